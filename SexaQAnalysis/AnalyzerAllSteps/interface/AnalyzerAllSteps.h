@@ -52,6 +52,9 @@ using namespace std;
 #include "SimDataFormats/Associations/interface/VertexToTrackingVertexAssociator.h"
 #include "SimDataFormats/Associations/interface/TrackToTrackingParticleAssociator.h"
 #include "SimDataFormats/TrackingAnalysis/interface/TrackingParticle.h"
+#include "SexaQAnalysis/Skimming/interface/GoodPrimaryVertices.h"
+#include "LineArrays.h"
+#include "GeometryKernels.h"
  
 class AnalyzerAllSteps : public edm::EDAnalyzer
  {
@@ -85,27 +88,31 @@ class AnalyzerAllSteps : public edm::EDAnalyzer
     //some functions to calculate kinematic variables which are used everywhere
     double static openings_angle(reco::Candidate::Vector momentum1, reco::Candidate::Vector momentum2);
     double static deltaR(double phi1, double eta1, double phi2, double eta2);
-    double static lxy(TVector3 v1, TVector3 v2);
-    double static lxyz(TVector3 v1, TVector3 v2);
-    TVector3 static PCA_line_point(TVector3 Point_line, TVector3 Vector_along_line, TVector3 Point);
-    TVector3 static vec_dxy_line_point(TVector3 Point_line, TVector3 Vector_along_line, TVector3 Point);
-    double static dxy_signed_line_point(TVector3 Point_line, TVector3 Vector_along_line, TVector3 Point);
-    double static dxyz_signed_line_point(TVector3 Point_line_in, TVector3 Vector_along_line_in, TVector3 Point_in);
+    //the TVector3 versions of the kernels in GeometryKernels.h, use those directly in new code
+    double static lxy(const TVector3& v1, const TVector3& v2);
+    double static lxyz(const TVector3& v1, const TVector3& v2);
+    TVector3 static PCA_line_point(const TVector3& Point_line, const TVector3& Vector_along_line, const TVector3& Point);
+    TVector3 static vec_dxy_line_point(const TVector3& Point_line, const TVector3& Vector_along_line, const TVector3& Point);
+    double static dxy_signed_line_point(const TVector3& Point_line, const TVector3& Vector_along_line, const TVector3& Point);
+    double static dxyz_signed_line_point(const TVector3& Point_line_in, const TVector3& Vector_along_line_in, const TVector3& Point_in);
     double static std_dev_lxy(double vx, double vy, double vx_var, double vy_var, double bx_x, double bx_y, double bx_x_var, double bx_y_var);
-    double static XYpointingAngle(const reco::Candidate  * particle,TVector3 beamspot);
-    double static CosOpeningsAngle(TVector3 vec1, TVector3 vec2);
-    double static dz_line_point(TVector3 Point_line_in, TVector3 Vector_along_line_in, TVector3 Point_in);
-    TVector3 static dz_line_point_min(TVector3 Point_line_in, TVector3 Vector_along_line_in, edm::Handle<vector<reco::Vertex>> h_offlinePV);
+    double static XYpointingAngle(const reco::Candidate  * particle,const TVector3& beamspot);
+    double static CosOpeningsAngle(const TVector3& vec1, const TVector3& vec2);
+    double static dz_line_point(const TVector3& Point_line_in, const TVector3& Vector_along_line_in, const TVector3& Point_in);
+    //plain copies of a TVector3 for the kernels and back
+    static sexaq::Vec3 vec3(const TVector3& v) { return sexaq::Vec3(v.X(), v.Y(), v.Z()); }
+    static TVector3 tvector3(const sexaq::Vec3& v) { return TVector3(v.x, v.y, v.z); }
+    TVector3 static dz_line_point_min(TVector3 Point_line_in, TVector3 Vector_along_line_in, const PrimaryVertexArrays& PVs);
+    //the same for many lines at once: for every line the index in PVs of the PV which minimises |dz| (-1 if PVs is empty) and that dz (999. if none)
+    void static dz_line_point_min(const LineArrays& lines, const PrimaryVertexArrays& PVs, std::vector<int>& bestPV, std::vector<double>& dzmin);
+    //the kernel of both, on plain arrays: one pass over the PVs, for each PV the inner loop over the lines has no branches so it can be vectorized
+    void static dz_line_point_min(unsigned int nLines, const double* x, const double* y, const double* z, const double* px, const double* py, const double* pz, const double* pt,
+                                  unsigned int nPV, const double* PVx, const double* PVy, const double* PVz, int* bestPV, double* dzmin);
     double static sgn(double input);
     int static getDaughterParticlesTypes(const reco::Candidate * genParticle);
     int static trackQualityAsInt(const reco::Track *track);
-    std::vector<double> static isTpGrandDaughterAntiS(TrackingParticleCollection const & TPColl, const TrackingParticle& tp);
     double static EventWeightingFactor(double etaAntiS);
-    double static PUReweighingFactor(map<double,double>,double MC_PV_vz);
 
-    //definitions of the maps for the PU reweighing. These maps are obtained with /user/jdeclerc/CMSSW_8_0_30_bis/src/SexaQAnalysis/AnalyzerAllSteps/macros/PUReweighing each map is for a certain PU, starting at PU0. Each map has as key the absolute z location and as value the 2D (PU and z location of the valid PVs) reweighing parameter. At the end it includes a vector with all the maps, so when you need the reweighing parameter you need to go to a certain location in the vector, given by the PU, and then find the best mathing z value and get that key's value --> see src/AnalyzerAllSteps.cc for the actual values
-    static  map<double,double> mapPU0,mapPU1,mapPU2,mapPU3,mapPU4,mapPU5,mapPU6,mapPU7,mapPU8,mapPU9,mapPU10,mapPU11,mapPU12,mapPU13,mapPU14,mapPU15,mapPU16,mapPU17,mapPU18,mapPU19,mapPU20,mapPU21,mapPU22,mapPU23,mapPU24,mapPU25,mapPU26,mapPU27,mapPU28,mapPU29,mapPU30,mapPU31,mapPU32,mapPU33,mapPU34,mapPU35,mapPU36,mapPU37,mapPU38,mapPU39,mapPU40,mapPU41,mapPU42,mapPU43,mapPU44,mapPU45,mapPU46,mapPU47,mapPU48,mapPU49,mapPU50,mapPU51,mapPU52,mapPU53,mapPU54,mapPU55,mapPU56,mapPU57,mapPU58,mapPU59,mapPU60; 
-    static vector<map<double, double>> v_mapPU; 
 
     };
 
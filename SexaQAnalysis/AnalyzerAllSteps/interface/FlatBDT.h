@@ -0,0 +1,83 @@
+#ifndef FlatBDT_h
+#define FlatBDT_h
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+//AdaBoost BDT (TMVA BoostType=AdaBoost, UseYesNoLeaf=True) stored as flat arrays instead of a forest of BDTNode objects.
+//Every tree is padded to a complete binary tree of the same depth, so the children of node i are at 2i+1 (left) and 2i+2 (right) and no pointers are needed:
+//    features[tree*nInternal + i], thresholds[tree*nInternal + i]: an event goes right if x[feature] > threshold
+//    leafValues[tree*nLeaves + j]: boostWeight*nodeType/sum(boostWeights), so the score is just the sum over the trees
+//The arrays are generated from the TMVA weights (xml or class.C) with TMVA/Step1/makeFlatBDT.py. The thresholds are rounded down to float, which gives exactly
+//the same decisions as TMVA for float inputs, the score agrees with ReadBDT::GetMvaValue to float precision.
+//makeFlatBDT.py writes either a header with the arrays (for the standalone macros) or a binary payload, which is read at run time by the constructor from a file name (in src/FlatBDT.cc).
+//Binary payload layout (little endian): char[8] "SEXAQBD", uint32 version, uint32 nTrees, uint32 depth, uint32 nVars, nVars x (uint32 length, char[length] name),
+//uint8 features[nTrees][2^depth-1], float thresholds[nTrees][2^depth-1], double leafValues[nTrees][2^depth]
+class FlatBDT {
+  public:
+    static const unsigned int payloadVersion = 1;
+
+    //reads a payload written by makeFlatBDT.py, throws a cms::Exception if the file cannot be read or is not a valid payload
+    explicit FlatBDT(const std::string& fileName);
+
+    FlatBDT(const std::vector<std::string>& variables, unsigned int nTrees, unsigned int depth, const unsigned char* features, const float* thresholds, const double* leafValues):
+      variables_(variables),
+      nTrees_(nTrees),
+      depth_(depth),
+      nInternal_((1u << depth) - 1),
+      nLeaves_(1u << depth),
+      features_(features, features + nTrees*nInternal_),
+      thresholds_(thresholds, thresholds + nTrees*nInternal_),
+      leafValues_(leafValues, leafValues + nTrees*nLeaves_)
+    {
+    }
+
+    //the input variables, in the order expected in the feature rows
+    const std::vector<std::string>& variables() const { return variables_; }
+    unsigned int nVars() const { return variables_.size(); }
+    unsigned int nTrees() const { return nTrees_; }
+
+    //scores of n candidates: the nVars() features of candidate i are at features[i*nVars()], the score goes to out[i]
+    //the candidates are done in blocks, for every tree the whole block is pushed through, so the nodes of the tree stay in cache and the loop over the block has no dependencies between candidates
+    void evaluate(const float* features, std::size_t n, float* out) const {
+	const std::size_t nVars = variables_.size();
+	for(std::size_t first = 0; first < n; first += blockSize){
+		const std::size_t nBlock = (n - first < blockSize) ? n - first : blockSize;
+		const float* x = features + first*nVars;
+		double score[blockSize] = {0.};
+		for(unsigned int tree = 0; tree < nTrees_; ++tree){
+			const unsigned char* feature = &features_[tree*nInternal_];
+			const float* threshold = &thresholds_[tree*nInternal_];
+			const double* leaf = &leafValues_[tree*nLeaves_];
+			for(std::size_t c = 0; c < nBlock; ++c){
+				unsigned int node = 0;
+				for(unsigned int d = 0; d < depth_; ++d) node = 2*node + 1 + (x[c*nVars + feature[node]] > threshold[node]);
+				score[c] += leaf[node - nInternal_];
+			}
+		}
+		for(std::size_t c = 0; c < nBlock; ++c) out[first + c] = score[c];
+	}
+    }
+
+    //score of one candidate
+    float evaluate(const float* features) const {
+	float out;
+	evaluate(features, 1, &out);
+	return out;
+    }
+
+  private:
+    static const std::size_t blockSize = 64;
+
+    std::vector<std::string> variables_;
+    unsigned int nTrees_;
+    unsigned int depth_;
+    unsigned int nInternal_;
+    unsigned int nLeaves_;
+    std::vector<unsigned char> features_;
+    std::vector<float> thresholds_;
+    std::vector<double> leafValues_;
+};
+
+#endif
@@ -0,0 +1,928 @@
+#ifndef FlatBDT_2016vSelected19Parameters_h
+#define FlatBDT_2016vSelected19Parameters_h
+
+#include "SexaQAnalysis/AnalyzerAllSteps/interface/FlatBDT.h"
+
+//generated by TMVA/Step1/makeFlatBDT.py from TMVAClassification_BDT.class.C, do not edit
+//400 trees of depth 3, the features have to be given in the order of variables
+namespace FlatBDT_2016vSelected19Parameters {
+  const unsigned int nTrees = 400;
+  const unsigned int depth = 3;
+  const unsigned int nVars = 19;
+  const char* const variables[nVars] = {"_S_vz_interaction_vertex", "_S_lxy_interaction_vertex_beampipeCenter", "_S_daughters_deltaphi", "_S_daughters_deltaeta", "_S_daughters_openingsangle", "_S_daughters_DeltaR", "_S_Ks_openingsangle", "_S_Lambda_openingsangle", "_S_eta", "_Ks_eta", "_S_dxy_over_lxy", "_Ks_dxy_over_lxy", "_Lambda_dxy_over_lxy", "_S_dz_min", "_Ks_dz_min", "_Lambda_dz_min", "_Ks_pt", "_Lambda_lxy_decay_vertex", "_S_chi2_ndof"};
+  //the TMVA dataset (directory of the training) the weights were taken from, DiscrApplication.C checks it against the dataset it is asked to apply
+  const char* const dataset = "dataset_BDT_2016dataset_BDT_2016vSelected19Parameters_CutFiducialRegion_CutDeltaPhi_CutLxy_CutDxyOverLxy_SignalWeighing";
+
+  const unsigned char features[] = {
+	12, 10, 10, 4, 0, 0, 0, 12, 12, 10, 0, 0, 0, 0, 12, 4, 10, 5, 0, 0, 0, 12, 14, 10, 14, 0, 0, 0,
+	12, 0, 16, 0, 0, 0, 0, 12, 10, 1, 5, 0, 0, 0, 4, 16, 0, 12, 0, 0, 0, 18, 4, 16, 0, 0, 0, 0,
+	12, 0, 5, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 5, 4, 0, 0, 12, 0, 0, 15, 15, 0, 0, 15, 0, 0,
+	10, 5, 16, 0, 7, 0, 11, 7, 0, 5, 0, 0, 1, 0, 1, 0, 5, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 16,
+	10, 1, 8, 0, 18, 0, 0, 15, 0, 15, 0, 0, 10, 0, 1, 0, 1, 0, 0, 4, 0, 15, 0, 0, 0, 0, 0, 0,
+	18, 11, 17, 0, 7, 9, 0, 5, 0, 17, 0, 0, 0, 5, 3, 0, 4, 0, 0, 0, 1, 12, 0, 17, 0, 0, 0, 18,
+	14, 0, 0, 0, 0, 0, 16, 1, 4, 0, 16, 0, 0, 0, 1, 5, 1, 7, 0, 10, 11, 4, 16, 12, 0, 0, 0, 0,
+	10, 7, 0, 4, 0, 0, 0, 15, 15, 0, 0, 17, 0, 0, 17, 17, 0, 0, 0, 0, 0, 12, 10, 6, 17, 0, 0, 3,
+	7, 16, 0, 4, 11, 0, 0, 3, 0, 12, 0, 0, 0, 10, 14, 12, 0, 14, 1, 0, 0, 3, 3, 0, 0, 5, 0, 0,
+	1, 0, 3, 0, 0, 11, 3, 14, 15, 16, 0, 0, 0, 0, 7, 16, 0, 4, 5, 0, 0, 4, 6, 0, 16, 0, 0, 0,
+	4, 16, 18, 0, 0, 1, 0, 10, 4, 0, 16, 12, 0, 0, 10, 3, 0, 15, 0, 0, 0, 15, 15, 0, 0, 15, 0, 0,
+	11, 16, 11, 18, 0, 0, 16, 3, 4, 0, 0, 3, 0, 0, 10, 3, 0, 1, 0, 0, 0, 14, 11, 2, 0, 0, 0, 2,
+	10, 17, 17, 0, 3, 6, 0, 0, 18, 0, 0, 0, 14, 9, 5, 0, 0, 0, 0, 0, 0, 1, 6, 0, 10, 0, 0, 0,
+	3, 0, 0, 0, 0, 0, 9, 10, 3, 0, 0, 8, 0, 0, 3, 0, 14, 0, 0, 11, 12, 0, 0, 0, 0, 0, 0, 0,
+	11, 0, 1, 0, 0, 0, 10, 6, 1, 0, 3, 0, 0, 0, 1, 0, 17, 0, 0, 0, 10, 9, 3, 7, 5, 17, 0, 0,
+	0, 16, 11, 0, 0, 0, 10, 3, 0, 4, 0, 0, 10, 12, 4, 17, 11, 0, 11, 0, 16, 10, 1, 12, 18, 10, 0, 0,
+	0, 16, 0, 0, 0, 0, 0, 3, 4, 0, 16, 3, 0, 0, 1, 10, 9, 1, 0, 0, 1, 0, 0, 8, 0, 0, 0, 3,
+	11, 16, 14, 6, 0, 1, 0, 1, 0, 17, 0, 0, 0, 0, 15, 0, 1, 0, 0, 4, 0, 4, 0, 0, 0, 0, 1, 0,
+	0, 9, 0, 2, 0, 0, 0, 4, 16, 11, 0, 0, 7, 16, 5, 11, 0, 0, 10, 0, 0, 7, 0, 5, 0, 0, 3, 8,
+	3, 14, 0, 2, 0, 0, 0, 12, 9, 9, 0, 0, 0, 17, 9, 14, 13, 15, 0, 0, 6, 5, 0, 16, 0, 0, 12, 11,
+	3, 9, 0, 8, 10, 0, 0, 8, 15, 16, 0, 9, 0, 15, 0, 15, 2, 0, 15, 0, 2, 4, 12, 15, 6, 11, 0, 4,
+	9, 10, 0, 18, 17, 0, 4, 5, 0, 17, 0, 0, 3, 0, 8, 13, 16, 11, 0, 0, 2, 17, 1, 16, 1, 0, 1, 0,
+	0, 0, 0, 7, 0, 0, 0, 4, 16, 0, 16, 0, 0, 0, 1, 1, 0, 0, 8, 0, 0, 0, 17, 9, 0, 11, 0, 0,
+	3, 0, 18, 0, 0, 11, 0, 7, 16, 0, 0, 4, 0, 0, 6, 10, 11, 6, 0, 0, 0, 3, 0, 3, 0, 0, 0, 17,
+	10, 5, 4, 7, 15, 0, 0, 2, 10, 12, 5, 0, 0, 0, 3, 15, 12, 0, 0, 16, 0, 4, 0, 17, 0, 0, 0, 7,
+	2, 2, 18, 11, 0, 0, 0, 15, 9, 0, 8, 0, 0, 0, 18, 9, 0, 9, 18, 0, 0, 14, 4, 0, 0, 0, 0, 12,
+	8, 10, 15, 0, 7, 10, 12, 9, 3, 0, 10, 0, 0, 10, 5, 10, 11, 0, 0, 9, 0, 0, 0, 2, 0, 0, 9, 0,
+	0, 0, 10, 0, 0, 18, 0, 12, 6, 5, 11, 0, 0, 16, 4, 15, 0, 0, 0, 0, 0, 15, 5, 0, 3, 0, 0, 0,
+	7, 18, 0, 3, 0, 0, 0, 4, 10, 0, 4, 5, 0, 0, 6, 7, 5, 0, 10, 0, 10, 0, 11, 16, 10, 7, 0, 0,
+	1, 0, 0, 17, 7, 9, 0, 3, 11, 0, 9, 0, 0, 0, 12, 10, 4, 0, 8, 16, 0, 4, 17, 0, 6, 2, 0, 0,
+	14, 2, 2, 16, 0, 7, 0, 0, 0, 4, 0, 0, 0, 0, 17, 0, 10, 0, 0, 0, 17, 18, 11, 0, 9, 11, 0, 0,
+	3, 0, 18, 0, 0, 0, 10, 4, 0, 3, 0, 0, 10, 0, 14, 1, 0, 0, 5, 0, 0, 4, 5, 0, 0, 0, 0, 0,
+	14, 1, 4, 0, 9, 0, 0, 3, 14, 0, 4, 0, 0, 0, 17, 12, 0, 10, 0, 0, 0, 3, 0, 3, 0, 0, 0, 9,
+	0, 10, 0, 17, 0, 0, 0, 6, 12, 1, 4, 0, 0, 1, 1, 14, 4, 16, 12, 0, 4, 4, 5, 0, 0, 15, 0, 0,
+	17, 12, 10, 12, 0, 11, 0, 4, 0, 4, 0, 0, 4, 0, 12, 0, 13, 0, 0, 9, 0, 10, 9, 0, 0, 16, 0, 0,
+	11, 12, 10, 0, 0, 0, 18, 5, 7, 11, 12, 0, 13, 4, 11, 12, 16, 0, 12, 2, 0, 4, 16, 3, 16, 10, 0, 0,
+	12, 12, 17, 0, 12, 0, 8, 0, 9, 0, 0, 9, 0, 0, 6, 5, 15, 11, 8, 0, 0, 1, 0, 1, 0, 0, 17, 0,
+	3, 1, 0, 0, 1, 0, 0, 4, 0, 11, 0, 0, 7, 18, 0, 0, 0, 0, 11, 0, 0, 10, 5, 7, 0, 6, 0, 2,
+	18, 2, 10, 0, 0, 15, 18, 3, 11, 0, 9, 12, 0, 0, 11, 4, 1, 0, 0, 0, 11, 0, 9, 4, 12, 0, 0, 0,
+	2, 13, 3, 0, 9, 0, 5, 4, 14, 0, 14, 0, 0, 0, 10, 3, 1, 5, 0, 0, 0, 1, 0, 1, 0, 0, 10, 0,
+	9, 12, 3, 0, 2, 0, 0, 12, 9, 0, 10, 0, 0, 0, 16, 4, 11, 0, 12, 0, 0, 5, 0, 15, 0, 0, 0, 15,
+	1, 14, 15, 11, 0, 0, 18, 1, 2, 10, 0, 0, 1, 5, 4, 17, 0, 6, 0, 0, 0, 4, 3, 0, 0, 5, 0, 0,
+	6, 16, 12, 0, 0, 10, 0, 4, 0, 3, 0, 0, 0, 3, 11, 16, 10, 0, 0, 6, 0, 0, 0, 1, 0, 0, 18, 0,
+	1, 16, 3, 15, 10, 0, 0, 18, 6, 0, 11, 1, 0, 0, 14, 3, 0, 0, 0, 0, 0, 2, 9, 9, 0, 18, 0, 0,
+	18, 9, 0, 12, 17, 0, 0, 17, 1, 7, 0, 0, 0, 14, 7, 16, 3, 0, 0, 8, 8, 6, 15, 0, 0, 0, 0, 0,
+	1, 0, 9, 0, 0, 8, 0, 6, 0, 16, 0, 0, 16, 12, 18, 17, 0, 0, 0, 0, 0, 1, 0, 5, 0, 0, 0, 18,
+	16, 16, 4, 6, 14, 0, 0, 3, 0, 15, 0, 0, 12, 0, 2, 0, 4, 0, 0, 18, 0, 18, 17, 0, 11, 5, 0, 0,
+	17, 11, 0, 15, 0, 0, 0, 11, 0, 15, 0, 0, 0, 15, 17, 0, 17, 0, 0, 7, 10, 2, 2, 10, 12, 0, 0, 0,
+	5, 4, 0, 0, 0, 0, 0, 11, 4, 18, 12, 0, 0, 0, 3, 0, 16, 0, 0, 16, 0, 17, 18, 0, 10, 0, 0, 0,
+	3, 0, 9, 0, 0, 0, 9, 4, 12, 4, 11, 9, 0, 9, 6, 10, 0, 14, 16, 0, 0, 10, 1, 0, 0, 1, 0, 0,
+	11, 16, 10, 11, 0, 0, 0, 3, 0, 15, 0, 5, 0, 0, 10, 8, 0, 1, 8, 0, 0, 13, 0, 15, 0, 0, 0, 8,
+	17, 1, 1, 0, 1, 0, 0, 2, 7, 0, 0, 3, 0, 9, 5, 9, 0, 16, 6, 0, 0, 4, 16, 11, 0, 12, 0, 0,
+	10, 12, 0, 4, 7, 0, 0, 2, 7, 4, 10, 0, 0, 0, 8, 18, 16, 0, 3, 0, 0, 3, 0, 4, 0, 0, 18, 0,
+	0, 5, 18, 1, 0, 0, 12, 10, 4, 0, 6, 0, 0, 0, 17, 0, 18, 0, 0, 0, 17, 15, 1, 0, 0, 17, 0, 0,
+	0, 2, 9, 0, 2, 0, 0, 11, 16, 4, 0, 0, 10, 0, 9, 6, 3, 17, 3, 0, 0, 9, 16, 10, 0, 10, 0, 18,
+	5, 5, 0, 0, 11, 0, 0, 12, 2, 1, 0, 0, 0, 0, 5, 0, 3, 0, 0, 0, 0, 18, 3, 16, 0, 2, 9, 4,
+	4, 16, 12, 16, 4, 0, 10, 10, 10, 0, 9, 0, 0, 0, 6, 1, 1, 0, 16, 0, 9, 4, 12, 0, 15, 0, 0, 0,
+	15, 17, 18, 0, 11, 0, 6, 4, 0, 3, 0, 0, 0, 0, 8, 3, 0, 0, 13, 0, 0, 2, 0, 5, 0, 0, 0, 4,
+	10, 4, 11, 5, 12, 5, 0, 3, 0, 15, 0, 0, 15, 0, 13, 0, 9, 0, 0, 0, 11, 7, 7, 14, 0, 0, 0, 0,
+	16, 12, 11, 16, 0, 0, 0, 17, 3, 1, 0, 1, 0, 0, 5, 6, 15, 10, 0, 4, 0, 3, 1, 10, 16, 0, 9, 0,
+	10, 8, 0, 0, 0, 0, 0, 9, 0, 11, 3, 0, 18, 0, 18, 2, 0, 3, 17, 0, 0, 5, 0, 0, 0, 0, 0, 11,
+	4, 0, 12, 0, 0, 4, 4, 4, 18, 15, 0, 0, 14, 0, 1, 18, 17, 1, 0, 0, 0, 5, 0, 1, 0, 0, 0, 9,
+	1, 0, 7, 0, 0, 7, 0, 12, 15, 0, 0, 0, 6, 0, 4, 0, 12, 0, 0, 0, 7, 5, 18, 5, 15, 0, 0, 0,
+	2, 0, 2, 0, 0, 2, 0, 7, 7, 0, 7, 0, 0, 0, 5, 8, 12, 0, 17, 11, 0, 10, 4, 12, 4, 0, 4, 0,
+	0, 3, 0, 7, 10, 0, 0, 1, 0, 1, 0, 0, 10, 17, 11, 18, 11, 0, 9, 0, 12, 9, 3, 0, 0, 3, 0, 0,
+	14, 10, 14, 0, 0, 9, 2, 1, 17, 17, 9, 6, 0, 4, 12, 11, 10, 0, 10, 16, 0, 9, 11, 7, 0, 0, 0, 0,
+	3, 7, 0, 16, 0, 0, 0, 4, 10, 3, 11, 0, 0, 0, 4, 5, 0, 16, 6, 0, 0, 12, 3, 0, 0, 12, 0, 0,
+	15, 4, 1, 0, 0, 11, 0, 1, 0, 10, 0, 0, 17, 17, 17, 1, 3, 0, 0, 0, 18, 1, 1, 17, 8, 0, 0, 0,
+	10, 1, 0, 0, 17, 0, 0, 12, 0, 4, 0, 0, 0, 12, 5, 17, 0, 1, 10, 0, 0, 3, 0, 11, 0, 0, 17, 0,
+	12, 7, 17, 0, 4, 0, 2, 15, 17, 11, 0, 5, 0, 14, 7, 2, 0, 2, 10, 0, 0, 3, 4, 0, 9, 9, 0, 0,
+	0, 0, 11, 0, 0, 4, 0, 17, 8, 0, 0, 0, 0, 0, 1, 0, 15, 0, 0, 18, 12, 14, 11, 0, 0, 16, 0, 0,
+	11, 12, 5, 0, 7, 0, 18, 1, 10, 2, 5, 16, 0, 0, 4, 0, 15, 0, 0, 12, 0, 14, 11, 6, 0, 0, 10, 0,
+	0, 10, 14, 0, 7, 0, 0, 4, 1, 0, 0, 2, 0, 0, 4, 16, 17, 0, 2, 1, 3, 4, 2, 0, 0, 0, 0, 0,
+	0, 18, 9, 0, 8, 10, 0, 0, 9, 10, 0, 0, 12, 0, 8, 10, 8, 5, 4, 0, 0, 18, 6, 1, 2, 0, 12, 0,
+	4, 10, 0, 0, 0, 0, 0, 2, 2, 14, 9, 0, 0, 4, 18, 2, 0, 7, 1, 0, 0, 1, 8, 10, 0, 0, 0, 0,
+	10, 11, 7, 0, 11, 17, 3, 11, 11, 0, 12, 8, 0, 0, 9, 12, 6, 0, 9, 11, 0, 17, 0, 11, 0, 0, 11, 9,
+	10, 3, 11, 11, 0, 0, 0, 17, 12, 11, 17, 0, 0, 9, 16, 16, 17, 0, 9, 0, 0, 18, 10, 0, 1, 0, 0, 0,
+	7, 10, 0, 9, 5, 0, 0, 14, 11, 0, 0, 1, 0, 0, 17, 5, 10, 4, 0, 0, 0, 5, 16, 0, 4, 0, 0, 0,
+	4, 3, 0, 4, 0, 0, 0, 18, 10, 0, 9, 11, 0, 0, 18, 14, 11, 0, 11, 0, 6, 10, 12, 18, 18, 0, 18, 0,
+	1, 11, 2, 0, 6, 0, 11, 10, 1, 7, 0, 1, 0, 4, 0, 11, 3, 16, 0, 18, 0, 3, 0, 0, 0, 0, 3, 0,
+	18, 5, 0, 7, 0, 0, 0, 2, 15, 6, 0, 0, 16, 0, 7, 17, 4, 7, 13, 0, 5, 5, 10, 11, 0, 0, 1, 0,
+	14, 8, 16, 1, 14, 14, 0, 12, 1, 11, 0, 8, 0, 4, 3, 0, 10, 0, 0, 12, 3, 10, 9, 0, 16, 17, 0, 0,
+	0, 10, 2, 3, 0, 0, 0, 18, 3, 0, 0, 0, 0, 0, 1, 0, 13, 0, 0, 0, 8, 15, 1, 0, 0, 10, 0, 0,
+	5, 0, 7, 0, 0, 17, 0, 15, 1, 0, 0, 6, 0, 0, 3, 4, 4, 16, 9, 0, 0, 5, 10, 17, 0, 12, 11, 0,
+	9, 18, 3, 1, 0, 0, 0, 0, 0, 14, 0, 0, 8, 0, 10, 9, 0, 0, 2, 0, 0, 3, 0, 0, 0, 17, 0, 0,
+	1, 0, 13, 0, 0, 0, 0, 6, 11, 0, 0, 11, 0, 0, 14, 0, 15, 0, 0, 0, 3, 12, 12, 7, 0, 4, 0, 4,
+	4, 15, 0, 15, 0, 0, 0, 6, 9, 17, 0, 0, 17, 17, 1, 18, 0, 0, 17, 0, 0, 18, 3, 0, 0, 5, 0, 0,
+	3, 12, 1, 3, 7, 0, 0, 18, 18, 1, 15, 14, 0, 0, 17, 11, 0, 10, 0, 0, 0, 0, 8, 7, 5, 0, 0, 11,
+	15, 10, 0, 0, 5, 0, 0, 3, 0, 15, 0, 0, 1, 17, 6, 12, 14, 0, 0, 0, 14, 14, 0, 18, 0, 0, 4, 17,
+	10, 14, 12, 0, 3, 0, 0, 17, 2, 3, 7, 16, 0, 0, 2, 18, 15, 0, 2, 0, 0, 11, 16, 9, 0, 0, 8, 0,
+	7, 11, 0, 0, 16, 0, 0, 11, 10, 3, 0, 2, 0, 9, 13, 0, 6, 0, 0, 1, 0, 0, 0, 9, 0, 0, 14, 3,
+	17, 10, 8, 0, 0, 3, 0, 5, 0, 17, 0, 0, 11, 4, 12, 2, 2, 0, 1, 0, 3, 9, 0, 0, 2, 0, 3, 0,
+	3, 0, 17, 0, 0, 6, 0, 2, 0, 2, 0, 0, 0, 0, 7, 10, 16, 0, 6, 15, 11, 15, 8, 0, 0, 10, 0, 0,
+	0, 0, 0, 7, 0, 0, 0, 9, 18, 10, 0, 16, 0, 9, 12, 18, 12, 11, 0, 0, 0, 3, 11, 4, 0, 0, 0, 0,
+	4, 0, 12, 2, 0, 0, 0, 3, 17, 2, 0, 0, 0, 0, 3, 8, 1, 0, 0, 14, 0, 2, 16, 0, 10, 0, 0, 17,
+	4, 0, 12, 0, 0, 9, 4, 3, 0, 12, 0, 0, 0, 0, 6, 10, 12, 9, 0, 0, 0, 8, 0, 0, 12, 0, 0, 14,
+	7, 7, 0, 0, 18, 0, 0, 15, 12, 0, 7, 0, 0, 0, 4, 18, 17, 10, 16, 0, 1, 0, 11, 18, 0, 11, 0, 0,
+	4, 7, 0, 15, 10, 0, 0, 17, 18, 10, 2, 11, 0, 9, 9, 0, 17, 16, 8, 0, 0, 11, 0, 4, 0, 0, 0, 15,
+	9, 1, 18, 0, 17, 0, 0, 14, 18, 2, 0, 10, 0, 11, 3, 18, 0, 0, 6, 0, 0, 10, 17, 16, 1, 9, 6, 0,
+	15, 0, 11, 0, 0, 0, 17, 3, 18, 3, 7, 0, 0, 10, 11, 8, 3, 0, 15, 3, 0, 4, 11, 0, 18, 10, 0, 0,
+  };
+
+  const float thresholds[] = {
+	0.238096997f, 0.0952483937f, 0.190504998f, 1.39926994f, 0.0f, 0.0f, 0.0f,
+	0.142856985f, -0.0205199011f, 0.261905998f, 0.0f, 0.0f, 0.0f, 0.0f,
+	0.333332986f, 1.68524992f, 0.142860994f, 2.43379998f, 0.0f, 0.0f, 0.0f,
+	0.428571999f, 1.34410989f, 0.166697994f, -0.53828305f, 0.0f, 0.0f, 0.0f,
+	0.333332986f, 0.0f, 1.70018995f, 0.0f, 0.0f, 0.0f, 0.0f,
+	0.238094985f, 0.190482989f, 2.14664984f, 3.48578978f, 0.0f, 0.0f, 0.0f,
+	1.68524992f, 1.67623997f, 0.0f, 0.0466653965f, 0.0f, 0.0f, 0.0f,
+	2.85587978f, 1.83386993f, 2.35505986f, 0.0f, 0.0f, 0.0f, 0.0f,
+	0.238096997f, 0.0f, 1.68076992f, 0.0f, 0.0f, 0.0f, 1.37179995f,
+	-9.69270039f, 0.0f, 8.35824966f, 0.0f, 0.0f, 0.0f, 0.0f,
+	3.22259998f, 0.52312696f, 0.0f, 0.0f, 0.0476191975f, 0.0f, 0.0f,
+	0.999605954f, -0.262994021f, 0.0f, 0.0f, 0.215968996f, 0.0f, 0.0f,
+	0.0714314952f, 2.97777987f, 1.56843996f, 0.0f, 0.296956986f, 0.0f, 0.523810983f,
+	0.150564998f, 0.0f, 3.24626994f, 0.0f, 0.0f, 2.29104996f, 0.0f,
+	2.11048985f, 0.0f, 1.50191998f, 0.0f, 0.0f, 0.0f, 3.10950994f,
+	-6.75132036f, 0.0f, 6.56879997f, 0.0f, 0.0f, 0.0f, 1.67579997f,
+	0.119057f, 2.12857985f, -2.36247015f, 0.0f, 1.90420997f, 0.0f, 0.0f,
+	-0.775817037f, 0.0f, 0.291615993f, 0.0f, 0.0f, 0.0476290993f, 0.0f,
+	2.12855983f, 0.0f, 2.27070999f, 0.0f, 0.0f, 0.54764998f, 3.63083982f,
+	-0.719539046f, 0.0f, 7.44503975f, 0.0f, 0.0f, 0.0f, 0.0f,
+	1.90475988f, -0.142857f, 10.9625998f, 0.0f, 0.152441993f, 1.57996988f, 0.0f,
+	0.991351962f, 0.0f, 4.4547596f, 0.0f, 0.0f, 0.0f, 3.18275976f,
+	-1.66798007f, 0.0f, 0.380546987f, 0.0f, 0.0f, 0.0f, 2.07430983f,
+	0.0476204976f, -5.74773026f, 6.79099989f, 0.0f, 0.0f, 0.0f, 3.80783987f,
+	-0.636290014f, 0.0f, 6.93171978f, 0.0f, 0.0f, 0.0f, 2.2248199f,
+	2.34563994f, 0.669401944f, 0.0f, 2.6360898f, 6.67233992f, 0.0f, 0.0f,
+	2.16476989f, 2.97652984f, 2.2767899f, 0.27778399f, 0.0f, 0.166551992f, -0.0476186015f,
+	0.67048198f, 1.91968f, 0.0476190969f, 0.0f, 0.0f, 3.20285988f, 0.0f,
+	0.404762983f, 0.74347198f, 0.0f, 0.670045972f, 0.0f, 0.0f, 0.0f,
+	0.69580096f, -0.40536502f, 0.0f, -4.01270008f, 4.68124962f, 0.0f, 0.0f,
+	4.4492197f, 2.64605999f, 0.0f, -1.00465012f, 0.0f, 0.0f, 0.0f,
+	0.238098994f, 0.309530973f, 0.328985989f, 15.1577997f, 0.0f, 0.0f, 0.644471943f,
+	0.741875947f, 1.5836699f, 0.0f, 1.11088991f, 0.333332986f, 0.0f, 0.0f,
+	-2.07454014f, 0.0f, 0.238094985f, 0.0f, 0.0f, -3.31823015f, 0.0713918954f,
+	0.379865974f, 0.142864987f, 0.0f, -0.467767f, 2.25519991f, 0.0f, 0.0f,
+	1.68501997f, -1.76142001f, 0.0f, 0.0f, 1.09162998f, 0.0f, 0.0f,
+	2.07430983f, 0.0f, -0.793383002f, 0.0f, 0.0f, -0.238085002f, 1.84272993f,
+	0.260538995f, -0.413211018f, 1.23687994f, 0.0f, 0.0f, 0.0f, 0.0f,
+	0.74347198f, 1.30597997f, 0.0f, 1.10781991f, 2.93256998f, 0.0f, 0.0f,
+	1.97654998f, 1.1997999f, 0.0f, 2.29660988f, 0.0f, 0.0f, 0.0f,
+	0.675921977f, 2.65250993f, 4.76147985f, 0.0f, 0.0f, 2.14669991f, 0.0f,
+	0.380951971f, 0.675226986f, 0.0f, 2.65676999f, 0.0476190969f, 0.0f, 0.0f,
+	0.309525996f, 1.53126991f, 0.0f, 0.482570976f, 0.0f, 0.0f, 0.0f,
+	0.482570976f, -0.865858018f, 0.0f, 0.0f, -0.0947377011f, 0.0f, 0.0f,
+	-0.0476189032f, 1.23348999f, 0.301605999f, 1.42793f, 0.0f, 0.0f, 1.60953999f,
+	2.05817986f, 0.674310982f, 0.0f, 0.0f, -1.91477001f, 0.0f, 0.0f,
+	0.40476498f, 1.66801f, 0.0f, 2.16475987f, 0.0f, 0.0f, 0.0f,
+	0.291829973f, 0.71428597f, -0.448779017f, 0.0f, 0.0f, 0.0f, 2.13500977f,
+	0.119051993f, 2.70379996f, 14.9838991f, 0.0f, 1.16655993f, 0.755594969f, 0.0f,
+	-7.19667006f, 1.89165998f, 4.21875954f, 0.0f, 0.0f, -0.249471009f, 0.132237986f,
+	3.45326996f, -8.9847908f, 0.0f, 0.0f, 3.07575989f, 0.0f, 0.0f,
+	2.34564996f, 2.67479992f, 0.0f, 0.214295998f, 0.0f, 0.0f, 0.0f,
+	-1.69313002f, 0.0f, -10.0824003f, 0.0f, 0.0f, 0.0f, -1.34957004f,
+	0.380951971f, -1.13465011f, 0.0f, 0.0f, 0.0490739979f, 0.0f, 0.0f,
+	-1.72189009f, 0.0f, -0.56101203f, 0.0f, 0.0f, 0.0476186983f, 0.0476257987f,
+	11.2379999f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+	-0.809523046f, 0.0f, 2.07429981f, 0.0f, 0.0f, 0.0f, 0.0238271989f,
+	2.68785977f, 2.25519991f, 0.0f, -1.29455006f, 0.0f, 0.0f, 0.0f,
+	2.07430983f, 0.0f, 2.34802985f, 0.0f, 0.0f, 0.0f, 0.333344996f,
+	0.859939992f, 0.581056952f, 0.158283994f, 1.4531399f, 15.1590996f, 0.0f, 2.13728976f,
+	-6.12553024f, 1.88300991f, 0.0476189964f, 0.0f, 0.0f, 5.91210985f, 0.0238186996f,
+	-1.72250009f, 0.0f, 0.814843953f, 0.0f, 0.0f, 0.261914998f, 0.142857999f,
+	0.670351982f, 4.78012991f, 0.0476196967f, 0.0f, 0.523808956f, 0.0f, 1.76364994f,
+	0.21429199f, 2.25521994f, 0.142595991f, 1.42815995f, 0.0714102983f, 0.0f, 0.0f,
+	-5.28281021f, 1.17303991f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+	1.5832299f, 0.814903975f, 0.0f, 1.61186993f, -1.56475008f, 0.0f, 0.0f,
+	2.29138994f, 0.333338976f, -0.606559038f, 2.17507982f, 0.0f, 0.0f, 2.34306979f,
+	-6.82632017f, 0.0f, -2.25523019f, 0.0f, 0.0f, 0.0f, 0.778811991f,
+	-0.142857f, 1.10980999f, -0.0516079031f, 1.15990996f, 0.0f, 2.21922994f, 0.0f,
+	2.12857985f, 0.0f, 6.5599699f, 0.0f, 0.0f, 0.0f, -8.1545105f,
+	-0.719539046f, 0.0f, 2.25521994f, 0.0f, 0.0f, 0.824004948f, 0.0f,
+	0.530521989f, 0.0f, 11.8292999f, 0.0f, 0.0f, 2.16475987f, 0.0f,
+	6.55280972f, 0.880971968f, 0.0f, -0.448722005f, 0.0f, 0.0f, 0.0f,
+	0.669838965f, 2.18867993f, 0.0476189964f, 0.0f, 0.0f, 0.302601993f, 1.1547699f,
+	3.48578978f, 0.619047999f, 0.0f, 0.0f, 0.23802799f, 0.0f, 0.0f,
+	0.301918f, 0.0f, 2.99771976f, 0.0f, 0.0f, 0.973093987f, -1.48888004f,
+	1.68501997f, 0.291829973f, 0.0f, 2.54317999f, 0.0f, 0.0f, 0.0f,
+	0.142858997f, -0.094478704f, -0.603607059f, 0.0f, 0.0f, 0.0f, 13.1804991f,
+	0.834134996f, 0.262258977f, -0.987191021f, -0.528017044f, 0.0f, 0.0f, 0.750353992f,
+	0.999208987f, 0.0f, 2.34782982f, 0.0f, 0.0f, 0.0476334989f, 0.0476184972f,
+	1.66801f, -1.59212005f, 0.0f, -2.23380017f, 0.309531987f, 0.0f, 0.0f,
+	2.10909986f, -0.413211018f, 1.42692995f, 0.0f, -0.598382056f, 0.0f, 0.0460623987f,
+	-1.5699501f, -0.299425006f, 2.24396992f, 0.0f, 0.197222993f, 0.0f, 2.88514996f,
+	0.960169971f, 0.0476189964f, -0.0659769028f, 0.324799985f, -0.333334029f, 0.0f, 2.40905976f,
+	0.882537961f, 0.119052999f, 1.00189996f, 3.33301997f, 4.85025978f, 0.0f, 0.667463958f,
+	1.49469995f, 0.0f, 15.1714993f, 0.0f, 0.0f, 1.13373995f, 0.0f,
+	1.38762999f, 2.08852983f, 1.08189988f, 0.90476197f, 0.0f, 0.0f, -0.747866035f,
+	17.2231998f, 2.27331996f, 1.29582f, 2.15266991f, 0.0f, 2.20102978f, 0.0f,
+	9.10337925f, -4.67889023f, 0.0f, 0.158308998f, 0.0f, 0.0f, 0.0f,
+	1.6890099f, 1.69177997f, 0.0f, 1.21137989f, 0.0f, 0.0f, 0.0f,
+	2.34568977f, 2.17504978f, 0.0f, 0.0f, 2.32087994f, 0.0f, 0.0f,
+	8.39519978f, 2.34840989f, 1.53419995f, 0.0f, 0.0476189964f, 0.0f, 0.0f,
+	-1.62215006f, 0.0f, 8.08833981f, 0.0f, 0.0f, -0.0476191007f, 0.0f,
+	0.747229993f, 1.21954f, 0.0f, 0.0f, 0.686087966f, 0.0f, 0.0f,
+	1.04840994f, 0.0476404987f, -0.0476161018f, 0.356913984f, 0.0f, 0.0f, 0.749873996f,
+	-1.13465011f, 0.0f, 1.19271994f, 0.0f, 0.0f, 0.0f, 19.4062996f,
+	0.214292988f, 2.72941995f, 1.54898989f, 0.234276995f, -0.140439004f, 0.0f, 0.0f,
+	2.84236979f, 0.309449971f, 0.0122732995f, 1.22774994f, 0.0f, 0.0f, 0.0f,
+	-0.63815403f, -0.133410007f, 0.142856985f, 0.0f, 2.52752995f, 1.72351992f, 0.0f,
+	0.52521795f, 0.0f, 2.34802985f, 0.0f, 0.0f, 0.0f, 0.150445998f,
+	2.24396992f, -0.833507001f, 3.80783987f, 0.142856985f, 0.0f, 0.0f, 0.0f,
+	0.482570976f, 1.12491989f, 0.0f, 1.8933599f, 0.0f, 0.0f, 0.0f,
+	7.14284992f, -1.58254004f, 0.0f, -1.91140008f, 3.40106988f, 0.0f, 0.0f,
+	-0.56101203f, 0.816814959f, -4.89148045f, 0.0f, 0.0f, 0.0f, 0.0476177968f,
+	-1.3487401f, 0.119034f, 0.0539506972f, 0.0f, 0.302848995f, 0.0475987978f, 0.333422989f,
+	1.13521993f, -0.748921037f, 2.85292983f, 0.0716637969f, 0.0f, 0.0f, 0.0952710956f,
+	2.98893976f, 0.309485972f, -0.0476162024f, 0.0f, 0.0f, -0.836886048f, 0.0f,
+	-8.31297016f, 0.0f, -1.34639001f, 0.0f, 0.0f, 0.834417999f, 0.0f,
+	-11.2768002f, 0.0f, 0.214292988f, 0.0f, 0.0f, 4.76147985f, 0.0f,
+	0.0476191975f, 1.64477992f, 1.47106993f, 0.142856985f, 0.0f, 0.0f, 1.24167991f,
+	1.97728992f, 0.421177f, 0.0f, -10.1278009f, 0.0f, 0.0f, 0.0f,
+	0.482570976f, 2.97682977f, 0.0f, 0.423331976f, 0.0f, 0.0f, 0.0f,
+	0.896089971f, 7.61563969f, 0.0f, -1.16822004f, 0.0f, 0.0f, 0.0f,
+	1.68441999f, 0.142791986f, 0.0f, 0.701916993f, 1.27519f, 0.0f, 0.0f,
+	0.751490951f, 0.166661993f, 1.90096998f, 0.0f, 0.0476469994f, 0.0f, 0.309417993f,
+	6.55280972f, 0.523809969f, 1.69617999f, 0.238115996f, 0.401078999f, 0.0f, 0.0f,
+	2.23712993f, 3.17719984f, -1.85876012f, 17.2401981f, 0.153998986f, -0.585765004f, 0.0f,
+	1.65006995f, 0.809524f, 0.0f, 1.82352996f, 0.0f, 0.0f, 0.0f,
+	0.0476173982f, 0.142879993f, 0.963455975f, 0.0f, -0.733280003f, 1.5836699f, 0.0f,
+	2.41194987f, 13.0811996f, 0.0f, 0.582686961f, -1.34616005f, 0.0f, 0.0f,
+	-0.0276737008f, 1.94434988f, 0.74800998f, 1.36322999f, 0.0f, 0.153322995f, 0.0f,
+	-7.43047047f, 0.0f, 0.670351982f, 0.0f, 0.0f, 0.0f, 0.0f,
+	2.34840989f, 0.0f, 0.214246988f, 0.0f, 0.0f, 0.0f, 16.3908997f,
+	8.09522915f, -0.0476190001f, 0.0f, -0.619216025f, 0.451295972f, 0.0f, 0.0f,
+	-1.10589004f, 0.0f, 1.42856991f, 0.0f, 0.0f, 0.0f, 0.261906981f,
+	0.52462399f, 0.0f, 1.16447997f, 0.0f, 0.0f, 0.166664988f, 0.0f,
+	1.21596992f, 2.09239984f, 0.0f, 0.0f, 3.23742986f, 0.0f, 0.0f,
+	1.97706997f, 2.36602998f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+	0.260538995f, 2.27325988f, 0.809107959f, -6.65227032f, 0.374406993f, 0.0f, 0.0f,
+	1.5819999f, 0.291829973f, 0.0f, 1.5398699f, 0.0f, 0.0f, 0.0f,
+	6.80240965f, 0.0475615971f, 0.0f, 0.119055994f, 0.0f, 0.0f, 0.0f,
+	-1.72189009f, 0.0f, 0.796964943f, 0.0f, 0.0f, 0.0f, -1.5825901f,
+	7.08178997f, 0.261905998f, 0.0f, 2.60530996f, 0.0f, 0.0f, 0.0f,
+	0.451768994f, 0.523810983f, 2.11047983f, 0.529124975f, 0.0f, 0.0f, 2.23455f,
+	2.20091987f, -0.15809001f, 0.530328989f, 1.48197997f, 0.523831964f, 0.0f, 1.27419996f,
+	1.97488999f, 0.998278975f, 0.0f, 0.0f, 0.421177f, 0.0f, 0.0f,
+	4.70476961f, 0.428536981f, 0.333329976f, 0.0197986998f, 0.0f, -0.523810029f, 0.0f,
+	0.524832964f, 0.0f, 2.14069986f, 0.0f, 0.0f, 1.14052999f, 0.0f,
+	0.0476204976f, -5.70770025f, 0.454611987f, 0.0f, 4.66223955f, -0.107715003f, 0.0f,
+	0.404763997f, 0.886139989f, 0.0f, 0.0f, 2.64174986f, 0.0f, 0.0f,
+	0.0476189964f, 0.23550199f, 0.0238379985f, 0.0f, -0.443906009f, 0.0f, 4.76189995f,
+	2.48261976f, 0.342076987f, -0.0476161018f, 0.428609997f, 0.0f, 0.454611987f, 1.06343997f,
+	0.142856985f, 0.142819986f, 1.65070999f, 0.0f, 0.387990981f, 0.962066948f, 0.0f,
+	1.39928997f, 1.22983992f, 1.5819999f, 1.06542993f, 0.0476404987f, 0.0f, 0.0f,
+	0.523807943f, 0.0158517994f, 5.13176966f, 0.0f, 0.427028984f, 0.0f, -0.83168304f,
+	11.3458996f, -0.598945022f, 0.0f, 0.0f, 1.07806993f, 0.0f, 0.0f,
+	0.757692993f, 2.24367976f, -0.19106701f, 0.619046986f, 2.56871986f, 0.0f, 0.0f,
+	2.07429981f, 0.0f, 2.35341978f, 0.0f, 0.0f, 6.77567959f, 0.0f,
+	1.62749994f, 2.07430983f, 0.0f, 0.0f, 2.24488997f, 0.0f, 0.0f,
+	0.674987972f, 0.0f, 0.0476188995f, 0.0f, 0.0f, 0.445625991f, 0.952291965f,
+	9.95025921f, -5.7046504f, 0.0f, 0.0f, 0.0476189964f, 0.0f, 0.0f,
+	0.214288995f, 1.24626994f, 0.156882986f, 0.0f, 1.34675992f, 0.0f, -1.94457006f,
+	0.952379942f, -2.84237003f, 0.285720974f, 0.0f, 0.0f, -0.322176009f, 5.69399977f,
+	1.14222991f, 0.523809969f, 0.0f, 1.57113993f, 0.0476204976f, 0.0f, 0.0f,
+	-0.0476190001f, 0.832123995f, 2.09237981f, 0.0f, 0.0f, 0.0f, 0.102063999f,
+	6.55280972f, 0.883824944f, 0.819914997f, 0.238093987f, 0.0f, 0.0f, 0.0f,
+	-0.44876802f, -0.266100019f, -0.633876026f, 0.0f, 1.57503998f, 0.0f, 1.49037993f,
+	1.83141994f, 0.291829973f, 0.0f, -0.723608017f, 0.0f, 0.0f, 0.0f,
+	0.285696983f, 1.56265998f, 2.30945992f, 1.24626994f, 0.0f, 0.0f, 0.0f,
+	2.07429981f, 0.0f, 2.30692983f, 0.0f, 0.0f, 0.190442994f, 0.0f,
+	1.5994699f, 0.0476191975f, -1.07094002f, 0.0f, -1.94387007f, 0.0f, 0.0f,
+	0.619047999f, -1.35336006f, 0.0f, 0.261839986f, 0.0f, 0.0f, 0.0f,
+	2.29660988f, 0.959761977f, 0.0476186983f, 0.0f, 0.143021986f, 0.0f, 0.0f,
+	1.24438f, 0.0f, -0.284173012f, 0.0f, 0.0f, 0.0f, 0.763592958f,
+	2.20093989f, 0.735381961f, -0.042011302f, 0.333332986f, 0.0f, 0.0f, 0.951954961f,
+	2.14667988f, 2.24396992f, 0.0714339986f, 0.0f, 0.0f, 2.2913599f, 1.48990989f,
+	1.97654998f, 17.2477989f, 0.0f, 1.02089f, 0.0f, 0.0f, 0.0f,
+	2.55490994f, -1.62188005f, 0.0f, 0.0f, 3.21794987f, 0.0f, 0.0f,
+	0.310466975f, 2.94020987f, 0.238093987f, 0.0f, 0.0f, 0.261910975f, 0.0f,
+	0.670994997f, 0.0f, -1.74581003f, 0.0f, 0.0f, 0.0f, 1.38003993f,
+	-0.619048059f, 1.26216996f, 0.261910975f, 0.0f, 0.0f, 0.310802996f, 0.0f,
+	3.17719984f, 0.0f, 2.29137993f, 0.0f, 0.0f, 4.28379965f, 0.0f,
+	2.2190299f, 1.65182996f, 1.09350991f, 0.0981134996f, 0.0714900941f, 0.0f, 0.0f,
+	8.09451962f, 1.49576998f, 0.0f, 0.333332986f, 2.2371099f, 0.0f, 0.0f,
+	-0.305998027f, -0.305344015f, -5.54897022f, 0.0f, 0.0f, 0.0f, 0.0f,
+	2.2439599f, 0.637188971f, -0.853885055f, 0.0f, 0.476147979f, 0.0f, 3.60800982f,
+	8.09522915f, -1.58714008f, 0.0f, 0.142776996f, 17.2725983f, 0.0f, 0.0f,
+	4.45315981f, 2.27291989f, 0.150564998f, 0.0f, 0.0f, 0.0f, -0.0504128002f,
+	0.298392981f, 1.91968f, 0.320838988f, 0.0f, 0.0f, -0.960367024f, -1.26138008f,
+	2.38358998f, 0.482570976f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+	2.07429981f, 0.0f, -1.09424007f, 0.0f, 0.0f, -1.91690004f, 0.0f,
+	0.302171975f, 0.0f, 1.71534991f, 0.0f, 0.0f, 0.831874967f, 0.0476216972f,
+	6.19046974f, 10.9644995f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+	2.07430983f, 0.0f, 1.24676991f, 0.0f, 0.0f, 0.0f, 2.85587978f,
+	2.35505986f, 1.05614996f, 0.968766987f, 1.22335994f, 0.260538995f, 0.0f, 0.0f,
+	-1.63861001f, 0.0f, 0.482570976f, 0.0f, 0.0f, 0.0476234965f, 0.0f,
+	-1.94459009f, -5.34002018f, 1.97908998f, 0.0f, 6.87763977f, 0.95162797f, 0.0f,
+	6.18992996f, 19.1780987f, 0.0f, 0.809522986f, 2.4093399f, 0.0f, 0.0f,
+	25.6255989f, 0.333333999f, 0.0f, 0.319079995f, 0.0f, 0.0f, 0.0f,
+	-0.90476203f, 0.0f, -0.719539046f, 0.0f, 0.0f, 0.0f, 0.349695981f,
+	2.34802985f, 0.0f, 8.36559963f, 0.0f, 0.0f, 0.153302997f, 0.190489992f,
+	2.24396992f, -0.320760012f, 0.0714140981f, 0.142858997f, 0.0f, 0.0f, 0.0f,
+	1.9878999f, 1.15023994f, -6.9851203f, 0.0f, 0.0f, 0.0f, 9.77782917f,
+	0.523809969f, 1.97434998f, 0.476145983f, 0.0476177968f, 0.0f, 0.0f, 0.0f,
+	-1.65038002f, 0.0f, 2.28618979f, 0.0f, 0.0f, 0.86373198f, 0.0f,
+	31.9031982f, 0.952296972f, 0.0f, 0.0476330966f, 0.0f, 0.0f, 0.0f,
+	-1.16623008f, 0.0f, -1.83142006f, 0.0f, 0.0f, 0.0f, 0.256436974f,
+	0.959601998f, 0.0476191975f, 1.58093989f, 0.523810983f, -1.58488011f, 0.0f, -0.345387012f,
+	2.39055991f, 0.0476404987f, 0.0f, 0.0715565979f, 1.56843996f, 0.0f, 0.0f,
+	0.0714337975f, 2.14675999f, 0.0f, 0.0f, 2.25528979f, 0.0f, 0.0f,
+	-0.0476193018f, 1.3182199f, 0.0238158982f, -0.365106016f, 0.0f, 0.0f, 0.0f,
+	1.16447997f, -9.69270039f, -0.00930777006f, 0.0f, 3.13092995f, 0.0f, 0.0f,
+	0.309506983f, -1.60956001f, 0.0f, 2.23717999f, 0.788831949f, 0.0f, 0.0f,
+	-1.73151004f, 0.0f, -0.719539046f, 0.0f, 0.0f, 0.0f, 2.16049981f,
+	19.3313999f, 2.16486979f, 2.25529981f, -0.804887056f, 2.3327899f, 0.0f, 0.0f,
+	1.64557993f, 0.157548994f, -3.87979007f, 0.0f, -1.21686006f, 0.0f, -0.363633007f,
+	2.73059988f, -0.863222003f, 0.0f, 1.37761998f, 0.536651969f, 0.0f, 0.0f,
+	0.959601998f, 1.61016989f, -0.619048059f, 0.0f, 0.523809969f, 0.0f, 0.0f,
+	0.333338976f, 0.238096997f, 0.0f, 0.669552982f, 0.407922983f, 0.0f, 0.0f,
+	-1.04718006f, 0.300006986f, 1.53776991f, 0.0950714946f, 0.0f, 6.35808992f, 0.0f,
+	-0.0462111011f, 1.42843997f, 2.31516981f, 0.0f, 0.0231860988f, 0.0f, 0.0f,
+	-1.60460007f, 0.0f, 2.55708981f, 0.0f, 0.0f, 2.85713983f, 0.0f,
+	-2.24811006f, 2.97658992f, 2.85566998f, 2.2010498f, 0.0f, 0.0f, 0.142903998f,
+	0.309479982f, 2.26384997f, 0.0f, 0.349912971f, 0.0f, 0.0f, 0.0f,
+	2.34761f, 0.0f, 3.33332992f, 0.0f, 0.0f, 0.0f, 12.3564997f,
+	0.69580096f, 2.09239984f, 0.0f, 0.0f, 4.44715977f, 0.0f, 0.0f,
+	5.92017984f, -2.54311013f, 0.598779976f, 0.0f, -0.37686801f, 0.0f, 0.0f,
+	-0.142857f, 1.04199994f, 1.54114997f, 0.0f, 0.0f, 0.309522986f, 0.0f,
+	0.882537961f, 0.601110995f, -0.926584005f, 11.1005993f, 0.992974997f, 0.0f, 0.0f,
+	-0.847786009f, 1.22983992f, 0.0952568948f, 0.0f, 0.166565999f, 0.0f, 2.85630989f,
+	3.46420979f, 1.35167992f, 0.0f, 0.0f, 0.904760957f, 0.0f, 0.0f,
+	0.428571999f, 1.64558995f, 2.20092988f, 0.0f, -0.925573051f, 0.0f, 0.0f,
+	1.49315f, 0.0f, -1.63397002f, 0.0f, 0.0f, 0.0f, 0.0f,
+	0.476189971f, -0.741744041f, 2.35505986f, 0.0f, -1.94475007f, -1.59283006f, 0.823236942f,
+	1.10574996f, 1.41219997f, 0.0472716987f, 0.996514976f, 0.58118099f, 0.0f, 0.119135998f,
+	0.380955994f, 0.163256988f, 0.0f, -0.847786009f, 0.0f, 0.0f, 0.0f,
+	0.451768994f, 2.12857985f, 2.14674997f, 0.0f, 2.38474989f, 0.0f, 1.0989399f,
+	1.97750998f, 0.619045973f, 0.0f, 0.234941989f, 0.0f, 0.0f, 0.0f,
+	-0.133909002f, 6.91914988f, 2.85686994f, 0.0f, 0.619046986f, 0.0f, 0.449436992f,
+	0.379827976f, 0.0f, 1.64074993f, 0.0f, 0.0f, -6.01145029f, 0.0f,
+	2.52478981f, -1.69313002f, 0.0f, 0.0f, 1.42058992f, 0.0f, 0.0f,
+	-2.84233022f, 0.0f, 0.999208987f, 0.0f, 0.0f, 0.0f, 1.59774995f,
+	0.0476305969f, 1.25365996f, 0.90476197f, 1.85419989f, 0.0566430986f, 3.23742986f, 0.0f,
+	-1.66737008f, 0.0f, 0.69580096f, 0.0f, 0.0f, -0.40536502f, 0.0f,
+	-1.73151004f, 0.0f, -1.83359003f, 0.0f, 0.0f, 0.0f, -0.0476183034f,
+	0.151379988f, 0.0664122999f, 2.39549994f, 0.0f, 0.0f, 0.0f, 0.0f,
+	2.28618979f, 0.619058967f, 0.0476186983f, 1.19841993f, 0.0f, 0.0f, 0.0f,
+	4.454f, -0.15283601f, 2.27331996f, 0.0f, 2.21891999f, 0.0f, 0.0f,
+	1.74682999f, 0.570871949f, 0.421177f, 0.166663989f, 0.0f, 1.51167989f, 0.0f,
+	0.673961997f, 2.30946994f, 0.118988998f, 2.03535986f, 0.0f, -0.324782014f, 0.0f,
+	0.309525996f, -1.63646007f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+	-0.106411003f, -0.608407021f, 0.71428597f, -0.305006027f, 0.0f, 5.23762989f, 0.0f,
+	8.09451962f, 2.84236979f, 0.0f, 1.65822995f, 12.9073992f, 0.0f, 0.0f,
+	0.999086976f, 0.0f, 3.5375998f, 0.0f, 0.0f, 0.0f, 0.333332986f,
+	0.669838965f, 0.0f, 0.0476177968f, 0.0f, 0.0f, 1.13954997f, 2.07599998f,
+	0.820555985f, 2.85586977f, 0.0967257991f, 0.0f, 0.0f, -0.234457001f, 0.0f,
+	2.18286991f, 0.952103972f, 4.77936983f, 2.13641f, 0.0f, 0.0f, 6.06404972f,
+	1.49840999f, 0.0f, 2.09239984f, 0.0f, 0.0f, 0.0f, -0.359507024f,
+	2.09238982f, 0.0f, 0.745690942f, 0.0f, 0.0f, 0.114257999f, 0.0f,
+	0.238098994f, 0.234941989f, -1.5699501f, 0.0f, 0.0f, 0.478810996f, 0.0f,
+	0.670994997f, 0.0f, 0.142860994f, 0.0f, 0.0f, 0.0f, 0.378196985f,
+	2.98924994f, 2.85713983f, 3.37972999f, -0.53858304f, 0.0f, 0.0f, 0.0f,
+	-2.84230018f, 0.0f, 0.862010956f, 0.0f, 0.0f, -0.549223006f, 7.15198994f,
+	0.748121977f, 0.535775959f, 0.0f, 0.30855298f, 0.0f, 0.0f, 0.0f,
+	1.99566996f, -1.40412009f, 0.333332986f, 0.0f, 6.75372982f, 0.0476189964f, 0.0f,
+	0.119057f, 1.68908f, 0.428585976f, 0.629527986f, 0.0f, 1.68366992f, 0.0f,
+	9.3862896f, 1.07274997f, 0.0f, 0.157999992f, 0.0951633975f, 0.0f, 0.0f,
+	2.07429981f, 0.0f, 2.24488997f, 0.0f, 0.0f, 0.0714308992f, 23.5977993f,
+	-0.142857f, 1.42783999f, 0.0204708986f, 0.0f, -0.627522051f, 0.0f, 0.0476205982f,
+	2.11180997f, -1.38790011f, 0.0f, 0.0f, 1.0030899f, 0.0f, 0.0f,
+	-0.305998027f, 0.118761994f, 0.757452965f, 0.0f, 0.0f, 1.79887998f, -0.746553004f,
+	2.25520992f, 15.1369991f, 8.66426945f, 0.124322996f, 0.914005995f, 0.0f, 0.966219962f,
+	0.142856985f, -0.333332002f, 0.309524f, 0.0f, 0.166619986f, 1.42235994f, 0.0f,
+	-0.581890047f, -0.428571016f, 0.154716998f, 0.0f, 0.0f, 0.0f, 2.90531993f,
+	1.16447997f, 0.301918f, 0.0f, 0.97892797f, 0.0f, 0.0f, 0.0f,
+	1.39448988f, 0.238090992f, -0.655105054f, 0.619046986f, 0.0f, 0.0f, 0.0f,
+	1.97908998f, 2.90796995f, 0.0f, 1.60222995f, 0.680030942f, 0.0f, 0.0f,
+	0.809524f, -0.63815403f, 0.0f, 0.0f, 0.0339486971f, 0.0f, 0.0f,
+	-0.042011302f, 0.67494297f, 2.27330995f, 0.0f, 0.0f, 0.523809969f, 0.0f,
+	2.07430983f, 0.0f, 0.190424994f, 0.0f, 0.0f, 13.0576992f, 2.74986982f,
+	4.4547596f, 2.25520992f, -1.21686006f, 0.0f, 0.0f, 0.0f, 0.476189971f,
+	2.30947995f, 2.10271978f, 14.9363995f, 0.369419992f, 0.0f, 0.0f, 0.0f,
+	0.285718977f, 2.12858987f, 0.0f, 0.0f, 2.60004997f, 0.0f, 0.0f,
+	0.142856985f, 0.0f, 0.952124953f, 0.0f, 0.0f, 0.0f, 0.469448984f,
+	3.46967983f, 4.67964983f, 0.0f, 2.16474986f, 0.119047999f, 0.0f, 0.0f,
+	-1.60460007f, 0.0f, 0.619047999f, 0.0f, 0.0f, 25.6343994f, 0.0f,
+	0.428570986f, 0.151842996f, 7.25950956f, 0.0f, 2.03515983f, 0.0f, -0.481936008f,
+	-0.133909002f, 7.00591993f, -0.714284003f, 0.0f, 2.91174984f, 0.0f, 0.578043997f,
+	0.894592941f, 1.34638989f, 0.0f, -0.363775015f, 0.214271992f, 0.0f, 0.0f,
+	1.64074993f, 1.39776993f, 0.0f, -1.58714008f, 0.650264978f, 0.0f, 0.0f,
+	-7.19667006f, 0.0f, -0.142857f, 0.0f, 0.0f, 1.23177993f, 0.0f,
+	33.8993988f, -2.1723702f, 0.0f, -7.9835701f, 0.0f, 0.0f, 0.0f,
+	2.11048985f, 0.0f, -0.140439004f, 0.0f, 0.0f, 1.90244997f, 0.0476288982f,
+	2.62732983f, 0.142856985f, 0.0f, 0.0f, 2.04482985f, 0.0f, 0.0f,
+	-0.238095f, 0.0898499936f, 1.49344993f, 0.0f, 0.260237992f, 0.0f, 0.476147979f,
+	2.30949998f, 0.190489992f, -0.44888401f, 1.49840999f, 1.1547699f, 0.0f, 0.0f,
+	0.524832964f, 0.0f, 0.146997988f, 0.0f, 0.0f, 0.142821997f, 0.0f,
+	-0.305998027f, -0.142857f, 2.39201999f, 0.0f, 0.0f, 0.0714487955f, 0.0f,
+	7.54042959f, 0.0952312946f, 0.887061954f, 0.0f, 0.156346992f, 0.0f, 0.0f,
+	1.68628991f, 2.07430983f, 0.0f, 0.0f, 1.04717994f, 0.0f, 0.0f,
+	0.816090941f, 1.5836699f, 6.87605f, 0.0f, -0.451745003f, 2.16467977f, 0.694775999f,
+	2.2684598f, 2.84237981f, 0.0f, -8.9847908f, 0.0f, 0.0f, 0.0f,
+	-5.35268021f, 0.474912971f, 1.86371994f, 0.0f, -2.17723012f, 0.333332986f, 0.0f,
+	-4.71551037f, -0.573074043f, 0.214287996f, 0.0f, 0.0f, 0.0476257987f, 0.0f,
+	1.62624991f, 0.0476174988f, 2.75971985f, 2.25212979f, 0.670201957f, 3.56509995f, 0.0f,
+	0.951958954f, 0.894935966f, 2.30947995f, -2.24398017f, 0.0f, 0.523810983f, 0.0f,
+	1.97654998f, 0.333314985f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+	2.2439599f, -1.85928011f, -0.0504128002f, 0.850717962f, 0.0f, 0.0f, 1.16754997f,
+	8.09522915f, 1.94477999f, 0.0f, 0.300312996f, 2.23709989f, 0.0f, 0.0f,
+	2.23712993f, 0.429951996f, 0.333287984f, 0.0f, 0.954845965f, 0.0f, 0.0f,
+	0.0476229973f, -0.0476190001f, 0.305565f, 0.0f, 0.451261997f, 25.6255989f, 0.383595973f,
+	0.90476197f, 0.541942954f, 0.0f, 0.0476424992f, -1.13774002f, 0.0f, 0.0f,
+	0.635035992f, 0.0476235971f, 1.05373991f, -1.11437011f, -1.64879f, 0.142859995f, 0.0f,
+	2.34840989f, 0.0f, 0.0476196967f, 0.0f, 0.0f, -0.0023769401f, 0.63091898f,
+	0.309531987f, 1.06665993f, -0.142857f, -0.142857f, 0.0f, 0.0f, 0.0f,
+	4.454f, 0.0476217978f, 0.142856985f, 3.1452899f, 0.0f, 0.0f, 0.635717988f,
+	2.34782982f, 1.13522995f, 19.3856983f, 0.0f, 1.54129994f, 0.0f, 0.0f,
+	8.09451962f, 0.309508979f, 0.0f, 2.12857985f, 0.0f, 0.0f, 0.0f,
+	0.74347198f, 0.119051993f, 0.0f, -0.0760929063f, 1.47404993f, 0.0f, 0.0f,
+	3.39609981f, 0.619047999f, 0.0f, 0.0f, 2.23711991f, 0.0f, 0.0f,
+	10.7620993f, 3.23735976f, 0.214295998f, 0.648795962f, 0.0f, 5.92017984f, 0.0f,
+	3.23735976f, 2.94572997f, 0.0f, 1.0973599f, 0.0f, 0.0f, 0.0f,
+	1.83021998f, -0.928817034f, 0.0f, 1.17060995f, 0.0f, 0.0f, 0.0f,
+	7.61836958f, 0.0714529976f, 0.0f, 0.858539999f, -0.142857f, 0.0f, 0.0f,
+	1.42856991f, -0.723958015f, -0.238094002f, 0.0f, 0.333333999f, 0.0f, 0.305801988f,
+	0.285716981f, 0.714286983f, 4.75979996f, 1.42843997f, 0.0f, 0.453170985f, 0.0f,
+	2.20091987f, -0.238094002f, -1.04712009f, 0.0f, 1.04549992f, 0.0f, -0.142857f,
+	0.119077995f, 2.16475987f, 0.157681987f, 0.0f, 2.31037998f, 0.0f, 1.46048999f,
+	-4.71551037f, 0.619046986f, 0.842699945f, 1.39678991f, 0.0f, 6.18992996f, 0.0f,
+	-1.68377006f, 0.0f, -4.71551037f, 0.0f, 0.0f, -0.472165018f, 7.4396596f,
+	8.09522915f, 2.9755199f, 0.0f, 0.245961994f, 0.0f, 0.0f, 0.0f,
+	-2.24397016f, -0.140439004f, 0.606117964f, 0.0f, 0.0f, 2.38645983f, 0.0f,
+	0.444628984f, 8.91081905f, 1.18307996f, 0.319398999f, 0.329336971f, 0.0f, 2.86423993f,
+	2.97682977f, 0.380951971f, -0.0476173013f, 0.0f, 0.0f, 2.20094991f, 0.0f,
+	0.260538995f, -1.30785f, 1.97757995f, 2.23709989f, -0.262610018f, 1.12441993f, 0.0f,
+	0.0476206988f, 2.20094991f, 0.0476186983f, 2.95780993f, -1.61222005f, 0.0f, 0.636192977f,
+	-1.69313002f, 0.0f, 0.0476303995f, 0.0f, 0.0f, 0.333333999f, -0.739975035f,
+	0.285722971f, -0.363883018f, 0.0f, 1.50954998f, 8.89784908f, 0.0f, 0.0f,
+	6.55280972f, 0.0238151997f, -1.04676008f, -0.0740451068f, 0.0f, 0.0f, 0.0f,
+	8.09447956f, 1.60926998f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+	2.09238982f, 0.0f, -1.73151004f, 0.0f, 0.0f, 0.0f, 0.730947971f,
+	0.69580096f, 2.11048985f, 0.0f, 0.0f, 0.0714220926f, 0.0f, 0.0f,
+	1.25010991f, 0.0f, 0.44866398f, 0.0f, 0.0f, 27.7150993f, 0.0f,
+	1.65971994f, 2.09238982f, 0.0f, 0.0f, 2.08939981f, 0.0f, 0.0f,
+	1.1117599f, 0.67234695f, 1.49473f, 1.94798994f, 0.284977973f, 0.0f, 0.0f,
+	2.98924994f, 0.0238178f, 8.94287968f, 0.0f, 0.238095999f, -0.142804012f, 0.0f,
+	-0.611295044f, 3.33048987f, 1.0963999f, 2.25519991f, 0.0f, 0.0f, 0.0f,
+	5.48929977f, 0.0f, 0.896598995f, 0.0f, 0.0f, 1.9678899f, 0.0f,
+	0.309525996f, -0.845212042f, 0.0f, 0.0f, -0.747951031f, 0.0f, 0.0f,
+	1.60926998f, -10.0334005f, 0.0f, 0.0f, 15.1577997f, 0.0f, 0.0f,
+	2.07429981f, 0.0f, -2.41653013f, 0.0f, 0.0f, 0.0f, 0.0f,
+	2.08939981f, -0.714286029f, 0.0f, 0.0f, 0.591873944f, 0.0f, 0.0f,
+	-2.59278011f, 0.0f, -0.542373002f, 0.0f, 0.0f, 0.0f, -0.234946012f,
+	0.523810983f, 0.0157790985f, 0.265423983f, 5.69212961f, 0.819880962f, 0.0f, 0.895899951f,
+	1.97518992f, 0.63952297f, 0.0f, -0.459167004f, 0.0f, 0.0f, 0.0f,
+	0.305801988f, -1.11578012f, 6.87743998f, 0.0f, 0.0f, 2.40337992f, 10.4566994f,
+	2.27327991f, 4.28530979f, 0.0f, 0.0f, 8.77391911f, 0.0f, 0.0f,
+	8.09522915f, -1.63861001f, 0.0f, 0.0f, 1.48768997f, 0.0f, 0.0f,
+	0.726425946f, 0.333334982f, 2.29140997f, 0.197776988f, 0.265194982f, 0.0f, 0.0f,
+	1.90458989f, 0.181355f, 2.1647799f, -0.114901006f, -0.355286002f, 0.0f, 0.0f,
+	10.7718992f, 0.523809969f, 6.77939987f, 0.333337992f, 0.0f, 0.0f, 0.0f,
+	-4.27753019f, -1.6952101f, 0.15327999f, 2.47969985f, 0.0f, 0.0f, -0.142857f,
+	0.482570976f, 0.214287996f, 0.0f, 0.0f, 1.7129699f, 0.0f, 0.0f,
+	-1.69313002f, 0.0f, 0.421177f, 0.0f, 0.0f, 2.32750988f, 8.8285799f,
+	0.306410998f, 0.238094985f, -0.191460013f, 0.0f, 0.0f, -1.74423003f, 0.807769954f,
+	-1.84029007f, 0.0f, 3.33332992f, 0.0f, 0.0f, 1.54463995f, 21.4225998f,
+	0.119058996f, -1.14689004f, 0.333276987f, 0.0f, -0.188943014f, 0.0f, 0.0f,
+	25.6320992f, 2.54315996f, 0.209284991f, 0.298217982f, 1.70286989f, 0.0f, 0.0f,
+	-1.94472003f, 1.42815995f, -0.340266019f, 0.0f, -2.74335003f, 0.0f, 0.0f,
+	-0.428570002f, 1.33385992f, -0.351562023f, 0.0f, 0.0f, -1.61222005f, 0.0f,
+	0.748776972f, 0.142857999f, 0.0f, 0.0f, 1.13319993f, 0.0f, 0.0f,
+	-0.142856002f, 0.119022995f, -1.27943003f, 0.0f, 2.24350977f, 0.0f, 1.82213998f,
+	-3.96668005f, 0.0f, 1.64606988f, 0.0f, 0.0f, 2.27328992f, 0.0f,
+	-10.0334005f, 0.0f, -1.09148002f, 0.0f, 0.0f, 0.0259438995f, -0.59445405f,
+	4.68048954f, 0.190397993f, 1.64503992f, 0.0f, 0.0f, 0.723263979f, 0.0f,
+	1.25186992f, 0.0f, 21.3876991f, 0.0f, 0.0f, -0.619048059f, 0.929383993f,
+	0.0476191975f, 1.94478989f, -1.94489002f, 0.0f, 2.23686981f, 0.0f, -0.619794011f,
+	-0.601335049f, -1.91004002f, 8.23548985f, 1.34564996f, 0.0f, 0.281587988f, 0.0f,
+	-1.63861001f, 0.0f, 29.8150997f, 0.0f, 0.0f, 0.303061992f, 0.0f,
+	-2.54313016f, 0.0f, -1.73073006f, 0.0f, 0.0f, 0.0f, 0.0f,
+	0.151379988f, 0.0714371949f, 2.32613993f, 0.0f, 0.913122952f, -0.37261501f, 0.0476190969f,
+	0.482570976f, 1.07439995f, 0.0f, 0.0f, 0.237896994f, 0.0f, 0.0f,
+	9.3862896f, -3.16649008f, 0.0f, 0.304737985f, 0.0f, 0.0f, 0.0f,
+	-0.845202029f, 0.952380955f, 0.0476556979f, 0.0f, 1.73150992f, 0.0f, -0.0219407007f,
+	0.238094985f, 3.33304f, 0.673524976f, 0.0476195998f, 0.0f, 0.0f, 0.0f,
+	-1.24973011f, -0.047615502f, 0.525150955f, 0.0f, 0.0f, 0.0f, 0.0f,
+	1.6875999f, 9.26039982f, 0.0473943986f, -0.748067021f, 0.0f, 0.0f, 0.0f,
+	-1.25043011f, 8.93176937f, 0.748010993f, 0.0f, 0.0f, 0.0f, 0.0f,
+	-1.12155008f, 0.328184992f, 2.16485977f, 0.0f, 0.0f, 0.0520366989f, 0.0f,
+	-1.04715002f, 1.57205999f, 2.42817998f, 0.166708991f, 0.0f, 0.0f, 8.86155987f,
+	0.669673979f, 0.0f, 0.142855987f, 0.0f, 0.0f, 1.84469998f, 1.59940994f,
+	-1.69313002f, 0.0f, 0.0476190969f, 0.0f, 0.0f, 0.0f, 0.0f,
+	1.19773996f, 0.0238420982f, 0.0473943986f, 0.844175994f, 0.0f, 0.0f, 0.0f,
+	-0.604989052f, -1.07117009f, -1.03242004f, 0.523808956f, 0.0f, 0.0f, 2.47148991f,
+	0.594047964f, 0.171563998f, 0.0f, 0.0f, 3.80842996f, 0.0f, 0.0f,
+	0.69580096f, 0.619048953f, 0.0f, 0.301918f, 0.0f, 0.0f, 0.0f,
+	1.25137997f, 1.90391994f, 12.8487997f, 0.0238117985f, 1.15124989f, 0.0f, 2.20102978f,
+	6.82122993f, -0.619048059f, 2.37891984f, 0.0f, -0.156137004f, 0.0f, 0.0f,
+	1.97654998f, 0.335777998f, 0.0f, -0.293233007f, 0.261710972f, 0.0f, 0.0f,
+	17.1892986f, 4.76145983f, 0.119075999f, 2.24396992f, 0.142849997f, 0.0f, 0.111211993f,
+	1.37709999f, -4.41331005f, 6.76427984f, 1.18607998f, -0.183275014f, 0.0f, 0.0f,
+	-0.90476203f, 0.0f, 0.52471f, 0.0f, 0.0f, 0.0f, 0.482570976f,
+	0.882537961f, 2.14666986f, 3.80781984f, -2.14770007f, 19.1957989f, 0.0f, 0.0f,
+	0.291829973f, 5.23808956f, -2.24349022f, 0.0f, 0.166532993f, 0.0f, -0.0476187021f,
+	1.5819999f, 3.33304f, 0.0f, 0.0f, 0.757442951f, 0.0f, 0.0f,
+	0.166670993f, 10.9642992f, 1.64559996f, 2.27316999f, -1.3312701f, 1.06676996f, 0.0f,
+	-0.490530014f, 0.0f, -0.238095f, 0.0f, 0.0f, 0.0f, 13.0716991f,
+	0.211941987f, 6.18989992f, 0.665906966f, 0.304701984f, 0.0f, 0.0f, 0.142779991f,
+	0.619046986f, -2.31460023f, 0.723263979f, 0.0f, 0.168946996f, -0.896546006f, 0.0f,
+	2.26955986f, -0.333333015f, 0.0f, 1.90325999f, 0.166638985f, 0.0f, 0.0f,
+  };
+
+  const double leafValues[] = {
+	0.012321317126581353, -0.012321317126581353, -0.012321317126581353, -0.012321317126581353, 0.012321317126581353, 0.012321317126581353, -0.012321317126581353, -0.012321317126581353,
+	0.0095648899593956931, 0.0095648899593956931, -0.0095648899593956931, -0.0095648899593956931, 0.0095648899593956931, 0.0095648899593956931, -0.0095648899593956931, -0.0095648899593956931,
+	-0.0070085921178513243, 0.0070085921178513243, -0.0070085921178513243, -0.0070085921178513243, 0.0070085921178513243, 0.0070085921178513243, -0.0070085921178513243, -0.0070085921178513243,
+	0.0069062460088219219, -0.0069062460088219219, 0.0069062460088219219, 0.0069062460088219219, 0.0069062460088219219, 0.0069062460088219219, -0.0069062460088219219, -0.0069062460088219219,
+	-0.0054340779765707607, -0.0054340779765707607, -0.0054340779765707607, -0.0054340779765707607, -0.0054340779765707607, -0.0054340779765707607, 0.0054340779765707607, 0.0054340779765707607,
+	0.0054742937143446866, -0.0054742937143446866, -0.0054742937143446866, -0.0054742937143446866, -0.0054742937143446866, -0.0054742937143446866, 0.0054742937143446866, 0.0054742937143446866,
+	-0.0058883067159405675, 0.0058883067159405675, 0.0058883067159405675, 0.0058883067159405675, -0.0058883067159405675, -0.0058883067159405675, -0.0058883067159405675, -0.0058883067159405675,
+	0.0046889601374722392, 0.0046889601374722392, -0.0046889601374722392, -0.0046889601374722392, -0.0046889601374722392, -0.0046889601374722392, 0.0046889601374722392, 0.0046889601374722392,
+	-0.0055767920788174531, -0.0055767920788174531, -0.0055767920788174531, -0.0055767920788174531, -0.0055767920788174531, -0.0055767920788174531, 0.0055767920788174531, -0.0055767920788174531,
+	0.0049642785805262424, 0.0049642785805262424, 0.0049642785805262424, 0.0049642785805262424, -0.0049642785805262424, -0.0049642785805262424, 0.0049642785805262424, 0.0049642785805262424,
+	-0.0052101406704707226, -0.0052101406704707226, -0.0052101406704707226, 0.0052101406704707226, -0.0052101406704707226, -0.0052101406704707226, -0.0052101406704707226, -0.0052101406704707226,
+	0.005528669208351481, 0.005528669208351481, -0.005528669208351481, 0.005528669208351481, 0.005528669208351481, 0.005528669208351481, 0.005528669208351481, 0.005528669208351481,
+	0.0057932587178297556, 0.0057932587178297556, 0.0057932587178297556, -0.0057932587178297556, -0.0057932587178297556, -0.0057932587178297556, -0.0057932587178297556, 0.0057932587178297556,
+	-0.0050585653014202344, -0.0050585653014202344, -0.0050585653014202344, -0.0050585653014202344, 0.0050585653014202344, -0.0050585653014202344, -0.0050585653014202344, -0.0050585653014202344,
+	-0.004611502718251434, -0.004611502718251434, -0.004611502718251434, -0.004611502718251434, -0.004611502718251434, -0.004611502718251434, 0.004611502718251434, -0.004611502718251434,
+	0.004402161633988576, 0.004402161633988576, 0.004402161633988576, 0.004402161633988576, -0.004402161633988576, -0.004402161633988576, -0.004402161633988576, 0.004402161633988576,
+	-0.004414433422723729, -0.004414433422723729, 0.004414433422723729, -0.004414433422723729, 0.004414433422723729, 0.004414433422723729, -0.004414433422723729, -0.004414433422723729,
+	0.0038752867474082719, 0.0038752867474082719, 0.0038752867474082719, 0.0038752867474082719, 0.0038752867474082719, -0.0038752867474082719, 0.0038752867474082719, 0.0038752867474082719,
+	-0.004247409201353222, -0.004247409201353222, -0.004247409201353222, -0.004247409201353222, -0.004247409201353222, 0.004247409201353222, -0.004247409201353222, 0.004247409201353222,
+	0.0031421361861581742, 0.0031421361861581742, 0.0031421361861581742, 0.0031421361861581742, -0.0031421361861581742, -0.0031421361861581742, 0.0031421361861581742, 0.0031421361861581742,
+	0.0038130244214352122, 0.0038130244214352122, -0.0038130244214352122, 0.0038130244214352122, 0.0038130244214352122, -0.0038130244214352122, -0.0038130244214352122, -0.0038130244214352122,
+	-0.0027245705575504619, -0.0027245705575504619, -0.0027245705575504619, -0.0027245705575504619, 0.0027245705575504619, 0.0027245705575504619, 0.0027245705575504619, -0.0027245705575504619,
+	-0.0024153194513520273, -0.0024153194513520273, -0.0024153194513520273, -0.0024153194513520273, -0.0024153194513520273, -0.0024153194513520273, -0.0024153194513520273, 0.0024153194513520273,
+	0.0040491218622786028, 0.0040491218622786028, -0.0040491218622786028, -0.0040491218622786028, 0.0040491218622786028, 0.0040491218622786028, 0.0040491218622786028, -0.0040491218622786028,
+	0.0035934416210153899, 0.0035934416210153899, 0.0035934416210153899, 0.0035934416210153899, -0.0035934416210153899, -0.0035934416210153899, -0.0035934416210153899, 0.0035934416210153899,
+	-0.0032508567230830911, 0.0032508567230830911, -0.0032508567230830911, 0.0032508567230830911, -0.0032508567230830911, -0.0032508567230830911, -0.0032508567230830911, -0.0032508567230830911,
+	-0.0042500888971564316, 0.0042500888971564316, -0.0042500888971564316, -0.0042500888971564316, 0.0042500888971564316, -0.0042500888971564316, 0.0042500888971564316, -0.0042500888971564316,
+	-0.0038555036901338187, -0.0038555036901338187, 0.0038555036901338187, 0.0038555036901338187, -0.0038555036901338187, 0.0038555036901338187, 0.0038555036901338187, 0.0038555036901338187,
+	-0.0024188923790896401, 0.0024188923790896401, -0.0024188923790896401, -0.0024188923790896401, -0.0024188923790896401, -0.0024188923790896401, -0.0024188923790896401, -0.0024188923790896401,
+	0.003310601759059196, -0.003310601759059196, 0.003310601759059196, -0.003310601759059196, 0.003310601759059196, 0.003310601759059196, 0.003310601759059196, 0.003310601759059196,
+	0.0028378892088649762, -0.0028378892088649762, 0.0028378892088649762, 0.0028378892088649762, -0.0028378892088649762, -0.0028378892088649762, -0.0028378892088649762, -0.0028378892088649762,
+	0.0031268192885557378, -0.0031268192885557378, -0.0031268192885557378, -0.0031268192885557378, -0.0031268192885557378, -0.0031268192885557378, 0.0031268192885557378, -0.0031268192885557378,
+	-0.0040393876642661865, 0.0040393876642661865, -0.0040393876642661865, 0.0040393876642661865, -0.0040393876642661865, -0.0040393876642661865, -0.0040393876642661865, -0.0040393876642661865,
+	-0.0030240773153735888, -0.0030240773153735888, -0.0030240773153735888, -0.0030240773153735888, 0.0030240773153735888, -0.0030240773153735888, 0.0030240773153735888, -0.0030240773153735888,
+	0.0038961254424233825, -0.0038961254424233825, 0.0038961254424233825, -0.0038961254424233825, 0.0038961254424233825, 0.0038961254424233825, 0.0038961254424233825, 0.0038961254424233825,
+	-0.0026619732696020011, -0.0026619732696020011, -0.0026619732696020011, 0.0026619732696020011, -0.0026619732696020011, -0.0026619732696020011, -0.0026619732696020011, -0.0026619732696020011,
+	-0.0026752905457149219, -0.0026752905457149219, -0.0026752905457149219, -0.0026752905457149219, 0.0026752905457149219, -0.0026752905457149219, 0.0026752905457149219, -0.0026752905457149219,
+	0.0035109394714377858, 0.0035109394714377858, -0.0035109394714377858, -0.0035109394714377858, -0.0035109394714377858, -0.0035109394714377858, 0.0035109394714377858, 0.0035109394714377858,
+	-0.0038772660681720061, 0.0038772660681720061, 0.0038772660681720061, -0.0038772660681720061, -0.0038772660681720061, -0.0038772660681720061, -0.0038772660681720061, -0.0038772660681720061,
+	-0.0036926817190001638, 0.0036926817190001638, 0.0036926817190001638, 0.0036926817190001638, -0.0036926817190001638, -0.0036926817190001638, -0.0036926817190001638, -0.0036926817190001638,
+	-0.0041608570569821304, -0.0041608570569821304, 0.0041608570569821304, 0.0041608570569821304, -0.0041608570569821304, 0.0041608570569821304, -0.0041608570569821304, -0.0041608570569821304,
+	-0.0037893233240848551, 0.0037893233240848551, -0.0037893233240848551, 0.0037893233240848551, -0.0037893233240848551, -0.0037893233240848551, -0.0037893233240848551, -0.0037893233240848551,
+	-0.0029206552678777459, 0.0029206552678777459, -0.0029206552678777459, -0.0029206552678777459, -0.0029206552678777459, -0.0029206552678777459, -0.0029206552678777459, -0.0029206552678777459,
+	0.003000995390159578, 0.003000995390159578, 0.003000995390159578, -0.003000995390159578, 0.003000995390159578, 0.003000995390159578, 0.003000995390159578, 0.003000995390159578,
+	0.0044685856087469224, -0.0044685856087469224, 0.0044685856087469224, 0.0044685856087469224, -0.0044685856087469224, -0.0044685856087469224, -0.0044685856087469224, 0.0044685856087469224,
+	-0.002625655271178199, -0.002625655271178199, -0.002625655271178199, 0.002625655271178199, -0.002625655271178199, -0.002625655271178199, -0.002625655271178199, -0.002625655271178199,
+	-0.0022561719115848943, 0.0022561719115848943, -0.0022561719115848943, -0.0022561719115848943, -0.0022561719115848943, -0.0022561719115848943, -0.0022561719115848943, -0.0022561719115848943,
+	-0.0033995189379838779, -0.0033995189379838779, 0.0033995189379838779, 0.0033995189379838779, 0.0033995189379838779, 0.0033995189379838779, -0.0033995189379838779, 0.0033995189379838779,
+	-0.0032403104960393985, -0.0032403104960393985, 0.0032403104960393985, -0.0032403104960393985, -0.0032403104960393985, 0.0032403104960393985, -0.0032403104960393985, -0.0032403104960393985,
+	0.003534153351369378, 0.003534153351369378, -0.003534153351369378, -0.003534153351369378, 0.003534153351369378, -0.003534153351369378, -0.003534153351369378, 0.003534153351369378,
+	0.0032848198373161947, 0.0032848198373161947, -0.0032848198373161947, 0.0032848198373161947, -0.0032848198373161947, -0.0032848198373161947, -0.0032848198373161947, -0.0032848198373161947,
+	0.0024827483120365779, -0.0024827483120365779, 0.0024827483120365779, 0.0024827483120365779, -0.0024827483120365779, -0.0024827483120365779, -0.0024827483120365779, -0.0024827483120365779,
+	-0.0017672086304022713, -0.0017672086304022713, -0.0017672086304022713, -0.0017672086304022713, 0.0017672086304022713, 0.0017672086304022713, -0.0017672086304022713, 0.0017672086304022713,
+	-0.0027190995119522423, -0.0027190995119522423, 0.0027190995119522423, -0.0027190995119522423, -0.0027190995119522423, -0.0027190995119522423, -0.0027190995119522423, -0.0027190995119522423,
+	-0.002466182919798555, -0.002466182919798555, -0.002466182919798555, -0.002466182919798555, -0.002466182919798555, 0.002466182919798555, -0.002466182919798555, 0.002466182919798555,
+	-0.0023431097697458416, -0.0023431097697458416, -0.0023431097697458416, -0.0023431097697458416, 0.0023431097697458416, 0.0023431097697458416, 0.0023431097697458416, 0.0023431097697458416,
+	0.0020399894827335383, 0.0020399894827335383, 0.0020399894827335383, 0.0020399894827335383, -0.0020399894827335383, -0.0020399894827335383, 0.0020399894827335383, -0.0020399894827335383,
+	-0.0024387160378156569, 0.0024387160378156569, -0.0024387160378156569, -0.0024387160378156569, 0.0024387160378156569, 0.0024387160378156569, 0.0024387160378156569, 0.0024387160378156569,
+	-0.0019208140720309481, -0.0019208140720309481, -0.0019208140720309481, -0.0019208140720309481, -0.0019208140720309481, -0.0019208140720309481, 0.0019208140720309481, -0.0019208140720309481,
+	-0.0035699333805599602, 0.0035699333805599602, 0.0035699333805599602, -0.0035699333805599602, -0.0035699333805599602, -0.0035699333805599602, -0.0035699333805599602, 0.0035699333805599602,
+	-0.0030510671303006121, -0.0030510671303006121, 0.0030510671303006121, 0.0030510671303006121, -0.0030510671303006121, 0.0030510671303006121, 0.0030510671303006121, -0.0030510671303006121,
+	-0.0033157378426820145, -0.0033157378426820145, -0.0033157378426820145, -0.0033157378426820145, -0.0033157378426820145, 0.0033157378426820145, -0.0033157378426820145, 0.0033157378426820145,
+	-0.0024498306851812421, -0.0024498306851812421, -0.0024498306851812421, 0.0024498306851812421, -0.0024498306851812421, -0.0024498306851812421, -0.0024498306851812421, 0.0024498306851812421,
+	0.0026042075543896309, -0.0026042075543896309, 0.0026042075543896309, -0.0026042075543896309, -0.0026042075543896309, -0.0026042075543896309, 0.0026042075543896309, 0.0026042075543896309,
+	-0.0019197584342902901, -0.0019197584342902901, 0.0019197584342902901, 0.0019197584342902901, -0.0019197584342902901, -0.0019197584342902901, -0.0019197584342902901, -0.0019197584342902901,
+	-0.0032714010575743647, 0.0032714010575743647, -0.0032714010575743647, 0.0032714010575743647, -0.0032714010575743647, -0.0032714010575743647, -0.0032714010575743647, -0.0032714010575743647,
+	-0.0027357359567305017, 0.0027357359567305017, -0.0027357359567305017, -0.0027357359567305017, -0.0027357359567305017, -0.0027357359567305017, -0.0027357359567305017, 0.0027357359567305017,
+	0.0022808880452243464, 0.0022808880452243464, 0.0022808880452243464, 0.0022808880452243464, -0.0022808880452243464, -0.0022808880452243464, 0.0022808880452243464, -0.0022808880452243464,
+	-0.0039924320855326727, 0.0039924320855326727, 0.0039924320855326727, 0.0039924320855326727, 0.0039924320855326727, -0.0039924320855326727, -0.0039924320855326727, -0.0039924320855326727,
+	-0.0025667324145962605, -0.0025667324145962605, -0.0025667324145962605, -0.0025667324145962605, 0.0025667324145962605, 0.0025667324145962605, 0.0025667324145962605, -0.0025667324145962605,
+	0.0030115720682919438, 0.0030115720682919438, 0.0030115720682919438, 0.0030115720682919438, -0.0030115720682919438, 0.0030115720682919438, -0.0030115720682919438, -0.0030115720682919438,
+	-0.0018424938719644134, -0.0018424938719644134, -0.0018424938719644134, -0.0018424938719644134, -0.0018424938719644134, 0.0018424938719644134, 0.0018424938719644134, 0.0018424938719644134,
+	0.0028147159303849481, -0.0028147159303849481, -0.0028147159303849481, -0.0028147159303849481, 0.0028147159303849481, 0.0028147159303849481, 0.0028147159303849481, 0.0028147159303849481,
+	-0.0026023500379805881, -0.0026023500379805881, 0.0026023500379805881, 0.0026023500379805881, 0.0026023500379805881, -0.0026023500379805881, -0.0026023500379805881, 0.0026023500379805881,
+	-0.0021398995046691145, -0.0021398995046691145, 0.0021398995046691145, -0.0021398995046691145, -0.0021398995046691145, -0.0021398995046691145, -0.0021398995046691145, -0.0021398995046691145,
+	-0.0027417754226506147, -0.0027417754226506147, -0.0027417754226506147, -0.0027417754226506147, 0.0027417754226506147, -0.0027417754226506147, 0.0027417754226506147, -0.0027417754226506147,
+	-0.0027585133710577832, 0.0027585133710577832, 0.0027585133710577832, 0.0027585133710577832, -0.0027585133710577832, -0.0027585133710577832, -0.0027585133710577832, -0.0027585133710577832,
+	-0.0025406865834180946, -0.0025406865834180946, 0.0025406865834180946, 0.0025406865834180946, 0.0025406865834180946, 0.0025406865834180946, 0.0025406865834180946, -0.0025406865834180946,
+	0.0023154500308680158, -0.0023154500308680158, 0.0023154500308680158, 0.0023154500308680158, -0.0023154500308680158, -0.0023154500308680158, 0.0023154500308680158, -0.0023154500308680158,
+	-0.002250842971067148, -0.002250842971067148, -0.002250842971067148, -0.002250842971067148, -0.002250842971067148, 0.002250842971067148, -0.002250842971067148, 0.002250842971067148,
+	-0.0022219753390052988, 0.0022219753390052988, 0.0022219753390052988, -0.0022219753390052988, -0.0022219753390052988, -0.0022219753390052988, -0.0022219753390052988, -0.0022219753390052988,
+	0.0020966386580279048, 0.0020966386580279048, -0.0020966386580279048, 0.0020966386580279048, -0.0020966386580279048, -0.0020966386580279048, -0.0020966386580279048, 0.0020966386580279048,
+	0.0030616133573443047, 0.0030616133573443047, -0.0030616133573443047, 0.0030616133573443047, -0.0030616133573443047, -0.0030616133573443047, 0.0030616133573443047, -0.0030616133573443047,
+	0.0025475177776437003, -0.0025475177776437003, 0.0025475177776437003, -0.0025475177776437003, 0.0025475177776437003, 0.0025475177776437003, -0.0025475177776437003, 0.0025475177776437003,
+	0.0036028611577781878, -0.0036028611577781878, 0.0036028611577781878, -0.0036028611577781878, -0.0036028611577781878, -0.0036028611577781878, -0.0036028611577781878, 0.0036028611577781878,
+	0.0024346152912077148, 0.0024346152912077148, 0.0024346152912077148, 0.0024346152912077148, 0.0024346152912077148, -0.0024346152912077148, -0.0024346152912077148, -0.0024346152912077148,
+	0.0037069125277732692, -0.0037069125277732692, -0.0037069125277732692, -0.0037069125277732692, -0.0037069125277732692, -0.0037069125277732692, 0.0037069125277732692, -0.0037069125277732692,
+	-0.0027300010016971174, 0.0027300010016971174, -0.0027300010016971174, -0.0027300010016971174, 0.0027300010016971174, -0.0027300010016971174, 0.0027300010016971174, 0.0027300010016971174,
+	-0.0027655475725412082, 0.0027655475725412082, -0.0027655475725412082, -0.0027655475725412082, 0.0027655475725412082, 0.0027655475725412082, 0.0027655475725412082, 0.0027655475725412082,
+	-0.0032674119649582231, 0.0032674119649582231, 0.0032674119649582231, 0.0032674119649582231, -0.0032674119649582231, -0.0032674119649582231, -0.0032674119649582231, -0.0032674119649582231,
+	-0.0020184199615902797, -0.0020184199615902797, 0.0020184199615902797, -0.0020184199615902797, -0.0020184199615902797, -0.0020184199615902797, -0.0020184199615902797, -0.0020184199615902797,
+	-0.0023792552120004986, -0.0023792552120004986, -0.0023792552120004986, 0.0023792552120004986, -0.0023792552120004986, -0.0023792552120004986, 0.0023792552120004986, 0.0023792552120004986,
+	-0.001617896792276464, -0.001617896792276464, -0.001617896792276464, -0.001617896792276464, 0.001617896792276464, -0.001617896792276464, -0.001617896792276464, -0.001617896792276464,
+	-0.0023518898336465097, -0.0023518898336465097, -0.0023518898336465097, 0.0023518898336465097, -0.0023518898336465097, -0.0023518898336465097, -0.0023518898336465097, -0.0023518898336465097,
+	-0.0032540946888453028, 0.0032540946888453028, -0.0032540946888453028, -0.0032540946888453028, 0.0032540946888453028, 0.0032540946888453028, -0.0032540946888453028, 0.0032540946888453028,
+	-0.0024527336889680522, -0.0024527336889680522, -0.0024527336889680522, -0.0024527336889680522, 0.0024527336889680522, 0.0024527336889680522, -0.0024527336889680522, 0.0024527336889680522,
+	-0.0032777957861956602, 0.0032777957861956602, 0.0032777957861956602, -0.0032777957861956602, -0.0032777957861956602, -0.0032777957861956602, 0.0032777957861956602, 0.0032777957861956602,
+	-0.0022763305322863118, 0.0022763305322863118, -0.0022763305322863118, -0.0022763305322863118, -0.0022763305322863118, -0.0022763305322863118, 0.0022763305322863118, 0.0022763305322863118,
+	0.0028921530488799706, 0.0028921530488799706, -0.0028921530488799706, 0.0028921530488799706, -0.0028921530488799706, 0.0028921530488799706, 0.0028921530488799706, 0.0028921530488799706,
+	-0.0015668100158463356, -0.0015668100158463356, -0.0015668100158463356, -0.0015668100158463356, -0.0015668100158463356, -0.0015668100158463356, 0.0015668100158463356, -0.0015668100158463356,
+	-0.0027776062036556515, 0.0027776062036556515, -0.0027776062036556515, -0.0027776062036556515, 0.0027776062036556515, 0.0027776062036556515, -0.0027776062036556515, -0.0027776062036556515,
+	-0.0019607557500068186, 0.0019607557500068186, -0.0019607557500068186, -0.0019607557500068186, 0.0019607557500068186, 0.0019607557500068186, 0.0019607557500068186, 0.0019607557500068186,
+	-0.0022486403423198128, 0.0022486403423198128, -0.0022486403423198128, 0.0022486403423198128, -0.0022486403423198128, -0.0022486403423198128, -0.0022486403423198128, -0.0022486403423198128,
+	-0.0021843783948572375, -0.0021843783948572375, 0.0021843783948572375, 0.0021843783948572375, 0.0021843783948572375, 0.0021843783948572375, -0.0021843783948572375, 0.0021843783948572375,
+	0.0033240509898896987, 0.0033240509898896987, -0.0033240509898896987, 0.0033240509898896987, 0.0033240509898896987, -0.0033240509898896987, 0.0033240509898896987, -0.0033240509898896987,
+	0.0028696598447136355, -0.0028696598447136355, 0.0028696598447136355, 0.0028696598447136355, -0.0028696598447136355, -0.0028696598447136355, 0.0028696598447136355, -0.0028696598447136355,
+	0.0022509140236073844, 0.0022509140236073844, -0.0022509140236073844, -0.0022509140236073844, -0.0022509140236073844, 0.0022509140236073844, -0.0022509140236073844, -0.0022509140236073844,
+	0.0025312974977439698, 0.0025312974977439698, 0.0025312974977439698, 0.0025312974977439698, 0.0025312974977439698, -0.0025312974977439698, -0.0025312974977439698, -0.0025312974977439698,
+	0.0024617472112152118, 0.0024617472112152118, 0.0024617472112152118, 0.0024617472112152118, 0.0024617472112152118, -0.0024617472112152118, -0.0024617472112152118, -0.0024617472112152118,
+	-0.0028937060544022854, 0.0028937060544022854, 0.0028937060544022854, 0.0028937060544022854, -0.0028937060544022854, -0.0028937060544022854, -0.0028937060544022854, 0.0028937060544022854,
+	0.0019168148290519159, -0.0019168148290519159, 0.0019168148290519159, 0.0019168148290519159, -0.0019168148290519159, -0.0019168148290519159, -0.0019168148290519159, -0.0019168148290519159,
+	0.0023353244414084868, -0.0023353244414084868, -0.0023353244414084868, -0.0023353244414084868, 0.0023353244414084868, 0.0023353244414084868, 0.0023353244414084868, 0.0023353244414084868,
+	-0.0019138407727248689, 0.0019138407727248689, -0.0019138407727248689, -0.0019138407727248689, -0.0019138407727248689, -0.0019138407727248689, -0.0019138407727248689, -0.0019138407727248689,
+	-0.003023600248317714, 0.003023600248317714, 0.003023600248317714, -0.003023600248317714, -0.003023600248317714, -0.003023600248317714, -0.003023600248317714, -0.003023600248317714,
+	-0.0024044788637844977, -0.0024044788637844977, 0.0024044788637844977, -0.0024044788637844977, 0.0024044788637844977, 0.0024044788637844977, -0.0024044788637844977, 0.0024044788637844977,
+	-0.0024702532153178243, 0.0024702532153178243, -0.0024702532153178243, 0.0024702532153178243, -0.0024702532153178243, -0.0024702532153178243, 0.0024702532153178243, 0.0024702532153178243,
+	0.0022348866006025817, -0.0022348866006025817, -0.0022348866006025817, 0.0022348866006025817, -0.0022348866006025817, 0.0022348866006025817, -0.0022348866006025817, -0.0022348866006025817,
+	-0.0013678223017322415, 0.0013678223017322415, -0.0013678223017322415, -0.0013678223017322415, -0.0013678223017322415, -0.0013678223017322415, -0.0013678223017322415, -0.0013678223017322415,
+	-0.0035235969739627949, -0.0035235969739627949, 0.0035235969739627949, -0.0035235969739627949, -0.0035235969739627949, 0.0035235969739627949, 0.0035235969739627949, 0.0035235969739627949,
+	-0.0028852305013883457, 0.0028852305013883457, 0.0028852305013883457, -0.0028852305013883457, -0.0028852305013883457, -0.0028852305013883457, -0.0028852305013883457, -0.0028852305013883457,
+	-0.0024217141799733229, 0.0024217141799733229, 0.0024217141799733229, 0.0024217141799733229, 0.0024217141799733229, -0.0024217141799733229, -0.0024217141799733229, -0.0024217141799733229,
+	0.0017781507215987105, 0.0017781507215987105, 0.0017781507215987105, 0.0017781507215987105, 0.0017781507215987105, 0.0017781507215987105, -0.0017781507215987105, -0.0017781507215987105,
+	-0.0023880454262640571, -0.0023880454262640571, -0.0023880454262640571, -0.0023880454262640571, 0.0023880454262640571, 0.0023880454262640571, 0.0023880454262640571, -0.0023880454262640571,
+	-0.0026112519062359472, 0.0026112519062359472, -0.0026112519062359472, 0.0026112519062359472, -0.0026112519062359472, -0.0026112519062359472, -0.0026112519062359472, -0.0026112519062359472,
+	-0.0019898568404151588, -0.0019898568404151588, -0.0019898568404151588, -0.0019898568404151588, 0.0019898568404151588, 0.0019898568404151588, -0.0019898568404151588, 0.0019898568404151588,
+	-0.0021010946673370298, -0.0021010946673370298, -0.0021010946673370298, -0.0021010946673370298, 0.0021010946673370298, -0.0021010946673370298, -0.0021010946673370298, -0.0021010946673370298,
+	-0.0022248377413405457, -0.0022248377413405457, 0.0022248377413405457, -0.0022248377413405457, 0.0022248377413405457, 0.0022248377413405457, 0.0022248377413405457, 0.0022248377413405457,
+	-0.0018512231840506264, -0.0018512231840506264, 0.0018512231840506264, 0.0018512231840506264, -0.0018512231840506264, -0.0018512231840506264, -0.0018512231840506264, -0.0018512231840506264,
+	0.0029625661162544594, -0.0029625661162544594, 0.0029625661162544594, -0.0029625661162544594, -0.0029625661162544594, -0.0029625661162544594, 0.0029625661162544594, 0.0029625661162544594,
+	-0.0021752735193440592, 0.0021752735193440592, 0.0021752735193440592, 0.0021752735193440592, -0.0021752735193440592, -0.0021752735193440592, -0.0021752735193440592, -0.0021752735193440592,
+	0.0022496147771573433, -0.0022496147771573433, 0.0022496147771573433, 0.0022496147771573433, -0.0022496147771573433, -0.0022496147771573433, -0.0022496147771573433, -0.0022496147771573433,
+	-0.0019436625388984663, -0.0019436625388984663, -0.0019436625388984663, -0.0019436625388984663, 0.0019436625388984663, 0.0019436625388984663, 0.0019436625388984663, -0.0019436625388984663,
+	-0.0018120123322029045, 0.0018120123322029045, -0.0018120123322029045, -0.0018120123322029045, 0.0018120123322029045, 0.0018120123322029045, 0.0018120123322029045, 0.0018120123322029045,
+	-0.0024921678487993754, 0.0024921678487993754, 0.0024921678487993754, 0.0024921678487993754, -0.0024921678487993754, -0.0024921678487993754, 0.0024921678487993754, -0.0024921678487993754,
+	-0.0031425117495851394, 0.0031425117495851394, -0.0031425117495851394, 0.0031425117495851394, -0.0031425117495851394, -0.0031425117495851394, 0.0031425117495851394, -0.0031425117495851394,
+	0.001883481037318051, 0.001883481037318051, -0.001883481037318051, 0.001883481037318051, -0.001883481037318051, -0.001883481037318051, -0.001883481037318051, -0.001883481037318051,
+	-0.0023579902017439678, 0.0023579902017439678, 0.0023579902017439678, 0.0023579902017439678, 0.0023579902017439678, -0.0023579902017439678, -0.0023579902017439678, -0.0023579902017439678,
+	-0.0022201888751364929, -0.0022201888751364929, -0.0022201888751364929, -0.0022201888751364929, -0.0022201888751364929, 0.0022201888751364929, -0.0022201888751364929, -0.0022201888751364929,
+	0.0021733144993061069, 0.0021733144993061069, -0.0021733144993061069, 0.0021733144993061069, 0.0021733144993061069, -0.0021733144993061069, -0.0021733144993061069, -0.0021733144993061069,
+	0.0017774604969221261, 0.0017774604969221261, -0.0017774604969221261, 0.0017774604969221261, -0.0017774604969221261, -0.0017774604969221261, -0.0017774604969221261, -0.0017774604969221261,
+	-0.0021509227987686814, -0.0021509227987686814, -0.0021509227987686814, 0.0021509227987686814, 0.0021509227987686814, 0.0021509227987686814, -0.0021509227987686814, 0.0021509227987686814,
+	-0.0022975549410912785, 0.0022975549410912785, 0.0022975549410912785, 0.0022975549410912785, 0.0022975549410912785, -0.0022975549410912785, 0.0022975549410912785, -0.0022975549410912785,
+	-0.0030105468816399583, -0.0030105468816399583, 0.0030105468816399583, -0.0030105468816399583, 0.0030105468816399583, -0.0030105468816399583, 0.0030105468816399583, 0.0030105468816399583,
+	-0.0026178293413892796, 0.0026178293413892796, 0.0026178293413892796, -0.0026178293413892796, 0.0026178293413892796, 0.0026178293413892796, -0.0026178293413892796, -0.0026178293413892796,
+	-0.0028166749504229005, -0.0028166749504229005, 0.0028166749504229005, -0.0028166749504229005, 0.0028166749504229005, 0.0028166749504229005, 0.0028166749504229005, -0.0028166749504229005,
+	-0.0022685858054005206, -0.0022685858054005206, 0.0022685858054005206, -0.0022685858054005206, 0.0022685858054005206, 0.0022685858054005206, 0.0022685858054005206, 0.0022685858054005206,
+	-0.0025977113221394262, 0.0025977113221394262, 0.0025977113221394262, -0.0025977113221394262, 0.0025977113221394262, 0.0025977113221394262, -0.0025977113221394262, -0.0025977113221394262,
+	-0.001540520575958787, -0.001540520575958787, -0.001540520575958787, -0.001540520575958787, 0.001540520575958787, -0.001540520575958787, -0.001540520575958787, -0.001540520575958787,
+	-0.001617896792276464, -0.001617896792276464, 0.001617896792276464, -0.001617896792276464, -0.001617896792276464, -0.001617896792276464, -0.001617896792276464, -0.001617896792276464,
+	-0.0022213561668689517, -0.0022213561668689517, -0.0022213561668689517, -0.0022213561668689517, 0.0022213561668689517, -0.0022213561668689517, -0.0022213561668689517, 0.0022213561668689517,
+	0.0022172249691723364, 0.0022172249691723364, -0.0022172249691723364, 0.0022172249691723364, 0.0022172249691723364, 0.0022172249691723364, 0.0022172249691723364, 0.0022172249691723364,
+	-0.002843786569704616, -0.002843786569704616, 0.002843786569704616, -0.002843786569704616, 0.002843786569704616, 0.002843786569704616, 0.002843786569704616, -0.002843786569704616,
+	-0.0025567241567857886, -0.0025567241567857886, 0.0025567241567857886, 0.0025567241567857886, 0.0025567241567857886, -0.0025567241567857886, -0.0025567241567857886, 0.0025567241567857886,
+	-0.0025682955704814658, 0.0025682955704814658, 0.0025682955704814658, -0.0025682955704814658, -0.0025682955704814658, -0.0025682955704814658, -0.0025682955704814658, -0.0025682955704814658,
+	-0.0019472050155474065, -0.0019472050155474065, 0.0019472050155474065, 0.0019472050155474065, -0.0019472050155474065, -0.0019472050155474065, -0.0019472050155474065, 0.0019472050155474065,
+	-0.0022674083633051709, 0.0022674083633051709, -0.0022674083633051709, -0.0022674083633051709, -0.0022674083633051709, -0.0022674083633051709, 0.0022674083633051709, 0.0022674083633051709,
+	-0.0027166025226810697, -0.0027166025226810697, 0.0027166025226810697, -0.0027166025226810697, -0.0027166025226810697, -0.0027166025226810697, -0.0027166025226810697, 0.0027166025226810697,
+	0.0023561631364235978, -0.0023561631364235978, 0.0023561631364235978, 0.0023561631364235978, -0.0023561631364235978, -0.0023561631364235978, -0.0023561631364235978, -0.0023561631364235978,
+	-0.002384574002155354, 0.002384574002155354, -0.002384574002155354, -0.002384574002155354, -0.002384574002155354, -0.002384574002155354, 0.002384574002155354, 0.002384574002155354,
+	-0.0019398460024514709, -0.0019398460024514709, -0.0019398460024514709, -0.0019398460024514709, 0.0019398460024514709, -0.0019398460024514709, -0.0019398460024514709, -0.0019398460024514709,
+	-0.0021614994769010463, -0.0021614994769010463, 0.0021614994769010463, -0.0021614994769010463, -0.0021614994769010463, -0.0021614994769010463, 0.0021614994769010463, 0.0021614994769010463,
+	-0.0020740744013213333, 0.0020740744013213333, -0.0020740744013213333, -0.0020740744013213333, 0.0020740744013213333, 0.0020740744013213333, 0.0020740744013213333, 0.0020740744013213333,
+	-0.0025340989979018708, -0.0025340989979018708, -0.0025340989979018708, 0.0025340989979018708, -0.0025340989979018708, -0.0025340989979018708, 0.0025340989979018708, 0.0025340989979018708,
+	0.0023585281709771881, 0.0023585281709771881, 0.0023585281709771881, 0.0023585281709771881, 0.0023585281709771881, 0.0023585281709771881, -0.0023585281709771881, 0.0023585281709771881,
+	-0.0025671079780232257, 0.0025671079780232257, 0.0025671079780232257, 0.0025671079780232257, 0.0025671079780232257, 0.0025671079780232257, -0.0025671079780232257, 0.0025671079780232257,
+	-0.0027738302686602201, -0.0027738302686602201, 0.0027738302686602201, 0.0027738302686602201, 0.0027738302686602201, -0.0027738302686602201, 0.0027738302686602201, -0.0027738302686602201,
+	-0.0019394602886616151, 0.0019394602886616151, 0.0019394602886616151, 0.0019394602886616151, -0.0019394602886616151, -0.0019394602886616151, -0.0019394602886616151, -0.0019394602886616151,
+	-0.0016911215101717443, -0.0016911215101717443, 0.0016911215101717443, -0.0016911215101717443, 0.0016911215101717443, 0.0016911215101717443, 0.0016911215101717443, 0.0016911215101717443,
+	-0.002156515648721592, -0.002156515648721592, 0.002156515648721592, 0.002156515648721592, 0.002156515648721592, -0.002156515648721592, 0.002156515648721592, 0.002156515648721592,
+	-0.0015901355497697281, -0.0015901355497697281, -0.0015901355497697281, -0.0015901355497697281, -0.0015901355497697281, -0.0015901355497697281, 0.0015901355497697281, -0.0015901355497697281,
+	-0.0015279036748853418, -0.0015279036748853418, 0.0015279036748853418, 0.0015279036748853418, -0.0015279036748853418, 0.0015279036748853418, 0.0015279036748853418, 0.0015279036748853418,
+	-0.0023999822530238087, -0.0023999822530238087, -0.0023999822530238087, -0.0023999822530238087, 0.0023999822530238087, -0.0023999822530238087, -0.0023999822530238087, -0.0023999822530238087,
+	-0.0029257913515005635, 0.0029257913515005635, 0.0029257913515005635, -0.0029257913515005635, 0.0029257913515005635, 0.0029257913515005635, -0.0029257913515005635, -0.0029257913515005635,
+	-0.0021904483118660224, 0.0021904483118660224, -0.0021904483118660224, 0.0021904483118660224, -0.0021904483118660224, -0.0021904483118660224, -0.0021904483118660224, -0.0021904483118660224,
+	-0.0022884602159409916, -0.0022884602159409916, 0.0022884602159409916, 0.0022884602159409916, 0.0022884602159409916, 0.0022884602159409916, -0.0022884602159409916, -0.0022884602159409916,
+	-0.0028347933481832378, -0.0028347933481832378, 0.0028347933481832378, -0.0028347933481832378, 0.0028347933481832378, 0.0028347933481832378, -0.0028347933481832378, 0.0028347933481832378,
+	-0.0018471833396200303, 0.0018471833396200303, -0.0018471833396200303, 0.0018471833396200303, -0.0018471833396200303, -0.0018471833396200303, -0.0018471833396200303, -0.0018471833396200303,
+	0.002291951940775477, 0.002291951940775477, -0.002291951940775477, -0.002291951940775477, -0.002291951940775477, -0.002291951940775477, 0.002291951940775477, -0.002291951940775477,
+	-0.003141232803860881, -0.003141232803860881, 0.003141232803860881, 0.003141232803860881, -0.003141232803860881, 0.003141232803860881, 0.003141232803860881, -0.003141232803860881,
+	-0.0011900386956973325, -0.0011900386956973325, 0.0011900386956973325, 0.0011900386956973325, 0.0011900386956973325, 0.0011900386956973325, 0.0011900386956973325, 0.0011900386956973325,
+	-0.0023473627717971479, -0.0023473627717971479, -0.0023473627717971479, -0.0023473627717971479, -0.0023473627717971479, 0.0023473627717971479, 0.0023473627717971479, 0.0023473627717971479,
+	-0.0017768717758744512, -0.0017768717758744512, -0.0017768717758744512, -0.0017768717758744512, -0.0017768717758744512, 0.0017768717758744512, -0.0017768717758744512, 0.0017768717758744512,
+	-0.0013037430608017031, -0.0013037430608017031, 0.0013037430608017031, 0.0013037430608017031, -0.0013037430608017031, -0.0013037430608017031, -0.0013037430608017031, -0.0013037430608017031,
+	-0.0020832807804634207, -0.0020832807804634207, -0.0020832807804634207, -0.0020832807804634207, -0.0020832807804634207, -0.0020832807804634207, 0.0020832807804634207, -0.0020832807804634207,
+	-0.0028364072558828982, 0.0028364072558828982, -0.0028364072558828982, 0.0028364072558828982, 0.0028364072558828982, 0.0028364072558828982, -0.0028364072558828982, -0.0028364072558828982,
+	-0.0017536274448541863, -0.0017536274448541863, -0.0017536274448541863, -0.0017536274448541863, -0.0017536274448541863, 0.0017536274448541863, 0.0017536274448541863, 0.0017536274448541863,
+	0.0022415249379332601, 0.0022415249379332601, -0.0022415249379332601, 0.0022415249379332601, 0.0022415249379332601, -0.0022415249379332601, -0.0022415249379332601, -0.0022415249379332601,
+	0.0025328708039920665, -0.0025328708039920665, 0.0025328708039920665, -0.0025328708039920665, -0.0025328708039920665, -0.0025328708039920665, -0.0025328708039920665, -0.0025328708039920665,
+	-0.001850045741955277, 0.001850045741955277, 0.001850045741955277, 0.001850045741955277, -0.001850045741955277, -0.001850045741955277, -0.001850045741955277, -0.001850045741955277,
+	0.0019697692722539782, 0.0019697692722539782, 0.0019697692722539782, 0.0019697692722539782, 0.0019697692722539782, 0.0019697692722539782, -0.0019697692722539782, 0.0019697692722539782,
+	-0.0020646244134698631, -0.0020646244134698631, -0.0020646244134698631, -0.0020646244134698631, -0.0020646244134698631, 0.0020646244134698631, 0.0020646244134698631, -0.0020646244134698631,
+	-0.0022806342861520727, 0.0022806342861520727, -0.0022806342861520727, -0.0022806342861520727, -0.0022806342861520727, -0.0022806342861520727, 0.0022806342861520727, 0.0022806342861520727,
+	-0.0028608493297242951, -0.0028608493297242951, 0.0028608493297242951, 0.0028608493297242951, 0.0028608493297242951, 0.0028608493297242951, -0.0028608493297242951, 0.0028608493297242951,
+	-0.002439741224467642, 0.002439741224467642, -0.002439741224467642, -0.002439741224467642, -0.002439741224467642, -0.002439741224467642, 0.002439741224467642, 0.002439741224467642,
+	-0.0017881589794091824, -0.0017881589794091824, -0.0017881589794091824, -0.0017881589794091824, -0.0017881589794091824, 0.0017881589794091824, 0.0017881589794091824, 0.0017881589794091824,
+	0.001688766625981045, -0.001688766625981045, 0.001688766625981045, 0.001688766625981045, -0.001688766625981045, -0.001688766625981045, -0.001688766625981045, -0.001688766625981045,
+	-0.0018036890346323289, -0.0018036890346323289, -0.0018036890346323289, -0.0018036890346323289, -0.0018036890346323289, -0.0018036890346323289, 0.0018036890346323289, -0.0018036890346323289,
+	-0.0025630579832297382, 0.0025630579832297382, 0.0025630579832297382, -0.0025630579832297382, 0.0025630579832297382, 0.0025630579832297382, -0.0025630579832297382, 0.0025630579832297382,
+	-0.0023887661020293143, 0.0023887661020293143, -0.0023887661020293143, 0.0023887661020293143, 0.0023887661020293143, 0.0023887661020293143, 0.0023887661020293143, 0.0023887661020293143,
+	-0.0021177717135668532, -0.0021177717135668532, 0.0021177717135668532, -0.0021177717135668532, -0.0021177717135668532, -0.0021177717135668532, -0.0021177717135668532, -0.0021177717135668532,
+	-0.002518995257920144, 0.002518995257920144, 0.002518995257920144, 0.002518995257920144, 0.002518995257920144, 0.002518995257920144, -0.002518995257920144, -0.002518995257920144,
+	-0.002086620249854542, -0.002086620249854542, 0.002086620249854542, -0.002086620249854542, 0.002086620249854542, 0.002086620249854542, -0.002086620249854542, -0.002086620249854542,
+	0.0021652957126222601, -0.0021652957126222601, -0.0021652957126222601, 0.0021652957126222601, -0.0021652957126222601, -0.0021652957126222601, -0.0021652957126222601, -0.0021652957126222601,
+	-0.0015376784743493224, -0.0015376784743493224, -0.0015376784743493224, -0.0015376784743493224, 0.0015376784743493224, 0.0015376784743493224, -0.0015376784743493224, 0.0015376784743493224,
+	-0.0025575057347283913, 0.0025575057347283913, 0.0025575057347283913, -0.0025575057347283913, -0.0025575057347283913, -0.0025575057347283913, 0.0025575057347283913, 0.0025575057347283913,
+	-0.002246904630265461, -0.002246904630265461, -0.002246904630265461, 0.002246904630265461, 0.002246904630265461, 0.002246904630265461, -0.002246904630265461, 0.002246904630265461,
+	-0.0024700197569713324, 0.0024700197569713324, -0.0024700197569713324, 0.0024700197569713324, -0.0024700197569713324, -0.0024700197569713324, -0.0024700197569713324, -0.0024700197569713324,
+	-0.0022704433218095634, -0.0022704433218095634, -0.0022704433218095634, 0.0022704433218095634, -0.0022704433218095634, -0.0022704433218095634, 0.0022704433218095634, 0.0022704433218095634,
+	0.0019972564549626585, -0.0019972564549626585, -0.0019972564549626585, 0.0019972564549626585, -0.0019972564549626585, -0.0019972564549626585, -0.0019972564549626585, -0.0019972564549626585,
+	0.002270544825438473, -0.002270544825438473, 0.002270544825438473, 0.002270544825438473, -0.002270544825438473, 0.002270544825438473, -0.002270544825438473, -0.002270544825438473,
+	0.0026369729258016025, 0.0026369729258016025, -0.0026369729258016025, 0.0026369729258016025, -0.0026369729258016025, -0.0026369729258016025, 0.0026369729258016025, 0.0026369729258016025,
+	-0.0015708194091882592, -0.0015708194091882592, -0.0015708194091882592, -0.0015708194091882592, 0.0015708194091882592, -0.0015708194091882592, 0.0015708194091882592, 0.0015708194091882592,
+	0.0028441925842202539, -0.0028441925842202539, 0.0028441925842202539, 0.0028441925842202539, -0.0028441925842202539, -0.0028441925842202539, -0.0028441925842202539, 0.0028441925842202539,
+	-0.0021633468429471982, 0.0021633468429471982, -0.0021633468429471982, -0.0021633468429471982, -0.0021633468429471982, -0.0021633468429471982, -0.0021633468429471982, -0.0021633468429471982,
+	-0.0016862087345325266, -0.0016862087345325266, -0.0016862087345325266, -0.0016862087345325266, 0.0016862087345325266, 0.0016862087345325266, 0.0016862087345325266, -0.0016862087345325266,
+	-0.0017129752414759497, -0.0017129752414759497, 0.0017129752414759497, -0.0017129752414759497, 0.0017129752414759497, 0.0017129752414759497, 0.0017129752414759497, 0.0017129752414759497,
+	-0.0023902480550113923, -0.0023902480550113923, 0.0023902480550113923, -0.0023902480550113923, -0.0023902480550113923, -0.0023902480550113923, 0.0023902480550113923, 0.0023902480550113923,
+	-0.0018861404323954789, -0.0018861404323954789, 0.0018861404323954789, 0.0018861404323954789, 0.0018861404323954789, -0.0018861404323954789, -0.0018861404323954789, -0.0018861404323954789,
+	0.0026984841249207319, -0.0026984841249207319, 0.0026984841249207319, -0.0026984841249207319, 0.0026984841249207319, 0.0026984841249207319, -0.0026984841249207319, -0.0026984841249207319,
+	-0.0026181034011873352, -0.0026181034011873352, 0.0026181034011873352, -0.0026181034011873352, 0.0026181034011873352, 0.0026181034011873352, -0.0026181034011873352, 0.0026181034011873352,
+	-0.001967789951490244, -0.001967789951490244, 0.001967789951490244, -0.001967789951490244, -0.001967789951490244, -0.001967789951490244, -0.001967789951490244, -0.001967789951490244,
+	-0.0023352533888682499, -0.0023352533888682499, -0.0023352533888682499, 0.0023352533888682499, -0.0023352533888682499, -0.0023352533888682499, 0.0023352533888682499, 0.0023352533888682499,
+	-0.0018641141449221273, -0.0018641141449221273, -0.0018641141449221273, -0.0018641141449221273, -0.0018641141449221273, -0.0018641141449221273, 0.0018641141449221273, 0.0018641141449221273,
+	0.0027304070162127553, 0.0027304070162127553, 0.0027304070162127553, -0.0027304070162127553, 0.0027304070162127553, -0.0027304070162127553, 0.0027304070162127553, -0.0027304070162127553,
+	-0.0032528766452983894, 0.0032528766452983894, -0.0032528766452983894, 0.0032528766452983894, -0.0032528766452983894, -0.0032528766452983894, 0.0032528766452983894, -0.0032528766452983894,
+	-0.0021748167530139667, 0.0021748167530139667, 0.0021748167530139667, 0.0021748167530139667, -0.0021748167530139667, -0.0021748167530139667, -0.0021748167530139667, -0.0021748167530139667,
+	0.0019678407033046985, 0.0019678407033046985, -0.0019678407033046985, 0.0019678407033046985, -0.0019678407033046985, -0.0019678407033046985, 0.0019678407033046985, -0.0019678407033046985,
+	-0.0016458102902265641, 0.0016458102902265641, -0.0016458102902265641, -0.0016458102902265641, -0.0016458102902265641, -0.0016458102902265641, -0.0016458102902265641, -0.0016458102902265641,
+	0.0018984934240337595, 0.0018984934240337595, -0.0018984934240337595, 0.0018984934240337595, -0.0018984934240337595, -0.0018984934240337595, 0.0018984934240337595, -0.0018984934240337595,
+	0.0020103910245435415, 0.0020103910245435415, 0.0020103910245435415, 0.0020103910245435415, 0.0020103910245435415, -0.0020103910245435415, -0.0020103910245435415, -0.0020103910245435415,
+	-0.002506490010838499, -0.002506490010838499, 0.002506490010838499, -0.002506490010838499, -0.002506490010838499, -0.002506490010838499, -0.002506490010838499, -0.002506490010838499,
+	-0.0018974174855673192, -0.0018974174855673192, -0.0018974174855673192, -0.0018974174855673192, -0.0018974174855673192, -0.0018974174855673192, 0.0018974174855673192, -0.0018974174855673192,
+	-0.0023409375920871796, 0.0023409375920871796, -0.0023409375920871796, 0.0023409375920871796, -0.0023409375920871796, 0.0023409375920871796, -0.0023409375920871796, -0.0023409375920871796,
+	-0.0014355962747550843, -0.0014355962747550843, -0.0014355962747550843, -0.0014355962747550843, 0.0014355962747550843, -0.0014355962747550843, 0.0014355962747550843, 0.0014355962747550843,
+	-0.0019769354284549854, -0.0019769354284549854, -0.0019769354284549854, -0.0019769354284549854, -0.0019769354284549854, -0.0019769354284549854, 0.0019769354284549854, -0.0019769354284549854,
+	0.0016258343760571835, 0.0016258343760571835, -0.0016258343760571835, -0.0016258343760571835, 0.0016258343760571835, 0.0016258343760571835, -0.0016258343760571835, -0.0016258343760571835,
+	-0.0024075036719259997, 0.0024075036719259997, -0.0024075036719259997, -0.0024075036719259997, -0.0024075036719259997, -0.0024075036719259997, 0.0024075036719259997, 0.0024075036719259997,
+	0.0018131390224837994, 0.0018131390224837994, -0.0018131390224837994, 0.0018131390224837994, 0.0018131390224837994, 0.0018131390224837994, -0.0018131390224837994, -0.0018131390224837994,
+	-0.0024796930528064036, 0.0024796930528064036, 0.0024796930528064036, 0.0024796930528064036, -0.0024796930528064036, 0.0024796930528064036, 0.0024796930528064036, 0.0024796930528064036,
+	-0.0019288024076261224, 0.0019288024076261224, -0.0019288024076261224, -0.0019288024076261224, -0.0019288024076261224, 0.0019288024076261224, -0.0019288024076261224, -0.0019288024076261224,
+	0.001477456371317343, 0.001477456371317343, -0.001477456371317343, -0.001477456371317343, -0.001477456371317343, -0.001477456371317343, -0.001477456371317343, -0.001477456371317343,
+	-0.0023955972962549205, 0.0023955972962549205, -0.0023955972962549205, -0.0023955972962549205, 0.0023955972962549205, -0.0023955972962549205, 0.0023955972962549205, 0.0023955972962549205,
+	0.0018293187009319662, -0.0018293187009319662, 0.0018293187009319662, -0.0018293187009319662, -0.0018293187009319662, -0.0018293187009319662, -0.0018293187009319662, -0.0018293187009319662,
+	0.0018095762451090774, 0.0018095762451090774, 0.0018095762451090774, 0.0018095762451090774, -0.0018095762451090774, -0.0018095762451090774, -0.0018095762451090774, 0.0018095762451090774,
+	-0.0021964167252458986, -0.0021964167252458986, -0.0021964167252458986, -0.0021964167252458986, 0.0021964167252458986, -0.0021964167252458986, 0.0021964167252458986, -0.0021964167252458986,
+	-0.0021407318344261721, -0.0021407318344261721, 0.0021407318344261721, 0.0021407318344261721, 0.0021407318344261721, -0.0021407318344261721, 0.0021407318344261721, 0.0021407318344261721,
+	0.0027891877677142206, -0.0027891877677142206, -0.0027891877677142206, -0.0027891877677142206, 0.0027891877677142206, 0.0027891877677142206, -0.0027891877677142206, 0.0027891877677142206,
+	-0.0020668473429429801, -0.0020668473429429801, -0.0020668473429429801, -0.0020668473429429801, -0.0020668473429429801, -0.0020668473429429801, 0.0020668473429429801, -0.0020668473429429801,
+	-0.0018905355395272582, -0.0018905355395272582, -0.0018905355395272582, -0.0018905355395272582, -0.0018905355395272582, 0.0018905355395272582, -0.0018905355395272582, -0.0018905355395272582,
+	-0.0025251971296465117, -0.0025251971296465117, 0.0025251971296465117, 0.0025251971296465117, 0.0025251971296465117, -0.0025251971296465117, 0.0025251971296465117, 0.0025251971296465117,
+	-0.0020716789156790703, -0.0020716789156790703, -0.0020716789156790703, -0.0020716789156790703, -0.0020716789156790703, -0.0020716789156790703, -0.0020716789156790703, 0.0020716789156790703,
+	0.0024393453603148954, -0.0024393453603148954, -0.0024393453603148954, -0.0024393453603148954, 0.0024393453603148954, 0.0024393453603148954, -0.0024393453603148954, -0.0024393453603148954,
+	-0.0019344866108450519, -0.0019344866108450519, -0.0019344866108450519, -0.0019344866108450519, 0.0019344866108450519, -0.0019344866108450519, 0.0019344866108450519, -0.0019344866108450519,
+	0.0017580022512601837, -0.0017580022512601837, 0.0017580022512601837, 0.0017580022512601837, -0.0017580022512601837, -0.0017580022512601837, -0.0017580022512601837, -0.0017580022512601837,
+	-0.0019789452003073928, -0.0019789452003073928, -0.0019789452003073928, 0.0019789452003073928, -0.0019789452003073928, 0.0019789452003073928, 0.0019789452003073928, 0.0019789452003073928,
+	-0.0029454221533316526, 0.0029454221533316526, -0.0029454221533316526, -0.0029454221533316526, -0.0029454221533316526, 0.0029454221533316526, 0.0029454221533316526, 0.0029454221533316526,
+	-0.0017940360395230399, 0.0017940360395230399, 0.0017940360395230399, -0.0017940360395230399, 0.0017940360395230399, 0.0017940360395230399, 0.0017940360395230399, 0.0017940360395230399,
+	-0.0023080402659576252, -0.0023080402659576252, -0.0023080402659576252, -0.0023080402659576252, 0.0023080402659576252, -0.0023080402659576252, -0.0023080402659576252, 0.0023080402659576252,
+	0.0024158371198594658, 0.0024158371198594658, -0.0024158371198594658, 0.0024158371198594658, -0.0024158371198594658, -0.0024158371198594658, 0.0024158371198594658, -0.0024158371198594658,
+	0.001231228868308789, 0.001231228868308789, 0.001231228868308789, -0.001231228868308789, -0.001231228868308789, -0.001231228868308789, -0.001231228868308789, -0.001231228868308789,
+	0.0021195886285243328, 0.0021195886285243328, -0.0021195886285243328, -0.0021195886285243328, -0.0021195886285243328, 0.0021195886285243328, -0.0021195886285243328, 0.0021195886285243328,
+	0.0023042541805993028, -0.0023042541805993028, -0.0023042541805993028, 0.0023042541805993028, -0.0023042541805993028, -0.0023042541805993028, 0.0023042541805993028, -0.0023042541805993028,
+	-0.0027288337099646586, -0.0027288337099646586, -0.0027288337099646586, 0.0027288337099646586, -0.0027288337099646586, 0.0027288337099646586, 0.0027288337099646586, 0.0027288337099646586,
+	0.0022446106482521076, 0.0022446106482521076, -0.0022446106482521076, -0.0022446106482521076, 0.0022446106482521076, 0.0022446106482521076, -0.0022446106482521076, 0.0022446106482521076,
+	-0.0019129982926049203, 0.0019129982926049203, 0.0019129982926049203, 0.0019129982926049203, -0.0019129982926049203, -0.0019129982926049203, -0.0019129982926049203, -0.0019129982926049203,
+	-0.0018761423249478975, 0.0018761423249478975, -0.0018761423249478975, -0.0018761423249478975, -0.0018761423249478975, -0.0018761423249478975, 0.0018761423249478975, 0.0018761423249478975,
+	-0.0020779822910343476, 0.0020779822910343476, -0.0020779822910343476, 0.0020779822910343476, -0.0020779822910343476, -0.0020779822910343476, -0.0020779822910343476, -0.0020779822910343476,
+	0.0016607414740391448, 0.0016607414740391448, -0.0016607414740391448, 0.0016607414740391448, -0.0016607414740391448, -0.0016607414740391448, -0.0016607414740391448, -0.0016607414740391448,
+	-0.0024939746133939636, -0.0024939746133939636, 0.0024939746133939636, 0.0024939746133939636, -0.0024939746133939636, 0.0024939746133939636, -0.0024939746133939636, -0.0024939746133939636,
+	-0.0020626044912545648, -0.0020626044912545648, -0.0020626044912545648, -0.0020626044912545648, -0.0020626044912545648, 0.0020626044912545648, 0.0020626044912545648, -0.0020626044912545648,
+	0.002128125083715618, 0.002128125083715618, -0.002128125083715618, -0.002128125083715618, -0.002128125083715618, -0.002128125083715618, 0.002128125083715618, -0.002128125083715618,
+	0.0022810301503048197, -0.0022810301503048197, 0.0022810301503048197, 0.0022810301503048197, -0.0022810301503048197, -0.0022810301503048197, 0.0022810301503048197, 0.0022810301503048197,
+	-0.0023269097905718929, -0.0023269097905718929, -0.0023269097905718929, 0.0023269097905718929, -0.0023269097905718929, -0.0023269097905718929, -0.0023269097905718929, -0.0023269097905718929,
+	-0.0026173116728818416, -0.0026173116728818416, -0.0026173116728818416, -0.0026173116728818416, -0.0026173116728818416, -0.0026173116728818416, 0.0026173116728818416, -0.0026173116728818416,
+	-0.0021417874721668304, 0.0021417874721668304, 0.0021417874721668304, -0.0021417874721668304, -0.0021417874721668304, -0.0021417874721668304, -0.0021417874721668304, -0.0021417874721668304,
+	-0.0020757289104725574, -0.0020757289104725574, -0.0020757289104725574, -0.0020757289104725574, 0.0020757289104725574, -0.0020757289104725574, -0.0020757289104725574, -0.0020757289104725574,
+	-0.0019625523642385159, -0.0019625523642385159, -0.0019625523642385159, 0.0019625523642385159, 0.0019625523642385159, 0.0019625523642385159, -0.0019625523642385159, 0.0019625523642385159,
+	0.0025040640741075633, 0.0025040640741075633, 0.0025040640741075633, -0.0025040640741075633, 0.0025040640741075633, 0.0025040640741075633, -0.0025040640741075633, 0.0025040640741075633,
+	0.0019694647613672498, -0.0019694647613672498, 0.0019694647613672498, -0.0019694647613672498, -0.0019694647613672498, -0.0019694647613672498, -0.0019694647613672498, -0.0019694647613672498,
+	0.0020588387066220242, -0.0020588387066220242, 0.0020588387066220242, -0.0020588387066220242, -0.0020588387066220242, -0.0020588387066220242, -0.0020588387066220242, -0.0020588387066220242,
+	0.0018296942643589312, 0.0018296942643589312, 0.0018296942643589312, 0.0018296942643589312, 0.0018296942643589312, -0.0018296942643589312, -0.0018296942643589312, -0.0018296942643589312,
+	0.0022702809160033083, -0.0022702809160033083, 0.0022702809160033083, 0.0022702809160033083, -0.0022702809160033083, -0.0022702809160033083, -0.0022702809160033083, -0.0022702809160033083,
+	-0.0020923146034363621, -0.0020923146034363621, -0.0020923146034363621, -0.0020923146034363621, 0.0020923146034363621, -0.0020923146034363621, -0.0020923146034363621, 0.0020923146034363621,
+	-0.0022306031474626027, -0.0022306031474626027, -0.0022306031474626027, 0.0022306031474626027, 0.0022306031474626027, 0.0022306031474626027, 0.0022306031474626027, 0.0022306031474626027,
+	-0.0025277245700063571, -0.0025277245700063571, -0.0025277245700063571, 0.0025277245700063571, -0.0025277245700063571, -0.0025277245700063571, -0.0025277245700063571, 0.0025277245700063571,
+	-0.0020307120510512145, 0.0020307120510512145, -0.0020307120510512145, 0.0020307120510512145, 0.0020307120510512145, 0.0020307120510512145, -0.0020307120510512145, -0.0020307120510512145,
+	-0.0028735778847895407, -0.0028735778847895407, -0.0028735778847895407, -0.0028735778847895407, -0.0028735778847895407, 0.0028735778847895407, 0.0028735778847895407, 0.0028735778847895407,
+	-0.0027395220420888245, -0.0027395220420888245, 0.0027395220420888245, 0.0027395220420888245, 0.0027395220420888245, -0.0027395220420888245, 0.0027395220420888245, 0.0027395220420888245,
+	-0.0019470426097411512, -0.0019470426097411512, -0.0019470426097411512, 0.0019470426097411512, 0.0019470426097411512, 0.0019470426097411512, -0.0019470426097411512, -0.0019470426097411512,
+	0.0017128635874841495, 0.0017128635874841495, -0.0017128635874841495, 0.0017128635874841495, -0.0017128635874841495, -0.0017128635874841495, -0.0017128635874841495, -0.0017128635874841495,
+	-0.0025666512116931327, -0.0025666512116931327, 0.0025666512116931327, -0.0025666512116931327, -0.0025666512116931327, 0.0025666512116931327, 0.0025666512116931327, -0.0025666512116931327,
+	-0.0015345623129418022, 0.0015345623129418022, -0.0015345623129418022, -0.0015345623129418022, -0.0015345623129418022, -0.0015345623129418022, -0.0015345623129418022, -0.0015345623129418022,
+	0.0025430922194232485, 0.0025430922194232485, 0.0025430922194232485, -0.0025430922194232485, -0.0025430922194232485, 0.0025430922194232485, 0.0025430922194232485, 0.0025430922194232485,
+	0.0023734593547897688, 0.0023734593547897688, -0.0023734593547897688, -0.0023734593547897688, -0.0023734593547897688, 0.0023734593547897688, -0.0023734593547897688, -0.0023734593547897688,
+	0.0031722726135813913, -0.0031722726135813913, 0.0031722726135813913, -0.0031722726135813913, -0.0031722726135813913, 0.0031722726135813913, -0.0031722726135813913, -0.0031722726135813913,
+	0.0022976970461717522, -0.0022976970461717522, 0.0022976970461717522, 0.0022976970461717522, -0.0022976970461717522, 0.0022976970461717522, -0.0022976970461717522, -0.0022976970461717522,
+	0.0015017461897153756, 0.0015017461897153756, -0.0015017461897153756, -0.0015017461897153756, -0.0015017461897153756, -0.0015017461897153756, -0.0015017461897153756, -0.0015017461897153756,
+	0.0024435577609146376, -0.0024435577609146376, -0.0024435577609146376, -0.0024435577609146376, 0.0024435577609146376, 0.0024435577609146376, 0.0024435577609146376, -0.0024435577609146376,
+	-0.0020983033175420197, 0.0020983033175420197, 0.0020983033175420197, -0.0020983033175420197, -0.0020983033175420197, -0.0020983033175420197, -0.0020983033175420197, -0.0020983033175420197,
+	-0.0023875988102968555, -0.0023875988102968555, -0.0023875988102968555, 0.0023875988102968555, -0.0023875988102968555, -0.0023875988102968555, 0.0023875988102968555, 0.0023875988102968555,
+	0.0029886829999728618, 0.0029886829999728618, -0.0029886829999728618, 0.0029886829999728618, -0.0029886829999728618, 0.0029886829999728618, 0.0029886829999728618, -0.0029886829999728618,
+	-0.0016414151830947846, 0.0016414151830947846, -0.0016414151830947846, 0.0016414151830947846, -0.0016414151830947846, -0.0016414151830947846, -0.0016414151830947846, -0.0016414151830947846,
+	0.0022318719428239707, -0.0022318719428239707, 0.0022318719428239707, -0.0022318719428239707, -0.0022318719428239707, 0.0022318719428239707, -0.0022318719428239707, -0.0022318719428239707,
+	-0.0020686033557231137, -0.0020686033557231137, -0.0020686033557231137, -0.0020686033557231137, 0.0020686033557231137, -0.0020686033557231137, 0.0020686033557231137, -0.0020686033557231137,
+	0.0015697739218104919, -0.0015697739218104919, -0.0015697739218104919, -0.0015697739218104919, 0.0015697739218104919, 0.0015697739218104919, -0.0015697739218104919, -0.0015697739218104919,
+	-0.0025697876738264352, 0.0025697876738264352, 0.0025697876738264352, 0.0025697876738264352, -0.0025697876738264352, -0.0025697876738264352, 0.0025697876738264352, -0.0025697876738264352,
+	-0.0023064365086208562, -0.0023064365086208562, 0.0023064365086208562, -0.0023064365086208562, 0.0023064365086208562, 0.0023064365086208562, -0.0023064365086208562, -0.0023064365086208562,
+	-0.0023315485064130548, 0.0023315485064130548, -0.0023315485064130548, -0.0023315485064130548, -0.0023315485064130548, -0.0023315485064130548, -0.0023315485064130548, -0.0023315485064130548,
+	-0.0023967645879873793, 0.0023967645879873793, 0.0023967645879873793, -0.0023967645879873793, -0.0023967645879873793, -0.0023967645879873793, -0.0023967645879873793, -0.0023967645879873793,
+	-0.0018137987960717107, -0.0018137987960717107, 0.0018137987960717107, -0.0018137987960717107, 0.0018137987960717107, 0.0018137987960717107, 0.0018137987960717107, 0.0018137987960717107,
+	-0.0024846870313487484, 0.0024846870313487484, -0.0024846870313487484, -0.0024846870313487484, -0.0024846870313487484, 0.0024846870313487484, -0.0024846870313487484, -0.0024846870313487484,
+	-0.001696379398149254, 0.001696379398149254, 0.001696379398149254, 0.001696379398149254, -0.001696379398149254, -0.001696379398149254, -0.001696379398149254, -0.001696379398149254,
+	-0.0018042168535026581, 0.0018042168535026581, 0.0018042168535026581, 0.0018042168535026581, -0.0018042168535026581, -0.0018042168535026581, -0.0018042168535026581, -0.0018042168535026581,
+	0.0022127283584116478, -0.0022127283584116478, 0.0022127283584116478, -0.0022127283584116478, -0.0022127283584116478, -0.0022127283584116478, -0.0022127283584116478, -0.0022127283584116478,
+	0.001937217058462716, 0.001937217058462716, -0.001937217058462716, 0.001937217058462716, -0.001937217058462716, -0.001937217058462716, -0.001937217058462716, 0.001937217058462716,
+	0.0021007495549987378, -0.0021007495549987378, -0.0021007495549987378, -0.0021007495549987378, 0.0021007495549987378, -0.0021007495549987378, 0.0021007495549987378, 0.0021007495549987378,
+	0.0024223435024725618, 0.0024223435024725618, 0.0024223435024725618, -0.0024223435024725618, -0.0024223435024725618, -0.0024223435024725618, -0.0024223435024725618, 0.0024223435024725618,
+	-0.0026817766276022361, -0.0026817766276022361, 0.0026817766276022361, -0.0026817766276022361, 0.0026817766276022361, 0.0026817766276022361, -0.0026817766276022361, 0.0026817766276022361,
+	-0.0019894812769881941, 0.0019894812769881941, 0.0019894812769881941, 0.0019894812769881941, -0.0019894812769881941, 0.0019894812769881941, -0.0019894812769881941, -0.0019894812769881941,
+	-0.0021572464748497401, -0.0021572464748497401, -0.0021572464748497401, -0.0021572464748497401, 0.0021572464748497401, -0.0021572464748497401, -0.0021572464748497401, 0.0021572464748497401,
+	-0.0024814693663123186, 0.0024814693663123186, 0.0024814693663123186, 0.0024814693663123186, -0.0024814693663123186, -0.0024814693663123186, -0.0024814693663123186, -0.0024814693663123186,
+	0.0021899001922699116, 0.0021899001922699116, -0.0021899001922699116, -0.0021899001922699116, -0.0021899001922699116, 0.0021899001922699116, 0.0021899001922699116, 0.0021899001922699116,
+	0.0022509749257847299, -0.0022509749257847299, 0.0022509749257847299, -0.0022509749257847299, 0.0022509749257847299, 0.0022509749257847299, 0.0022509749257847299, -0.0022509749257847299,
+	0.0018921494472269183, 0.0018921494472269183, -0.0018921494472269183, -0.0018921494472269183, 0.0018921494472269183, -0.0018921494472269183, -0.0018921494472269183, -0.0018921494472269183,
+	0.0027519257855415599, -0.0027519257855415599, 0.0027519257855415599, -0.0027519257855415599, 0.0027519257855415599, -0.0027519257855415599, 0.0027519257855415599, 0.0027519257855415599,
+	-0.002513970828289126, 0.002513970828289126, 0.002513970828289126, -0.002513970828289126, 0.002513970828289126, 0.002513970828289126, -0.002513970828289126, 0.002513970828289126,
+	-0.0020263981468225628, -0.0020263981468225628, -0.0020263981468225628, -0.0020263981468225628, 0.0020263981468225628, -0.0020263981468225628, -0.0020263981468225628, 0.0020263981468225628,
+	-0.002511230230308571, 0.002511230230308571, -0.002511230230308571, 0.002511230230308571, -0.002511230230308571, -0.002511230230308571, -0.002511230230308571, -0.002511230230308571,
+	-0.0029227360922703892, 0.0029227360922703892, -0.0029227360922703892, -0.0029227360922703892, 0.0029227360922703892, 0.0029227360922703892, -0.0029227360922703892, -0.0029227360922703892,
+	0.00090560218165839257, 0.00090560218165839257, -0.00090560218165839257, -0.00090560218165839257, -0.00090560218165839257, -0.00090560218165839257, -0.00090560218165839257, -0.00090560218165839257,
+	-0.001791599952429213, -0.001791599952429213, -0.001791599952429213, -0.001791599952429213, -0.001791599952429213, -0.001791599952429213, -0.001791599952429213, 0.001791599952429213,
+	-0.0021183198331629644, -0.0021183198331629644, 0.0021183198331629644, -0.0021183198331629644, 0.0021183198331629644, 0.0021183198331629644, 0.0021183198331629644, 0.0021183198331629644,
+	-0.0020496120267541546, -0.0020496120267541546, -0.0020496120267541546, -0.0020496120267541546, -0.0020496120267541546, 0.0020496120267541546, 0.0020496120267541546, 0.0020496120267541546,
+	-0.0010823230446986196, -0.0010823230446986196, -0.0010823230446986196, 0.0010823230446986196, 0.0010823230446986196, 0.0010823230446986196, 0.0010823230446986196, 0.0010823230446986196,
+	-0.0019964748770200558, 0.0019964748770200558, 0.0019964748770200558, -0.0019964748770200558, 0.0019964748770200558, 0.0019964748770200558, -0.0019964748770200558, -0.0019964748770200558,
+	0.00261858046824321, 0.00261858046824321, -0.00261858046824321, 0.00261858046824321, 0.00261858046824321, -0.00261858046824321, -0.00261858046824321, -0.00261858046824321,
+	0.0019220118148520799, -0.0019220118148520799, -0.0019220118148520799, -0.0019220118148520799, 0.0019220118148520799, 0.0019220118148520799, -0.0019220118148520799, -0.0019220118148520799,
+	-0.0019767933233745126, -0.0019767933233745126, -0.0019767933233745126, -0.0019767933233745126, -0.0019767933233745126, 0.0019767933233745126, -0.0019767933233745126, -0.0019767933233745126,
+	-0.0014830086198186904, -0.0014830086198186904, 0.0014830086198186904, -0.0014830086198186904, -0.0014830086198186904, -0.0014830086198186904, -0.0014830086198186904, -0.0014830086198186904,
+	0.0018728434570083404, 0.0018728434570083404, 0.0018728434570083404, -0.0018728434570083404, -0.0018728434570083404, -0.0018728434570083404, -0.0018728434570083404, -0.0018728434570083404,
+	-0.0020519364598561812, -0.0020519364598561812, -0.0020519364598561812, -0.0020519364598561812, -0.0020519364598561812, -0.0020519364598561812, 0.0020519364598561812, 0.0020519364598561812,
+	0.0016306253473417098, 0.0016306253473417098, -0.0016306253473417098, 0.0016306253473417098, -0.0016306253473417098, -0.0016306253473417098, -0.0016306253473417098, -0.0016306253473417098,
+	-0.0016986226283481529, -0.0016986226283481529, -0.0016986226283481529, -0.0016986226283481529, 0.0016986226283481529, 0.0016986226283481529, 0.0016986226283481529, -0.0016986226283481529,
+	-0.0024340062694342582, 0.0024340062694342582, -0.0024340062694342582, 0.0024340062694342582, -0.0024340062694342582, -0.0024340062694342582, 0.0024340062694342582, -0.0024340062694342582,
+	0.0017994563333068047, -0.0017994563333068047, 0.0017994563333068047, 0.0017994563333068047, -0.0017994563333068047, -0.0017994563333068047, -0.0017994563333068047, -0.0017994563333068047,
+	0.0024834486870760532, 0.0024834486870760532, -0.0024834486870760532, -0.0024834486870760532, -0.0024834486870760532, 0.0024834486870760532, -0.0024834486870760532, 0.0024834486870760532,
+	0.0021401329630156059, 0.0021401329630156059, 0.0021401329630156059, -0.0021401329630156059, -0.0021401329630156059, -0.0021401329630156059, -0.0021401329630156059, -0.0021401329630156059,
+	-0.0016238956567450127, -0.0016238956567450127, -0.0016238956567450127, 0.0016238956567450127, -0.0016238956567450127, -0.0016238956567450127, -0.0016238956567450127, -0.0016238956567450127,
+	-0.0023725458221295834, 0.0023725458221295834, -0.0023725458221295834, 0.0023725458221295834, -0.0023725458221295834, -0.0023725458221295834, 0.0023725458221295834, 0.0023725458221295834,
+	0.0026109778464378916, -0.0026109778464378916, 0.0026109778464378916, -0.0026109778464378916, -0.0026109778464378916, -0.0026109778464378916, 0.0026109778464378916, 0.0026109778464378916,
+	-0.0024400863368059344, 0.0024400863368059344, 0.0024400863368059344, 0.0024400863368059344, -0.0024400863368059344, -0.0024400863368059344, 0.0024400863368059344, 0.0024400863368059344,
+	-0.0022832733805037185, 0.0022832733805037185, -0.0022832733805037185, -0.0022832733805037185, -0.0022832733805037185, -0.0022832733805037185, 0.0022832733805037185, -0.0022832733805037185,
+	0.0021860633550971342, 0.0021860633550971342, 0.0021860633550971342, -0.0021860633550971342, 0.0021860633550971342, 0.0021860633550971342, 0.0021860633550971342, 0.0021860633550971342,
+	-0.0018926366646456838, -0.0018926366646456838, -0.0018926366646456838, -0.0018926366646456838, -0.0018926366646456838, 0.0018926366646456838, 0.0018926366646456838, -0.0018926366646456838,
+	0.0022850293932838522, 0.0022850293932838522, -0.0022850293932838522, -0.0022850293932838522, -0.0022850293932838522, 0.0022850293932838522, -0.0022850293932838522, 0.0022850293932838522,
+	-0.0021441626570833116, -0.0021441626570833116, -0.0021441626570833116, -0.0021441626570833116, 0.0021441626570833116, -0.0021441626570833116, -0.0021441626570833116, 0.0021441626570833116,
+	0.0016269813670638604, 0.0016269813670638604, -0.0016269813670638604, 0.0016269813670638604, -0.0016269813670638604, -0.0016269813670638604, 0.0016269813670638604, 0.0016269813670638604,
+	-0.0017518105298967069, 0.0017518105298967069, 0.0017518105298967069, -0.0017518105298967069, 0.0017518105298967069, 0.0017518105298967069, -0.0017518105298967069, -0.0017518105298967069,
+	0.0020128778634518237, 0.0020128778634518237, -0.0020128778634518237, 0.0020128778634518237, 0.0020128778634518237, 0.0020128778634518237, -0.0020128778634518237, -0.0020128778634518237,
+	-0.0023943386512564435, -0.0023943386512564435, 0.0023943386512564435, 0.0023943386512564435, 0.0023943386512564435, -0.0023943386512564435, 0.0023943386512564435, 0.0023943386512564435,
+	-0.0023212458880787455, -0.0023212458880787455, -0.0023212458880787455, 0.0023212458880787455, -0.0023212458880787455, -0.0023212458880787455, -0.0023212458880787455, -0.0023212458880787455,
+	0.0019937241286766094, 0.0019937241286766094, -0.0019937241286766094, 0.0019937241286766094, -0.0019937241286766094, -0.0019937241286766094, -0.0019937241286766094, 0.0019937241286766094,
+	-0.0018109972959138097, -0.0018109972959138097, -0.0018109972959138097, -0.0018109972959138097, 0.0018109972959138097, -0.0018109972959138097, -0.0018109972959138097, -0.0018109972959138097,
+	0.0018774415713979384, 0.0018774415713979384, 0.0018774415713979384, 0.0018774415713979384, -0.0018774415713979384, 0.0018774415713979384, -0.0018774415713979384, 0.0018774415713979384,
+	0.0026357954837062528, 0.0026357954837062528, -0.0026357954837062528, -0.0026357954837062528, 0.0026357954837062528, -0.0026357954837062528, -0.0026357954837062528, -0.0026357954837062528,
+	-0.0022148700849816375, -0.0022148700849816375, -0.0022148700849816375, -0.0022148700849816375, -0.0022148700849816375, 0.0022148700849816375, 0.0022148700849816375, -0.0022148700849816375,
+	-0.0022603944625475274, -0.0022603944625475274, -0.0022603944625475274, 0.0022603944625475274, 0.0022603944625475274, 0.0022603944625475274, 0.0022603944625475274, -0.0022603944625475274,
+	-0.0023193579205810296, 0.0023193579205810296, -0.0023193579205810296, -0.0023193579205810296, 0.0023193579205810296, -0.0023193579205810296, 0.0023193579205810296, 0.0023193579205810296,
+	-0.0016040516972932145, -0.0016040516972932145, -0.0016040516972932145, -0.0016040516972932145, -0.0016040516972932145, 0.0016040516972932145, -0.0016040516972932145, -0.0016040516972932145,
+	-0.0012445055429701455, -0.0012445055429701455, -0.0012445055429701455, -0.0012445055429701455, 0.0012445055429701455, 0.0012445055429701455, -0.0012445055429701455, -0.0012445055429701455,
+	-0.0026724687448312391, -0.0026724687448312391, -0.0026724687448312391, 0.0026724687448312391, 0.0026724687448312391, -0.0026724687448312391, -0.0026724687448312391, 0.0026724687448312391,
+	0.0019203573057008558, 0.0019203573057008558, -0.0019203573057008558, 0.0019203573057008558, 0.0019203573057008558, 0.0019203573057008558, 0.0019203573057008558, 0.0019203573057008558,
+	0.0017733292992255113, -0.0017733292992255113, -0.0017733292992255113, -0.0017733292992255113, 0.0017733292992255113, 0.0017733292992255113, 0.0017733292992255113, 0.0017733292992255113,
+	-0.0022437884688579408, -0.0022437884688579408, -0.0022437884688579408, 0.0022437884688579408, 0.0022437884688579408, 0.0022437884688579408, 0.0022437884688579408, -0.0022437884688579408,
+	-0.0020675680187082373, 0.0020675680187082373, -0.0020675680187082373, -0.0020675680187082373, 0.0020675680187082373, 0.0020675680187082373, -0.0020675680187082373, -0.0020675680187082373,
+	0.0016013923022157868, 0.0016013923022157868, -0.0016013923022157868, -0.0016013923022157868, -0.0016013923022157868, -0.0016013923022157868, 0.0016013923022157868, 0.0016013923022157868,
+	-0.0017701014838261905, 0.0017701014838261905, 0.0017701014838261905, 0.0017701014838261905, 0.0017701014838261905, 0.0017701014838261905, -0.0017701014838261905, -0.0017701014838261905,
+	0.001968307619997682, 0.001968307619997682, -0.001968307619997682, -0.001968307619997682, 0.001968307619997682, 0.001968307619997682, -0.001968307619997682, -0.001968307619997682,
+	-0.0019462711821614394, -0.0019462711821614394, 0.0019462711821614394, 0.0019462711821614394, -0.0019462711821614394, 0.0019462711821614394, 0.0019462711821614394, 0.0019462711821614394,
+	0.0023464390887740719, -0.0023464390887740719, 0.0023464390887740719, 0.0023464390887740719, -0.0023464390887740719, -0.0023464390887740719, 0.0023464390887740719, -0.0023464390887740719,
+	-0.0025471219134909542, -0.0025471219134909542, -0.0025471219134909542, -0.0025471219134909542, -0.0025471219134909542, 0.0025471219134909542, 0.0025471219134909542, -0.0025471219134909542,
+	-0.0014321350010092718, -0.0014321350010092718, -0.0014321350010092718, -0.0014321350010092718, -0.0014321350010092718, -0.0014321350010092718, 0.0014321350010092718, 0.0014321350010092718,
+	0.0018023796378193971, -0.0018023796378193971, -0.0018023796378193971, -0.0018023796378193971, 0.0018023796378193971, 0.0018023796378193971, -0.0018023796378193971, -0.0018023796378193971,
+	0.002173984423256909, -0.002173984423256909, -0.002173984423256909, -0.002173984423256909, -0.002173984423256909, -0.002173984423256909, 0.002173984423256909, -0.002173984423256909,
+	-0.0020614168987963242, -0.0020614168987963242, 0.0020614168987963242, -0.0020614168987963242, -0.0020614168987963242, -0.0020614168987963242, -0.0020614168987963242, -0.0020614168987963242,
+	0.0015159566977626993, -0.0015159566977626993, 0.0015159566977626993, 0.0015159566977626993, 0.0015159566977626993, 0.0015159566977626993, 0.0015159566977626993, 0.0015159566977626993,
+	0.0030346032416914987, -0.0030346032416914987, -0.0030346032416914987, 0.0030346032416914987, 0.0030346032416914987, 0.0030346032416914987, 0.0030346032416914987, -0.0030346032416914987,
+	-0.0018716152630985359, -0.0018716152630985359, 0.0018716152630985359, -0.0018716152630985359, 0.0018716152630985359, 0.0018716152630985359, -0.0018716152630985359, -0.0018716152630985359,
+	0.0024563269174314468, -0.0024563269174314468, 0.0024563269174314468, -0.0024563269174314468, -0.0024563269174314468, -0.0024563269174314468, -0.0024563269174314468, -0.0024563269174314468,
+	-0.0024400152842656976, 0.0024400152842656976, -0.0024400152842656976, 0.0024400152842656976, 0.0024400152842656976, 0.0024400152842656976, 0.0024400152842656976, -0.0024400152842656976,
+	-0.0024226378629963992, 0.0024226378629963992, -0.0024226378629963992, 0.0024226378629963992, 0.0024226378629963992, 0.0024226378629963992, -0.0024226378629963992, -0.0024226378629963992,
+	0.0015006601008860443, 0.0015006601008860443, 0.0015006601008860443, 0.0015006601008860443, -0.0015006601008860443, -0.0015006601008860443, -0.0015006601008860443, 0.0015006601008860443,
+	0.0023706172531803038, -0.0023706172531803038, 0.0023706172531803038, -0.0023706172531803038, -0.0023706172531803038, -0.0023706172531803038, 0.0023706172531803038, 0.0023706172531803038,
+	-0.0022628000985526813, -0.0022628000985526813, -0.0022628000985526813, 0.0022628000985526813, 0.0022628000985526813, 0.0022628000985526813, -0.0022628000985526813, 0.0022628000985526813,
+	0.0020487898473599882, 0.0020487898473599882, 0.0020487898473599882, -0.0020487898473599882, -0.0020487898473599882, -0.0020487898473599882, -0.0020487898473599882, -0.0020487898473599882,
+	0.0023264428738789095, -0.0023264428738789095, -0.0023264428738789095, 0.0023264428738789095, -0.0023264428738789095, 0.0023264428738789095, -0.0023264428738789095, -0.0023264428738789095,
+	0.0015663024977017885, 0.0015663024977017885, 0.0015663024977017885, 0.0015663024977017885, -0.0015663024977017885, -0.0015663024977017885, -0.0015663024977017885, 0.0015663024977017885,
+	-0.0023358827113674888, 0.0023358827113674888, 0.0023358827113674888, 0.0023358827113674888, 0.0023358827113674888, 0.0023358827113674888, 0.0023358827113674888, -0.0023358827113674888,
+	-0.0020417556458765629, -0.0020417556458765629, -0.0020417556458765629, 0.0020417556458765629, -0.0020417556458765629, 0.0020417556458765629, -0.0020417556458765629, -0.0020417556458765629,
+	0.0017214203434012163, -0.0017214203434012163, 0.0017214203434012163, -0.0017214203434012163, -0.0017214203434012163, -0.0017214203434012163, -0.0017214203434012163, -0.0017214203434012163,
+  };
+
+  inline FlatBDT make() { return FlatBDT(std::vector<std::string>(variables, variables + nVars), nTrees, depth, features, thresholds, leafValues); }
+}
+
+#endif
@@ -0,0 +1,70 @@
+#ifndef FlatTreeColumn_h
+#define FlatTreeColumn_h
+
+#include "TBranch.h"
+#include "TClass.h"
+#include "TTree.h"
+
+#include <vector>
+
+//reads one column of a flat tree in either layout written by FlatTreeWriter: a std::vector<T> branch (vector layout, the value is element 0, as Alt$(column,0) in TTree::Draw)
+//or a plain T branch (scalar layout, one entry per candidate). Only this branch is read, and only once per entry.
+//  FlatTreeColumn<float> lxy;
+//  lxy.bind(tree, "_S_lxy_interaction_vertex_beampipeCenter");
+//  for(Long64_t i = 0; i < tree->GetEntries(); ++i) lxy.get(i);
+//The branch address points into this object, so it must not be copied or moved while bound. unbind() and the destructor reset the branch address.
+template<class T> class FlatTreeColumn {
+  public:
+    FlatTreeColumn() {}
+    ~FlatTreeColumn(){ unbind(); }
+
+    FlatTreeColumn(const FlatTreeColumn&) = delete;
+    FlatTreeColumn& operator=(const FlatTreeColumn&) = delete;
+
+    //returns false if the tree has no such branch
+    bool bind(TTree* tree, const char* name){
+	unbind();
+	TBranch* branch = tree->GetBranch(name);
+	if(!branch) return false;
+	TClass* expectedClass = nullptr;
+	EDataType expectedType;
+	branch->GetExpectedType(expectedClass, expectedType);
+	int status = expectedClass ? tree->SetBranchAddress(name, &vector_, &branch_) : tree->SetBranchAddress(name, &scalar_, &branch_);
+	if(status < 0){
+		branch_ = nullptr;
+		return false;
+	}
+	tree_ = tree;
+	return true;
+    }
+
+    void unbind(){
+	if(branch_) tree_->ResetBranchAddress(branch_);
+	delete vector_;
+	vector_ = nullptr;
+	branch_ = nullptr;
+	tree_ = nullptr;
+	readEntry_ = -1;
+    }
+
+    bool isScalar() const { return branch_ && !vector_; }
+
+    //value of the entry (for a TChain: the local entry, bind again for each tree)
+    T get(Long64_t entry){
+	if(readEntry_ != entry){
+		branch_->GetEntry(entry);
+		readEntry_ = entry;
+	}
+	if(vector_) return vector_->empty() ? T(0) : (*vector_)[0];
+	return scalar_;
+    }
+
+  private:
+    TTree* tree_ = nullptr;
+    TBranch* branch_ = nullptr;
+    std::vector<T>* vector_ = nullptr;
+    T scalar_ = T(0);
+    Long64_t readEntry_ = -1;
+};
+
+#endif
@@ -0,0 +1,31 @@
+#ifndef FlatTreeEventId_h
+#define FlatTreeEventId_h
+
+#include "FWCore/Framework/interface/Event.h"
+#include "SexaQAnalysis/AnalyzerAllSteps/interface/FlatTreeWriter.h"
+
+//run, luminosity block and event number of the event which is being analyzed, written as _runNumber, _lumiBlock and _eventNumber to every flat tree.
+//Together with the candidate index (e.g. _S_index) this identifies an entry exactly, also across the different primary datasets (see macros/BDT/DuplicateMask.C).
+class FlatTreeEventId {
+  public:
+    //the columns point to this object, so it has to live as long as the tree is filled
+    void addBranches(FlatTreeWriter& tree){
+	tree.addScalar("_runNumber",&runNumber_);
+	tree.addScalar("_lumiBlock",&lumiBlock_);
+	tree.addScalar("_eventNumber",&eventNumber_);
+    }
+
+    //call this at the start of analyze, before any of the trees is filled
+    void set(edm::Event const& iEvent){
+	runNumber_ = iEvent.id().run();
+	lumiBlock_ = iEvent.id().luminosityBlock();
+	eventNumber_ = iEvent.id().event();
+    }
+
+  private:
+    UInt_t runNumber_ = 0;
+    UInt_t lumiBlock_ = 0;
+    ULong64_t eventNumber_ = 0;
+};
+
+#endif
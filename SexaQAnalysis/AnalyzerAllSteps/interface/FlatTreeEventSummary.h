@@ -0,0 +1,54 @@
+#ifndef FlatTreeEventSummary_h
+#define FlatTreeEventSummary_h
+
+#include "FWCore/Framework/interface/Event.h"
+#include "SexaQAnalysis/AnalyzerAllSteps/interface/FlatTreeWriter.h"
+#include "SexaQAnalysis/Skimming/interface/EventSummary.h"
+
+//the event level counts and sums of the EventSummary written by the InitialProducer in the skimming, read back with one getByToken per event and written as scalar columns
+//(_summary_nTracks, _summary_HT, ...) to a flat tree. The columns are -1 if the input has no EventSummary (e.g. a skim made before it existed).
+class FlatTreeEventSummary {
+  public:
+    //the columns point to this object, so it has to live as long as the tree is filled
+    void addBranches(FlatTreeWriter& tree){
+	tree.addScalar("_summary_nTracks",&nTracks_);
+	tree.addScalar("_summary_nLambdas",&nLambdas_);
+	tree.addScalar("_summary_nKshorts",&nKshorts_);
+	tree.addScalar("_summary_nJets",&nJets_);
+	tree.addScalar("_summary_HT",&HT_);
+	tree.addScalar("_summary_TKHT",&TKHT_);
+	tree.addScalar("_summary_MET",&MET_);
+	tree.addScalar("_summary_TKMET",&TKMET_);
+    }
+
+    //call this at the start of analyze, before any of the trees is filled
+    void set(edm::Event const& iEvent, const edm::EDGetTokenT<EventSummary>& token){
+	edm::Handle<EventSummary> h_summary;
+	iEvent.getByToken(token, h_summary);
+	if(!h_summary.isValid()){
+		nTracks_ = nLambdas_ = nKshorts_ = nJets_ = -1;
+		HT_ = TKHT_ = MET_ = TKMET_ = -1.;
+		return;
+	}
+	nTracks_ = h_summary->ntracks;
+	nLambdas_ = h_summary->nlambdas;
+	nKshorts_ = h_summary->nkshorts;
+	nJets_ = h_summary->njets;
+	HT_ = h_summary->HT;
+	TKHT_ = h_summary->TKHT;
+	MET_ = h_summary->MET.pt();
+	TKMET_ = h_summary->TKMET.rho();
+    }
+
+  private:
+    int nTracks_ = -1;
+    int nLambdas_ = -1;
+    int nKshorts_ = -1;
+    int nJets_ = -1;
+    float HT_ = -1.;
+    float TKHT_ = -1.;
+    float MET_ = -1.;
+    float TKMET_ = -1.;
+};
+
+#endif
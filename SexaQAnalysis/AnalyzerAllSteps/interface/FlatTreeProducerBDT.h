@@ -2,9 +2,16 @@
 #define FlatTreeProducerBDT_h
 #include <stdio.h>     
 #include <stdlib.h> 
-#include <time.h> 
+#include <random>
  
 #include "AnalyzerAllSteps.h"
+#include "FlatTreeEventId.h"
+#include "FlatTreeEventSummary.h"
+#include "FlatTreeWriter.h"
+#include "GenParticleIndex.h"
+#include "PUReweighingTable.h"
+#include "FlatBDT.h"
+#include "FWCore/ParameterSet/interface/FileInPath.h"
 using namespace edm;
 using namespace std; 
 class FlatTreeProducerBDT : public edm::EDAnalyzer
@@ -13,7 +20,7 @@ class FlatTreeProducerBDT : public edm::EDAnalyzer
     explicit FlatTreeProducerBDT(edm::ParameterSet const& cfg);
     virtual ~FlatTreeProducerBDT();
     static void fillDescriptions(edm::ConfigurationDescriptions& descriptions);
-    void FillBranches(const reco::VertexCompositeCandidate * antiS, TVector3 beamspot, TVector3 beamspotVariance, edm::Handle<vector<reco::Vertex>> h_offlinePV,  bool m_runningOnData, edm::Handle<vector<reco::GenParticle>> h_genParticles, edm::Handle<vector<reco::VertexCompositeCandidate> > h_V0Ks, edm::Handle<vector<reco::VertexCompositeCandidate> > h_V0L, unsigned int ngoodPVsPOG, double randomPVz);    
+    void FillBranches(const reco::VertexCompositeCandidate * antiS, unsigned int SIndex, const sexaq::Vec3& beamspot, const sexaq::Vec3& beamspotVariance, edm::Handle<GoodPrimaryVertices> h_goodPVs,  bool m_runningOnData, edm::Handle<vector<reco::GenParticle>> h_genParticles, edm::Handle<vector<reco::VertexCompositeCandidate> > h_V0Ks, edm::Handle<vector<reco::VertexCompositeCandidate> > h_V0L, unsigned int ngoodPVsPOG, double randomPVz);    
 
   private:
 
@@ -23,18 +30,25 @@ class FlatTreeProducerBDT : public edm::EDAnalyzer
     double nTotalRECOSWeighed=0.;
     double nSavedRECOSWeighed=0.;
     int nGENAntiSWithCorrectGranddaughters=0;
+    int nDroppedBDTRECOS=0;
 
     bool m_lookAtAntiS;
     bool m_runningOnData; 
 
-    virtual void beginJob();
-    virtual void analyze(edm::Event const& iEvent, edm::EventSetup const& iSetup);
-    virtual void endJob();
-    
-    virtual void beginRun(edm::Run const&, edm::EventSetup const&);
-    virtual void endRun(edm::Run const&, edm::EventSetup const&);
-    virtual void beginLuminosityBlock(edm::LuminosityBlock const&, edm::EventSetup const&);
-    virtual void endLuminosityBlock(edm::LuminosityBlock const&, edm::EventSetup const&);
+    //the GEN antiS with 2 daughters and their interaction vertex, rebuilt every event and used to match all the RECO S candidates
+    GenParticleIndex m_genAntiS{AnalyzerAllSteps::pdgIdAntiS, false, 2};
+
+    //flight lines of the antiS, Lambda and Ks of a candidate and their best PV in dz, kept as members so they are not allocated again for every candidate
+    LineArrays m_dzLines;
+    std::vector<int> m_dzBestPV;
+    std::vector<double> m_dzmin;
+
+    void beginJob() override;
+    void analyze(edm::Event const& iEvent, edm::EventSetup const& iSetup) override;
+    void endJob() override;
+
+    //index of a random entry of n (n > 0), the same for an event whatever the job splitting or the order of the events
+    unsigned int randomIndex(edm::Event const& iEvent, unsigned int n) const;
 
     //initialization of the different trees
     void Init_PV();
@@ -43,9 +57,18 @@ class FlatTreeProducerBDT : public edm::EDAnalyzer
 
     edm::Service<TFileService> m_fs;
 
+    //run, lumi and event number, written to all the trees
+    FlatTreeEventId m_eventId;
+    //counts and sums of the event from the EventSummary of the InitialProducer
+    FlatTreeEventSummary m_eventSummary;
+
+    //seed of the random PV (randomSeed in the cfi), combined with the run, lumi and event number in randomIndex()
+    std::uint32_t m_randomSeed;
+
     //the collections 
     edm::InputTag m_bsTag;
-    edm::InputTag m_offlinePVTag;
+    edm::InputTag m_goodPVsTag;
+    edm::InputTag m_eventSummaryTag;
     edm::InputTag m_genParticlesTag_GEN;
     edm::InputTag m_genParticlesTag_SIM_GEANT;
     edm::InputTag m_generalTracksTag;
@@ -54,24 +77,46 @@ class FlatTreeProducerBDT : public edm::EDAnalyzer
     edm::InputTag m_V0LTag;
 
     edm::EDGetTokenT<reco::BeamSpot> m_bsToken;
-    edm::EDGetTokenT<vector<reco::Vertex>> m_offlinePVToken;
+    edm::EDGetTokenT<GoodPrimaryVertices> m_goodPVsToken;
+    edm::EDGetTokenT<EventSummary> m_eventSummaryToken;
     edm::EDGetTokenT<vector<reco::GenParticle>> m_genParticlesToken_GEN; 
     edm::EDGetTokenT<vector<reco::GenParticle>> m_genParticlesToken_SIM_GEANT; 
     edm::EDGetTokenT<View<reco::Track>> m_generalTracksToken;
     edm::EDGetTokenT<vector<reco::VertexCompositeCandidate> > m_sCandsToken;
     edm::EDGetTokenT<vector<reco::VertexCompositeCandidate> > m_V0KsToken;
     edm::EDGetTokenT<vector<reco::VertexCompositeCandidate> > m_V0LToken;
+
+    //PU reweighing parameters (per number of good PVs and vz of the PV), loaded at beginJob from m_PUReweighingFile and shared with all other modules using the same file
+    edm::FileInPath m_PUReweighingFile;
+    std::shared_ptr<const PUReweighingTable> m_PUReweighingTable;
+
+    //optional evaluation of the BDT on the saved candidates: the score goes to _S_BDT and the candidates with a score below m_minBDTScore are not saved
+    bool m_evaluateBDT;
+    edm::FileInPath m_BDTWeightsFile;
+    double m_minBDTScore;
+    std::unique_ptr<FlatBDT> m_BDT;
+    //for each input variable of the BDT the branch it is taken from, so the BDT sees exactly the values which are written
+    std::vector<const std::vector<float>*> m_BDTInputs;
+    std::vector<float> m_BDTFeatures;
    
+
     //the trees in the ntuples
-    TTree* _tree_PV;   
-    TTree* _tree;   
-    TTree* _tree_counter;
+    FlatTreeWriter _tree_PV;   
+    FlatTreeWriter _tree;   
+    FlatTreeWriter _tree_counter;
+
+    //layout of FlatTree (vector: as before, scalar: one entry per candidate with plain branches, see FlatTreeWriter.h)
+    FlatTreeWriter::Layout m_flatTreeLayout;
+    //entry of FlatTreePV for the current event, only filled for the scalar layout
+    Long64_t m_eventIndex = -1;
 
     //definition of variables which should go to _tree_PV
     std::vector<int> _nPV,_nGoodPV,_nGoodPVPOG;
     std::vector<float> _PVx,_PVy,_PVz,_goodPVx,_goodPVy,_goodPVz,_goodPVxPOG,_goodPVyPOG,_goodPVzPOG;
 
     //definition of variables which should go to tree
+    //index of the S candidate in the sexaqCandidates collection
+    std::vector<int> _S_index;
     std::vector<float> _S_charge;
     std::vector<float> _S_deltaLInteractionVertexAntiSmin,_S_deltaRAntiSmin,_S_deltaRKsAntiSmin,_S_deltaRLambdaAntiSmin;
     std::vector<float> _S_lxy_interaction_vertex, _S_lxy_interaction_vertex_beampipeCenter, _S_error_lxy_interaction_vertex,_S_error_lxy_interaction_vertex_beampipeCenter,_Ks_lxy_decay_vertex,_Lambda_lxy_decay_vertex,_S_mass,_S_chi2_ndof,_S_event_weighting_factor,_S_event_weighting_factorPU,_S_event_weighting_factorALL;
@@ -84,6 +129,7 @@ class FlatTreeProducerBDT : public edm::EDAnalyzer
     std::vector<float> _S_vz_interaction_vertex,_Ks_vz_decay_vertex,_Lambda_vz_decay_vertex;
     std::vector<float> _S_vx,_S_vy,_S_vz;
     std::vector<float> _Lambda_mass,_Ks_mass;
+    std::vector<float> _S_BDT;
     std::vector<float> _RECO_Lambda_daughter0_charge,_RECO_Lambda_daughter0_pt,_RECO_Lambda_daughter0_pz,_RECO_Lambda_daughter0_dxy_beamspot,_RECO_Lambda_daughter0_dz_beamspot;   
     std::vector<float> _RECO_Lambda_daughter1_charge,_RECO_Lambda_daughter1_pt,_RECO_Lambda_daughter1_pz,_RECO_Lambda_daughter1_dxy_beamspot,_RECO_Lambda_daughter1_dz_beamspot;   
     std::vector<float> _RECO_Ks_daughter0_charge,_RECO_Ks_daughter0_pt,_RECO_Ks_daughter0_pz,_RECO_Ks_daughter0_dxy_beamspot,_RECO_Ks_daughter0_dz_beamspot;   
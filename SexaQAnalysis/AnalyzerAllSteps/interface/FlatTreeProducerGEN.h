@@ -2,6 +2,8 @@
 #define FlatTreeProducerGEN_h
  
 #include "AnalyzerAllSteps.h"
+#include "FlatTreeEventId.h"
+#include "FlatTreeWriter.h"
 #include "DataFormats/GeometryVector/interface/GlobalVector.h"
 
 using namespace edm;
@@ -42,6 +44,9 @@ class FlatTreeProducerGEN : public edm::EDAnalyzer
     void InitPi();
 
     edm::Service<TFileService> m_fs;
+
+    //run, lumi and event number, written to all the trees
+    FlatTreeEventId m_eventId;
  
     //the collections
     edm::InputTag m_bsTag;
@@ -50,9 +55,10 @@ class FlatTreeProducerGEN : public edm::EDAnalyzer
     edm::EDGetTokenT<reco::BeamSpot> m_bsToken;
     edm::EDGetTokenT<vector<reco::GenParticle>> m_genParticlesToken_GEN; 
  
+
     //the trees in the ntuples
-    TTree* _tree_pi;   
-    TTree* _tree;   
+    FlatTreeWriter _tree_pi;   
+    FlatTreeWriter _tree;   
 
     //definition of variables which should go to _tree_pi
     std::vector<float> _pi_eta;	
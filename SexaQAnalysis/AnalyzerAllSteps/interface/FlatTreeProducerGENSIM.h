@@ -2,6 +2,10 @@
 #define FlatTreeProducerGENSIM_h
  
 #include "AnalyzerAllSteps.h"
+#include "FlatTreeEventId.h"
+#include "FlatTreeWriter.h"
+#include "PUReweighingTable.h"
+#include "FWCore/ParameterSet/interface/FileInPath.h"
 #include "DataFormats/GeometryVector/interface/GlobalVector.h"
 
 using namespace edm;
@@ -53,23 +57,31 @@ class FlatTreeProducerGENSIM : public edm::EDAnalyzer
     void Init();
 
     edm::Service<TFileService> m_fs;
+
+    //run, lumi and event number, written to all the trees
+    FlatTreeEventId m_eventId;
  
     //the collections
     edm::InputTag m_bsTag;
-    edm::InputTag m_offlinePVTag;
+    edm::InputTag m_goodPVsTag;
     edm::InputTag m_genParticlesTag_GEN;
     edm::InputTag m_genParticlesTag_SIM_GEANT;
     edm::InputTag m_TPTag;
 
     edm::EDGetTokenT<reco::BeamSpot> m_bsToken;
-    edm::EDGetTokenT<vector<reco::Vertex>> m_offlinePVToken;
+    edm::EDGetTokenT<GoodPrimaryVertices> m_goodPVsToken;
     edm::EDGetTokenT<vector<reco::GenParticle>> m_genParticlesToken_GEN; 
     edm::EDGetTokenT<vector<reco::GenParticle>> m_genParticlesToken_SIM_GEANT; 
     edm::EDGetTokenT<vector<TrackingParticle> > m_TPToken;   
 
+    //PU reweighing parameters (per number of good PVs and vz of the PV), loaded at beginJob from m_PUReweighingFile and shared with all other modules using the same file
+    edm::FileInPath m_PUReweighingFile;
+    std::shared_ptr<const PUReweighingTable> m_PUReweighingTable;
+
+
     //Two trees: one with info on all the AntiS and one with info on the AntiS which give rise to our signal (so the correct granddaughters)
-    TTree* _treeAllAntiS;
-    TTree* _tree;   
+    FlatTreeWriter _treeAllAntiS;
+    FlatTreeWriter _tree;   
 
     //definition of variables which should go to _treeAllAntiS
     std::vector<float> _S_eta_all,_S_event_weighting_factor_all,_S_event_weighting_factor_PU_all,_S_vz_creation_vertex_all,_S_pt_all,_S_pz_all;
@@ -18,6 +18,12 @@
 #include "TrackingTools/TrajectoryState/interface/FreeTrajectoryState.h"
 
 #include "AnalyzerAllSteps.h"
+#include "FlatTreeEventId.h"
+#include "FlatTreeWriter.h"
+#include "PUReweighingTable.h"
+#include "TrackingParticleAncestry.h"
+#include "V0FitterCutFlow.h"
+#include "FWCore/ParameterSet/interface/FileInPath.h"
 using namespace edm;
 using namespace std; 
 class FlatTreeProducerTracking : public edm::EDAnalyzer
@@ -36,7 +42,7 @@ class FlatTreeProducerTracking : public edm::EDAnalyzer
 
     virtual ~FlatTreeProducerTracking();
 
-    void FillTreesTracks(const TrackingParticle& tp, TVector3 beamspot, int nPVs, const reco::Track *matchedTrackPointer, bool matchingTrackFound, std::vector<double> tpIsGrandDaughterAntiS);
+    void FillTreesTracks(const TrackingParticle& tp, TVector3 beamspot, int nPVs, const reco::Track *matchedTrackPointer, bool matchingTrackFound, int antiSGranddaughterType, double etaOfGrandMotherAntiS);
     int FillTreesAntiSAndDaughters(const TrackingParticle& tp, TVector3 beamspot, reco::BeamSpot::Point beamspotPoint, TVector3 beamspotVariance,int nPVs, edm::Handle<View<reco::Track>> h_generalTracks, edm::Handle<TrackingParticleCollection> h_TP, edm::Handle< reco::TrackToTrackingParticleAssociator> h_trackAssociator, edm::Handle<vector<reco::VertexCompositeCandidate> > h_V0Ks, edm::Handle<vector<reco::VertexCompositeCandidate> > h_V0L, edm::Handle<vector<reco::VertexCompositeCandidate> > h_sCands, TrackingParticleCollection const & TPColl, reco::SimToRecoCollection const & simRecColl, const reco::BeamSpot* theBeamSpot, const MagneticField* theMagneticField , unsigned int nGoodPV);
     void FillFlatTreeTpsAntiS(TVector3 beamspot, TVector3 AntiSCreationVertex, TrackingParticle trackingParticle, bool RECOFound, int type, double besteDeltaR, int returnCodeV0Fitter, double besteDeltaL, const MagneticField* theMagneticField);
     void FillFlatTreeTpsAntiSRECO(TVector3 beamspot, reco::BeamSpot::Point beamspotPoint, bool RECOFound, int type, reco::VertexCompositeCandidate  bestRECOCompositeCandidate);
@@ -44,6 +50,7 @@ class FlatTreeProducerTracking : public edm::EDAnalyzer
     void FillFlatTreeTpsAntiSRECODummy();
     int V0Fitter_trackSelection(const reco::Track *matchedTrackPointer1, const reco::BeamSpot* theBeamSpot);
     int V0Fitter(const reco::Track *matchedTrackPointer1, const reco::Track *matchedTrackPointer2, const reco::BeamSpot* theBeamSpot, const MagneticField* theMagneticField, bool isGENKs, bool isGENLambda, bool isGENAntiLambda);
+    int V0FitterSteps(const reco::Track *matchedTrackPointer1, const reco::Track *matchedTrackPointer2, const reco::BeamSpot* theBeamSpot, const MagneticField* theMagneticField, bool isGENKs, bool isGENLambda, bool isGENAntiLambda);
 
     
   private:
@@ -58,6 +65,15 @@ class FlatTreeProducerTracking : public edm::EDAnalyzer
 
     //configurable parameters
     bool m_lookAtAntiS;
+    bool m_fillTracksTree;
+    //associate only the antiS granddaughter tps to the tracks instead of all the tps (not possible when fillTracksTree is set, as that tree needs all of them)
+    bool m_associateAntiSGranddaughtersOnly;
+
+    //mother-daughter relations of the trackingparticles, rebuilt every event
+    TrackingParticleAncestry m_tpAncestry;
+
+    //return codes and step timing of V0Fitter and V0Fitter_trackSelection over the job, written at endJob
+    V0FitterCutFlow m_v0FitterCutFlow;
 
     //initialization of the different trees 
     void InitPV();
@@ -65,10 +81,13 @@ class FlatTreeProducerTracking : public edm::EDAnalyzer
     void InitTrackingAntiS();
     
     edm::Service<TFileService> m_fs;
+
+    //run, lumi and event number, written to all the trees
+    FlatTreeEventId m_eventId;
  
     //the collections
     edm::InputTag m_bsTag;
-    edm::InputTag m_offlinePVTag;
+    edm::InputTag m_goodPVsTag;
     edm::InputTag m_genParticlesTag_GEN;
     edm::InputTag m_genParticlesTag_SIM_GEANT;
     edm::InputTag m_generalTracksTag;
@@ -81,7 +100,7 @@ class FlatTreeProducerTracking : public edm::EDAnalyzer
 
 
     edm::EDGetTokenT<reco::BeamSpot> m_bsToken;
-    edm::EDGetTokenT<vector<reco::Vertex>> m_offlinePVToken;
+    edm::EDGetTokenT<GoodPrimaryVertices> m_goodPVsToken;
     edm::EDGetTokenT<vector<reco::GenParticle>> m_genParticlesToken_GEN;
     edm::EDGetTokenT<vector<reco::GenParticle>> m_genParticlesToken_SIM_GEANT;
     //edm::EDGetTokenT<vector<reco::Track>> m_generalTracksToken;
@@ -93,21 +112,26 @@ class FlatTreeProducerTracking : public edm::EDAnalyzer
     edm::EDGetTokenT<vector<TrackingParticle> > m_TPToken;
 //    edm::EDGetTokenT<vector<PileupSummaryInfo> > m_PileupInfoToken;
 
+    //PU reweighing parameters (per number of good PVs and vz of the PV), loaded at beginJob from m_PUReweighingFile and shared with all other modules using the same file
+    edm::FileInPath m_PUReweighingFile;
+    std::shared_ptr<const PUReweighingTable> m_PUReweighingTable;
+
+
 
     //the trees and the respective variables
-    TTree* _tree_counter;
+    FlatTreeWriter _tree_counter;
     std::vector<float> _nGENAntiS,_nRECOAntiS;
    
-    TTree* _tree_PV;   
+    FlatTreeWriter _tree_PV;   
     std::vector<float> _goodPVxPOG,_goodPVyPOG,_goodPVzPOG,_goodPV_weightPU;
 
-    TTree* _tree_tracks;   
+    FlatTreeWriter _tree_tracks;   
     std::vector<float> _tp_pt,_tp_eta,_tp_phi,_tp_pz,_tp_Lxy_beamspot,_tp_vz_beamspot,_tp_dxy_beamspot,_tp_dz_beamspot,_tp_etaOfGrandMotherAntiS;
     std::vector<int> _tp_numberOfTrackerHits,_tp_charge,_tp_reconstructed,_tp_isAntiSTrack;
     std::vector<float> _matchedTrack_pt,_matchedTrack_eta,_matchedTrack_phi,_matchedTrack_pz,_matchedTrack_chi2,_matchedTrack_ndof,_matchedTrack_dxy_beamspot,_matchedTrack_dz_beamspot;
     std::vector<int> _matchedTrack_trackQuality,_matchedTrack_charge,_matchedTrack_isLooper;
 
-    TTree* _tree_tpsAntiS;
+    FlatTreeWriter _tree_tpsAntiS;
     std::vector<float> _tpsAntiS_bestDeltaRWithRECO,_tpsAntiS_deltaLInteractionVertexAntiSmin,_tpsAntiS_mass,_tpsAntiS_pt,_tpsAntiS_eta,_tpsAntiS_phi,_tpsAntiS_pz,_tpsAntiS_Lxy_beampipeCenter,_tpsAntiS_Lxy_beamspot,_tpsAntiS_vz,_tpsAntiS_vz_beamspot,_tpsAntiS_dxy_beamspot,_tpsAntiS_dz_beamspot,_tpsAntiS_dz_AntiSCreationVertex,_tpsAntiS_dxyTrack_beamspot,_tpsAntiS_dzTrack_beamspot,_tpsAntiS_numberOfTrackerHits,_tpsAntiS_charge,_tpsAntiS_reconstructed,_tpsAntiS_event_weighting_factor,_tpsAntiS_event_weighting_factorPU;
     std::vector<float> _tpsAntiS_bestRECO_mass,_tpsAntiS_bestRECO_massMinusNeutron,_tpsAntiS_bestRECO_pt,_tpsAntiS_bestRECO_eta,_tpsAntiS_bestRECO_phi,_tpsAntiS_bestRECO_pz,_tpsAntiS_bestRECO_Lxy_beampipeCenter,_tpsAntiS_bestRECO_Lxy_beamspot,_tpsAntiS_bestRECO_error_Lxy_beampipeCenter,_tpsAntiS_bestRECO_error_Lxy_beamspot,_tpsAntiS_bestRECO_vz,_tpsAntiS_bestRECO_vz_beamspot,_tpsAntiS_bestRECO_dxy_beamspot,_tpsAntiS_bestRECO_dz_beamspot,_tpsAntiS_bestRECO_dxyTrack_beamspot,_tpsAntiS_bestRECO_dzTrack_beamspot,_tpsAntiS_bestRECO_charge,_tpsAntiS_returnCodeV0Fitter;
     std::vector<int> _tpsAntiS_type,_tpsAntiS_pdgId;
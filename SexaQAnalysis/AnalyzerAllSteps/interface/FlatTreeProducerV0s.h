@@ -2,6 +2,11 @@
 #define FlatTreeProducerV0s_h
  
 #include "AnalyzerAllSteps.h"
+#include "FlatTreeEventId.h"
+#include "FlatTreeEventSummary.h"
+#include "FlatTreeWriter.h"
+#include "GenParticleIndex.h"
+#include "V0FeatureArrays.h"
 #include "DataFormats/MuonReco/interface/Muon.h"
 #include "DataFormats/MuonReco/interface/MuonFwd.h"
 #include "DataFormats/JetReco/interface/PFJet.h"
@@ -9,6 +14,7 @@
 #include "DataFormats/Math/interface/LorentzVector.h"
 #include "DataFormats/RecoCandidate/interface/RecoChargedCandidate.h"
 #include "DataFormats/PatCandidates/interface/PackedTriggerPrescales.h"
+#include "SexaQAnalysis/Skimming/interface/TopK.h"
 
 using namespace edm;
 using namespace std; 
@@ -20,12 +26,22 @@ class FlatTreeProducerV0s : public edm::EDAnalyzer
     static void fillDescriptions(edm::ConfigurationDescriptions& descriptions);
 
     bool IsolationCriterium(reco::Muon muon);
-    void FillBranchesV0(const reco::VertexCompositeCandidate * V0, TVector3 beamspot, TVector3 beamspotVariance, edm::Handle<vector<reco::Vertex>> h_offlinePV, edm::Handle<vector<reco::GenParticle>> h_genParticles, std::string V0Type);    
+    //fills the Ks or Lambda columns with all the V0s of the event at once, from the features computed by V0FeatureArrays::compute
+    void FillBranchesV0s(const V0FeatureArrays& V0s, edm::Handle<vector<reco::GenParticle>> h_genParticles, std::string V0Type);
 
   private:
     bool m_lookAtAntiS;
     bool m_runningOnData; 
 
+    //the GEN Ks and (anti)Lambdas, rebuilt every event and used to match all the RECO V0s
+    GenParticleIndex m_genKs{AnalyzerAllSteps::pdgIdKs};
+    GenParticleIndex m_genLambda{AnalyzerAllSteps::pdgIdAntiLambda, true};
+
+    //the selected Ks and Lambdas of the event, their features are computed in batch (V0FeatureArrays)
+    V0FeatureArrays m_Ks;
+    V0FeatureArrays m_Lambda;
+    std::vector<double> m_deltaRBestMatchingGENParticle;
+
     virtual void beginJob();
     virtual void analyze(edm::Event const& iEvent, edm::EventSetup const& iSetup);
     virtual void endJob();
@@ -46,9 +62,16 @@ class FlatTreeProducerV0s : public edm::EDAnalyzer
 
     edm::Service<TFileService> m_fs;
 
+    //run, lumi and event number, written to all the trees
+    FlatTreeEventId m_eventId;
+    //counts and sums of the event from the EventSummary of the InitialProducer
+    FlatTreeEventSummary m_eventSummary;
+
     //the collections
     edm::InputTag m_bsTag;
     edm::InputTag m_offlinePVTag;
+    edm::InputTag m_goodPVsTag;
+    edm::InputTag m_eventSummaryTag;
     edm::InputTag m_genParticlesTag_GEN;
     edm::InputTag m_genParticlesTag_SIM_GEANT;
     //edm::InputTag m_generalTracksTag;
@@ -57,10 +80,14 @@ class FlatTreeProducerV0s : public edm::EDAnalyzer
     edm::InputTag m_V0LTag;
     edm::InputTag m_muonsTag;
     edm::InputTag m_jetsTag;
+    //maximal number of jets (highest pt first) checked for contaminating the transverse region of the Z, 0 means all jets above 30 GeV
+    unsigned int m_nHardConeJets;
 
 
     edm::EDGetTokenT<reco::BeamSpot> m_bsToken;
     edm::EDGetTokenT<vector<reco::Vertex>> m_offlinePVToken;
+    edm::EDGetTokenT<GoodPrimaryVertices> m_goodPVsToken;
+    edm::EDGetTokenT<EventSummary> m_eventSummaryToken;
     edm::EDGetTokenT<vector<reco::GenParticle>> m_genParticlesToken_GEN; 
     edm::EDGetTokenT<vector<reco::GenParticle>> m_genParticlesToken_SIM_GEANT; 
     //edm::EDGetTokenT<vector<reco::Track>> m_generalTracksToken;
@@ -73,24 +100,31 @@ class FlatTreeProducerV0s : public edm::EDAnalyzer
     edm::EDGetTokenT<pat::PackedTriggerPrescales> triggerPrescalesToken_;
     edm::EDGetTokenT<edm::TriggerResults> HLTTagToken_;
   
+
     //the trees in the ntuples  
-    TTree* _tree_Ks;   
-    TTree* _tree_Lambda;   
-    TTree* _tree_Z;   
-    TTree* _tree_PV;
-    TTree* _tree_beamspot;
-    TTree* _tree_GEN_Ks; 
-    TTree* _tree_general; 
+    FlatTreeWriter _tree_Ks;   
+    FlatTreeWriter _tree_Lambda;   
+    FlatTreeWriter _tree_Z;   
+    FlatTreeWriter _tree_PV;
+    FlatTreeWriter _tree_beamspot;
+    FlatTreeWriter _tree_GEN_Ks; 
+    FlatTreeWriter _tree_general; 
+
+    //layout of FlatTreeKs and FlatTreeLambda (vector: one entry per event as before, scalar: one entry per V0 with plain branches, see FlatTreeWriter.h)
+    FlatTreeWriter::Layout m_flatTreeLayout;
 
     //definition of variables which should go to tree
     //GEN Ks
     std::vector<float> _GEN_Ks_mass,_GEN_Ks_pt;
     //Ks
+    //index of the V0 in the V0 collection
+    std::vector<int> _Ks_index;
     std::vector<float> _Ks_mass,_Ks_pt,_Ks_pz,_Ks_Lxy,_Ks_vz,_Ks_eta,_Ks_phi,_Ks_dxy_beamspot,_Ks_dxy_min_PV,_Ks_dxy_PV0,_Ks_dxy_000,_Ks_dz_beamspot,_Ks_dz_min_PV,_Ks_dz_PV0,_Ks_dz_000,_Ks_vz_dz_min_PV;
     std::vector<float> _Ks_deltaRBestMatchingGENParticle,_Ks_trackPair_mindeltaR,_Ks_trackPair_mass,_Ks_Track1Track2_openingsAngle, _Ks_Track1Track2_deltaR,_Ks_Track1_openingsAngle,_Ks_Track2_openingsAngle,_Ks_Track1_deltaR,_Ks_Track2_deltaR;
     std::vector<float> _Ks_daughterTrack1_eta,_Ks_daughterTrack1_phi,_Ks_daughterTrack1_pt,_Ks_daughterTrack1_pz,_Ks_daughterTrack1_dxy,_Ks_daughterTrack1_dz,_Ks_daughterTrack1_charge,_Ks_daughterTrack1_chi2,_Ks_daughterTrack1_ndof,_Ks_daughterTrack1_dxy_beamspot,_Ks_daughterTrack1_dz_beamspot,_Ks_daughterTrack1_dz_min_PV,_Ks_daughterTrack1_dz_PV0,_Ks_daughterTrack1_dz_000;
     std::vector<float> _Ks_daughterTrack2_eta,_Ks_daughterTrack2_phi,_Ks_daughterTrack2_pt,_Ks_daughterTrack2_pz,_Ks_daughterTrack2_charge,_Ks_daughterTrack2_chi2,_Ks_daughterTrack2_ndof,_Ks_daughterTrack2_dxy_beamspot,_Ks_daughterTrack2_dz_beamspot,_Ks_daughterTrack2_dz_min_PV,_Ks_daughterTrack2_dz_PV0,_Ks_daughterTrack2_dz_000;
    //Lambda
+    std::vector<int> _Lambda_index;
     std::vector<float> _Lambda_mass,_Lambda_pt,_Lambda_pz,_Lambda_Lxy,_Lambda_vz,_Lambda_eta,_Lambda_phi,_Lambda_dxy_beamspot,_Lambda_dxy_min_PV,_Lambda_dxy_PV0,_Lambda_dxy_000,_Lambda_dz_beamspot,_Lambda_dz_min_PV,_Lambda_dz_PV0,_Lambda_dz_000,_Lambda_vz_dz_min_PV;
     std::vector<float> _Lambda_deltaRBestMatchingGENParticle,_Lambda_trackPair_mindeltaR,_Lambda_trackPair_mass,_Lambda_Track1Track2_openingsAngle, _Lambda_Track1Track2_deltaR,_Lambda_Track1_openingsAngle,_Lambda_Track2_openingsAngle,_Lambda_Track1_deltaR,_Lambda_Track2_deltaR;
     std::vector<float> _Lambda_daughterTrack1_eta,_Lambda_daughterTrack1_phi,_Lambda_daughterTrack1_pt,_Lambda_daughterTrack1_pz,_Lambda_daughterTrack1_dxy,_Lambda_daughterTrack1_dz,_Lambda_daughterTrack1_charge,_Lambda_daughterTrack1_chi2,_Lambda_daughterTrack1_ndof,_Lambda_daughterTrack1_dxy_beamspot,_Lambda_daughterTrack1_dz_beamspot,_Lambda_daughterTrack1_dz_min_PV,_Lambda_daughterTrack1_dz_PV0,_Lambda_daughterTrack1_dz_000;
@@ -0,0 +1,146 @@
+#ifndef FlatTreeSelection_h
+#define FlatTreeSelection_h
+
+#include "SexaQAnalysis/AnalyzerAllSteps/interface/FlatTreeColumn.h"
+#include "SexaQAnalysis/AnalyzerAllSteps/interface/SexaqSelectionCuts.h"
+
+#include "TTree.h"
+
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+//compiled version of the selection strings of TMVA/configBDT.py, for the flat trees of FlatTreeProducerBDT. The cuts are generated from configBDT.py into SexaqSelectionCuts.h by TMVA/makeSelection.py.
+//A selection is one or more of the named selections of configBDT.py joined with '+', e.g. "BkgS+pre_BDT". The cuts are applied in order and every entry stops at the first failing cut,
+//the branch of a cut is only read when the entry gets to that cut. The number of entries passing each cut is kept, so the cut flow comes for free.
+//The trees can have either layout of FlatTreeWriter (vector or scalar branches), see FlatTreeColumn.h.
+//From C++ (e.g. TMVA/Step2/DiscrApplication.C):
+//  FlatTreeSelection selection("BkgS+pre_BDT");
+//  selection.bind(tree);
+//  for(Long64_t i = 0; i < tree->GetEntries(); ++i) if(selection.select(i)) ...
+//  selection.printCutFlow(std::cout);
+//From python: configBDT.load_selection_library() and configBDT.filter_rdataframe(df, "BkgS+pre_BDT") for an RDataFrame (one named Filter per cut, df.Report() is the cut flow)
+class FlatTreeSelection {
+  public:
+    //throws std::invalid_argument for an unknown selection name
+    explicit FlatTreeSelection(const std::string& selection):
+      selection_(selection),
+      columns_(SexaqSelectionCuts::nVariables),
+      bound_(SexaqSelectionCuts::nVariables, false)
+    {
+	std::stringstream names(selection);
+	std::string name;
+	while(std::getline(names, name, '+')){
+		unsigned int s = 0;
+		while(s < SexaqSelectionCuts::nSelections && name != SexaqSelectionCuts::selections[s].name) ++s;
+		if(s == SexaqSelectionCuts::nSelections) throw std::invalid_argument("FlatTreeSelection: unknown selection " + name);
+		for(unsigned int c = 0; c < SexaqSelectionCuts::selections[s].nCuts; ++c){
+			unsigned int cut = SexaqSelectionCuts::selections[s].cuts[c];
+			bool found = false;
+			for(unsigned int other : cuts_) found |= other == cut;
+			if(!found) cuts_.push_back(cut);
+		}
+	}
+	nPassed_.assign(cuts_.size(), 0);
+    }
+
+    ~FlatTreeSelection(){ unbind(); }
+
+    FlatTreeSelection(const FlatTreeSelection&) = delete;
+    FlatTreeSelection& operator=(const FlatTreeSelection&) = delete;
+
+    //the cuts (SexaqSelectionCuts::Cut) in the order in which they are applied
+    const std::vector<unsigned int>& cuts() const { return cuts_; }
+    static std::string cutName(unsigned int cut) { return SexaqSelectionCuts::cutNames[cut]; }
+    static std::string variableName(unsigned int cut) { return SexaqSelectionCuts::variableNames[SexaqSelectionCuts::cutVariables[cut]]; }
+    //the expression of a cut for RDataFrame::Filter, on the vector<float> column of the cut or on the float column for the scalar layout
+    static std::string rdfExpression(unsigned int cut, bool scalar = false) {
+	std::string variable = variableName(cut);
+	std::string value = scalar ? variable : "(" + variable + ".empty() ? 0. : " + variable + "[0])";
+	return std::string("SexaqSelectionCuts::") + SexaqSelectionCuts::cutNames[cut] + "(" + value + ")";
+    }
+
+    //the values of the first candidate of an entry, indexed by SexaqSelectionCuts::Variable, as Alt$(variable,0)
+    bool passes(const float* values){
+	++nEntries_;
+	for(unsigned int c = 0; c < cuts_.size(); ++c){
+		if(!SexaqSelectionCuts::passes(cuts_[c], values[SexaqSelectionCuts::cutVariables[cuts_[c]]])) return false;
+		++nPassed_[c];
+	}
+	return true;
+    }
+
+    //sets the branch addresses of the variables of the cuts, returns false if a branch is missing. The addresses are reset by unbind() and the destructor, so do not use the same branches for something else in between
+    bool bind(TTree* tree){
+	unbind();
+	for(unsigned int cut : cuts_){
+		unsigned int v = SexaqSelectionCuts::cutVariables[cut];
+		if(bound_[v]) continue;
+		if(!columns_[v].bind(tree, SexaqSelectionCuts::variableNames[v])) return false;
+		bound_[v] = true;
+	}
+	return true;
+    }
+
+    void unbind(){
+	for(unsigned int v = 0; v < SexaqSelectionCuts::nVariables; ++v) columns_[v].unbind();
+	bound_.assign(SexaqSelectionCuts::nVariables, false);
+    }
+
+    //entry of the bound tree (for a TChain: the local entry, call bind again for each tree)
+    bool select(Long64_t entry){
+	++nEntries_;
+	for(unsigned int c = 0; c < cuts_.size(); ++c){
+		if(!SexaqSelectionCuts::passes(cuts_[c], columns_[SexaqSelectionCuts::cutVariables[cuts_[c]]].get(entry))) return false;
+		++nPassed_[c];
+	}
+	return true;
+    }
+
+    //the selected entries of tree, in a new tree in the current directory, as tree->CopyTree(selection string)
+    TTree* copyTree(TTree* tree){
+	std::vector<Long64_t> entries;
+	if(!bind(tree)) throw std::invalid_argument("FlatTreeSelection: missing branch in " + std::string(tree->GetName()));
+	for(Long64_t i = 0; i < tree->GetEntries(); ++i) if(select(i)) entries.push_back(i);
+	unbind();
+	TTree* copy = tree->CloneTree(0);
+	for(Long64_t i : entries){
+		tree->GetEntry(i);
+		copy->Fill();
+	}
+	return copy;
+    }
+
+    //adds the cut flow of another FlatTreeSelection of the same selection (e.g. one per thread)
+    void add(const FlatTreeSelection& other){
+	nEntries_ += other.nEntries_;
+	for(unsigned int c = 0; c < cuts_.size() && c < other.nPassed_.size(); ++c) nPassed_[c] += other.nPassed_[c];
+    }
+
+    Long64_t nEntries() const { return nEntries_; }
+    //number of entries passing the first c+1 cuts
+    Long64_t nPassed(unsigned int c) const { return nPassed_[c]; }
+
+    void printCutFlow(std::ostream& out) const {
+	out << "cut flow of " << selection_ << ": " << nEntries_ << " entries" << std::endl;
+	Long64_t previous = nEntries_;
+	for(unsigned int c = 0; c < cuts_.size(); ++c){
+		out << std::setw(40) << std::left << SexaqSelectionCuts::cutNames[cuts_[c]] << std::right << std::setw(12) << nPassed_[c]
+		    << std::setw(10) << std::fixed << std::setprecision(4) << (previous > 0 ? (double)nPassed_[c]/previous : 0.) << std::endl;
+		previous = nPassed_[c];
+	}
+    }
+
+  private:
+    std::string selection_;
+    std::vector<unsigned int> cuts_;
+    std::vector<FlatTreeColumn<float>> columns_;
+    std::vector<bool> bound_;
+    Long64_t nEntries_ = 0;
+    std::vector<Long64_t> nPassed_;
+};
+
+#endif
@@ -0,0 +1,64 @@
+#ifndef FlatTreeWriter_h
+#define FlatTreeWriter_h
+
+#include "TTree.h"
+
+#include <deque>
+#include <string>
+#include <utility>
+#include <vector>
+
+class TFileService;
+
+//writes one flat tree of a producer, a TTree made by the TFileService in the directory of the module (the TFileService writes and deletes it).
+//The producers keep filling one std::vector per variable with one element per candidate, add() makes it a column. For the candidate trees the layout is chosen in the cfi (flatTreeLayout):
+//  "vector": one entry per fill() with std::vector<float>/std::vector<int> columns, as before (the cuts need Alt$(_S_xxx,0))
+//  "scalar": one entry per candidate with plain float/int columns of the same names, plus _eventIndex, the entry of the event-level tree of the same event
+//            (FlatTreePV for FlatTreeProducerBDT, FlatTreeZ/PV/Beamspot/General for FlatTreeProducerV0s). Events without candidates give no entry, a column which is not filled at all is written as -999.
+//The addScalar() columns (e.g. FlatTreeEventId) are written with every entry. FlatTreeColumn.h reads a column in either layout.
+//The columns point to members of the producer, so they all have to be added in beginJob, before the first fill().
+class FlatTreeWriter {
+  public:
+    enum Layout { vectorLayout, scalarLayout };
+
+    //from the cfi string, throws a cms::Exception for an unknown name
+    static Layout layout(const std::string& name);
+
+    FlatTreeWriter();
+
+    FlatTreeWriter(const FlatTreeWriter&) = delete;
+    FlatTreeWriter& operator=(const FlatTreeWriter&) = delete;
+
+    void open(TFileService& fs, const char* name, const char* title, Layout layout = vectorLayout);
+
+    void add(const char* name, std::vector<float>* column);
+    void add(const char* name, std::vector<int>* column);
+    void addScalar(const char* name, float* value);
+    void addScalar(const char* name, int* value);
+    void addScalar(const char* name, UInt_t* value);
+    void addScalar(const char* name, ULong64_t* value);
+    void addScalar(const char* name, Long64_t* value);
+
+    //writes the candidates which are in the columns now, eventIndex is only used for the scalar layout
+    void fill(Long64_t eventIndex = -1);
+
+    //number of entries written so far
+    Long64_t entries() const { return tree_->GetEntries(); }
+
+  private:
+    //value written in the scalar layout for a column which is not filled at all (some V0 columns are declared but never filled)
+    enum { notFilled = -999 };
+
+    void check(size_t size, size_t n) const;
+
+    TTree* tree_;
+    Layout layout_;
+    Long64_t eventIndex_ = -1;
+    //the scalars the columns of the scalar layout point to, a deque so the addresses stay valid
+    std::deque<float> floatValues_;
+    std::deque<int> intValues_;
+    std::vector<std::pair<const std::vector<float>*, float*>> floatColumns_;
+    std::vector<std::pair<const std::vector<int>*, int*>> intColumns_;
+};
+
+#endif
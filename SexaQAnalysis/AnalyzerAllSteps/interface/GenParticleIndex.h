@@ -0,0 +1,41 @@
+#ifndef GenParticleIndex_h
+#define GenParticleIndex_h
+
+#include "DataFormats/HepMCCandidate/interface/GenParticle.h"
+
+#include <vector>
+
+//The RECO candidates were matched to the GEN particles by looping over the full GEN(+GEANT) collection for every candidate, O(nCandidates x nGen) per event.
+//This class selects the GEN particles of one type once per event (e.g. the antiS with 2 daughters) and keeps their direction and the vertex of their first daughter (the interaction or decay vertex)
+//in flat arrays, so matching a candidate is a scan over the few selected particles only. The results are the same as for the old loops: the particles are kept in collection order,
+//the first one with the smallest distance wins and the returned index is the index in the GEN collection.
+class GenParticleIndex {
+  public:
+    //pdgId: the particles to select, with absPdgId also the antiparticles. nDaughters >= 0: only particles with exactly this number of daughters
+    GenParticleIndex(int pdgId, bool absPdgId = false, int nDaughters = -1): pdgId_(pdgId), absPdgId_(absPdgId), nDaughters_(nDaughters) {}
+
+    //index the collection of this event, has to be called before any of the below. clear() for an event without (valid) GEN collection
+    void build(std::vector<reco::GenParticle> const & genParticles);
+    void clear();
+
+    unsigned int size() const { return index_.size(); }
+
+    //index in the GEN collection of the particle with its first daughter vertex closest in 3D to (x,y,z), -1 if none is closer than maxDistance. distance is set to the 3D distance of that particle
+    //(only particles with at least one daughter have a vertex)
+    int nearestVertex(double x, double y, double z, double& distance, double maxDistance = 999.) const;
+    //index in the GEN collection of the particle closest in deltaR to (eta,phi), -1 if none is closer than maxDeltaR. deltaR is set to the deltaR of that particle
+    int nearestDeltaR(double eta, double phi, double& deltaR, double maxDeltaR = 99.) const;
+
+  private:
+    int pdgId_;
+    bool absPdgId_;
+    int nDaughters_;
+
+    //the selected particles: index in the collection, eta, phi and the vertex of daughter(0)
+    std::vector<int> index_;
+    std::vector<double> eta_, phi_;
+    std::vector<bool> hasVertex_;
+    std::vector<double> vx_, vy_, vz_;
+};
+
+#endif
@@ -0,0 +1,102 @@
+#ifndef GeometryKernels_h
+#define GeometryKernels_h
+
+#include <cmath>
+
+//the geometry of the AnalyzerAllSteps helpers (lxy, dxy, dz, PCA, angles) on a plain 3D vector instead of TVector3, inline and without temporaries, so they can be used in the per-candidate
+//feature computation and in loops over many candidates. The arithmetic is the same as in the TVector3 helpers, operation by operation, so the results are the same to the last bit.
+//The AnalyzerAllSteps helpers are kept as wrappers around these.
+//The batch versions take n lines or points as one array per coordinate (e.g. the arrays of a LineArrays) and a common reference point, and write n results to out.
+namespace sexaq {
+
+struct Vec3 {
+    double x, y, z;
+    constexpr Vec3(): x(0.), y(0.), z(0.) {}
+    constexpr Vec3(double vx, double vy, double vz): x(vx), y(vy), z(vz) {}
+};
+
+constexpr Vec3 operator-(const Vec3& a, const Vec3& b) { return Vec3(a.x-b.x, a.y-b.y, a.z-b.z); }
+constexpr Vec3 operator*(double s, const Vec3& v) { return Vec3(s*v.x, s*v.y, s*v.z); }
+constexpr double dot(const Vec3& a, const Vec3& b) { return a.x*b.x + a.y*b.y + a.z*b.z; }
+//the same vector in the xy plane
+constexpr Vec3 xy(const Vec3& v) { return Vec3(v.x, v.y, 0.); }
+
+//2D distance in xy (pow(x,2) as in the TVector3 helper, the compiler makes it x*x when optimising, but the library pow is not always exactly x*x)
+inline double lxy(const Vec3& v1, const Vec3& v2){
+	return sqrt(pow(v1.x-v2.x,2)+pow(v1.y-v2.y,2));
+}
+
+//3D distance
+inline double lxyz(const Vec3& v1, const Vec3& v2){
+	return sqrt(pow(v1.x-v2.x,2)+pow(v1.y-v2.y,2)+pow(v1.z-v2.z,2));
+}
+
+//point of closest approach vector between a point (Point) and a line (Point_line;Vector_along_line)
+inline Vec3 PCA_line_point(const Vec3& Point_line, const Vec3& Vector_along_line, const Vec3& Point){
+	const double normalise = sqrt(dot(Vector_along_line, Vector_along_line));
+	const Vec3 n(Vector_along_line.x/normalise, Vector_along_line.y/normalise, Vector_along_line.z/normalise);
+	const Vec3 d = Point_line - Point;
+	//see https://en.wikipedia.org/wiki/Distance_from_a_point_to_a_line (Vector formulation)
+	return d - dot(d, n)*n;
+}
+
+//the PCA vector in xy between point and line
+inline Vec3 vec_dxy_line_point(const Vec3& Point_line, const Vec3& Vector_along_line, const Vec3& Point){
+	return PCA_line_point(xy(Point_line), xy(Vector_along_line), xy(Point));
+}
+
+//shortest distance between point and line in xy, negative if the line points towards the point
+inline double dxy_signed_line_point(const Vec3& Point_line, const Vec3& Vector_along_line, const Vec3& Point){
+	const Vec3 shortest_distance = vec_dxy_line_point(Point_line, Vector_along_line, Point);
+	const double dxy = sqrt(shortest_distance.x*shortest_distance.x+shortest_distance.y*shortest_distance.y);
+	return dot(xy(Point_line) - xy(Point), xy(Vector_along_line)) < 0 ? -dxy : dxy;
+}
+
+//same as dxy_signed_line_point, but in 3D
+inline double dxyz_signed_line_point(const Vec3& Point_line, const Vec3& Vector_along_line, const Vec3& Point){
+	const Vec3 shortest_distance = PCA_line_point(Point_line, Vector_along_line, Point);
+	const double dxyz = sqrt(dot(shortest_distance, shortest_distance));
+	return dot(Point_line - Point, Vector_along_line) < 0 ? -dxyz : dxyz;
+}
+
+//longitudinal impact parameter between a line and a point, from https://github.com/cms-sw/cmssw/blob/master/DataFormats/TrackReco/interface/TrackBase.h#L764-L767
+inline double dz_line_point(const Vec3& Point_line, const Vec3& Vector_along_line, const Vec3& Point){
+	const double pt = sqrt(Vector_along_line.x*Vector_along_line.x+Vector_along_line.y*Vector_along_line.y);
+	return (Point_line.z - Point.z) - ((Point_line.x - Point.x) * Vector_along_line.x + (Point_line.y - Point.y) * Vector_along_line.y) / pt * Vector_along_line.z / pt;
+}
+
+//cos of the angle between two vectors
+inline double CosOpeningsAngle(const Vec3& vec1, const Vec3& vec2){
+	return dot(vec1, vec2)/(sqrt(dot(vec1, vec1))*sqrt(dot(vec2, vec2)));
+}
+
+//cos of the angle in xy between the momentum and the displacement of the decay vertex from the beamspot
+inline double XYpointingAngle(const Vec3& decayVertex, const Vec3& momentum, const Vec3& beamspot){
+	const double dx = decayVertex.x-beamspot.x, dy = decayVertex.y-beamspot.y;
+	return (dx*momentum.x+dy*momentum.y)/(sqrt(dx*dx+dy*dy)*sqrt(momentum.x*momentum.x+momentum.y*momentum.y));
+}
+
+//batch versions: point i is (x[i],y[i],z[i]), line i goes through point i along (px[i],py[i],pz[i])
+inline void lxy(unsigned int n, const double* x, const double* y, const Vec3& Point, double* out){
+	for(unsigned int i = 0; i < n; ++i) out[i] = lxy(Vec3(x[i], y[i], 0.), Point);
+}
+
+inline void dxy_signed_line_point(unsigned int n, const double* x, const double* y, const double* px, const double* py, const Vec3& Point, double* out){
+	for(unsigned int i = 0; i < n; ++i) out[i] = dxy_signed_line_point(Vec3(x[i], y[i], 0.), Vec3(px[i], py[i], 0.), Point);
+}
+
+inline void dxyz_signed_line_point(unsigned int n, const double* x, const double* y, const double* z, const double* px, const double* py, const double* pz, const Vec3& Point, double* out){
+	for(unsigned int i = 0; i < n; ++i) out[i] = dxyz_signed_line_point(Vec3(x[i], y[i], z[i]), Vec3(px[i], py[i], pz[i]), Point);
+}
+
+inline void dz_line_point(unsigned int n, const double* x, const double* y, const double* z, const double* px, const double* py, const double* pz, const Vec3& Point, double* out){
+	for(unsigned int i = 0; i < n; ++i) out[i] = dz_line_point(Vec3(x[i], y[i], z[i]), Vec3(px[i], py[i], pz[i]), Point);
+}
+
+inline void XYpointingAngle(unsigned int n, const double* x, const double* y, const double* px, const double* py, const Vec3& beamspot, double* out){
+	for(unsigned int i = 0; i < n; ++i) out[i] = XYpointingAngle(Vec3(x[i], y[i], 0.), Vec3(px[i], py[i], 0.), beamspot);
+}
+
+}
+
+#endif
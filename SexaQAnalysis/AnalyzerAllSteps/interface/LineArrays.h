@@ -0,0 +1,37 @@
+#ifndef LineArrays_h
+#define LineArrays_h
+
+#include "TVector3.h"
+#include "GeometryKernels.h"
+
+#include <cmath>
+#include <vector>
+
+//flight lines (a point on the line and the direction along it, e.g. the vertex and the momentum of a V0) as one array per quantity, the input of the batch AnalyzerAllSteps::dz_line_point_min.
+//pt is the transverse size of the direction, computed once per line here instead of once per line and PV
+struct LineArrays {
+    std::vector<double> x, y, z, px, py, pz, pt;
+
+    unsigned int size() const { return x.size(); }
+
+    void clear(){
+	x.clear(); y.clear(); z.clear();
+	px.clear(); py.clear(); pz.clear(); pt.clear();
+    }
+
+    void push_back(const sexaq::Vec3& Point_line, const sexaq::Vec3& Vector_along_line){
+	x.push_back(Point_line.x);
+	y.push_back(Point_line.y);
+	z.push_back(Point_line.z);
+	px.push_back(Vector_along_line.x);
+	py.push_back(Vector_along_line.y);
+	pz.push_back(Vector_along_line.z);
+	pt.push_back(sqrt(Vector_along_line.x*Vector_along_line.x+Vector_along_line.y*Vector_along_line.y));
+    }
+
+    void push_back(const TVector3& Point_line, const TVector3& Vector_along_line){
+	push_back(sexaq::Vec3(Point_line.X(), Point_line.Y(), Point_line.Z()), sexaq::Vec3(Vector_along_line.X(), Vector_along_line.Y(), Vector_along_line.Z()));
+    }
+};
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef PUReweighingTable_h
+#define PUReweighingTable_h
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+//2D (number of good PVs, vz of the PV) reweighing parameters for the PU, as a dense table: one row per number of good PVs (starting at 0), each row has nVz bins of equal width between vzMin and vzMax.
+//The payload is written by macros/PUReweighing/CreateDataMCRatioVzPV_histoFromFile.py and memory mapped read-only, a lookup is just an index calculation, no allocation and no search.
+//Use PUReweighingTable::get(fileName): all modules (and so all threads) of a job which ask for the same file share one mapping.
+//Binary payload layout (little endian): char[8] "SEXAQPU", uint32 version, uint32 nPV, uint32 nVz, uint32 reserved, double vzMin, double vzMax, float weights[nPV][nVz]
+class PUReweighingTable {
+  public:
+    static const unsigned int payloadVersion = 1;
+
+    //throws a cms::Exception if the file cannot be mapped or is not a valid payload
+    static std::shared_ptr<const PUReweighingTable> get(const std::string& fileName);
+
+    explicit PUReweighingTable(const std::string& fileName);
+    ~PUReweighingTable();
+    PUReweighingTable(const PUReweighingTable&) = delete;
+    PUReweighingTable& operator=(const PUReweighingTable&) = delete;
+
+    //number of rows: the table has weights for nGoodPV < nPVBins()
+    unsigned int nPVBins() const { return nPV_; }
+    unsigned int nVzBins() const { return nVz_; }
+    double vzMin() const { return vzMin_; }
+    double vzMax() const { return vzMax_; }
+
+    //reweighing parameter for an event with nGoodPV good PVs and a PV at vz. Returns 0 if nGoodPV is outside of the table or vz >= vzMax, a vz below vzMin gets the first bin (as the old std::map lookup did)
+    double weight(unsigned int nGoodPV, double vz) const {
+	if(nGoodPV >= nPV_ || !(vz < vzMax_)) return 0.;
+	unsigned int iVz = vz > vzMin_ ? (unsigned int)((vz - vzMin_)*invBinWidth_) : 0;
+	if(iVz >= nVz_) iVz = nVz_ - 1;
+	return weights_[nGoodPV*nVz_ + iVz];
+    }
+
+  private:
+    void* mapping_;
+    std::size_t mappingSize_;
+    unsigned int nPV_;
+    unsigned int nVz_;
+    double vzMin_;
+    double vzMax_;
+    double invBinWidth_;
+    const float* weights_;
+};
+
+#endif
@@ -0,0 +1,261 @@
+//generated by TMVA/makeSelection.py from the cuts in TMVA/configBDT.py, do not edit
+#ifndef SexaqSelectionCuts_h
+#define SexaqSelectionCuts_h
+
+namespace SexaqSelectionCuts {
+
+  //the branches the cuts are on (vector<float>, the cut is on element 0)
+  enum Variable { v_S_lxy_interaction_vertex_beampipeCenter, v_S_dxy_over_lxy, v_S_daughters_deltaphi, v_S_charge, v_S_deltaLInteractionVertexAntiSmin, v_S_deltaRAntiSmin, v_Lambda_vz_decay_vertex, v_Lambda_lxy_decay_vertex, v_Ks_vz_decay_vertex, v_Ks_lxy_decay_vertex, v_RECO_Lambda_daughter0_pt, v_RECO_Lambda_daughter0_pz, v_RECO_Lambda_daughter0_dxy_beamspot, v_RECO_Lambda_daughter0_dz_beamspot, v_RECO_Lambda_daughter1_pt, v_RECO_Lambda_daughter1_pz, v_RECO_Lambda_daughter1_dxy_beamspot, v_RECO_Lambda_daughter1_dz_beamspot, v_RECO_Ks_daughter0_pt, v_RECO_Ks_daughter0_pz, v_RECO_Ks_daughter0_dxy_beamspot, v_RECO_Ks_daughter0_dz_beamspot, v_RECO_Ks_daughter1_pt, v_RECO_Ks_daughter1_pz, v_RECO_Ks_daughter1_dxy_beamspot, v_RECO_Ks_daughter1_dz_beamspot, nVariables };
+  const char* const variableNames[nVariables] = {
+	"_S_lxy_interaction_vertex_beampipeCenter",
+	"_S_dxy_over_lxy",
+	"_S_daughters_deltaphi",
+	"_S_charge",
+	"_S_deltaLInteractionVertexAntiSmin",
+	"_S_deltaRAntiSmin",
+	"_Lambda_vz_decay_vertex",
+	"_Lambda_lxy_decay_vertex",
+	"_Ks_vz_decay_vertex",
+	"_Ks_lxy_decay_vertex",
+	"_RECO_Lambda_daughter0_pt",
+	"_RECO_Lambda_daughter0_pz",
+	"_RECO_Lambda_daughter0_dxy_beamspot",
+	"_RECO_Lambda_daughter0_dz_beamspot",
+	"_RECO_Lambda_daughter1_pt",
+	"_RECO_Lambda_daughter1_pz",
+	"_RECO_Lambda_daughter1_dxy_beamspot",
+	"_RECO_Lambda_daughter1_dz_beamspot",
+	"_RECO_Ks_daughter0_pt",
+	"_RECO_Ks_daughter0_pz",
+	"_RECO_Ks_daughter0_dxy_beamspot",
+	"_RECO_Ks_daughter0_dz_beamspot",
+	"_RECO_Ks_daughter1_pt",
+	"_RECO_Ks_daughter1_pz",
+	"_RECO_Ks_daughter1_dxy_beamspot",
+	"_RECO_Ks_daughter1_dz_beamspot"
+  };
+
+  enum Cut { c_noCut, c_cut1_lxy_min, c_cut1_lxy_max, c_cut3_dxy_over_lxy_min, c_cut3_dxy_over_lxy_max, c_cut4_deltaphi, c_S_charge_minus, c_S_charge_plus, c_AntiS_GEN_deltaL, c_AntiS_GEN_deltaR, c_AntiS_noGEN_deltaL, c_fiducial_Lambda_vz_min, c_fiducial_Lambda_vz_max, c_fiducial_Lambda_lxy_max, c_fiducial_Ks_vz_min, c_fiducial_Ks_vz_max, c_fiducial_Ks_lxy_max, c_fiducial_Lambda_daughter0_pt_min, c_fiducial_Lambda_daughter0_pz_min, c_fiducial_Lambda_daughter0_pz_max, c_fiducial_Lambda_daughter0_dxy_min, c_fiducial_Lambda_daughter0_dxy_max, c_fiducial_Lambda_daughter0_dz_min, c_fiducial_Lambda_daughter0_dz_max, c_fiducial_Lambda_daughter1_pt_min, c_fiducial_Lambda_daughter1_pz_min, c_fiducial_Lambda_daughter1_pz_max, c_fiducial_Lambda_daughter1_dxy_min, c_fiducial_Lambda_daughter1_dxy_max, c_fiducial_Lambda_daughter1_dz_min, c_fiducial_Lambda_daughter1_dz_max, c_fiducial_Ks_daughter0_pt_min, c_fiducial_Ks_daughter0_pz_min, c_fiducial_Ks_daughter0_pz_max, c_fiducial_Ks_daughter0_dxy_min, c_fiducial_Ks_daughter0_dxy_max, c_fiducial_Ks_daughter0_dz_min, c_fiducial_Ks_daughter0_dz_max, c_fiducial_Ks_daughter1_pt_min, c_fiducial_Ks_daughter1_pz_min, c_fiducial_Ks_daughter1_pz_max, c_fiducial_Ks_daughter1_dxy_min, c_fiducial_Ks_daughter1_dxy_max, c_fiducial_Ks_daughter1_dz_min, c_fiducial_Ks_daughter1_dz_max, nCuts };
+  const char* const cutNames[nCuts] = {
+	"noCut",
+	"cut1_lxy_min",
+	"cut1_lxy_max",
+	"cut3_dxy_over_lxy_min",
+	"cut3_dxy_over_lxy_max",
+	"cut4_deltaphi",
+	"S_charge_minus",
+	"S_charge_plus",
+	"AntiS_GEN_deltaL",
+	"AntiS_GEN_deltaR",
+	"AntiS_noGEN_deltaL",
+	"fiducial_Lambda_vz_min",
+	"fiducial_Lambda_vz_max",
+	"fiducial_Lambda_lxy_max",
+	"fiducial_Ks_vz_min",
+	"fiducial_Ks_vz_max",
+	"fiducial_Ks_lxy_max",
+	"fiducial_Lambda_daughter0_pt_min",
+	"fiducial_Lambda_daughter0_pz_min",
+	"fiducial_Lambda_daughter0_pz_max",
+	"fiducial_Lambda_daughter0_dxy_min",
+	"fiducial_Lambda_daughter0_dxy_max",
+	"fiducial_Lambda_daughter0_dz_min",
+	"fiducial_Lambda_daughter0_dz_max",
+	"fiducial_Lambda_daughter1_pt_min",
+	"fiducial_Lambda_daughter1_pz_min",
+	"fiducial_Lambda_daughter1_pz_max",
+	"fiducial_Lambda_daughter1_dxy_min",
+	"fiducial_Lambda_daughter1_dxy_max",
+	"fiducial_Lambda_daughter1_dz_min",
+	"fiducial_Lambda_daughter1_dz_max",
+	"fiducial_Ks_daughter0_pt_min",
+	"fiducial_Ks_daughter0_pz_min",
+	"fiducial_Ks_daughter0_pz_max",
+	"fiducial_Ks_daughter0_dxy_min",
+	"fiducial_Ks_daughter0_dxy_max",
+	"fiducial_Ks_daughter0_dz_min",
+	"fiducial_Ks_daughter0_dz_max",
+	"fiducial_Ks_daughter1_pt_min",
+	"fiducial_Ks_daughter1_pz_min",
+	"fiducial_Ks_daughter1_pz_max",
+	"fiducial_Ks_daughter1_dxy_min",
+	"fiducial_Ks_daughter1_dxy_max",
+	"fiducial_Ks_daughter1_dz_min",
+	"fiducial_Ks_daughter1_dz_max"
+  };
+  //the TTreeFormula string of each cut, as used in configBDT.py
+  const char* const cutFormulas[nCuts] = {
+	"Alt$(_S_lxy_interaction_vertex_beampipeCenter,0) < 99999999.0",
+	"Alt$(_S_lxy_interaction_vertex_beampipeCenter,0) > 2.02",
+	"Alt$(_S_lxy_interaction_vertex_beampipeCenter,0) < 2.4",
+	"Alt$(_S_dxy_over_lxy,0) >= 0",
+	"Alt$(_S_dxy_over_lxy,0) <= 0.5",
+	"(Alt$(_S_daughters_deltaphi,0) < -0.5 || Alt$(_S_daughters_deltaphi,0) > 0.5)",
+	"Alt$(_S_charge,0) == -1",
+	"Alt$(_S_charge,0) == 1",
+	"Alt$(_S_deltaLInteractionVertexAntiSmin,0) < 2.0",
+	"Alt$(_S_deltaRAntiSmin,0) < 0.5",
+	"Alt$(_S_deltaLInteractionVertexAntiSmin,0) > 10",
+	"Alt$(_Lambda_vz_decay_vertex,0) >= -125.0",
+	"Alt$(_Lambda_vz_decay_vertex,0) <= 125.0",
+	"Alt$(_Lambda_lxy_decay_vertex,0) <= 44.5",
+	"Alt$(_Ks_vz_decay_vertex,0) >= -125.0",
+	"Alt$(_Ks_vz_decay_vertex,0) <= 125.0",
+	"Alt$(_Ks_lxy_decay_vertex,0) <= 44.5",
+	"Alt$(_RECO_Lambda_daughter0_pt,0) >= 0.33",
+	"Alt$(_RECO_Lambda_daughter0_pz,0) >= -22.0",
+	"Alt$(_RECO_Lambda_daughter0_pz,0) <= 22.0",
+	"Alt$(_RECO_Lambda_daughter0_dxy_beamspot,0) >= 0.0",
+	"Alt$(_RECO_Lambda_daughter0_dxy_beamspot,0) <= 9.5",
+	"Alt$(_RECO_Lambda_daughter0_dz_beamspot,0) >= -27.0",
+	"Alt$(_RECO_Lambda_daughter0_dz_beamspot,0) <= 27.0",
+	"Alt$(_RECO_Lambda_daughter1_pt,0) >= 0.33",
+	"Alt$(_RECO_Lambda_daughter1_pz,0) >= -22.0",
+	"Alt$(_RECO_Lambda_daughter1_pz,0) <= 22.0",
+	"Alt$(_RECO_Lambda_daughter1_dxy_beamspot,0) >= 0.0",
+	"Alt$(_RECO_Lambda_daughter1_dxy_beamspot,0) <= 9.5",
+	"Alt$(_RECO_Lambda_daughter1_dz_beamspot,0) >= -27.0",
+	"Alt$(_RECO_Lambda_daughter1_dz_beamspot,0) <= 27.0",
+	"Alt$(_RECO_Ks_daughter0_pt,0) >= 0.33",
+	"Alt$(_RECO_Ks_daughter0_pz,0) >= -22.0",
+	"Alt$(_RECO_Ks_daughter0_pz,0) <= 22.0",
+	"Alt$(_RECO_Ks_daughter0_dxy_beamspot,0) >= 0.0",
+	"Alt$(_RECO_Ks_daughter0_dxy_beamspot,0) <= 9.5",
+	"Alt$(_RECO_Ks_daughter0_dz_beamspot,0) >= -27.0",
+	"Alt$(_RECO_Ks_daughter0_dz_beamspot,0) <= 27.0",
+	"Alt$(_RECO_Ks_daughter1_pt,0) >= 0.33",
+	"Alt$(_RECO_Ks_daughter1_pz,0) >= -22.0",
+	"Alt$(_RECO_Ks_daughter1_pz,0) <= 22.0",
+	"Alt$(_RECO_Ks_daughter1_dxy_beamspot,0) >= 0.0",
+	"Alt$(_RECO_Ks_daughter1_dxy_beamspot,0) <= 9.5",
+	"Alt$(_RECO_Ks_daughter1_dz_beamspot,0) >= -27.0",
+	"Alt$(_RECO_Ks_daughter1_dz_beamspot,0) <= 27.0"
+  };
+  const Variable cutVariables[nCuts] = { v_S_lxy_interaction_vertex_beampipeCenter, v_S_lxy_interaction_vertex_beampipeCenter, v_S_lxy_interaction_vertex_beampipeCenter, v_S_dxy_over_lxy, v_S_dxy_over_lxy, v_S_daughters_deltaphi, v_S_charge, v_S_charge, v_S_deltaLInteractionVertexAntiSmin, v_S_deltaRAntiSmin, v_S_deltaLInteractionVertexAntiSmin, v_Lambda_vz_decay_vertex, v_Lambda_vz_decay_vertex, v_Lambda_lxy_decay_vertex, v_Ks_vz_decay_vertex, v_Ks_vz_decay_vertex, v_Ks_lxy_decay_vertex, v_RECO_Lambda_daughter0_pt, v_RECO_Lambda_daughter0_pz, v_RECO_Lambda_daughter0_pz, v_RECO_Lambda_daughter0_dxy_beamspot, v_RECO_Lambda_daughter0_dxy_beamspot, v_RECO_Lambda_daughter0_dz_beamspot, v_RECO_Lambda_daughter0_dz_beamspot, v_RECO_Lambda_daughter1_pt, v_RECO_Lambda_daughter1_pz, v_RECO_Lambda_daughter1_pz, v_RECO_Lambda_daughter1_dxy_beamspot, v_RECO_Lambda_daughter1_dxy_beamspot, v_RECO_Lambda_daughter1_dz_beamspot, v_RECO_Lambda_daughter1_dz_beamspot, v_RECO_Ks_daughter0_pt, v_RECO_Ks_daughter0_pz, v_RECO_Ks_daughter0_pz, v_RECO_Ks_daughter0_dxy_beamspot, v_RECO_Ks_daughter0_dxy_beamspot, v_RECO_Ks_daughter0_dz_beamspot, v_RECO_Ks_daughter0_dz_beamspot, v_RECO_Ks_daughter1_pt, v_RECO_Ks_daughter1_pz, v_RECO_Ks_daughter1_pz, v_RECO_Ks_daughter1_dxy_beamspot, v_RECO_Ks_daughter1_dxy_beamspot, v_RECO_Ks_daughter1_dz_beamspot, v_RECO_Ks_daughter1_dz_beamspot };
+
+  inline bool noCut(double x){ return x < 99999999.0; }
+  inline bool cut1_lxy_min(double x){ return x > 2.02; }
+  inline bool cut1_lxy_max(double x){ return x < 2.4; }
+  inline bool cut3_dxy_over_lxy_min(double x){ return x >= 0.0; }
+  inline bool cut3_dxy_over_lxy_max(double x){ return x <= 0.5; }
+  inline bool cut4_deltaphi(double x){ return x < -0.5 || x > 0.5; }
+  inline bool S_charge_minus(double x){ return x == -1.0; }
+  inline bool S_charge_plus(double x){ return x == 1.0; }
+  inline bool AntiS_GEN_deltaL(double x){ return x < 2.0; }
+  inline bool AntiS_GEN_deltaR(double x){ return x < 0.5; }
+  inline bool AntiS_noGEN_deltaL(double x){ return x > 10.0; }
+  inline bool fiducial_Lambda_vz_min(double x){ return x >= -125.0; }
+  inline bool fiducial_Lambda_vz_max(double x){ return x <= 125.0; }
+  inline bool fiducial_Lambda_lxy_max(double x){ return x <= 44.5; }
+  inline bool fiducial_Ks_vz_min(double x){ return x >= -125.0; }
+  inline bool fiducial_Ks_vz_max(double x){ return x <= 125.0; }
+  inline bool fiducial_Ks_lxy_max(double x){ return x <= 44.5; }
+  inline bool fiducial_Lambda_daughter0_pt_min(double x){ return x >= 0.33; }
+  inline bool fiducial_Lambda_daughter0_pz_min(double x){ return x >= -22.0; }
+  inline bool fiducial_Lambda_daughter0_pz_max(double x){ return x <= 22.0; }
+  inline bool fiducial_Lambda_daughter0_dxy_min(double x){ return x >= 0.0; }
+  inline bool fiducial_Lambda_daughter0_dxy_max(double x){ return x <= 9.5; }
+  inline bool fiducial_Lambda_daughter0_dz_min(double x){ return x >= -27.0; }
+  inline bool fiducial_Lambda_daughter0_dz_max(double x){ return x <= 27.0; }
+  inline bool fiducial_Lambda_daughter1_pt_min(double x){ return x >= 0.33; }
+  inline bool fiducial_Lambda_daughter1_pz_min(double x){ return x >= -22.0; }
+  inline bool fiducial_Lambda_daughter1_pz_max(double x){ return x <= 22.0; }
+  inline bool fiducial_Lambda_daughter1_dxy_min(double x){ return x >= 0.0; }
+  inline bool fiducial_Lambda_daughter1_dxy_max(double x){ return x <= 9.5; }
+  inline bool fiducial_Lambda_daughter1_dz_min(double x){ return x >= -27.0; }
+  inline bool fiducial_Lambda_daughter1_dz_max(double x){ return x <= 27.0; }
+  inline bool fiducial_Ks_daughter0_pt_min(double x){ return x >= 0.33; }
+  inline bool fiducial_Ks_daughter0_pz_min(double x){ return x >= -22.0; }
+  inline bool fiducial_Ks_daughter0_pz_max(double x){ return x <= 22.0; }
+  inline bool fiducial_Ks_daughter0_dxy_min(double x){ return x >= 0.0; }
+  inline bool fiducial_Ks_daughter0_dxy_max(double x){ return x <= 9.5; }
+  inline bool fiducial_Ks_daughter0_dz_min(double x){ return x >= -27.0; }
+  inline bool fiducial_Ks_daughter0_dz_max(double x){ return x <= 27.0; }
+  inline bool fiducial_Ks_daughter1_pt_min(double x){ return x >= 0.33; }
+  inline bool fiducial_Ks_daughter1_pz_min(double x){ return x >= -22.0; }
+  inline bool fiducial_Ks_daughter1_pz_max(double x){ return x <= 22.0; }
+  inline bool fiducial_Ks_daughter1_dxy_min(double x){ return x >= 0.0; }
+  inline bool fiducial_Ks_daughter1_dxy_max(double x){ return x <= 9.5; }
+  inline bool fiducial_Ks_daughter1_dz_min(double x){ return x >= -27.0; }
+  inline bool fiducial_Ks_daughter1_dz_max(double x){ return x <= 27.0; }
+
+  inline bool passes(unsigned int cut, double x){
+	switch(cut){
+		case c_noCut: return noCut(x);
+		case c_cut1_lxy_min: return cut1_lxy_min(x);
+		case c_cut1_lxy_max: return cut1_lxy_max(x);
+		case c_cut3_dxy_over_lxy_min: return cut3_dxy_over_lxy_min(x);
+		case c_cut3_dxy_over_lxy_max: return cut3_dxy_over_lxy_max(x);
+		case c_cut4_deltaphi: return cut4_deltaphi(x);
+		case c_S_charge_minus: return S_charge_minus(x);
+		case c_S_charge_plus: return S_charge_plus(x);
+		case c_AntiS_GEN_deltaL: return AntiS_GEN_deltaL(x);
+		case c_AntiS_GEN_deltaR: return AntiS_GEN_deltaR(x);
+		case c_AntiS_noGEN_deltaL: return AntiS_noGEN_deltaL(x);
+		case c_fiducial_Lambda_vz_min: return fiducial_Lambda_vz_min(x);
+		case c_fiducial_Lambda_vz_max: return fiducial_Lambda_vz_max(x);
+		case c_fiducial_Lambda_lxy_max: return fiducial_Lambda_lxy_max(x);
+		case c_fiducial_Ks_vz_min: return fiducial_Ks_vz_min(x);
+		case c_fiducial_Ks_vz_max: return fiducial_Ks_vz_max(x);
+		case c_fiducial_Ks_lxy_max: return fiducial_Ks_lxy_max(x);
+		case c_fiducial_Lambda_daughter0_pt_min: return fiducial_Lambda_daughter0_pt_min(x);
+		case c_fiducial_Lambda_daughter0_pz_min: return fiducial_Lambda_daughter0_pz_min(x);
+		case c_fiducial_Lambda_daughter0_pz_max: return fiducial_Lambda_daughter0_pz_max(x);
+		case c_fiducial_Lambda_daughter0_dxy_min: return fiducial_Lambda_daughter0_dxy_min(x);
+		case c_fiducial_Lambda_daughter0_dxy_max: return fiducial_Lambda_daughter0_dxy_max(x);
+		case c_fiducial_Lambda_daughter0_dz_min: return fiducial_Lambda_daughter0_dz_min(x);
+		case c_fiducial_Lambda_daughter0_dz_max: return fiducial_Lambda_daughter0_dz_max(x);
+		case c_fiducial_Lambda_daughter1_pt_min: return fiducial_Lambda_daughter1_pt_min(x);
+		case c_fiducial_Lambda_daughter1_pz_min: return fiducial_Lambda_daughter1_pz_min(x);
+		case c_fiducial_Lambda_daughter1_pz_max: return fiducial_Lambda_daughter1_pz_max(x);
+		case c_fiducial_Lambda_daughter1_dxy_min: return fiducial_Lambda_daughter1_dxy_min(x);
+		case c_fiducial_Lambda_daughter1_dxy_max: return fiducial_Lambda_daughter1_dxy_max(x);
+		case c_fiducial_Lambda_daughter1_dz_min: return fiducial_Lambda_daughter1_dz_min(x);
+		case c_fiducial_Lambda_daughter1_dz_max: return fiducial_Lambda_daughter1_dz_max(x);
+		case c_fiducial_Ks_daughter0_pt_min: return fiducial_Ks_daughter0_pt_min(x);
+		case c_fiducial_Ks_daughter0_pz_min: return fiducial_Ks_daughter0_pz_min(x);
+		case c_fiducial_Ks_daughter0_pz_max: return fiducial_Ks_daughter0_pz_max(x);
+		case c_fiducial_Ks_daughter0_dxy_min: return fiducial_Ks_daughter0_dxy_min(x);
+		case c_fiducial_Ks_daughter0_dxy_max: return fiducial_Ks_daughter0_dxy_max(x);
+		case c_fiducial_Ks_daughter0_dz_min: return fiducial_Ks_daughter0_dz_min(x);
+		case c_fiducial_Ks_daughter0_dz_max: return fiducial_Ks_daughter0_dz_max(x);
+		case c_fiducial_Ks_daughter1_pt_min: return fiducial_Ks_daughter1_pt_min(x);
+		case c_fiducial_Ks_daughter1_pz_min: return fiducial_Ks_daughter1_pz_min(x);
+		case c_fiducial_Ks_daughter1_pz_max: return fiducial_Ks_daughter1_pz_max(x);
+		case c_fiducial_Ks_daughter1_dxy_min: return fiducial_Ks_daughter1_dxy_min(x);
+		case c_fiducial_Ks_daughter1_dxy_max: return fiducial_Ks_daughter1_dxy_max(x);
+		case c_fiducial_Ks_daughter1_dz_min: return fiducial_Ks_daughter1_dz_min(x);
+		case c_fiducial_Ks_daughter1_dz_max: return fiducial_Ks_daughter1_dz_max(x);
+	}
+	return false;
+  }
+
+  //the named selections, the cuts in the order in which they are applied
+  const Cut noCutCuts[] = { c_noCut };
+  const Cut pre_BDT_cut1Cuts[] = { c_cut1_lxy_min, c_cut1_lxy_max };
+  const Cut pre_BDT_cut3Cuts[] = { c_cut3_dxy_over_lxy_min, c_cut3_dxy_over_lxy_max };
+  const Cut pre_BDT_cut4Cuts[] = { c_cut4_deltaphi };
+  const Cut fiducial_regionCuts[] = { c_fiducial_Lambda_vz_min, c_fiducial_Lambda_vz_max, c_fiducial_Lambda_lxy_max, c_fiducial_Ks_vz_min, c_fiducial_Ks_vz_max, c_fiducial_Ks_lxy_max, c_fiducial_Lambda_daughter0_pt_min, c_fiducial_Lambda_daughter0_pz_min, c_fiducial_Lambda_daughter0_pz_max, c_fiducial_Lambda_daughter0_dxy_min, c_fiducial_Lambda_daughter0_dxy_max, c_fiducial_Lambda_daughter0_dz_min, c_fiducial_Lambda_daughter0_dz_max, c_fiducial_Lambda_daughter1_pt_min, c_fiducial_Lambda_daughter1_pz_min, c_fiducial_Lambda_daughter1_pz_max, c_fiducial_Lambda_daughter1_dxy_min, c_fiducial_Lambda_daughter1_dxy_max, c_fiducial_Lambda_daughter1_dz_min, c_fiducial_Lambda_daughter1_dz_max, c_fiducial_Ks_daughter0_pt_min, c_fiducial_Ks_daughter0_pz_min, c_fiducial_Ks_daughter0_pz_max, c_fiducial_Ks_daughter0_dxy_min, c_fiducial_Ks_daughter0_dxy_max, c_fiducial_Ks_daughter0_dz_min, c_fiducial_Ks_daughter0_dz_max, c_fiducial_Ks_daughter1_pt_min, c_fiducial_Ks_daughter1_pz_min, c_fiducial_Ks_daughter1_pz_max, c_fiducial_Ks_daughter1_dxy_min, c_fiducial_Ks_daughter1_dxy_max, c_fiducial_Ks_daughter1_dz_min, c_fiducial_Ks_daughter1_dz_max };
+  const Cut pre_BDTCuts[] = { c_fiducial_Lambda_vz_min, c_fiducial_Lambda_vz_max, c_fiducial_Lambda_lxy_max, c_fiducial_Ks_vz_min, c_fiducial_Ks_vz_max, c_fiducial_Ks_lxy_max, c_fiducial_Lambda_daughter0_pt_min, c_fiducial_Lambda_daughter0_pz_min, c_fiducial_Lambda_daughter0_pz_max, c_fiducial_Lambda_daughter0_dxy_min, c_fiducial_Lambda_daughter0_dxy_max, c_fiducial_Lambda_daughter0_dz_min, c_fiducial_Lambda_daughter0_dz_max, c_fiducial_Lambda_daughter1_pt_min, c_fiducial_Lambda_daughter1_pz_min, c_fiducial_Lambda_daughter1_pz_max, c_fiducial_Lambda_daughter1_dxy_min, c_fiducial_Lambda_daughter1_dxy_max, c_fiducial_Lambda_daughter1_dz_min, c_fiducial_Lambda_daughter1_dz_max, c_fiducial_Ks_daughter0_pt_min, c_fiducial_Ks_daughter0_pz_min, c_fiducial_Ks_daughter0_pz_max, c_fiducial_Ks_daughter0_dxy_min, c_fiducial_Ks_daughter0_dxy_max, c_fiducial_Ks_daughter0_dz_min, c_fiducial_Ks_daughter0_dz_max, c_fiducial_Ks_daughter1_pt_min, c_fiducial_Ks_daughter1_pz_min, c_fiducial_Ks_daughter1_pz_max, c_fiducial_Ks_daughter1_dxy_min, c_fiducial_Ks_daughter1_dxy_max, c_fiducial_Ks_daughter1_dz_min, c_fiducial_Ks_daughter1_dz_max, c_cut4_deltaphi, c_cut1_lxy_min, c_cut1_lxy_max, c_cut3_dxy_over_lxy_min, c_cut3_dxy_over_lxy_max };
+  const Cut SignalAntiSCuts[] = { c_S_charge_minus, c_AntiS_GEN_deltaL, c_AntiS_GEN_deltaR };
+  const Cut BkgSCuts[] = { c_S_charge_plus };
+  const Cut BkgAntiSCuts[] = { c_S_charge_minus, c_AntiS_noGEN_deltaL };
+  const Cut AntiSCuts[] = { c_S_charge_minus };
+  struct Selection { const char* name; unsigned int nCuts; const Cut* cuts; };
+  const Selection selections[] = {
+	{ "noCut", 1, noCutCuts },
+	{ "pre_BDT_cut1", 2, pre_BDT_cut1Cuts },
+	{ "pre_BDT_cut3", 2, pre_BDT_cut3Cuts },
+	{ "pre_BDT_cut4", 1, pre_BDT_cut4Cuts },
+	{ "fiducial_region", 34, fiducial_regionCuts },
+	{ "pre_BDT", 39, pre_BDTCuts },
+	{ "SignalAntiS", 3, SignalAntiSCuts },
+	{ "BkgS", 1, BkgSCuts },
+	{ "BkgAntiS", 2, BkgAntiSCuts },
+	{ "AntiS", 1, AntiSCuts }
+  };
+  const unsigned int nSelections = 10;
+
+}
+
+#endif
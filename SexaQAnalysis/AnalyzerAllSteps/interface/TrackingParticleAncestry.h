@@ -0,0 +1,56 @@
+#ifndef TrackingParticleAncestry_h
+#define TrackingParticleAncestry_h
+
+#include "SimDataFormats/TrackingAnalysis/interface/TrackingParticle.h"
+
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+//The trackingparticles do not have mother-daughter relations stored, a daughter is a tp which has its production vertex at exactly the same location as the first decay vertex of the mother.
+//This class indexes the TrackingParticleCollection of one event once on these vertex positions (O(N)), after which finding the daughters of a tp and checking if a tp is an antiS granddaughter are O(1).
+//The positions are compared exactly, as the nested loops over the collection that this replaces did.
+class TrackingParticleAncestry {
+  public:
+    //which kind of antiS granddaughter a tp is, same numbering as the _tp_isAntiSTrack branch
+    enum GranddaughterType { notAntiSGranddaughter = 0, KsPion = 1, AntiLambdaPion = 2, AntiLambdaAntiProton = 3 };
+
+    //index the collection of this event, has to be called before any of the below
+    void build(TrackingParticleCollection const & TPColl);
+
+    //indices in the collection (ascending) of the tps produced at the first decay vertex of tp
+    const std::vector<unsigned int>& daughters(const TrackingParticle& tp) const;
+
+    //for the tp at index i in the collection: is it a pion or antiproton from a Ks or AntiLambda which comes from an antiS
+    int antiSGranddaughterType(unsigned int i) const { return granddaughterType_[i]; }
+    //eta of that antiS, 999 if the tp does not descend from an antiS through a Ks or AntiLambda
+    double etaOfGrandMotherAntiS(unsigned int i) const { return etaOfGrandMotherAntiS_[i]; }
+    //indices in the collection (ascending) of all the tps with antiSGranddaughterType != notAntiSGranddaughter
+    const std::vector<unsigned int>& antiSGranddaughters() const { return antiSGranddaughters_; }
+
+  private:
+    struct Position {
+	double x, y, z;
+	bool operator==(const Position& other) const { return x == other.x && y == other.y && z == other.z; }
+    };
+    struct PositionHash {
+	size_t operator()(const Position& p) const {
+		std::hash<double> h;
+		return h(p.x) ^ (h(p.y) << 1) ^ (h(p.z) << 2);
+	}
+    };
+    typedef std::unordered_map<Position, std::vector<unsigned int>, PositionHash> PositionIndex;
+
+    static Position productionPosition(const TrackingParticle& tp) { return Position{tp.vx(), tp.vy(), tp.vz()}; }
+    const std::vector<unsigned int>& find(const PositionIndex& index, const Position& position) const;
+
+    //tps per production vertex position and per first decay vertex position
+    PositionIndex producedAt_;
+    PositionIndex decayingAt_;
+    std::vector<int> granddaughterType_;
+    std::vector<double> etaOfGrandMotherAntiS_;
+    std::vector<unsigned int> antiSGranddaughters_;
+    std::vector<unsigned int> none_;
+};
+
+#endif
@@ -0,0 +1,67 @@
+#ifndef V0FitterCutFlow_h
+#define V0FitterCutFlow_h
+
+#include "CommonTools/UtilAlgos/interface/TFileService.h"
+#include "TH1F.h"
+
+#include <chrono>
+#include <ostream>
+
+//Job level accounting of the copy of the V0Fitter in FlatTreeProducerTracking: how many track pairs reach and pass every step of FlatTreeProducerTracking::V0Fitter, the counts of its return codes,
+//the time spent in every step and how many tracks fail each cut of V0Fitter_trackSelection. Written as histograms to the TFileService file and printed as a summary at the end of the job,
+//so the cut which kills the efficiency and the step where the refit spends its time can be seen without going through the trees.
+class V0FitterCutFlow {
+  public:
+    //the steps of V0Fitter in the order they are done, every return code 1-22 comes from one of them (see stepOf)
+    enum Step { charge = 0, impactPoint, closestApproach, POCA, quadrant, mPiPi, vertexFit, vertexChi2, decaySignificance, trajectoriesAtVertex, pointingAngle, massWindow, nSteps };
+    //return codes of V0Fitter: 0 is accepted, 1-22 the rejections
+    static constexpr int nReturnCodes = 23;
+    //the cuts of V0Fitter_trackSelection
+    enum TrackCut { trackChi2 = 0, trackNHits, trackPt, trackIPSigXY, trackIPSigZ, nTrackCuts };
+
+    //the step in which V0Fitter returns returnCode
+    static Step stepOf(int returnCode);
+    static const char* stepName(Step step);
+    static const char* trackCutName(TrackCut cut);
+
+    //to be called from the module's beginJob
+    void book(TFileService& fs);
+
+    //start of a V0Fitter call
+    void begin() { last_ = Clock::now(); }
+    //step was passed, the time since begin() or the previous passed step was spent in it
+    void passed(Step step) { addTime(step); nPassed_[step]++; }
+    //end of the V0Fitter call: the time since the last passed step goes to the step returnCode comes from
+    void end(int returnCode);
+
+    //one call of V0Fitter_trackSelection, failed[cut] is true if the track fails that cut
+    void track(const bool failed[nTrackCuts]);
+
+    //to be called from the module's endJob: fill the histograms and print the summary
+    void fill();
+    void print(std::ostream& out) const;
+
+  private:
+    typedef std::chrono::steady_clock Clock;
+    void addTime(Step step) {
+	const Clock::time_point now = Clock::now();
+	seconds_[step] += std::chrono::duration<double>(now - last_).count();
+	last_ = now;
+    }
+
+    Clock::time_point last_;
+    unsigned long nCalls_ = 0;
+    unsigned long nPassed_[nSteps] = {};
+    unsigned long nReturnCode_[nReturnCodes] = {};
+    double seconds_[nSteps] = {};
+    unsigned long nTracks_ = 0;
+    unsigned long nTracksPassed_ = 0;
+    unsigned long nTracksFailed_[nTrackCuts] = {};
+
+    TH1F* h_cutFlow_ = nullptr;
+    TH1F* h_returnCode_ = nullptr;
+    TH1F* h_stepTime_ = nullptr;
+    TH1F* h_trackSelection_ = nullptr;
+};
+
+#endif
@@ -1,6 +1,8 @@
 #from ROOT import TFile, TH1F, TH2F, TEfficiency, TH1D, TH2D, TCanvas, gROOT
+from __future__ import print_function
 from ROOT import *
 import numpy as np
+import struct
 import sys
 sys.path.append('/user/jdeclerc/CMSSW_8_0_30_bis/src/SexaQAnalysis/AnalyzerAllSteps/macros/tdrStyle')
 import  CMS_lumi, tdrstyle
@@ -22,6 +24,8 @@ MaxEvents = 1e7
 
 
 plots_output_dir = "Results/"
+#name of the binary payload with the 2D reweighing parameters, put the data era in the name
+payload_name = "PUReweighing_nPV_vzPV_2016.bin"
 
 #have to reweigh on the z location of the PV
 n_PVZ = 600
@@ -44,14 +48,14 @@ fMC = TFile('file:/user/jdeclerc/CMSSW_8_0_30_bis/src/SexaQAnalysis/AnalyzerAllS
 h2_nPV_vzPV_MC = fMC.Get('PV/h2_nPV_vzPV_MC')
 
 #you first need to scale the data to the number of events in MC
-print "mean #PV in data: ", h2_nPV_vzPV_Data.GetMean(1)
-print "mean #PV in mc  : ", h2_nPV_vzPV_MC.GetMean(1)
+print("mean #PV in data: ", h2_nPV_vzPV_Data.GetMean(1))
+print("mean #PV in mc  : ", h2_nPV_vzPV_MC.GetMean(1))
 NEventsData = h2_nPV_vzPV_Data.GetEntries()/h2_nPV_vzPV_Data.GetMean(1)
 NEventsMC   = h2_nPV_vzPV_MC.GetEntries()/h2_nPV_vzPV_MC.GetMean(1)
 h2_nPV_vzPV_Data.Scale(NEventsMC/NEventsData)
 
-print 'PVs in the data: ', h2_nPV_vzPV_Data.GetEntries() 
-print 'PVs in the MC:   ', h2_nPV_vzPV_MC.GetEntries()
+print('PVs in the data: ', h2_nPV_vzPV_Data.GetEntries())
+print('PVs in the MC:   ', h2_nPV_vzPV_MC.GetEntries())
 
 h_nPV_Data = h2_nPV_vzPV_Data.ProjectionX()
 h_nPV_MC = h2_nPV_vzPV_MC.ProjectionX()
@@ -60,14 +64,12 @@ h_vzPV_Data = h2_nPV_vzPV_Data.ProjectionY()
 h_vzPV_MC = h2_nPV_vzPV_MC.ProjectionY()
 
 if(h2_nPV_vzPV_Data.GetNbinsX() != h2_nPV_vzPV_MC.GetNbinsX()):
-	print 'Data and MC plot have different number of bins in X'
+	print('Data and MC plot have different number of bins in X')
 if(h2_nPV_vzPV_Data.GetNbinsY() != h2_nPV_vzPV_MC.GetNbinsY()):
-	print 'Data and MC plot have different number of bins in Y'
+	print('Data and MC plot have different number of bins in Y')
 
 
 
-f = open(plots_output_dir+'PUReweighing.txt', "w")
-
 #fill the plots with the reweighing parameter
 for i in range(1,h_vzPV_Data.GetNbinsX()+1):
 	data_PVvz = h_vzPV_Data.GetBinContent(i)
@@ -86,14 +88,8 @@ for i in range(1,h_nPV_Data.GetNbinsX()+1):
 		dataToMC_nPV = data_nPV/mc_nPV
 	h_reweighingFactor_nPV.SetBinContent(i,dataToMC_nPV)	
 
-#f.write(",")
-#for j in range(1,h2_nPV_vzPV_Data.GetNbinsY()+1):
-#	f.write(str(h2_reweighingFactor_nPV_PVz.GetYaxis().GetBinCenter(j))+",")
-#f.write("\n")
-
-#loop over the PU
+#loop over the PU and fill the 2D reweighing parameter
 for i in range(1,h2_nPV_vzPV_Data.GetNbinsX()+1):
-	f.write('map<double,double>AnalyzerAllSteps::mapPU'+str(int(h2_reweighingFactor_nPV_PVz.GetXaxis().GetBinCenter(i)))+' = ' + '{' )
 	for j in range(1,h2_nPV_vzPV_Data.GetNbinsY()+1):
 		data_nPV_vzPV = h2_nPV_vzPV_Data.GetBinContent(i,j)
 		mc_nPV_vzPV = h2_nPV_vzPV_MC.GetBinContent(i,j)
@@ -101,17 +97,21 @@ for i in range(1,h2_nPV_vzPV_Data.GetNbinsX()+1):
 		if(mc_nPV_vzPV>0.):
 			dataToMC_nPV_vzPV = data_nPV_vzPV/mc_nPV_vzPV
 		h2_reweighingFactor_nPV_PVz.SetBinContent(i,j,dataToMC_nPV_vzPV)	
-		f.write('{'+str(h2_reweighingFactor_nPV_PVz.GetYaxis().GetBinCenter(j)) + ','+str(dataToMC_nPV_vzPV)+"}")
-		if(j != h2_nPV_vzPV_Data.GetNbinsY()):
-			f.write(',')
-	f.write("};\n")
-f.write('vector<map<double,double>>AnalyzerAllSteps::v_mapPU{')
-for i in range(1,h2_nPV_vzPV_Data.GetNbinsX()+1):
-	f.write('mapPU'+str(int(h2_reweighingFactor_nPV_PVz.GetXaxis().GetBinCenter(i))))
-	if i != h2_nPV_vzPV_Data.GetNbinsX():
-		f.write(',')
-f.write('};')
+
+#write the payload which is read by PUReweighingTable (interface/PUReweighingTable.h) in the FlatTreeProducers: copy it to ../../data/ and point the PUReweighingFile parameter in the _cfi.py to it, no need to recompile anything
+#layout (little endian): char[8] "SEXAQPU", uint32 version, uint32 nPV, uint32 nVz, uint32 reserved, double vzMin, double vzMax, float weights[nPV][nVz] with row i for i good PVs
+if(h2_reweighingFactor_nPV_PVz.GetXaxis().GetBinCenter(1) != 0):
+	print('The first nPV bin should be nPV = 0, the payload assumes that row i is for i good PVs')
+payload_version = 1
+f = open(plots_output_dir+payload_name, "wb")
+f.write(struct.pack('<8s', b'SEXAQPU'))
+f.write(struct.pack('<IIII', payload_version, h2_reweighingFactor_nPV_PVz.GetNbinsX(), h2_reweighingFactor_nPV_PVz.GetNbinsY(), 0))
+f.write(struct.pack('<dd', h2_reweighingFactor_nPV_PVz.GetYaxis().GetXmin(), h2_reweighingFactor_nPV_PVz.GetYaxis().GetXmax()))
+for i in range(1,h2_reweighingFactor_nPV_PVz.GetNbinsX()+1):
+	row = [h2_reweighingFactor_nPV_PVz.GetBinContent(i,j) for j in range(1,h2_reweighingFactor_nPV_PVz.GetNbinsY()+1)]
+	f.write(struct.pack('<%df' % len(row), *row))
 f.close()
+print('PU reweighing payload written to ', plots_output_dir+payload_name)
 
 #now do the reweighing: loop over the events again and reeigh the mc to data. Do this for the vz distribution of the PV as a test that your reweighing works.
 
@@ -5,11 +5,25 @@ FlatTreeProducerBDT = cms.EDAnalyzer('FlatTreeProducerBDT',
     lookAtAntiS = cms.untracked.bool(False),
     runningOnData = cms.untracked.bool(False),
     beamspot = cms.InputTag("offlineBeamSpot"),
-    offlinePV = cms.InputTag("offlinePrimaryVertices","",""),
+    #the PVs selected by SexaQAnalysis/Skimming/python/GoodPVProducer_cfi.py, which has to run before this module
+    goodPVs = cms.InputTag("GoodPVProducer"),
+    #the EventSummary written by the InitialProducer in the skimming, its counts and sums go to the _summary_* columns (-1 if it is not in the input)
+    eventSummary = cms.InputTag("InitialProducer"),
     genCollection_GEN =  cms.InputTag("genParticles","","GEN"),
     genCollection_SIM_GEANT =  cms.InputTag("genParticlesPlusGEANT","",""),
     generalTracksCollection =  cms.InputTag("generalTracks","","RECO"),
     sexaqCandidates = cms.InputTag("lambdaKshortVertexFilter", "sParticles",""),
     V0KsCollection = cms.InputTag("generalV0Candidates","Kshort",""),
     V0LCollection = cms.InputTag("generalV0Candidates","Lambda",""),
+    #2D (number of good PVs, vz of the PV) PU reweighing parameters, written by macros/PUReweighing/CreateDataMCRatioVzPV_histoFromFile.py. Point this to another payload in data/ to switch era, no rebuild needed
+    PUReweighingFile = cms.FileInPath("SexaQAnalysis/AnalyzerAllSteps/data/PUReweighing_nPV_vzPV_2016.bin"),
+    #evaluate the BDT on the saved candidates and write the score to _S_BDT (-999 if not evaluated). The payload is written from the TMVA weights by TMVA/Step1/makeFlatBDT.py
+    evaluateBDT = cms.untracked.bool(False),
+    BDTWeightsFile = cms.FileInPath("SexaQAnalysis/AnalyzerAllSteps/data/FlatBDT_2016vSelected19Parameters.bin"),
+    #if evaluateBDT: candidates with a BDT score below this are not saved, the score is between -1 and 1, so -1 saves all candidates
+    minBDTScore = cms.double(-1.),
+    #layout of FlatTree: "vector" (std::vector branches, as before) or "scalar" (plain float/int branches, one entry per candidate, with _eventIndex pointing to the entry of FlatTreePV)
+    flatTreeLayout = cms.untracked.string("vector"),
+    #the random PV for the PU reweighing of the background is drawn from this seed and the run, lumi and event number, so it does not depend on the job splitting
+    randomSeed = cms.untracked.uint32(20190507),
 )
@@ -5,8 +5,11 @@ FlatTreeProducerGENSIM = cms.EDAnalyzer('FlatTreeProducerGENSIM',
     lookAtAntiS = cms.untracked.bool(False),
     runningOnData = cms.untracked.bool(False),
     beamspot = cms.InputTag("offlineBeamSpot"),
-    offlinePV = cms.InputTag("offlinePrimaryVertices","",""),
+    #the PVs selected by SexaQAnalysis/Skimming/python/GoodPVProducer_cfi.py, which has to run before this module
+    goodPVs = cms.InputTag("GoodPVProducer"),
     genCollection_GEN =  cms.InputTag("genParticles","","GEN"),
     genCollection_SIM_GEANT =  cms.InputTag("genParticlesPlusGEANT","","SIM"),
-    TrackingParticles = cms.InputTag("mix","MergedTrackTruth")
+    TrackingParticles = cms.InputTag("mix","MergedTrackTruth"),
+    #2D (number of good PVs, vz of the PV) PU reweighing parameters, written by macros/PUReweighing/CreateDataMCRatioVzPV_histoFromFile.py. Point this to another payload in data/ to switch era, no rebuild needed
+    PUReweighingFile = cms.FileInPath("SexaQAnalysis/AnalyzerAllSteps/data/PUReweighing_nPV_vzPV_2016.bin")
 )
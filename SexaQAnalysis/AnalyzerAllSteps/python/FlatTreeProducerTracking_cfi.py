@@ -2,8 +2,14 @@ import FWCore.ParameterSet.Config as cms
 from Validation.RecoTrack.TrackingParticleSelectionForEfficiency_cfi import * 
 from SimTracker.TrackAssociation.LhcParametersDefinerForTP_cfi import * 
 FlatTreeProducerTracking= cms.EDAnalyzer('FlatTreeProducerTracking',
+    #fill the (heavy) FlatTreeTracks tree with all charged trackingparticles and their matched tracks
+    fillTracksTree = cms.untracked.bool(False),
+    #associate only the trackingparticles which are granddaughters of an antiS (pions of the Ks, pion and antiproton of the AntiLambda) to the tracks, the only ones looked up for the antiS tree.
+    #Ignored (all trackingparticles are associated) when fillTracksTree is set
+    associateAntiSGranddaughtersOnly = cms.untracked.bool(True),
     beamspot = cms.InputTag("offlineBeamSpot","",""),
-    offlinePV = cms.InputTag("offlinePrimaryVertices","",""),
+    #the PVs selected by SexaQAnalysis/Skimming/python/GoodPVProducer_cfi.py, which has to run before this module
+    goodPVs = cms.InputTag("GoodPVProducer"),
     genCollection_GEN =  cms.InputTag("genParticles","","GEN"),
     genCollection_SIM_GEANT =  cms.InputTag("genParticlesPlusGEANT","","SIM"),
     generalTracksCollection =  cms.InputTag("generalTracks","",""),
@@ -12,6 +18,8 @@ FlatTreeProducerTracking= cms.EDAnalyzer('FlatTreeProducerTracking',
     V0LCollection = cms.InputTag("generalV0Candidates","Lambda",""), #can also be SEXAQ
     trackAssociators = cms.InputTag("quickTrackAssociatorByHits"),
     TrackingParticles = cms.InputTag("mix","MergedTrackTruth"),
+    #2D (number of good PVs, vz of the PV) PU reweighing parameters, written by macros/PUReweighing/CreateDataMCRatioVzPV_histoFromFile.py. Point this to another payload in data/ to switch era, no rebuild needed
+    PUReweighingFile = cms.FileInPath("SexaQAnalysis/AnalyzerAllSteps/data/PUReweighing_nPV_vzPV_2016.bin"),
 #    PileupInfo = cms.InputTag("addPileupInfo","","HLT")
 
     #################
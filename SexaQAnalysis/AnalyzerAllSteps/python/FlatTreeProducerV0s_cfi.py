@@ -6,6 +6,10 @@ FlatTreeProducerV0s = cms.EDAnalyzer('FlatTreeProducerV0s',
     runningOnData = cms.untracked.bool(False),
     beamspot = cms.InputTag("offlineBeamSpot"),
     offlinePV = cms.InputTag("offlinePrimaryVertices","","RECO"),
+    #the PVs selected by SexaQAnalysis/Skimming/python/GoodPVProducer_cfi.py, which has to run before this module
+    goodPVs = cms.InputTag("GoodPVProducer"),
+    #the EventSummary written by the InitialProducer in the skimming, its counts and sums go to the _summary_* columns (-1 if it is not in the input)
+    eventSummary = cms.InputTag("InitialProducer"),
     genCollection_GEN =  cms.InputTag("genParticles","","HLT"),
     genCollection_SIM_GEANT =  cms.InputTag("genParticlesPlusGEANT","","SIM"),
     #generalTracksCollection =  cms.InputTag("generalTracks","","RECO"),
@@ -13,5 +17,9 @@ FlatTreeProducerV0s = cms.EDAnalyzer('FlatTreeProducerV0s',
     V0KsCollection = cms.InputTag("generalV0Candidates","Kshort","SEXAQ"),
     V0LCollection = cms.InputTag("generalV0Candidates","Lambda","SEXAQ"),
     muonsCollection = cms.InputTag("muons","","RECO"),
-    jetsCollection = cms.InputTag("ak4PFJets","","RECO")
+    jetsCollection = cms.InputTag("ak4PFJets","","RECO"),
+    #maximal number of jets above 30 GeV pt (highest pt first) checked for contaminating the transverse region of the Z, 0 means all
+    nHardConeJets = cms.uint32(0),
+    #layout of FlatTreeKs and FlatTreeLambda: "vector" (one entry per event with std::vector branches, as before) or "scalar" (one entry per V0 with plain float/int branches, with _eventIndex pointing to the entry of FlatTreeZ/PV/Beamspot/General)
+    flatTreeLayout = cms.untracked.string("vector")
 )
@@ -13,77 +13,34 @@ double AnalyzerAllSteps::deltaR(double phi1, double eta1, double phi2, double et
 }
 
 //2D distance in xy
-double AnalyzerAllSteps::lxy(TVector3 v1, TVector3 v2){
-	double x1 = v1.X();
-	double x2 = v2.X();
-	double y1 = v1.Y();
-	double y2 = v2.Y();
-	return sqrt(pow(x1-x2,2)+pow(y1-y2,2));
+double AnalyzerAllSteps::lxy(const TVector3& v1, const TVector3& v2){
+	return sexaq::lxy(vec3(v1), vec3(v2));
 }
 
 //3D distance
-double AnalyzerAllSteps::lxyz(TVector3 v1, TVector3 v2){
-	double x1 = v1.X();
-	double x2 = v2.X();
-	double y1 = v1.Y();
-	double y2 = v2.Y();
-	double z1 = v1.Z();
-	double z2 = v2.Z();
-	return sqrt(pow(x1-x2,2)+pow(y1-y2,2)+pow(z1-z2,2));
+double AnalyzerAllSteps::lxyz(const TVector3& v1, const TVector3& v2){
+	return sexaq::lxyz(vec3(v1), vec3(v2));
 }
 
 
 //point of closest approach vector between a point (Point) and a line (Point_line;Vector_along_line)
-TVector3 AnalyzerAllSteps::PCA_line_point(TVector3 Point_line, TVector3 Vector_along_line, TVector3 Point){
-   //first move the vector along the line to the starting point of Point_line
-   double normalise = sqrt(Vector_along_line.X()*Vector_along_line.X()+Vector_along_line.Y()*Vector_along_line.Y()+Vector_along_line.Z()*Vector_along_line.Z());
-   TVector3 n(Vector_along_line.X()/normalise,Vector_along_line.Y()/normalise,Vector_along_line.Z()/normalise);
-   TVector3 a = Point_line;
-   TVector3 p = Point;
-
-   //see https://en.wikipedia.org/wiki/Distance_from_a_point_to_a_line (Vector formulation)
-   TVector3 vector_PCA = (a-p)-((a-p)*n)*n;
-   return vector_PCA ;
+TVector3 AnalyzerAllSteps::PCA_line_point(const TVector3& Point_line, const TVector3& Vector_along_line, const TVector3& Point){
+	return tvector3(sexaq::PCA_line_point(vec3(Point_line), vec3(Vector_along_line), vec3(Point)));
 }
 
 //return the PCA vector in xy between point and line
-TVector3 AnalyzerAllSteps::vec_dxy_line_point(TVector3 Point_line_in, TVector3 Vector_along_line_in, TVector3 Point_in){
-  //looking at XY, so put the Z component to 0 first
-  TVector3 Point_line(Point_line_in.X(),Point_line_in.Y(),0.);
-  TVector3 Vector_along_line(Vector_along_line_in.X(), Vector_along_line_in.Y(),0.);
-  TVector3 Point(Point_in.X(), Point_in.Y(), 0.);
-  
-  TVector3 shortest_distance = PCA_line_point(Point_line,  Vector_along_line, Point);
-  return shortest_distance;
-	
+TVector3 AnalyzerAllSteps::vec_dxy_line_point(const TVector3& Point_line_in, const TVector3& Vector_along_line_in, const TVector3& Point_in){
+	return tvector3(sexaq::vec_dxy_line_point(vec3(Point_line_in), vec3(Vector_along_line_in), vec3(Point_in)));
 }
 
 //return shortest distance between point and vector in xy. The sign is given by the dot product of the vector connecting the PCA to the refernece point and the direction of the vector under study
-double AnalyzerAllSteps::dxy_signed_line_point(TVector3 Point_line_in, TVector3 Vector_along_line_in, TVector3 Point_in){
-  TVector3 shortest_distance = vec_dxy_line_point(Point_line_in,Vector_along_line_in,Point_in);
-  double dxy_signed_line_point = sqrt(shortest_distance.X()*shortest_distance.X()+shortest_distance.Y()*shortest_distance.Y());
-
-  //looking at XY, so put the Z component to 0 first
-  TVector3 Point_line(Point_line_in.X(),Point_line_in.Y(),0.);
-  TVector3 Vector_along_line(Vector_along_line_in.X(), Vector_along_line_in.Y(),0.);
-  TVector3 Point(Point_in.X(), Point_in.Y(), 0.);
-
-  TVector3 displacement = Point_line - Point; 
-  if(displacement*Vector_along_line<0)dxy_signed_line_point = -dxy_signed_line_point;
-
-  return dxy_signed_line_point;
+double AnalyzerAllSteps::dxy_signed_line_point(const TVector3& Point_line_in, const TVector3& Vector_along_line_in, const TVector3& Point_in){
+	return sexaq::dxy_signed_line_point(vec3(Point_line_in), vec3(Vector_along_line_in), vec3(Point_in));
 }
 
 //same as dxy_signed_line_point, but now in 3D
-double AnalyzerAllSteps::dxyz_signed_line_point(TVector3 Point_line_in, TVector3 Vector_along_line_in, TVector3 Point_in){
-  TVector3 shortest_distance = PCA_line_point(Point_line_in,  Vector_along_line_in, Point_in);
-  double dxyz_signed_line_point = sqrt(shortest_distance.X()*shortest_distance.X()+shortest_distance.Y()*shortest_distance.Y()+shortest_distance.Z()*shortest_distance.Z());
-
-  TVector3 displacement = Point_line_in - Point_in; 
-  if(displacement*Vector_along_line_in<0)dxyz_signed_line_point = -dxyz_signed_line_point;
-
-  return dxyz_signed_line_point;
-	
+double AnalyzerAllSteps::dxyz_signed_line_point(const TVector3& Point_line_in, const TVector3& Vector_along_line_in, const TVector3& Point_in){
+	return sexaq::dxyz_signed_line_point(vec3(Point_line_in), vec3(Vector_along_line_in), vec3(Point_in));
 }
 
 //uncertainty on lxy
@@ -97,58 +54,68 @@ double AnalyzerAllSteps::std_dev_lxy(double vx, double vy, double vx_var, double
 }
 
 //function to return the cos of the angle between the momentum of the particle and it's displacement vector. This is for a V0 particle, so you need the V0 to decay to get it's decay vertex
-double AnalyzerAllSteps::XYpointingAngle(const reco::Candidate  * particle, TVector3 beamspot){
+double AnalyzerAllSteps::XYpointingAngle(const reco::Candidate  * particle, const TVector3& beamspot){
       double angleXY = -2;
       if(particle->numberOfDaughters() == 2){
-	      TVector3 decayVertexParticle(particle->daughter(0)->vx(),particle->daughter(0)->vy(),particle->daughter(0)->vz());	 
-	      double dx = decayVertexParticle.X()-beamspot.X();
-	      double dy = decayVertexParticle.Y()-beamspot.Y();
-	      double px = particle->px();
-	      double py = particle->py();
-	      angleXY = (dx*px+dy*py)/(sqrt(dx*dx+dy*dy)*sqrt(px*px+py*py));
+	      sexaq::Vec3 decayVertexParticle(particle->daughter(0)->vx(),particle->daughter(0)->vy(),particle->daughter(0)->vz());
+	      angleXY = sexaq::XYpointingAngle(decayVertexParticle, sexaq::Vec3(particle->px(),particle->py(),particle->pz()), vec3(beamspot));
       }
       return angleXY;
 	
 }
 
-double AnalyzerAllSteps::CosOpeningsAngle(TVector3 vec1, TVector3 vec2){
-  double nom = vec1.X()*vec2.X()+vec1.Y()*vec2.Y()+vec1.Z()*vec2.Z();
-  double denom = sqrt(vec1.X()*vec1.X()+vec1.Y()*vec1.Y()+vec1.Z()*vec1.Z())*sqrt(vec2.X()*vec2.X()+vec2.Y()*vec2.Y()+vec2.Z()*vec2.Z());
-  return nom/denom;
+double AnalyzerAllSteps::CosOpeningsAngle(const TVector3& vec1, const TVector3& vec2){
+	return sexaq::CosOpeningsAngle(vec3(vec1), vec3(vec2));
 }
 
 //longitudinal impact parameter between a vector (Point_line_in;Vector_along_line_in) and a reference point (Point_in)
-double AnalyzerAllSteps::dz_line_point(TVector3 Point_line_in, TVector3 Vector_along_line_in, TVector3 Point_in){
-  Double_t vz = Point_line_in.Z();
-  Double_t vx = Point_line_in.X();
-  Double_t vy = Point_line_in.Y();
-  Double_t px = Vector_along_line_in.X();
-  Double_t py = Vector_along_line_in.Y();
-  Double_t pz = Vector_along_line_in.Z(); 
-  Double_t pt = sqrt(px*px+py*py);
-  //from: https://github.com/cms-sw/cmssw/blob/master/DataFormats/TrackReco/interface/TrackBase.h#L764-L767
-  return (vz - Point_in.Z()) - ((vx - Point_in.X()) * px + (vy - Point_in.Y()) * py) / pt * pz / pt;
-             
+double AnalyzerAllSteps::dz_line_point(const TVector3& Point_line_in, const TVector3& Vector_along_line_in, const TVector3& Point_in){
+	return sexaq::dz_line_point(vec3(Point_line_in), vec3(Vector_along_line_in), vec3(Point_in));
 }
 
-//use the dz_line_point function here to look for the valid PV in h_offlinePV which minimises the dz
-TVector3 AnalyzerAllSteps::dz_line_point_min(TVector3 Point_line_in, TVector3 Vector_along_line_in, edm::Handle<vector<reco::Vertex>> h_offlinePV){
+//look for the PV in PVs which minimises the dz. PVs are the selected PVs of the GoodPVProducer, normally the POG good PVs (GoodPrimaryVertices::goodPOG). Returns (0,0,0) if there is no PV
+TVector3 AnalyzerAllSteps::dz_line_point_min(TVector3 Point_line_in, TVector3 Vector_along_line_in, const PrimaryVertexArrays& PVs){
 
-	TVector3 bestPV;
-	double dzmin = 999.;
+	const double x = Point_line_in.X(), y = Point_line_in.Y(), z = Point_line_in.Z();
+	const double px = Vector_along_line_in.X(), py = Vector_along_line_in.Y(), pz = Vector_along_line_in.Z();
+	const double pt = sqrt(px*px+py*py);
+	int bestPV;
+	double dzmin;
+	dz_line_point_min(1, &x, &y, &z, &px, &py, &pz, &pt, PVs.size(), PVs.x.data(), PVs.y.data(), PVs.z.data(), &bestPV, &dzmin);
 
-	for(unsigned int i = 0; i < h_offlinePV->size(); ++i){
-		//select only PV with certain quality cuts like it needs enough tracks pointing to it
-		//if(h_offlinePV->at(i).isValid() && h_offlinePV->at(i).tracksSize() >= 4){
-		double r = sqrt(h_offlinePV->at(i).x()*h_offlinePV->at(i).x()+h_offlinePV->at(i).y()*h_offlinePV->at(i).y());
-                if(h_offlinePV->at(i).ndof() > 4 && abs(h_offlinePV->at(i).z()) < 24 && r < 2){
-			TVector3 PV(h_offlinePV->at(i).x(),h_offlinePV->at(i).y(),h_offlinePV->at(i).z());
-			double dz  = AnalyzerAllSteps::dz_line_point(Point_line_in,Vector_along_line_in,PV);
-			if(abs(dz) < abs(dzmin)) {dzmin = dz; bestPV =  PV;}
-		}
+	if(bestPV < 0) return TVector3();
+	return TVector3(PVs.x[bestPV],PVs.y[bestPV],PVs.z[bestPV]);
+
+}
+
+void AnalyzerAllSteps::dz_line_point_min(const LineArrays& lines, const PrimaryVertexArrays& PVs, std::vector<int>& bestPV, std::vector<double>& dzmin){
+
+	bestPV.resize(lines.size());
+	dzmin.resize(lines.size());
+	dz_line_point_min(lines.size(), lines.x.data(), lines.y.data(), lines.z.data(), lines.px.data(), lines.py.data(), lines.pz.data(), lines.pt.data(),
+	                  PVs.size(), PVs.x.data(), PVs.y.data(), PVs.z.data(), bestPV.data(), dzmin.data());
+
+}
+
+void AnalyzerAllSteps::dz_line_point_min(unsigned int nLines, const double* x, const double* y, const double* z, const double* px, const double* py, const double* pz, const double* pt,
+                                         unsigned int nPV, const double* PVx, const double* PVy, const double* PVz, int* bestPV, double* dzmin){
+
+	for(unsigned int i = 0; i < nLines; ++i){
+		bestPV[i] = -1;
+		dzmin[i] = 999.;
 	}
 
-	return bestPV;
+	//the PVs in the outer loop, so for every line they are tried in the order of the collection and the first one of equal |dz| is kept, as in dz_line_point
+	for(unsigned int j = 0; j < nPV; ++j){
+		const double vx = PVx[j], vy = PVy[j], vz = PVz[j];
+		for(unsigned int i = 0; i < nLines; ++i){
+			//the same expression as dz_line_point, so the same dz to the last bit
+			const double dz = (z[i] - vz) - ((x[i] - vx) * px[i] + (y[i] - vy) * py[i]) / pt[i] * pz[i] / pt[i];
+			const bool closer = std::abs(dz) < std::abs(dzmin[i]);
+			dzmin[i] = closer ? dz : dzmin[i];
+			bestPV[i] = closer ? (int)j : bestPV[i];
+		}
+	}
 
 }
 
@@ -187,159 +154,7 @@ int AnalyzerAllSteps::trackQualityAsInt(const reco::Track *track){
     return myquality;
 }
 
-//check for a certain TrackingParticle if this TrackingParticle is a final state particle in an Sbar event. To do this you need to go through the TrackingParticle collection and try to find production vertices overlapping with decay vertices
-std::vector<double> AnalyzerAllSteps::isTpGrandDaughterAntiS(TrackingParticleCollection const & TPColl, const TrackingParticle& tp){
-
- std::vector<double> returnVector; //this vector contains as first element the number defined at the bottom of this function which tells which kind of track this is and as second number the eta of this antiS
- returnVector.push_back(0.);
- returnVector.push_back(999.);
-  
-
- bool tpIsGrandDaughterAntiS = false;
- string daughter = "none";
- string granddaughter = "none";
- if(abs(tp.pdgId()) == 211 || tp.pdgId() == - 2212){//found a charged pion or antiproton
-
-        double granddaughterVx = tp.vx();double granddaughterVy = tp.vy();double granddaughterVz = tp.vz();
-
-        for(size_t j=0; j<TPColl.size(); ++j) {//now find the daughters which have a decay vertex = the production vertex of the granddaughters
-                if(tpIsGrandDaughterAntiS)continue;//can skip it was already found in a previous loop
-                const TrackingParticle& tp_daughter = TPColl[j];
-
-                if(abs(tp_daughter.pdgId()) == 310 || tp_daughter.pdgId() == -3122){//daughter has to be a Ks or Lambda
-
-                        tv_iterator tp_daughter_firstDecayVertex = tp_daughter.decayVertices_begin();
-                        double daughterdecayVx = (**tp_daughter_firstDecayVertex).position().X(); double daughterdecayVy = (**tp_daughter_firstDecayVertex).position().Y(); double daughterdecayVz = (**tp_daughter_firstDecayVertex).position().Z();
-
-                        if(granddaughterVx == daughterdecayVx && granddaughterVy == daughterdecayVy && granddaughterVz == daughterdecayVz){//daughter decay vertex has to match the granddaughter creation vertex
-                                for(size_t k=0; k<TPColl.size(); ++k) {//loop to find the antiS
-                                        if(tpIsGrandDaughterAntiS)continue;//can skip it was already found in a previous loop
-                                        const TrackingParticle& tp_S = TPColl[k];
-                                        if(tp_S.pdgId() == -1020000020){//found the S
-                                                tv_iterator tp_S_firstDecayVertex = tp_S.decayVertices_begin();
-                                                double SdecayVx = (**tp_S_firstDecayVertex).position().X(); double SdecayVy = (**tp_S_firstDecayVertex).position().Y();double SdecayVz = (**tp_S_firstDecayVertex).position().Z();
-                                                if(tp_daughter.vx() == SdecayVx && tp_daughter.vy() == SdecayVy && tp_daughter.vz() == SdecayVz){
-                                                        tpIsGrandDaughterAntiS = true;
-							if(abs(tp.pdgId()) == 211) granddaughter = "pion";
-							else if(tp.pdgId() == -2212) granddaughter = "antiproton";
-
-							if(abs(tp_daughter.pdgId()) == 310) daughter = "Ks";
-							else if(tp_daughter.pdgId() == -3122) daughter = "AntiLambda";
-							
-							returnVector[1] = tp_S.eta();
-                                                }
-                                        }//end if antiS
-                                }//end loop over the tp to find the antiS
-                        }//end check if granddaughter vertex matches the the daughter decay vertex      
-                }//end check for pdgId daughter
-        }//end loop over tp to find daughters
-   }//end check of granddaughter pdgId
-
- if(tpIsGrandDaughterAntiS && daughter == "Ks" && granddaughter == "pion") returnVector[0] = 1.;
- else if(tpIsGrandDaughterAntiS && daughter == "AntiLambda" && granddaughter == "pion") returnVector[0] = 2.;
- else if(tpIsGrandDaughterAntiS && daughter == "AntiLambda" && granddaughter == "antiproton") returnVector[0] = 3.;
- else returnVector[0] = 0;
- 
- return returnVector;
-
-}
-
 //weight factor for the fact that Sbar with higher eta have a larger pathlength through the beampipe
 double AnalyzerAllSteps::EventWeightingFactor(double etaAntiS){
 	return 1/TMath::Sin(etaAntiS);
 }
-
-//extract the reweighing factor for PV distribution. 
-double AnalyzerAllSteps::PUReweighingFactor(map<double,double> map_PUreweighing,double MC_PV_vz){
-	double vz_map_prev = -999.;
-	double weight_map_prev = 0.;
-	double return_weight = 0.;
-
-	
-	
-	for (auto const& x : map_PUreweighing)
-	{
-	    double vz_map  = x.first;
-	    double weight_map  = x.second;
-	    //you start looking at the map at smallest vz, so when vz_map becomes larger than MC_PV_vz you are getting in the correct ballpark 
-	    if(vz_map > MC_PV_vz){
-		//get eiter the current or the previous weight paremeter depdnding if the vz_map or vz_map_prev gives the best math to MC_PV_vz
-		return_weight = weight_map;
-		if(abs(vz_map_prev-MC_PV_vz) < abs(vz_map-MC_PV_vz)) return_weight = weight_map_prev;
-		break;	
-	    }	
-
-	    vz_map_prev = x.first;
-	    weight_map_prev = x.second;   
-
-	}
-
-
-   	return return_weight;
-
-}
-
-//the values for the reweighing for PU: per PU value you have a map with vz's as key and weight parameter as value
-
-
-map<double,double>AnalyzerAllSteps::mapPU0 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.0},{-21.35,0.0},{-21.25,0.0},{-21.15,0.0},{-21.05,0.0},{-20.95,0.0},{-20.85,0.0},{-20.75,0.0},{-20.65,0.0},{-20.55,0.0},{-20.45,0.0},{-20.35,0.0},{-20.25,0.0},{-20.15,0.0},{-20.05,0.0},{-19.95,0.0},{-19.85,0.0},{-19.75,0.0},{-19.65,0.0},{-19.55,0.0},{-19.45,0.0},{-19.35,0.0},{-19.25,0.0},{-19.15,0.0},{-19.05,0.0},{-18.95,0.0},{-18.85,0.0},{-18.75,0.0},{-18.65,0.0},{-18.55,0.0},{-18.45,0.0},{-18.35,0.0},{-18.25,0.0},{-18.15,0.0},{-18.05,0.0},{-17.95,0.0},{-17.85,0.0},{-17.75,0.0},{-17.65,0.0},{-17.55,0.0},{-17.45,0.0},{-17.35,0.0},{-17.25,0.0},{-17.15,0.0},{-17.05,0.0},{-16.95,0.0},{-16.85,0.0},{-16.75,0.0},{-16.65,0.0},{-16.55,0.0},{-16.45,0.0},{-16.35,0.0},{-16.25,0.0},{-16.15,0.0},{-16.05,0.0},{-15.95,0.0},{-15.85,0.0},{-15.75,0.0},{-15.65,0.0},{-15.55,0.0},{-15.45,0.0},{-15.35,0.0},{-15.25,0.0},{-15.15,0.0},{-15.05,0.0},{-14.95,0.0},{-14.85,0.0},{-14.75,0.0},{-14.65,0.0},{-14.55,0.0},{-14.45,0.0},{-14.35,0.0},{-14.25,0.0},{-14.15,0.0},{-14.05,0.0},{-13.95,0.0},{-13.85,0.0},{-13.75,0.0},{-13.65,0.0},{-13.55,0.0},{-13.45,0.0},{-13.35,0.0},{-13.25,0.0},{-13.15,0.0},{-13.05,0.0},{-12.95,0.0},{-12.85,0.0},{-12.75,0.0},{-12.65,0.0},{-12.55,0.0},{-12.45,0.0},{-12.35,0.0},{-12.25,0.0},{-12.15,0.0},{-12.05,0.0},{-11.95,0.0},{-11.85,0.0},{-11.75,0.0},{-11.65,0.0},{-11.55,0.0},{-11.45,0.0},{-11.35,0.0},{-11.25,0.0},{-11.15,0.0},{-11.05,0.0},{-10.95,0.0},{-10.85,0.0},{-10.75,0.0},{-10.65,0.0},{-10.55,0.0},{-10.45,0.0},{-10.35,0.0},{-10.25,0.0},{-10.15,0.0},{-10.05,0.0},{-9.95,0.0},{-9.85,0.0},{-9.75,0.0},{-9.65,0.0},{-9.55,0.0},{-9.45,0.0},{-9.35,0.0},{-9.25,0.0},{-9.15,0.0},{-9.05,0.0},{-8.95,0.0},{-8.85,0.0},{-8.75,0.0},{-8.65,0.0},{-8.55,0.0},{-8.45,0.0},{-8.35,0.0},{-8.25,0.0},{-8.15,0.0},{-8.05,0.0},{-7.95,0.0},{-7.85,0.0},{-7.75,0.0},{-7.65,0.0},{-7.55,0.0},{-7.45,0.0},{-7.35,0.0},{-7.25,0.0},{-7.15,0.0},{-7.05,0.0},{-6.95,0.0},{-6.85,0.0},{-6.75,0.0},{-6.65,0.0},{-6.55,0.0},{-6.45,0.0},{-6.35,0.0},{-6.25,0.0},{-6.15,0.0},{-6.05,0.0},{-5.95,0.0},{-5.85,0.0},{-5.75,0.0},{-5.65,0.0},{-5.55,0.0},{-5.45,0.0},{-5.35,0.0},{-5.25,0.0},{-5.15,0.0},{-5.05,0.0},{-4.95,0.0},{-4.85,0.0},{-4.75,0.0},{-4.65,0.0},{-4.55,0.0},{-4.45,0.0},{-4.35,0.0},{-4.25,0.0},{-4.15,0.0},{-4.05,0.0},{-3.95,0.0},{-3.85,0.0},{-3.75,0.0},{-3.65,0.0},{-3.55,0.0},{-3.45,0.0},{-3.35,0.0},{-3.25,0.0},{-3.15,0.0},{-3.05,0.0},{-2.95,0.0},{-2.85,0.0},{-2.75,0.0},{-2.65,0.0},{-2.55,0.0},{-2.45,0.0},{-2.35,0.0},{-2.25,0.0},{-2.15,0.0},{-2.05,0.0},{-1.95,0.0},{-1.85,0.0},{-1.75,0.0},{-1.65,0.0},{-1.55,0.0},{-1.45,0.0},{-1.35,0.0},{-1.25,0.0},{-1.15,0.0},{-1.05,0.0},{-0.95,0.0},{-0.85,0.0},{-0.75,0.0},{-0.65,0.0},{-0.55,0.0},{-0.45,0.0},{-0.35,0.0},{-0.25,0.0},{-0.15,0.0},{-0.05,0.0},{0.05,0.0},{0.15,0.0},{0.25,0.0},{0.35,0.0},{0.45,0.0},{0.55,0.0},{0.65,0.0},{0.75,0.0},{0.85,0.0},{0.95,0.0},{1.05,0.0},{1.15,0.0},{1.25,0.0},{1.35,0.0},{1.45,0.0},{1.55,0.0},{1.65,0.0},{1.75,0.0},{1.85,0.0},{1.95,0.0},{2.05,0.0},{2.15,0.0},{2.25,0.0},{2.35,0.0},{2.45,0.0},{2.55,0.0},{2.65,0.0},{2.75,0.0},{2.85,0.0},{2.95,0.0},{3.05,0.0},{3.15,0.0},{3.25,0.0},{3.35,0.0},{3.45,0.0},{3.55,0.0},{3.65,0.0},{3.75,0.0},{3.85,0.0},{3.95,0.0},{4.05,0.0},{4.15,0.0},{4.25,0.0},{4.35,0.0},{4.45,0.0},{4.55,0.0},{4.65,0.0},{4.75,0.0},{4.85,0.0},{4.95,0.0},{5.05,0.0},{5.15,0.0},{5.25,0.0},{5.35,0.0},{5.45,0.0},{5.55,0.0},{5.65,0.0},{5.75,0.0},{5.85,0.0},{5.95,0.0},{6.05,0.0},{6.15,0.0},{6.25,0.0},{6.35,0.0},{6.45,0.0},{6.55,0.0},{6.65,0.0},{6.75,0.0},{6.85,0.0},{6.95,0.0},{7.05,0.0},{7.15,0.0},{7.25,0.0},{7.35,0.0},{7.45,0.0},{7.55,0.0},{7.65,0.0},{7.75,0.0},{7.85,0.0},{7.95,0.0},{8.05,0.0},{8.15,0.0},{8.25,0.0},{8.35,0.0},{8.45,0.0},{8.55,0.0},{8.65,0.0},{8.75,0.0},{8.85,0.0},{8.95,0.0},{9.05,0.0},{9.15,0.0},{9.25,0.0},{9.35,0.0},{9.45,0.0},{9.55,0.0},{9.65,0.0},{9.75,0.0},{9.85,0.0},{9.95,0.0},{10.05,0.0},{10.15,0.0},{10.25,0.0},{10.35,0.0},{10.45,0.0},{10.55,0.0},{10.65,0.0},{10.75,0.0},{10.85,0.0},{10.95,0.0},{11.05,0.0},{11.15,0.0},{11.25,0.0},{11.35,0.0},{11.45,0.0},{11.55,0.0},{11.65,0.0},{11.75,0.0},{11.85,0.0},{11.95,0.0},{12.05,0.0},{12.15,0.0},{12.25,0.0},{12.35,0.0},{12.45,0.0},{12.55,0.0},{12.65,0.0},{12.75,0.0},{12.85,0.0},{12.95,0.0},{13.05,0.0},{13.15,0.0},{13.25,0.0},{13.35,0.0},{13.45,0.0},{13.55,0.0},{13.65,0.0},{13.75,0.0},{13.85,0.0},{13.95,0.0},{14.05,0.0},{14.15,0.0},{14.25,0.0},{14.35,0.0},{14.45,0.0},{14.55,0.0},{14.65,0.0},{14.75,0.0},{14.85,0.0},{14.95,0.0},{15.05,0.0},{15.15,0.0},{15.25,0.0},{15.35,0.0},{15.45,0.0},{15.55,0.0},{15.65,0.0},{15.75,0.0},{15.85,0.0},{15.95,0.0},{16.05,0.0},{16.15,0.0},{16.25,0.0},{16.35,0.0},{16.45,0.0},{16.55,0.0},{16.65,0.0},{16.75,0.0},{16.85,0.0},{16.95,0.0},{17.05,0.0},{17.15,0.0},{17.25,0.0},{17.35,0.0},{17.45,0.0},{17.55,0.0},{17.65,0.0},{17.75,0.0},{17.85,0.0},{17.95,0.0},{18.05,0.0},{18.15,0.0},{18.25,0.0},{18.35,0.0},{18.45,0.0},{18.55,0.0},{18.65,0.0},{18.75,0.0},{18.85,0.0},{18.95,0.0},{19.05,0.0},{19.15,0.0},{19.25,0.0},{19.35,0.0},{19.45,0.0},{19.55,0.0},{19.65,0.0},{19.75,0.0},{19.85,0.0},{19.95,0.0},{20.05,0.0},{20.15,0.0},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.0},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU1 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.0},{-21.35,0.0},{-21.25,0.0},{-21.15,0.0},{-21.05,0.0},{-20.95,0.0},{-20.85,0.0},{-20.75,0.0},{-20.65,0.0},{-20.55,0.0},{-20.45,0.0},{-20.35,0.0},{-20.25,0.0},{-20.15,0.0},{-20.05,0.0},{-19.95,0.0},{-19.85,0.0},{-19.75,0.0},{-19.65,0.0},{-19.55,0.0},{-19.45,0.0},{-19.35,0.0},{-19.25,0.0},{-19.15,0.0},{-19.05,0.0},{-18.95,0.0},{-18.85,0.0},{-18.75,0.0},{-18.65,0.0},{-18.55,0.0},{-18.45,0.0},{-18.35,0.0},{-18.25,0.0},{-18.15,0.0},{-18.05,0.0},{-17.95,0.0},{-17.85,0.0},{-17.75,0.0},{-17.65,0.0},{-17.55,0.0},{-17.45,0.0},{-17.35,0.0},{-17.25,0.0},{-17.15,0.0},{-17.05,0.0},{-16.95,0.0},{-16.85,0.0},{-16.75,0.0},{-16.65,0.0},{-16.55,0.0},{-16.45,0.0},{-16.35,0.0},{-16.25,0.0},{-16.15,0.0},{-16.05,0.0},{-15.95,0.0},{-15.85,0.0},{-15.75,0.0},{-15.65,0.000278344203252},{-15.55,0.0},{-15.45,0.0},{-15.35,0.0},{-15.25,0.0},{-15.15,0.0},{-15.05,0.0},{-14.95,0.0},{-14.85,0.0},{-14.75,0.0},{-14.65,0.0},{-14.55,0.0},{-14.45,0.0},{-14.35,0.0},{-14.25,0.0},{-14.15,0.0},{-14.05,0.0},{-13.95,0.0},{-13.85,0.0},{-13.75,0.0},{-13.65,0.0},{-13.55,0.0},{-13.45,0.0},{-13.35,0.0},{-13.25,0.00278344214894},{-13.15,0.0},{-13.05,0.0},{-12.95,0.0},{-12.85,0.0},{-12.75,0.0},{-12.65,0.0},{-12.55,0.0},{-12.45,0.0},{-12.35,0.0},{-12.25,0.0},{-12.15,0.0},{-12.05,0.0},{-11.95,0.0},{-11.85,0.0},{-11.75,0.0},{-11.65,0.0},{-11.55,0.0},{-11.45,0.0},{-11.35,0.0},{-11.25,0.0108554242179},{-11.15,0.0},{-11.05,0.0},{-10.95,0.0},{-10.85,0.0},{-10.75,0.0},{-10.65,0.0},{-10.55,0.0},{-10.45,0.0203191265464},{-10.35,0.0},{-10.25,0.0},{-10.15,0.0},{-10.05,0.0},{-9.95,0.0},{-9.85,0.0},{-9.75,0.0},{-9.65,0.0},{-9.55,0.0359064042568},{-9.45,0.0},{-9.35,0.0},{-9.25,0.0},{-9.15,0.0},{-9.05,0.0},{-8.95,0.0},{-8.85,0.0},{-8.75,0.0},{-8.65,0.0531637445092},{-8.55,0.0},{-8.45,0.0},{-8.35,0.0},{-8.25,0.0},{-8.15,0.0},{-8.05,0.0},{-7.95,0.0},{-7.85,0.0782147198915},{-7.75,0.0},{-7.65,0.0},{-7.55,0.0},{-7.45,0.0},{-7.35,0.0},{-7.25,0.0},{-7.15,0.0},{-7.05,0.0},{-6.95,0.0},{-6.85,0.0},{-6.75,0.0},{-6.65,0.0},{-6.55,0.136945351958},{-6.45,0.0},{-6.35,0.0},{-6.25,0.0},{-6.15,0.143347263336},{-6.05,0.0},{-5.95,0.0},{-5.85,0.0},{-5.75,0.185377240181},{-5.65,0.0},{-5.55,0.0},{-5.45,0.0},{-5.35,0.0},{-5.25,0.0},{-5.15,0.0},{-5.05,0.0},{-4.95,0.0},{-4.85,0.234644174576},{-4.75,0.0},{-4.65,0.0},{-4.55,0.0},{-4.45,0.0},{-4.35,0.0},{-4.25,0.0},{-4.15,0.0},{-4.05,0.0},{-3.95,0.0},{-3.85,0.0},{-3.75,0.0},{-3.65,0.0},{-3.55,0.356002241373},{-3.45,0.347095221281},{-3.35,0.0},{-3.25,0.0},{-3.15,0.0},{-3.05,0.0},{-2.95,0.0},{-2.85,0.0},{-2.75,0.0},{-2.65,0.0},{-2.55,0.0},{-2.45,0.0},{-2.35,0.0},{-2.25,0.0},{-2.15,0.0},{-2.05,0.443680673838},{-1.95,0.218361034989},{-1.85,0.0},{-1.75,0.0},{-1.65,0.0},{-1.55,0.0},{-1.45,0.0},{-1.35,0.0},{-1.25,0.509926617146},{-1.15,0.0},{-1.05,0.493782639503},{-0.95,0.0},{-0.85,0.0},{-0.75,0.0},{-0.65,0.0},{-0.55,0.25009226799},{-0.45,0.0},{-0.35,0.0},{-0.25,0.0},{-0.15,0.0},{-0.05,0.0},{0.05,0.0},{0.15,0.0},{0.25,0.0},{0.35,0.0},{0.45,0.0},{0.55,0.0},{0.65,0.0},{0.75,0.0},{0.85,0.0},{0.95,0.0},{1.05,0.0},{1.15,0.0},{1.25,0.562811970711},{1.35,0.541657805443},{1.45,0.0},{1.55,0.0},{1.65,0.0},{1.75,0.0},{1.85,0.0},{1.95,0.0},{2.05,0.521338701248},{2.15,0.0},{2.25,0.0},{2.35,0.0},{2.45,0.0},{2.55,0.477081984282},{2.65,0.0},{2.75,0.0},{2.85,0.472350120544},{2.95,0.0},{3.05,0.450082600117},{3.15,0.430041790009},{3.25,0.0},{3.35,0.0},{3.45,0.0},{3.55,0.0},{3.65,0.0},{3.75,0.0},{3.85,0.0},{3.95,0.0},{4.05,0.0},{4.15,0.0},{4.25,0.0},{4.35,0.0},{4.45,0.0},{4.55,0.0},{4.65,0.312023848295},{4.75,0.0},{4.85,0.0},{4.95,0.280849307775},{5.05,0.284467786551},{5.15,0.0},{5.25,0.0},{5.35,0.0},{5.45,0.0},{5.55,0.0},{5.65,0.0},{5.75,0.0},{5.85,0.224623784423},{5.95,0.0},{6.05,0.210706561804},{6.15,0.0},{6.25,0.0},{6.35,0.0},{6.45,0.0},{6.55,0.0},{6.65,0.0},{6.75,0.0},{6.85,0.0},{6.95,0.0},{7.05,0.137780383229},{7.15,0.0},{7.25,0.0},{7.35,0.0},{7.45,0.0},{7.55,0.0},{7.65,0.0},{7.75,0.0},{7.85,0.0},{7.95,0.0},{8.05,0.0},{8.15,0.0},{8.25,0.0},{8.35,0.0},{8.45,0.0},{8.55,0.0},{8.65,0.0},{8.75,0.0},{8.85,0.0},{8.95,0.0},{9.05,0.0},{9.15,0.0},{9.25,0.0},{9.35,0.0},{9.45,0.0},{9.55,0.0},{9.65,0.0},{9.75,0.0},{9.85,0.0},{9.95,0.0},{10.05,0.0},{10.15,0.0},{10.25,0.0},{10.35,0.0},{10.45,0.0},{10.55,0.0},{10.65,0.0},{10.75,0.0},{10.85,0.0},{10.95,0.0},{11.05,0.0},{11.15,0.0},{11.25,0.0},{11.35,0.0},{11.45,0.0},{11.55,0.0},{11.65,0.0},{11.75,0.0},{11.85,0.0},{11.95,0.0},{12.05,0.0},{12.15,0.0},{12.25,0.0},{12.35,0.0},{12.45,0.0},{12.55,0.0},{12.65,0.0},{12.75,0.0},{12.85,0.0},{12.95,0.0},{13.05,0.0},{13.15,0.0},{13.25,0.0},{13.35,0.0},{13.45,0.0},{13.55,0.0},{13.65,0.0},{13.75,0.0},{13.85,0.0},{13.95,0.0},{14.05,0.0},{14.15,0.0},{14.25,0.0},{14.35,0.0},{14.45,0.0},{14.55,0.0},{14.65,0.0},{14.75,0.00167006521951},{14.85,0.0},{14.95,0.0},{15.05,0.0},{15.15,0.0},{15.25,0.0},{15.35,0.0},{15.45,0.0},{15.55,0.0},{15.65,0.0},{15.75,0.0},{15.85,0.0},{15.95,0.0},{16.05,0.0},{16.15,0.0},{16.25,0.0},{16.35,0.0},{16.45,0.0},{16.55,0.0},{16.65,0.0},{16.75,0.0},{16.85,0.0},{16.95,0.0},{17.05,0.0},{17.15,0.0},{17.25,0.0},{17.35,0.0},{17.45,0.0},{17.55,0.0},{17.65,0.0},{17.75,0.0},{17.85,0.0},{17.95,0.0},{18.05,0.0},{18.15,0.0},{18.25,0.0},{18.35,0.0},{18.45,0.0},{18.55,0.0},{18.65,0.0},{18.75,0.0},{18.85,0.0},{18.95,0.0},{19.05,0.0},{19.15,0.0},{19.25,0.0},{19.35,0.0},{19.45,0.0},{19.55,0.0},{19.65,0.0},{19.75,0.0},{19.85,0.0},{19.95,0.0},{20.05,0.0},{20.15,0.0},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.0},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU2 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.0},{-21.35,0.0},{-21.25,0.0},{-21.15,0.0},{-21.05,0.0},{-20.95,0.0},{-20.85,0.0},{-20.75,0.0},{-20.65,0.0},{-20.55,0.0},{-20.45,0.0},{-20.35,0.0},{-20.25,0.0},{-20.15,0.0},{-20.05,0.0},{-19.95,0.0},{-19.85,0.0},{-19.75,0.0},{-19.65,0.0},{-19.55,0.0},{-19.45,0.0},{-19.35,0.0},{-19.25,0.0},{-19.15,0.0},{-19.05,0.0},{-18.95,0.0},{-18.85,0.0},{-18.75,0.0},{-18.65,0.0},{-18.55,0.0},{-18.45,0.0},{-18.35,0.0},{-18.25,0.0},{-18.15,0.0},{-18.05,0.0},{-17.95,0.0},{-17.85,0.0},{-17.75,0.0},{-17.65,0.0},{-17.55,0.0},{-17.45,0.000278344203252},{-17.35,0.0},{-17.25,0.0},{-17.15,0.0},{-17.05,0.0},{-16.95,0.0},{-16.85,0.0},{-16.75,0.0},{-16.65,0.0},{-16.55,0.0},{-16.45,0.0},{-16.35,0.0},{-16.25,0.0},{-16.15,0.0},{-16.05,0.0},{-15.95,0.0},{-15.85,0.0},{-15.75,0.0},{-15.65,0.0},{-15.55,0.0},{-15.45,0.0},{-15.35,0.0},{-15.25,0.0},{-15.15,0.0},{-15.05,0.0},{-14.95,0.0},{-14.85,0.0},{-14.75,0.0},{-14.65,0.0},{-14.55,0.0},{-14.45,0.0},{-14.35,0.0},{-14.25,0.0},{-14.15,0.0},{-14.05,0.0},{-13.95,0.0},{-13.85,0.0},{-13.75,0.0},{-13.65,0.0},{-13.55,0.0},{-13.45,0.0},{-13.35,0.0},{-13.25,0.0},{-13.15,0.0},{-13.05,0.0},{-12.95,0.0},{-12.85,0.0},{-12.75,0.00793281011283},{-12.65,0.0247726347297},{-12.55,0.0},{-12.45,0.0},{-12.35,0.0258860122412},{-12.25,0.0},{-12.15,0.0},{-12.05,0.0},{-11.95,0.0},{-11.85,0.0},{-11.75,0.0},{-11.65,0.0409165993333},{-11.55,0.0417516306043},{-11.45,0.0501019582152},{-11.35,0.0},{-11.25,0.0},{-11.15,0.0},{-11.05,0.0},{-10.95,0.0665242671967},{-10.85,0.0665242671967},{-10.75,0.0},{-10.65,0.0},{-10.55,0.0790497586131},{-10.45,0.0},{-10.35,0.0940803438425},{-10.25,0.0949153751135},{-10.15,0.102430671453},{-10.05,0.0},{-9.95,0.0},{-9.85,0.0},{-9.75,0.0},{-9.65,0.0},{-9.55,0.0},{-9.45,0.150862559676},{-9.35,0.0},{-9.25,0.0},{-9.15,0.089209318161},{-9.05,0.0},{-8.95,0.0},{-8.85,0.0},{-8.75,0.205696374178},{-8.65,0.219335243106},{-8.55,0.227407217026},{-8.45,0.0},{-8.35,0.0},{-8.25,0.0},{-8.15,0.253293246031},{-8.05,0.148357465863},{-7.95,0.136249497533},{-7.85,0.0},{-7.75,0.305900275707},{-7.65,0.0},{-7.55,0.171599209309},{-7.45,0.340414971113},{-7.35,0.368249386549},{-7.25,0.0},{-7.15,0.0},{-7.05,0.0},{-6.95,0.0},{-6.85,0.43811377883},{-6.75,0.43755710125},{-6.65,0.0},{-6.55,0.50853484869},{-6.45,0.520225346088},{-6.35,0.527462303638},{-6.25,0.26999387145},{-6.15,0.580626010895},{-6.05,0.0},{-5.95,0.624326050282},{-5.85,0.0},{-5.75,0.328028649092},{-5.65,0.312719732523},{-5.55,0.0},{-5.45,0.701427400112},{-5.35,0.361708313227},{-5.25,0.36908441782},{-5.15,0.0},{-5.05,0.782147228718},{-4.95,0.415011227131},{-4.85,0.436582893133},{-4.75,0.875949203968},{-4.65,0.0},{-4.55,0.454953610897},{-4.45,0.482648849487},{-4.35,0.955277323723},{-4.25,0.0},{-4.15,1.00621426105},{-4.05,0.338188211123},{-3.95,0.552791595459},{-3.85,0.564064562321},{-3.75,0.227685570717},{-3.65,1.14705646038},{-3.55,1.19047820568},{-3.45,1.21719920635},{-3.35,1.22582793236},{-3.25,1.25254893303},{-3.15,0.434031407038},{-3.05,0.663850963116},{-2.95,0.0},{-2.85,0.0},{-2.75,0.716179668903},{-2.65,0.0},{-2.55,1.45156502724},{-2.45,1.45072996616},{-2.35,0.50909157594},{-2.25,0.777832865715},{-2.15,0.51373064518},{-2.05,1.6057677269},{-1.95,0.795786082745},{-1.85,1.66004490852},{-1.75,1.63415884972},{-1.65,1.67618882656},{-1.55,1.69706463814},{-1.45,1.73798120022},{-1.35,0.0},{-1.25,0.588048537572},{-1.15,0.444933205843},{-1.05,0.434008210897},{-0.95,0.0},{-0.85,0.608924349149},{-0.75,0.901278555393},{-0.65,1.84653544426},{-0.55,1.81563925743},{-0.45,1.84347367287},{-0.35,0.473324328661},{-0.25,1.87910175323},{-0.15,1.89357566833},{-0.05,0.651789347331},{0.05,1.87993681431},{0.15,0.953607261181},{0.25,0.388067507744},{0.35,1.87548327446},{0.45,0.979632437229},{0.55,1.89190554619},{0.65,0.950267136097},{0.75,0.942334294319},{0.85,0.0},{0.95,0.0},{1.05,0.0},{1.15,1.87409162521},{1.25,1.84347367287},{1.35,0.0},{1.45,1.79142332077},{1.55,0.898773431778},{1.65,1.75496029854},{1.75,0.587584614754},{1.85,1.75356853008},{1.95,0.349990010262},{2.05,0.866624712944},{2.15,0.83809441328},{2.25,0.841991245747},{2.35,0.832945048809},{2.45,0.0},{2.55,1.67730224133},{2.65,0.0},{2.75,1.61523139477},{2.85,0.773657739162},{2.95,0.755426168442},{3.05,0.0},{3.15,1.48079121113},{3.25,0.0},{3.35,0.705185055733},{3.45,0.0},{3.55,1.38253569603},{3.65,1.33020699024},{3.75,0.0},{3.85,0.0},{3.95,0.0},{4.05,1.2416934967},{4.15,1.20383870602},{4.25,0.587723791599},{4.35,0.0},{4.45,0.381888270378},{4.55,0.0},{4.65,0.0},{4.75,0.0},{4.85,1.0282034874},{4.95,0.0},{5.05,0.497540265322},{5.15,0.957782447338},{5.25,0.92215436697},{5.35,0.889309763908},{5.45,0.0},{5.55,0.0},{5.65,0.0},{5.75,0.398032218218},{5.85,0.770735144615},{5.95,0.752086043358},{6.05,0.0},{6.15,0.667747735977},{6.25,0.694190442562},{6.35,0.666077673435},{6.45,0.645480215549},{6.55,0.630171298981},{6.65,0.579234302044},{6.75,0.588976323605},{6.85,0.550008177757},{6.95,0.540822803974},{7.05,0.526905596256},{7.15,0.0},{7.25,0.51577180624},{7.35,0.475690245628},{7.45,0.437278747559},{7.55,0.0},{7.65,0.417794644833},{7.75,0.0},{7.85,0.0},{7.95,0.0},{8.05,0.340971648693},{8.15,0.0},{8.25,0.0},{8.35,0.310632139444},{8.45,0.150723382831},{8.55,0.28502446413},{8.65,0.0},{8.75,0.0},{8.85,0.266097068787},{8.95,0.0},{9.05,0.0},{9.15,0.0},{9.25,0.0},{9.35,0.211819946766},{9.45,0.0},{9.55,0.0},{9.65,0.0},{9.75,0.0},{9.85,0.169511631131},{9.95,0.0},{10.05,0.0},{10.15,0.0},{10.25,0.0},{10.35,0.0},{10.45,0.0},{10.55,0.0},{10.65,0.0},{10.75,0.0},{10.85,0.0},{10.95,0.0},{11.05,0.0},{11.15,0.0},{11.25,0.0},{11.35,0.0},{11.45,0.0},{11.55,0.0},{11.65,0.0},{11.75,0.0},{11.85,0.0},{11.95,0.0},{12.05,0.0},{12.15,0.0},{12.25,0.0},{12.35,0.0},{12.45,0.0},{12.55,0.0322879292071},{12.65,0.0},{12.75,0.0},{12.85,0.0},{12.95,0.0},{13.05,0.0},{13.15,0.0},{13.25,0.0},{13.35,0.0194840952754},{13.45,0.0},{13.55,0.0},{13.65,0.0},{13.75,0.0},{13.85,0.0},{13.95,0.0},{14.05,0.0},{14.15,0.0},{14.25,0.0},{14.35,0.0},{14.45,0.0},{14.55,0.0},{14.65,0.0},{14.75,0.0},{14.85,0.00528853992},{14.95,0.0},{15.05,0.0},{15.15,0.0},{15.25,0.0},{15.35,0.0},{15.45,0.0},{15.55,0.0},{15.65,0.0},{15.75,0.0},{15.85,0.0},{15.95,0.0},{16.05,0.0},{16.15,0.0},{16.25,0.0},{16.35,0.0},{16.45,0.0},{16.55,0.0},{16.65,0.0},{16.75,0.0},{16.85,0.0},{16.95,0.0},{17.05,0.0},{17.15,0.0},{17.25,0.0},{17.35,0.0},{17.45,0.0},{17.55,0.0},{17.65,0.0},{17.75,0.0},{17.85,0.0},{17.95,0.0},{18.05,0.0},{18.15,0.0},{18.25,0.0},{18.35,0.0},{18.45,0.0},{18.55,0.0},{18.65,0.0},{18.75,0.0},{18.85,0.0},{18.95,0.0},{19.05,0.0},{19.15,0.0},{19.25,0.0},{19.35,0.0},{19.45,0.0},{19.55,0.0},{19.65,0.0},{19.75,0.0},{19.85,0.0},{19.95,0.0},{20.05,0.0},{20.15,0.0},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.0},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU3 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.0},{-21.35,0.0},{-21.25,0.0},{-21.15,0.0},{-21.05,0.0},{-20.95,0.0},{-20.85,0.0},{-20.75,0.0},{-20.65,0.0},{-20.55,0.0},{-20.45,0.0},{-20.35,0.0},{-20.25,0.0},{-20.15,0.0},{-20.05,0.0},{-19.95,0.0},{-19.85,0.0},{-19.75,0.0},{-19.65,0.0},{-19.55,0.0},{-19.45,0.0},{-19.35,0.0},{-19.25,0.0},{-19.15,0.0},{-19.05,0.0},{-18.95,0.0},{-18.85,0.0},{-18.75,0.0},{-18.65,0.0},{-18.55,0.0},{-18.45,0.0},{-18.35,0.0},{-18.25,0.0},{-18.15,0.0},{-18.05,0.0},{-17.95,0.0},{-17.85,0.0},{-17.75,0.000278344203252},{-17.65,0.0},{-17.55,0.0},{-17.45,0.0},{-17.35,0.000278344203252},{-17.25,0.0},{-17.15,0.0},{-17.05,0.0},{-16.95,0.00139172107447},{-16.85,0.0},{-16.75,0.0},{-16.65,0.0},{-16.55,0.0},{-16.45,0.0},{-16.35,0.0},{-16.25,0.0},{-16.15,0.0},{-16.05,0.0},{-15.95,0.00473185162991},{-15.85,0.0},{-15.75,0.0},{-15.65,0.0},{-15.55,0.0},{-15.45,0.0},{-15.35,0.0},{-15.25,0.0},{-15.15,0.0},{-15.05,0.0},{-14.95,0.0},{-14.85,0.0},{-14.75,0.0},{-14.65,0.00570605648682},{-14.55,0.0},{-14.45,0.0},{-14.35,0.0},{-14.25,0.0},{-14.15,0.0},{-14.05,0.0194840952754},{-13.95,0.0},{-13.85,0.0203191265464},{-13.75,0.0129430061206},{-13.65,0.0},{-13.55,0.0143347270787},{-13.45,0.0247726347297},{-13.35,0.0203191265464},{-13.25,0.0356280580163},{-13.15,0.0},{-13.05,0.0},{-12.95,0.0144738989572},{-12.85,0.0489885807037},{-12.75,0.0406382530928},{-12.65,0.0},{-12.55,0.0190201873581},{-12.45,0.0},{-12.35,0.0},{-12.25,0.0},{-12.15,0.0},{-12.05,0.0},{-11.95,0.0988121926785},{-11.85,0.0},{-11.75,0.0988121926785},{-11.65,0.0501019582152},{-11.55,0.0617924146354},{-11.45,0.0},{-11.35,0.0},{-11.25,0.127203300595},{-11.15,0.138058722019},{-11.05,0.0363935045898},{-10.95,0.0771013498306},{-10.85,0.0},{-10.75,0.181202083826},{-10.65,0.0},{-10.55,0.106605835259},{-10.45,0.113842785358},{-10.35,0.0546250529587},{-10.25,0.0},{-10.15,0.128873363137},{-10.05,0.130265086889},{-9.95,0.152254283428},{-9.85,0.0},{-9.75,0.108368674914},{-9.65,0.0},{-9.55,0.378548115492},{-9.45,0.385785073042},{-9.35,0.220726951957},{-9.25,0.45314437151},{-9.15,0.151790380478},{-9.05,0.233948305249},{-8.95,0.271385610104},{-8.85,0.176563004653},{-8.75,0.112172710896},{-8.65,0.303673535585},{-8.55,0.204397439957},{-8.45,0.344033449888},{-8.35,0.235293646653},{-8.25,0.241138875484},{-8.15,0.194632187486},{-8.05,0.785765707493},{-7.95,0.848114788532},{-7.85,0.864815473557},{-7.75,0.155316064755},{-7.65,0.158563415209},{-7.55,1.03989398479},{-7.45,0.264287829399},{-7.35,0.0},{-7.25,0.242048120499},{-7.15,0.303743124008},{-7.05,0.318982452154},{-6.95,0.322253018618},{-6.85,0.47132953008},{-6.75,1.44683325291},{-6.65,0.0},{-6.55,0.797177791595},{-6.45,0.230349711009},{-6.35,0.284978071849},{-6.25,0.591852585475},{-6.15,1.83874189854},{-6.05,0.976849019527},{-5.95,2.01409864426},{-5.85,0.667376597722},{-5.75,0.535882174969},{-5.65,0.552791595459},{-5.55,0.461773061752},{-5.45,0.33810867582},{-5.35,0.304125845432},{-5.25,0.64311426878},{-5.15,1.33772230148},{-5.05,0.387614182064},{-4.95,0.281183314323},{-4.85,0.488354921341},{-4.75,0.42085644177},{-4.65,0.345641665988},{-4.55,0.459546293531},{-4.45,0.653496551514},{-4.35,0.311517780477},{-4.25,0.902461528778},{-4.15,0.720967149734},{-4.05,0.528376851763},{-3.95,0.935514867306},{-3.85,0.785209035873},{-3.75,1.35934034983},{-3.65,0.518102943897},{-3.55,0.540092170238},{-3.45,0.545867800713},{-3.35,0.446018743515},{-3.25,0.560063362122},{-3.15,0.521091302236},{-3.05,0.267798052894},{-2.95,1.23897969723},{-2.85,1.24371147156},{-2.75,1.30446016788},{-2.65,0.348746744792},{-2.55,0.66186773777},{-2.45,0.610316064623},{-2.35,1.40034973621},{-2.25,1.13826084137},{-2.15,0.964601834615},{-2.05,1.17884340286},{-1.95,0.649809996287},{-1.85,1.51948106289},{-1.75,1.2192032814},{-1.65,1.23707304001},{-1.55,3.15322232246},{-1.45,0.525351484617},{-1.35,0.920524052211},{-1.25,0.730591721005},{-1.15,0.838929474354},{-1.05,0.836111187935},{-0.95,0.753075705634},{-0.85,2.27017529806},{-0.75,0.767147594028},{-0.65,0.987326690129},{-0.55,1.14835540454},{-0.45,0.696751213074},{-0.35,1.1696023941},{-0.25,0.642038865523},{-0.15,1.19892128309},{-0.05,0.649756604975},{0.05,2.40229606628},{0.15,0.891710460186},{0.25,0.9022179842},{0.35,1.19061732292},{0.45,0.789074897766},{0.55,0.546175589928},{0.65,0.793559339311},{0.75,0.705073738098},{0.85,1.02140399388},{0.95,1.40530424118},{1.05,1.00303322928},{1.15,0.871808886528},{1.25,1.36644735336},{1.35,1.69943058491},{1.45,1.1170416673},{1.55,1.11903651555},{1.65,0.654303741455},{1.75,0.667163228989},{1.85,1.60138380527},{1.95,1.29123878479},{2.05,0.7934897542},{2.15,0.628751754761},{2.25,3.0498175621},{2.35,0.683118555281},{2.45,1.19893989563},{2.55,1.47035324574},{2.65,0.723868906498},{2.75,1.4409879446},{2.85,1.39172101021},{2.95,0.690885126591},{3.05,0.775864601135},{3.15,2.66110992432},{3.25,1.03482809067},{3.35,0.627596616745},{3.45,1.22972476482},{3.55,1.21511161327},{3.65,2.38777589798},{3.75,1.54991340637},{3.85,2.22424864769},{3.95,1.47643041611},{4.05,0.873165798187},{4.15,0.701195478439},{4.25,2.04917001724},{4.35,0.678000132243},{4.45,1.28678528468},{4.55,1.24902327855},{4.65,0.399980624517},{4.75,1.19140601158},{4.85,1.1638499101},{4.95,3.42307710648},{5.05,3.32593488693},{5.15,0.529642621676},{5.25,1.02773960431},{5.35,0.0},{5.45,0.710821509361},{5.55,2.78678226471},{5.65,2.69966053963},{5.75,0.651882112026},{5.85,1.24920880795},{5.95,0.415939013163},{6.05,0.781961679459},{6.15,2.24456763268},{6.25,0.361197988192},{6.35,0.353543519974},{6.45,0.682685534159},{6.55,0.63314028581},{6.65,0.933288156986},{6.75,0.885552108288},{6.85,1.73269271851},{6.95,0.330060553551},{7.05,0.780198812485},{7.15,1.53562498093},{7.25,1.43653452396},{7.35,0.466041008631},{7.45,0.341528356075},{7.55,1.27592980862},{7.65,1.22805464268},{7.75,0.282380193472},{7.85,0.366022626559},{7.95,0.357022841771},{8.05,0.346724112829},{8.15,0.0},{8.25,0.305621941884},{8.35,0.443819850683},{8.45,0.430876851082},{8.55,0.167117857933},{8.65,0.381331562996},{8.75,0.0},{8.85,0.0},{8.95,0.656335651875},{9.05,0.155316069722},{9.15,0.637408256531},{9.25,0.563368678093},{9.35,0.0},{9.45,0.54694634676},{9.55,0.16440864404},{9.65,0.478473693132},{9.75,0.438392132521},{9.85,0.417794644833},{9.95,0.0},{10.05,0.352662116289},{10.15,0.364352583885},{10.25,0.0},{10.35,0.157960340381},{10.45,0.0},{10.55,0.0},{10.65,0.0},{10.75,0.0},{10.85,0.118713803589},{10.95,0.0},{11.05,0.220170274377},{11.15,0.0},{11.25,0.0},{11.35,0.164223089814},{11.45,0.0},{11.55,0.141677200794},{11.65,0.0},{11.75,0.0},{11.85,0.129151716828},{11.95,0.0},{12.05,0.117182910442},{12.15,0.0},{12.25,0.0},{12.35,0.0985338538885},{12.45,0.0},{12.55,0.0759879723191},{12.65,0.0336796492338},{12.75,0.0},{12.85,0.0},{12.95,0.0307570360601},{13.05,0.0},{13.15,0.0},{13.25,0.0},{13.35,0.0},{13.45,0.0},{13.55,0.0},{13.65,0.0},{13.75,0.0},{13.85,0.0},{13.95,0.0},{14.05,0.0},{14.15,0.0},{14.25,0.0},{14.35,0.0},{14.45,0.0},{14.55,0.0},{14.65,0.0},{14.75,0.0},{14.85,0.0},{14.95,0.0},{15.05,0.0},{15.15,0.0},{15.25,0.0},{15.35,0.0},{15.45,0.0},{15.55,0.0},{15.65,0.0},{15.75,0.0},{15.85,0.0},{15.95,0.0},{16.05,0.0},{16.15,0.0},{16.25,0.0},{16.35,0.0},{16.45,0.0},{16.55,0.0},{16.65,0.0},{16.75,0.0},{16.85,0.0},{16.95,0.000835032609757},{17.05,0.0},{17.15,0.0},{17.25,0.0},{17.35,0.0},{17.45,0.0},{17.55,0.0},{17.65,0.0},{17.75,0.0},{17.85,0.0},{17.95,0.0},{18.05,0.0},{18.15,0.0},{18.25,0.0},{18.35,0.0},{18.45,0.0},{18.55,0.0},{18.65,0.0},{18.75,0.0},{18.85,0.0},{18.95,0.0},{19.05,0.0},{19.15,0.0},{19.25,0.0},{19.35,0.0},{19.45,0.0},{19.55,0.0},{19.65,0.0},{19.75,0.0},{19.85,0.0},{19.95,0.0},{20.05,0.0},{20.15,0.0},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.0},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU4 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.0},{-21.35,0.0},{-21.25,0.0},{-21.15,0.0},{-21.05,0.0},{-20.95,0.0},{-20.85,0.0},{-20.75,0.0},{-20.65,0.0},{-20.55,0.0},{-20.45,0.0},{-20.35,0.0},{-20.25,0.0},{-20.15,0.0},{-20.05,0.0},{-19.95,0.0},{-19.85,0.0},{-19.75,0.0},{-19.65,0.0},{-19.55,0.0},{-19.45,0.0},{-19.35,0.0},{-19.25,0.0},{-19.15,0.000835032609757},{-19.05,0.0},{-18.95,0.0},{-18.85,0.0},{-18.75,0.0},{-18.65,0.0},{-18.55,0.0},{-18.45,0.000556688406505},{-18.35,0.0},{-18.25,0.00111337681301},{-18.15,0.0},{-18.05,0.0},{-17.95,0.0},{-17.85,0.0},{-17.75,0.0},{-17.65,0.0},{-17.55,0.0},{-17.45,0.0},{-17.35,0.0},{-17.25,0.0},{-17.15,0.0},{-17.05,0.0},{-16.95,0.0},{-16.85,0.0},{-16.75,0.0},{-16.65,0.0},{-16.55,0.0},{-16.45,0.00306178629398},{-16.35,0.0},{-16.25,0.00167006533593},{-16.15,0.0},{-16.05,0.00501019600779},{-15.95,0.00445350725204},{-15.85,0.00835032667965},{-15.75,0.0},{-15.65,0.0},{-15.55,0.0},{-15.45,0.0114121129736},{-15.35,0.0},{-15.25,0.0147522427142},{-15.15,0.0},{-15.05,0.0116904564202},{-14.95,0.0},{-14.85,0.0144738992676},{-14.75,0.0},{-14.65,0.0},{-14.55,0.00890701450408},{-14.45,0.0},{-14.35,0.0278344210237},{-14.25,0.0},{-14.15,0.0},{-14.05,0.0347930267453},{-13.95,0.039246533066},{-13.85,0.0},{-13.75,0.0},{-13.65,0.0464834831655},{-13.55,0.0240767747164},{-13.45,0.0587306283414},{-13.35,0.0121358074248},{-13.25,0.0757096260786},{-13.15,0.0},{-13.05,0.015364600718},{-12.95,0.0294117058317},{-12.85,0.0840599536896},{-12.75,0.101873978972},{-12.65,0.0},{-12.55,0.0627666190267},{-12.45,0.0437000393867},{-12.35,0.0641583427787},{-12.25,0.0733437016606},{-12.15,0.135553628206},{-12.05,0.149192497134},{-11.95,0.06142129004},{-11.85,0.194284260273},{-11.75,0.101595640182},{-11.65,0.112590231001},{-11.55,0.0805342594783},{-11.45,0.0472628474236},{-11.35,0.0957504113515},{-11.25,0.0755704566836},{-11.15,0.101873983939},{-11.05,0.0871217399836},{-10.95,0.0704210877419},{-10.85,0.0540783022131},{-10.75,0.107232108712},{-10.65,0.0570605620742},{-10.55,0.151512026787},{-10.45,0.252179861069},{-10.35,0.0669765770435},{-10.25,0.0840201888766},{-10.15,0.1078119874},{-10.05,0.0965854440417},{-9.95,0.179532021284},{-9.85,0.0842145880063},{-9.75,0.0821672081947},{-9.65,0.0674449434647},{-9.55,0.186768960953},{-9.45,0.144341349602},{-9.35,0.208368468285},{-9.25,0.233029770851},{-9.15,0.20189233621},{-9.05,0.255798339844},{-8.95,0.197385804994},{-8.85,0.10380251067},{-8.75,0.091804469333},{-8.65,0.182995849186},{-8.55,0.215786352754},{-8.45,0.309286812941},{-8.35,0.201409864426},{-8.25,0.185326641256},{-8.15,0.309001820428},{-8.05,0.230691671371},{-7.95,0.396083792051},{-7.85,0.26164355278},{-7.75,0.127720231102},{-7.65,0.182454630733},{-7.55,0.250509798527},{-7.45,0.268091857433},{-7.35,0.263227976285},{-7.25,0.252120205334},{-7.15,0.408423741659},{-7.05,0.259880717595},{-6.95,0.22799483935},{-6.85,0.254799562342},{-6.75,0.374836881955},{-6.65,0.530307557848},{-6.55,0.272498978509},{-6.45,0.430296937625},{-6.35,0.908933003743},{-6.25,0.259125817906},{-6.15,0.424713509423},{-6.05,0.514449675878},{-5.95,0.432880910238},{-5.85,0.306305148385},{-5.75,0.438774853945},{-5.65,0.48791885376},{-5.55,0.70140210065},{-5.45,0.493486881256},{-5.35,0.511857628822},{-5.25,0.957596884833},{-5.15,0.494184705946},{-5.05,0.272736381082},{-4.95,0.743585879986},{-4.85,0.769728807303},{-4.75,0.642453253269},{-4.65,0.566782047874},{-4.55,0.480325284212},{-4.45,0.421732725921},{-4.35,0.790423329671},{-4.25,0.675989839766},{-4.15,0.659836919684},{-4.05,0.618401300339},{-3.95,0.639038540068},{-3.85,0.549763221741},{-3.75,0.592513640722},{-3.65,0.661067485809},{-3.55,0.835542943743},{-3.45,0.644946734111},{-3.35,0.631162185669},{-3.25,0.74087637121},{-3.15,0.973287806791},{-3.05,0.951519648234},{-2.95,0.762469499008},{-2.85,0.714142150879},{-2.75,0.793886101764},{-2.65,0.718470646785},{-2.55,0.758254165649},{-2.45,1.49864798326},{-2.35,0.738240983751},{-2.25,1.07695770264},{-2.15,1.21277842802},{-2.05,0.775013393826},{-1.95,1.13595199585},{-1.85,0.6448580237},{-1.75,0.965793858404},{-1.65,1.0193977356},{-1.55,0.918958969116},{-1.45,1.55702044169},{-1.35,0.840350968497},{-1.25,1.13637333825},{-1.15,0.669719378153},{-1.05,1.28023689672},{-0.95,0.822423617045},{-0.85,1.24254245758},{-0.75,0.927411962439},{-0.65,1.10029469366},{-0.55,0.978048031147},{-0.45,0.586104349657},{-0.35,0.862069129944},{-0.25,0.764906266156},{-0.15,0.958823663217},{-0.05,1.30135660172},{0.05,1.08916091919},{0.15,0.90274705558},{0.25,1.29992313385},{0.35,1.00411605835},{0.45,1.30917806625},{0.55,1.53393857619},{0.65,1.23625918797},{0.75,0.702262466018},{0.85,1.6116130352},{0.95,0.781253178914},{1.05,1.80094664437},{1.15,0.982833422147},{1.25,0.924989347105},{1.35,0.884359223502},{1.45,1.17705136254},{1.55,1.15954217457},{1.65,1.26527956912},{1.75,1.13657215663},{1.85,1.24330500553},{1.95,0.830777917589},{2.05,0.991534689198},{2.15,1.08201671782},{2.25,1.0199544213},{2.35,0.815919664171},{2.45,0.983187675476},{2.55,0.962919148532},{2.65,0.907184269117},{2.75,1.36004549662},{2.85,1.54742255578},{2.95,1.15740439471},{3.05,0.959341144562},{3.15,0.989689475612},{3.25,1.02532725864},{3.35,0.896936416626},{3.45,1.03304997612},{3.55,1.01631658217},{3.65,1.03888499737},{3.75,0.899562093947},{3.85,1.59109897614},{3.95,1.28543996811},{4.05,1.15395083794},{4.15,1.6263961792},{4.25,0.795832475026},{4.35,0.921282196045},{4.45,0.891091156006},{4.55,0.807720124722},{4.65,1.05218752225},{4.75,0.874776227134},{4.85,1.18507833481},{4.95,0.75787563324},{5.05,0.734290568034},{5.15,0.65995413065},{5.25,0.85999083519},{5.35,1.24698209763},{5.45,0.687808445522},{5.55,0.662936414991},{5.65,0.58964436849},{5.75,0.5657995224},{5.85,0.931556171841},{5.95,1.30088806152},{6.05,0.5443816185},{6.15,0.734327697754},{6.25,0.642823305997},{6.35,0.566476861636},{6.45,0.798082411289},{6.55,0.619371557236},{6.65,0.732462763786},{6.75,0.802665165492},{6.85,0.535367250443},{6.95,0.858552694321},{7.05,0.982388019562},{7.15,0.52059645123},{7.25,0.635181495122},{7.35,0.852679634094},{7.45,0.576649665833},{7.55,3.87427306175},{7.65,0.616578817368},{7.75,1.16050982475},{7.85,0.672089910507},{7.95,0.391699880362},{8.05,0.268121394244},{8.15,0.704210877419},{8.25,0.444237351418},{8.35,0.354610511235},{8.45,0.811373392741},{8.55,0.448857879639},{8.65,0.349785884221},{8.75,0.330533742905},{8.85,0.637964924177},{8.95,0.355612564087},{9.05,1.64473593235},{9.15,0.51465845108},{9.25,0.755565345287},{9.35,0.461030801137},{9.45,0.685840129852},{9.55,0.62752699852},{9.65,1.17127239704},{9.75,0.373074014982},{9.85,0.258790522814},{9.95,0.0},{10.05,0.0},{10.15,0.835032641888},{10.25,0.401094019413},{10.35,0.255148867766},{10.45,0.224252661069},{10.55,0.220819731553},{10.65,0.150445044041},{10.75,0.57589417696},{10.85,0.169418851535},{10.95,0.255102455616},{11.05,0.466783225536},{11.15,0.110015548766},{11.25,0.39135196805},{11.35,0.190387442708},{11.45,0.348765283823},{11.55,0.177583605051},{11.65,0.0},{11.75,0.140563830733},{11.85,0.0},{11.95,0.0},{12.05,0.0801631311576},{12.15,0.205974712968},{12.25,0.207923129201},{12.35,0.178140297532},{12.45,0.159212887287},{12.55,0.0},{12.65,0.148079127073},{12.75,0.136667013168},{12.85,0.13054344058},{12.95,0.0},{13.05,0.108554244041},{13.15,0.0},{13.25,0.0334013054768},{13.35,0.0843382924795},{13.45,0.0},{13.55,0.0706994310021},{13.65,0.0651325434446},{13.75,0.0},{13.85,0.0659675747156},{13.95,0.0},{14.05,0.0},{14.15,0.0},{14.25,0.0442567281425},{14.35,0.0},{14.45,0.0350713692605},{14.55,0.0},{14.65,0.0},{14.75,0.0334013067186},{14.85,0.0},{14.95,0.0},{15.05,0.0},{15.15,0.0208758153021},{15.25,0.0},{15.35,0.0},{15.45,0.0},{15.55,0.0},{15.65,0.0},{15.75,0.0},{15.85,0.0},{15.95,0.0114121129736},{16.05,0.0},{16.15,0.0111337685958},{16.25,0.00695860525593},{16.35,0.0},{16.45,0.0},{16.55,0.0},{16.65,0.0},{16.75,0.0},{16.85,0.0},{16.95,0.0},{17.05,0.0},{17.15,0.0},{17.25,0.0},{17.35,0.0},{17.45,0.0},{17.55,0.0},{17.65,0.0},{17.75,0.0},{17.85,0.0},{17.95,0.0},{18.05,0.0},{18.15,0.0},{18.25,0.0},{18.35,0.0},{18.45,0.0},{18.55,0.0},{18.65,0.0},{18.75,0.0},{18.85,0.0},{18.95,0.0},{19.05,0.0},{19.15,0.0},{19.25,0.0},{19.35,0.0},{19.45,0.0},{19.55,0.0},{19.65,0.0},{19.75,0.0},{19.85,0.0},{19.95,0.0},{20.05,0.0},{20.15,0.0},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.0},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU5 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.0},{-21.35,0.0},{-21.25,0.0},{-21.15,0.0},{-21.05,0.0},{-20.95,0.0},{-20.85,0.0},{-20.75,0.0},{-20.65,0.0},{-20.55,0.0},{-20.45,0.0},{-20.35,0.0},{-20.25,0.0},{-20.15,0.0},{-20.05,0.0},{-19.95,0.0},{-19.85,0.0},{-19.75,0.0},{-19.65,0.0},{-19.55,0.0},{-19.45,0.0},{-19.35,0.0},{-19.25,0.0},{-19.15,0.000835032609757},{-19.05,0.0},{-18.95,0.0},{-18.85,0.0},{-18.75,0.0},{-18.65,0.0},{-18.55,0.0},{-18.45,0.0},{-18.35,0.0},{-18.25,0.0},{-18.15,0.0},{-18.05,0.0},{-17.95,0.000417516304879},{-17.85,0.000556688406505},{-17.75,0.00306178629398},{-17.65,0.00111337681301},{-17.55,0.0},{-17.45,0.0},{-17.35,0.0},{-17.25,0.0},{-17.15,0.0},{-17.05,0.0},{-16.95,0.0},{-16.85,0.0},{-16.75,0.0},{-16.65,0.0},{-16.55,0.00208758166991},{-16.45,0.00473185162991},{-16.35,0.0},{-16.25,0.0116904564202},{-16.15,0.00668026087806},{-16.05,0.0},{-15.95,0.00306178629398},{-15.85,0.0128038339317},{-15.75,0.00417516333982},{-15.65,0.0125254895538},{-15.55,0.0100203920156},{-15.45,0.0},{-15.35,0.0},{-15.25,0.00853588928779},{-15.15,0.00821115449071},{-15.05,0.0219891928136},{-14.95,0.0},{-14.85,0.0070281913504},{-14.75,0.00899979596337},{-14.65,0.0345146805048},{-14.55,0.0178140290082},{-14.45,0.0207366440445},{-14.35,0.0526070557535},{-14.25,0.0243551190943},{-14.15,0.00862867074708},{-14.05,0.0158656202257},{-13.95,0.0116904564202},{-13.85,0.0342363379896},{-13.75,0.0227314432462},{-13.65,0.0232417415828},{-13.55,0.0180367052555},{-13.45,0.0},{-13.35,0.121636420488},{-13.25,0.0197160479923},{-13.15,0.0194045688425},{-13.05,0.0229170074066},{-12.95,0.0297271609306},{-12.85,0.0255679041147},{-12.75,0.0272777335984},{-12.65,0.017636901953},{-12.55,0.030021412032},{-12.45,0.0425866643588},{-12.35,0.0379475951195},{-12.25,0.0236086493189},{-12.15,0.0273030373183},{-12.05,0.029959957708},{-11.95,0.0369888544083},{-11.85,0.0534023259367},{-11.75,0.078994089365},{-11.65,0.044535073638},{-11.55,0.0691884160042},{-11.45,0.0578337444199},{-11.35,0.0826284629958},{-11.25,0.0689056581921},{-11.15,0.0421343557537},{-11.05,0.0604702780644},{-10.95,0.0879876944754},{-10.85,0.0962761706776},{-10.75,0.0647349102157},{-10.65,0.071514580931},{-10.55,0.082625407439},{-10.45,0.0745614543557},{-10.35,0.0666268122824},{-10.25,0.0767766104804},{-10.15,0.098663743337},{-10.05,0.107403755188},{-9.95,0.24561888831},{-9.85,0.123844615618},{-9.75,0.100691020489},{-9.65,0.124861941618},{-9.55,0.12745071782},{-9.45,0.15068860352},{-9.35,0.222884118557},{-9.25,0.17034665276},{-9.15,0.15886129831},{-9.05,0.147395914251},{-8.95,0.190217336019},{-8.85,0.248060353597},{-8.75,0.178747588938},{-8.65,0.261347830296},{-8.55,0.227073216438},{-8.45,0.217943516645},{-8.35,0.254406619072},{-8.25,0.180534060796},{-8.15,0.182080611587},{-8.05,0.268602163895},{-7.95,0.246417098575},{-7.85,0.161601465802},{-7.75,0.273179372152},{-7.65,0.269638752115},{-7.55,0.218873776888},{-7.45,0.259506842669},{-7.35,0.258635891808},{-7.25,0.306709229946},{-7.15,0.358776092529},{-7.05,0.216908073425},{-6.95,0.280632065564},{-6.85,0.258096147091},{-6.75,0.279608850894},{-6.65,0.420682489872},{-6.55,0.380774884611},{-6.45,0.434298823862},{-6.35,0.316375109614},{-6.25,0.330031025166},{-6.15,0.355491956075},{-6.05,0.382154748795},{-5.95,0.494053639864},{-5.85,0.383869395537},{-5.75,0.472990967507},{-5.65,0.495277937068},{-5.55,0.322483947312},{-5.45,0.54442183916},{-5.35,0.631636268214},{-5.25,0.599261828831},{-5.15,0.441416803996},{-5.05,0.465358507835},{-4.95,0.635138193766},{-4.85,0.562442669502},{-4.75,0.524856402956},{-4.65,0.473500892298},{-4.55,0.760229243789},{-4.45,0.515425999959},{-4.35,0.607471860688},{-4.25,0.70426434737},{-4.15,0.671197210039},{-4.05,0.671913344285},{-3.95,0.609362977924},{-3.85,0.752976781672},{-3.75,0.675872742184},{-3.65,0.63560507954},{-3.55,0.675641131045},{-3.45,0.832467896598},{-3.35,0.918209369366},{-3.25,0.861333746659},{-3.15,0.855455560199},{-3.05,0.850305088231},{-2.95,0.780644977794},{-2.85,0.893703960982},{-2.75,0.925049146016},{-2.65,1.03384121982},{-2.55,0.982658838822},{-2.45,0.988275019328},{-2.35,0.783538966984},{-2.25,1.10069227219},{-2.15,0.776676554739},{-2.05,0.969228282119},{-1.95,0.730616023032},{-1.85,1.00428702615},{-1.75,1.03472536527},{-1.65,0.94028870047},{-1.55,1.17938219491},{-1.45,1.06839047056},{-1.35,1.13483586387},{-1.25,1.03311832973},{-1.15,0.852451768032},{-1.05,1.60964037024},{-0.95,1.02621700339},{-0.85,1.04762193892},{-0.75,1.18922996521},{-0.65,1.06697453393},{-0.55,0.87900465185},{-0.45,1.19801917443},{-0.35,1.21922588348},{-0.25,1.31249504089},{-0.15,1.21063889724},{-0.05,1.25349886455},{0.05,1.61181173519},{0.15,1.33893947278},{0.25,1.38921101888},{0.35,1.61250476448},{0.45,1.29880423624},{0.55,1.06500141041},{0.65,1.23290395737},{0.75,1.20641233004},{0.85,1.1004358211},{0.95,1.18973306509},{1.05,1.43419943915},{1.15,1.16204914902},{1.25,1.43990081211},{1.35,1.21637762747},{1.45,1.01429377375},{1.55,1.50541048634},{1.65,1.30552877699},{1.75,1.2259363724},{1.85,1.08771433975},{1.95,1.25972625187},{2.05,1.14192312272},{2.15,1.1214350716},{2.25,1.04154686561},{2.35,1.14490167026},{2.45,1.22998737839},{2.55,1.0707438151},{2.65,1.26276977539},{2.75,1.0667541767},{2.85,1.25941475232},{2.95,1.23568590482},{3.05,1.56815369065},{3.15,1.28776584972},{3.25,1.00903320312},{3.35,0.969199521201},{3.45,1.01877726041},{3.55,1.22776967003},{3.65,1.02519856667},{3.75,1.28677799827},{3.85,1.19472293854},{3.95,0.988933319741},{4.05,1.003053538},{4.15,1.28937227586},{4.25,0.944663153754},{4.35,1.15127033657},{4.45,1.00508003235},{4.55,0.988849933331},{4.65,1.24665730794},{4.75,0.825220975009},{4.85,1.06970214844},{4.95,0.998895532945},{5.05,1.12363723229},{5.15,0.749276115781},{5.25,0.799902664988},{5.35,0.912986397743},{5.45,1.12619178772},{5.55,0.905574353536},{5.65,0.763252594892},{5.75,0.832703844706},{5.85,0.96699005127},{5.95,0.553142865499},{6.05,0.820063908895},{6.15,1.0102436429},{6.25,0.722969259535},{6.35,0.627809832173},{6.45,0.600020316339},{6.55,0.680166171147},{6.65,0.800332387288},{6.75,0.736865650524},{6.85,0.699377796867},{6.95,0.606361269951},{7.05,0.814811762641},{7.15,0.94010754994},{7.25,0.448382684163},{7.35,0.517901752306},{7.45,0.498211943585},{7.55,0.708831342061},{7.65,0.84806839625},{7.75,0.419295310974},{7.85,0.827492020347},{7.95,0.567451032003},{8.05,0.469353844138},{8.15,0.677034334703},{8.25,0.708914852142},{8.35,1.35553627014},{8.45,0.392848044634},{8.55,0.546465613625},{8.65,0.397952692849},{8.75,0.311810998356},{8.85,0.382316479316},{8.95,0.572484433651},{9.05,0.333413527562},{9.15,0.507908582687},{9.25,0.420361598333},{9.35,0.906358361244},{9.45,0.543327887853},{9.55,0.193397030234},{9.65,0.32826060719},{9.75,0.383319752557},{9.85,0.627735793591},{9.95,0.207214615562},{10.05,0.197750915181},{10.15,0.333966652552},{10.25,0.614862362544},{10.35,0.247249177524},{10.45,0.229355624744},{10.55,0.751668512821},{10.65,0.341806679964},{10.75,1.26702284813},{10.85,0.149366468191},{10.95,0.562533676624},{11.05,0.253432393074},{11.15,0.154156297445},{11.25,0.177639269829},{11.35,0.266839325428},{11.45,0.244015097618},{11.55,0.345981866121},{11.65,0.161578819156},{11.75,0.152115106583},{11.85,0.0890237589677},{11.95,0.170624991258},{12.05,0.227824732661},{12.15,0.0},{12.25,0.128595024347},{12.35,0.174243479967},{12.45,0.0},{12.55,0.294766515493},{12.65,0.140842169523},{12.75,0.0665242671967},{12.85,0.0816476345062},{12.95,0.0693077097336},{13.05,0.0947762057185},{13.15,0.0},{13.25,0.0},{13.35,0.0412645302713},{13.45,0.0},{13.55,0.0683335065842},{13.65,0.0},{13.75,0.108275897801},{13.85,0.0949153751135},{13.95,0.09213193506},{14.05,0.0840599536896},{14.15,0.0388290174305},{14.25,0.0371589511633},{14.35,0.0},{14.45,0.0},{14.55,0.0},{14.65,0.050658646971},{14.75,0.0215716771781},{14.85,0.0409165993333},{14.95,0.0182315465063},{15.05,0.0},{15.15,0.0137780383229},{15.25,0.0},{15.35,0.0},{15.45,0.0},{15.55,0.0},{15.65,0.0},{15.75,0.0},{15.85,0.0197624396533},{15.95,0.0},{16.05,0.0},{16.15,0.01057707984},{16.25,0.00918535888195},{16.35,0.0},{16.45,0.00487102381885},{16.55,0.0},{16.65,0.0},{16.75,0.0},{16.85,0.0},{16.95,0.00501019600779},{17.05,0.00473185162991},{17.15,0.0},{17.25,0.0},{17.35,0.0},{17.45,0.0},{17.55,0.0},{17.65,0.00194840948097},{17.75,0.0},{17.85,0.0},{17.95,0.0},{18.05,0.0},{18.15,0.0},{18.25,0.0},{18.35,0.00139172107447},{18.45,0.0},{18.55,0.0},{18.65,0.0},{18.75,0.0},{18.85,0.0},{18.95,0.0},{19.05,0.0},{19.15,0.0},{19.25,0.0},{19.35,0.0},{19.45,0.0},{19.55,0.0},{19.65,0.0},{19.75,0.0},{19.85,0.0},{19.95,0.0},{20.05,0.0},{20.15,0.0},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.0},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU6 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.0},{-21.35,0.0},{-21.25,0.0},{-21.15,0.0},{-21.05,0.0},{-20.95,0.0},{-20.85,0.0},{-20.75,0.0},{-20.65,0.0},{-20.55,0.0},{-20.45,0.0},{-20.35,0.0},{-20.25,0.0},{-20.15,0.0},{-20.05,0.0},{-19.95,0.0},{-19.85,0.000278344203252},{-19.75,0.0},{-19.65,0.0},{-19.55,0.0},{-19.45,0.0},{-19.35,0.000556688406505},{-19.25,0.0},{-19.15,0.0},{-19.05,0.0},{-18.95,0.0},{-18.85,0.0},{-18.75,0.0},{-18.65,0.0},{-18.55,0.0},{-18.45,0.0},{-18.35,0.0},{-18.25,0.000556688406505},{-18.15,0.0},{-18.05,0.0},{-17.95,0.0},{-17.85,0.00111337681301},{-17.75,0.0},{-17.65,0.00153089314699},{-17.55,0.0},{-17.45,0.00139172111327},{-17.35,0.00139172107447},{-17.25,0.0},{-17.15,0.0},{-17.05,0.00208758166991},{-16.95,0.00236592581496},{-16.85,0.0036184748169},{-16.75,0.00213397232195},{-16.65,0.00320095848292},{-16.55,0.0},{-16.45,0.0},{-16.35,0.00487102381885},{-16.25,0.00250509791076},{-16.15,0.00695860525593},{-16.05,0.00681943306699},{-15.95,0.00227314435566},{-15.85,0.00317312404513},{-15.75,0.00313137238845},{-15.65,0.00438392115757},{-15.55,0.0086286701262},{-15.45,0.0041751631846},{-15.35,0.00539987757802},{-15.25,0.00661067478359},{-15.15,0.0115976755818},{-15.05,0.00686582364142},{-14.95,0.0381331555545},{-14.85,0.00504498882219},{-14.75,0.0},{-14.65,0.00505658642699},{-14.55,0.0177212481697},{-14.45,0.0118574634194},{-14.35,0.0105770805052},{-14.25,0.0385506749153},{-14.15,0.00879567712545},{-14.05,0.0124906962737},{-13.95,0.0405454734961},{-13.85,0.0166608893446},{-13.75,0.0164571013302},{-13.65,0.022585645318},{-13.55,0.0205577079739},{-13.45,0.020288200842},{-13.35,0.0272379687854},{-13.25,0.0441453903913},{-13.15,0.0177283848707},{-13.05,0.027339587609},{-12.95,0.0357672311366},{-12.85,0.0164662568193},{-12.75,0.0190511147181},{-12.65,0.031756544655},{-12.55,0.0435763332579},{-12.45,0.0317908844778},{-12.35,0.0292097680709},{-12.25,0.0368527730306},{-12.15,0.0311452526795},{-12.05,0.0481107280805},{-11.95,0.0335603583427},{-11.85,0.0680425058712},{-11.75,0.0766711776907},{-11.65,0.052426951773},{-11.55,0.0745534254954},{-11.45,0.0772206357547},{-11.35,0.0785116195679},{-11.25,0.0510037946701},{-11.15,0.042070907705},{-11.05,0.0651809547258},{-10.95,0.0711285422246},{-10.85,0.0557953625014},{-10.75,0.0651139895121},{-10.65,0.0800806593012},{-10.55,0.0744918659329},{-10.45,0.103210029602},{-10.35,0.0733949761642},{-10.25,0.0662954065535},{-10.15,0.0795113982224},{-10.05,0.0864328384399},{-9.95,0.120145928475},{-9.85,0.102263665199},{-9.75,0.0852108001709},{-9.65,0.1133987563},{-9.55,0.13721636722},{-9.45,0.134778238478},{-9.35,0.163312821775},{-9.25,0.130482196808},{-9.15,0.14125684816},{-9.05,0.148312931061},{-8.95,0.148728582594},{-8.85,0.161985829191},{-8.75,0.206463368734},{-8.65,0.202572102449},{-8.55,0.192426941612},{-8.45,0.204090918813},{-8.35,0.193643630497},{-8.25,0.176649433293},{-8.15,0.206419233066},{-8.05,0.264794809478},{-7.95,0.236466060985},{-7.85,0.228002025657},{-7.75,0.275134563446},{-7.65,0.25457588402},{-7.55,0.239926004984},{-7.45,0.319307211674},{-7.35,0.377648131053},{-7.25,0.334554054368},{-7.15,0.251755300194},{-7.05,0.359240815446},{-6.95,0.394123641538},{-6.85,0.295562591553},{-6.75,0.361866884453},{-6.65,0.417283794548},{-6.55,0.344192085266},{-6.45,0.401959639329},{-6.35,0.362632133847},{-6.25,0.4179251194},{-6.15,0.389063340646},{-6.05,0.4601957798},{-5.95,0.38279689442},{-5.85,0.452702139026},{-5.75,0.447311468884},{-5.65,0.514120675985},{-5.55,0.485324859619},{-5.45,0.514688253403},{-5.35,0.585028194687},{-5.25,0.532401715295},{-5.15,0.710897196894},{-5.05,0.538004296971},{-4.95,0.575916817518},{-4.85,0.578484722948},{-4.75,0.599549060731},{-4.65,0.597098558469},{-4.55,0.706684770255},{-4.45,0.55695946388},{-4.35,0.752745017027},{-4.25,0.718513789139},{-4.15,0.784863408407},{-4.05,0.699681234017},{-3.95,0.74396870931},{-3.85,0.727134331123},{-3.75,0.748015983955},{-3.65,0.728321707012},{-3.55,0.680121598843},{-3.45,0.79957235676},{-3.35,0.820871379277},{-3.25,0.902786928065},{-3.15,0.81636559271},{-3.05,0.824023009865},{-2.95,0.970007235116},{-2.85,0.920719352928},{-2.75,0.948970042118},{-2.65,0.837691632439},{-2.55,0.89425163035},{-2.45,1.07992918595},{-2.35,0.983937811082},{-2.25,0.96989736557},{-2.15,1.06028225278},{-2.05,0.968051202283},{-1.95,1.11671323192},{-1.85,1.01045865146},{-1.75,0.978053274871},{-1.65,0.979504325173},{-1.55,0.976980369184},{-1.45,0.899444580078},{-1.35,1.30086992789},{-1.25,1.08109219869},{-1.15,0.946861031129},{-1.05,1.11186181714},{-0.95,1.18023547287},{-0.85,1.42497999148},{-0.75,1.33581276207},{-0.65,1.12161716195},{-0.55,1.17815681226},{-0.45,1.20114060852},{-0.35,1.2111392551},{-0.25,1.19232538397},{-0.15,1.22328157778},{-0.05,1.34953962054},{0.05,1.41008385192},{0.15,1.19991844821},{0.25,1.2538951178},{0.35,1.21397958151},{0.45,1.53197866587},{0.55,1.26300904098},{0.65,1.43345454119},{0.75,1.43567095012},{0.85,1.28881605048},{0.95,1.39528187343},{1.05,1.19611895526},{1.15,1.31996353358},{1.25,1.53062365723},{1.35,1.36414496333},{1.45,1.29589580667},{1.55,1.24316874186},{1.65,1.28702667877},{1.75,1.41330890508},{1.85,1.26511361565},{1.95,1.35410850467},{2.05,1.16068798343},{2.15,1.29233751799},{2.25,1.43636697026},{2.35,1.36983902728},{2.45,1.26113269512},{2.55,1.24017979549},{2.65,1.47870229561},{2.75,1.09929976227},{2.85,1.30268416445},{2.95,1.22795798562},{3.05,1.24740078918},{3.15,1.41646341758},{3.25,1.39542861938},{3.35,1.29634966169},{3.45,1.1969428535},{3.55,1.38156744774},{3.65,1.17936521156},{3.75,1.0539134751},{3.85,1.12819210988},{3.95,1.29308514065},{4.05,1.21575361683},{4.15,1.03046410106},{4.25,1.27324249631},{4.35,1.05540738787},{4.45,0.991318806563},{4.55,1.05333311661},{4.65,0.838792732784},{4.75,1.09332597112},{4.85,1.04480480012},{4.95,0.969959215186},{5.05,0.905503167046},{5.15,0.905367357978},{5.25,1.03822389368},{5.35,0.897436730656},{5.45,0.76292029671},{5.55,1.08930009411},{5.65,0.922671290806},{5.75,0.973661065102},{5.85,0.949657440186},{5.95,0.866784933842},{6.05,0.853390276432},{6.15,0.905304941638},{6.25,0.748081207275},{6.35,0.785537532119},{6.45,0.67432975769},{6.55,0.762838932506},{6.65,0.690994135539},{6.75,0.962650019948},{6.85,0.751573867798},{6.95,0.798161315918},{7.05,0.578300217451},{7.15,0.661158425467},{7.25,0.598369112202},{7.35,0.879862929835},{7.45,0.551500091553},{7.55,0.788456367724},{7.65,0.533325651418},{7.75,0.466499328613},{7.85,0.439371910095},{7.95,0.684522628784},{8.05,0.434235509237},{8.15,0.521322795323},{8.25,0.746010904727},{8.35,0.671760559082},{8.45,0.409873137603},{8.55,0.314077419705},{8.65,0.333289361},{8.75,0.367266991559},{8.85,0.377291094872},{8.95,0.496300393885},{9.05,0.465859629891},{9.15,0.391873836517},{9.25,0.404826337641},{9.35,0.31708757694},{9.45,0.310788002014},{9.55,0.358535170555},{9.65,0.277822315693},{9.75,0.387089818716},{9.85,0.446549745706},{9.95,0.252948624747},{10.05,0.308074861765},{10.15,0.267030323253},{10.25,0.299538135529},{10.35,0.214989980062},{10.45,0.241194534302},{10.55,0.220392942429},{10.65,0.339146958457},{10.75,0.198757648468},{10.85,0.257524061203},{10.95,0.259633302689},{11.05,0.112436407491},{11.15,0.257816314697},{11.25,0.265142747334},{11.35,0.205139681697},{11.45,0.308349704742},{11.55,0.28474612236},{11.65,0.119763927026},{11.75,0.149192497134},{11.85,0.369362751643},{11.95,0.510204911232},{12.05,0.133048534393},{12.15,0.137409259876},{12.25,0.0634856770436},{12.35,0.0742251210743},{12.45,0.0898654205459},{12.55,0.0708038061857},{12.65,0.108832585812},{12.75,0.0471515089273},{12.85,0.0895711660385},{12.95,0.131378471851},{13.05,0.119780788819},{13.15,0.164779767394},{13.25,0.148218289018},{13.35,0.0724390819669},{13.45,0.0428186158339},{13.55,0.118574634194},{13.65,0.0542771220207},{13.75,0.194840952754},{13.85,0.175635203719},{13.95,0.0},{14.05,0.0359064042568},{14.15,0.0444422910611},{14.25,0.109667621553},{14.35,0.0261643566191},{14.45,0.0342363367478},{14.55,0.0879567712545},{14.65,0.0140563820799},{14.75,0.0706994310021},{14.85,0.0693077072501},{14.95,0.0},{15.05,0.0183707177639},{15.15,0.0150305877129},{15.25,0.0131749597689},{15.35,0.0359064042568},{15.45,0.0372981242836},{15.55,0.0364630930126},{15.65,0.015169759281},{15.75,0.0322879292071},{15.85,0.0233809128404},{15.95,0.0},{16.05,0.0},{16.15,0.0},{16.25,0.0},{16.35,0.0},{16.45,0.0116904564202},{16.55,0.00681943306699},{16.65,0.00807198230177},{16.75,0.00807198230177},{16.85,0.0},{16.95,0.0},{17.05,0.0},{17.15,0.0},{17.25,0.0},{17.35,0.0},{17.45,0.00194840948097},{17.55,0.0},{17.65,0.0},{17.75,0.0},{17.85,0.0},{17.95,0.0},{18.05,0.0},{18.15,0.0},{18.25,0.0},{18.35,0.0},{18.45,0.0},{18.55,0.0},{18.65,0.0},{18.75,0.0},{18.85,0.0},{18.95,0.0},{19.05,0.0},{19.15,0.0},{19.25,0.0},{19.35,0.0},{19.45,0.0},{19.55,0.0},{19.65,0.0},{19.75,0.0},{19.85,0.0},{19.95,0.0},{20.05,0.0},{20.15,0.0},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.0},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU7 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.0},{-21.35,0.0},{-21.25,0.0},{-21.15,0.0},{-21.05,0.0},{-20.95,0.0},{-20.85,0.0},{-20.75,0.0},{-20.65,0.0},{-20.55,0.000278344203252},{-20.45,0.0},{-20.35,0.0},{-20.25,0.0},{-20.15,0.0},{-20.05,0.0},{-19.95,0.000139172101626},{-19.85,0.000278344203252},{-19.75,0.000139172101626},{-19.65,0.0},{-19.55,0.0},{-19.45,0.0},{-19.35,0.000556688406505},{-19.25,9.27814010841e-05},{-19.15,0.0},{-19.05,0.0},{-18.95,0.000556688406505},{-18.85,0.000835032609757},{-18.75,0.0},{-18.65,0.0},{-18.55,0.00194840948097},{-18.45,0.000695860537235},{-18.35,0.00278344214894},{-18.25,0.000278344203252},{-18.15,0.000835032609757},{-18.05,0.000695860537235},{-17.95,0.00111337681301},{-17.85,0.00125254900195},{-17.75,0.0},{-17.65,0.000231953512412},{-17.55,0.0},{-17.45,0.00306178629398},{-17.35,0.00125254900195},{-17.25,0.0},{-17.15,0.00264426996},{-17.05,0.00077936379239},{-16.95,0.00320095848292},{-16.85,0.00160047924146},{-16.75,0.00208758166991},{-16.65,0.00125254892434},{-16.55,0.00194840948097},{-16.45,0.00222675362602},{-16.35,0.00229633972049},{-16.25,0.00107055465476},{-16.15,0.00378548130393},{-16.05,0.00538132153451},{-15.95,0.00563647039235},{-15.85,0.00219891928136},{-15.75,0.00514936788628},{-15.65,0.0125254889329},{-15.55,0.00588499169265},{-15.45,0.00784930661321},{-15.35,0.00395867311292},{-15.25,0.00467618256807},{-15.15,0.00963070988655},{-15.05,0.00664933398366},{-14.95,0.0114677816629},{-14.85,0.00441871443763},{-14.75,0.00512153357267},{-14.65,0.0114816986024},{-14.55,0.0103999518535},{-14.45,0.00964926617841},{-14.35,0.00898654120309},{-14.25,0.0102589726448},{-14.15,0.00807198230177},{-14.05,0.00881423304478},{-13.95,0.0164223083041},{-13.85,0.0144553422928},{-13.75,0.01311492394},{-13.65,0.0189671708005},{-13.55,0.00990110103573},{-13.45,0.0250509778659},{-13.35,0.00964926589619},{-13.25,0.0140306099697},{-13.15,0.023334523042},{-13.05,0.0127265155315},{-12.95,0.0133128055504},{-12.85,0.0229578304291},{-12.75,0.0194661367324},{-12.65,0.016605608347},{-12.55,0.0225543163039},{-12.45,0.0363904807879},{-12.35,0.0292087458074},{-12.25,0.0316683880744},{-12.15,0.0266259995902},{-12.05,0.0294433861244},{-11.95,0.0384512628828},{-11.85,0.0339385742365},{-11.75,0.0430982145103},{-11.65,0.0468468765418},{-11.55,0.057144909194},{-11.45,0.0510297729855},{-11.35,0.0512215190464},{-11.25,0.0471452092225},{-11.15,0.0451510812415},{-11.05,0.0626332461834},{-10.95,0.0483090947656},{-10.85,0.0708194994459},{-10.75,0.0693711899875},{-10.65,0.0798074669308},{-10.55,0.0660272257669},{-10.45,0.0669198098936},{-10.35,0.0990060397557},{-10.25,0.085894671964},{-10.15,0.0693906215911},{-10.05,0.0758203639779},{-9.95,0.0971068973783},{-9.85,0.108387959468},{-9.75,0.093009569207},{-9.65,0.103286428654},{-9.55,0.107103482641},{-9.45,0.112842399295},{-9.35,0.112936247379},{-9.25,0.137169179228},{-9.15,0.138831610819},{-9.05,0.163133149398},{-8.95,0.139757091716},{-8.85,0.135630119848},{-8.75,0.1578977108},{-8.65,0.169267780525},{-8.55,0.162278764388},{-8.45,0.196768474579},{-8.35,0.204377058076},{-8.25,0.203370513338},{-8.15,0.210829370162},{-8.05,0.212964464734},{-7.95,0.24968964089},{-7.85,0.286329488285},{-7.75,0.253739343931},{-7.65,0.256156203035},{-7.55,0.317481098753},{-7.45,0.300137803361},{-7.35,0.30529842129},{-7.25,0.31698473194},{-7.15,0.316714052669},{-7.05,0.288463083903},{-6.95,0.319051311862},{-6.85,0.330667021413},{-6.75,0.338853075097},{-6.65,0.432370582723},{-6.55,0.38395827444},{-6.45,0.453011770809},{-6.35,0.395527127894},{-6.25,0.407799570184},{-6.15,0.448511823338},{-6.05,0.521751573351},{-5.95,0.459500749535},{-5.85,0.556422094397},{-5.75,0.468813954229},{-5.65,0.49313558612},{-5.55,0.489101584027},{-5.45,0.531542261958},{-5.35,0.570744786944},{-5.25,0.520933151245},{-5.15,0.503506536069},{-5.05,0.575891948882},{-4.95,0.643651978582},{-4.85,0.578126069804},{-4.75,0.594448785712},{-4.65,0.564475528373},{-4.55,0.662442351833},{-4.45,0.679143212708},{-4.35,0.670225095919},{-4.25,0.715326197007},{-4.15,0.760633821307},{-4.05,0.794721756858},{-3.95,0.744902239905},{-3.85,0.851731168307},{-3.75,0.824602257904},{-3.65,0.807089557386},{-3.55,0.767050586169},{-3.45,0.84162918297},{-3.35,0.942295411054},{-3.25,0.925735581089},{-3.15,0.912228043015},{-3.05,0.868902511358},{-2.95,0.946362915039},{-2.85,0.989469151919},{-2.75,0.914481133771},{-2.65,0.903811763231},{-2.55,1.18564364937},{-2.45,1.1862303321},{-2.35,1.04936845403},{-2.25,1.10319040934},{-2.15,1.04132259039},{-2.05,1.09187893338},{-1.95,1.14086039292},{-1.85,1.25073575302},{-1.75,1.13055419922},{-1.65,1.12632582963},{-1.55,1.1190264361},{-1.45,1.17605714412},{-1.35,1.18910719593},{-1.25,1.23067723834},{-1.15,1.12896253602},{-1.05,1.29213910926},{-0.95,1.1276515907},{-0.85,1.18379135356},{-0.75,1.38585211306},{-0.65,1.15097823797},{-0.55,1.17967506691},{-0.45,1.19561153719},{-0.35,1.26020426923},{-0.25,1.27703477112},{-0.15,1.32768523881},{-0.05,1.38418659148},{0.05,1.36996696991},{0.15,1.29522499761},{0.25,1.2948794117},{0.35,1.32793137123},{0.45,1.45801212705},{0.55,1.31369388178},{0.65,1.19853353908},{0.75,1.34557743562},{0.85,1.49047459194},{0.95,1.37576233314},{1.05,1.42024991275},{1.15,1.57131279839},{1.25,1.4338657218},{1.35,1.31125333712},{1.45,1.44416329835},{1.55,1.34221729343},{1.65,1.40606426936},{1.75,1.538271465},{1.85,1.3742452642},{1.95,1.51032800293},{2.05,1.34340868788},{2.15,1.59407614003},{2.25,1.33872013798},{2.35,1.51966544909},{2.45,1.26373797806},{2.55,1.26090237684},{2.65,1.32289476582},{2.75,1.4200668987},{2.85,1.26361119608},{2.95,1.30383951156},{3.05,1.31943408513},{3.15,1.34647781237},{3.25,1.22714283633},{3.35,1.42478120093},{3.45,1.27522896432},{3.55,1.25052874121},{3.65,1.20025987413},{3.75,1.21803170663},{3.85,1.05117320622},{3.95,1.26910898637},{4.05,1.31110713793},{4.15,1.28262529217},{4.25,1.16147076354},{4.35,1.28977707534},{4.45,1.07471354882},{4.55,1.05405542802},{4.65,1.13016083281},{4.75,0.96677154541},{4.85,1.22053567724},{4.95,1.13562510748},{5.05,0.997704903739},{5.15,1.06401303448},{5.25,0.943634033203},{5.35,0.828054793338},{5.45,0.964913448211},{5.55,1.12220335007},{5.65,0.964065658463},{5.75,0.927483832086},{5.85,0.998848081574},{5.95,0.988927577569},{6.05,1.02427004095},{6.15,0.825643129702},{6.25,0.987727624399},{6.35,0.703986644745},{6.45,0.815773074366},{6.55,0.778561503947},{6.65,0.887054905747},{6.75,0.774296866523},{6.85,1.13952527727},{6.95,0.720765686035},{7.05,0.788772415329},{7.15,0.731701102308},{7.25,0.632668214686},{7.35,0.688398382637},{7.45,0.635080568083},{7.55,0.642506857479},{7.65,0.642769861221},{7.75,0.594896270008},{7.85,0.707088529147},{7.95,0.550349899485},{8.05,0.572612869907},{8.15,0.590273871789},{8.25,0.463302116889},{8.35,0.578360853524},{8.45,0.46622245452},{8.55,0.486043742446},{8.65,0.56384016543},{8.75,0.405699729919},{8.85,0.526857168778},{8.95,0.515151890841},{9.05,0.330298900604},{9.15,0.47978396532},{9.25,0.365488204956},{9.35,0.397721490195},{9.45,0.369615222132},{9.55,0.348957493192},{9.65,0.389944321769},{9.75,0.253170757294},{9.85,0.269785122438},{9.95,0.212262022729},{10.05,0.228166341782},{10.15,0.308683713277},{10.25,0.313467131721},{10.35,0.225737149375},{10.45,0.347771213168},{10.55,0.277891894182},{10.65,0.245933818817},{10.75,0.244616156039},{10.85,0.168030108175},{10.95,0.163608814108},{11.05,0.271072477102},{11.15,0.224407275518},{11.25,0.138808112878},{11.35,0.154518994418},{11.45,0.236870930745},{11.55,0.110647392273},{11.65,0.125129640102},{11.75,0.104265213013},{11.85,0.164522831257},{11.95,0.147693716563},{12.05,0.11052004993},{12.15,0.159686076641},{12.25,0.159831431177},{12.35,0.113958756129},{12.45,0.11754475832},{12.55,0.0988881046122},{12.65,0.0650954325994},{12.75,0.101719346311},{12.85,0.101908773184},{12.95,0.0737612128258},{13.05,0.0342363387346},{13.15,0.0680396954219},{13.25,0.0575059115887},{13.35,0.0562564598189},{13.45,0.0353729104002},{13.55,0.0687046299378},{13.65,0.0531637455736},{13.75,0.0487102355276},{13.85,0.0522359311581},{13.95,0.0669417828321},{14.05,0.0774724731843},{14.15,0.073390091459},{14.25,0.049127753824},{14.35,0.025647431612},{14.45,0.056132748723},{14.55,0.0211541610105},{14.65,0.0095829931753},{14.75,0.0226015493274},{14.85,0.116069532931},{14.95,0.0},{15.05,0.0185377240181},{15.15,0.00875237915251},{15.25,0.0372981242836},{15.35,0.0297828298062},{15.45,0.0553904995322},{15.55,0.0286694541574},{15.65,0.0152161506315},{15.75,0.0121543643375},{15.85,0.0},{15.95,0.0},{16.05,0.013638866134},{16.15,0.0},{16.25,0.00862867074708},{16.35,0.00723694963381},{16.45,0.0},{16.55,0.0155872758478},{16.65,0.0144738992676},{16.75,0.0144738992676},{16.85,0.0},{16.95,0.0},{17.05,0.00918535888195},{17.15,0.0},{17.25,0.0},{17.35,0.00723694963381},{17.45,0.0},{17.55,0.00250509800389},{17.65,0.0},{17.75,0.0},{17.85,0.0},{17.95,0.0},{18.05,0.0},{18.15,0.00306178629398},{18.25,0.00167006521951},{18.35,0.0},{18.45,0.000835032609757},{18.55,0.0},{18.65,0.0},{18.75,0.0},{18.85,0.000278344203252},{18.95,0.0},{19.05,0.0},{19.15,0.000556688406505},{19.25,0.0},{19.35,0.0},{19.45,0.00194840948097},{19.55,0.0},{19.65,0.0},{19.75,0.0},{19.85,0.0},{19.95,0.0},{20.05,0.0},{20.15,0.0},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.0},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU8 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.0},{-21.35,0.0},{-21.25,0.000278344203252},{-21.15,0.0},{-21.05,0.0},{-20.95,0.0},{-20.85,0.0},{-20.75,0.0},{-20.65,0.0},{-20.55,0.0},{-20.45,0.0},{-20.35,0.0},{-20.25,0.0},{-20.15,0.0},{-20.05,0.000278344203252},{-19.95,9.27814010841e-05},{-19.85,0.0},{-19.75,0.0},{-19.65,0.0},{-19.55,0.0},{-19.45,0.000185562802168},{-19.35,0.000835032609757},{-19.25,0.0},{-19.15,0.000139172101626},{-19.05,0.000139172101626},{-18.95,0.000185562802168},{-18.85,0.000278344203252},{-18.75,0.000556688406505},{-18.65,0.00250509800389},{-18.55,0.0},{-18.45,0.000278344203252},{-18.35,0.000371125604336},{-18.25,0.00111337681301},{-18.15,0.00111337681301},{-18.05,0.00278344214894},{-17.95,0.000612357258797},{-17.85,0.000835032667965},{-17.75,0.000835032667965},{-17.65,0.00055668844531},{-17.55,0.00473185162991},{-17.45,0.00104379083496},{-17.35,0.000680396954219},{-17.25,0.000730653526261},{-17.15,0.00100899778772},{-17.05,0.000723694963381},{-16.95,0.00118296290748},{-16.85,0.00570605648682},{-16.75,0.0018291191331},{-16.65,0.00204119086266},{-16.55,0.00514936773106},{-16.45,0.00259787930797},{-16.35,0.00198320252821},{-16.25,0.00302699324675},{-16.15,0.00302202281143},{-16.05,0.00377311060826},{-15.95,0.00449327060155},{-15.85,0.00219582662814},{-15.75,0.00516483146283},{-15.65,0.00433753058314},{-15.55,0.00387693728719},{-15.45,0.00541505996477},{-15.35,0.00982157460281},{-15.25,0.00430614851853},{-15.15,0.00482463298572},{-15.05,0.00708707192769},{-14.95,0.00503949507287},{-14.85,0.00581871931042},{-14.75,0.00669417828321},{-14.65,0.00608877961834},{-14.55,0.00845287426522},{-14.45,0.0152583230625},{-14.35,0.00791610956192},{-14.25,0.00857300162315},{-14.15,0.0137625750568},{-14.05,0.0120293109313},{-13.95,0.0134936428588},{-13.85,0.0126539560465},{-13.75,0.013017231226},{-13.65,0.0206637439274},{-13.55,0.0125040786389},{-13.45,0.0164049118757},{-13.35,0.0142602865086},{-13.25,0.0129075307472},{-13.15,0.0145128667355},{-13.05,0.0178899412805},{-12.95,0.0201736295765},{-12.85,0.0135180056095},{-12.75,0.0231691287911},{-12.65,0.0245170131022},{-12.55,0.027084596303},{-12.45,0.0251949491172},{-12.35,0.0240414623004},{-12.25,0.0332086063348},{-12.15,0.0317768698833},{-12.05,0.0300689074728},{-11.95,0.0415694410151},{-11.85,0.0322098557542},{-11.75,0.0392808489604},{-11.65,0.0479565657102},{-11.55,0.0407332195955},{-11.45,0.043213737422},{-11.35,0.0428133551607},{-11.25,0.060630791982},{-11.15,0.0460247287044},{-11.05,0.0536405119565},{-10.95,0.056062725355},{-10.85,0.0587155840418},{-10.75,0.0637859610824},{-10.65,0.078844513556},{-10.55,0.076475075313},{-10.45,0.0929864501953},{-10.35,0.0804860153198},{-10.25,0.0963901134959},{-10.15,0.093911583968},{-10.05,0.0967524493182},{-9.95,0.101407400996},{-9.85,0.120371818542},{-9.75,0.0960850688074},{-9.65,0.109075718615},{-9.55,0.114514081618},{-9.45,0.129443724463},{-9.35,0.126543409369},{-9.25,0.149728821545},{-9.15,0.141401831479},{-9.05,0.160557428996},{-8.95,0.151431650218},{-8.85,0.160478214135},{-8.75,0.17420508474},{-8.65,0.201070553411},{-8.55,0.208134382199},{-8.45,0.236099429753},{-8.35,0.211614972895},{-8.25,0.220849422879},{-8.15,0.24290299089},{-8.05,0.228289194375},{-7.95,0.256410220504},{-7.85,0.266892013236},{-7.75,0.306254102919},{-7.65,0.270032770493},{-7.55,0.310800262451},{-7.45,0.330338897705},{-7.35,0.330242845349},{-7.25,0.304221106357},{-7.15,0.332844192917},{-7.05,0.340591105477},{-6.95,0.37855385587},{-6.85,0.377492582643},{-6.75,0.406949378007},{-6.65,0.406497728115},{-6.55,0.41200827976},{-6.45,0.419647038332},{-6.35,0.431410387799},{-6.25,0.440575723833},{-6.15,0.480605815261},{-6.05,0.496111392975},{-5.95,0.499606639228},{-5.85,0.495114080685},{-5.75,0.561648874975},{-5.65,0.581171136153},{-5.55,0.546172981832},{-5.45,0.603936606959},{-5.35,0.598851636538},{-5.25,0.578100253147},{-5.15,0.665757242839},{-5.05,0.637365004596},{-4.95,0.631145775985},{-4.85,0.665716914218},{-4.75,0.728264329536},{-4.65,0.713018978343},{-4.55,0.697348393357},{-4.45,0.751093625494},{-4.35,0.78344903279},{-4.25,0.788956118768},{-4.15,0.761281042505},{-4.05,0.799658832353},{-3.95,0.866211992103},{-3.85,0.853532488322},{-3.75,0.837658595477},{-3.65,0.839375095513},{-3.55,0.829795082847},{-3.45,0.891659674517},{-3.35,0.977547113149},{-3.25,0.906522405983},{-3.15,1.00446055135},{-3.05,0.966189489632},{-2.95,0.960794310639},{-2.85,1.07676047146},{-2.75,1.05670363278},{-2.65,1.01947809035},{-2.55,1.18269587437},{-2.45,1.19245953541},{-2.35,1.0694264676},{-2.25,1.30483004413},{-2.15,1.14247747248},{-2.05,1.20335986511},{-1.95,1.12417465736},{-1.85,1.17912645442},{-1.75,1.26858549244},{-1.65,1.18865394592},{-1.55,1.180184693},{-1.45,1.30692621065},{-1.35,1.23989809783},{-1.25,1.3101075548},{-1.15,1.31420119032},{-1.05,1.30539734427},{-0.95,1.30202222704},{-0.85,1.34794315899},{-0.75,1.38342764082},{-0.65,1.33872352507},{-0.55,1.41028089139},{-0.45,1.44351429291},{-0.35,1.47161899848},{-0.25,1.45415520979},{-0.15,1.39728348948},{-0.05,1.46723815348},{0.05,1.64493397988},{0.15,1.50658561167},{0.25,1.49627917179},{0.35,1.50958439034},{0.45,1.430625},{0.55,1.51945899949},{0.65,1.39286766188},{0.75,1.53079822017},{0.85,1.47761193337},{0.95,1.41370365345},{1.05,1.5094683634},{1.15,1.40095338034},{1.25,1.48587945676},{1.35,1.42271585175},{1.45,1.50145819879},{1.55,1.40012582989},{1.65,1.62308824327},{1.75,1.45601350418},{1.85,1.40052528606},{1.95,1.53667280039},{2.05,1.46823100761},{2.15,1.47217807565},{2.25,1.50420379639},{2.35,1.43757480448},{2.45,1.39813376496},{2.55,1.50526850884},{2.65,1.31654134455},{2.75,1.4114714322},{2.85,1.35752902865},{2.95,1.48298461914},{3.05,1.28483622053},{3.15,1.42752749956},{3.25,1.35407938143},{3.35,1.42444728741},{3.45,1.31530685993},{3.55,1.32466086363},{3.65,1.22553670841},{3.75,1.28152147099},{3.85,1.31366277858},{3.95,1.25937519903},{4.05,1.29866982056},{4.15,1.2098891959},{4.25,1.2354486155},{4.35,1.25810483607},{4.45,1.1221916113},{4.55,1.16123362132},{4.65,1.27010156664},{4.75,1.19455137347},{4.85,1.19137969033},{4.95,1.18798194133},{5.05,1.08763882946},{5.15,1.07569607345},{5.25,1.08902528398},{5.35,0.91955498804},{5.45,1.00095074835},{5.55,0.989851610247},{5.65,0.901810866136},{5.75,1.10622224679},{5.85,1.06548907306},{5.95,0.957270368745},{6.05,1.00654806914},{6.15,0.949034251035},{6.25,0.907558423743},{6.35,0.969298226493},{6.45,0.914882236057},{6.55,0.937118364417},{6.65,0.881370954616},{6.75,0.879258059384},{6.85,0.889821400899},{6.95,0.774319910741},{7.05,0.871578860593},{7.15,0.787195229236},{7.25,0.872165348219},{7.35,0.686323050993},{7.45,0.686233714887},{7.55,0.78949855834},{7.65,0.677648571176},{7.75,0.594949772483},{7.85,0.658755082351},{7.95,0.560032420688},{8.05,0.52605120341},{8.15,0.614389682638},{8.25,0.58053403108},{8.35,0.532330949428},{8.45,0.590426521301},{8.55,0.525625210717},{8.65,0.449189459759},{8.75,0.407038316888},{8.85,0.365339232654},{8.95,0.473469766338},{9.05,0.430705563053},{9.15,0.479883746097},{9.25,0.430228559277},{9.35,0.450651196071},{9.45,0.464211872646},{9.55,0.330445498955},{9.65,0.350017839008},{9.75,0.248413329429},{9.85,0.277723287925},{9.95,0.251546621323},{10.05,0.267726787622},{10.15,0.31252486489},{10.25,0.295900902658},{10.35,0.340162521185},{10.45,0.267099113464},{10.55,0.218206950596},{10.65,0.221829414368},{10.75,0.25358516414},{10.85,0.216146924279},{10.95,0.198978163979},{11.05,0.189393350056},{11.15,0.227876931429},{11.25,0.210210770369},{11.35,0.168019387457},{11.45,0.159014075143},{11.55,0.145104816982},{11.65,0.108677231988},{11.75,0.262530773878},{11.85,0.185045878092},{11.95,0.151322437369},{12.05,0.145055294037},{12.15,0.118218355179},{12.25,0.100514375246},{12.35,0.0876474998615},{12.45,0.0981922474774},{12.55,0.0776691675186},{12.65,0.0751413404942},{12.75,0.10647594134},{12.85,0.065018675544},{12.95,0.0773633157506},{13.05,0.0677613483535},{13.15,0.0664720758796},{13.25,0.0738682701037},{13.35,0.0546598434448},{13.45,0.0555495534624},{13.55,0.0659422711893},{13.65,0.0634346425533},{13.75,0.0634006261826},{13.85,0.0872145195802},{13.95,0.0642577494894},{14.05,0.0424474924803},{14.15,0.0979075729847},{14.25,0.0375146137344},{14.35,0.0504266917706},{14.45,0.0320714381006},{14.55,0.027617931366},{14.65,0.0387362365921},{14.75,0.031545676291},{14.85,0.0570605645577},{14.95,0.0156429439783},{15.05,0.0208758165439},{15.15,0.011488024484},{15.25,0.0192521413167},{15.35,0.0156270393303},{15.45,0.0190387442708},{15.55,0.0146130708357},{15.65,0.00675617293878},{15.75,0.00990110103573},{15.85,0.0175356852512},{15.95,0.00784002865354},{16.05,0.0456484518945},{16.15,0.0146594618758},{16.25,0.0361847467721},{16.35,0.0},{16.45,0.00816476345062},{16.55,0.00732973093788},{16.65,0.00528853992},{16.75,0.01057707984},{16.85,0.00932453107089},{16.95,0.00403599115089},{17.05,0.00528854007522},{17.15,0.0133605217561},{17.25,0.00918535888195},{17.35,0.00403599115089},{17.45,0.0},{17.55,0.00723694963381},{17.65,0.0},{17.75,0.00389681896195},{17.85,0.00194840948097},{17.95,0.0},{18.05,0.0},{18.15,0.00334013043903},{18.25,0.0},{18.35,0.0},{18.45,0.0},{18.55,0.0},{18.65,0.0},{18.75,0.0},{18.85,0.0},{18.95,0.0},{19.05,0.0},{19.15,0.00111337681301},{19.25,0.0},{19.35,0.0},{19.45,0.0},{19.55,0.0},{19.65,0.0},{19.75,0.0},{19.85,0.0},{19.95,0.0},{20.05,0.0},{20.15,0.0},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.0},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU9 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.0},{-21.35,0.0},{-21.25,0.0},{-21.15,0.000278344203252},{-21.05,0.000139172101626},{-20.95,0.0},{-20.85,0.0},{-20.75,0.0},{-20.65,0.0},{-20.55,0.0},{-20.45,0.000556688406505},{-20.35,0.000556688406505},{-20.25,0.0},{-20.15,0.0},{-20.05,0.000139172101626},{-19.95,0.000556688406505},{-19.85,0.000278344203252},{-19.75,0.000835032609757},{-19.65,0.000185562802168},{-19.55,0.000835032609757},{-19.45,0.000278344203252},{-19.35,0.0},{-19.25,0.000695860537235},{-19.15,0.000185562802168},{-19.05,0.000278344203252},{-18.95,6.95860508131e-05},{-18.85,0.000556688406505},{-18.75,0.000974204740487},{-18.65,0.00167006521951},{-18.55,0.00111337681301},{-18.45,0.00222675362602},{-18.35,0.000612357258797},{-18.25,0.00111337681301},{-18.15,0.000340198477109},{-18.05,0.000974204740487},{-17.95,0.000238580745645},{-17.85,0.00139172111327},{-17.75,0.001057707984},{-17.65,0.000890701450408},{-17.55,0.00133605217561},{-17.45,0.000742251208673},{-17.35,0.00125254900195},{-17.25,0.00160047924146},{-17.15,0.00159053837082},{-17.05,0.00142264821463},{-16.95,0.00119688007981},{-16.85,0.00233113276772},{-16.75,0.00243551190943},{-16.65,0.00169536928562},{-16.55,0.00302202281143},{-16.45,0.00190201882894},{-16.35,0.0042795422487},{-16.25,0.00148028507829},{-16.15,0.00228242253264},{-16.05,0.00349000812723},{-15.95,0.00263694516922},{-15.85,0.0021133541509},{-15.75,0.00384769939324},{-15.65,0.00303527748301},{-15.55,0.00343291177636},{-15.45,0.00499473222428},{-15.35,0.00337105768698},{-15.25,0.0043607260342},{-15.15,0.00562487232188},{-15.05,0.0062687954177},{-14.95,0.00684262874226},{-14.85,0.013479812869},{-14.75,0.00673784932186},{-14.65,0.0074891988188},{-14.55,0.00664457602379},{-14.45,0.00715419811171},{-14.35,0.011618292994},{-14.25,0.0110494214477},{-14.15,0.0110134031322},{-14.05,0.00947607424524},{-13.95,0.0116398483515},{-13.85,0.0169053182882},{-13.75,0.0187502774325},{-13.65,0.0118467201266},{-13.55,0.0125115722418},{-13.45,0.0133784797884},{-13.35,0.012946766776},{-13.25,0.0140365006088},{-13.15,0.0196464618047},{-13.05,0.0236750121387},{-12.95,0.018838335673},{-12.85,0.0202902091014},{-12.75,0.0222710597364},{-12.65,0.0277270589556},{-12.55,0.0201682487381},{-12.45,0.0326044004257},{-12.35,0.0330123381737},{-12.25,0.0371259890105},{-12.15,0.0338613058391},{-12.05,0.0319661722271},{-11.95,0.0380813093746},{-11.85,0.0424168729782},{-11.75,0.0398268093497},{-11.65,0.0473951243479},{-11.55,0.0487268888033},{-11.45,0.0554225212705},{-11.35,0.0466874756225},{-11.25,0.0461191061771},{-11.15,0.0551808102926},{-11.05,0.0715761034507},{-10.95,0.0611504852772},{-10.85,0.0672827541828},{-10.75,0.0598809281174},{-10.65,0.0780257889719},{-10.55,0.0671947002411},{-10.45,0.0774263149591},{-10.35,0.0878445590354},{-10.25,0.0979202947309},{-10.15,0.0960328264934},{-10.05,0.0961549377441},{-9.95,0.123967740902},{-9.85,0.121633757815},{-9.75,0.108347661793},{-9.65,0.114411157506},{-9.55,0.121784526897},{-9.45,0.152057731361},{-9.35,0.146098351294},{-9.25,0.167905705456},{-9.15,0.152737010609},{-9.05,0.166877219018},{-8.95,0.171054236415},{-8.85,0.182926318789},{-8.75,0.179882938876},{-8.65,0.183231165789},{-8.55,0.214217923041},{-8.45,0.198918507197},{-8.35,0.212523413486},{-8.25,0.223756564561},{-8.15,0.247522641827},{-8.05,0.244726967566},{-7.95,0.256383983012},{-7.85,0.262963997445},{-7.75,0.348378984856},{-7.65,0.282325233653},{-7.55,0.312918732132},{-7.45,0.326750984101},{-7.35,0.324415422596},{-7.25,0.33469418882},{-7.15,0.356110676026},{-7.05,0.360466113989},{-6.95,0.393440148349},{-6.85,0.402973127563},{-6.75,0.454113945464},{-6.65,0.428190594628},{-6.55,0.421931618883},{-6.45,0.477416992188},{-6.35,0.491013287104},{-6.25,0.478373374595},{-6.15,0.508097256341},{-6.05,0.536330476813},{-5.95,0.486541699529},{-5.85,0.554139978745},{-5.75,0.552712116304},{-5.65,0.578708805794},{-5.55,0.602561197783},{-5.45,0.606260085746},{-5.35,0.574802008979},{-5.25,0.663478784607},{-5.15,0.675909775041},{-5.05,0.681882003853},{-4.95,0.70718374597},{-4.85,0.668782802227},{-4.75,0.698617171716},{-4.65,0.748829826691},{-4.55,0.71340089803},{-4.45,0.746931757066},{-4.35,0.799006164966},{-4.25,0.858134786344},{-4.15,0.809104683473},{-4.05,0.830972239242},{-3.95,0.859222881611},{-3.85,0.848304720451},{-3.75,0.85065047288},{-3.65,0.882210658147},{-3.55,0.927610430143},{-3.45,1.04516453897},{-3.35,0.969188430934},{-3.25,1.01798182031},{-3.15,1.04856315793},{-3.05,1.00864441559},{-2.95,1.0890328758},{-2.85,1.10892847965},{-2.75,1.15224616957},{-2.65,1.0253174488},{-2.55,1.16910044045},{-2.45,1.18254587044},{-2.35,1.1725878566},{-2.25,1.20433456689},{-2.15,1.26668446429},{-2.05,1.1926046099},{-1.95,1.23880307623},{-1.85,1.22355832663},{-1.75,1.27446788441},{-1.65,1.31494295501},{-1.55,1.29624779698},{-1.45,1.28441941111},{-1.35,1.31968381752},{-1.25,1.27314551402},{-1.15,1.3218460166},{-1.05,1.34140131382},{-0.95,1.28057836107},{-0.85,1.43095136071},{-0.75,1.40666288888},{-0.65,1.37950349423},{-0.55,1.42306528739},{-0.45,1.45182769293},{-0.35,1.41457572895},{-0.25,1.51600504367},{-0.15,1.4678256748},{-0.05,1.54833434117},{0.05,1.60193334274},{0.15,1.41200782513},{0.25,1.54589253552},{0.35,1.49242329869},{0.45,1.51538849761},{0.55,1.53072350917},{0.65,1.53608257366},{0.75,1.47962734175},{0.85,1.54897654142},{0.95,1.5804323241},{1.05,1.53966005624},{1.15,1.56260869068},{1.25,1.49842194003},{1.35,1.5919749266},{1.45,1.64073074038},{1.55,1.48298608163},{1.65,1.58499615622},{1.75,1.49283444229},{1.85,1.5061660999},{1.95,1.64796604419},{2.05,1.47970600592},{2.15,1.65114799168},{2.25,1.47434357933},{2.35,1.48899294295},{2.45,1.60378083086},{2.55,1.45643505393},{2.65,1.48321956219},{2.75,1.42072460533},{2.85,1.40906263961},{2.95,1.54499473572},{3.05,1.35912468728},{3.15,1.31618618435},{3.25,1.34366522403},{3.35,1.45683654687},{3.45,1.34550952186},{3.55,1.39723420723},{3.65,1.34191339666},{3.75,1.38088958328},{3.85,1.41107955528},{3.95,1.37839277274},{4.05,1.26914208655},{4.15,1.30938895401},{4.25,1.48009387436},{4.35,1.27063314853},{4.45,1.1850458013},{4.55,1.26131188869},{4.65,1.26049915437},{4.75,1.22562357378},{4.85,1.25016480799},{4.95,1.25676141466},{5.05,1.05151438021},{5.15,1.18504423254},{5.25,1.12766950296},{5.35,1.01871234028},{5.45,1.07799369689},{5.55,1.08725625839},{5.65,1.03865486182},{5.75,0.989944860518},{5.85,1.05432193837},{5.95,0.934672313371},{6.05,1.13256094389},{6.15,0.966459062364},{6.25,1.03371765895},{6.35,0.943830399286},{6.45,0.943135959708},{6.55,0.906675614651},{6.65,0.824226539772},{6.75,0.925428349921},{6.85,0.702953954594},{6.95,0.9039980132},{7.05,0.815673493991},{7.15,0.897225552973},{7.25,0.804904663086},{7.35,0.767460053967},{7.45,0.701862335205},{7.55,0.711360468525},{7.65,0.729547743364},{7.75,0.654308056009},{7.85,0.688321026051},{7.95,0.729954678079},{8.05,0.622613502841},{8.15,0.726271326949},{8.25,0.50564312827},{8.35,0.568169753616},{8.45,0.565833782328},{8.55,0.601683772467},{8.65,0.602515960907},{8.75,0.473332528507},{8.85,0.442601686365},{8.95,0.531747066613},{9.05,0.546190198263},{9.15,0.464966577428},{9.25,0.398704555673},{9.35,0.469693422318},{9.45,0.45794125138},{9.55,0.442094376944},{9.65,0.350528144836},{9.75,0.323999627431},{9.85,0.323719297137},{9.95,0.273578143511},{10.05,0.26226392843},{10.15,0.352108872967},{10.25,0.294116009487},{10.35,0.273776834661},{10.45,0.253441897306},{10.55,0.239801721012},{10.65,0.22176174837},{10.75,0.323110364518},{10.85,0.227880409786},{10.95,0.279393361165},{11.05,0.240160439231},{11.15,0.192949071527},{11.25,0.173999920487},{11.35,0.178013333103},{11.45,0.224073875241},{11.55,0.166362519358},{11.65,0.142873048782},{11.75,0.152230076168},{11.85,0.187382964527},{11.95,0.175829193809},{12.05,0.114829084148},{12.15,0.13906567237},{12.25,0.118078128712},{12.35,0.104767297444},{12.45,0.0964199401237},{12.55,0.0946534030578},{12.65,0.107460745743},{12.75,0.0777932303292},{12.85,0.0905903302706},{12.95,0.0868433952332},{13.05,0.0611176418536},{13.15,0.0805806463415},{13.25,0.0859790601228},{13.35,0.072021561861},{13.45,0.0732973085509},{13.55,0.107137214054},{13.65,0.0554930473629},{13.75,0.051479029028},{13.85,0.0782147212462},{13.95,0.0864722662502},{14.05,0.0457041184107},{14.15,0.0484961271286},{14.25,0.0408768355846},{14.35,0.0393321789228},{14.45,0.0336796503801},{14.55,0.0244615446119},{14.65,0.0207284566234},{14.75,0.0235399667706},{14.85,0.0293374806643},{14.95,0.0421227564414},{15.05,0.0188810154796},{15.15,0.0101595640182},{15.25,0.0181682854891},{15.35,0.0777972042561},{15.45,0.0480607648691},{15.55,0.0242716148496},{15.65,0.00618906538276},{15.75,0.0267210435122},{15.85,0.0150769775112},{15.95,0.0125254889329},{16.05,0.0105770801504},{16.15,0.0111337684095},{16.25,0.0129430061206},{16.35,0.0170717785756},{16.45,0.00628262651818},{16.55,0.0370197817683},{16.65,0.0103915172319},{16.75,0.013638866134},{16.85,0.0132213495672},{16.95,0.0041751631846},{17.05,0.00473185162991},{17.15,0.00640191696584},{17.25,0.00547410299381},{17.35,0.0},{17.45,0.0119688007981},{17.55,0.00205974709243},{17.65,0.0128038339317},{17.75,0.00890701450408},{17.85,0.00640191696584},{17.95,0.0},{18.05,0.00807198230177},{18.15,0.00347930262797},{18.25,0.0},{18.35,0.00501019600779},{18.45,0.00473185162991},{18.55,0.00417516333982},{18.65,0.0},{18.75,0.0},{18.85,0.00194840948097},{18.95,0.0},{19.05,0.0},{19.15,0.0},{19.25,0.0},{19.35,0.0},{19.45,0.0},{19.55,0.0},{19.65,0.0},{19.75,0.0},{19.85,0.0},{19.95,0.0},{20.05,0.0},{20.15,0.0},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.0},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU10 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.000278344203252},{-21.35,0.0},{-21.25,0.0},{-21.15,0.0},{-21.05,0.0},{-20.95,0.0},{-20.85,0.0},{-20.75,0.0},{-20.65,0.0},{-20.55,0.000278344203252},{-20.45,0.0},{-20.35,0.000139172101626},{-20.25,0.0},{-20.15,0.0},{-20.05,9.27814010841e-05},{-19.95,0.00015905383043},{-19.85,0.0},{-19.75,0.000278344203252},{-19.65,0.000695860537235},{-19.55,0.000695860537235},{-19.45,0.000139172107447},{-19.35,0.000139172101626},{-19.25,0.000278344214894},{-19.15,3.47930254065e-05},{-19.05,0.000649469826991},{-18.95,0.000231953512412},{-18.85,0.000835032609757},{-18.75,0.000222675362602},{-18.65,0.000238580745645},{-18.55,0.0},{-18.45,0.000167006521951},{-18.35,0.00047716149129},{-18.25,0.000473185162991},{-18.15,0.00148450241735},{-18.05,0.00528853992},{-17.95,0.000974204701682},{-17.85,0.00194840948097},{-17.75,0.000927814049646},{-17.65,0.000501019569735},{-17.55,0.00125254892434},{-17.45,0.000815150926688},{-17.35,0.000723694947859},{-17.25,0.00208758166991},{-17.15,0.00236592581496},{-17.05,0.00111337686674},{-16.95,0.00210023366592},{-16.85,0.00556688420475},{-16.75,0.00126994540915},{-16.65,0.0017363377625},{-16.55,0.00259074224876},{-16.45,0.00354888880004},{-16.35,0.00235200859606},{-16.25,0.00233278955732},{-16.15,0.00278344201414},{-16.05,0.00232984401562},{-15.95,0.00292261431997},{-15.85,0.00286815542242},{-15.75,0.00379560278221},{-15.65,0.00345320790075},{-15.55,0.00393161177635},{-15.45,0.00559007935226},{-15.35,0.00567246305531},{-15.25,0.00470865642031},{-15.15,0.00638336042563},{-15.05,0.00557367321922},{-14.95,0.00573919252271},{-14.85,0.0075694165296},{-14.75,0.00652369235953},{-14.65,0.00701427400112},{-14.55,0.00551776456482},{-14.45,0.0102671059695},{-14.35,0.00643576963528},{-14.25,0.00836772285402},{-14.15,0.0121717602015},{-14.05,0.0123574328872},{-13.95,0.0137350212444},{-13.85,0.011992322727},{-13.75,0.0132332793304},{-13.65,0.0157119071306},{-13.55,0.0123244629966},{-13.45,0.0118141648946},{-13.35,0.0152263457959},{-13.25,0.0163334747578},{-13.15,0.0179686654698},{-13.05,0.0167287207451},{-12.95,0.0188614820179},{-12.85,0.0237133063159},{-12.75,0.0219196061293},{-12.65,0.0234209957123},{-12.55,0.027606036928},{-12.45,0.0300774117311},{-12.35,0.0271099642532},{-12.25,0.0259288330755},{-12.15,0.0302379836076},{-12.05,0.0284300183737},{-11.95,0.0352147593643},{-11.85,0.0452645268934},{-11.75,0.041003480812},{-11.65,0.0441096506336},{-11.55,0.0569946389449},{-11.45,0.0562485858534},{-11.35,0.0469305979181},{-11.25,0.0622674174931},{-11.15,0.0549729832432},{-11.05,0.0681126295631},{-10.95,0.0686658658938},{-10.85,0.0668138820633},{-10.75,0.0686086813609},{-10.65,0.0734880440297},{-10.55,0.0754096432204},{-10.45,0.100609981652},{-10.35,0.0811541794212},{-10.25,0.0937223402338},{-10.15,0.0942960619926},{-10.05,0.103992738934},{-9.95,0.118296288497},{-9.85,0.126162658199},{-9.75,0.111384450277},{-9.65,0.143498220414},{-9.55,0.128678309323},{-9.45,0.149264231449},{-9.35,0.138339765982},{-9.25,0.164058442457},{-9.15,0.158605290139},{-9.05,0.164422347329},{-8.95,0.168874099265},{-8.85,0.195549511519},{-8.75,0.188219626245},{-8.65,0.200196889348},{-8.55,0.216737747192},{-8.45,0.222191072279},{-8.35,0.237378616333},{-8.25,0.239289038109},{-8.15,0.239940141019},{-8.05,0.258149779398},{-7.95,0.258404464081},{-7.85,0.282443553004},{-7.75,0.282376389511},{-7.65,0.299673742932},{-7.55,0.334109755694},{-7.45,0.333883637835},{-7.35,0.340874033719},{-7.25,0.349797325247},{-7.15,0.372467631385},{-7.05,0.359090141628},{-6.95,0.397765765997},{-6.85,0.375012315469},{-6.75,0.419057717542},{-6.65,0.433452701694},{-6.55,0.46907258486},{-6.45,0.44800510383},{-6.35,0.495884937217},{-6.25,0.499092857436},{-6.15,0.515899286491},{-6.05,0.565985807188},{-5.95,0.523163389812},{-5.85,0.572775218408},{-5.75,0.57283581105},{-5.65,0.624461177357},{-5.55,0.612677799229},{-5.45,0.621575264026},{-5.35,0.658628983931},{-5.25,0.689621104365},{-5.15,0.672904633844},{-5.05,0.681291378334},{-4.95,0.708398956691},{-4.85,0.716347071158},{-4.75,0.712876686953},{-4.65,0.799163059216},{-4.55,0.769237027799},{-4.45,0.821831215429},{-4.35,0.827402203335},{-4.25,0.800032643759},{-4.15,0.843997486496},{-4.05,0.867821868037},{-3.95,0.857666837647},{-3.85,0.939878514926},{-3.75,0.947455026053},{-3.65,0.938973577737},{-3.55,0.955586226159},{-3.45,1.00883027427},{-3.35,1.0459674566},{-3.25,1.01751006457},{-3.15,1.08103128382},{-3.05,1.10747245434},{-2.95,1.05639456654},{-2.85,1.06544754453},{-2.75,1.14499422399},{-2.65,1.08122877277},{-2.55,1.1887058141},{-2.45,1.12890826769},{-2.35,1.13594853154},{-2.25,1.19340031378},{-2.15,1.20596218759},{-2.05,1.24267025813},{-1.95,1.19629960413},{-1.85,1.25151091663},{-1.75,1.29676259862},{-1.65,1.30187040787},{-1.55,1.3088305974},{-1.45,1.38401874117},{-1.35,1.38922845525},{-1.25,1.38448537384},{-1.15,1.37360972945},{-1.05,1.40045414201},{-0.95,1.42011089008},{-0.85,1.41819131115},{-0.75,1.48588762692},{-0.65,1.43330625305},{-0.55,1.45126166754},{-0.45,1.44190257289},{-0.35,1.43936291863},{-0.25,1.39658698357},{-0.15,1.57879780387},{-0.05,1.52233501135},{0.05,1.59766117616},{0.15,1.47221708687},{0.25,1.57537802983},{0.35,1.53639966388},{0.45,1.55474589813},{0.55,1.56042316551},{0.65,1.51393168491},{0.75,1.50380277999},{0.85,1.55889298775},{0.95,1.60506104321},{1.05,1.53374852083},{1.15,1.50247249603},{1.25,1.57568056971},{1.35,1.62575488365},{1.45,1.60051198705},{1.55,1.52000705473},{1.65,1.59941134274},{1.75,1.64401968047},{1.85,1.55737347},{1.95,1.58586397418},{2.05,1.62011549365},{2.15,1.52694386449},{2.25,1.53091092801},{2.35,1.5004004475},{2.45,1.52875689205},{2.55,1.54378499349},{2.65,1.53353934757},{2.75,1.46569079189},{2.85,1.49920307913},{2.95,1.5230969164},{3.05,1.4979977734},{3.15,1.5165625},{3.25,1.43547072104},{3.35,1.42887521904},{3.45,1.49747385298},{3.55,1.520278258},{3.65,1.42576353891},{3.75,1.58262513915},{3.85,1.31877425449},{3.95,1.37431002498},{4.05,1.32503382365},{4.15,1.34007847797},{4.25,1.44905555264},{4.35,1.27279596259},{4.45,1.27139404603},{4.55,1.23541029444},{4.65,1.24922122028},{4.75,1.18421039385},{4.85,1.27609677636},{4.95,1.23250737684},{5.05,1.14571873039},{5.15,1.14736205176},{5.25,1.15651052714},{5.35,1.08498205817},{5.45,1.10129536473},{5.55,1.12171203212},{5.65,1.04178666689},{5.75,1.10755952647},{5.85,1.077167293},{5.95,0.967568351196},{6.05,1.10943542358},{6.15,1.04214862012},{6.25,1.02067867402},{6.35,1.04653679109},{6.45,1.02465201805},{6.55,0.930761770585},{6.65,0.969994069252},{6.75,0.950861807645},{6.85,0.891420328392},{6.95,0.889300129201},{7.05,0.843101879158},{7.15,0.818408821203},{7.25,0.838807406491},{7.35,0.816775641643},{7.45,0.787400607405},{7.55,0.750052897135},{7.65,0.761414477387},{7.75,0.661967310412},{7.85,0.669692758413},{7.95,0.673980311344},{8.05,0.591545479429},{8.15,0.598019338677},{8.25,0.591748174475},{8.35,0.643953815583},{8.45,0.58256144839},{8.55,0.546338804965},{8.65,0.527634402356},{8.75,0.517390222992},{8.85,0.483762234072},{8.95,0.526152812789},{9.05,0.460127342681},{9.15,0.495363844202},{9.25,0.433708992004},{9.35,0.502734851837},{9.45,0.410629607819},{9.55,0.380511818351},{9.65,0.348754716956},{9.75,0.338463374547},{9.85,0.328114804767},{9.95,0.322141140322},{10.05,0.334273501805},{10.15,0.275641291396},{10.25,0.318586090088},{10.35,0.2900149428},{10.45,0.230938580571},{10.55,0.240988276555},{10.65,0.314779763693},{10.75,0.293931494819},{10.85,0.245491162695},{10.95,0.258886004603},{11.05,0.220575685086},{11.15,0.183071360869},{11.25,0.287973048323},{11.35,0.234328440766},{11.45,0.197748091486},{11.55,0.164772721786},{11.65,0.134212515571},{11.75,0.163244666475},{11.85,0.157004094893},{11.95,0.155311182926},{12.05,0.113297687636},{12.15,0.167101415721},{12.25,0.120254820043},{12.35,0.155209015577},{12.45,0.0851907283068},{12.55,0.121296975671},{12.65,0.0992297089618},{12.75,0.110871263452},{12.85,0.101812124252},{12.95,0.0776011022654},{13.05,0.0612969636917},{13.15,0.0677768170834},{13.25,0.0698087283543},{13.35,0.0768997833647},{13.45,0.0852096339931},{13.55,0.0754080861807},{13.65,0.0709414689437},{13.75,0.052957561281},{13.85,0.0518499612808},{13.95,0.0814064025879},{14.05,0.0502477543695},{14.15,0.0632026910782},{14.25,0.0367656401966},{14.35,0.041121696171},{14.45,0.0862867087126},{14.55,0.0494988809029},{14.65,0.0204368875577},{14.75,0.019205750227},{14.85,0.0452309340239},{14.95,0.0249118059874},{15.05,0.0224902113279},{15.15,0.0132491838932},{15.25,0.0152796318657},{15.35,0.0247447997332},{15.45,0.0282171443105},{15.55,0.0656892359257},{15.65,0.0128466555705},{15.75,0.0162058191167},{15.85,0.029226142168},{15.95,0.016859705959},{16.05,0.0209314852953},{16.15,0.0103605902857},{16.25,0.022685052827},{16.35,0.0171877555549},{16.45,0.0099276099354},{16.55,0.00793281011283},{16.65,0.00630913550655},{16.75,0.0215716771781},{16.85,0.019623266533},{16.95,0.0042795422487},{17.05,0.0102059543133},{17.15,0.0247726347297},{17.25,0.00705138656},{17.35,0.00417516306043},{17.45,0.0},{17.55,0.00668026087806},{17.65,0.0100203920156},{17.75,0.0130821783096},{17.85,0.0097420476377},{17.95,0.0114121129736},{18.05,0.0},{18.15,0.00320095848292},{18.25,0.00146130705252},{18.35,0.00250509784867},{18.45,0.00236592581496},{18.55,0.0036184748169},{18.65,0.0},{18.75,0.0},{18.85,0.00222675362602},{18.95,0.0},{19.05,0.00111337681301},{19.15,0.0},{19.25,0.00139172107447},{19.35,0.00278344214894},{19.45,0.000695860537235},{19.55,0.0},{19.65,0.000556688406505},{19.75,0.0},{19.85,0.0},{19.95,0.0},{20.05,0.0},{20.15,0.0},{20.25,0.00167006521951},{20.35,0.000556688406505},{20.45,0.0},{20.55,0.0},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU11 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.000278344203252},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.0},{-21.35,0.000278344203252},{-21.25,0.000278344203252},{-21.15,0.0},{-21.05,0.0},{-20.95,0.000185562802168},{-20.85,0.000556688406505},{-20.75,3.47930254065e-05},{-20.65,0.0},{-20.55,0.000278344203252},{-20.45,0.000278344203252},{-20.35,0.000139172101626},{-20.25,9.27814010841e-05},{-20.15,0.000417516304879},{-20.05,0.000835032609757},{-19.95,0.000139172101626},{-19.85,5.56688406505e-05},{-19.75,9.27814010841e-05},{-19.65,0.000119290372822},{-19.55,0.000185562802168},{-19.45,7.9526915215e-05},{-19.35,0.000139172101626},{-19.25,0.000185562802168},{-19.15,5.56688406505e-05},{-19.05,0.000278344203252},{-18.95,0.000278344203252},{-18.85,0.000463907024823},{-18.75,0.00111337681301},{-18.65,0.000927814049646},{-18.55,0.000139172101626},{-18.45,0.000649469826991},{-18.35,0.000389681896195},{-18.25,0.000457279783274},{-18.15,0.000334013043903},{-18.05,0.000531384382736},{-17.95,0.00104379083496},{-17.85,0.000733816572888},{-17.75,0.000642332821511},{-17.65,0.00108244973752},{-17.55,0.00176284669174},{-17.45,0.000922015169635},{-17.35,0.000631627268516},{-17.25,0.000884152181885},{-17.15,0.00159053837082},{-17.05,0.00136079390844},{-16.95,0.00123708539953},{-16.85,0.00178140290082},{-16.75,0.00152532622218},{-16.65,0.0018710916241},{-16.55,0.00204522486614},{-16.45,0.00289168705543},{-16.35,0.00268662672328},{-16.25,0.00136146629634},{-16.15,0.00259787920449},{-16.05,0.00328214218219},{-15.95,0.003373869215},{-15.85,0.00296900497797},{-15.75,0.00316229959329},{-15.65,0.00407994028769},{-15.55,0.00301168441772},{-15.45,0.00429952968942},{-15.35,0.00500340687066},{-15.25,0.00461944335928},{-15.15,0.00474650138303},{-15.05,0.00603624886157},{-14.95,0.00752097429061},{-14.85,0.00748121069402},{-14.75,0.0059573393729},{-14.65,0.0068958796246},{-14.55,0.00751915987995},{-14.45,0.0101618454105},{-14.35,0.0088810356458},{-14.25,0.00935508129073},{-14.15,0.0101847153112},{-14.05,0.0139581438373},{-13.95,0.0138015344545},{-13.85,0.0107149981164},{-13.75,0.0146563688914},{-13.65,0.0153582220276},{-13.55,0.014057614107},{-13.45,0.0140756524526},{-13.35,0.016237487793},{-13.25,0.0156678989016},{-13.15,0.0186181350991},{-13.05,0.0175605063226},{-12.95,0.0203228636876},{-12.85,0.020231316487},{-12.75,0.0294721200485},{-12.65,0.0268851946562},{-12.55,0.023218428423},{-12.45,0.0296339489693},{-12.35,0.0307719989489},{-12.25,0.0413000125759},{-12.15,0.0360221360859},{-12.05,0.035290161399},{-11.95,0.0357763465315},{-11.85,0.0374682847305},{-11.75,0.0452872212728},{-11.65,0.0540243231732},{-11.55,0.0480720028281},{-11.45,0.0533419710845},{-11.35,0.0485463424733},{-11.25,0.0519383159308},{-11.15,0.0570346942315},{-11.05,0.0613722559772},{-10.95,0.0686316028718},{-10.85,0.0688971685449},{-10.75,0.0776927217524},{-10.65,0.0751815228849},{-10.55,0.0809108145694},{-10.45,0.0951689248798},{-10.35,0.093334493711},{-10.25,0.0974052391242},{-10.15,0.0901681612505},{-10.05,0.102675221087},{-9.95,0.109410408003},{-9.85,0.11304907258},{-9.75,0.113743217175},{-9.65,0.131254891514},{-9.55,0.139611424212},{-9.45,0.145431074985},{-9.35,0.148575653523},{-9.25,0.159107624401},{-9.15,0.164145850802},{-9.05,0.175746442537},{-8.95,0.163018578575},{-8.85,0.168171201433},{-8.75,0.201543436264},{-8.65,0.210790815666},{-8.55,0.229672665468},{-8.45,0.218472448628},{-8.35,0.222881802274},{-8.25,0.262597832053},{-8.15,0.25294140625},{-8.05,0.252452660556},{-7.95,0.263769405022},{-7.85,0.289969009916},{-7.75,0.293761677719},{-7.65,0.292895323478},{-7.55,0.32438889351},{-7.45,0.330623682242},{-7.35,0.368133616644},{-7.25,0.359060728267},{-7.15,0.380402337152},{-7.05,0.380020032499},{-6.95,0.37741818126},{-6.85,0.389853185829},{-6.75,0.396431306944},{-6.65,0.446947917846},{-6.55,0.463888201032},{-6.45,0.460597172795},{-6.35,0.463586813805},{-6.25,0.497733882436},{-6.15,0.522156937527},{-6.05,0.53648886836},{-5.95,0.518045386244},{-5.85,0.582819012487},{-5.75,0.582002635137},{-5.65,0.603895894597},{-5.55,0.600485938769},{-5.45,0.639178885106},{-5.35,0.634530488079},{-5.25,0.674830291817},{-5.15,0.681721647493},{-5.05,0.689042288073},{-4.95,0.69239368465},{-4.85,0.731818091861},{-4.75,0.683911500864},{-4.65,0.783099691376},{-4.55,0.796805815736},{-4.45,0.802588149146},{-4.35,0.81379617628},{-4.25,0.820559644248},{-4.15,0.842025193111},{-4.05,0.88573977412},{-3.95,0.852278529783},{-3.85,0.935454086111},{-3.75,0.935320408359},{-3.65,1.00252751847},{-3.55,0.942875013112},{-3.45,1.00283017366},{-3.35,1.05919235675},{-3.25,1.0487825131},{-3.15,1.07414925597},{-3.05,1.03937428162},{-2.95,1.07830925576},{-2.85,1.07508647382},{-2.75,1.16587024839},{-2.65,1.13436166954},{-2.55,1.19013269893},{-2.45,1.19989548337},{-2.35,1.20777381015},{-2.25,1.24003798602},{-2.15,1.26837511528},{-2.05,1.24788478493},{-1.95,1.24870095029},{-1.85,1.31625798757},{-1.75,1.2703491276},{-1.65,1.35505670292},{-1.55,1.29097033775},{-1.45,1.35190270465},{-1.35,1.39740921164},{-1.25,1.35089311974},{-1.15,1.39477737336},{-1.05,1.46042318804},{-0.95,1.35319240896},{-0.85,1.41932713328},{-0.75,1.49492998571},{-0.65,1.45506718349},{-0.55,1.45618481721},{-0.45,1.51391493236},{-0.35,1.48164944522},{-0.25,1.50079875141},{-0.15,1.51788178918},{-0.05,1.51348876953},{0.05,1.57550805692},{0.15,1.55831367407},{0.25,1.57048410309},{0.35,1.63487050332},{0.45,1.55547722158},{0.55,1.60095009862},{0.65,1.59011717624},{0.75,1.62238031633},{0.85,1.4611529642},{0.95,1.62427442455},{1.05,1.59670199988},{1.15,1.59321485763},{1.25,1.57805444163},{1.35,1.61134890293},{1.45,1.53131089288},{1.55,1.66144975879},{1.65,1.70963952078},{1.75,1.56722840518},{1.85,1.51933467115},{1.95,1.64112664779},{2.05,1.58018699852},{2.15,1.64599211049},{2.25,1.51596825489},{2.35,1.56320072586},{2.45,1.52151408948},{2.55,1.50732454276},{2.65,1.57867867298},{2.75,1.52776470556},{2.85,1.49280632867},{2.95,1.53399489401},{3.05,1.43289862739},{3.15,1.52133408512},{3.25,1.49820577927},{3.35,1.51520397222},{3.45,1.47109256929},{3.55,1.47668956677},{3.65,1.53414658546},{3.75,1.43331355908},{3.85,1.34697501267},{3.95,1.47969196865},{4.05,1.36735392184},{4.15,1.38065240495},{4.25,1.31048968416},{4.35,1.38525057602},{4.45,1.25281609131},{4.55,1.30437494},{4.65,1.31837284483},{4.75,1.18926093158},{4.85,1.22585355779},{4.95,1.27255249023},{5.05,1.18346981886},{5.15,1.15875332415},{5.25,1.11769017217},{5.35,1.08880972762},{5.45,1.07429833827},{5.55,1.15708994951},{5.65,1.15813688885},{5.75,1.15303254128},{5.85,1.09333178742},{5.95,1.05270642358},{6.05,1.04667436229},{6.15,1.10089697338},{6.25,1.02821391933},{6.35,0.937476764547},{6.45,0.906541451396},{6.55,0.909503021016},{6.65,0.887295039711},{6.75,0.928979573163},{6.85,0.902646240647},{6.95,0.839569801508},{7.05,0.80945589727},{7.15,0.745435378131},{7.25,0.705526613722},{7.35,0.856037730452},{7.45,0.705304477601},{7.55,0.7924731207},{7.65,0.78498063521},{7.75,0.629853121317},{7.85,0.676719161382},{7.95,0.614825049867},{8.05,0.600252063069},{8.15,0.721881758695},{8.25,0.615379098745},{8.35,0.614230579511},{8.45,0.605589290061},{8.55,0.556959727113},{8.65,0.533383723982},{8.75,0.491388726167},{8.85,0.509551665008},{8.95,0.543538155316},{9.05,0.49968216267},{9.15,0.515892389252},{9.25,0.498915536063},{9.35,0.465676698528},{9.45,0.463314926415},{9.55,0.40537728554},{9.65,0.428902176191},{9.75,0.354809016618},{9.85,0.362962128395},{9.95,0.351118320372},{10.05,0.358580681585},{10.15,0.312107221729},{10.25,0.290923935328},{10.35,0.280249216223},{10.45,0.255879767398},{10.55,0.267627122159},{10.65,0.282836384243},{10.75,0.276921777164},{10.85,0.223987030827},{10.95,0.294959023734},{11.05,0.206573159354},{11.15,0.196595552233},{11.25,0.217073696},{11.35,0.182886060079},{11.45,0.240244184222},{11.55,0.187463413585},{11.65,0.15813073488},{11.75,0.142901402933},{11.85,0.167901923858},{11.95,0.126078907806},{12.05,0.113799123203},{12.15,0.160968604455},{12.25,0.11691144072},{12.35,0.11968800793},{12.45,0.11620669434},{12.55,0.133095795254},{12.65,0.10785602311},{12.75,0.133339826451},{12.85,0.083410482558},{12.95,0.0866055315191},{13.05,0.076276251248},{13.15,0.0880200321024},{13.25,0.0810823163321},{13.35,0.0573439684781},{13.45,0.0686220308629},{13.55,0.0619281908361},{13.65,0.0515679041545},{13.75,0.0677902852335},{13.85,0.0713417621759},{13.95,0.0506586450519},{14.05,0.0567203627692},{14.15,0.0666773557663},{14.25,0.0465155977469},{14.35,0.0336121718089},{14.45,0.0496917649319},{14.55,0.0502820646062},{14.65,0.0237462408841},{14.75,0.0316173705188},{14.85,0.0373155213892},{14.95,0.0187975128492},{15.05,0.0331971863906},{15.15,0.0120054255975},{15.25,0.019177916646},{15.35,0.0530842159476},{15.45,0.0797456130385},{15.55,0.0410756511348},{15.65,0.0181780182398},{15.75,0.0151101137911},{15.85,0.0274765491486},{15.95,0.016923327744},{16.05,0.00927234161645},{16.15,0.0131378471851},{16.25,0.0135344872251},{16.35,0.0210428223014},{16.45,0.0094358690083},{16.55,0.00894180778414},{16.65,0.0743179023266},{16.75,0.0146826570854},{16.85,0.0265818722546},{16.95,0.00352569328},{17.05,0.00570605633159},{17.15,0.00723694963381},{17.25,0.00612357258797},{17.35,0.00723694963381},{17.45,0.00590089708567},{17.55,0.00779363761346},{17.65,0.00261643566191},{17.75,0.00709777744487},{17.85,0.0164223089814},{17.95,0.0},{18.05,0.00217108484358},{18.15,0.00250509784867},{18.25,0.0036184748169},{18.35,0.00445350725204},{18.45,0.00445350725204},{18.55,0.00222675362602},{18.65,0.00473185162991},{18.75,0.00153089314699},{18.85,0.00194840948097},{18.95,0.000835032667965},{19.05,0.0},{19.15,0.00194840948097},{19.25,0.00111337681301},{19.35,0.0},{19.45,0.00167006521951},{19.55,0.0},{19.65,0.0},{19.75,0.00194840948097},{19.85,0.0},{19.95,0.0},{20.05,0.0},{20.15,0.00111337681301},{20.25,0.000278344203252},{20.35,0.000835032609757},{20.45,0.0},{20.55,0.0},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU12 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.000278344203252},{-22.45,0.0},{-22.35,0.000556688406505},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.000278344203252},{-21.35,0.000139172101626},{-21.25,0.000139172101626},{-21.15,0.0},{-21.05,0.0},{-20.95,0.0},{-20.85,0.0},{-20.75,3.47930254065e-05},{-20.65,0.000139172101626},{-20.55,6.95860508131e-05},{-20.45,0.000278344203252},{-20.35,9.27814010841e-05},{-20.25,0.000278344203252},{-20.15,0.000139172101626},{-20.05,0.0},{-19.95,9.27814010841e-05},{-19.85,0.000231953512412},{-19.75,0.000835032609757},{-19.65,0.000278344214894},{-19.55,0.000334013043903},{-19.45,0.000198817296353},{-19.35,0.000371125604336},{-19.25,0.000357871143413},{-19.15,8.35032609757e-05},{-19.05,0.00167006521951},{-18.95,0.000334013043903},{-18.85,0.000487102370244},{-18.75,0.000185562802168},{-18.65,0.000417516333982},{-18.55,0.00088142332},{-18.45,0.000343836953535},{-18.35,0.000869825656991},{-18.25,0.00059951060953},{-18.15,0.000487102350841},{-18.05,0.000989668278231},{-17.95,0.000792210420164},{-17.85,0.000656097062996},{-17.75,0.000638554365758},{-17.65,0.000514936773106},{-17.55,0.000900525380583},{-17.45,0.000734828710556},{-17.35,0.00090461869591},{-17.25,0.00178604200482},{-17.15,0.00107214068649},{-17.05,0.00130265086889},{-16.95,0.00180923731791},{-16.85,0.00190665777773},{-16.75,0.00200891915871},{-16.65,0.00202519408074},{-16.55,0.0016790440967},{-16.45,0.00217288059573},{-16.35,0.00206560700348},{-16.25,0.00154120226701},{-16.15,0.00266211250654},{-16.05,0.00308435470671},{-15.95,0.00264103346786},{-15.85,0.00317776296288},{-15.75,0.00595080749742},{-15.65,0.00429445363226},{-15.55,0.00394408489173},{-15.45,0.00489243463828},{-15.35,0.00447063629444},{-15.25,0.00501019579749},{-15.15,0.00664417942365},{-15.05,0.00484973858385},{-14.95,0.00602958612628},{-14.85,0.00670461580157},{-14.75,0.00751529335976},{-14.65,0.00609495762353},{-14.55,0.00706159234047},{-14.45,0.0100032098499},{-14.35,0.00778637657995},{-14.25,0.0111569638054},{-14.15,0.0111365247481},{-14.05,0.0127046214472},{-13.95,0.0136685926937},{-13.85,0.0147049775663},{-13.75,0.0115765037153},{-13.65,0.0140891285504},{-13.55,0.0149718887952},{-13.45,0.0146898269653},{-13.35,0.0177114809814},{-13.25,0.0176421109368},{-13.15,0.020727251205},{-13.05,0.0221913229851},{-12.95,0.0202350734484},{-12.85,0.0208631062616},{-12.75,0.0251377903589},{-12.65,0.0322621847164},{-12.55,0.0244975919309},{-12.45,0.0304636461241},{-12.35,0.0359736799629},{-12.25,0.0340994645741},{-12.15,0.0349417606383},{-12.05,0.0355016278549},{-11.95,0.0406955620822},{-11.85,0.040593866494},{-11.75,0.0532001957061},{-11.65,0.0504330898153},{-11.55,0.0521369631328},{-11.45,0.0531438645862},{-11.35,0.0577754918757},{-11.25,0.060735173586},{-11.15,0.0560949334601},{-11.05,0.0666712883191},{-10.95,0.0608815246386},{-10.85,0.0619627609253},{-10.75,0.0768387809632},{-10.65,0.0747019603999},{-10.55,0.0838203747406},{-10.45,0.0903120337066},{-10.35,0.100955560741},{-10.25,0.107251869798},{-10.15,0.100435704947},{-10.05,0.101276020635},{-9.95,0.110867459117},{-9.85,0.122578912852},{-9.75,0.119633537549},{-9.65,0.133271901959},{-9.55,0.137698474231},{-9.45,0.149433589161},{-9.35,0.136110673701},{-9.25,0.159555609537},{-9.15,0.167919960947},{-9.05,0.171727687235},{-8.95,0.167472910327},{-8.85,0.175408807815},{-8.75,0.184284193326},{-8.65,0.208613778943},{-8.55,0.205316106563},{-8.45,0.233114852386},{-8.35,0.221743897717},{-8.25,0.237476021021},{-8.15,0.249599076837},{-8.05,0.271264858265},{-7.95,0.274081236564},{-7.85,0.276243483306},{-7.75,0.308195514443},{-7.65,0.292052188162},{-7.55,0.329096795841},{-7.45,0.340620252821},{-7.35,0.353680414696},{-7.25,0.349659102846},{-7.15,0.372941854299},{-7.05,0.366611947586},{-6.95,0.377579803022},{-6.85,0.399303745128},{-6.75,0.424435698163},{-6.65,0.420626262796},{-6.55,0.438929215573},{-6.45,0.44828365907},{-6.35,0.473753704371},{-6.25,0.487701555365},{-6.15,0.502081357328},{-6.05,0.532882986525},{-5.95,0.554432208721},{-5.85,0.57208367623},{-5.75,0.580210542154},{-5.65,0.606125008666},{-5.55,0.627017889467},{-5.45,0.616276870754},{-5.35,0.664845072009},{-5.25,0.65828964549},{-5.15,0.68177198622},{-5.05,0.685625938801},{-4.95,0.700648357623},{-4.85,0.752577571827},{-4.75,0.733247692534},{-4.65,0.779937552206},{-4.55,0.785145999821},{-4.45,0.82306681357},{-4.35,0.815208266017},{-4.25,0.828495226797},{-4.15,0.859265610778},{-4.05,0.882736677369},{-3.95,0.902288141488},{-3.85,0.921713839431},{-3.75,0.915040676745},{-3.65,0.949987220238},{-3.55,0.951283950294},{-3.45,0.980547172919},{-3.35,1.04405461395},{-3.25,0.998217097616},{-3.15,1.05848997658},{-3.05,1.06393969116},{-2.95,1.06591995789},{-2.85,1.10904983407},{-2.75,1.1452803276},{-2.65,1.11291274163},{-2.55,1.0981170975},{-2.45,1.23761571895},{-2.35,1.17595243256},{-2.25,1.24596529382},{-2.15,1.25857225808},{-2.05,1.25612456223},{-1.95,1.30733447623},{-1.85,1.24751122613},{-1.75,1.2795377272},{-1.65,1.29711814495},{-1.55,1.34338831772},{-1.45,1.35792385491},{-1.35,1.35597164565},{-1.25,1.35913185101},{-1.15,1.31299510506},{-1.05,1.40911220639},{-0.95,1.36395970801},{-0.85,1.42354003107},{-0.75,1.46218945883},{-0.65,1.46833951512},{-0.55,1.459174496},{-0.45,1.47383146608},{-0.35,1.49198837534},{-0.25,1.5459737107},{-0.15,1.48717910365},{-0.05,1.55926521541},{0.05,1.56041336388},{0.15,1.55014280041},{0.25,1.54642221879},{0.35,1.57411735075},{0.45,1.58881613797},{0.55,1.56261922902},{0.65,1.55885926214},{0.75,1.59459687966},{0.85,1.55867965526},{0.95,1.56033782492},{1.05,1.59437996609},{1.15,1.5369377851},{1.25,1.60290354155},{1.35,1.57508264924},{1.45,1.5705979242},{1.55,1.62205941026},{1.65,1.62120815067},{1.75,1.5750256204},{1.85,1.55066078286},{1.95,1.54072196529},{2.05,1.56891478007},{2.15,1.51295513295},{2.25,1.49809184827},{2.35,1.6012463968},{2.45,1.57343874032},{2.55,1.50955667915},{2.65,1.52628568033},{2.75,1.50861743509},{2.85,1.46581815869},{2.95,1.5921494758},{3.05,1.54187164307},{3.15,1.56781232716},{3.25,1.47871266052},{3.35,1.46002523676},{3.45,1.44792298147},{3.55,1.49453254686},{3.65,1.3800607455},{3.75,1.45521185415},{3.85,1.3711901213},{3.95,1.39437749136},{4.05,1.38620589512},{4.15,1.37264746094},{4.25,1.37840391931},{4.35,1.361302733},{4.45,1.28504820692},{4.55,1.33582411701},{4.65,1.26257989261},{4.75,1.30703391063},{4.85,1.28419568423},{4.95,1.28620718058},{5.05,1.14774159879},{5.15,1.15049044885},{5.25,1.18361970515},{5.35,1.10200878278},{5.45,1.17282137073},{5.55,1.16006192803},{5.65,1.0728927693},{5.75,1.17703062488},{5.85,1.14598897194},{5.95,1.04290302896},{6.05,1.05969892679},{6.15,1.02419045766},{6.25,1.05697549356},{6.35,0.983010409171},{6.45,0.989440564756},{6.55,1.01195183463},{6.65,0.959813184077},{6.75,0.956135408866},{6.85,0.876549318842},{6.95,0.823503659095},{7.05,0.876629883488},{7.15,0.81741183737},{7.25,0.799915099412},{7.35,0.865305599011},{7.45,0.70295559372},{7.55,0.751287442501},{7.65,0.760145948407},{7.75,0.714358616986},{7.85,0.672483323816},{7.95,0.690818495846},{8.05,0.678184869835},{8.15,0.670687787338},{8.25,0.59191142979},{8.35,0.633765492541},{8.45,0.512945904451},{8.55,0.572061284105},{8.65,0.535561659665},{8.75,0.515151187106},{8.85,0.471983920133},{8.95,0.536068545589},{9.05,0.426986380082},{9.15,0.483519655366},{9.25,0.425758964137},{9.35,0.447447009893},{9.45,0.433811543151},{9.55,0.376216305779},{9.65,0.433674297744},{9.75,0.324769441472},{9.85,0.359060155021},{9.95,0.296017332847},{10.05,0.337678283225},{10.15,0.31594539333},{10.25,0.332171335094},{10.35,0.300727414878},{10.45,0.257717668771},{10.55,0.280980518886},{10.65,0.235950803132},{10.75,0.236367252895},{10.85,0.232882272168},{10.95,0.269599572206},{11.05,0.212824131244},{11.15,0.20131602696},{11.25,0.224876830628},{11.35,0.180139623037},{11.45,0.224769910177},{11.55,0.185324919851},{11.65,0.181428382067},{11.75,0.193501742381},{11.85,0.17350380509},{11.95,0.189564908488},{12.05,0.122039689792},{12.15,0.140653793258},{12.25,0.136972283804},{12.35,0.119989554087},{12.45,0.108290249539},{12.55,0.104938821478},{12.65,0.100469312002},{12.75,0.0999041581765},{12.85,0.0831719012488},{12.95,0.0758719898406},{13.05,0.0926796467074},{13.15,0.091541064413},{13.25,0.0732349678874},{13.35,0.0696179905876},{13.45,0.074312549371},{13.55,0.0794040127234},{13.65,0.0616887176738},{13.75,0.0649383511654},{13.85,0.0755622667425},{13.95,0.0673930355997},{14.05,0.0532369927356},{14.15,0.0814536376433},{14.25,0.0482190426658},{14.35,0.041133089198},{14.45,0.0386898447486},{14.55,0.0338597543099},{14.65,0.026743019882},{14.75,0.0302652935187},{14.85,0.037715640935},{14.95,0.0280699431896},{15.05,0.0188319734165},{15.15,0.015176717937},{15.25,0.0316330019165},{15.35,0.0587654225528},{15.45,0.0321808732473},{15.55,0.0378857387437},{15.65,0.0173305900473},{15.75,0.0265186131001},{15.85,0.0166658591479},{15.95,0.0133431255817},{16.05,0.0224762950093},{16.15,0.0150558907877},{16.25,0.00785549233357},{16.35,0.0194045688425},{16.45,0.00651652935673},{16.55,0.0150305873581},{16.65,0.00896268337965},{16.75,0.0125254889329},{16.85,0.0144182294607},{16.95,0.00518732382493},{17.05,0.0160743780434},{17.15,0.00719055905938},{17.25,0.0082389883697},{17.35,0.0187882333994},{17.45,0.00788641907275},{17.55,0.0070281913504},{17.65,0.00788641907275},{17.75,0.00480143772438},{17.85,0.00428650081158},{17.95,0.00322879292071},{18.05,0.00436072610319},{18.15,0.00194840940336},{18.25,0.00426794464389},{18.35,0.0119688007981},{18.45,0.00403599115089},{18.55,0.00296900483469},{18.65,0.0036184748169},{18.75,0.00264426996},{18.85,0.00208758166991},{18.95,0.0036184748169},{19.05,0.00194840948097},{19.15,0.00102059543133},{19.25,0.00334013043903},{19.35,0.0},{19.45,0.00139172107447},{19.55,0.000556688406505},{19.65,0.0},{19.75,0.0},{19.85,0.00167006521951},{19.95,0.0},{20.05,0.00139172107447},{20.15,0.0},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.0},{20.65,0.00111337681301},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU13 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,0.000278344203252},{-21.45,0.0},{-21.35,0.0},{-21.25,0.0},{-21.15,0.000139172101626},{-21.05,0.000278344203252},{-20.95,0.000556688406505},{-20.85,0.000185562802168},{-20.75,7.59120554325e-05},{-20.65,0.000649469826991},{-20.55,9.27814010841e-05},{-20.45,0.000139172101626},{-20.35,6.95860508131e-05},{-20.25,0.0},{-20.15,0.000278344203252},{-20.05,0.000278344203252},{-19.95,0.0},{-19.85,0.000208758152439},{-19.75,0.000347930268617},{-19.65,0.0},{-19.55,0.000278344214894},{-19.45,0.000185562802168},{-19.35,0.000347930268617},{-19.25,0.000313137250487},{-19.15,0.000119290372822},{-19.05,0.00031810766086},{-18.95,0.000243551185122},{-18.85,0.000649469826991},{-18.75,0.000250509800389},{-18.65,0.000510297715664},{-18.55,0.00058199245144},{-18.45,0.000445350725204},{-18.35,0.000471044045228},{-18.25,0.000471044045228},{-18.15,0.000492455151219},{-18.05,0.00120615824643},{-17.95,0.000760807531575},{-17.85,0.00131219412599},{-17.75,0.000795269207585},{-17.65,0.000573061625747},{-17.55,0.00106118735857},{-17.45,0.000823434985553},{-17.35,0.000579883758393},{-17.25,0.00109110929072},{-17.15,0.00116724989587},{-17.05,0.00152484214176},{-16.95,0.00122112300127},{-16.85,0.00163295269012},{-16.75,0.00199190084822},{-16.65,0.00178140295403},{-16.55,0.00164969865142},{-16.45,0.00246292442986},{-16.35,0.00204962559722},{-16.25,0.00151824115804},{-16.15,0.00372622090001},{-16.05,0.00378397670952},{-15.95,0.00317518578635},{-15.85,0.00291619094519},{-15.75,0.00382090698589},{-15.65,0.00326281268564},{-15.55,0.00330036723769},{-15.45,0.00514936794837},{-15.35,0.00492271610669},{-15.25,0.00507129583417},{-15.15,0.0057009017026},{-15.05,0.00621522272505},{-14.95,0.00742130697548},{-14.85,0.00683456076228},{-14.75,0.00607599254347},{-14.65,0.00723446426647},{-14.55,0.00772346718972},{-14.45,0.00921021082572},{-14.35,0.00874464710553},{-14.25,0.0111785864426},{-14.15,0.0104863159898},{-14.05,0.0122881416203},{-13.95,0.0140811962675},{-13.85,0.0120846336673},{-13.75,0.0145881854935},{-13.65,0.0127210445893},{-13.55,0.0145944656535},{-13.45,0.0157105016212},{-13.35,0.0146711598272},{-13.25,0.0166723253453},{-13.15,0.0161330484876},{-13.05,0.0193548222466},{-12.95,0.0192234721523},{-12.85,0.0236728901766},{-12.75,0.026454394605},{-12.65,0.0286081041609},{-12.55,0.0308807444951},{-12.45,0.0320291695771},{-12.35,0.0335934730611},{-12.25,0.0327642245322},{-12.15,0.0345489513409},{-12.05,0.0386992084142},{-11.95,0.0395780440127},{-11.85,0.0425620579588},{-11.75,0.0444386700789},{-11.65,0.0534948754585},{-11.55,0.0478240656298},{-11.45,0.0538759574616},{-11.35,0.0515976947633},{-11.25,0.0525649795237},{-11.15,0.0620812412086},{-11.05,0.0765603727453},{-10.95,0.0604519892878},{-10.85,0.0675165582984},{-10.75,0.0737901113438},{-10.65,0.0830492777833},{-10.55,0.0836046484132},{-10.45,0.0956815526876},{-10.35,0.0957852588781},{-10.25,0.0948866467143},{-10.15,0.100904518908},{-10.05,0.101404439505},{-9.95,0.11666155061},{-9.85,0.127567655585},{-9.75,0.120388637254},{-9.65,0.150227414312},{-9.55,0.143531561492},{-9.45,0.148867149125},{-9.35,0.150528296611},{-9.25,0.154607256721},{-9.15,0.166466501817},{-9.05,0.181047844164},{-8.95,0.183304967317},{-8.85,0.193776051442},{-8.75,0.200182474577},{-8.65,0.213656911448},{-8.55,0.226136523068},{-8.45,0.230249423758},{-8.35,0.235381634375},{-8.25,0.24590627026},{-8.15,0.262369714989},{-8.05,0.272818411349},{-7.95,0.286469045994},{-7.85,0.300580254084},{-7.75,0.308256868552},{-7.65,0.303178439097},{-7.55,0.34076637763},{-7.45,0.36485993898},{-7.35,0.378453102056},{-7.25,0.357793405515},{-7.15,0.393422244115},{-7.05,0.381605068694},{-6.95,0.415113282815},{-6.85,0.42513544028},{-6.75,0.45055514492},{-6.65,0.441206946467},{-6.55,0.449518856644},{-6.45,0.459142714025},{-6.35,0.491327938447},{-6.25,0.505872945723},{-6.15,0.508638502777},{-6.05,0.536994263717},{-5.95,0.550329895487},{-5.85,0.585337923076},{-5.75,0.614172369629},{-5.65,0.603308278407},{-5.55,0.625065080544},{-5.45,0.637344237588},{-5.35,0.677093285463},{-5.25,0.691669737618},{-5.15,0.69948371964},{-5.05,0.678436891472},{-4.95,0.738917335009},{-4.85,0.740552556551},{-4.75,0.778086543862},{-4.65,0.783130450581},{-4.55,0.797093875969},{-4.45,0.823369455515},{-4.35,0.852120016665},{-4.25,0.868189709194},{-4.15,0.857203373414},{-4.05,0.925928846814},{-3.95,0.943966392915},{-3.85,0.909097758044},{-3.75,0.977120508424},{-3.65,0.968769939223},{-3.55,1.00104833596},{-3.45,1.03231541672},{-3.35,1.06062300686},{-3.25,1.09753954798},{-3.15,1.07737301472},{-3.05,1.12724895634},{-2.95,1.12938855266},{-2.85,1.13851769479},{-2.75,1.18642365128},{-2.65,1.16613421005},{-2.55,1.16117368444},{-2.45,1.23548089578},{-2.35,1.20593328744},{-2.25,1.28747677109},{-2.15,1.2881802822},{-2.05,1.27855713648},{-1.95,1.27758152461},{-1.85,1.35343915864},{-1.75,1.31255300963},{-1.65,1.32765322473},{-1.55,1.39122940934},{-1.45,1.40196740875},{-1.35,1.4331199654},{-1.25,1.37602704088},{-1.15,1.40920280626},{-1.05,1.47568284569},{-0.95,1.4385839384},{-0.85,1.50508289703},{-0.75,1.51717650175},{-0.65,1.52756575793},{-0.55,1.51075506341},{-0.45,1.50621148814},{-0.35,1.51583575813},{-0.25,1.55389542193},{-0.15,1.54344492927},{-0.05,1.55764561136},{0.05,1.60697996391},{0.15,1.60850107763},{0.25,1.57456462299},{0.35,1.61124642474},{0.45,1.65234589944},{0.55,1.56949415154},{0.65,1.58174782634},{0.75,1.5773461983},{0.85,1.57469338149},{0.95,1.60468679235},{1.05,1.60231233511},{1.15,1.63002421933},{1.25,1.61144761541},{1.35,1.60133214443},{1.45,1.63914593265},{1.55,1.63493278265},{1.65,1.57321416536},{1.75,1.66524213732},{1.85,1.64116015625},{1.95,1.5428761866},{2.05,1.65310917476},{2.15,1.58583947087},{2.25,1.57478920252},{2.35,1.67902432801},{2.45,1.62699230546},{2.55,1.61390037022},{2.65,1.57109250771},{2.75,1.53914591121},{2.85,1.5854106238},{2.95,1.5845865211},{3.05,1.5022457675},{3.15,1.54866792203},{3.25,1.56702891515},{3.35,1.52060760807},{3.45,1.50105612194},{3.55,1.5072044701},{3.65,1.43683503018},{3.75,1.47023364308},{3.85,1.38472150028},{3.95,1.39491534785},{4.05,1.42297369869},{4.15,1.41734273455},{4.25,1.43040112024},{4.35,1.4249823492},{4.45,1.32510277421},{4.55,1.30913481078},{4.65,1.28860635007},{4.75,1.26869953648},{4.85,1.29989726587},{4.95,1.2978916656},{5.05,1.15503498315},{5.15,1.20645959001},{5.25,1.19373076468},{5.35,1.15927430858},{5.45,1.18095506549},{5.55,1.15382278175},{5.65,1.10069399102},{5.75,1.14349317251},{5.85,1.14730142292},{5.95,1.02723031187},{6.05,1.10620507222},{6.15,1.05883103274},{6.25,1.12691826454},{6.35,1.02499204863},{6.45,0.990050929187},{6.55,0.915960753899},{6.65,0.934728602126},{6.75,0.961253454194},{6.85,0.885084748148},{6.95,0.860863600705},{7.05,0.960525605398},{7.15,0.897724448564},{7.25,0.864138046804},{7.35,0.797349073541},{7.45,0.774699513505},{7.55,0.8084518556},{7.65,0.822052399432},{7.75,0.72962398685},{7.85,0.73788519073},{7.95,0.677509204761},{8.05,0.644915112832},{8.15,0.673043847656},{8.25,0.632631835938},{8.35,0.685748730198},{8.45,0.609712987513},{8.55,0.574411166829},{8.65,0.532759556787},{8.75,0.463781471191},{8.85,0.479685538547},{8.95,0.545669154996},{9.05,0.461005817073},{9.15,0.532660091625},{9.25,0.442758359407},{9.35,0.456866884695},{9.45,0.475057379663},{9.55,0.420978328725},{9.65,0.41248933975},{9.75,0.348243313835},{9.85,0.39069132058},{9.95,0.312444269657},{10.05,0.348409040919},{10.15,0.290731716426},{10.25,0.401872188487},{10.35,0.345692468068},{10.45,0.300614855183},{10.55,0.279705465065},{10.65,0.244969951163},{10.75,0.301270136466},{10.85,0.220996739314},{10.95,0.2439132973},{11.05,0.229940160116},{11.15,0.217043304443},{11.25,0.243014381045},{11.35,0.188631616458},{11.45,0.216487981711},{11.55,0.199010763413},{11.65,0.174743463964},{11.75,0.210568528834},{11.85,0.199969081555},{11.95,0.16643461585},{12.05,0.134607262447},{12.15,0.164766757288},{12.25,0.129692810059},{12.35,0.117047080994},{12.45,0.114529042408},{12.55,0.153517539685},{12.65,0.118135939474},{12.75,0.0937468510754},{12.85,0.0867298922492},{12.95,0.0940317996713},{13.05,0.0937949494471},{13.15,0.0898788490811},{13.25,0.0789984841096},{13.35,0.0562958466379},{13.45,0.0612392485896},{13.55,0.0739310555539},{13.65,0.0648085719249},{13.75,0.0707551002502},{13.85,0.0722465071567},{13.95,0.063351143731},{14.05,0.0506158241859},{14.15,0.0546946355275},{14.25,0.0482312246811},{14.35,0.049740862202},{14.45,0.0427650885704},{14.55,0.0308843622816},{14.65,0.0309156262597},{14.75,0.0335404773553},{14.85,0.037119188479},{14.95,0.0448531820661},{15.05,0.0287251234055},{15.15,0.0174407945438},{15.25,0.0359796505225},{15.35,0.0300750911236},{15.45,0.0246461142193},{15.55,0.033182606101},{15.65,0.0146727157491},{15.75,0.0149971854687},{15.85,0.0319260805845},{15.95,0.0166351602358},{16.05,0.0119827181101},{16.15,0.0157264481698},{16.25,0.00987389448442},{16.35,0.0140563820799},{16.45,0.0074689032303},{16.55,0.0239376023412},{16.65,0.0076147025185},{16.75,0.0105770801504},{16.85,0.0161996334791},{16.95,0.0069586052136},{17.05,0.00810677558184},{17.15,0.00964926617841},{17.25,0.0056782219559},{17.35,0.0237984303385},{17.45,0.00790497586131},{17.55,0.0353497155011},{17.65,0.0113193318248},{17.75,0.0205974709243},{17.85,0.0},{17.95,0.00542771210894},{18.05,0.00765446573496},{18.15,0.00510297715664},{18.25,0.00222675371915},{18.35,0.00222675362602},{18.45,0.0128038339317},{18.55,0.00173965131398},{18.65,0.00445350725204},{18.75,0.0},{18.85,0.00640191696584},{18.95,0.00208758166991},{19.05,0.0},{19.15,0.00347930262797},{19.25,0.00118296290748},{19.35,0.0036184748169},{19.45,0.00445350725204},{19.55,0.0},{19.65,0.00417516333982},{19.75,0.00139172107447},{19.85,0.0},{19.95,0.00250509800389},{20.05,0.0},{20.15,0.00111337681301},{20.25,0.00111337681301},{20.35,0.0},{20.45,0.0},{20.55,0.0},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.000556688406505},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU14 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.000185562802168},{-21.55,0.0},{-21.45,0.00111337681301},{-21.35,0.0},{-21.25,0.0},{-21.15,0.0},{-21.05,0.0},{-20.95,0.000278344203252},{-20.85,0.0},{-20.75,4.39490847241e-05},{-20.65,0.000695860537235},{-20.55,0.000222675362602},{-20.45,6.95860508131e-05},{-20.35,0.000111337681301},{-20.25,0.000278344203252},{-20.15,9.27814010841e-05},{-20.05,0.000463907024823},{-19.95,9.27814010841e-05},{-19.85,0.000278344203252},{-19.75,0.000231953512412},{-19.65,0.000417516304879},{-19.55,0.000167006521951},{-19.45,6.05096119335e-05},{-19.35,0.000417516304879},{-19.25,0.000243551185122},{-19.15,0.000196478261119},{-19.05,0.000487102370244},{-18.95,0.000178935571707},{-18.85,0.00080023962073},{-18.75,0.00058199245144},{-18.65,0.000531384382736},{-18.55,0.000459267944098},{-18.45,0.000491195687038},{-18.35,0.000411465359123},{-18.25,0.000572151970118},{-18.15,0.000479370562567},{-18.05,0.000490415974387},{-17.95,0.000673885996404},{-17.85,0.000663743855862},{-17.75,0.00102547869871},{-17.65,0.00102430671453},{-17.55,0.00140637071117},{-17.45,0.000931013375521},{-17.35,0.000804941346114},{-17.25,0.00139172106981},{-17.15,0.00169536928562},{-17.05,0.00104548800282},{-16.95,0.00117031086914},{-16.85,0.00176033901202},{-16.75,0.00138509379966},{-16.65,0.00178658147884},{-16.55,0.00251305060727},{-16.45,0.00192000701719},{-16.35,0.00302610106957},{-16.25,0.0018657760229},{-16.15,0.00311508616234},{-16.05,0.00331172803227},{-15.95,0.00246056278547},{-15.85,0.00335381949534},{-15.75,0.00421691487233},{-15.65,0.0030220230015},{-15.55,0.00372851795928},{-15.45,0.00563111763734},{-15.35,0.00477929650383},{-15.25,0.00486961789805},{-15.15,0.00535743720461},{-15.05,0.00584002577256},{-14.95,0.00625364022834},{-14.85,0.00690101703693},{-14.75,0.00720679561297},{-14.65,0.00709096451739},{-14.55,0.00828559546508},{-14.45,0.00968333426863},{-14.35,0.0100973802255},{-14.25,0.0112422406673},{-14.15,0.00930311981138},{-14.05,0.0118851266756},{-13.95,0.0134538804522},{-13.85,0.0136919614208},{-13.75,0.014799914966},{-13.65,0.0177665472031},{-13.55,0.014458165998},{-13.45,0.0166320202013},{-13.35,0.0165637614297},{-13.25,0.017244543609},{-13.15,0.0200047623877},{-13.05,0.020599487899},{-12.95,0.0209639112556},{-12.85,0.0266739405119},{-12.75,0.0269984090832},{-12.65,0.0269160635152},{-12.55,0.0270391518729},{-12.45,0.0292309002999},{-12.35,0.036924911082},{-12.25,0.0376361125991},{-12.15,0.0320520114678},{-12.05,0.0357551708713},{-11.95,0.042712093305},{-11.85,0.0468393398237},{-11.75,0.045289517511},{-11.65,0.0485308745812},{-11.55,0.0534631304813},{-11.45,0.0540627975464},{-11.35,0.0561175799642},{-11.25,0.0532953491714},{-11.15,0.0585429291976},{-11.05,0.0629758277497},{-10.95,0.0639877778247},{-10.85,0.0771004264504},{-10.75,0.0736025080149},{-10.65,0.0803426712278},{-10.55,0.081014518585},{-10.45,0.09011375157},{-10.35,0.0952207000449},{-10.25,0.100723965553},{-10.15,0.103289491237},{-10.05,0.109408518413},{-9.95,0.125008406729},{-9.85,0.118429532077},{-9.75,0.120442986243},{-9.65,0.136328805903},{-9.55,0.142297321998},{-9.45,0.149193333041},{-9.35,0.152998664827},{-9.25,0.169159385659},{-9.15,0.164617214627},{-9.05,0.182605000013},{-8.95,0.176782477736},{-8.85,0.189755213888},{-8.75,0.200192769368},{-8.65,0.204728397322},{-8.55,0.219591268688},{-8.45,0.223065100714},{-8.35,0.247501474669},{-8.25,0.244387182224},{-8.15,0.25893661722},{-8.05,0.267407875523},{-7.95,0.266734848839},{-7.85,0.289081690862},{-7.75,0.304636869885},{-7.65,0.30777755618},{-7.55,0.326662357037},{-7.45,0.336009625994},{-7.35,0.357250158015},{-7.25,0.371069071022},{-7.15,0.358924276396},{-7.05,0.356981445073},{-6.95,0.414005873852},{-6.85,0.402841062271},{-6.75,0.414300085325},{-6.65,0.434387852595},{-6.55,0.45008838516},{-6.45,0.477261540093},{-6.35,0.507473912099},{-6.25,0.52062012637},{-6.15,0.54801675704},{-6.05,0.530664221722},{-5.95,0.566104693117},{-5.85,0.56704438237},{-5.75,0.612103524135},{-5.65,0.606960541062},{-5.55,0.643400205062},{-5.45,0.652116034283},{-5.35,0.688862548224},{-5.25,0.68683727075},{-5.15,0.685939013192},{-5.05,0.686577178589},{-4.95,0.715278211963},{-4.85,0.756516999997},{-4.75,0.729480945286},{-4.65,0.787467640016},{-4.55,0.805060511752},{-4.45,0.826559156075},{-4.35,0.84841777249},{-4.25,0.861565871466},{-4.15,0.887527584827},{-4.05,0.924320828483},{-3.95,0.92806303521},{-3.85,0.972066600903},{-3.75,0.93379731579},{-3.65,0.992339582403},{-3.55,0.968415152784},{-3.45,1.0155547415},{-3.35,1.05052551675},{-3.25,1.04474993655},{-3.15,1.09564390694},{-3.05,1.08371939671},{-2.95,1.14595873307},{-2.85,1.12080018347},{-2.75,1.17139647841},{-2.65,1.1716436168},{-2.55,1.14911867125},{-2.45,1.20092823687},{-2.35,1.2072423719},{-2.25,1.26963489116},{-2.15,1.29498811981},{-2.05,1.28218443739},{-1.95,1.27629398714},{-1.85,1.32120638002},{-1.75,1.34518564373},{-1.65,1.32348971417},{-1.55,1.33929445085},{-1.45,1.40752966323},{-1.35,1.4197199456},{-1.25,1.41927506454},{-1.15,1.39577218956},{-1.05,1.47256894428},{-0.95,1.40928286274},{-0.85,1.52701676943},{-0.75,1.47555177042},{-0.65,1.45892241247},{-0.55,1.47338653452},{-0.45,1.47194897536},{-0.35,1.51876350865},{-0.25,1.50458442612},{-0.15,1.52882520291},{-0.05,1.57098437385},{0.05,1.56996773774},{0.15,1.55135211972},{0.25,1.5361460321},{0.35,1.58415414887},{0.45,1.61955836684},{0.55,1.57998293555},{0.65,1.56018580273},{0.75,1.58444057296},{0.85,1.6410281708},{0.95,1.56644627066},{1.05,1.60995577705},{1.15,1.60997092783},{1.25,1.63555224858},{1.35,1.65084287773},{1.45,1.62032175889},{1.55,1.55251806701},{1.65,1.64201007823},{1.75,1.54693636196},{1.85,1.63200318409},{1.95,1.61697101657},{2.05,1.61873258402},{2.15,1.59901986267},{2.25,1.55842790617},{2.35,1.56284043446},{2.45,1.57768157851},{2.55,1.54083750767},{2.65,1.60886578981},{2.75,1.56894444573},{2.85,1.49679209757},{2.95,1.55428754076},{3.05,1.50044853743},{3.15,1.52036667759},{3.25,1.54693485192},{3.35,1.55082028823},{3.45,1.47700435806},{3.55,1.48402689421},{3.65,1.41695702648},{3.75,1.46930079477},{3.85,1.4441219548},{3.95,1.41700605546},{4.05,1.38662446717},{4.15,1.36501915009},{4.25,1.37767996717},{4.35,1.35565847026},{4.45,1.31623307106},{4.55,1.37382992052},{4.65,1.33761234234},{4.75,1.28343531991},{4.85,1.25938842015},{4.95,1.29500473485},{5.05,1.18586376009},{5.15,1.1775661834},{5.25,1.20721578953},{5.35,1.1601042933},{5.45,1.16060277609},{5.55,1.15916285282},{5.65,1.10653945529},{5.75,1.12786980846},{5.85,1.06853578629},{5.95,1.0804108704},{6.05,1.04801968279},{6.15,1.03979806307},{6.25,1.09584154831},{6.35,1.02987701676},{6.45,0.964295037902},{6.55,0.911251471482},{6.65,0.938538246436},{6.75,0.94606403496},{6.85,0.851307861928},{6.95,0.856516026542},{7.05,0.833330930232},{7.15,0.855383359469},{7.25,0.8292682077},{7.35,0.843254944235},{7.45,0.824773730149},{7.55,0.819054349847},{7.65,0.724976504746},{7.75,0.689515879456},{7.85,0.680852086807},{7.95,0.660662642149},{8.05,0.637374585895},{8.15,0.680393853045},{8.25,0.626296692301},{8.35,0.641414686691},{8.45,0.577487365638},{8.55,0.52918597779},{8.65,0.569136355405},{8.75,0.554403199435},{8.85,0.514662979101},{8.95,0.519550403515},{9.05,0.465921097443},{9.15,0.510884824006},{9.25,0.45160144433},{9.35,0.450096007811},{9.45,0.436607120922},{9.55,0.404523234986},{9.65,0.38836911024},{9.75,0.344724694723},{9.85,0.359079524702},{9.95,0.339976621071},{10.05,0.35816562725},{10.15,0.335044066547},{10.25,0.340700040051},{10.35,0.279028153037},{10.45,0.268478201217},{10.55,0.296664500397},{10.65,0.274198101827},{10.75,0.27594489629},{10.85,0.231544084997},{10.95,0.242167960596},{11.05,0.236150640371},{11.15,0.212735463338},{11.25,0.224073480029},{11.35,0.20856306486},{11.45,0.194703772878},{11.55,0.172390425647},{11.65,0.165749929484},{11.75,0.161878903707},{11.85,0.186159171556},{11.95,0.145688174816},{12.05,0.132713896505},{12.15,0.149698577561},{12.25,0.131417439779},{12.35,0.117774861654},{12.45,0.119792651413},{12.55,0.115453205411},{12.65,0.134298237003},{12.75,0.137654160344},{12.85,0.0902985423064},{12.95,0.0935183570499},{13.05,0.0871626723046},{13.15,0.0936317163355},{13.25,0.094600881849},{13.35,0.0691494891518},{13.45,0.07095765493},{13.55,0.0938566752842},{13.65,0.0596678407886},{13.75,0.0713071505229},{13.85,0.0628054063828},{13.95,0.0583532139406},{14.05,0.0655906548103},{14.15,0.053859605239},{14.25,0.0354371956417},{14.35,0.0377156405613},{14.45,0.0478420654933},{14.55,0.0348928109655},{14.65,0.0227222963118},{14.75,0.0323497825199},{14.85,0.0370034084601},{14.95,0.0350376331445},{15.05,0.0308061557658},{15.15,0.0260053021567},{15.25,0.0324270998438},{15.35,0.0378255122586},{15.45,0.0239697190431},{15.55,0.0275693308739},{15.65,0.0208642184734},{15.75,0.0205046903519},{15.85,0.0160279870033},{15.95,0.0165248560278},{16.05,0.0114343798161},{16.15,0.0164571013302},{16.25,0.0113868090239},{16.35,0.022978860471},{16.45,0.0086843393743},{16.55,0.00913316942751},{16.65,0.0116651532325},{16.75,0.013638866134},{16.85,0.0114739669694},{16.95,0.00881423304478},{17.05,0.00804414749146},{17.15,0.00559218837456},{17.25,0.0304786916822},{17.35,0.00636712368578},{17.45,0.00672665176292},{17.55,0.00616996362805},{17.65,0.00400119787082},{17.75,0.00358368176967},{17.85,0.00606790371239},{17.95,0.00267906300724},{18.05,0.00361847473929},{18.15,0.0101595632732},{18.25,0.00491741423806},{18.35,0.0020875815923},{18.45,0.0141955548897},{18.55,0.00243551190943},{18.65,0.00528853992},{18.75,0.0},{18.85,0.00148450241735},{18.95,0.00640191696584},{19.05,0.00320095848292},{19.15,0.00100203920156},{19.25,0.00306178629398},{19.35,0.00125254900195},{19.45,0.00125254900195},{19.55,0.0036184748169},{19.65,0.00417516333982},{19.75,0.00222675362602},{19.85,0.000974204740487},{19.95,0.00167006521951},{20.05,0.0},{20.15,0.00139172107447},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.0},{20.65,0.0},{20.75,0.000278344203252},{20.85,0.0},{20.95,0.000556688406505},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU15 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.000278344203252},{-22.15,0.000278344203252},{-22.05,0.0},{-21.95,0.000278344203252},{-21.85,0.000556688406505},{-21.75,0.0},{-21.65,0.000835032609757},{-21.55,0.0},{-21.45,0.0},{-21.35,0.0},{-21.25,0.000278344203252},{-21.15,0.0},{-21.05,0.000278344203252},{-20.95,0.000278344203252},{-20.85,0.000185562802168},{-20.75,7.9526915215e-05},{-20.65,0.000185562802168},{-20.55,0.000556688406505},{-20.45,0.000278344203252},{-20.35,0.000389681896195},{-20.25,0.000278344203252},{-20.15,0.000278344203252},{-20.05,2.3195350271e-05},{-19.95,0.0},{-19.85,0.000227736182172},{-19.75,0.00021648994233},{-19.65,0.000222675362602},{-19.55,9.27814010841e-05},{-19.45,0.000139172101626},{-19.35,0.000417516304879},{-19.25,9.27814010841e-05},{-19.15,0.000226154676056},{-19.05,0.000556688406505},{-18.95,0.00167006533593},{-18.85,0.000385399692907},{-18.75,0.000649469826991},{-18.65,0.000205095734839},{-18.55,0.000334013043903},{-18.45,0.000765446573496},{-18.35,0.000439490877876},{-18.25,0.000622181167059},{-18.15,0.000619948460636},{-18.05,0.000531384382736},{-17.95,0.000583624947936},{-17.85,0.00127574428916},{-17.75,0.000988121982664},{-17.65,0.000843730871566},{-17.55,0.00125254893845},{-17.45,0.0011730220701},{-17.35,0.00111337689062},{-17.25,0.000956362161117},{-17.15,0.00103486950199},{-17.05,0.00139904590814},{-16.95,0.0010806304567},{-16.85,0.00178604200482},{-16.75,0.00185098908842},{-16.65,0.0021249204874},{-16.55,0.00231531770392},{-16.45,0.00215181479087},{-16.35,0.0023948106001},{-16.25,0.00181480427583},{-16.15,0.00261643553774},{-16.05,0.00364119665963},{-15.95,0.00263069224794},{-15.85,0.00344749178205},{-15.75,0.00466116080208},{-15.65,0.00375917619401},{-15.55,0.00390274125211},{-15.45,0.00489267276393},{-15.35,0.00399117298045},{-15.25,0.00567822205393},{-15.15,0.0053954044623},{-15.05,0.00670998709873},{-14.95,0.00814508247857},{-14.85,0.00755472580592},{-14.75,0.00594463696082},{-14.65,0.00662038492602},{-14.55,0.00823603955326},{-14.45,0.00947310634561},{-14.35,0.00948550112276},{-14.25,0.0104924370671},{-14.15,0.0114968960313},{-14.05,0.0122096163503},{-13.95,0.0142518674707},{-13.85,0.0123937066677},{-13.75,0.0147791358008},{-13.65,0.0154499761727},{-13.55,0.014836956861},{-13.45,0.0166370000026},{-13.35,0.0167016359606},{-13.25,0.0179948579697},{-13.15,0.0200494515442},{-13.05,0.0217737296095},{-12.95,0.0212052178806},{-12.85,0.0239317688399},{-12.75,0.0276185092154},{-12.65,0.0281039923856},{-12.55,0.0250024307606},{-12.45,0.0321793052239},{-12.35,0.0340273993356},{-12.25,0.0375915335626},{-12.15,0.0353967242771},{-12.05,0.0383024545975},{-11.95,0.0440914808493},{-11.85,0.0438996729304},{-11.75,0.0443681720538},{-11.65,0.0468656419634},{-11.55,0.0530204022868},{-11.45,0.0559831650082},{-11.35,0.0584080361912},{-11.25,0.0590340371757},{-11.15,0.0573544802366},{-11.05,0.0684015991491},{-10.95,0.0690246902146},{-10.85,0.0660347513633},{-10.75,0.0804242497461},{-10.65,0.0806236459508},{-10.55,0.083508604858},{-10.45,0.094998351283},{-10.35,0.0964873209683},{-10.25,0.103465853123},{-10.15,0.104121343261},{-10.05,0.102800975214},{-9.95,0.118118980431},{-9.85,0.123335094033},{-9.75,0.122092555066},{-9.65,0.13659229531},{-9.55,0.143308772272},{-9.45,0.151348660924},{-9.35,0.158237225076},{-9.25,0.169056886655},{-9.15,0.166500686285},{-9.05,0.171262949189},{-8.95,0.178060735529},{-8.85,0.188065054757},{-8.75,0.189874173173},{-8.65,0.214730417534},{-8.55,0.222264806185},{-8.45,0.237717572381},{-8.35,0.238659076421},{-8.25,0.250094028689},{-8.15,0.264924619677},{-8.05,0.260506355509},{-7.95,0.289070042645},{-7.85,0.295630184654},{-7.75,0.297432463258},{-7.65,0.302876674107},{-7.55,0.327836188483},{-7.45,0.343385415391},{-7.35,0.360594125989},{-7.25,0.369889418443},{-7.15,0.364091440648},{-7.05,0.383222239012},{-6.95,0.404661929541},{-6.85,0.41143089875},{-6.75,0.432344853931},{-6.65,0.441484925677},{-6.55,0.446176285606},{-6.45,0.481164509646},{-6.35,0.471228424827},{-6.25,0.511930628832},{-6.15,0.53012720693},{-6.05,0.547128305495},{-5.95,0.567020868098},{-5.85,0.551745742032},{-5.75,0.590293861772},{-5.65,0.607783651854},{-5.55,0.639364974006},{-5.45,0.650682993618},{-5.35,0.660951652712},{-5.25,0.69674509392},{-5.15,0.708611352196},{-5.05,0.684651537698},{-4.95,0.717270390625},{-4.85,0.761161283617},{-4.75,0.772568075545},{-4.65,0.771018056662},{-4.55,0.796246655199},{-4.45,0.831103500582},{-4.35,0.841270564011},{-4.25,0.856114051154},{-4.15,0.868362075828},{-4.05,0.870553911102},{-3.95,0.943561474812},{-3.85,0.945096064273},{-3.75,0.948617367148},{-3.65,0.974886537166},{-3.55,1.00496188583},{-3.45,1.05524505589},{-3.35,1.08222963609},{-3.25,1.0832629885},{-3.15,1.10086007216},{-3.05,1.06228325448},{-2.95,1.12004977065},{-2.85,1.15257334356},{-2.75,1.18670148847},{-2.65,1.13430984621},{-2.55,1.2040534947},{-2.45,1.2355119885},{-2.35,1.22294984798},{-2.25,1.30056892522},{-2.15,1.28497188459},{-2.05,1.2997944119},{-1.95,1.27223383846},{-1.85,1.32443522135},{-1.75,1.35556658298},{-1.65,1.35659374103},{-1.55,1.33799863359},{-1.45,1.42737943553},{-1.35,1.39090074976},{-1.25,1.42090825282},{-1.15,1.39702946125},{-1.05,1.43832234896},{-0.95,1.43996304515},{-0.85,1.49131740767},{-0.75,1.50240502353},{-0.65,1.46659416467},{-0.55,1.49046353315},{-0.45,1.51646237314},{-0.35,1.53063193512},{-0.25,1.47383699195},{-0.15,1.54115547315},{-0.05,1.56527777215},{0.05,1.64038642308},{0.15,1.53886927375},{0.25,1.57605190168},{0.35,1.57822854008},{0.45,1.651314905},{0.55,1.62161588682},{0.65,1.54652651451},{0.75,1.60288237302},{0.85,1.58862758963},{0.95,1.58493738235},{1.05,1.62969901746},{1.15,1.63293999566},{1.25,1.58518532951},{1.35,1.6470166543},{1.45,1.57054275838},{1.55,1.59988762805},{1.65,1.62336597355},{1.75,1.59461241158},{1.85,1.57000374618},{1.95,1.58139346889},{2.05,1.60827837312},{2.15,1.59049820486},{2.25,1.58430817168},{2.35,1.61275435195},{2.45,1.57986154986},{2.55,1.5564905953},{2.65,1.52380621145},{2.75,1.52638325752},{2.85,1.54197961851},{2.95,1.51912112572},{3.05,1.54975379715},{3.15,1.53557819235},{3.25,1.49998167895},{3.35,1.47493760006},{3.45,1.47886853257},{3.55,1.47815261009},{3.65,1.43326528913},{3.75,1.50531861492},{3.85,1.48102622362},{3.95,1.43349250232},{4.05,1.40484183691},{4.15,1.46615799557},{4.25,1.38361236459},{4.35,1.38188970841},{4.45,1.34463868018},{4.55,1.33213932094},{4.65,1.37510073489},{4.75,1.28041904994},{4.85,1.26027143202},{4.95,1.31407553361},{5.05,1.21427749053},{5.15,1.19524396724},{5.25,1.17796425311},{5.35,1.1693016392},{5.45,1.16859310752},{5.55,1.1593078547},{5.65,1.13591518244},{5.75,1.18751687031},{5.85,1.12060720641},{5.95,1.09587894765},{6.05,1.09527124919},{6.15,1.05122816986},{6.25,1.04973903828},{6.35,0.999632498167},{6.45,1.00234902642},{6.55,0.930247485153},{6.65,0.948348954795},{6.75,0.92126103689},{6.85,0.8928091111},{6.95,0.876240572825},{7.05,0.890979614258},{7.15,0.826987254863},{7.25,0.823407600102},{7.35,0.797692978173},{7.45,0.805598798316},{7.55,0.738224645708},{7.65,0.772715773107},{7.75,0.655887106191},{7.85,0.691077437753},{7.95,0.671201578776},{8.05,0.653221615953},{8.15,0.674136547332},{8.25,0.664672851562},{8.35,0.604138411008},{8.45,0.593315852946},{8.55,0.538865583656},{8.65,0.542914026071},{8.75,0.549398233127},{8.85,0.507838230507},{8.95,0.520487030591},{9.05,0.501961275959},{9.15,0.512470915421},{9.25,0.469334416829},{9.35,0.483176074542},{9.45,0.456036792836},{9.55,0.410604285485},{9.65,0.374091059784},{9.75,0.354714379382},{9.85,0.404746223642},{9.95,0.316581799859},{10.05,0.313926633463},{10.15,0.378367573506},{10.25,0.33525513488},{10.35,0.302676728534},{10.45,0.253413440449},{10.55,0.261655040623},{10.65,0.259566453174},{10.75,0.328623190693},{10.85,0.260363528603},{10.95,0.233915095175},{11.05,0.2096824646},{11.15,0.201827940188},{11.25,0.210065434488},{11.35,0.186089239259},{11.45,0.242201067738},{11.55,0.183317732913},{11.65,0.168863756903},{11.75,0.161522392754},{11.85,0.194640477498},{11.95,0.20664658382},{12.05,0.142633829619},{12.15,0.134388543218},{12.25,0.131905679142},{12.35,0.121833585557},{12.45,0.134385800016},{12.55,0.104678171762},{12.65,0.119705545621},{12.75,0.0977146135154},{12.85,0.099523521605},{12.95,0.0931905527584},{13.05,0.0831502433715},{13.15,0.097180215936},{13.25,0.111103871663},{13.35,0.0695303830233},{13.45,0.0770513073782},{13.55,0.115560108761},{13.65,0.0577651212613},{13.75,0.0693463683128},{13.85,0.0803756887263},{13.95,0.0686189279718},{14.05,0.0505606389382},{14.15,0.0482366369731},{14.25,0.0560917120713},{14.35,0.046966925002},{14.45,0.0510943143264},{14.55,0.0392570360652},{14.65,0.0325998663902},{14.75,0.038740453395},{14.85,0.030094575882},{14.95,0.0342149276},{15.05,0.0261038464049},{15.15,0.0179532005869},{15.25,0.024933782063},{15.35,0.0449680520429},{15.45,0.0239824960309},{15.55,0.0515150886316},{15.65,0.0188902934392},{15.75,0.0169140497843},{15.85,0.0291217621416},{15.95,0.0371209951964},{16.05,0.011440907059},{16.15,0.00926886200905},{16.25,0.0114005145927},{16.35,0.0141085721552},{16.45,0.00859387777746},{16.55,0.010822677437},{16.65,0.0123167311152},{16.75,0.0128291371194},{16.85,0.0110780999064},{16.95,0.00596700422466},{17.05,0.0091296903789},{17.15,0.0119688014189},{17.25,0.0108554239074},{17.35,0.00554158030586},{17.45,0.00609264564183},{17.55,0.00867506116629},{17.65,0.00501019600779},{17.75,0.00273283401673},{17.85,0.00425468997232},{17.95,0.00797920053204},{18.05,0.0114121129736},{18.15,0.0183707177639},{18.25,0.00417516306043},{18.35,0.00654108915478},{18.45,0.00807198230177},{18.55,0.00128038339317},{18.65,0.00375764677301},{18.75,0.00189274065197},{18.85,0.00584522821009},{18.95,0.0015030587092},{19.05,0.00501019600779},{19.15,0.00264426996},{19.25,0.00077936379239},{19.35,0.00222675362602},{19.45,0.00222675362602},{19.55,0.000835032609757},{19.65,0.00153089314699},{19.75,0.0},{19.85,0.00250509800389},{19.95,0.00111337681301},{20.05,0.00306178629398},{20.15,0.000463907024823},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.0},{20.65,0.00111337681301},{20.75,0.0},{20.85,0.0},{20.95,0.00111337681301},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU16 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.000139172101626},{-22.25,0.000278344203252},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.000556688406505},{-21.55,0.000278344203252},{-21.45,0.000278344203252},{-21.35,0.0},{-21.25,0.000278344203252},{-21.15,0.000278344203252},{-21.05,0.0},{-20.95,0.0},{-20.85,0.0},{-20.75,4.63907005421e-05},{-20.65,3.47930254065e-05},{-20.55,0.000278344214894},{-20.45,9.27814010841e-05},{-20.35,0.000463907024823},{-20.25,0.000185562802168},{-20.15,4.63907005421e-05},{-20.05,0.000417516304879},{-19.95,0.000139172107447},{-19.85,9.27814010841e-05},{-19.75,0.000417516304879},{-19.65,0.000250509800389},{-19.55,0.00031810766086},{-19.45,0.000196478261119},{-19.35,0.000167006521951},{-19.25,0.000417516304879},{-19.15,9.68153750443e-05},{-19.05,0.000278344203252},{-18.95,0.000428221869068},{-18.85,0.000620921715521},{-18.75,0.000765446573496},{-18.65,0.000835032625632},{-18.55,0.000535277327379},{-18.45,0.000404048050123},{-18.35,0.000437398041998},{-18.25,0.000417516333982},{-18.15,0.000751529354602},{-18.05,0.00087298867716},{-17.95,0.000768760219216},{-17.85,0.000626274451081},{-17.75,0.000727977173833},{-17.65,0.00116904571652},{-17.55,0.00121646733196},{-17.45,0.00107858376577},{-17.35,0.000690293610096},{-17.25,0.00144738989572},{-17.15,0.00156955203662},{-17.05,0.00117852126664},{-16.95,0.00135351688254},{-16.85,0.00131580897353},{-16.75,0.0017191848042},{-16.65,0.00159705698979},{-16.55,0.0020324379768},{-16.45,0.00155545289026},{-16.35,0.00245157027474},{-16.25,0.00207060938928},{-16.15,0.00351270407438},{-16.05,0.00363262780642},{-15.95,0.00256662666798},{-15.85,0.00265115971612},{-15.75,0.00408479184299},{-15.65,0.00370255795618},{-15.55,0.00464012439955},{-15.45,0.00554700231268},{-15.35,0.00556981438085},{-15.25,0.0047489803571},{-15.15,0.00587941104906},{-15.05,0.0062706649788},{-14.95,0.00768376494709},{-14.85,0.00960152415396},{-14.75,0.00813005382209},{-14.65,0.00714838572524},{-14.55,0.00752576897221},{-14.45,0.00947728098893},{-14.35,0.00932232223491},{-14.25,0.0105741188881},{-14.15,0.0122950818804},{-14.05,0.0129473544657},{-13.95,0.0160087680817},{-13.85,0.0132577859281},{-13.75,0.0124436817716},{-13.65,0.0147554800492},{-13.55,0.0167397949845},{-13.45,0.0171730257299},{-13.35,0.0172518298964},{-13.25,0.0192854075055},{-13.15,0.0193528627848},{-13.05,0.0193885772541},{-12.95,0.021926316348},{-12.85,0.0228516987392},{-12.75,0.0248092772085},{-12.65,0.030898585958},{-12.55,0.026627227664},{-12.45,0.0316395657159},{-12.35,0.031555379398},{-12.25,0.0364261060148},{-12.15,0.0362469781705},{-12.05,0.0380228987018},{-11.95,0.0426381704375},{-11.85,0.0418697310166},{-11.75,0.045747893913},{-11.65,0.0543870780304},{-11.55,0.0548737132466},{-11.45,0.0527703137712},{-11.35,0.0576886417302},{-11.25,0.0593386856101},{-11.15,0.0641424396983},{-11.05,0.0687525579049},{-10.95,0.0727663308262},{-10.85,0.0693090115374},{-10.75,0.0824404275021},{-10.65,0.0835052417918},{-10.55,0.0870955417486},{-10.45,0.0941969467713},{-10.35,0.0975258283718},{-10.25,0.107046162526},{-10.15,0.104757917371},{-10.05,0.118557322402},{-9.95,0.12127218366},{-9.85,0.130055672782},{-9.75,0.121221763341},{-9.65,0.140138607678},{-9.55,0.138588833388},{-9.45,0.150374058667},{-9.35,0.159405965654},{-9.25,0.165429743538},{-9.15,0.172123329754},{-9.05,0.177512841589},{-8.95,0.176852633543},{-8.85,0.182686867699},{-8.75,0.198146099947},{-8.65,0.215920872364},{-8.55,0.213833925535},{-8.45,0.2430804354},{-8.35,0.233743286133},{-8.25,0.252839584616},{-8.15,0.266585406135},{-8.05,0.282610571026},{-7.95,0.277573238357},{-7.85,0.289990572243},{-7.75,0.317847207629},{-7.65,0.303629701993},{-7.55,0.335167272991},{-7.45,0.344760441814},{-7.35,0.350998664709},{-7.25,0.363301858565},{-7.15,0.382064893769},{-7.05,0.381570770532},{-6.95,0.405114602421},{-6.85,0.416342420523},{-6.75,0.436285149901},{-6.65,0.447815062172},{-6.55,0.450192683861},{-6.45,0.491154251756},{-6.35,0.495647060701},{-6.25,0.501979270306},{-6.15,0.527277370955},{-6.05,0.549999640195},{-5.95,0.550957312951},{-5.85,0.576489902491},{-5.75,0.590665960825},{-5.65,0.615726006238},{-5.55,0.654421312787},{-5.45,0.645276533765},{-5.35,0.678888882562},{-5.25,0.692050849282},{-5.15,0.71079435417},{-5.05,0.697846717071},{-4.95,0.725772332934},{-4.85,0.774593532067},{-4.75,0.789991931105},{-4.65,0.778906884131},{-4.55,0.827949645308},{-4.45,0.829196187474},{-4.35,0.863063046743},{-4.25,0.871438671553},{-4.15,0.891073176694},{-4.05,0.906814391453},{-3.95,0.948173558108},{-3.85,0.958182522799},{-3.75,0.94671226447},{-3.65,0.984866927955},{-3.55,0.989268432648},{-3.45,1.03131761967},{-3.35,1.06933392604},{-3.25,1.05407911001},{-3.15,1.07605893593},{-3.05,1.12944070005},{-2.95,1.10456481273},{-2.85,1.14709356285},{-2.75,1.14234253133},{-2.65,1.16986034457},{-2.55,1.21496179081},{-2.45,1.25245577803},{-2.35,1.23335631037},{-2.25,1.28624070098},{-2.15,1.26950080423},{-2.05,1.2875856268},{-1.95,1.29303294093},{-1.85,1.31836721568},{-1.75,1.36553402586},{-1.65,1.35748020949},{-1.55,1.36073073691},{-1.45,1.39101010243},{-1.35,1.40091371889},{-1.25,1.42745299837},{-1.15,1.40974558153},{-1.05,1.44166601247},{-0.95,1.4093596381},{-0.85,1.48492949662},{-0.75,1.50534331005},{-0.65,1.51759708626},{-0.55,1.4933089174},{-0.45,1.4852541287},{-0.35,1.48572436136},{-0.25,1.5397954939},{-0.15,1.56586008033},{-0.05,1.58298956337},{0.05,1.59628597688},{0.15,1.56994466917},{0.25,1.56505257846},{0.35,1.64105266953},{0.45,1.59995398162},{0.55,1.60602293497},{0.65,1.56304332007},{0.75,1.60604251031},{0.85,1.58344348233},{0.95,1.62384407633},{1.05,1.60017211733},{1.15,1.66246328428},{1.25,1.5715323625},{1.35,1.63936770732},{1.45,1.6205920102},{1.55,1.64241476431},{1.65,1.64841833894},{1.75,1.627228409},{1.85,1.60517240932},{1.95,1.64403799589},{2.05,1.64667052967},{2.15,1.58261848923},{2.25,1.64721111919},{2.35,1.58799129872},{2.45,1.58357031584},{2.55,1.58866952286},{2.65,1.53552970712},{2.75,1.60199693866},{2.85,1.57399408435},{2.95,1.56179162512},{3.05,1.58582105773},{3.15,1.50614996483},{3.25,1.53359807218},{3.35,1.49779014013},{3.45,1.4433478007},{3.55,1.5663596164},{3.65,1.46688626702},{3.75,1.51073940527},{3.85,1.41872304647},{3.95,1.46642794941},{4.05,1.38159903322},{4.15,1.42440427859},{4.25,1.41584087763},{4.35,1.35859193538},{4.45,1.31488018614},{4.55,1.30035662476},{4.65,1.34983327179},{4.75,1.31685615463},{4.85,1.30357465352},{4.95,1.33909387363},{5.05,1.22773670015},{5.15,1.2527412418},{5.25,1.21505455777},{5.35,1.1580984933},{5.45,1.17229863854},{5.55,1.19207028271},{5.65,1.15473191881},{5.75,1.1265230149},{5.85,1.173883316},{5.95,1.08165393572},{6.05,1.08637795702},{6.15,1.0700992896},{6.25,1.05306640625},{6.35,0.998481360062},{6.45,1.00842285156},{6.55,0.998826315354},{6.65,0.946733086221},{6.75,0.954368463442},{6.85,0.931840344623},{6.95,0.905969766685},{7.05,0.885465869731},{7.15,0.828981857186},{7.25,0.78955151221},{7.35,0.799252929687},{7.45,0.777652244002},{7.55,0.783276260108},{7.65,0.739265368213},{7.75,0.734398085253},{7.85,0.679413808417},{7.95,0.67475762986},{8.05,0.680245927994},{8.15,0.64730023894},{8.25,0.669611005382},{8.35,0.630113869192},{8.45,0.598744792607},{8.55,0.606148109436},{8.65,0.547127256611},{8.75,0.575248440268},{8.85,0.528434652232},{8.95,0.515365473782},{9.05,0.510888088451},{9.15,0.497966778095},{9.25,0.464657123272},{9.35,0.438060011819},{9.45,0.470472188569},{9.55,0.431453711586},{9.65,0.378750820288},{9.75,0.350555725607},{9.85,0.379027605057},{9.95,0.325258771435},{10.05,0.343477332074},{10.15,0.340720421445},{10.25,0.325358397325},{10.35,0.261187386891},{10.45,0.275720453587},{10.55,0.286307273923},{10.65,0.26527065701},{10.75,0.283647754235},{10.85,0.245795193524},{10.95,0.270130709767},{11.05,0.241987540052},{11.15,0.216455746002},{11.25,0.243276109882},{11.35,0.236778148015},{11.45,0.228832043215},{11.55,0.183528782318},{11.65,0.164671821739},{11.75,0.177974786844},{11.85,0.168776277054},{11.95,0.173735126696},{12.05,0.159080343902},{12.15,0.138800977456},{12.25,0.135163951564},{12.35,0.126973168144},{12.45,0.111632758802},{12.55,0.126168921187},{12.65,0.113861468014},{12.75,0.121423826443},{12.85,0.104791361586},{12.95,0.0941380748042},{13.05,0.0895550772548},{13.15,0.0829892235418},{13.25,0.0963271819439},{13.35,0.0563151980406},{13.45,0.0740636495443},{13.55,0.0669348924467},{13.65,0.0683319381114},{13.75,0.0704032396659},{13.85,0.0785409063101},{13.95,0.0867630976897},{14.05,0.0766759548547},{14.15,0.0598440053033},{14.25,0.0462325828176},{14.35,0.0487055977186},{14.45,0.0480659228784},{14.55,0.0562520367759},{14.65,0.0316005042105},{14.75,0.036403057622},{14.85,0.0332175970078},{14.95,0.0301279783249},{15.05,0.0369004896709},{15.15,0.0176686262017},{15.25,0.0252763061296},{15.35,0.0574954748154},{15.45,0.031942782402},{15.55,0.032179010951},{15.65,0.0192563587969},{15.75,0.0182809291347},{15.85,0.0186387521249},{15.95,0.0196612233465},{16.05,0.0155551594037},{16.15,0.0160246732689},{16.25,0.0120035943886},{16.35,0.0116651532325},{16.45,0.00922015185157},{16.55,0.0143943716373},{16.65,0.00926267686817},{16.75,0.0136388662187},{16.85,0.0218964119752},{16.95,0.0044883005321},{17.05,0.00862867074708},{17.15,0.00599510623859},{17.25,0.00443804388245},{17.35,0.0104975530079},{17.45,0.0077936379239},{17.55,0.00405918651571},{17.65,0.00297614187002},{17.75,0.00505658642699},{17.85,0.00904618669301},{17.95,0.00441374390253},{18.05,0.0114121129736},{18.15,0.00366486546894},{18.25,0.00208758166991},{18.35,0.00668026134372},{18.45,0.00547410299381},{18.55,0.00222675369254},{18.65,0.0147522427142},{18.75,0.00473185162991},{18.85,0.0077936379239},{18.95,0.00835032667965},{19.05,0.00250509800389},{19.15,0.00417516333982},{19.25,0.00167006521951},{19.35,0.000835032667965},{19.45,0.00389681896195},{19.55,0.0},{19.65,0.00389681896195},{19.75,0.000742251208673},{19.85,0.0},{19.95,0.00278344214894},{20.05,0.00278344214894},{20.15,0.000649469826991},{20.25,0.0},{20.35,0.000835032609757},{20.45,0.0},{20.55,0.000835032609757},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.000556688406505},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU17 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.000278344203252},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.000139172101626},{-21.35,0.000835032609757},{-21.25,0.0},{-21.15,0.000278344203252},{-21.05,0.0},{-20.95,5.56688406505e-05},{-20.85,9.27814010841e-05},{-20.75,0.000126520097679},{-20.65,6.95860508131e-05},{-20.55,0.000208758152439},{-20.45,0.000278344214894},{-20.35,0.000167006521951},{-20.25,0.000139172101626},{-20.15,0.000208758152439},{-20.05,0.000347930268617},{-19.95,0.000253040195358},{-19.85,0.000139172101626},{-19.75,0.000167006521951},{-19.65,0.000238580745645},{-19.55,4.63907005421e-05},{-19.45,7.32484776037e-05},{-19.35,0.000256933110694},{-19.25,0.000278344214894},{-19.15,0.000130985507413},{-19.05,0.000680396954219},{-18.95,0.000324734900561},{-18.85,0.000538132153451},{-18.75,0.000513866221389},{-18.65,0.000458449289641},{-18.55,0.000556688400961},{-18.45,0.000374694139912},{-18.35,0.000556688417088},{-18.25,0.00036582382662},{-18.15,0.000447338912636},{-18.05,0.000413754904592},{-17.95,0.00111337682526},{-17.85,0.00101513766191},{-17.75,0.00141955548897},{-17.65,0.000988601867495},{-17.55,0.0013675171396},{-17.45,0.00088142334587},{-17.35,0.000744035467505},{-17.25,0.00115314030222},{-17.15,0.0011197028851},{-17.05,0.00152509426698},{-16.95,0.00154987113042},{-16.85,0.00191677937453},{-16.75,0.00162553012371},{-16.65,0.00203747957945},{-16.55,0.00248770136386},{-16.45,0.00212597384535},{-16.35,0.00266078190278},{-16.25,0.001887621722},{-16.15,0.00245513862524},{-16.05,0.00279828707377},{-15.95,0.00294249594867},{-15.85,0.00293931484222},{-15.75,0.00423939640705},{-15.65,0.00358783132439},{-15.55,0.00368326183023},{-15.45,0.00484849101021},{-15.35,0.00517190070379},{-15.25,0.00486479188079},{-15.15,0.00502163457544},{-15.05,0.00636980029253},{-14.95,0.00666663571671},{-14.85,0.00703706437309},{-14.75,0.00695375023886},{-14.65,0.00737837842993},{-14.55,0.0085543400862},{-14.45,0.0105156050138},{-14.35,0.00946641840586},{-14.25,0.0119536739329},{-14.15,0.0110986500143},{-14.05,0.0131143481288},{-13.95,0.0126640746362},{-13.85,0.0149920667921},{-13.75,0.0147315034679},{-13.65,0.016188146576},{-13.55,0.0136848383838},{-13.45,0.016367164048},{-13.35,0.0176584335588},{-13.25,0.020664310769},{-13.15,0.0199495749285},{-13.05,0.0227214638577},{-12.95,0.0240662491956},{-12.85,0.0240911464547},{-12.75,0.0290995532519},{-12.65,0.0291315323026},{-12.55,0.0268590618466},{-12.45,0.0332275008276},{-12.35,0.0351610794236},{-12.25,0.0390462020053},{-12.15,0.0342746796036},{-12.05,0.0429703141039},{-11.95,0.0433308188595},{-11.85,0.0436588392405},{-11.75,0.0472032405712},{-11.65,0.0514480629095},{-11.55,0.0550544888121},{-11.45,0.0583665374708},{-11.35,0.0596475996209},{-11.25,0.0602503510559},{-11.15,0.0629266785773},{-11.05,0.0680021251864},{-10.95,0.0690690310154},{-10.85,0.0667512059087},{-10.75,0.0816188865984},{-10.65,0.080206157302},{-10.55,0.0843863570555},{-10.45,0.0976199812879},{-10.35,0.0945846750955},{-10.25,0.09951514478},{-10.15,0.106439498277},{-10.05,0.106975039565},{-9.95,0.127948655528},{-9.85,0.123670916691},{-9.75,0.120632297134},{-9.65,0.143127864549},{-9.55,0.140190368374},{-9.45,0.147702953483},{-9.35,0.15060516014},{-9.25,0.163166283886},{-9.15,0.165684020996},{-9.05,0.173950651984},{-8.95,0.183082711522},{-8.85,0.191838080361},{-8.75,0.201038108442},{-8.65,0.217212728363},{-8.55,0.23580917472},{-8.45,0.230865530416},{-8.35,0.243062882501},{-8.25,0.250033567696},{-8.15,0.254139229465},{-8.05,0.274679275916},{-7.95,0.280037852075},{-7.85,0.300073406653},{-7.75,0.295303330663},{-7.65,0.300856917425},{-7.55,0.333646922905},{-7.45,0.341261612385},{-7.35,0.370842683007},{-7.25,0.369219139708},{-7.15,0.379666913909},{-7.05,0.385485262484},{-6.95,0.413975624242},{-6.85,0.419770934466},{-6.75,0.435696015103},{-6.65,0.44972103558},{-6.55,0.467205963359},{-6.45,0.469815020494},{-6.35,0.497920608791},{-6.25,0.513904933764},{-6.15,0.530637603499},{-6.05,0.53647674842},{-5.95,0.548007726287},{-5.85,0.568763029628},{-5.75,0.604955400387},{-5.65,0.627226298353},{-5.55,0.647503905323},{-5.45,0.644367410075},{-5.35,0.694041177728},{-5.25,0.688434932837},{-5.15,0.702234721267},{-5.05,0.715374406197},{-4.95,0.729714337143},{-4.85,0.788200175555},{-4.75,0.788882266974},{-4.65,0.8154538035},{-4.55,0.822377706842},{-4.45,0.834697296619},{-4.35,0.877098403095},{-4.25,0.864068556686},{-4.15,0.905030309119},{-4.05,0.891219127791},{-3.95,0.941334792701},{-3.85,0.97656709822},{-3.75,0.958219010701},{-3.65,0.979834666628},{-3.55,0.99197886443},{-3.45,1.03291402498},{-3.35,1.04741572113},{-3.25,1.0376282716},{-3.15,1.13139316896},{-3.05,1.1134944593},{-2.95,1.1351502729},{-2.85,1.12790685619},{-2.75,1.18974946356},{-2.65,1.18633681692},{-2.55,1.20466086245},{-2.45,1.24591192048},{-2.35,1.22809836845},{-2.25,1.29145027481},{-2.15,1.28124552236},{-2.05,1.31127902213},{-1.95,1.31967194379},{-1.85,1.3507862974},{-1.75,1.35731088224},{-1.65,1.36608433808},{-1.55,1.3806062001},{-1.45,1.35796449099},{-1.35,1.41910839671},{-1.25,1.41131339805},{-1.15,1.37823396533},{-1.05,1.47805393764},{-0.95,1.47002447315},{-0.85,1.51705047332},{-0.75,1.53645895962},{-0.65,1.46898800433},{-0.55,1.49716577877},{-0.45,1.54859978653},{-0.35,1.53074341897},{-0.25,1.50514894635},{-0.15,1.56345034606},{-0.05,1.59217693297},{0.05,1.61903311974},{0.15,1.56815396088},{0.25,1.56400237038},{0.35,1.59453712489},{0.45,1.59301951883},{0.55,1.57921468338},{0.65,1.64176455248},{0.75,1.61213921252},{0.85,1.6543598903},{0.95,1.64783974022},{1.05,1.66300345276},{1.15,1.62769987383},{1.25,1.5976548684},{1.35,1.56189475361},{1.45,1.64026596614},{1.55,1.60580474728},{1.65,1.63181135305},{1.75,1.61291276106},{1.85,1.592056661},{1.95,1.66455630073},{2.05,1.60425055088},{2.15,1.57634402624},{2.25,1.61091312471},{2.35,1.57523866397},{2.45,1.61717238749},{2.55,1.54157162598},{2.65,1.54297072845},{2.75,1.59914794991},{2.85,1.54363931562},{2.95,1.56925921367},{3.05,1.54723554402},{3.15,1.53298106092},{3.25,1.54480760589},{3.35,1.52610437068},{3.45,1.50905332669},{3.55,1.51882301519},{3.65,1.44933079447},{3.75,1.48321736051},{3.85,1.4134237125},{3.95,1.46959668976},{4.05,1.44130605503},{4.15,1.40505086617},{4.25,1.42747006701},{4.35,1.34013008459},{4.45,1.34273986705},{4.55,1.39009050947},{4.65,1.31555602471},{4.75,1.30064481569},{4.85,1.23215709492},{4.95,1.29182979715},{5.05,1.20400677047},{5.15,1.15687608377},{5.25,1.2248482848},{5.35,1.20620940452},{5.45,1.16746695421},{5.55,1.17052202538},{5.65,1.16524079037},{5.75,1.11271182511},{5.85,1.09834398379},{5.95,1.09516140633},{6.05,1.08855327364},{6.15,1.054660144},{6.25,1.03881904478},{6.35,1.03497121259},{6.45,0.983940900836},{6.55,0.974185466187},{6.65,0.952363734828},{6.75,0.927927068367},{6.85,0.923917007191},{6.95,0.901481796097},{7.05,0.834951050949},{7.15,0.859584542208},{7.25,0.835119756252},{7.35,0.83388420243},{7.45,0.76786194315},{7.55,0.76815820589},{7.65,0.736104212597},{7.75,0.684764825025},{7.85,0.717359858451},{7.95,0.670793642317},{8.05,0.669336988436},{8.15,0.684343314465},{8.25,0.653380901213},{8.35,0.694018843611},{8.45,0.597251883824},{8.55,0.549716742275},{8.65,0.5539528733},{8.75,0.558164923464},{8.85,0.509690724886},{8.95,0.500358851269},{9.05,0.469400447084},{9.15,0.52951658284},{9.25,0.477873529707},{9.35,0.474005649283},{9.45,0.454481165327},{9.55,0.400244818793},{9.65,0.39039988332},{9.75,0.342869185815},{9.85,0.367357592211},{9.95,0.334659596388},{10.05,0.365759767132},{10.15,0.344822369781},{10.25,0.307667424602},{10.35,0.279197540891},{10.45,0.282168851699},{10.55,0.280851278866},{10.65,0.295799829627},{10.75,0.300675344043},{10.85,0.255911944664},{10.95,0.243410825058},{11.05,0.241821359272},{11.15,0.217434467854},{11.25,0.210987549794},{11.35,0.211257457733},{11.45,0.226170516596},{11.55,0.173475667733},{11.65,0.164412912969},{11.75,0.158589983518},{11.85,0.163011878105},{11.95,0.171208705717},{12.05,0.161730518341},{12.15,0.157637103911},{12.25,0.146982570271},{12.35,0.135231742646},{12.45,0.13047096433},{12.55,0.125510621071},{12.65,0.12394968239},{12.75,0.0982439729589},{12.85,0.125127323469},{12.95,0.0926284403414},{13.05,0.0930196805434},{13.15,0.0843089971327},{13.25,0.0941375750248},{13.35,0.0659127200607},{13.45,0.0809265080065},{13.55,0.0781851119183},{13.65,0.0644286550008},{13.75,0.0561625102781},{13.85,0.0700849062437},{13.95,0.0791709730702},{14.05,0.054339748621},{14.15,0.054655979077},{14.25,0.0432223891035},{14.35,0.0435001044206},{14.45,0.0456798768813},{14.55,0.0411082447552},{14.65,0.0358092027997},{14.75,0.0384063455794},{14.85,0.0565908588469},{14.95,0.0343903150964},{15.05,0.0254061078203},{15.15,0.0217525998751},{15.25,0.0286266314678},{15.35,0.030435198918},{15.45,0.0374917543453},{15.55,0.0329837898413},{15.65,0.0205974719104},{15.75,0.0176959435145},{15.85,0.0153171174666},{15.95,0.0267365078131},{16.05,0.0282917001418},{16.15,0.0168676584959},{16.25,0.0138445988945},{16.35,0.0108090341091},{16.45,0.00971885211766},{16.55,0.0150305873581},{16.65,0.0111152122418},{16.75,0.00981163326651},{16.85,0.0105373167566},{16.95,0.00437672282087},{17.05,0.0062534665068},{17.15,0.00774724719425},{17.25,0.0082389883697},{17.35,0.00950346674238},{17.45,0.0133605226874},{17.55,0.00590708272325},{17.65,0.00539291929454},{17.75,0.00612357258797},{17.85,0.0086286701262},{17.95,0.00855908449739},{18.05,0.00512153357267},{18.15,0.00250509791076},{18.25,0.00621635404726},{18.35,0.00253602510525},{18.45,0.00501019600779},{18.55,0.0062627447769},{18.65,0.00519575861593},{18.75,0.00306178629398},{18.85,0.00371125619859},{18.95,0.0},{19.05,0.00176284664},{19.15,0.00139172111327},{19.25,0.00167006533593},{19.35,0.00139172111327},{19.45,0.00528853992},{19.55,0.000371125604336},{19.65,0.0},{19.75,0.00278344214894},{19.85,0.00278344214894},{19.95,0.00194840948097},{20.05,0.0},{20.15,0.0},{20.25,0.00167006521951},{20.35,0.0},{20.45,0.00139172107447},{20.55,0.000278344203252},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.000278344203252},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU18 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.000278344203252},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.000556688406505},{-21.35,0.000278344203252},{-21.25,3.97634576075e-05},{-21.15,0.000556688406505},{-21.05,0.000139172101626},{-20.95,0.000185562802168},{-20.85,0.000185562802168},{-20.75,4.28221851157e-05},{-20.65,0.000139172101626},{-20.55,0.0},{-20.45,0.000185562802168},{-20.35,0.000742251208673},{-20.25,0.0},{-20.15,0.00015905383043},{-20.05,0.0},{-19.95,0.00010437907622},{-19.85,0.000324734913496},{-19.75,0.000347930268617},{-19.65,0.000139172107447},{-19.55,0.000417516304879},{-19.45,8.56443702315e-05},{-19.35,0.000328952256082},{-19.25,0.000649469801121},{-19.15,0.000278344210237},{-19.05,0.000258462486922},{-18.95,0.000278344206316},{-18.85,0.000278344222655},{-18.75,0.000244942903519},{-18.65,0.000389681880673},{-18.55,0.000360816579174},{-18.45,0.000450652536182},{-18.35,0.000423567288596},{-18.25,0.00060729644346},{-18.15,0.000475878797231},{-18.05,0.000727977173833},{-17.95,0.00111337681301},{-17.85,0.000940611457516},{-17.75,0.00123266724958},{-17.65,0.000938123092055},{-17.55,0.00083503265466},{-17.45,0.00125676630573},{-17.35,0.0008756245176},{-17.25,0.00120842120633},{-17.15,0.00173501223326},{-17.05,0.00139172104272},{-16.95,0.0016321092844},{-16.85,0.00153907972808},{-16.75,0.00159328071208},{-16.65,0.00193235120521},{-16.55,0.00214996908245},{-16.45,0.00189358413671},{-16.35,0.00229322398776},{-16.25,0.00204428351588},{-16.15,0.00252945292741},{-16.05,0.00289746257196},{-15.95,0.00267488777637},{-15.85,0.00358754760689},{-15.75,0.00484247543873},{-15.65,0.00325271659646},{-15.55,0.00367928953732},{-15.45,0.00534977555275},{-15.35,0.00526555743786},{-15.25,0.00566340694504},{-15.15,0.00584941385384},{-15.05,0.00530345134792},{-14.95,0.00691797089403},{-14.85,0.00695512592793},{-14.75,0.00644346078237},{-14.65,0.00753474812354},{-14.55,0.00829612267645},{-14.45,0.00901157057225},{-14.35,0.0102930264595},{-14.25,0.0121464678582},{-14.15,0.0116311797389},{-14.05,0.0138476240635},{-13.95,0.0148667775843},{-13.85,0.0138501393268},{-13.75,0.0151692178927},{-13.65,0.0175233883073},{-13.55,0.0150426885356},{-13.45,0.0188834575185},{-13.35,0.0178266045559},{-13.25,0.0171518626966},{-13.15,0.0227901767882},{-13.05,0.0204840189294},{-12.95,0.0229778434657},{-12.85,0.0257627037523},{-12.75,0.0259915240975},{-12.65,0.0290661447122},{-12.55,0.0291375498618},{-12.45,0.0319156137287},{-12.35,0.0365707185533},{-12.25,0.0346549205853},{-12.15,0.0379240010676},{-12.05,0.0373089559591},{-11.95,0.0428088466678},{-11.85,0.0437367264875},{-11.75,0.0487236225388},{-11.65,0.0478586120151},{-11.55,0.0518537681008},{-11.45,0.0563697814941},{-11.35,0.0551004822257},{-11.25,0.0612621659654},{-11.15,0.0611559580719},{-11.05,0.0714685496523},{-10.95,0.071204522143},{-10.85,0.0730719719144},{-10.75,0.0786803483703},{-10.65,0.0809652012237},{-10.55,0.0870316033451},{-10.45,0.0966802517573},{-10.35,0.0993650545072},{-10.25,0.100844004575},{-10.15,0.104156601126},{-10.05,0.112880402547},{-9.95,0.119842135691},{-9.85,0.128558425187},{-9.75,0.117169539476},{-9.65,0.135447890779},{-9.55,0.138412010514},{-9.45,0.148881350922},{-9.35,0.153347466185},{-9.25,0.163836978855},{-9.15,0.164542654922},{-9.05,0.176212113856},{-8.95,0.174082009834},{-8.85,0.188839019649},{-8.75,0.198305589181},{-8.65,0.21424725064},{-8.55,0.214253210722},{-8.45,0.231149004217},{-8.35,0.23859272973},{-8.25,0.238493724861},{-8.15,0.259104338953},{-8.05,0.272099999709},{-7.95,0.26639405966},{-7.85,0.30192543718},{-7.75,0.314387800574},{-7.65,0.307397748412},{-7.55,0.338816780356},{-7.45,0.343006734449},{-7.35,0.362477371694},{-7.25,0.371505059559},{-7.15,0.377638566826},{-7.05,0.384373399845},{-6.95,0.409153829544},{-6.85,0.415260971477},{-6.75,0.435106620676},{-6.65,0.456468285703},{-6.55,0.449367199205},{-6.45,0.471239584222},{-6.35,0.494153293066},{-6.25,0.511010742187},{-6.15,0.523328603888},{-6.05,0.545996133319},{-5.95,0.555794462768},{-5.85,0.58687412066},{-5.75,0.601889651471},{-5.65,0.618283675021},{-5.55,0.640357087594},{-5.45,0.660856056555},{-5.35,0.681334331623},{-5.25,0.698776944737},{-5.15,0.703484908766},{-5.05,0.70111402115},{-4.95,0.751761778854},{-4.85,0.769851792907},{-4.75,0.784700490297},{-4.65,0.819693852397},{-4.55,0.804981292116},{-4.45,0.850285642623},{-4.35,0.893329455996},{-4.25,0.892255597462},{-4.15,0.90747690021},{-4.05,0.943267845426},{-3.95,0.941637059734},{-3.85,0.95849473643},{-3.75,0.973022955149},{-3.65,0.998683612307},{-3.55,0.986240935897},{-3.45,1.04956636936},{-3.35,1.09883468558},{-3.25,1.05606944053},{-3.15,1.12086374923},{-3.05,1.12165083148},{-2.95,1.18045386687},{-2.85,1.15405825693},{-2.75,1.15404390228},{-2.65,1.16675238951},{-2.55,1.18524310945},{-2.45,1.27120779689},{-2.35,1.246942132},{-2.25,1.27071002567},{-2.15,1.285810549},{-2.05,1.29168181612},{-1.95,1.28871285888},{-1.85,1.32383947407},{-1.75,1.35039007979},{-1.65,1.3140698061},{-1.55,1.36850013741},{-1.45,1.40546931655},{-1.35,1.4262703733},{-1.25,1.44662989823},{-1.15,1.43432819299},{-1.05,1.4975138927},{-0.95,1.4293509887},{-0.85,1.47257253872},{-0.75,1.48548123141},{-0.65,1.52080021164},{-0.55,1.55156951824},{-0.45,1.50666956019},{-0.35,1.5317819002},{-0.25,1.54022527412},{-0.15,1.55072765173},{-0.05,1.58474078695},{0.05,1.58010591076},{0.15,1.54686517374},{0.25,1.60015913712},{0.35,1.58148739724},{0.45,1.60542185416},{0.55,1.64001628715},{0.65,1.58704292648},{0.75,1.57626950977},{0.85,1.60745585674},{0.95,1.60078160215},{1.05,1.61889139462},{1.15,1.63918727666},{1.25,1.64960182747},{1.35,1.62501740998},{1.45,1.66914983069},{1.55,1.58759542489},{1.65,1.63293554546},{1.75,1.62051670111},{1.85,1.59061674438},{1.95,1.68729410891},{2.05,1.60835494538},{2.15,1.56686962999},{2.25,1.64396374304},{2.35,1.58230544735},{2.45,1.63495443408},{2.55,1.51825238869},{2.65,1.58334129848},{2.75,1.57662463279},{2.85,1.56457657369},{2.95,1.53020841378},{3.05,1.529844346},{3.15,1.56273458606},{3.25,1.52041256577},{3.35,1.51891673654},{3.45,1.5162296584},{3.55,1.52789964882},{3.65,1.50178898135},{3.75,1.46299565153},{3.85,1.45752361334},{3.95,1.4432050213},{4.05,1.36967955783},{4.15,1.42574503775},{4.25,1.41430647014},{4.35,1.43199981223},{4.45,1.362675872},{4.55,1.3569663312},{4.65,1.34308542043},{4.75,1.30239289065},{4.85,1.28110252372},{4.95,1.26097870171},{5.05,1.24526203322},{5.15,1.24107034722},{5.25,1.2207690811},{5.35,1.16867475062},{5.45,1.15907546311},{5.55,1.17357886566},{5.65,1.13988447761},{5.75,1.11707956777},{5.85,1.12914288233},{5.95,1.07381220958},{6.05,1.07783036923},{6.15,1.05909367548},{6.25,1.04077839903},{6.35,0.983537880622},{6.45,0.98495339888},{6.55,0.956371774299},{6.65,0.947382416596},{6.75,0.934227117931},{6.85,0.929252147675},{6.95,0.911043638824},{7.05,0.842465267843},{7.15,0.856237271155},{7.25,0.834944367667},{7.35,0.789623389763},{7.45,0.784235828763},{7.55,0.79529848122},{7.65,0.805465658402},{7.75,0.723285498209},{7.85,0.722335226494},{7.95,0.659369062284},{8.05,0.635058625512},{8.15,0.705035037682},{8.25,0.636728130773},{8.35,0.599376670943},{8.45,0.617977249907},{8.55,0.567107862418},{8.65,0.53636392094},{8.75,0.51574024755},{8.85,0.508348666556},{8.95,0.472853714607},{9.05,0.525814844557},{9.15,0.530830973671},{9.25,0.464687870998},{9.35,0.414549434886},{9.45,0.453340014572},{9.55,0.416856590734},{9.65,0.407094062444},{9.75,0.391676537465},{9.85,0.398543886093},{9.95,0.336219542321},{10.05,0.394075218054},{10.15,0.331044416019},{10.25,0.361048659233},{10.35,0.327620532062},{10.45,0.299070332845},{10.55,0.287956450212},{10.65,0.271563459745},{10.75,0.257179891396},{10.85,0.263372628585},{10.95,0.225992423206},{11.05,0.221610257942},{11.15,0.244570256833},{11.25,0.231093645893},{11.35,0.198939320436},{11.45,0.20045905643},{11.55,0.181458424047},{11.65,0.186178156243},{11.75,0.204060936853},{11.85,0.172984979092},{11.95,0.156429452411},{12.05,0.153841741553},{12.15,0.152802661877},{12.25,0.148950970362},{12.35,0.138802502325},{12.45,0.128268739912},{12.55,0.115225330814},{12.65,0.11330775872},{12.75,0.109770440752},{12.85,0.0991728140873},{12.95,0.111007153988},{13.05,0.0738630076817},{13.15,0.0969588836034},{13.25,0.0815462215926},{13.35,0.0772936983806},{13.45,0.070411955724},{13.55,0.0793479802657},{13.65,0.0641213119577},{13.75,0.0636424199499},{13.85,0.0706020116806},{13.95,0.0707817547758},{14.05,0.0633155769772},{14.15,0.0613200736768},{14.25,0.0635064275641},{14.35,0.0461355513997},{14.45,0.0472062787702},{14.55,0.0379449817496},{14.65,0.0388065691917},{14.75,0.0430411027402},{14.85,0.0455092787743},{14.95,0.0308067394154},{15.05,0.0289477987109},{15.15,0.0218634893817},{15.25,0.0247436414162},{15.35,0.0336976089785},{15.45,0.0323475727013},{15.55,0.0372854715044},{15.65,0.0196872111913},{15.75,0.017734502043},{15.85,0.017083376646},{15.95,0.0216140332429},{16.05,0.0207830341089},{16.15,0.0119966357946},{16.25,0.00803718939424},{16.35,0.0133075047107},{16.45,0.00822855066508},{16.55,0.0135275284449},{16.65,0.00878049433231},{16.75,0.0169789969921},{16.85,0.0215517942395},{16.95,0.0062808977521},{17.05,0.0112729407847},{17.15,0.00996472239494},{17.25,0.0082389883697},{17.35,0.00548123969482},{17.45,0.00604766065424},{17.55,0.00606171828177},{17.65,0.0127481654286},{17.75,0.00535812601447},{17.85,0.00504498882219},{17.95,0.00379243982024},{18.05,0.00601223483682},{18.15,0.0123863173649},{18.25,0.00228242259473},{18.35,0.00269066066378},{18.45,0.00354888872243},{18.55,0.00208758166991},{18.65,0.00278344210237},{18.75,0.00285302824341},{18.85,0.00199480013301},{18.95,0.00269066076726},{19.05,0.00160047924146},{19.15,0.00222675362602},{19.25,0.00334013043903},{19.35,0.0036184748169},{19.45,0.000904618704226},{19.55,0.0036184748169},{19.65,0.00445350725204},{19.75,0.000835032609757},{19.85,0.000835032609757},{19.95,0.000371125604336},{20.05,0.0},{20.15,0.0},{20.25,0.000556688406505},{20.35,0.0},{20.45,0.0},{20.55,0.00250509800389},{20.65,0.00194840948097},{20.75,0.000556688406505},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.000556688406505},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU19 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.000278344203252},{-23.15,0.000278344203252},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.000463907024823},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,6.95860508131e-05},{-21.45,0.0},{-21.35,0.0},{-21.25,0.000278344203252},{-21.15,0.0},{-21.05,0.000463907024823},{-20.95,0.0},{-20.85,0.000556688406505},{-20.75,0.000119290372822},{-20.65,0.000119290372822},{-20.55,5.56688406505e-05},{-20.45,0.000167006521951},{-20.35,3.97634576075e-05},{-20.25,7.9526915215e-05},{-20.15,0.000324734913496},{-20.05,0.00010437907622},{-19.95,8.56443702315e-05},{-19.85,0.000328952256082},{-19.75,0.000139172107447},{-19.65,0.000278344222655},{-19.55,0.000167006521951},{-19.45,0.00021648994233},{-19.35,0.000301539568075},{-19.25,0.000185562802168},{-19.15,0.000278344222655},{-19.05,0.00022922464482},{-18.95,0.000417516333982},{-18.85,0.000417516300721},{-18.75,0.00029574072687},{-18.65,0.000811837303142},{-18.55,0.000269645941444},{-18.45,0.000506080390716},{-18.35,0.000378548130393},{-18.25,0.000776433827061},{-18.15,0.00113193318248},{-18.05,0.000587615563914},{-17.95,0.00102547869871},{-17.85,0.00106884174049},{-17.75,0.000713257060852},{-17.65,0.00089407531601},{-17.55,0.00149775686718},{-17.45,0.000864643682825},{-17.35,0.000792210420164},{-17.25,0.00107784355257},{-17.15,0.0012213062419},{-17.05,0.00158442088809},{-16.95,0.000990577918642},{-16.85,0.00208025680561},{-16.75,0.00161903550227},{-16.65,0.00176772985019},{-16.55,0.00245597841693},{-16.45,0.00228914130351},{-16.35,0.00238229904105},{-16.25,0.00195439544416},{-16.15,0.00222675369845},{-16.05,0.00257468394314},{-15.95,0.00277781907958},{-15.85,0.00336130902819},{-15.75,0.00358723195232},{-15.65,0.00379608472188},{-15.55,0.00394362026611},{-15.45,0.00462197891453},{-15.35,0.0051576943479},{-15.25,0.00610120541283},{-15.15,0.00571533441544},{-15.05,0.00611777396666},{-14.95,0.00646117733371},{-14.85,0.00781927453844},{-14.75,0.00855095123316},{-14.65,0.00783254638795},{-14.55,0.00818276583259},{-14.45,0.0105536238531},{-14.35,0.0108744684019},{-14.25,0.0103293788542},{-14.15,0.0127390705713},{-14.05,0.0120879229853},{-13.95,0.0133085488284},{-13.85,0.0142813680671},{-13.75,0.0138832658841},{-13.65,0.0145795416124},{-13.55,0.0180050702113},{-13.45,0.0175786447678},{-13.35,0.0194929872458},{-13.25,0.0189830752781},{-13.15,0.0206127651445},{-13.05,0.0209058125814},{-12.95,0.0251674600269},{-12.85,0.0248520641792},{-12.75,0.0259830792011},{-12.65,0.0298597063337},{-12.55,0.0282254696867},{-12.45,0.0320679366714},{-12.35,0.0364073003299},{-12.25,0.0389811628956},{-12.15,0.0399823939706},{-12.05,0.0366366003689},{-11.95,0.0444392814293},{-11.85,0.0433235868122},{-11.75,0.0465083114791},{-11.65,0.0519260668108},{-11.55,0.0571555724511},{-11.45,0.0574935901899},{-11.35,0.0617511612048},{-11.25,0.0627509515017},{-11.15,0.0592420505405},{-11.05,0.0725859856421},{-10.95,0.0697642176461},{-10.85,0.0728125473834},{-10.75,0.0816949592607},{-10.65,0.0830012513801},{-10.55,0.0840191039446},{-10.45,0.089359367087},{-10.35,0.092645002448},{-10.25,0.106386693196},{-10.15,0.105306814262},{-10.05,0.109642717708},{-9.95,0.122075928582},{-9.85,0.126690461268},{-9.75,0.119356730496},{-9.65,0.136173898159},{-9.55,0.128648237749},{-9.45,0.154487462051},{-9.35,0.161621182015},{-9.25,0.162175828877},{-9.15,0.16805054501},{-9.05,0.174184743061},{-8.95,0.187078366553},{-8.85,0.186428319381},{-8.75,0.196017145501},{-8.65,0.211228279711},{-8.55,0.230381129304},{-8.45,0.23222127836},{-8.35,0.233875822984},{-8.25,0.252195344383},{-8.15,0.257719289859},{-8.05,0.275445751563},{-7.95,0.280755376679},{-7.85,0.285311670277},{-7.75,0.312719205531},{-7.65,0.31876299635},{-7.55,0.344481334948},{-7.45,0.34650505987},{-7.35,0.365526550608},{-7.25,0.356374032329},{-7.15,0.372260699356},{-7.05,0.382943912192},{-6.95,0.41023703459},{-6.85,0.406840146213},{-6.75,0.437333270913},{-6.65,0.451560784417},{-6.55,0.46177966573},{-6.45,0.476062718464},{-6.35,0.513159616417},{-6.25,0.512488541168},{-6.15,0.546363056271},{-6.05,0.556551689777},{-5.95,0.566681939071},{-5.85,0.581717153403},{-5.75,0.592959140209},{-5.65,0.616117264209},{-5.55,0.632483381051},{-5.45,0.650012370932},{-5.35,0.671192267342},{-5.25,0.721094870312},{-5.15,0.723268385909},{-5.05,0.713696620775},{-4.95,0.744777452848},{-4.85,0.769444288552},{-4.75,0.780850232658},{-4.65,0.808676227325},{-4.55,0.808957033741},{-4.45,0.828455471018},{-4.35,0.867116393498},{-4.25,0.883174844457},{-4.15,0.904207903354},{-4.05,0.897145482113},{-3.95,0.956323863549},{-3.85,0.990921498056},{-3.75,0.971618262666},{-3.65,0.992054176196},{-3.55,1.00174233508},{-3.45,1.05428651054},{-3.35,1.07963084973},{-3.25,1.05722851519},{-3.15,1.11565741664},{-3.05,1.11565984417},{-2.95,1.1567804784},{-2.85,1.14483260349},{-2.75,1.18872048357},{-2.65,1.20876532069},{-2.55,1.18323474742},{-2.45,1.2591907644},{-2.35,1.2525937671},{-2.25,1.24376998556},{-2.15,1.31311951292},{-2.05,1.30490126173},{-1.95,1.30891113281},{-1.85,1.35610633775},{-1.75,1.36643307585},{-1.65,1.38944563257},{-1.55,1.40143111526},{-1.45,1.39487948803},{-1.35,1.45275999186},{-1.25,1.41166613739},{-1.15,1.43448236186},{-1.05,1.47223275041},{-0.95,1.4283828214},{-0.85,1.4799255683},{-0.75,1.52815176331},{-0.65,1.5064975516},{-0.55,1.51547215128},{-0.45,1.52322391606},{-0.35,1.5082354645},{-0.25,1.52466183},{-0.15,1.57701479363},{-0.05,1.57774670738},{0.05,1.56887551869},{0.15,1.57572313241},{0.25,1.57266161759},{0.35,1.62314424647},{0.45,1.59784815187},{0.55,1.6261829653},{0.65,1.59252843304},{0.75,1.60362528369},{0.85,1.59216553278},{0.95,1.63885992623},{1.05,1.62988652353},{1.15,1.58864387874},{1.25,1.63739477013},{1.35,1.64474216713},{1.45,1.60227309925},{1.55,1.63677801369},{1.65,1.61821539283},{1.75,1.58622157828},{1.85,1.62907674564},{1.95,1.56818779774},{2.05,1.61195057088},{2.15,1.56171800855},{2.25,1.59644577363},{2.35,1.6023691487},{2.45,1.58654223804},{2.55,1.563922893},{2.65,1.61327604984},{2.75,1.56050170997},{2.85,1.53534063869},{2.95,1.55399402663},{3.05,1.56179818265},{3.15,1.54006510043},{3.25,1.51060538456},{3.35,1.52407204861},{3.45,1.52696333276},{3.55,1.53876350233},{3.65,1.49615794938},{3.75,1.4722764586},{3.85,1.43507167409},{3.95,1.44845523249},{4.05,1.46714726124},{4.15,1.42510419766},{4.25,1.39119691506},{4.35,1.39127713056},{4.45,1.39851011847},{4.55,1.36379186447},{4.65,1.32161844575},{4.75,1.28422063314},{4.85,1.26340350388},{4.95,1.27061081978},{5.05,1.24083500928},{5.15,1.21983940972},{5.25,1.21546067654},{5.35,1.18189146146},{5.45,1.18779430356},{5.55,1.12593051425},{5.65,1.15051405039},{5.75,1.13030520352},{5.85,1.09404268867},{5.95,1.07316944697},{6.05,1.08065808457},{6.15,1.04743074451},{6.25,1.03881736854},{6.35,1.0073700035},{6.45,1.00246149466},{6.55,0.953993195384},{6.65,0.919323341259},{6.75,0.944475337369},{6.85,0.876977374909},{6.95,0.856513938712},{7.05,0.890666221818},{7.15,0.857551276351},{7.25,0.859172629747},{7.35,0.82335696459},{7.45,0.806268466321},{7.55,0.779579355747},{7.65,0.762945151739},{7.75,0.6738674723},{7.85,0.711841858539},{7.95,0.681908572531},{8.05,0.676013228431},{8.15,0.680862531784},{8.25,0.619565020071},{8.35,0.587894854578},{8.45,0.621941880217},{8.55,0.592371695623},{8.65,0.524482250214},{8.75,0.511125794451},{8.85,0.504833487984},{8.95,0.51289582401},{9.05,0.524261890947},{9.15,0.49283091924},{9.25,0.456102108402},{9.35,0.432432471381},{9.45,0.473998375188},{9.55,0.431470807089},{9.65,0.402313722271},{9.75,0.364916666922},{9.85,0.350557175795},{9.95,0.369672430397},{10.05,0.353200296032},{10.15,0.32366704401},{10.25,0.325621651821},{10.35,0.322408676147},{10.45,0.275193031388},{10.55,0.283295969393},{10.65,0.276409787995},{10.75,0.277923424624},{10.85,0.253224178186},{10.95,0.259839923902},{11.05,0.252611788308},{11.15,0.208202236989},{11.25,0.226025366014},{11.35,0.196924268102},{11.45,0.205398492646},{11.55,0.202130210131},{11.65,0.182102302636},{11.75,0.171224021186},{11.85,0.197958946228},{11.95,0.195857187112},{12.05,0.160326273936},{12.15,0.137927530095},{12.25,0.131884901612},{12.35,0.132032218346},{12.45,0.127237907616},{12.55,0.1255185869},{12.65,0.117437490603},{12.75,0.10784820231},{12.85,0.0999360084534},{12.95,0.101393206136},{13.05,0.0934466639309},{13.15,0.0949910888672},{13.25,0.096760038896},{13.35,0.0723571212203},{13.45,0.0755968504939},{13.55,0.0868403361394},{13.65,0.0830055180718},{13.75,0.0662947045159},{13.85,0.0747046966057},{13.95,0.0655095426342},{14.05,0.0559604395004},{14.15,0.0615722314635},{14.25,0.0614073713621},{14.35,0.0521317298596},{14.45,0.0670438395606},{14.55,0.0422783448146},{14.65,0.0343853117714},{14.75,0.0343889767124},{14.85,0.0386230421066},{14.95,0.0324322559215},{15.05,0.0329026058316},{15.15,0.0266675169651},{15.25,0.0325813196801},{15.35,0.0371925460881},{15.45,0.0354888874751},{15.55,0.0361000351284},{15.65,0.0179905397136},{15.75,0.019701551646},{15.85,0.0175356847398},{15.95,0.0220375993977},{16.05,0.0153398591059},{16.15,0.0117513444275},{16.25,0.00822580409677},{16.35,0.0131547891575},{16.45,0.0080806799233},{16.55,0.0132213499811},{16.65,0.0186237584461},{16.75,0.0116719007492},{16.85,0.0177096500993},{16.95,0.00554158030586},{17.05,0.00964926617841},{17.15,0.00989668319623},{17.25,0.0100551843643},{17.35,0.00762663111091},{17.45,0.00930464906352},{17.55,0.00719718581864},{17.65,0.00344718591525},{17.75,0.00816476345062},{17.85,0.0044883005321},{17.95,0.0116904564202},{18.05,0.00491741423806},{18.15,0.00480143772438},{18.25,0.0097420476377},{18.35,0.00350713692605},{18.45,0.00328446179628},{18.55,0.00167006533593},{18.65,0.00367414355278},{18.75,0.00612357258797},{18.85,0.00324734921257},{18.95,0.00185562809929},{19.05,0.0},{19.15,0.00375764677301},{19.25,0.00292261410505},{19.35,0.00111337681301},{19.45,0.000927814049646},{19.55,0.00139172111327},{19.65,0.00111337681301},{19.75,0.00194840948097},{19.85,0.00167006521951},{19.95,0.000835032609757},{20.05,0.0},{20.15,0.0},{20.25,0.000278344203252},{20.35,0.0},{20.45,0.0},{20.55,0.0},{20.65,0.000278344203252},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.000139172101626},{21.25,0.0},{21.35,0.000835032609757},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU20 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.000556688406505},{-21.95,0.0},{-21.85,0.000139172101626},{-21.75,0.000139172101626},{-21.65,0.000835032609757},{-21.55,0.0},{-21.45,0.0},{-21.35,0.000185562802168},{-21.25,0.0},{-21.15,0.0},{-21.05,0.000139172101626},{-20.95,0.0},{-20.85,0.000139172101626},{-20.75,2.78344203252e-05},{-20.65,6.95860508131e-05},{-20.55,0.000347930268617},{-20.45,0.000278344214894},{-20.35,5.56688406505e-05},{-20.25,0.000173965134309},{-20.15,6.95860508131e-05},{-20.05,6.95860508131e-05},{-19.95,3.97634576075e-05},{-19.85,0.000123708534779},{-19.75,0.000107055467267},{-19.65,0.000198817296353},{-19.55,0.000128466555347},{-19.45,0.000208758152439},{-19.35,9.27814010841e-05},{-19.25,0.00030364822173},{-19.15,0.000487102370244},{-19.05,0.000173965134309},{-18.95,0.000261971014826},{-18.85,0.000835032625632},{-18.75,0.000974204740487},{-18.65,0.000394320969159},{-18.55,0.000347930262797},{-18.45,0.000324734913496},{-18.35,0.000487102361928},{-18.25,0.000391743697778},{-18.15,0.000788641938319},{-18.05,0.000922015169635},{-17.95,0.000487102350841},{-17.85,0.000781504867169},{-17.75,0.00103219311374},{-17.65,0.000666339176171},{-17.55,0.000966018175378},{-17.45,0.00115827110506},{-17.35,0.000963499196447},{-17.25,0.00109395748654},{-17.15,0.00117388643},{-17.05,0.00128947213596},{-16.95,0.00155754308117},{-16.85,0.0013485296533},{-16.75,0.00135318109622},{-16.65,0.00168234515278},{-16.55,0.00236845612526},{-16.45,0.00259787920449},{-16.35,0.00203376829624},{-16.25,0.00200019447609},{-16.15,0.00246864805619},{-16.05,0.00334797127986},{-15.95,0.00283325094926},{-15.85,0.00363544683631},{-15.75,0.00309380809818},{-15.65,0.0035037186585},{-15.55,0.00345399862889},{-15.45,0.00554948796829},{-15.35,0.00611530495162},{-15.25,0.00502861554132},{-15.15,0.00568219806467},{-15.05,0.00583954773793},{-14.95,0.00619719912929},{-14.85,0.00797985389199},{-14.75,0.00700701319653},{-14.65,0.00788641937317},{-14.55,0.00779498256923},{-14.45,0.00973330367922},{-14.35,0.00896490042189},{-14.25,0.0115148025809},{-14.15,0.0109006258158},{-14.05,0.0131166517188},{-13.95,0.0125604190078},{-13.85,0.0133274106731},{-13.75,0.0159092160114},{-13.65,0.0157578734941},{-13.55,0.0169561186882},{-13.45,0.0168205687085},{-13.35,0.017555218691},{-13.25,0.0185623263502},{-13.15,0.0202564236882},{-13.05,0.021743076726},{-12.95,0.0233859620564},{-12.85,0.0229510326863},{-12.75,0.0285547173964},{-12.65,0.0306399104619},{-12.55,0.0271856942492},{-12.45,0.0350874400855},{-12.35,0.0346392946762},{-12.25,0.0408250554403},{-12.15,0.0387342746441},{-12.05,0.0411100510969},{-11.95,0.0436671773948},{-11.85,0.0465242875184},{-11.75,0.0544288973711},{-11.65,0.0490509957978},{-11.55,0.0517371787081},{-11.45,0.0578047500815},{-11.35,0.0585585740896},{-11.25,0.0655047170534},{-11.15,0.063970501018},{-11.05,0.0747950099459},{-10.95,0.0732072156071},{-10.85,0.0703903570803},{-10.75,0.0791095767105},{-10.65,0.0807712346285},{-10.55,0.0878463462837},{-10.45,0.094754165478},{-10.35,0.0958235039244},{-10.25,0.100800513339},{-10.15,0.105413883579},{-10.05,0.107571403452},{-9.95,0.122273159111},{-9.85,0.12172935196},{-9.75,0.123068838408},{-9.65,0.139207177986},{-9.55,0.133602271646},{-9.45,0.150773618348},{-9.35,0.155395087549},{-9.25,0.16503700251},{-9.15,0.170714984078},{-9.05,0.175860934787},{-8.95,0.181798001803},{-8.85,0.192781004822},{-8.75,0.204558848186},{-8.65,0.207297556756},{-8.55,0.220804279353},{-8.45,0.228961158217},{-8.35,0.235970983803},{-8.25,0.243770293019},{-8.15,0.265132814412},{-8.05,0.266408624256},{-7.95,0.261837194188},{-7.85,0.287410508341},{-7.75,0.30181797813},{-7.65,0.303892447278},{-7.55,0.336768909801},{-7.45,0.339510294772},{-7.35,0.353541779236},{-7.25,0.368862021655},{-7.15,0.371150337446},{-7.05,0.378370963057},{-6.95,0.411270231535},{-6.85,0.416443353494},{-6.75,0.434082439664},{-6.65,0.439397618706},{-6.55,0.452253604459},{-6.45,0.462040842124},{-6.35,0.494216472475},{-6.25,0.514817179306},{-6.15,0.538833074133},{-6.05,0.53347143719},{-5.95,0.546440224836},{-5.85,0.592741555234},{-5.75,0.584963434816},{-5.65,0.629529077302},{-5.55,0.626961397231},{-5.45,0.636306140975},{-5.35,0.678965035632},{-5.25,0.697871325583},{-5.15,0.700360535497},{-5.05,0.711098127694},{-4.95,0.735113649269},{-4.85,0.752060570591},{-4.75,0.778601800789},{-4.65,0.786439891133},{-4.55,0.816899402525},{-4.45,0.821028380508},{-4.35,0.854688939804},{-4.25,0.859811921657},{-4.15,0.898662983725},{-4.05,0.960045121725},{-3.95,0.931821407746},{-3.85,0.964510059027},{-3.75,0.972337741654},{-3.65,1.00608633931},{-3.55,0.986341572227},{-3.45,1.02999742248},{-3.35,1.06140975502},{-3.25,1.08162494047},{-3.15,1.10659218549},{-3.05,1.09316809843},{-2.95,1.13936662882},{-2.85,1.12279359195},{-2.75,1.18166446533},{-2.65,1.15473749045},{-2.55,1.23405323919},{-2.45,1.23697140397},{-2.35,1.22828347725},{-2.25,1.26663637776},{-2.15,1.27418600492},{-2.05,1.28614729587},{-1.95,1.32465097773},{-1.85,1.30675831222},{-1.75,1.35576545576},{-1.65,1.32386616564},{-1.55,1.34599040423},{-1.45,1.38455144805},{-1.35,1.40269312639},{-1.25,1.40914586079},{-1.15,1.39989232402},{-1.05,1.44104090817},{-0.95,1.42047964599},{-0.85,1.47938961545},{-0.75,1.46198345917},{-0.65,1.50297519079},{-0.55,1.45950093112},{-0.45,1.4921503584},{-0.35,1.5219074883},{-0.25,1.5123043085},{-0.15,1.54725858052},{-0.05,1.53314024432},{0.05,1.56474866935},{0.15,1.5363571522},{0.25,1.54692938406},{0.35,1.6451880531},{0.45,1.61829928573},{0.55,1.57768360162},{0.65,1.57769217785},{0.75,1.60011037075},{0.85,1.55273567853},{0.95,1.62948522514},{1.05,1.59386824154},{1.15,1.5946689843},{1.25,1.6378847178},{1.35,1.6313100419},{1.45,1.63788396392},{1.55,1.58285526086},{1.65,1.61438853816},{1.75,1.62291147029},{1.85,1.5773186629},{1.95,1.6320441146},{2.05,1.57997470559},{2.15,1.5862868758},{2.25,1.5578054733},{2.35,1.59386866698},{2.45,1.61798625292},{2.55,1.53447133002},{2.65,1.57092079382},{2.75,1.52420066065},{2.85,1.53239500477},{2.95,1.56382525506},{3.05,1.54818177925},{3.15,1.55170003711},{3.25,1.51448639536},{3.35,1.51829493837},{3.45,1.51451277043},{3.55,1.51233574458},{3.65,1.48498473348},{3.75,1.50342021225},{3.85,1.51847039789},{3.95,1.41752827697},{4.05,1.41895777367},{4.15,1.36317011498},{4.25,1.37073265679},{4.35,1.3373632273},{4.45,1.33963076886},{4.55,1.31161250394},{4.65,1.29873232184},{4.75,1.26785757072},{4.85,1.24376175117},{4.95,1.24094216407},{5.05,1.20806915967},{5.15,1.18956407128},{5.25,1.18186494311},{5.35,1.16713995683},{5.45,1.15240467864},{5.55,1.12812450131},{5.65,1.12357541528},{5.75,1.14898963157},{5.85,1.10531512532},{5.95,1.04525584989},{6.05,1.12760131903},{6.15,1.05557980851},{6.25,1.039800039},{6.35,0.969121472589},{6.45,0.970503837797},{6.55,0.930646405405},{6.65,0.948876566309},{6.75,0.917315039304},{6.85,0.86655851863},{6.95,0.888911155493},{7.05,0.850087544881},{7.15,0.833753741464},{7.25,0.78502873012},{7.35,0.814891493464},{7.45,0.815498886594},{7.55,0.742497918065},{7.65,0.733481484532},{7.75,0.699228831921},{7.85,0.673901932608},{7.95,0.671305409678},{8.05,0.63390866999},{8.15,0.659532696847},{8.25,0.632605608328},{8.35,0.615403082432},{8.45,0.571005614244},{8.55,0.530772966921},{8.65,0.536584552095},{8.75,0.530775927622},{8.85,0.519341228677},{8.95,0.514608574641},{9.05,0.477622148819},{9.15,0.481308731786},{9.25,0.450974054206},{9.35,0.465887830905},{9.45,0.416083278961},{9.55,0.402919092019},{9.65,0.412321647937},{9.75,0.355479166604},{9.85,0.3552854404},{9.95,0.343839000742},{10.05,0.365925026322},{10.15,0.330639146779},{10.25,0.33028748978},{10.35,0.316922849963},{10.45,0.268666983608},{10.55,0.267598067344},{10.65,0.273581053081},{10.75,0.308795884076},{10.85,0.249256163452},{10.95,0.260647854374},{11.05,0.2339642116},{11.15,0.218875641047},{11.25,0.232921613186},{11.35,0.216942617338},{11.45,0.228125463748},{11.55,0.206096619599},{11.65,0.16673198088},{11.75,0.157458234592},{11.85,0.167361616598},{11.95,0.183194371867},{12.05,0.142835206623},{12.15,0.172338369158},{12.25,0.139020532665},{12.35,0.121931993394},{12.45,0.115550235729},{12.55,0.11806459267},{12.65,0.136546588113},{12.75,0.123565230571},{12.85,0.0934413029597},{12.95,0.0828113773891},{13.05,0.0821745650573},{13.15,0.0837012411843},{13.25,0.0788384597667},{13.35,0.0730789586117},{13.45,0.0740678674084},{13.55,0.0870085653368},{13.65,0.076133194177},{13.75,0.0623381885828},{13.85,0.07450949062},{13.95,0.0565846863613},{14.05,0.0610909843445},{14.15,0.0786296106734},{14.25,0.0552658643296},{14.35,0.054824684487},{14.45,0.054312545603},{14.55,0.0445257941882},{14.65,0.0451639272549},{14.75,0.0490504370795},{14.85,0.0508490926341},{14.95,0.0353274464607},{15.05,0.0340384032991},{15.15,0.020698688247},{15.25,0.0328897527746},{15.35,0.0344787682256},{15.45,0.0375764679909},{15.55,0.0367161306468},{15.65,0.0222337986484},{15.75,0.0167577495942},{15.85,0.0187882343928},{15.95,0.0275870031781},{16.05,0.0180076606896},{16.15,0.0117410647147},{16.25,0.013282585144},{16.35,0.0159738643302},{16.45,0.00826053753976},{16.55,0.00848393142223},{16.65,0.0107626426551},{16.75,0.0111337681611},{16.85,0.0113907020826},{16.95,0.00465506674915},{17.05,0.0151101137911},{17.15,0.0101131730609},{17.25,0.0124061991061},{17.35,0.0093941166997},{17.45,0.00475326266426},{17.55,0.00587306283414},{17.65,0.00985338538885},{17.75,0.00658747988443},{17.85,0.00405145477917},{17.95,0.00946370325983},{18.05,0.00510297715664},{18.15,0.00371125619859},{18.25,0.00528853992},{18.35,0.00311745516956},{18.45,0.00258462476943},{18.55,0.00417516306043},{18.65,0.00233809128404},{18.75,0.00334013043903},{18.85,0.00352569328},{18.95,0.00313137238845},{19.05,0.00315456775328},{19.15,0.00918535888195},{19.25,0.00167006533593},{19.35,0.00389681896195},{19.45,0.000946370325983},{19.55,0.00417516333982},{19.65,0.00222675362602},{19.75,0.00139172107447},{19.85,0.00111337681301},{19.95,0.0},{20.05,0.0},{20.15,0.0},{20.25,0.00111337681301},{20.35,0.000278344203252},{20.45,0.0},{20.55,0.0},{20.65,0.0},{20.75,0.000278344203252},{20.85,0.0},{20.95,0.0},{21.05,0.000139172101626},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.000278344203252},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU21 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.000278344203252},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.000278344203252},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.000185562802168},{-21.35,0.0},{-21.25,0.000278344203252},{-21.15,6.95860508131e-05},{-21.05,0.0},{-20.95,0.000139172101626},{-20.85,0.0},{-20.75,0.00010121607391},{-20.65,0.000347930268617},{-20.55,4.63907005421e-05},{-20.45,0.000231953512412},{-20.35,0.000139172101626},{-20.25,4.63907005421e-05},{-20.15,0.000185562802168},{-20.05,4.63907005421e-05},{-19.95,0.000123708534779},{-19.85,0.000194840948097},{-19.75,0.000324734913496},{-19.65,0.000556688406505},{-19.55,0.000278344216685},{-19.45,1.4649694908e-05},{-19.35,0.000278344203252},{-19.25,0.000487102370244},{-19.15,0.00015905383043},{-19.05,0.000278344222655},{-18.95,0.000430168329992},{-18.85,0.000352569328},{-18.75,0.00213397232195},{-18.65,0.000603079136151},{-18.55,0.00054031522835},{-18.45,0.000316300238906},{-18.35,0.000357871143413},{-18.25,0.000501019600779},{-18.15,0.000657904512164},{-18.05,0.000595080698359},{-17.95,0.000721164555712},{-17.85,0.000924102813005},{-17.75,0.00105152258443},{-17.65,0.000949644976679},{-17.55,0.00106367249308},{-17.45,0.00100695111734},{-17.35,0.00122162182298},{-17.25,0.00117964927284},{-17.15,0.00143811179118},{-17.05,0.00193101295736},{-16.95,0.00132710539869},{-16.85,0.00151016547325},{-16.75,0.0017330865815},{-16.65,0.00189830750227},{-16.55,0.00191001722525},{-16.45,0.00224166496524},{-16.35,0.00230068876408},{-16.25,0.00255570589722},{-16.15,0.00380228684758},{-16.05,0.00309889892737},{-15.95,0.00288743894179},{-15.85,0.00310114808757},{-15.75,0.00383025828911},{-15.65,0.00385421514511},{-15.55,0.00473185144749},{-15.45,0.00545371135513},{-15.35,0.00471816248581},{-15.25,0.00574379805791},{-15.15,0.00567099747767},{-15.05,0.0058337895021},{-14.95,0.00732762208491},{-14.85,0.00742251265283},{-14.75,0.00749167673516},{-14.65,0.00873350168203},{-14.55,0.00819650449251},{-14.45,0.00999467528385},{-14.35,0.010655969222},{-14.25,0.0110631439816},{-14.15,0.0126611290849},{-14.05,0.0142431469161},{-13.95,0.0140538519079},{-13.85,0.0139138574102},{-13.75,0.0160676245951},{-13.65,0.016721071884},{-13.55,0.0164012646757},{-13.45,0.0170199040788},{-13.35,0.0212257334164},{-13.25,0.0205023640002},{-13.15,0.0218487673694},{-13.05,0.0225771545024},{-12.95,0.023039832634},{-12.85,0.0249716537903},{-12.75,0.0262861320606},{-12.65,0.0294216621213},{-12.55,0.0269641701056},{-12.45,0.0374086127633},{-12.35,0.0314732483724},{-12.25,0.0407122698697},{-12.15,0.0403781984866},{-12.05,0.0378278611412},{-11.95,0.0446421281482},{-11.85,0.0441538826894},{-11.75,0.0471717765343},{-11.65,0.0488944941657},{-11.55,0.0566389127926},{-11.45,0.0617305593553},{-11.35,0.0583695347923},{-11.25,0.0627495598328},{-11.15,0.0659716648158},{-11.05,0.077357199973},{-10.95,0.0720124495657},{-10.85,0.0751725137583},{-10.75,0.0768968017712},{-10.65,0.0859489657416},{-10.55,0.0860031445821},{-10.45,0.0959933275845},{-10.35,0.0998709307178},{-10.25,0.109345278464},{-10.15,0.109217372041},{-10.05,0.112839879781},{-9.95,0.124483067863},{-9.85,0.125927968308},{-9.75,0.121473226354},{-9.65,0.142010790646},{-9.55,0.134860664164},{-9.45,0.158554262178},{-9.35,0.156621920315},{-9.25,0.158776270637},{-9.15,0.166385723},{-9.05,0.175449145751},{-8.95,0.177875054526},{-8.85,0.189316791655},{-8.75,0.200363356128},{-8.65,0.204962136674},{-8.55,0.216110115029},{-8.45,0.229840024896},{-8.35,0.233290495696},{-8.25,0.243974265991},{-8.15,0.261168224653},{-8.05,0.269622455226},{-7.95,0.274824758734},{-7.85,0.290186067724},{-7.75,0.300256574574},{-7.65,0.321211216317},{-7.55,0.334835908778},{-7.45,0.328558195561},{-7.35,0.362345037447},{-7.25,0.372937242242},{-7.15,0.371377632692},{-7.05,0.377540185876},{-6.95,0.41396219747},{-6.85,0.409890728232},{-6.75,0.429568937455},{-6.65,0.449243507792},{-6.55,0.45064380263},{-6.45,0.467432423964},{-6.35,0.494879526935},{-6.25,0.503817741598},{-6.15,0.535975122234},{-6.05,0.566844481122},{-5.95,0.561957456184},{-5.85,0.582089996085},{-5.75,0.595748841994},{-5.65,0.627304276349},{-5.55,0.628158244681},{-5.45,0.644779598651},{-5.35,0.704428026872},{-5.25,0.680474547612},{-5.15,0.715798311883},{-5.05,0.726751916977},{-4.95,0.754511727352},{-4.85,0.767643229167},{-4.75,0.78348746161},{-4.65,0.824371880037},{-4.55,0.824675712132},{-4.45,0.818551592851},{-4.35,0.856343467242},{-4.25,0.873759027135},{-4.15,0.904491928808},{-4.05,0.947035259101},{-3.95,0.96576119179},{-3.85,0.938921878917},{-3.75,0.968983656434},{-3.65,0.986260729801},{-3.55,1.01737624768},{-3.45,1.04699816785},{-3.35,1.05292402315},{-3.25,1.06244177325},{-3.15,1.10308323926},{-3.05,1.10241675967},{-2.95,1.11870353546},{-2.85,1.16314493473},{-2.75,1.17960509163},{-2.65,1.1866282494},{-2.55,1.19291891569},{-2.45,1.27451460841},{-2.35,1.23657378833},{-2.25,1.2666045149},{-2.15,1.27263682195},{-2.05,1.28949610538},{-1.95,1.33068620337},{-1.85,1.34556395578},{-1.75,1.30300474114},{-1.65,1.36731267735},{-1.55,1.35505354113},{-1.45,1.40981871178},{-1.35,1.41873675354},{-1.25,1.41669523278},{-1.15,1.44056067619},{-1.05,1.44682617187},{-0.95,1.46104148891},{-0.85,1.46469822694},{-0.75,1.50820999075},{-0.65,1.45630933462},{-0.55,1.46540333375},{-0.45,1.48765650826},{-0.35,1.515123729},{-0.25,1.53000018329},{-0.15,1.52004068383},{-0.05,1.58454097876},{0.05,1.61885707654},{0.15,1.5738465197},{0.25,1.56031172635},{0.35,1.56078377177},{0.45,1.59118626353},{0.55,1.60760926184},{0.65,1.60633006454},{0.75,1.56955006977},{0.85,1.57609412026},{0.95,1.60770893884},{1.05,1.63361302458},{1.15,1.59586885984},{1.25,1.61981164697},{1.35,1.59264646271},{1.45,1.61804057491},{1.55,1.60742348078},{1.65,1.61516648161},{1.75,1.6158866823},{1.85,1.61148199675},{1.95,1.59378802138},{2.05,1.61075367647},{2.15,1.60767162881},{2.25,1.61472970577},{2.35,1.55464221585},{2.45,1.61619375621},{2.55,1.5693486432},{2.65,1.53458049917},{2.75,1.52901034694},{2.85,1.54671928324},{2.95,1.57501088338},{3.05,1.54481382603},{3.15,1.4954531715},{3.25,1.52665579308},{3.35,1.53181194303},{3.45,1.45918716923},{3.55,1.53273291016},{3.65,1.43455360444},{3.75,1.4522344333},{3.85,1.42481382035},{3.95,1.42883900852},{4.05,1.42231665151},{4.15,1.40193676192},{4.25,1.44678455973},{4.35,1.35570914148},{4.45,1.31940818594},{4.55,1.35222882019},{4.65,1.28370310717},{4.75,1.29930601522},{4.85,1.26367470816},{4.95,1.24327115394},{5.05,1.22363585791},{5.15,1.24239874679},{5.25,1.21635029749},{5.35,1.16530502454},{5.45,1.18035112584},{5.55,1.15562302092},{5.65,1.09368163149},{5.75,1.10579218519},{5.85,1.13660589133},{5.95,1.10058034153},{6.05,1.07751498087},{6.15,1.01223715674},{6.25,1.02336022106},{6.35,1.0252908086},{6.45,0.96608373493},{6.55,0.979893188477},{6.65,0.943283543442},{6.75,0.921711368783},{6.85,0.896737506869},{6.95,0.861830415662},{7.05,0.833015061727},{7.15,0.801417536224},{7.25,0.798781981888},{7.35,0.780538672168},{7.45,0.78225885238},{7.55,0.757502747826},{7.65,0.760206980519},{7.75,0.686854554487},{7.85,0.71186393244},{7.95,0.67947311753},{8.05,0.636519349824},{8.15,0.647138400876},{8.25,0.622876919382},{8.35,0.629990025571},{8.45,0.599656100803},{8.55,0.579266427176},{8.65,0.55825232564},{8.75,0.545792019148},{8.85,0.549734593696},{8.95,0.516512357272},{9.05,0.486294873895},{9.15,0.45961938014},{9.25,0.47387142524},{9.35,0.452821558705},{9.45,0.412563793652},{9.55,0.429310159122},{9.65,0.390275601291},{9.75,0.356830104705},{9.85,0.361090012539},{9.95,0.337476279765},{10.05,0.341492201931},{10.15,0.325198625663},{10.25,0.323309626773},{10.35,0.321081893746},{10.45,0.301854832669},{10.55,0.292480412652},{10.65,0.288481907071},{10.75,0.317818641663},{10.85,0.246729747601},{10.95,0.296864660855},{11.05,0.234365000527},{11.15,0.235964728791},{11.25,0.243225429369},{11.35,0.200422386718},{11.45,0.239741203112},{11.55,0.18927508242},{11.65,0.178200171129},{11.75,0.172201908917},{11.85,0.203723573193},{11.95,0.153114188986},{12.05,0.159889832284},{12.15,0.159711837769},{12.25,0.140615208944},{12.35,0.144625708114},{12.45,0.12167532726},{12.55,0.131988684336},{12.65,0.142665222401},{12.75,0.117710810694},{12.85,0.108273952991},{12.95,0.0894718109807},{13.05,0.0914837905339},{13.15,0.101117083901},{13.25,0.0894017426864},{13.35,0.0830608946936},{13.45,0.0758537650108},{13.55,0.0754312814451},{13.65,0.0754131286041},{13.75,0.073381356632},{13.85,0.0884118382893},{13.95,0.0759289264679},{14.05,0.0634783881051},{14.15,0.0541546503703},{14.25,0.0640142842343},{14.35,0.0458483863884},{14.45,0.0552461721279},{14.55,0.044318057723},{14.65,0.0395805478096},{14.75,0.044807617863},{14.85,0.046374861787},{14.95,0.030021412032},{15.05,0.031609463195},{15.15,0.0261043216668},{15.25,0.0478974723816},{15.35,0.0413174152374},{15.45,0.0442832396144},{15.55,0.0460814303822},{15.65,0.0209394369807},{15.75,0.0190960999691},{15.85,0.0167441442609},{15.95,0.0207063892613},{16.05,0.018528042928},{16.15,0.0138553557573},{16.25,0.0239376021283},{16.35,0.0173872351646},{16.45,0.0100537931919},{16.55,0.013196790043},{16.65,0.0118992151693},{16.75,0.00981163326651},{16.85,0.00914824604988},{16.95,0.00563014434143},{17.05,0.00790497561296},{17.15,0.00841991230845},{17.25,0.0088760877649},{17.35,0.0140842169523},{17.45,0.00498878497344},{17.55,0.0295044854283},{17.65,0.0045370105654},{17.75,0.00560167711228},{17.85,0.00483623053879},{17.95,0.0038040375544},{18.05,0.00772405182943},{18.15,0.004230831936},{18.25,0.00306178629398},{18.35,0.00146130705252},{18.45,0.00191361643374},{18.55,0.00283911097795},{18.65,0.00295044854283},{18.75,0.00185562809929},{18.85,0.00208758166991},{18.95,0.0043143350631},{19.05,0.00278344214894},{19.15,0.00167006521951},{19.25,0.00148450241735},{19.35,0.00180923740845},{19.45,0.00445350725204},{19.55,0.00129893965398},{19.65,0.00157728387664},{19.75,0.00417516333982},{19.85,0.00250509800389},{19.95,0.0},{20.05,0.0},{20.15,0.000974204740487},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.00167006521951},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.000556688406505},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU22 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.000278344203252},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.000835032609757},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.000278344203252},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.000139172101626},{-21.35,0.0},{-21.25,0.000278344203252},{-21.15,0.0},{-21.05,6.95860508131e-05},{-20.95,0.000139172101626},{-20.85,0.000556688406505},{-20.75,9.27814010841e-05},{-20.65,7.9526915215e-05},{-20.55,6.95860508131e-05},{-20.45,0.000139172101626},{-20.35,6.95860508131e-05},{-20.25,0.00167006521951},{-20.15,0.000139172101626},{-20.05,0.000417516304879},{-19.95,6.95860508131e-05},{-19.85,0.000115976756206},{-19.75,0.000278344211568},{-19.65,0.000417516304879},{-19.55,0.000227736182172},{-19.45,0.000139172101626},{-19.35,0.000278344214894},{-19.25,0.000584522821009},{-19.15,0.000417516304879},{-19.05,0.000218699020999},{-18.95,0.000394320969159},{-18.85,0.000259787930797},{-18.75,0.00031109058353},{-18.65,0.00031810766086},{-18.55,0.000736793503165},{-18.45,0.000497043232567},{-18.35,0.000385399692907},{-18.25,0.000569340434264},{-18.15,0.000494834139115},{-18.05,0.000524571774384},{-17.95,0.000612357258797},{-17.85,0.000606392776327},{-17.75,0.00104379076511},{-17.65,0.000851901981867},{-17.55,0.00178140290082},{-17.45,0.000867778983186},{-17.35,0.00112842244876},{-17.25,0.00111337684286},{-17.15,0.00104231022774},{-17.05,0.00107289037921},{-16.95,0.001644172814},{-16.85,0.00184237353858},{-16.75,0.00180388456927},{-16.65,0.00197113138072},{-16.55,0.002024321529},{-16.45,0.0021571676646},{-16.35,0.00244015082717},{-16.25,0.00221952389587},{-16.15,0.00307076520497},{-16.05,0.00313656543618},{-15.95,0.0029340754537},{-15.85,0.00339167574306},{-15.75,0.00412993207574},{-15.65,0.00346665057269},{-15.55,0.00417232300554},{-15.45,0.00478245965158},{-15.35,0.00477024399001},{-15.25,0.00507425930765},{-15.15,0.00629299930904},{-15.05,0.00659564447403},{-14.95,0.00724765520829},{-14.85,0.008501745224},{-14.75,0.00850361758384},{-14.65,0.00773512233387},{-14.55,0.00814871465838},{-14.45,0.0114459653158},{-14.35,0.011265528978},{-14.25,0.0121257748715},{-14.15,0.011947607631},{-14.05,0.0133023606011},{-13.95,0.0130958461336},{-13.85,0.0144223087821},{-13.75,0.0137079207952},{-13.65,0.0148235882232},{-13.55,0.0184818313968},{-13.45,0.017870290905},{-13.35,0.0187919457753},{-13.25,0.0208397513608},{-13.15,0.0213812757855},{-13.05,0.0227342222979},{-12.95,0.0239219208838},{-12.85,0.0248891677856},{-12.75,0.0263494477054},{-12.65,0.0310648783394},{-12.55,0.0292821968043},{-12.45,0.0372787745879},{-12.35,0.0370945393039},{-12.25,0.0386194601826},{-12.15,0.0396673125245},{-12.05,0.039998169539},{-11.95,0.0436072597614},{-11.85,0.0504966602951},{-11.75,0.0492943534016},{-11.65,0.0525918903585},{-11.55,0.0536728218982},{-11.45,0.0577243396214},{-11.35,0.0581473507098},{-11.25,0.0624852257053},{-11.15,0.0631382452475},{-11.05,0.0710735535354},{-10.95,0.0706012118394},{-10.85,0.0729174648423},{-10.75,0.0822630201746},{-10.65,0.0882532368128},{-10.55,0.0852384306694},{-10.45,0.0956077918578},{-10.35,0.101938948167},{-10.25,0.0990285009887},{-10.15,0.108144515991},{-10.05,0.115241636079},{-9.95,0.123912889894},{-9.85,0.124018540816},{-9.75,0.123269709456},{-9.65,0.133359563431},{-9.55,0.137139484381},{-9.45,0.153630566123},{-9.35,0.157428897894},{-9.25,0.164229050792},{-9.15,0.162438512016},{-9.05,0.169314221066},{-8.95,0.182117655241},{-8.85,0.191762574386},{-8.75,0.188790211221},{-8.65,0.209036316926},{-8.55,0.218532342041},{-8.45,0.236581017836},{-8.35,0.238596224672},{-8.25,0.247401030548},{-8.15,0.260195788215},{-8.05,0.265417116574},{-7.95,0.271145072715},{-7.85,0.290140766512},{-7.75,0.312837869732},{-7.65,0.307931116732},{-7.55,0.332431349114},{-7.45,0.346030173448},{-7.35,0.362918242159},{-7.25,0.367080934246},{-7.15,0.375443209552},{-7.05,0.380159352902},{-6.95,0.414874621561},{-6.85,0.42192072473},{-6.75,0.434988248146},{-6.65,0.44718801543},{-6.55,0.445772439344},{-6.45,0.480046576278},{-6.35,0.490055012035},{-6.25,0.502866960057},{-6.15,0.517137929376},{-6.05,0.538828235614},{-5.95,0.550881635082},{-5.85,0.563532999117},{-5.75,0.602657078029},{-5.65,0.622137076284},{-5.55,0.618654388949},{-5.45,0.651667914065},{-5.35,0.649944245023},{-5.25,0.697396767031},{-5.15,0.712063354882},{-5.05,0.698193712456},{-4.95,0.719097419684},{-4.85,0.777471088171},{-4.75,0.800124525987},{-4.65,0.778562267633},{-4.55,0.813584129409},{-4.45,0.85134947886},{-4.35,0.846486625208},{-4.25,0.890593183054},{-4.15,0.898308087628},{-4.05,0.920713577462},{-3.95,0.890327265972},{-3.85,0.959126623328},{-3.75,0.974612539664},{-3.65,0.982863022109},{-3.55,0.983933053845},{-3.45,1.02400728901},{-3.35,1.05838467007},{-3.25,1.04379046147},{-3.15,1.10157573462},{-3.05,1.08863294032},{-2.95,1.1245067578},{-2.85,1.13392685816},{-2.75,1.14807907949},{-2.65,1.20188066635},{-2.55,1.18807002315},{-2.45,1.2209300007},{-2.35,1.19713255314},{-2.25,1.2249334836},{-2.15,1.26576500425},{-2.05,1.2339518688},{-1.95,1.302984479},{-1.85,1.32980447155},{-1.75,1.33532340614},{-1.65,1.32248300015},{-1.55,1.30665421668},{-1.45,1.39588951399},{-1.35,1.41480618806},{-1.25,1.36631533182},{-1.15,1.40948359019},{-1.05,1.39733671047},{-0.95,1.38845306064},{-0.85,1.42570456628},{-0.75,1.47992040005},{-0.65,1.43263594995},{-0.55,1.48568109337},{-0.45,1.44587340681},{-0.35,1.46846911696},{-0.25,1.51674679792},{-0.15,1.49009181879},{-0.05,1.52021595941},{0.05,1.56503555039},{0.15,1.52856945259},{0.25,1.54893988715},{0.35,1.58916032949},{0.45,1.56571264648},{0.55,1.54184805121},{0.65,1.57607638999},{0.75,1.57749786454},{0.85,1.5590454163},{0.95,1.55904859071},{1.05,1.56240778705},{1.15,1.59730218218},{1.25,1.58980046674},{1.35,1.56994033674},{1.45,1.6372003388},{1.55,1.59536309078},{1.65,1.58648161877},{1.75,1.55774429771},{1.85,1.57570526541},{1.95,1.59163074461},{2.05,1.63006395138},{2.15,1.6169616468},{2.25,1.5644359654},{2.35,1.54291960073},{2.45,1.53706208555},{2.55,1.52606966336},{2.65,1.53528698243},{2.75,1.56567050648},{2.85,1.51533747809},{2.95,1.53759627215},{3.05,1.56239351228},{3.15,1.50930783186},{3.25,1.48234939698},{3.35,1.44164350461},{3.45,1.49478187781},{3.55,1.44746971966},{3.65,1.40964976276},{3.75,1.40582438765},{3.85,1.36960026265},{3.95,1.4112476605},{4.05,1.40884892513},{4.15,1.38245366921},{4.25,1.42152277325},{4.35,1.35360808231},{4.45,1.30933984071},{4.55,1.32300428152},{4.65,1.27631494909},{4.75,1.2767300387},{4.85,1.25935176039},{4.95,1.2610977321},{5.05,1.17960417057},{5.15,1.20614174625},{5.25,1.1523068055},{5.35,1.17018532945},{5.45,1.16586748665},{5.55,1.18775809877},{5.65,1.12731356488},{5.75,1.11885172958},{5.85,1.07939532679},{5.95,1.08684151903},{6.05,1.08621137204},{6.15,1.03197149232},{6.25,1.01917016807},{6.35,0.955913759627},{6.45,0.925238804617},{6.55,0.956339703425},{6.65,0.950160411638},{6.75,0.926179121338},{6.85,0.913551984201},{6.95,0.875702015109},{7.05,0.830721406335},{7.15,0.830111366115},{7.25,0.837998503398},{7.35,0.795879868076},{7.45,0.782060681359},{7.55,0.743520491162},{7.65,0.747059992813},{7.75,0.705430250901},{7.85,0.67945058648},{7.95,0.685037584616},{8.05,0.676431258602},{8.15,0.677895157113},{8.25,0.629425481466},{8.35,0.6230239342},{8.45,0.588101425612},{8.55,0.579233299181},{8.65,0.566782079769},{8.75,0.530435644222},{8.85,0.510430424049},{8.95,0.527799974601},{9.05,0.473965039874},{9.15,0.461734440974},{9.25,0.45031553885},{9.35,0.455669047204},{9.45,0.439232818137},{9.55,0.413878269097},{9.65,0.419211912691},{9.75,0.358626845787},{9.85,0.355905887611},{9.95,0.346896557098},{10.05,0.368741900323},{10.15,0.368973470246},{10.25,0.314732936834},{10.35,0.312163041101},{10.45,0.29906242969},{10.55,0.269377932024},{10.65,0.283825388396},{10.75,0.283295285385},{10.85,0.23376151637},{10.95,0.251792413217},{11.05,0.232501606882},{11.15,0.241969004849},{11.25,0.238305381175},{11.35,0.204687857292},{11.45,0.205291119572},{11.55,0.191332280636},{11.65,0.184780466213},{11.75,0.169816535538},{11.85,0.178289368254},{11.95,0.184145004685},{12.05,0.167723337809},{12.15,0.174414890568},{12.25,0.140608967961},{12.35,0.146611326229},{12.45,0.130276893847},{12.55,0.131802526896},{12.65,0.127011819934},{12.75,0.114342622354},{12.85,0.108785510063},{12.95,0.089656727426},{13.05,0.0888507244361},{13.15,0.0993739474903},{13.25,0.0934553776147},{13.35,0.0815295479514},{13.45,0.0829580542967},{13.55,0.0979289182027},{13.65,0.0752329223457},{13.75,0.085288640431},{13.85,0.0719820679845},{13.95,0.0678022948789},{14.05,0.0712097247442},{14.15,0.0649794538816},{14.25,0.0615620613098},{14.35,0.051298836867},{14.45,0.0471177413815},{14.55,0.0542356663562},{14.65,0.0402157689844},{14.75,0.0432593276103},{14.85,0.0421464914499},{14.95,0.0349624519763},{15.05,0.0411176251041},{15.15,0.0259242151298},{15.25,0.0288663317518},{15.35,0.0393214730116},{15.45,0.0362292814255},{15.55,0.0304251634158},{15.65,0.0207202697501},{15.75,0.0178983753378},{15.85,0.0222312315651},{15.95,0.0209137716077},{16.05,0.0187376263467},{16.15,0.0144254915092},{16.25,0.0165395062221},{16.35,0.011756729512},{16.45,0.0110144778377},{16.55,0.0121601624414},{16.65,0.00977297458384},{16.75,0.0090707470389},{16.85,0.0102773251442},{16.95,0.0113362006166},{17.05,0.00735623974885},{17.15,0.0189274057746},{17.25,0.00792015818032},{17.35,0.00609826838428},{17.45,0.00520503669977},{17.55,0.00835032636921},{17.65,0.00935236513615},{17.75,0.00745962485671},{17.85,0.00519575861593},{17.95,0.00441871443763},{18.05,0.00341965737087},{18.15,0.00357871130109},{18.25,0.00422155391425},{18.35,0.0161439646035},{18.45,0.0034097165335},{18.55,0.00139172106153},{18.65,0.00327054457739},{18.75,0.00229633972049},{18.85,0.00153089314699},{18.95,0.00751529354602},{19.05,0.0},{19.15,0.00306178629398},{19.25,0.00501019600779},{19.35,0.0},{19.45,0.000904618704226},{19.55,0.00417516333982},{19.65,0.00208758166991},{19.75,0.000695860537235},{19.85,0.00111337681301},{19.95,0.00111337681301},{20.05,0.0},{20.15,0.0},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.00222675362602},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.000556688406505},{21.05,0.000139172101626},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.000835032609757},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU23 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.000556688406505},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.000278344203252},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.000417516304879},{-21.55,0.000278344203252},{-21.45,0.0},{-21.35,0.0},{-21.25,9.27814010841e-05},{-21.15,9.27814010841e-05},{-21.05,0.0},{-20.95,6.18542673894e-05},{-20.85,0.000139172101626},{-20.75,7.9526915215e-05},{-20.65,5.56688406505e-05},{-20.55,9.27814010841e-05},{-20.45,0.0},{-20.35,0.000208758152439},{-20.25,0.000167006521951},{-20.15,0.000139172101626},{-20.05,9.27814010841e-05},{-19.95,0.000194840948097},{-19.85,0.000139172101626},{-19.75,0.00010121607391},{-19.65,0.000278344214894},{-19.55,0.000194840948097},{-19.45,9.82391305597e-05},{-19.35,0.000194840948097},{-19.25,0.000556688406505},{-19.15,0.000119290381138},{-19.05,0.000324734913496},{-18.95,0.000626274500974},{-18.85,0.000278344203252},{-18.75,0.000506080390716},{-18.65,0.000695860556637},{-18.55,0.000424143547813},{-18.45,0.00030364822173},{-18.35,0.000598440039903},{-18.25,0.00066493337767},{-18.15,0.000688535700503},{-18.05,0.000508280713921},{-17.95,0.000835032616225},{-17.85,0.00069586052136},{-17.75,0.000989668278231},{-17.65,0.000605807968361},{-17.55,0.000869825637589},{-17.45,0.000947695757662},{-17.35,0.000950443671971},{-17.25,0.00142051523616},{-17.15,0.0014265141217},{-17.05,0.000974204723856},{-16.95,0.00117639817719},{-16.85,0.00159681676642},{-16.75,0.0014979978854},{-16.65,0.00205974711312},{-16.55,0.00195932490569},{-16.45,0.00247780920244},{-16.35,0.00277159759339},{-16.25,0.00230452637462},{-16.15,0.00256151907347},{-16.05,0.00370775500558},{-15.95,0.00289941880675},{-15.85,0.0034239690706},{-15.75,0.00447310906061},{-15.65,0.00390932868036},{-15.55,0.00469705868851},{-15.45,0.00507738227132},{-15.35,0.0057119784203},{-15.25,0.00559074254263},{-15.15,0.0048963278532},{-15.05,0.00587497503703},{-14.95,0.00727501384213},{-14.85,0.00749209839286},{-14.75,0.00724422620013},{-14.65,0.0088103670213},{-14.55,0.00822235181414},{-14.45,0.00989893205238},{-14.35,0.0110313102512},{-14.25,0.0126329517063},{-14.15,0.0125623974352},{-14.05,0.0121854432111},{-13.95,0.0150320916562},{-13.85,0.0143373529866},{-13.75,0.0173392900961},{-13.65,0.0159483075641},{-13.55,0.0181007364789},{-13.45,0.0185264576049},{-13.35,0.0195591530103},{-13.25,0.0187918719123},{-13.15,0.0201062244308},{-13.05,0.0199078656314},{-12.95,0.0221820117375},{-12.85,0.0244398649844},{-12.75,0.0285116982389},{-12.65,0.0276822697931},{-12.55,0.0304006532181},{-12.45,0.0307856598081},{-12.35,0.0383682199841},{-12.25,0.0369224257312},{-12.15,0.0378877026247},{-12.05,0.0406591595498},{-11.95,0.0422513111528},{-11.85,0.0445415341877},{-11.75,0.0444400302209},{-11.65,0.056887953678},{-11.55,0.053081254612},{-11.45,0.0581553810521},{-11.35,0.0578924956595},{-11.25,0.0640415424703},{-11.15,0.0653574906087},{-11.05,0.0697582228019},{-10.95,0.071173958614},{-10.85,0.0728444423898},{-10.75,0.0761514364038},{-10.65,0.0879024213725},{-10.55,0.0862823886917},{-10.45,0.0970112082399},{-10.35,0.098727043921},{-10.25,0.0997108862752},{-10.15,0.102223330128},{-10.05,0.109263752782},{-9.95,0.118993281347},{-9.85,0.122805035068},{-9.75,0.121383788954},{-9.65,0.137682577828},{-9.55,0.143558164186},{-9.45,0.152845079016},{-9.35,0.153101084442},{-9.25,0.1613868732},{-9.15,0.157025777106},{-9.05,0.171904085635},{-8.95,0.177173499238},{-8.85,0.180737985641},{-8.75,0.180710267594},{-8.65,0.201636582791},{-8.55,0.210875413198},{-8.45,0.236466284512},{-8.35,0.230651344318},{-8.25,0.256118025275},{-8.15,0.249323092423},{-8.05,0.272044262975},{-7.95,0.271104745962},{-7.85,0.287285776888},{-7.75,0.293523489562},{-7.65,0.3114384348},{-7.55,0.328704149295},{-7.45,0.327723299949},{-7.35,0.36784220248},{-7.25,0.354652003625},{-7.15,0.373705779253},{-7.05,0.373615853367},{-6.95,0.407162637259},{-6.85,0.403183171116},{-6.75,0.429799809026},{-6.65,0.438114857162},{-6.55,0.459419700043},{-6.45,0.48176345403},{-6.35,0.475710496056},{-6.25,0.507070132388},{-6.15,0.518448243731},{-6.05,0.525925777523},{-5.95,0.536498887451},{-5.85,0.577585401677},{-5.75,0.582255322427},{-5.65,0.618523436041},{-5.55,0.612019971877},{-5.45,0.662108972423},{-5.35,0.674949405528},{-5.25,0.685119330966},{-5.15,0.687673254468},{-5.05,0.705973442295},{-4.95,0.738165042971},{-4.85,0.760600001034},{-4.75,0.743985733537},{-4.65,0.796965145442},{-4.55,0.786770740413},{-4.45,0.818916980131},{-4.35,0.836499328334},{-4.25,0.846166642583},{-4.15,0.866682682754},{-4.05,0.911067399295},{-3.95,0.926800921754},{-3.85,0.951676581834},{-3.75,0.942904300217},{-3.65,0.975284034897},{-3.55,1.00336874798},{-3.45,0.997327816755},{-3.35,1.02272393645},{-3.25,1.05315269743},{-3.15,1.09911241165},{-3.05,1.10328339201},{-2.95,1.10738840087},{-2.85,1.14590885236},{-2.75,1.14912258104},{-2.65,1.13280070019},{-2.55,1.13258017669},{-2.45,1.15024341334},{-2.35,1.21825950225},{-2.25,1.23497398259},{-2.15,1.23726705849},{-2.05,1.25816612274},{-1.95,1.24267117012},{-1.85,1.31678258194},{-1.75,1.29092640041},{-1.65,1.30706490029},{-1.55,1.32563862048},{-1.45,1.3801737835},{-1.35,1.35112191718},{-1.25,1.36485040268},{-1.15,1.37088400505},{-1.05,1.42111826031},{-0.95,1.38857307541},{-0.85,1.38935117454},{-0.75,1.47302811294},{-0.65,1.42315086382},{-0.55,1.44954839668},{-0.45,1.4140681392},{-0.35,1.49181897127},{-0.25,1.51062778721},{-0.15,1.46653844721},{-0.05,1.52649504267},{0.05,1.54421878171},{0.15,1.54079821606},{0.25,1.51354576262},{0.35,1.55317157248},{0.45,1.50641904918},{0.55,1.54532354493},{0.65,1.52058266139},{0.75,1.54736221484},{0.85,1.50978128759},{0.95,1.53995373699},{1.05,1.5741187025},{1.15,1.52999861987},{1.25,1.50733553697},{1.35,1.51669519809},{1.45,1.58037285077},{1.55,1.51922957567},{1.65,1.51466556533},{1.75,1.55239636713},{1.85,1.5730534069},{1.95,1.60208800516},{2.05,1.5577693116},{2.15,1.58489657732},{2.25,1.5094123218},{2.35,1.56189142879},{2.45,1.50141426421},{2.55,1.50564207062},{2.65,1.51747035334},{2.75,1.53894603371},{2.85,1.5149827474},{2.95,1.45026209821},{3.05,1.46293272947},{3.15,1.47475793859},{3.25,1.4840234444},{3.35,1.41491762207},{3.45,1.47022830804},{3.55,1.41578879744},{3.65,1.43593503578},{3.75,1.47244012079},{3.85,1.35996006589},{3.95,1.43356781313},{4.05,1.39556021965},{4.15,1.35694538324},{4.25,1.33803557415},{4.35,1.34727113985},{4.45,1.32266258887},{4.55,1.24412226627},{4.65,1.30088214541},{4.75,1.22442230344},{4.85,1.24742688336},{4.95,1.29730209524},{5.05,1.15359937803},{5.15,1.17523043778},{5.25,1.13876863446},{5.35,1.13026197858},{5.45,1.15526154711},{5.55,1.09570121367},{5.65,1.12132736147},{5.75,1.08087025296},{5.85,1.07305918781},{5.95,1.01544774054},{6.05,1.0611759015},{6.15,1.02462412452},{6.25,0.980841405882},{6.35,1.0004262227},{6.45,0.972881591296},{6.55,0.925788091945},{6.65,0.903893991679},{6.75,0.902944504558},{6.85,0.898588679387},{6.95,0.83983194864},{7.05,0.811379615795},{7.15,0.859271967217},{7.25,0.820073951187},{7.35,0.79094213588},{7.45,0.777663752586},{7.55,0.757268523452},{7.65,0.753026824559},{7.75,0.664654032389},{7.85,0.678351799568},{7.95,0.657327597033},{8.05,0.623307586828},{8.15,0.650090004081},{8.25,0.580137030249},{8.35,0.599767275074},{8.45,0.568194890426},{8.55,0.577196513685},{8.65,0.493073165274},{8.75,0.519900947489},{8.85,0.518967592955},{8.95,0.51193648207},{9.05,0.471571600615},{9.15,0.456634001835},{9.25,0.446394167611},{9.35,0.451349563465},{9.45,0.422815697594},{9.55,0.422491189205},{9.65,0.426536717042},{9.75,0.345651047876},{9.85,0.340553079853},{9.95,0.338160435197},{10.05,0.335692226626},{10.15,0.318704128265},{10.25,0.329947569127},{10.35,0.302694846028},{10.45,0.282685680389},{10.55,0.293701621924},{10.65,0.287292525747},{10.75,0.287042925435},{10.85,0.237907872724},{10.95,0.260927529171},{11.05,0.242128531138},{11.15,0.240652643648},{11.25,0.220075763873},{11.35,0.224684988315},{11.45,0.212346900223},{11.55,0.200960839898},{11.65,0.178375814715},{11.75,0.195034511198},{11.85,0.193619933576},{11.95,0.165940734389},{12.05,0.161204117995},{12.15,0.157251380472},{12.25,0.146853401},{12.35,0.124338546496},{12.45,0.134309487055},{12.55,0.120977188412},{12.65,0.122321107962},{12.75,0.124465488997},{12.85,0.119503251437},{12.95,0.092408229323},{13.05,0.106194817017},{13.15,0.0790842780771},{13.25,0.086451654081},{13.35,0.0729408347816},{13.45,0.0739495053011},{13.55,0.078110342676},{13.65,0.0654372566625},{13.75,0.0724417946555},{13.85,0.0787714095343},{13.95,0.0512665222431},{14.05,0.071026609655},{14.15,0.0540943288091},{14.25,0.0646195177938},{14.35,0.0878639871424},{14.45,0.0600481245253},{14.55,0.0509547578528},{14.65,0.0428483057022},{14.75,0.0390931611158},{14.85,0.0528680048883},{14.95,0.0387872666121},{15.05,0.0357351150268},{15.15,0.0240685869666},{15.25,0.037447235414},{15.35,0.0482788026333},{15.45,0.0280385394891},{15.55,0.037687805295},{15.65,0.026164355278},{15.75,0.0239739081134},{15.85,0.0204351035257},{15.95,0.0300412923098},{16.05,0.019205750525},{16.15,0.0173686787486},{16.25,0.0105342578429},{16.35,0.0198694948967},{16.45,0.0118516032633},{16.55,0.0126924961805},{16.65,0.0185562802686},{16.75,0.00990110103573},{16.85,0.0142574095064},{16.95,0.00668026087806},{17.05,0.00753517555339},{17.15,0.00714416801929},{17.25,0.00743179023266},{17.35,0.00556688411878},{17.45,0.00643670978025},{17.55,0.0101317293942},{17.65,0.0044535074383},{17.75,0.00524877650397},{17.85,0.00366486546894},{17.95,0.0331229604781},{18.05,0.0143347270787},{18.15,0.00825754490991},{18.25,0.00294249584632},{18.35,0.00434216968715},{18.45,0.0141955548897},{18.55,0.00501019600779},{18.65,0.00640191696584},{18.75,0.00306178629398},{18.85,0.00417516333982},{18.95,0.00213397232195},{19.05,0.00835032667965},{19.15,0.00129893965398},{19.25,0.00222675362602},{19.35,0.00194840948097},{19.45,0.0036184748169},{19.55,0.00417516333982},{19.65,0.00153089314699},{19.75,0.0},{19.85,0.00236592581496},{19.95,0.0},{20.05,0.00194840948097},{20.15,0.000835032609757},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.000556688406505},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.000278344203252},{21.05,0.0},{21.15,0.000278344203252},{21.25,0.0},{21.35,0.0},{21.45,0.000278344203252},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU24 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,6.95860508131e-05},{-21.55,0.0},{-21.45,0.000278344203252},{-21.35,0.00111337681301},{-21.25,0.0},{-21.15,0.00111337681301},{-21.05,0.000139172101626},{-20.95,0.0},{-20.85,0.000208758152439},{-20.75,7.59120554325e-05},{-20.65,5.56688406505e-05},{-20.55,7.9526915215e-05},{-20.45,5.56688406505e-05},{-20.35,0.000139172101626},{-20.25,9.27814010841e-05},{-20.15,0.000208758152439},{-20.05,9.27814010841e-05},{-19.95,0.00015905383043},{-19.85,0.000417516304879},{-19.75,0.00021648994233},{-19.65,9.27814010841e-05},{-19.55,0.000167006521951},{-19.45,0.000208758152439},{-19.35,0.000148450241735},{-19.25,0.00148450241735},{-19.15,0.000278344208544},{-19.05,0.000119290372822},{-18.95,0.000516924973843},{-18.85,0.00106698616097},{-18.75,0.00055668844531},{-18.65,0.000531384382736},{-18.55,0.000337989402137},{-18.45,0.000424841173777},{-18.35,0.000459267944098},{-18.25,0.000299755304765},{-18.15,0.000447771107049},{-18.05,0.000709777744487},{-17.95,0.000603079123216},{-17.85,0.000922930770014},{-17.75,0.000818659441874},{-17.65,0.000792210420164},{-17.55,0.00119809028895},{-17.45,0.00124327080945},{-17.35,0.000904618658953},{-17.25,0.0010547781069},{-17.15,0.00143971140015},{-17.05,0.00160047917494},{-16.95,0.00152316141046},{-16.85,0.00134533031711},{-16.75,0.00159238781347},{-16.65,0.0016923327744},{-16.55,0.00212237456193},{-16.45,0.00209011191672},{-16.35,0.00246612966061},{-16.25,0.00183778542739},{-16.15,0.00297775780255},{-16.05,0.0029438438557},{-15.95,0.00318408915491},{-15.85,0.00320611287046},{-15.75,0.00425293559537},{-15.65,0.00309622072682},{-15.55,0.00460000414597},{-15.45,0.00457103053729},{-15.35,0.0043272216011},{-15.25,0.00505343397844},{-15.15,0.0058319738933},{-15.05,0.00618818828038},{-14.95,0.00678583979607},{-14.85,0.00693055502204},{-14.75,0.00797498316476},{-14.65,0.00916796270758},{-14.55,0.00861439643762},{-14.45,0.0114099879301},{-14.35,0.00986856764013},{-14.25,0.00990754913639},{-14.15,0.0121145220364},{-14.05,0.0130949020386},{-13.95,0.017030610154},{-13.85,0.0140233122476},{-13.75,0.0129603275414},{-13.65,0.0154798449131},{-13.55,0.0162317406587},{-13.45,0.0175970349993},{-13.35,0.0201464826045},{-13.25,0.017679528102},{-13.15,0.0210372748324},{-13.05,0.0226759036107},{-12.95,0.0261732708941},{-12.85,0.0249676468932},{-12.75,0.0299502127879},{-12.65,0.0289609340792},{-12.55,0.0308962086269},{-12.45,0.034978587725},{-12.35,0.0365833721002},{-12.25,0.0410096435979},{-12.15,0.0369040208442},{-12.05,0.0393951936202},{-11.95,0.0415761532991},{-11.85,0.0462381719233},{-11.75,0.048533425641},{-11.65,0.0504472592242},{-11.55,0.0568118798928},{-11.45,0.057372581756},{-11.35,0.0570116108861},{-11.25,0.0593434443239},{-11.15,0.0620755434036},{-11.05,0.0655703675058},{-10.95,0.0734275498005},{-10.85,0.0725078798894},{-10.75,0.0810252733009},{-10.65,0.0821183127326},{-10.55,0.0820182999816},{-10.45,0.0922806278352},{-10.35,0.0999028846178},{-10.25,0.0954014471095},{-10.15,0.101963627446},{-10.05,0.107246598605},{-9.95,0.113866697449},{-9.85,0.119949740265},{-9.75,0.12070200106},{-9.65,0.130241662789},{-9.55,0.131310854002},{-9.45,0.156344542841},{-9.35,0.152609566793},{-9.25,0.147580013682},{-9.15,0.161038393966},{-9.05,0.169441528819},{-8.95,0.172483648256},{-8.85,0.173885459372},{-8.75,0.191840006206},{-8.65,0.218689159378},{-8.55,0.212962134691},{-8.45,0.221946003079},{-8.35,0.226548332595},{-8.25,0.235599517822},{-8.15,0.244563709606},{-8.05,0.254673118591},{-7.95,0.261121301966},{-7.85,0.276234014914},{-7.75,0.297629945435},{-7.65,0.294619033522},{-7.55,0.316750332654},{-7.45,0.32834572569},{-7.35,0.337443614828},{-7.25,0.357681175545},{-7.15,0.345078473944},{-7.05,0.378480900567},{-6.95,0.387315615297},{-6.85,0.404032458896},{-6.75,0.417883259877},{-6.65,0.427042633793},{-6.55,0.427283252598},{-6.45,0.440877032465},{-6.35,0.461668345418},{-6.25,0.500247934995},{-6.15,0.507974841471},{-6.05,0.495500976173},{-5.95,0.538182786674},{-5.85,0.556989831862},{-5.75,0.552664336981},{-5.65,0.602451185691},{-5.55,0.608360510892},{-5.45,0.617920571432},{-5.35,0.643535708043},{-5.25,0.64833664763},{-5.15,0.687037463329},{-5.05,0.671358127246},{-4.95,0.739942150194},{-4.85,0.759407976468},{-4.75,0.720864490796},{-4.65,0.768698960089},{-4.55,0.777152242931},{-4.45,0.814154638288},{-4.35,0.815995282641},{-4.25,0.842504923166},{-4.15,0.861943074691},{-4.05,0.856664191887},{-3.95,0.882063909872},{-3.85,0.922678125},{-3.75,0.92421426268},{-3.65,0.936426590804},{-3.55,0.969305338743},{-3.45,0.971791324137},{-3.35,0.993631385895},{-3.25,1.01111179232},{-3.15,1.06767690979},{-3.05,1.03789162587},{-2.95,1.0864919591},{-2.85,1.06515053935},{-2.75,1.11506806275},{-2.65,1.10599851417},{-2.55,1.13591472106},{-2.45,1.18107115531},{-2.35,1.15032506681},{-2.25,1.19427499011},{-2.15,1.21543241501},{-2.05,1.22661347902},{-1.95,1.21880987323},{-1.85,1.22550261537},{-1.75,1.27237185635},{-1.65,1.30982439359},{-1.55,1.28353037442},{-1.45,1.3016721203},{-1.35,1.33451207407},{-1.25,1.33823516441},{-1.15,1.36026442393},{-1.05,1.38012123653},{-0.95,1.37330422729},{-0.85,1.41553706429},{-0.75,1.41862306089},{-0.65,1.40479535462},{-0.55,1.37522905366},{-0.45,1.40539185832},{-0.35,1.41313940095},{-0.25,1.39284234762},{-0.15,1.39138325474},{-0.05,1.45598998395},{0.05,1.44913554076},{0.15,1.44279816235},{0.25,1.46579168912},{0.35,1.46902550201},{0.45,1.43958999276},{0.55,1.47426234149},{0.65,1.51356749287},{0.75,1.4502034272},{0.85,1.53556910206},{0.95,1.50272718666},{1.05,1.50161894514},{1.15,1.55929000289},{1.25,1.47537798748},{1.35,1.47705387071},{1.45,1.48108560455},{1.55,1.54822658506},{1.65,1.50187125932},{1.75,1.45353766579},{1.85,1.51989148602},{1.95,1.52230453366},{2.05,1.4833976474},{2.15,1.497060789},{2.25,1.49933945168},{2.35,1.48163028493},{2.45,1.4056664328},{2.55,1.46379452163},{2.65,1.43210914249},{2.75,1.43876769892},{2.85,1.44921596777},{2.95,1.44965263998},{3.05,1.48579989347},{3.15,1.41871973017},{3.25,1.38805324748},{3.35,1.49519114251},{3.45,1.42444189819},{3.55,1.37293735397},{3.65,1.32018907387},{3.75,1.39617185474},{3.85,1.38356828609},{3.95,1.39101554001},{4.05,1.35342578465},{4.15,1.30842300975},{4.25,1.33039353306},{4.35,1.34537239828},{4.45,1.31882352067},{4.55,1.25473901299},{4.65,1.28907758531},{4.75,1.21250612111},{4.85,1.228208025},{4.95,1.22431762189},{5.05,1.12449727256},{5.15,1.17671522831},{5.25,1.13698763195},{5.35,1.12931629834},{5.45,1.09606300788},{5.55,1.10932598584},{5.65,1.01582117225},{5.75,1.09484043863},{5.85,1.10025621933},{5.95,1.00965659803},{6.05,1.07782264517},{6.15,0.968067993244},{6.25,0.981848782529},{6.35,0.957429671525},{6.45,0.905077471206},{6.55,0.930671390429},{6.65,0.85859031368},{6.75,0.897642759058},{6.85,0.870019229842},{6.95,0.862778746456},{7.05,0.811743164063},{7.15,0.813511901527},{7.25,0.760879300165},{7.35,0.780765408975},{7.45,0.750726943598},{7.55,0.767370065221},{7.65,0.722025489407},{7.75,0.659729994335},{7.85,0.680318986933},{7.95,0.627759159775},{8.05,0.6040637898},{8.15,0.638180253518},{8.25,0.626684578249},{8.35,0.620369396471},{8.45,0.588790028257},{8.55,0.570441948668},{8.65,0.521302247114},{8.75,0.529960655374},{8.85,0.504026958759},{8.95,0.522557845108},{9.05,0.460720888876},{9.15,0.45560356711},{9.25,0.456749617944},{9.35,0.418590716871},{9.45,0.436442608814},{9.55,0.453488884485},{9.65,0.41745103144},{9.75,0.355934780144},{9.85,0.333557725443},{9.95,0.331993052724},{10.05,0.33980693632},{10.15,0.319414755739},{10.25,0.327343413226},{10.35,0.300160102124},{10.45,0.280175374902},{10.55,0.27500487752},{10.65,0.249685789978},{10.75,0.284437704585},{10.85,0.262532888805},{10.95,0.246672603062},{11.05,0.241257758195},{11.15,0.254201765184},{11.25,0.241495915822},{11.35,0.218471881563},{11.45,0.213593245672},{11.55,0.188839545617},{11.65,0.174525639782},{11.75,0.190822455401},{11.85,0.183041355827},{11.95,0.166682319208},{12.05,0.144492236988},{12.15,0.173534785602},{12.25,0.144744380828},{12.35,0.154631898603},{12.45,0.124043172201},{12.55,0.127719922499},{12.65,0.112272269534},{12.75,0.129682864618},{12.85,0.108273497943},{12.95,0.0893614347591},{13.05,0.0899487453958},{13.15,0.100467611614},{13.25,0.109332182469},{13.35,0.0779195072675},{13.45,0.092028020223},{13.55,0.0910145827702},{13.65,0.0735506705749},{13.75,0.064067876339},{13.85,0.0693541006608},{13.95,0.0642718168405},{14.05,0.0495965418063},{14.15,0.0588917732239},{14.25,0.0542973648418},{14.35,0.0437795661745},{14.45,0.0497679424286},{14.55,0.0385238162258},{14.65,0.0335260794081},{14.75,0.0351477791281},{14.85,0.0409165987602},{14.95,0.0456215143204},{15.05,0.0369133528541},{15.15,0.0281684339046},{15.25,0.0281359619564},{15.35,0.0358832081159},{15.45,0.0367679454031},{15.55,0.0470998159477},{15.65,0.0177009515464},{15.75,0.0174150685469},{15.85,0.0291890303294},{15.95,0.0151233685513},{16.05,0.0192366772228},{16.15,0.0117572593689},{16.25,0.0103989398479},{16.35,0.0179995919267},{16.45,0.00999388240633},{16.55,0.0148682196935},{16.65,0.0207366440445},{16.75,0.0128347608778},{16.85,0.00826468204076},{16.95,0.0050499591799},{17.05,0.00871217399836},{17.15,0.0102987353291},{17.25,0.00538132153451},{17.35,0.0062163538403},{17.45,0.0070281913504},{17.55,0.00588002149016},{17.65,0.00904618669301},{17.75,0.011040986826},{17.85,0.00590089708567},{17.95,0.0119688007981},{18.05,0.00197933655646},{18.15,0.00821115449071},{18.25,0.00565966591239},{18.35,0.00187882338651},{18.45,0.00205974709243},{18.55,0.00128734193277},{18.65,0.00807198230177},{18.75,0.00695860525593},{18.85,0.0},{18.95,0.00612357258797},{19.05,0.0},{19.15,0.00157728387664},{19.25,0.0},{19.35,0.00153089314699},{19.45,0.00111337681301},{19.55,0.000278344203252},{19.65,0.00250509800389},{19.75,0.00111337681301},{19.85,0.0},{19.95,0.0},{20.05,0.0},{20.15,0.0},{20.25,0.000835032609757},{20.35,0.0},{20.45,0.0},{20.55,0.0},{20.65,0.0},{20.75,0.0},{20.85,0.000835032609757},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU25 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.000139172101626},{-21.55,0.000278344203252},{-21.45,0.000417516304879},{-21.35,0.0},{-21.25,9.27814010841e-05},{-21.15,0.000139172101626},{-21.05,9.27814010841e-05},{-20.95,0.00111337681301},{-20.85,0.0},{-20.75,3.47930254065e-05},{-20.65,0.000835032609757},{-20.55,0.000556688406505},{-20.45,0.000278344203252},{-20.35,0.000278344203252},{-20.25,0.0},{-20.15,9.27814010841e-05},{-20.05,0.0},{-19.95,0.000222675362602},{-19.85,3.97634576075e-05},{-19.75,0.000167006521951},{-19.65,0.000695860537235},{-19.55,0.000167006521951},{-19.45,0.000238580745645},{-19.35,0.000417516333982},{-19.25,0.000194840948097},{-19.15,0.000215084164996},{-19.05,0.000649469826991},{-18.95,0.000278344211568},{-18.85,0.000487102370244},{-18.75,0.000521895417478},{-18.65,0.000417516304879},{-18.55,0.000278344206316},{-18.45,0.000366242381891},{-18.35,0.000454140532958},{-18.25,0.000556688423135},{-18.15,0.000231953518879},{-18.05,0.000512739349353},{-17.95,0.000939411693253},{-17.85,0.00136852574845},{-17.75,0.00123989692127},{-17.65,0.00134533038363},{-17.55,0.00159053837082},{-17.45,0.000679487362504},{-17.35,0.000794099643826},{-17.25,0.00124095124193},{-17.15,0.00161439646035},{-17.05,0.00133153856606},{-16.95,0.00111917569302},{-16.85,0.00177941471338},{-16.75,0.00137961915006},{-16.65,0.00160492084762},{-16.55,0.00200407836172},{-16.45,0.00219891928136},{-16.35,0.00267812267349},{-16.25,0.00257190048695},{-16.15,0.00264164411797},{-16.05,0.00294249584632},{-15.95,0.00339480516102},{-15.85,0.00262136832823},{-15.75,0.00324252925136},{-15.65,0.00378407179555},{-15.55,0.00396131342504},{-15.45,0.0045926796227},{-15.35,0.00482361329781},{-15.25,0.00589161898409},{-15.15,0.00631873360996},{-15.05,0.00651669809499},{-14.95,0.00838785559944},{-14.85,0.00926886200905},{-14.75,0.00817363832308},{-14.65,0.00985440639181},{-14.55,0.00969292736855},{-14.45,0.0105657655049},{-14.35,0.0109659433365},{-14.25,0.0137331810865},{-14.15,0.0114086763358},{-14.05,0.0151439861015},{-13.95,0.0153922450786},{-13.85,0.013470082841},{-13.75,0.0146865820273},{-13.65,0.0161722226796},{-13.55,0.0161299836146},{-13.45,0.01790510015},{-13.35,0.0186526610934},{-13.25,0.0197441871049},{-13.15,0.0210371908047},{-13.05,0.0205470394174},{-12.95,0.0241428048071},{-12.85,0.0257438574518},{-12.75,0.0268893676835},{-12.65,0.0297418709184},{-12.55,0.0301190903468},{-12.45,0.0344708280165},{-12.35,0.0387820196933},{-12.25,0.0348428889392},{-12.15,0.0372384266028},{-12.05,0.0372119231709},{-11.95,0.0432323965077},{-11.85,0.0442958402969},{-11.75,0.0487545647722},{-11.65,0.0516467701305},{-11.55,0.056524656477},{-11.45,0.056005725664},{-11.35,0.0573706092982},{-11.25,0.0588106565838},{-11.15,0.0582891191755},{-11.05,0.0705142047331},{-10.95,0.0701951599121},{-10.85,0.0680778040688},{-10.75,0.0828424289527},{-10.65,0.0841706869403},{-10.55,0.0781208371359},{-10.45,0.0850990265014},{-10.35,0.0931966740598},{-10.25,0.10048338162},{-10.15,0.0929086167378},{-10.05,0.105194082649},{-9.95,0.115465384889},{-9.85,0.122099663337},{-9.75,0.119639210887},{-9.65,0.123788736365},{-9.55,0.132704286189},{-9.45,0.145357083874},{-9.35,0.147590568884},{-9.25,0.157669760279},{-9.15,0.153916116256},{-9.05,0.167272503767},{-8.95,0.175271207099},{-8.85,0.17606161598},{-8.75,0.191634707624},{-8.65,0.195996606465},{-8.55,0.215487111913},{-8.45,0.225856115832},{-8.35,0.227200159212},{-8.25,0.229476410904},{-8.15,0.252295665543},{-8.05,0.250924125634},{-7.95,0.260662750823},{-7.85,0.272898943776},{-7.75,0.289652466063},{-7.65,0.304483742636},{-7.55,0.308753489253},{-7.45,0.320677288904},{-7.35,0.343030493029},{-7.25,0.359668871593},{-7.15,0.382218756898},{-7.05,0.373717811147},{-6.95,0.374184500671},{-6.85,0.380316893012},{-6.75,0.419901353131},{-6.65,0.421739857492},{-6.55,0.435482990917},{-6.45,0.434417636493},{-6.35,0.467136216058},{-6.25,0.485611236647},{-6.15,0.513883327841},{-6.05,0.51963722503},{-5.95,0.521364624576},{-5.85,0.557025498881},{-5.75,0.553980757387},{-5.65,0.579150111975},{-5.55,0.578782846146},{-5.45,0.644221013034},{-5.35,0.628776751993},{-5.25,0.647434530246},{-5.15,0.670132439997},{-5.05,0.695088235955},{-4.95,0.732069956462},{-4.85,0.726488033709},{-4.75,0.729160880675},{-4.65,0.748787680185},{-4.55,0.759532482112},{-4.45,0.790541116256},{-4.35,0.794823130509},{-4.25,0.81223537452},{-4.15,0.862700905309},{-4.05,0.883404743715},{-3.95,0.875362960929},{-3.85,0.892642765609},{-3.75,0.920755103882},{-3.65,0.894824202479},{-3.55,0.932959859845},{-3.45,0.966963778106},{-3.35,0.97839589982},{-3.25,0.993261034244},{-3.15,1.00819492498},{-3.05,1.02911945003},{-2.95,1.03734786938},{-2.85,1.07219739742},{-2.75,1.08616280532},{-2.65,1.09642654557},{-2.55,1.13018196061},{-2.45,1.14069382772},{-2.35,1.14749846152},{-2.25,1.16461351345},{-2.15,1.19145653967},{-2.05,1.21677012527},{-1.95,1.20463982711},{-1.85,1.18220253596},{-1.75,1.2362589749},{-1.65,1.21813059788},{-1.55,1.24577793229},{-1.45,1.24835201336},{-1.35,1.29654117192},{-1.25,1.28134753584},{-1.15,1.22550672204},{-1.05,1.34394010251},{-0.95,1.31480553014},{-0.85,1.36626760607},{-0.75,1.33289036635},{-0.65,1.32368610652},{-0.55,1.36858707692},{-0.45,1.35922922415},{-0.35,1.35641625527},{-0.25,1.41099325917},{-0.15,1.40156582604},{-0.05,1.43485582489},{0.05,1.39365701002},{0.15,1.41855493575},{0.25,1.44580236145},{0.35,1.46150790709},{0.45,1.45157435349},{0.55,1.46700232316},{0.65,1.51079148034},{0.75,1.41819741692},{0.85,1.44534447651},{0.95,1.45582776036},{1.05,1.46759932044},{1.15,1.43970857591},{1.25,1.45934107557},{1.35,1.47862504706},{1.45,1.48797601031},{1.55,1.44462367169},{1.65,1.47119157758},{1.75,1.46652713968},{1.85,1.45639612115},{1.95,1.44504286121},{2.05,1.46478647256},{2.15,1.47845663495},{2.25,1.44739098477},{2.35,1.45904084979},{2.45,1.49532850169},{2.55,1.46268013927},{2.65,1.44678231062},{2.75,1.42493800302},{2.85,1.43251630214},{2.95,1.39803066375},{3.05,1.39596613239},{3.15,1.41187206705},{3.25,1.39207302768},{3.35,1.34804046466},{3.45,1.4046689708},{3.55,1.38212668975},{3.65,1.35861109022},{3.75,1.35289691246},{3.85,1.34331458563},{3.95,1.3557381506},{4.05,1.31402886337},{4.15,1.31623201854},{4.25,1.27601622035},{4.35,1.2618573163},{4.45,1.22400969925},{4.55,1.23251102178},{4.65,1.22731222113},{4.75,1.2054690933},{4.85,1.16068776175},{4.95,1.18820501692},{5.05,1.19389715008},{5.15,1.06503524989},{5.25,1.13888438697},{5.35,1.13237729945},{5.45,1.18839523784},{5.55,1.06857765261},{5.65,1.03656745203},{5.75,1.08648372602},{5.85,1.04270760028},{5.95,0.979566085437},{6.05,1.02302440234},{6.15,0.993379983068},{6.25,0.960307617188},{6.35,0.910982744409},{6.45,0.945992214311},{6.55,0.953527789124},{6.65,0.841272907071},{6.75,0.885821077225},{6.85,0.874447549202},{6.95,0.835199420372},{7.05,0.825849982963},{7.15,0.807679999784},{7.25,0.8040664191},{7.35,0.74463854338},{7.45,0.720600027681},{7.55,0.685702860924},{7.65,0.728997076125},{7.75,0.649303294994},{7.85,0.663729702469},{7.95,0.624771136705},{8.05,0.634617516754},{8.15,0.668130006134},{8.25,0.558234532674},{8.35,0.631919884756},{8.45,0.59339140648},{8.55,0.550653180102},{8.65,0.510328541123},{8.75,0.480588939414},{8.85,0.484916674359},{8.95,0.501176603548},{9.05,0.459693730627},{9.15,0.481290263514},{9.25,0.423334670789},{9.35,0.410946396446},{9.45,0.378834596154},{9.55,0.432586962656},{9.65,0.404236756838},{9.75,0.363524645428},{9.85,0.337732266384},{9.95,0.328110929243},{10.05,0.342563932236},{10.15,0.341068793602},{10.25,0.284880138579},{10.35,0.316809781797},{10.45,0.261398337043},{10.55,0.266175980137},{10.65,0.295388896814},{10.75,0.268698355731},{10.85,0.243854743847},{10.95,0.285053830628},{11.05,0.215496791882},{11.15,0.223157753379},{11.25,0.225059332671},{11.35,0.211181459834},{11.45,0.19419497364},{11.55,0.200809723553},{11.65,0.162425670984},{11.75,0.193230280062},{11.85,0.17443409544},{11.95,0.165793364903},{12.05,0.16506955395},{12.15,0.148310442229},{12.25,0.149360756376},{12.35,0.134284706677},{12.45,0.11551671558},{12.55,0.136185542957},{12.65,0.120644063535},{12.75,0.125150170657},{12.85,0.129039121478},{12.95,0.104223203659},{13.05,0.0803938971625},{13.15,0.0765597025553},{13.25,0.0901543927747},{13.35,0.0867424964905},{13.45,0.0898972238813},{13.55,0.0696625947952},{13.65,0.0725968723566},{13.75,0.0685889970011},{13.85,0.0715344609885},{13.95,0.0666087652956},{14.05,0.0580155726137},{14.15,0.080305875876},{14.25,0.0522551851453},{14.35,0.0575072099996},{14.45,0.0537747464529},{14.55,0.0320769260007},{14.65,0.0341667509996},{14.75,0.0452927880817},{14.85,0.03784767481},{14.95,0.0467205930639},{15.05,0.0370023846626},{15.15,0.0295601538249},{15.25,0.0324271001986},{15.35,0.0398297309875},{15.45,0.0554761428099},{15.55,0.0192775803228},{15.65,0.0198036741327},{15.75,0.019985114336},{15.85,0.0188876433032},{15.95,0.0173368681045},{16.05,0.0128929042816},{16.15,0.0098812190386},{16.25,0.0124668910315},{16.35,0.0156469206725},{16.45,0.0174521818757},{16.55,0.0131074813279},{16.65,0.0108786200484},{16.75,0.0100709999149},{16.85,0.0119378740589},{16.95,0.00845154239373},{17.05,0.00539987782637},{17.15,0.00751529385646},{17.25,0.00713257025927},{17.35,0.00520503669977},{17.45,0.00681943322221},{17.55,0.00414423603151},{17.65,0.00441871443763},{17.75,0.00473185149687},{17.85,0.00695860525593},{17.95,0.00282320566475},{18.05,0.0057524467508},{18.15,0.00311745516956},{18.25,0.00368806067854},{18.35,0.0036184748169},{18.45,0.00723694963381},{18.55,0.00389681896195},{18.65,0.00501019600779},{18.75,0.00153089314699},{18.85,0.0},{18.95,0.0036184748169},{19.05,0.00445350725204},{19.15,0.00111337681301},{19.25,0.00104379083496},{19.35,0.00153089314699},{19.45,0.00208758166991},{19.55,0.0},{19.65,0.00111337681301},{19.75,0.0},{19.85,0.000556688406505},{19.95,0.0},{20.05,0.00167006521951},{20.15,0.000556688406505},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.000417516304879},{20.65,0.000835032609757},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.000278344203252},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU26 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.0},{-21.35,0.0},{-21.25,0.000278344203252},{-21.15,0.0},{-21.05,0.0},{-20.95,0.0},{-20.85,0.000208758152439},{-20.75,0.0},{-20.65,0.000185562802168},{-20.55,0.0},{-20.45,0.0},{-20.35,0.000278344203252},{-20.25,0.000139172101626},{-20.15,0.000556688406505},{-20.05,6.95860508131e-05},{-19.95,0.000139172101626},{-19.85,5.56688406505e-05},{-19.75,0.000119290372822},{-19.65,0.00125254900195},{-19.55,0.000278344203252},{-19.45,0.000278344203252},{-19.35,0.000556688429788},{-19.25,0.000250509800389},{-19.15,0.00021648994233},{-19.05,0.000603079136151},{-18.95,0.000371125604336},{-18.85,0.000151824110865},{-18.75,0.000139172111327},{-18.65,0.000253040195358},{-18.55,0.000296900483469},{-18.45,0.000249044822627},{-18.35,0.000428221869068},{-18.25,0.000424841173777},{-18.15,0.000946370325983},{-18.05,0.000605807968361},{-17.95,0.000984910302437},{-17.85,0.000852429133374},{-17.75,0.00104914354877},{-17.65,0.000810828788773},{-17.55,0.00109598028939},{-17.45,0.000797920053204},{-17.35,0.000835032619793},{-17.25,0.00120244696736},{-17.15,0.0010762643069},{-17.05,0.00126694605268},{-16.95,0.000984388062867},{-16.85,0.00117699833853},{-16.75,0.00200228248873},{-16.65,0.00182052158021},{-16.55,0.00171434726905},{-16.45,0.00303085920987},{-16.35,0.00205500931182},{-16.25,0.0019191100932},{-16.15,0.00223221147762},{-16.05,0.00270315059102},{-15.95,0.00268138249715},{-15.85,0.00266957395908},{-15.75,0.0045244579806},{-15.65,0.00350342591604},{-15.55,0.00406382552215},{-15.45,0.00551212811079},{-15.35,0.00477161500361},{-15.25,0.00519575866369},{-15.15,0.00731588299595},{-15.05,0.00572251760831},{-14.95,0.00640191694703},{-14.85,0.00850891789725},{-14.75,0.00712463521121},{-14.65,0.00767434745276},{-14.55,0.00833265365116},{-14.45,0.00961957550049},{-14.35,0.010228045403},{-14.25,0.0101566840862},{-14.15,0.0128612698071},{-14.05,0.0137871808379},{-13.95,0.0122100324342},{-13.85,0.012510525283},{-13.75,0.0149101346557},{-13.65,0.0163474319971},{-13.55,0.0167141204239},{-13.45,0.0173937010043},{-13.35,0.0190403980784},{-13.25,0.020856524458},{-13.15,0.0214564336371},{-13.05,0.0230154348456},{-12.95,0.0240888006893},{-12.85,0.0240481051613},{-12.75,0.0304219466934},{-12.65,0.0281921483119},{-12.55,0.0277875789161},{-12.45,0.0351547676972},{-12.35,0.0321994017388},{-12.25,0.0347302279821},{-12.15,0.0342370945474},{-12.05,0.0396557234631},{-11.95,0.0484637033372},{-11.85,0.0431025684033},{-11.75,0.0474228033416},{-11.65,0.0526344566148},{-11.55,0.0513545053977},{-11.45,0.0547019289403},{-11.35,0.0579035670747},{-11.25,0.0616239744195},{-11.15,0.0630752655768},{-11.05,0.0683390476789},{-10.95,0.0689735908013},{-10.85,0.0661742990102},{-10.75,0.0763627949786},{-10.65,0.0818747361774},{-10.55,0.0774547730402},{-10.45,0.0927496129245},{-10.35,0.0873456933033},{-10.25,0.0975327146634},{-10.15,0.101221352435},{-10.05,0.109054317582},{-9.95,0.112730155469},{-9.85,0.118627864843},{-9.75,0.116823555767},{-9.65,0.124613532335},{-9.55,0.128695692726},{-9.45,0.141913863848},{-9.35,0.15223568629},{-9.25,0.159635982972},{-9.15,0.152197816551},{-9.05,0.161371577524},{-8.95,0.16860422582},{-8.85,0.171497147172},{-8.75,0.183048970371},{-8.65,0.190476158687},{-8.55,0.18837588986},{-8.45,0.212485934219},{-8.35,0.20702286312},{-8.25,0.227115190586},{-8.15,0.246906169163},{-8.05,0.249937250644},{-7.95,0.248806536639},{-7.85,0.263548951363},{-7.75,0.290073487817},{-7.65,0.272645356435},{-7.55,0.315633735965},{-7.45,0.324332339592},{-7.35,0.323086743686},{-7.25,0.346071769096},{-7.15,0.345370541712},{-7.05,0.349140088247},{-6.95,0.376828397684},{-6.85,0.369680581269},{-6.75,0.402771069015},{-6.65,0.419530175666},{-6.55,0.41973852937},{-6.45,0.420661750552},{-6.35,0.474742600013},{-6.25,0.455808974466},{-6.15,0.466844739577},{-6.05,0.488860740388},{-5.95,0.497008337875},{-5.85,0.54656428714},{-5.75,0.522514110303},{-5.65,0.562958813933},{-5.55,0.551963781485},{-5.45,0.577392238884},{-5.35,0.605750817587},{-5.25,0.613298096808},{-5.15,0.639627898686},{-5.05,0.639050058832},{-4.95,0.634459764001},{-4.85,0.687471989081},{-4.75,0.712376519144},{-4.65,0.711014202207},{-4.55,0.738263116181},{-4.45,0.743298439493},{-4.35,0.796873915619},{-4.25,0.795441197842},{-4.15,0.80739647848},{-4.05,0.837280718048},{-3.95,0.860125641325},{-3.85,0.836477326184},{-3.75,0.849235907814},{-3.65,0.850912174551},{-3.55,0.869536964119},{-3.45,0.914467240236},{-3.35,0.971908770577},{-3.25,0.947997776708},{-3.15,0.942766974954},{-3.05,0.96454391589},{-2.95,1.00971767521},{-2.85,1.05352572421},{-2.75,1.06494785251},{-2.65,1.05413589367},{-2.55,1.13423511905},{-2.45,1.08374276569},{-2.35,1.08952564304},{-2.25,1.11866661284},{-2.15,1.11841616702},{-2.05,1.14735326655},{-1.95,1.17315479893},{-1.85,1.20681876542},{-1.75,1.19538267423},{-1.65,1.17705708436},{-1.55,1.17247571987},{-1.45,1.23177226508},{-1.35,1.24521644214},{-1.25,1.21774740138},{-1.15,1.24819273402},{-1.05,1.24064971383},{-0.95,1.25095083281},{-0.85,1.31542186527},{-0.75,1.28403166987},{-0.65,1.3065544477},{-0.55,1.30128935608},{-0.45,1.26608518343},{-0.35,1.31580718793},{-0.25,1.3533337129},{-0.15,1.32188005527},{-0.05,1.38519258392},{0.05,1.3983504787},{0.15,1.36884015093},{0.25,1.38947200568},{0.35,1.36855421733},{0.45,1.38292972625},{0.55,1.36747342103},{0.65,1.39442514067},{0.75,1.36361493217},{0.85,1.40768370383},{0.95,1.40115517064},{1.05,1.40265070085},{1.15,1.40951274865},{1.25,1.37815482533},{1.35,1.44237337481},{1.45,1.42924612496},{1.55,1.42263779618},{1.65,1.41188769837},{1.75,1.42189014954},{1.85,1.34194765684},{1.95,1.41541243082},{2.05,1.41514631676},{2.15,1.40919406646},{2.25,1.38740342704},{2.35,1.40934547602},{2.45,1.38550813363},{2.55,1.35057616373},{2.65,1.35163256494},{2.75,1.32151797007},{2.85,1.35644853335},{2.95,1.33601665455},{3.05,1.35924511897},{3.15,1.34796207419},{3.25,1.33951533226},{3.35,1.34210816307},{3.45,1.32515485828},{3.55,1.36131313717},{3.65,1.28385703469},{3.75,1.29569655198},{3.85,1.317488804},{3.95,1.22269679719},{4.05,1.26120635289},{4.15,1.22972593363},{4.25,1.21132922995},{4.35,1.1767616272},{4.45,1.17491979203},{4.55,1.18725994247},{4.65,1.15787557438},{4.75,1.1327601535},{4.85,1.13920758674},{4.95,1.11444835945},{5.05,1.09408109377},{5.15,1.08207632212},{5.25,1.02809512976},{5.35,1.09528464686},{5.45,1.0172016457},{5.55,1.06321055987},{5.65,0.998265642439},{5.75,1.02777024834},{5.85,1.04264655148},{5.95,0.99314015788},{6.05,0.971150682875},{6.15,0.951577822633},{6.25,0.912745862524},{6.35,0.835100558484},{6.45,0.887727660586},{6.55,0.893755099724},{6.65,0.842483477766},{6.75,0.857779923551},{6.85,0.833180766203},{6.95,0.822814941406},{7.05,0.800911189417},{7.15,0.709523272274},{7.25,0.737965518249},{7.35,0.701407945421},{7.45,0.672016409542},{7.55,0.697767076598},{7.65,0.698791344337},{7.75,0.670279060182},{7.85,0.603095902203},{7.95,0.604976654053},{8.05,0.601879519714},{8.15,0.598410874784},{8.25,0.592957457533},{8.35,0.591048122648},{8.45,0.541242341233},{8.55,0.486612764696},{8.65,0.481815199647},{8.75,0.536374205946},{8.85,0.490114638728},{8.95,0.488925551588},{9.05,0.442098433214},{9.15,0.417370496043},{9.25,0.414360757601},{9.35,0.41762904117},{9.45,0.41767977028},{9.55,0.38415006402},{9.65,0.411760511345},{9.75,0.322996139526},{9.85,0.339156495764},{9.95,0.342207318786},{10.05,0.321037982018},{10.15,0.31194958365},{10.25,0.318308094204},{10.35,0.32453809065},{10.45,0.251971735018},{10.55,0.244725305017},{10.65,0.259302983054},{10.75,0.256798580823},{10.85,0.228621233427},{10.95,0.239132773358},{11.05,0.202213729858},{11.15,0.203205858256},{11.25,0.24456967007},{11.35,0.19795449415},{11.45,0.215792973836},{11.55,0.20377512676},{11.65,0.170207479265},{11.75,0.16745487373},{11.85,0.166498957117},{11.95,0.145032707168},{12.05,0.146940962909},{12.15,0.149101820859},{12.25,0.154646610392},{12.35,0.133593724779},{12.45,0.132449218819},{12.55,0.135952872459},{12.65,0.132130592427},{12.75,0.112807340622},{12.85,0.112717035082},{12.95,0.0899943564702},{13.05,0.077480201368},{13.15,0.0978687150138},{13.25,0.0870539347331},{13.35,0.0819380314319},{13.45,0.0842750361471},{13.55,0.0765235713034},{13.65,0.07377468386},{13.75,0.0700200775922},{13.85,0.0825259632534},{13.95,0.0765964430432},{14.05,0.0563904753438},{14.15,0.0544162940979},{14.25,0.0576819819073},{14.35,0.0492163192142},{14.45,0.0513911309995},{14.55,0.0524596957599},{14.65,0.0517091712644},{14.75,0.0538235240512},{14.85,0.0421691497167},{14.95,0.0315147505866},{15.05,0.0419835845629},{15.15,0.0291183956208},{15.25,0.0466635893373},{15.35,0.05042006714},{15.45,0.0346620398409},{15.55,0.0244816379114},{15.65,0.0180820646109},{15.75,0.0218280459705},{15.85,0.0194686303536},{15.95,0.020189233621},{16.05,0.0118675855073},{16.15,0.0128502241439},{16.25,0.0113347950909},{16.35,0.0241115670651},{16.45,0.0155594408512},{16.55,0.0192455138479},{16.65,0.0157960336655},{16.75,0.0157860932606},{16.85,0.0143811181188},{16.95,0.00937092138661},{17.05,0.00635130906647},{17.15,0.00807198190263},{17.25,0.00688901916146},{17.35,0.00901835262775},{17.45,0.00672665176292},{17.55,0.00630913550655},{17.65,0.0103915172319},{17.75,0.00512153357267},{17.85,0.00310154977654},{17.95,0.00306178629398},{18.05,0.00494060991332},{18.15,0.00452309334651},{18.25,0.00261643566191},{18.35,0.00334013043903},{18.45,0.00501019600779},{18.55,0.00695860525593},{18.65,0.00107361336372},{18.75,0.00473185162991},{18.85,0.0},{18.95,0.00139172111327},{19.05,0.00180923740845},{19.15,0.00417516333982},{19.25,0.00306178629398},{19.35,0.00102059543133},{19.45,0.000695860537235},{19.55,0.00111337681301},{19.65,0.000835032609757},{19.75,0.00111337681301},{19.85,0.000556688406505},{19.95,0.000695860537235},{20.05,0.0},{20.15,0.0},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.0},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU27 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.000556688406505},{-21.35,0.0},{-21.25,0.0},{-21.15,0.0},{-21.05,0.0},{-20.95,0.000278344203252},{-20.85,0.000139172101626},{-20.75,9.27814010841e-05},{-20.65,9.27814010841e-05},{-20.55,0.0},{-20.45,0.00111337681301},{-20.35,0.0},{-20.25,0.0},{-20.15,0.000139172101626},{-20.05,0.000111337681301},{-19.95,9.27814010841e-05},{-19.85,0.000139172101626},{-19.75,0.000278344203252},{-19.65,0.000278344203252},{-19.55,0.0},{-19.45,0.000115976756206},{-19.35,0.000154635674941},{-19.25,0.000371125604336},{-19.15,0.000306178629398},{-19.05,0.000556688406505},{-18.95,0.000556688406505},{-18.85,0.00031810766086},{-18.75,0.000256933110694},{-18.65,0.00011461232241},{-18.55,0.000177128134634},{-18.45,0.000157324992039},{-18.35,0.000236592581496},{-18.25,0.000406810763077},{-18.15,0.000487102370244},{-18.05,0.00048246330892},{-17.95,0.000535277327379},{-17.85,0.000788641938319},{-17.75,0.000852429133374},{-17.65,0.000603079123216},{-17.55,0.00130607674901},{-17.45,0.000821115449071},{-17.35,0.000622181167059},{-17.25,0.00108807279982},{-17.15,0.000927814049646},{-17.05,0.00123515247833},{-16.95,0.00095680821687},{-16.85,0.00124878758514},{-16.75,0.00147000537254},{-16.65,0.00132051673393},{-16.55,0.00157226863745},{-16.45,0.00266282632947},{-16.35,0.00260715732972},{-16.25,0.00206227752973},{-16.15,0.00249847060158},{-16.05,0.00366619101592},{-15.95,0.00279287741346},{-15.85,0.00228474206395},{-15.75,0.00312783404932},{-15.65,0.00277591919577},{-15.55,0.00329818831731},{-15.45,0.00401552459773},{-15.35,0.00454765339108},{-15.25,0.00587216500313},{-15.15,0.00462051398224},{-15.05,0.00687673950897},{-14.95,0.00853874408282},{-14.85,0.00684786611988},{-14.75,0.00630338793307},{-14.65,0.00806652447757},{-14.55,0.00935466080597},{-14.45,0.0109541916078},{-14.35,0.00943227737181},{-14.25,0.011148042149},{-14.15,0.0116970841847},{-14.05,0.0127570714951},{-13.95,0.0132879105167},{-13.85,0.0190095844723},{-13.75,0.0134129159591},{-13.65,0.0163897740376},{-13.55,0.0176260564234},{-13.45,0.0165070217589},{-13.35,0.0177759396402},{-13.25,0.0185599923134},{-13.15,0.0202370166779},{-13.05,0.0216141463445},{-12.95,0.0218422545896},{-12.85,0.0241556993295},{-12.75,0.0287652146926},{-12.65,0.026442700166},{-12.55,0.0263540918027},{-12.45,0.0302724357989},{-12.35,0.0328715539748},{-12.25,0.0362775283048},{-12.15,0.0346525384801},{-12.05,0.0378408968449},{-11.95,0.0419151033674},{-11.85,0.0487666462743},{-11.75,0.0438486925588},{-11.65,0.0498912347912},{-11.55,0.0488501176011},{-11.45,0.0548243134666},{-11.35,0.0539994329776},{-11.25,0.0581067742438},{-11.15,0.0569362082909},{-11.05,0.0673781908475},{-10.95,0.0682674585763},{-10.85,0.0707864146079},{-10.75,0.0758130446724},{-10.65,0.0766820252937},{-10.55,0.0785488336493},{-10.45,0.0956548952589},{-10.35,0.0885541579303},{-10.25,0.0877753357214},{-10.15,0.0945138449326},{-10.05,0.0971876381087},{-9.95,0.0981100476392},{-9.85,0.117036793488},{-9.75,0.102821444056},{-9.65,0.118651477002},{-9.55,0.130032949924},{-9.45,0.13597386446},{-9.35,0.135706130519},{-9.25,0.143435517994},{-9.15,0.150355545698},{-9.05,0.159144585286},{-8.95,0.160376199462},{-8.85,0.157376857076},{-8.75,0.174205527786},{-8.65,0.186473625237},{-8.55,0.19179251236},{-8.45,0.21430084603},{-8.35,0.2160233695},{-8.25,0.217090749003},{-8.15,0.216112908516},{-8.05,0.229757835014},{-7.95,0.23740679726},{-7.85,0.245200399574},{-7.75,0.260104035346},{-7.65,0.266978337215},{-7.55,0.280295166201},{-7.45,0.303709139565},{-7.35,0.301644153942},{-7.25,0.321150141854},{-7.15,0.321009584624},{-7.05,0.342767720767},{-6.95,0.352230454525},{-6.85,0.350180715609},{-6.75,0.37185745682},{-6.65,0.386169743417},{-6.55,0.403831453071},{-6.45,0.417798458123},{-6.35,0.427627480398},{-6.25,0.447223525449},{-6.15,0.444708516416},{-6.05,0.476954812903},{-5.95,0.453341723245},{-5.85,0.50093821509},{-5.75,0.514592460691},{-5.65,0.530252200701},{-5.55,0.572274617855},{-5.45,0.563847676896},{-5.35,0.556894673135},{-5.25,0.588136377523},{-5.15,0.592115157594},{-5.05,0.609396492925},{-4.95,0.621717580646},{-4.85,0.663190012189},{-4.75,0.688245258753},{-4.65,0.690865860603},{-4.55,0.714284236859},{-4.45,0.702225932816},{-4.35,0.742285890932},{-4.25,0.759466465981},{-4.15,0.75279583517},{-4.05,0.7901042579},{-3.95,0.763448070868},{-3.85,0.820554335389},{-3.75,0.819609514628},{-3.65,0.807761375256},{-3.55,0.824209359976},{-3.45,0.88190927291},{-3.35,0.913500274828},{-3.25,0.890132136755},{-3.15,0.920472147439},{-3.05,0.936694676413},{-2.95,0.945095650915},{-2.85,0.963463313947},{-2.75,0.975308220197},{-2.65,0.978196979557},{-2.55,0.984000276953},{-2.45,1.0310310376},{-2.35,1.00086798294},{-2.25,1.08393970542},{-2.15,1.10725511556},{-2.05,1.08355033652},{-1.95,1.03418322577},{-1.85,1.06335688392},{-1.75,1.11309415158},{-1.65,1.10271896049},{-1.55,1.11354422778},{-1.45,1.16962940784},{-1.35,1.11037321356},{-1.25,1.15681209338},{-1.15,1.14408972882},{-1.05,1.17669423324},{-0.95,1.15766144084},{-0.85,1.23125742326},{-0.75,1.22212764237},{-0.65,1.23474321053},{-0.55,1.23919482992},{-0.45,1.20976117769},{-0.35,1.27954675439},{-0.25,1.26493898978},{-0.15,1.22574443426},{-0.05,1.2855172252},{0.05,1.27990544346},{0.15,1.29878559349},{0.25,1.24752423948},{0.35,1.28129877029},{0.45,1.34300604392},{0.55,1.30814037415},{0.65,1.26431676936},{0.75,1.31473913539},{0.85,1.27552521286},{0.95,1.2966533421},{1.05,1.26714254157},{1.15,1.30149791763},{1.25,1.28912203429},{1.35,1.32711785513},{1.45,1.35090210917},{1.55,1.32316468753},{1.65,1.29606999858},{1.75,1.3498391416},{1.85,1.30791770106},{1.95,1.33703266709},{2.05,1.3207875904},{2.15,1.33923486509},{2.25,1.35045384821},{2.35,1.28629768524},{2.45,1.26771963326},{2.55,1.25586440077},{2.65,1.27220714614},{2.75,1.28632043144},{2.85,1.26135289187},{2.95,1.24037134343},{3.05,1.2340836525},{3.15,1.26923473102},{3.25,1.25701860114},{3.35,1.26663543847},{3.45,1.22201800396},{3.55,1.17913474544},{3.65,1.23232284445},{3.75,1.22430845111},{3.85,1.20186817895},{3.95,1.19710131583},{4.05,1.20345248268},{4.15,1.1608468788},{4.25,1.15453255895},{4.35,1.18802453668},{4.45,1.11760110737},{4.55,1.14841962827},{4.65,1.10980256399},{4.75,1.09502918671},{4.85,1.11139361373},{4.95,1.11333398016},{5.05,1.01591607799},{5.15,1.119230711},{5.25,1.03257838561},{5.35,0.976739830672},{5.45,1.03407253473},{5.55,0.961287510248},{5.65,0.943097068006},{5.75,0.954152231288},{5.85,0.939440586369},{5.95,0.908519065543},{6.05,0.927827706537},{6.15,0.867014494655},{6.25,0.929696254046},{6.35,0.850657329432},{6.45,0.810278262184},{6.55,0.842014324603},{6.65,0.828977270351},{6.75,0.759898318321},{6.85,0.731437055923},{6.95,0.73042230731},{7.05,0.790735090741},{7.15,0.747636700621},{7.25,0.737994062701},{7.35,0.718825405868},{7.45,0.674209035504},{7.55,0.64208361157},{7.65,0.648901882978},{7.75,0.646191170453},{7.85,0.629834956451},{7.95,0.615783546084},{8.05,0.601401293023},{8.15,0.560160932013},{8.25,0.516818154562},{8.35,0.554393865412},{8.45,0.484927523338},{8.55,0.492380180709},{8.65,0.485390560444},{8.75,0.454864208515},{8.85,0.458708355536},{8.95,0.444178241517},{9.05,0.414321605347},{9.15,0.410035113899},{9.25,0.422963192588},{9.35,0.377201682643},{9.45,0.370918967507},{9.55,0.369759654742},{9.65,0.370015182936},{9.75,0.322208683665},{9.85,0.328966413225},{9.95,0.298578935184},{10.05,0.312694072723},{10.15,0.305748117836},{10.25,0.338682789448},{10.35,0.313760647104},{10.45,0.270143180058},{10.55,0.269149686083},{10.65,0.240455158173},{10.75,0.289926499283},{10.85,0.228893364053},{10.95,0.245846797511},{11.05,0.218136419164},{11.15,0.199653700655},{11.25,0.226833667177},{11.35,0.213541872013},{11.45,0.215877714611},{11.55,0.171796019966},{11.65,0.15458784547},{11.75,0.181952582465},{11.85,0.184914104274},{11.95,0.144289350176},{12.05,0.13195687152},{12.15,0.120475997388},{12.25,0.132943854373},{12.35,0.133225423153},{12.45,0.125626912484},{12.55,0.120348728064},{12.65,0.120523045572},{12.75,0.111960790374},{12.85,0.169810978871},{12.95,0.0960784526098},{13.05,0.087836041508},{13.15,0.0929940276676},{13.25,0.0974294524039},{13.35,0.070243959303},{13.45,0.0821393728256},{13.55,0.0676587278193},{13.65,0.0711779845388},{13.75,0.0576259493828},{13.85,0.057553768158},{13.95,0.0779217293388},{14.05,0.0581678877706},{14.15,0.0659521155887},{14.25,0.0546876788139},{14.35,0.0514204313881},{14.45,0.0412078901779},{14.55,0.0416839251647},{14.65,0.0413914217668},{14.75,0.0469577003408},{14.85,0.0406691807288},{14.95,0.0267137194935},{15.05,0.0301353991032},{15.15,0.0293255512203},{15.25,0.0283911085129},{15.35,0.0418258547783},{15.45,0.0423939640705},{15.55,0.0300089847296},{15.65,0.0175356852512},{15.75,0.0325409688733},{15.85,0.0212283849716},{15.95,0.0144247789593},{16.05,0.0162632550512},{16.15,0.0324734921257},{16.25,0.0134002853717},{16.35,0.0189274069336},{16.45,0.00803923606873},{16.55,0.00997400097549},{16.65,0.0118644218892},{16.75,0.0100203920156},{16.85,0.00852429121733},{16.95,0.00873304996639},{17.05,0.0203191277881},{17.15,0.0095193721354},{17.25,0.00672002456018},{17.35,0.00812765061855},{17.45,0.0100899776444},{17.55,0.00800239574164},{17.65,0.00533493049443},{17.75,0.0048431891948},{17.85,0.0086286701262},{17.95,0.00501019569735},{18.05,0.0169789977372},{18.15,0.00233809128404},{18.25,0.00793281011283},{18.35,0.00445350725204},{18.45,0.00417516333982},{18.55,0.00403599115089},{18.65,0.000742251208673},{18.75,0.00334013043903},{18.85,0.000742251208673},{18.95,0.0},{19.05,0.0},{19.15,0.000556688406505},{19.25,0.000463907024823},{19.35,0.00125254900195},{19.45,0.00250509800389},{19.55,0.0},{19.65,0.0},{19.75,0.000695860537235},{19.85,0.00111337681301},{19.95,0.0},{20.05,0.000556688406505},{20.15,0.0},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.0},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU28 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.000278344203252},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.0},{-21.35,0.0},{-21.25,0.0},{-21.15,0.0},{-21.05,0.000278344203252},{-20.95,0.000278344203252},{-20.85,0.0},{-20.75,0.0},{-20.65,0.0},{-20.55,0.000556688406505},{-20.45,0.0},{-20.35,0.0},{-20.25,0.000139172101626},{-20.15,0.000111337681301},{-20.05,6.95860508131e-05},{-19.95,3.97634576075e-05},{-19.85,0.000222675362602},{-19.75,0.000231953512412},{-19.65,0.000139172101626},{-19.55,0.000556688406505},{-19.45,0.00010121607391},{-19.35,6.95860508131e-05},{-19.25,5.0608036955e-05},{-19.15,6.95860508131e-05},{-19.05,0.000167006521951},{-18.95,0.000324734913496},{-18.85,0.000835032667965},{-18.75,0.000313137250487},{-18.65,0.000139172101626},{-18.55,0.000675978804273},{-18.45,0.000347930278319},{-18.35,0.000426794464389},{-18.25,0.000556688406505},{-18.15,0.000452309352113},{-18.05,0.000535277327379},{-17.95,0.000663743855862},{-17.85,0.000860336659984},{-17.75,0.000784424556927},{-17.65,0.00125254895538},{-17.55,0.000654927564456},{-17.45,0.000708512538536},{-17.35,0.000522949704618},{-17.25,0.00148450241735},{-17.15,0.00114267623346},{-17.05,0.00102059543133},{-16.95,0.00196580588818},{-16.85,0.0018710916241},{-16.75,0.00188213710984},{-16.65,0.00165935978293},{-16.55,0.00249350024387},{-16.45,0.00225554792018},{-16.35,0.00164290971872},{-16.25,0.00221923094343},{-16.15,0.00264848723556},{-16.05,0.00301896417752},{-15.95,0.00222129593877},{-15.85,0.00328303415042},{-15.75,0.00313415586948},{-15.65,0.0031433698946},{-15.55,0.00388611337313},{-15.45,0.00452844626628},{-15.35,0.00414564167008},{-15.25,0.0052243067668},{-15.15,0.00534098174261},{-15.05,0.00496488393739},{-14.95,0.00661571734193},{-14.85,0.00714416840138},{-14.75,0.00766490399837},{-14.65,0.0084682135021},{-14.55,0.00945722987485},{-14.45,0.0088899731636},{-14.35,0.0106718349964},{-14.25,0.0127910361893},{-14.15,0.0101018581933},{-14.05,0.0114686867086},{-13.95,0.013152348895},{-13.85,0.0120603374187},{-13.75,0.0143851516903},{-13.65,0.0144928345064},{-13.55,0.0167313657958},{-13.45,0.0191793389564},{-13.35,0.0172457439559},{-13.25,0.0166803561151},{-13.15,0.018508455188},{-13.05,0.0227974929379},{-12.95,0.0219456138033},{-12.85,0.0242214580574},{-12.75,0.023668815138},{-12.65,0.0260707634505},{-12.55,0.0260767499764},{-12.45,0.0321980197873},{-12.35,0.0335235914925},{-12.25,0.0355210053293},{-12.15,0.036481151144},{-12.05,0.037794303203},{-11.95,0.0394442525403},{-11.85,0.0392663530521},{-11.75,0.0453974833254},{-11.65,0.0461813054683},{-11.55,0.044232035196},{-11.45,0.0512473931473},{-11.35,0.0515220233728},{-11.25,0.0537491084343},{-11.15,0.0561729230379},{-11.05,0.0664584766735},{-10.95,0.0676687203565},{-10.85,0.0679378295693},{-10.75,0.0700515631972},{-10.65,0.0707999411083},{-10.55,0.075146427861},{-10.45,0.0923552209204},{-10.35,0.0886027938932},{-10.25,0.0857544749818},{-10.15,0.0920385015451},{-10.05,0.0983560217751},{-9.95,0.0980559875488},{-9.85,0.105390189174},{-9.75,0.103792238026},{-9.65,0.113418851175},{-9.55,0.118835658999},{-9.45,0.124707248925},{-9.35,0.138343135574},{-9.25,0.142716039341},{-9.15,0.138622467427},{-9.05,0.158090934038},{-8.95,0.15744147931},{-8.85,0.164052031546},{-8.75,0.170665234432},{-8.65,0.168023212648},{-8.55,0.182464431561},{-8.45,0.191640882719},{-8.35,0.203765655386},{-8.25,0.199001064938},{-8.15,0.221544820505},{-8.05,0.225653949389},{-7.95,0.224960705813},{-7.85,0.238337338626},{-7.75,0.254726939829},{-7.65,0.253372100383},{-7.55,0.283403692843},{-7.45,0.288773885587},{-7.35,0.298573777307},{-7.25,0.292783265602},{-7.15,0.308624699091},{-7.05,0.330596632027},{-6.95,0.343725202972},{-6.85,0.337146352503},{-6.75,0.353933068209},{-6.65,0.371568958597},{-6.55,0.379748869478},{-6.45,0.386862051739},{-6.35,0.416232804527},{-6.25,0.407156643734},{-6.15,0.439544412364},{-6.05,0.447088940113},{-5.95,0.456958889131},{-5.85,0.46927122507},{-5.75,0.496032255069},{-5.65,0.503235608977},{-5.55,0.526283245506},{-5.45,0.547381640208},{-5.35,0.562621225662},{-5.25,0.577073336778},{-5.15,0.573232590343},{-5.05,0.59052372888},{-4.95,0.626529201737},{-4.85,0.615552009641},{-4.75,0.652941562413},{-4.65,0.640329745241},{-4.55,0.646154948084},{-4.45,0.654896291225},{-4.35,0.69973446849},{-4.25,0.703397106049},{-4.15,0.727795174451},{-4.05,0.738892029236},{-3.95,0.737048055684},{-3.85,0.783393596254},{-3.75,0.783409787897},{-3.65,0.798682786326},{-3.55,0.810863031269},{-3.45,0.840828816673},{-3.35,0.839725998213},{-3.25,0.84360838488},{-3.15,0.855718210203},{-3.05,0.91207619991},{-2.95,0.894090530795},{-2.85,0.890625},{-2.75,0.9058749023},{-2.65,0.90206905187},{-2.55,0.961894887985},{-2.45,0.977966670407},{-2.35,0.994414365172},{-2.25,1.03270062969},{-2.15,1.00166415108},{-2.05,1.02494622559},{-1.95,1.0190977824},{-1.85,1.00918953695},{-1.75,1.05939749264},{-1.65,1.06463946555},{-1.55,1.06061647789},{-1.45,1.07315018324},{-1.35,1.08222864029},{-1.25,1.10554834242},{-1.15,1.12630118071},{-1.05,1.14957821091},{-0.95,1.09373426902},{-0.85,1.14292221942},{-0.75,1.168514553},{-0.65,1.13310242356},{-0.55,1.19037770068},{-0.45,1.13961394846},{-0.35,1.1463757167},{-0.25,1.17782885334},{-0.15,1.18372744606},{-0.05,1.20339227778},{0.05,1.16759291307},{0.15,1.21170533158},{0.25,1.19819385784},{0.35,1.21432404471},{0.45,1.21183568282},{0.55,1.23046953107},{0.65,1.21456693956},{0.75,1.23329316379},{0.85,1.25195392584},{0.95,1.23334059983},{1.05,1.27461896204},{1.15,1.20346991831},{1.25,1.2563290294},{1.35,1.27126002312},{1.45,1.2579892464},{1.55,1.20351642734},{1.65,1.25327028171},{1.75,1.2544646154},{1.85,1.23703225123},{1.95,1.26775841346},{2.05,1.23943983524},{2.15,1.24721442853},{2.25,1.21683235694},{2.35,1.20404654665},{2.45,1.2077974252},{2.55,1.22570036617},{2.65,1.2627360026},{2.75,1.19816581125},{2.85,1.20865651359},{2.95,1.2084890869},{3.05,1.17144161989},{3.15,1.22570324057},{3.25,1.21067780068},{3.35,1.16680296779},{3.45,1.17889124184},{3.55,1.22250182558},{3.65,1.18585174056},{3.75,1.17378651904},{3.85,1.16485543877},{3.95,1.15235832073},{4.05,1.13943229013},{4.15,1.13043016542},{4.25,1.12694584872},{4.35,1.06555317143},{4.45,1.08772993258},{4.55,1.1381585392},{4.65,1.09144470261},{4.75,1.04010306941},{4.85,1.02038916905},{4.95,1.04646800067},{5.05,1.00868999662},{5.15,0.978126415308},{5.25,0.997819668384},{5.35,0.960218123807},{5.45,0.986062221613},{5.55,0.967630308932},{5.65,0.953582043238},{5.75,0.92910789942},{5.85,0.897463463498},{5.95,0.82431047103},{6.05,0.867084337652},{6.15,0.893635405003},{6.25,0.817865021859},{6.35,0.808031429315},{6.45,0.772545548468},{6.55,0.7782797376},{6.65,0.769431700297},{6.75,0.738741650102},{6.85,0.762219457101},{6.95,0.732715903169},{7.05,0.745664475037},{7.15,0.725310241872},{7.25,0.655310915228},{7.35,0.627267655625},{7.45,0.688208894895},{7.55,0.646544837056},{7.65,0.559339662478},{7.75,0.60741253903},{7.85,0.619013847189},{7.95,0.532891332139},{8.05,0.559142462641},{8.15,0.533956151809},{8.25,0.497036820284},{8.35,0.571153720746},{8.45,0.489672312296},{8.55,0.483729217012},{8.65,0.455561244234},{8.75,0.456890002164},{8.85,0.438750295928},{8.95,0.444657332951},{9.05,0.382615594041},{9.15,0.440085995231},{9.25,0.426205110268},{9.35,0.419591712952},{9.45,0.364026630789},{9.55,0.365819096565},{9.65,0.305833837959},{9.75,0.339471950978},{9.85,0.317783510363},{9.95,0.306756805955},{10.05,0.336324129856},{10.15,0.275137689764},{10.25,0.287441722682},{10.35,0.257422194651},{10.45,0.238284554068},{10.55,0.22954043404},{10.65,0.256082149562},{10.75,0.236988838083},{10.85,0.23064207166},{10.95,0.21671879417},{11.05,0.212381320053},{11.15,0.216129114598},{11.25,0.205980056371},{11.35,0.176137529181},{11.45,0.181978124656},{11.55,0.184521745233},{11.65,0.162734633642},{11.75,0.190410012597},{11.85,0.194434566498},{11.95,0.154330975076},{12.05,0.108163808016},{12.15,0.169037168676},{12.25,0.133897347025},{12.35,0.133768599966},{12.45,0.150257631938},{12.55,0.0958251511609},{12.65,0.109710188473},{12.75,0.114647723533},{12.85,0.0900623602026},{12.95,0.116742197673},{13.05,0.0858524894714},{13.15,0.0947282900576},{13.25,0.0829106607745},{13.35,0.0630106244768},{13.45,0.0604594996278},{13.55,0.0859155813853},{13.65,0.0757277789323},{13.75,0.0771760242741},{13.85,0.0771239126051},{13.95,0.0630958778102},{14.05,0.0480291792687},{14.15,0.0571809266065},{14.25,0.0539601180289},{14.35,0.0499791573076},{14.45,0.0699023550207},{14.55,0.0348834872246},{14.65,0.0308248354838},{14.75,0.0332621335983},{14.85,0.0429860275725},{14.95,0.0377388348182},{15.05,0.028844707542},{15.15,0.0281877036278},{15.25,0.036332105889},{15.35,0.0623181727197},{15.45,0.0313833095133},{15.55,0.0272777318954},{15.65,0.0166373930194},{15.75,0.0162058191167},{15.85,0.0207687593423},{15.95,0.0181137850651},{16.05,0.024389911443},{16.15,0.0110355291296},{16.25,0.023420676589},{16.35,0.0142574095064},{16.45,0.00955648471912},{16.55,0.0116208707914},{16.65,0.0138376834137},{16.75,0.0172016724944},{16.85,0.00549729789297},{16.95,0.00681943306699},{17.05,0.0253293234855},{17.15,0.0114816986024},{17.25,0.00325448610462},{17.35,0.00364940199587},{17.45,0.00606790371239},{17.55,0.00681943306699},{17.65,0.00473185144365},{17.75,0.0},{17.85,0.00382723286748},{17.95,0.00269066076726},{18.05,0.00459267944098},{18.15,0.00202793641282},{18.25,0.0108554242179},{18.35,0.00167006533593},{18.45,0.00269066076726},{18.55,0.00264426996},{18.65,0.00194840948097},{18.75,0.0086286701262},{18.85,0.0},{18.95,0.0},{19.05,0.0036184748169},{19.15,0.00417516333982},{19.25,0.00278344214894},{19.35,0.0},{19.45,0.00250509800389},{19.55,0.000835032609757},{19.65,0.0},{19.75,0.00111337681301},{19.85,0.000556688406505},{19.95,0.000278344203252},{20.05,0.0},{20.15,0.0},{20.25,0.000278344203252},{20.35,0.000556688406505},{20.45,0.0},{20.55,0.0},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU29 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.000278344203252},{-21.55,0.000371125604336},{-21.45,0.0},{-21.35,0.0},{-21.25,0.0},{-21.15,0.000278344203252},{-21.05,0.0},{-20.95,0.000139172101626},{-20.85,0.000278344203252},{-20.75,0.0},{-20.65,0.000556688406505},{-20.55,5.56688406505e-05},{-20.45,9.27814010841e-05},{-20.35,0.000139172101626},{-20.25,0.0},{-20.15,6.95860508131e-05},{-20.05,0.000185562802168},{-19.95,0.0},{-19.85,0.000139172101626},{-19.75,0.000556688406505},{-19.65,6.95860508131e-05},{-19.55,6.95860508131e-05},{-19.45,6.95860508131e-05},{-19.35,0.000278344203252},{-19.25,9.27814010841e-05},{-19.15,0.00010121607391},{-19.05,0.0},{-18.95,0.000501019600779},{-18.85,0.000167006521951},{-18.75,0.000256933110694},{-18.65,0.000167006521951},{-18.55,0.000357871143413},{-18.45,0.000278344216685},{-18.35,0.000385399692907},{-18.25,0.000835032609757},{-18.15,0.00044071166},{-18.05,0.000296900483469},{-17.95,0.000989668278231},{-17.85,0.000663743855862},{-17.75,0.00071905584385},{-17.65,0.000521895417478},{-17.55,0.00120615824643},{-17.45,0.00133207586727},{-17.35,0.000670087903186},{-17.25,0.000918535888195},{-17.15,0.000788641938319},{-17.05,0.00100203920156},{-16.95,0.0015030587092},{-16.85,0.00106367249308},{-16.75,0.00105770805052},{-16.65,0.00128529527608},{-16.55,0.00162882909731},{-16.45,0.00173501223326},{-16.35,0.00172910794164},{-16.25,0.00167006531427},{-16.15,0.00207293190454},{-16.05,0.00198552211126},{-15.95,0.0019720982998},{-15.85,0.00248839721084},{-15.75,0.00385588582824},{-15.65,0.00305598756919},{-15.55,0.00380228684758},{-15.45,0.00394593851239},{-15.35,0.00447054876357},{-15.25,0.00616888459339},{-15.15,0.00641376097152},{-15.05,0.00569426205199},{-14.95,0.00547898599976},{-14.85,0.00660503273075},{-14.75,0.00605153055752},{-14.65,0.00916005535559},{-14.55,0.00927442868551},{-14.45,0.0072159424143},{-14.35,0.010848716799},{-14.25,0.00902341333303},{-14.15,0.0114765706815},{-14.05,0.0122137439251},{-13.95,0.0117412847021},{-13.85,0.0141368218518},{-13.75,0.0133560686111},{-13.65,0.0163495873546},{-13.55,0.0187047308142},{-13.45,0.0192057500451},{-13.35,0.0166744993837},{-13.25,0.019243880494},{-13.15,0.0183804843858},{-13.05,0.0240933194861},{-12.95,0.0256321172456},{-12.85,0.0243146613587},{-12.75,0.0250868951121},{-12.65,0.0267458186724},{-12.55,0.0295015560953},{-12.45,0.0278458595276},{-12.35,0.030706025896},{-12.25,0.0341372010915},{-12.15,0.032375942577},{-12.05,0.035064871673},{-11.95,0.0350087438311},{-11.85,0.0360330084096},{-11.75,0.0448974465424},{-11.65,0.0442302210801},{-11.55,0.044293898233},{-11.45,0.0526013763583},{-11.35,0.0513876007824},{-11.25,0.0545480547572},{-11.15,0.0560241571352},{-11.05,0.0611602438372},{-10.95,0.0607482665624},{-10.85,0.0584548220276},{-10.75,0.0669441315065},{-10.65,0.0662934284502},{-10.55,0.0832051407867},{-10.45,0.0758995430302},{-10.35,0.0791285412371},{-10.25,0.0879448784722},{-10.15,0.0934508359885},{-10.05,0.102996318637},{-9.95,0.0938116177646},{-9.85,0.112699989381},{-9.75,0.100818904671},{-9.65,0.108424696512},{-9.55,0.110633348807},{-9.45,0.11713454019},{-9.35,0.120417926247},{-9.25,0.137769218433},{-9.15,0.140270227348},{-9.05,0.137452167935},{-8.95,0.141025015648},{-8.85,0.155477578748},{-8.75,0.155180438481},{-8.65,0.178247585218},{-8.55,0.189888542467},{-8.45,0.174239879756},{-8.35,0.196890456166},{-8.25,0.19147066069},{-8.15,0.204730525292},{-8.05,0.211397834811},{-7.95,0.215441061649},{-7.85,0.236865781701},{-7.75,0.235822236258},{-7.65,0.249999300768},{-7.55,0.259743063248},{-7.45,0.267749642635},{-7.35,0.306826632349},{-7.25,0.284685251807},{-7.15,0.307326413272},{-7.05,0.312052874981},{-6.95,0.334719586416},{-6.85,0.316047106554},{-6.75,0.336598672157},{-6.65,0.361181892794},{-6.55,0.385876825411},{-6.45,0.374546647637},{-6.35,0.380343000792},{-6.25,0.393407024769},{-6.15,0.401942540195},{-6.05,0.439265489761},{-5.95,0.438445933625},{-5.85,0.455750795272},{-5.75,0.472659323713},{-5.65,0.463246065028},{-5.55,0.503783836311},{-5.45,0.513493138187},{-5.35,0.517008910239},{-5.25,0.536711877474},{-5.15,0.544157888666},{-5.05,0.551396880487},{-4.95,0.583298857956},{-4.85,0.607349405609},{-4.75,0.575226730833},{-4.65,0.60195904643},{-4.55,0.631388173834},{-4.45,0.665712294205},{-4.35,0.651107689873},{-4.25,0.679441340492},{-4.15,0.678855380378},{-4.05,0.683870251547},{-3.95,0.724794660296},{-3.85,0.731506209568},{-3.75,0.762120188343},{-3.65,0.7308477829},{-3.55,0.755912406086},{-3.45,0.801354366707},{-3.35,0.812673084771},{-3.25,0.802952301808},{-3.15,0.859335899353},{-3.05,0.813857613853},{-2.95,0.841097175638},{-2.85,0.870811989406},{-2.75,0.862779174427},{-2.65,0.88689159292},{-2.55,0.904742896246},{-2.45,0.914041344514},{-2.35,0.926445365382},{-2.25,0.962779833623},{-2.15,0.939754277165},{-2.05,0.983142619474},{-1.95,0.993286577629},{-1.85,0.947480025946},{-1.75,0.977220814286},{-1.65,0.972949530368},{-1.55,1.04310822264},{-1.45,1.01000666214},{-1.35,1.02288519586},{-1.25,1.04202395164},{-1.15,1.05176581509},{-1.05,1.0547972715},{-0.95,0.997956414232},{-0.85,1.04288951766},{-0.75,1.09657156808},{-0.65,1.08488392423},{-0.55,1.07292767268},{-0.45,1.10257663207},{-0.35,1.11600380293},{-0.25,1.07370960712},{-0.15,1.11739375673},{-0.05,1.13091462854},{0.05,1.12735957001},{0.15,1.12604718579},{0.25,1.10213576307},{0.35,1.13880441565},{0.45,1.1320575997},{0.55,1.14955085231},{0.65,1.18361837363},{0.75,1.16393112909},{0.85,1.1892396839},{0.95,1.16329434706},{1.05,1.16146489065},{1.15,1.1585567305},{1.25,1.16037722688},{1.35,1.20461585422},{1.45,1.14217542423},{1.55,1.14208296655},{1.65,1.18853110898},{1.75,1.20168025362},{1.85,1.17844004366},{1.95,1.21947451804},{2.05,1.13277444764},{2.15,1.16333835892},{2.25,1.15473772034},{2.35,1.16737396938},{2.45,1.14981497251},{2.55,1.16520574122},{2.65,1.15809701656},{2.75,1.12833558632},{2.85,1.12669440312},{2.95,1.16453304454},{3.05,1.10454814608},{3.15,1.18652360692},{3.25,1.15744054359},{3.35,1.08996452514},{3.45,1.14784218986},{3.55,1.11880376288},{3.65,1.0731198627},{3.75,1.08458050989},{3.85,1.05666503906},{3.95,1.07991866378},{4.05,1.0379070756},{4.15,1.10186870861},{4.25,1.010598352},{4.35,1.04208668405},{4.45,1.00082613536},{4.55,1.06414741848},{4.65,0.978227643637},{4.75,0.999109617235},{4.85,1.02126346459},{4.95,1.01599144039},{5.05,0.875020242816},{5.15,0.931365657402},{5.25,0.885255181281},{5.35,0.915994230009},{5.45,0.921367118029},{5.55,0.900752867708},{5.65,0.902008383381},{5.75,0.865343846612},{5.85,0.827814629737},{5.95,0.83440691559},{6.05,0.809690727622},{6.15,0.76045578138},{6.25,0.754387749566},{6.35,0.804527263202},{6.45,0.754054357895},{6.55,0.762776611652},{6.65,0.730419026693},{6.75,0.678122384208},{6.85,0.745775371255},{6.95,0.695947184962},{7.05,0.717927726211},{7.15,0.640085339902},{7.25,0.680216454343},{7.35,0.597427509887},{7.45,0.613582886768},{7.55,0.643742387623},{7.65,0.629543546065},{7.75,0.588400621794},{7.85,0.555159655484},{7.95,0.58040134262},{8.05,0.516342858041},{8.15,0.471413243319},{8.25,0.493561377892},{8.35,0.487294173614},{8.45,0.456352778843},{8.55,0.488712223432},{8.65,0.400464952257},{8.75,0.389113676713},{8.85,0.401710606829},{8.95,0.392667094236},{9.05,0.402488155641},{9.15,0.403147016253},{9.25,0.364880009098},{9.35,0.332811811329},{9.45,0.325174560547},{9.55,0.319534623778},{9.65,0.345843723842},{9.75,0.293928606757},{9.85,0.292223565719},{9.95,0.280244133689},{10.05,0.324834272195},{10.15,0.296401622684},{10.25,0.288865624405},{10.35,0.265891328526},{10.45,0.232073581057},{10.55,0.257068180394},{10.65,0.222240371321},{10.75,0.267657984316},{10.85,0.207644787464},{10.95,0.217514772593},{11.05,0.212374818091},{11.15,0.189999173401},{11.25,0.213108884371},{11.35,0.217614782268},{11.45,0.199409632847},{11.55,0.166689038277},{11.65,0.180683695942},{11.75,0.157403644763},{11.85,0.14885699749},{11.95,0.147757539471},{12.05,0.144428749879},{12.15,0.124607265586},{12.25,0.115069153285},{12.35,0.108230454581},{12.45,0.101481367412},{12.55,0.0970864613851},{12.65,0.092243273118},{12.75,0.095417129366},{12.85,0.111026867231},{12.95,0.0930226325989},{13.05,0.120863236321},{13.15,0.0937389787638},{13.25,0.0736836449045},{13.35,0.0883258840312},{13.45,0.0665445111015},{13.55,0.0686640391747},{13.65,0.0663201491038},{13.75,0.0665378454255},{13.85,0.082000207901},{13.95,0.0928625861804},{14.05,0.0716636947223},{14.15,0.0512471437454},{14.25,0.0497392668869},{14.35,0.0678906820037},{14.45,0.0518362567975},{14.55,0.0706011898377},{14.65,0.0420522451401},{14.75,0.0317312399546},{14.85,0.0454873034829},{14.95,0.0338947339491},{15.05,0.0448876420657},{15.15,0.0170253879494},{15.25,0.0237604731863},{15.35,0.0460938006639},{15.45,0.0437618957625},{15.55,0.0370816356606},{15.65,0.02488861233},{15.75,0.0135070195324},{15.85,0.015624388059},{15.95,0.021123232113},{16.05,0.0110293896869},{16.15,0.0121079732974},{16.25,0.0112194132346},{16.35,0.0220448613167},{16.45,0.0128435971481},{16.55,0.0108902174979},{16.65,0.0144738987088},{16.75,0.00706994310021},{16.85,0.00609264564183},{16.95,0.0118296286091},{17.05,0.00829465761781},{17.15,0.00508972257376},{17.25,0.00606790371239},{17.35,0.00716736353934},{17.45,0.0269993878901},{17.55,0.00633233087137},{17.65,0.0139172105119},{17.75,0.00345146805048},{17.85,0.0},{17.95,0.00598440039903},{18.05,0.0130821783096},{18.15,0.00306178629398},{18.25,0.00306178629398},{18.35,0.0043143350631},{18.45,0.00640191696584},{18.55,0.00445350725204},{18.65,0.00501019600779},{18.75,0.00250509800389},{18.85,0.0},{18.95,0.00250509800389},{19.05,0.00139172107447},{19.15,0.0},{19.25,0.000695860537235},{19.35,0.00306178629398},{19.45,0.0},{19.55,0.0},{19.65,0.00167006521951},{19.75,0.0},{19.85,0.0},{19.95,0.0},{20.05,0.0},{20.15,0.0},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.000278344203252},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU30 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.0},{-21.35,0.0},{-21.25,0.0},{-21.15,0.0},{-21.05,0.0},{-20.95,0.0},{-20.85,0.0},{-20.75,0.000835032609757},{-20.65,0.0},{-20.55,0.0},{-20.45,0.000417516304879},{-20.35,4.63907005421e-05},{-20.25,0.0},{-20.15,0.0},{-20.05,0.0},{-19.95,9.27814010841e-05},{-19.85,6.95860508131e-05},{-19.75,4.63907005421e-05},{-19.65,6.95860508131e-05},{-19.55,0.0},{-19.45,0.0},{-19.35,7.9526915215e-05},{-19.25,0.000389681896195},{-19.15,0.000139172107447},{-19.05,0.000556688429788},{-18.95,7.59120554325e-05},{-18.85,0.000185562802168},{-18.75,0.0},{-18.65,0.000185562802168},{-18.55,0.000510297715664},{-18.45,0.00036184748169},{-18.35,0.000301539568075},{-18.25,0.000432979884661},{-18.15,0.000904618704226},{-18.05,0.000556688423135},{-17.95,0.000795269185411},{-17.85,0.00111337684627},{-17.75,0.000501019569735},{-17.65,0.000807198230177},{-17.55,0.00088142332},{-17.45,0.000556688412632},{-17.35,0.000817636144347},{-17.25,0.000909257742266},{-17.15,0.00151542957044},{-17.05,0.000943277652065},{-16.95,0.00105286721626},{-16.85,0.00156182030009},{-16.75,0.0017579635115},{-16.65,0.00139172099855},{-16.55,0.00165935978293},{-16.45,0.00172359295763},{-16.35,0.00205546488556},{-16.25,0.00189274059875},{-16.15,0.0018092374153},{-16.05,0.003023393966},{-15.95,0.00376924437781},{-15.85,0.00201657536078},{-15.75,0.00303085914089},{-15.65,0.00295316409774},{-15.55,0.00320947930521},{-15.45,0.00303085920987},{-15.35,0.00326255916572},{-15.25,0.00522050029702},{-15.15,0.00466484272922},{-15.05,0.00640771538019},{-14.95,0.00535923053348},{-14.85,0.00675574399657},{-14.75,0.00745693137569},{-14.65,0.00743058021518},{-14.55,0.00600548705669},{-14.45,0.0091371122996},{-14.35,0.00941399875141},{-14.25,0.0106792570669},{-14.15,0.0110755105351},{-14.05,0.0124915445723},{-13.95,0.0127304242207},{-13.85,0.0152128367197},{-13.75,0.013456772421},{-13.65,0.0141857883386},{-13.55,0.0164594207491},{-13.45,0.0141382489134},{-13.35,0.0174225365243},{-13.25,0.0176367141582},{-13.15,0.0196766333472},{-13.05,0.0220976647209},{-12.95,0.023679724511},{-12.85,0.0235537423028},{-12.75,0.0250034136108},{-12.65,0.0264751457729},{-12.55,0.0243307266039},{-12.45,0.0288322010978},{-12.35,0.0306354422318},{-12.25,0.0321005001739},{-12.15,0.029432541233},{-12.05,0.032822015958},{-11.95,0.0360651099891},{-11.85,0.0376144243666},{-11.75,0.0442764358183},{-11.65,0.0476916658826},{-11.55,0.044623353588},{-11.45,0.0518940055513},{-11.35,0.045911480308},{-11.25,0.0552528116627},{-11.15,0.0505518495496},{-11.05,0.057877216699},{-10.95,0.0695762835051},{-10.85,0.0588529764951},{-10.75,0.066103223344},{-10.65,0.0659039584073},{-10.55,0.078805607387},{-10.45,0.079454284668},{-10.35,0.0824271919801},{-10.25,0.0842473285954},{-10.15,0.0881734848022},{-10.05,0.0838229526536},{-9.95,0.0986188136907},{-9.85,0.092479728653},{-9.75,0.084429502892},{-9.65,0.116401240197},{-9.55,0.111639720098},{-9.45,0.116775411548},{-9.35,0.113830866879},{-9.25,0.120293683409},{-9.15,0.127306120963},{-9.05,0.129560007282},{-8.95,0.144854731292},{-8.85,0.139073693541},{-8.75,0.15263874556},{-8.65,0.167997211682},{-8.55,0.165047347716},{-8.45,0.172220712942},{-8.35,0.171954050114},{-8.25,0.181710744182},{-8.15,0.18650420646},{-8.05,0.190964203614},{-7.95,0.203598206524},{-7.85,0.214069221133},{-7.75,0.220218579522},{-7.65,0.236051730024},{-7.55,0.234917351883},{-7.45,0.242156222715},{-7.35,0.262900627616},{-7.25,0.279422701834},{-7.15,0.277988692329},{-7.05,0.302954553675},{-6.95,0.300219678026},{-6.85,0.309744732654},{-6.75,0.324454133407},{-6.65,0.335629101144},{-6.55,0.351159413656},{-6.45,0.342646857994},{-6.35,0.35581239755},{-6.25,0.368061918832},{-6.15,0.383932682278},{-6.05,0.414763680242},{-5.95,0.386493464793},{-5.85,0.42669521234},{-5.75,0.419986950646},{-5.65,0.439491164852},{-5.55,0.47119674989},{-5.45,0.480602039658},{-5.35,0.494516739934},{-5.25,0.50099813686},{-5.15,0.497660333711},{-5.05,0.525430223856},{-4.95,0.520701054852},{-4.85,0.534955342611},{-4.75,0.553898963106},{-4.65,0.557158353036},{-4.55,0.578884815281},{-4.45,0.56576604684},{-4.35,0.586944737385},{-4.25,0.598362586149},{-4.15,0.629481401183},{-4.05,0.659705066176},{-3.95,0.68223628592},{-3.85,0.676737780449},{-3.75,0.683361924161},{-3.65,0.673654477764},{-3.55,0.71070834246},{-3.45,0.724709814514},{-3.35,0.780107946738},{-3.25,0.742889922799},{-3.15,0.745057748983},{-3.05,0.78445623551},{-2.95,0.762977862873},{-2.85,0.792533489189},{-2.75,0.811413530518},{-2.65,0.827447527985},{-2.55,0.846821834202},{-2.45,0.860461411145},{-2.35,0.839116382215},{-2.25,0.876752178486},{-2.15,0.852363806879},{-2.05,0.870786207976},{-1.95,0.858307307916},{-1.85,0.870464170501},{-1.75,0.94200465518},{-1.65,0.883043762878},{-1.55,0.922101494406},{-1.45,0.968499601203},{-1.35,0.911988444279},{-1.25,0.920944180331},{-1.15,0.96633480645},{-1.05,0.961224716169},{-0.95,0.955739599446},{-0.85,0.967846461095},{-0.75,1.00000364389},{-0.65,1.0046761674},{-0.55,0.979750721288},{-0.45,0.992896712769},{-0.35,0.987821483506},{-0.25,1.01195810763},{-0.15,1.02163074764},{-0.05,1.10345590607},{0.05,1.03328509152},{0.15,1.03284695782},{0.25,1.06276039259},{0.35,1.06356018319},{0.45,1.07374902402},{0.55,1.05975020559},{0.65,1.01683605686},{0.75,1.08136475202},{0.85,1.05441526727},{0.95,1.02029250185},{1.05,1.06399802863},{1.15,1.0561795929},{1.25,1.1108358058},{1.35,1.09302119559},{1.45,1.08160071092},{1.55,1.06212810256},{1.65,1.08363757371},{1.75,1.04954105218},{1.85,1.05952334449},{1.95,1.04635521424},{2.05,1.08381289335},{2.15,1.0997148258},{2.25,1.06510907988},{2.35,1.06260618389},{2.45,1.06565385906},{2.55,1.05986738403},{2.65,1.04855386862},{2.75,1.05351945804},{2.85,1.02482488753},{2.95,1.02341299936},{3.05,1.05084676439},{3.15,1.08904026372},{3.25,0.984472603444},{3.35,1.0225328585},{3.45,1.009210632},{3.55,1.06150581184},{3.65,0.983644485474},{3.75,1.04267878128},{3.85,1.02217254898},{3.95,1.00126014443},{4.05,0.974514085419},{4.15,1.01150109841},{4.25,0.998065000931},{4.35,0.925677090441},{4.45,0.935635159972},{4.55,0.909406421187},{4.65,0.906143231139},{4.75,0.884276372217},{4.85,0.932430407466},{4.95,0.96495418507},{5.05,0.899738279711},{5.15,0.852687596047},{5.25,0.806375524669},{5.35,0.795001101518},{5.45,0.855541277424},{5.55,0.869224123458},{5.65,0.79765577074},{5.75,0.814367735546},{5.85,0.808463742035},{5.95,0.771113722357},{6.05,0.75294097589},{6.15,0.697652657044},{6.25,0.799973209347},{6.35,0.721423763699},{6.45,0.696954311365},{6.55,0.714990722288},{6.65,0.716902911474},{6.75,0.723027581337},{6.85,0.643963967987},{6.95,0.632617394901},{7.05,0.641818127},{7.15,0.685776699464},{7.25,0.570192133715},{7.35,0.6343055604},{7.45,0.579880053056},{7.55,0.572229149807},{7.65,0.515497717957},{7.75,0.533831241473},{7.85,0.493726161624},{7.95,0.497890182793},{8.05,0.504170049623},{8.15,0.556430629042},{8.25,0.500802261711},{8.35,0.432547573838},{8.45,0.416099361345},{8.55,0.390909194946},{8.65,0.419438979205},{8.75,0.377553714219},{8.85,0.376893179757},{8.95,0.35835037675},{9.05,0.350328764292},{9.15,0.374424970686},{9.25,0.399177490958},{9.35,0.387153969436},{9.45,0.328334425462},{9.55,0.33952243269},{9.65,0.320258902705},{9.75,0.300069087694},{9.85,0.291882519155},{9.95,0.244104573849},{10.05,0.291292161506},{10.15,0.286541887509},{10.25,0.292314134406},{10.35,0.23926148812},{10.45,0.255006381444},{10.55,0.205996453762},{10.65,0.206546953937},{10.75,0.217299953388},{10.85,0.218277147371},{10.95,0.194891052246},{11.05,0.212920278311},{11.15,0.163288636641},{11.25,0.183031203255},{11.35,0.176757780974},{11.45,0.174635136022},{11.55,0.154257407555},{11.65,0.164283714672},{11.75,0.141391127198},{11.85,0.143480758278},{11.95,0.128581245347},{12.05,0.1272305302},{12.15,0.140695672286},{12.25,0.133689109593},{12.35,0.117622400585},{12.45,0.0878400494975},{12.55,0.100391987208},{12.65,0.0910668055216},{12.75,0.0898355946821},{12.85,0.118580430746},{12.95,0.080715470016},{13.05,0.100363812548},{13.15,0.0888323982557},{13.25,0.0849753962623},{13.35,0.089048734078},{13.45,0.0653355022271},{13.55,0.0765672245541},{13.65,0.0803544968367},{13.75,0.10668174787},{13.85,0.0560717080769},{13.95,0.0508692844494},{14.05,0.0528362814118},{14.15,0.067976495494},{14.25,0.0476339737574},{14.35,0.0558503710705},{14.45,0.0339498064097},{14.55,0.0482993466513},{14.65,0.0325950671887},{14.75,0.077531516552},{14.85,0.0383836656809},{14.95,0.0365363390822},{15.05,0.0296105231558},{15.15,0.0293962425656},{15.25,0.0258705483543},{15.35,0.0413341164589},{15.45,0.038720773326},{15.55,0.031564232707},{15.65,0.0201478394178},{15.75,0.0116131388479},{15.85,0.022051046292},{15.95,0.022148247276},{16.05,0.0156800564792},{16.15,0.0146594610479},{16.25,0.00979265570641},{16.35,0.00852745432745},{16.45,0.0111735314131},{16.55,0.0353497155011},{16.65,0.0166310667992},{16.75,0.0495452694595},{16.85,0.00675978777664},{16.95,0.00546250492334},{17.05,0.00745962485671},{17.15,0.00681943306699},{17.25,0.0036582382662},{17.35,0.00788641907275},{17.45,0.0111337685958},{17.55,0.0086286701262},{17.65,0.00295044854283},{17.75,0.00334013043903},{17.85,0.018092373386},{17.95,0.0116904564202},{18.05,0.00473185162991},{18.15,0.00139172105119},{18.25,0.00222675362602},{18.35,0.00278344214894},{18.45,0.0036184748169},{18.55,0.00334013043903},{18.65,0.00250509800389},{18.75,0.00111337681301},{18.85,0.00153089314699},{18.95,0.000695860537235},{19.05,0.000835032609757},{19.15,0.00139172107447},{19.25,0.0},{19.35,0.000695860537235},{19.45,0.000139172101626},{19.55,0.00167006521951},{19.65,0.0},{19.75,0.000556688406505},{19.85,0.0},{19.95,0.0},{20.05,0.00139172107447},{20.15,0.0},{20.25,0.0},{20.35,0.0},{20.45,0.000556688406505},{20.55,0.0},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU31 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.0},{-21.35,0.0},{-21.25,0.0},{-21.15,0.0},{-21.05,0.0},{-20.95,0.000278344203252},{-20.85,0.0},{-20.75,0.0},{-20.65,0.0},{-20.55,0.0},{-20.45,0.0},{-20.35,0.0},{-20.25,0.0},{-20.15,0.000139172101626},{-20.05,0.000417516304879},{-19.95,9.27814010841e-05},{-19.85,0.0},{-19.75,0.000208758152439},{-19.65,0.0},{-19.55,0.00015905383043},{-19.45,0.000111337681301},{-19.35,5.56688406505e-05},{-19.25,0.000139172101626},{-19.15,0.00015905383043},{-19.05,0.000139172101626},{-18.95,0.000247417069558},{-18.85,0.000347930268617},{-18.75,0.000371125604336},{-18.65,0.000445350725204},{-18.55,0.00031810766086},{-18.45,0.00021648994233},{-18.35,0.000371125604336},{-18.25,0.000742251208673},{-18.15,0.000394320969159},{-18.05,0.000521895417478},{-17.95,0.00037956030362},{-17.85,0.000914559566549},{-17.75,0.00080023962073},{-17.65,0.000695860537235},{-17.55,0.000494834139115},{-17.45,0.000426794464389},{-17.35,0.000618542699764},{-17.25,0.00119902121906},{-17.15,0.000974204723856},{-17.05,0.000890701450408},{-16.95,0.000937580474113},{-16.85,0.00129893963181},{-16.75,0.000691371098641},{-16.65,0.00108355423436},{-16.55,0.00161439639827},{-16.45,0.00173332525248},{-16.35,0.00140099922816},{-16.25,0.00117241952455},{-16.15,0.00243248628533},{-16.05,0.00241602778435},{-15.95,0.00252571591625},{-15.85,0.00244779183584},{-15.75,0.00263557163998},{-15.65,0.00315183883204},{-15.55,0.00424938847621},{-15.45,0.00444507282792},{-15.35,0.00483009087689},{-15.25,0.00392844900489},{-15.15,0.00327589718195},{-15.05,0.00497611292771},{-14.95,0.00685345331828},{-14.85,0.00682216181475},{-14.75,0.0083562484447},{-14.65,0.00593058745066},{-14.55,0.00654108896852},{-14.45,0.0103193543575},{-14.35,0.00793796483381},{-14.25,0.0130821775113},{-14.15,0.010227452691},{-14.05,0.00995309929271},{-13.95,0.011703402497},{-13.85,0.0152788403872},{-13.75,0.0149343690754},{-13.65,0.0146665992318},{-13.55,0.0148321638013},{-13.45,0.013351396459},{-13.35,0.0165117766176},{-13.25,0.0184263857928},{-13.15,0.020166162972},{-13.05,0.0155194297433},{-12.95,0.0196154268695},{-12.85,0.0208099903287},{-12.75,0.0204915985739},{-12.65,0.0235914111137},{-12.55,0.0236560029593},{-12.45,0.0291267339285},{-12.35,0.0301299006851},{-12.25,0.0263130781697},{-12.15,0.0306524760983},{-12.05,0.0317068006934},{-11.95,0.0354616126822},{-11.85,0.0383353375677},{-11.75,0.0434160183887},{-11.65,0.0395568563583},{-11.55,0.0410428105096},{-11.45,0.0470650449712},{-11.35,0.0455385760257},{-11.25,0.0503674068966},{-11.15,0.0499000616477},{-11.05,0.0526807070598},{-10.95,0.0563741052473},{-10.85,0.0588315951279},{-10.75,0.0603515754912},{-10.65,0.0625195700741},{-10.55,0.0673354888736},{-10.45,0.0855441307939},{-10.35,0.0781608480862},{-10.25,0.0823236919064},{-10.15,0.0852529631721},{-10.05,0.0775318680523},{-9.95,0.0837183735689},{-9.85,0.0926562717983},{-9.75,0.093940848344},{-9.65,0.0986478067351},{-9.55,0.100902143438},{-9.45,0.108021245104},{-9.35,0.113812690465},{-9.25,0.117959022522},{-9.15,0.121302188593},{-9.05,0.123535198324},{-8.95,0.1272660242},{-8.85,0.141138768153},{-8.75,0.138345441357},{-8.65,0.14216698133},{-8.55,0.146360293839},{-8.45,0.169426336834},{-8.35,0.165897434041},{-8.25,0.160545829293},{-8.15,0.1846316455},{-8.05,0.17548364192},{-7.95,0.193941987195},{-7.85,0.196439110645},{-7.75,0.20681561392},{-7.65,0.219564734789},{-7.55,0.234856535687},{-7.45,0.242588161805},{-7.35,0.254137563828},{-7.25,0.262784458967},{-7.15,0.267134902273},{-7.05,0.263733958339},{-6.95,0.26795006421},{-6.85,0.305770103015},{-6.75,0.281384239706},{-6.65,0.284065510184},{-6.55,0.311994921523},{-6.45,0.31790746485},{-6.35,0.359096695455},{-6.25,0.345058162772},{-6.15,0.351895733209},{-6.05,0.379567071781},{-5.95,0.378805760385},{-5.85,0.422418923742},{-5.75,0.404356619891},{-5.65,0.436486432391},{-5.55,0.413186096403},{-5.45,0.437340943564},{-5.35,0.460152932636},{-5.25,0.454661540744},{-5.15,0.482361155543},{-5.05,0.475117402918},{-4.95,0.497021806407},{-4.85,0.524151334827},{-4.75,0.537156734229},{-4.65,0.523669213733},{-4.55,0.5341083777},{-4.45,0.56947760715},{-4.35,0.589622052358},{-4.25,0.597030843419},{-4.15,0.580036787348},{-4.05,0.592197950366},{-3.95,0.606173866674},{-3.85,0.602292204409},{-3.75,0.628535748212},{-3.65,0.636634475697},{-3.55,0.654375565671},{-3.45,0.682220238482},{-3.35,0.68153482499},{-3.25,0.716098042349},{-3.15,0.704491506969},{-3.05,0.710736709878},{-2.95,0.672236458998},{-2.85,0.726988754995},{-2.75,0.737419113005},{-2.65,0.757286180547},{-2.55,0.809578752144},{-2.45,0.800574389851},{-2.35,0.717754410648},{-2.25,0.787835503759},{-2.15,0.852283488529},{-2.05,0.826731062321},{-1.95,0.843836342416},{-1.85,0.834231910958},{-1.75,0.82202368384},{-1.65,0.832298657085},{-1.55,0.854204535874},{-1.45,0.867126224548},{-1.35,0.890744708712},{-1.25,0.866190671},{-1.15,0.854178182734},{-1.05,0.901481698781},{-0.95,0.858448496203},{-0.85,0.908968802441},{-0.75,0.936916875105},{-0.65,0.900983459746},{-0.55,0.927463899206},{-0.45,0.934116060055},{-0.35,0.953500268294},{-0.25,0.939084026723},{-0.15,0.969518407444},{-0.05,0.956781745433},{0.05,0.925071971276},{0.15,0.966340687353},{0.25,0.991034632372},{0.35,0.986991986836},{0.45,0.979558952487},{0.55,1.02157963669},{0.65,0.983753688046},{0.75,0.971605815913},{0.85,0.992270012061},{0.95,0.956412776824},{1.05,0.976017179693},{1.15,0.964523628538},{1.25,1.00556229349},{1.35,1.03352897763},{1.45,1.01021181919},{1.55,0.994609650586},{1.65,0.998632562283},{1.75,0.994130579537},{1.85,0.983334581203},{1.95,0.958666762865},{2.05,0.997079389048},{2.15,0.978956715541},{2.25,0.991011220304},{2.35,0.987018938473},{2.45,1.00261054687},{2.55,1.00369751076},{2.65,0.964039476612},{2.75,0.987298357928},{2.85,1.01841925259},{2.95,0.976745605469},{3.05,0.922689688793},{3.15,0.976142471977},{3.25,0.916755866687},{3.35,0.950620842315},{3.45,0.975820308008},{3.55,0.993659579275},{3.65,0.943643148843},{3.75,0.910794187443},{3.85,0.894476778367},{3.95,0.964071710985},{4.05,0.897290464066},{4.15,0.873097080389},{4.25,0.909401404476},{4.35,0.881823893564},{4.45,0.858878689459},{4.55,0.938754925149},{4.65,0.833636229436},{4.75,0.845484988316},{4.85,0.83498785064},{4.95,0.842724552199},{5.05,0.858112579496},{5.15,0.845730541043},{5.25,0.840636181893},{5.35,0.796257376822},{5.45,0.780578927491},{5.55,0.792510820921},{5.65,0.816901961617},{5.75,0.764694407561},{5.85,0.77522840954},{5.95,0.704264008597},{6.05,0.77804264691},{6.15,0.68934353501},{6.25,0.688130095439},{6.35,0.686846122556},{6.45,0.599767109346},{6.55,0.683337963091},{6.65,0.637208449451},{6.75,0.641238236861},{6.85,0.630104966727},{6.95,0.599383316753},{7.05,0.613669031595},{7.15,0.561563458618},{7.25,0.576505465896},{7.35,0.571327042892},{7.45,0.609667273129},{7.55,0.545223483333},{7.65,0.517182244195},{7.75,0.529232092071},{7.85,0.501003523518},{7.95,0.486839866145},{8.05,0.499770946717},{8.15,0.4833002008},{8.25,0.467855419633},{8.35,0.44472259977},{8.45,0.451419559602},{8.55,0.374410356794},{8.65,0.408653537169},{8.75,0.339009371671},{8.85,0.385048102654},{8.95,0.380221295713},{9.05,0.35147888634},{9.15,0.33894916723},{9.25,0.34465912748},{9.35,0.311150022712},{9.45,0.311965320243},{9.55,0.304728247125},{9.65,0.324241031745},{9.75,0.251486952761},{9.85,0.28175285535},{9.95,0.277025098386},{10.05,0.276441108349},{10.15,0.253242032281},{10.25,0.231649613113},{10.35,0.208415922571},{10.45,0.212126611949},{10.55,0.226341508839},{10.65,0.201946906794},{10.75,0.223308160901},{10.85,0.172309528698},{10.95,0.189047109164},{11.05,0.188861179352},{11.15,0.18143482866},{11.25,0.149224618765},{11.35,0.157188783612},{11.45,0.181814448039},{11.55,0.171792149544},{11.65,0.140797634125},{11.75,0.154584999544},{11.85,0.129251552665},{11.95,0.156071581159},{12.05,0.141915784563},{12.15,0.114963205555},{12.25,0.0977872287526},{12.35,0.107631731033},{12.45,0.0982753889901},{12.55,0.124130604314},{12.65,0.105909974487},{12.75,0.0854836135614},{12.85,0.110340828119},{12.95,0.0831232162622},{13.05,0.0867526272069},{13.15,0.109169974472},{13.25,0.107496531804},{13.35,0.0713443756104},{13.45,0.0627401102157},{13.55,0.0759966671467},{13.65,0.074548260919},{13.75,0.0680983518732},{13.85,0.0577698907545},{13.95,0.0573595232434},{14.05,0.0591537094116},{14.15,0.0596542250026},{14.25,0.0417416904654},{14.35,0.0307029121452},{14.45,0.0446109853008},{14.55,0.052557934733},{14.65,0.0382524473327},{14.75,0.0326295332475},{14.85,0.0424011031787},{14.95,0.047527273496},{15.05,0.0309483967721},{15.15,0.0239685293701},{15.25,0.0184104811578},{15.35,0.027648858726},{15.45,0.0276572921059},{15.55,0.0246334627271},{15.65,0.0181387638052},{15.75,0.0112903369591},{15.85,0.0155872756785},{15.95,0.0140007138252},{16.05,0.0192521413167},{16.15,0.0107162520289},{16.25,0.0113077331334},{16.35,0.00642511248589},{16.45,0.0138058722019},{16.55,0.00578337411086},{16.65,0.00674984697253},{16.75,0.00886062408487},{16.85,0.0093941166997},{16.95,0.0116904564202},{17.05,0.00303085914089},{17.15,0.00422155391425},{17.25,0.00528853992},{17.35,0.00528853992},{17.45,0.00466226553544},{17.55,0.00352569328},{17.65,0.0},{17.75,0.00306178629398},{17.85,0.00807198230177},{17.95,0.00556688429788},{18.05,0.0},{18.15,0.00306178629398},{18.25,0.00146130705252},{18.35,0.00334013043903},{18.45,0.00473185162991},{18.55,0.000974204740487},{18.65,0.00194840948097},{18.75,0.00139172107447},{18.85,0.00250509800389},{18.95,0.0},{19.05,0.00111337681301},{19.15,0.000835032609757},{19.25,0.00111337681301},{19.35,0.000835032609757},{19.45,0.0},{19.55,0.000649469826991},{19.65,0.0},{19.75,0.0},{19.85,0.0},{19.95,0.0},{20.05,0.0},{20.15,0.0},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.0},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU32 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.0},{-21.35,0.0},{-21.25,0.0},{-21.15,0.000278344203252},{-21.05,0.0},{-20.95,0.000139172101626},{-20.85,0.000139172101626},{-20.75,0.0},{-20.65,0.0},{-20.55,0.0},{-20.45,0.0},{-20.35,9.27814010841e-05},{-20.25,0.0},{-20.15,0.000139172101626},{-20.05,0.0},{-19.95,0.0},{-19.85,9.27814010841e-05},{-19.75,0.0},{-19.65,0.0},{-19.55,3.47930254065e-05},{-19.45,9.27814010841e-05},{-19.35,0.0},{-19.25,0.000835032609757},{-19.15,0.000556688406505},{-19.05,0.000347930268617},{-18.95,0.00015905383043},{-18.85,0.000649469826991},{-18.75,0.000139172101626},{-18.65,0.000695860537235},{-18.55,0.000154635674941},{-18.45,0.000278344203252},{-18.35,0.000324734913496},{-18.25,0.000214110934534},{-18.15,0.000324734913496},{-18.05,0.000324734913496},{-17.95,0.000162367456748},{-17.85,0.00077936379239},{-17.75,0.00077936379239},{-17.65,0.000328952256082},{-17.55,0.000869825656991},{-17.45,0.000426794464389},{-17.35,0.000587615546667},{-17.25,0.000426794464389},{-17.15,0.000904618684823},{-17.05,0.00141955548897},{-16.95,0.00128038339317},{-16.85,0.000890701450408},{-16.75,0.00123057436002},{-16.65,0.00194840944771},{-16.55,0.00143811179118},{-16.45,0.00205278862268},{-16.35,0.00135048492639},{-16.25,0.00143295719668},{-16.15,0.00254904694463},{-16.05,0.00133267835234},{-15.95,0.00239906193955},{-15.85,0.00233610320304},{-15.75,0.00232881332437},{-15.65,0.00292261410505},{-15.55,0.00230143146544},{-15.45,0.00275693319383},{-15.35,0.00389681887977},{-15.25,0.00333445017435},{-15.15,0.00440955828679},{-15.05,0.0048431891948},{-14.95,0.00526323609731},{-14.85,0.00693077072501},{-14.75,0.00565326676287},{-14.65,0.00648078123728},{-14.55,0.00882351160049},{-14.45,0.00912865941171},{-14.35,0.00882003176957},{-14.25,0.00847577712905},{-14.15,0.0121201810084},{-14.05,0.0114439232009},{-13.95,0.0131112586206},{-13.85,0.0132640298208},{-13.75,0.0122147798538},{-13.65,0.0131549266252},{-13.55,0.011958492023},{-13.45,0.0155780996595},{-13.35,0.0133389265373},{-13.25,0.0167770607799},{-13.15,0.0151998205185},{-13.05,0.0180376554147},{-12.95,0.0179210846241},{-12.85,0.0235074346716},{-12.75,0.0193221818388},{-12.65,0.0253787059938},{-12.55,0.0273168738931},{-12.45,0.0255660102481},{-12.35,0.0282017584561},{-12.25,0.0297177642971},{-12.15,0.0333004285825},{-12.05,0.032490060443},{-11.95,0.0326438445211},{-11.85,0.0331412373167},{-11.75,0.0351596250767},{-11.65,0.0398415643342},{-11.55,0.0414248802812},{-11.45,0.0424622434625},{-11.35,0.0488345460984},{-11.25,0.0426118693014},{-11.15,0.0465298720769},{-11.05,0.051547550386},{-10.95,0.0497614305916},{-10.85,0.0566074686839},{-10.75,0.062180184226},{-10.65,0.0595486180312},{-10.55,0.0652189254761},{-10.45,0.0599762365615},{-10.35,0.0687596924208},{-10.25,0.075755125437},{-10.15,0.0670794836764},{-10.05,0.0788981522882},{-9.95,0.0769114006223},{-9.85,0.0907143966011},{-9.75,0.0802567966798},{-9.65,0.0930566394452},{-9.55,0.0967384642036},{-9.45,0.0986021132696},{-9.35,0.0977789574927},{-9.25,0.112625756364},{-9.15,0.106516319686},{-9.05,0.119934748354},{-8.95,0.12062706448},{-8.85,0.117687345881},{-8.75,0.134184635968},{-8.65,0.137475956466},{-8.55,0.140309907401},{-8.45,0.14073111913},{-8.35,0.144079296212},{-8.25,0.153561494531},{-8.15,0.164585624253},{-8.05,0.163760191165},{-7.95,0.177995630538},{-7.85,0.171435304221},{-7.75,0.209975969299},{-7.65,0.196293438019},{-7.55,0.197062335836},{-7.45,0.233092793658},{-7.35,0.22887070702},{-7.25,0.233566347059},{-7.15,0.223731206036},{-7.05,0.242000404669},{-6.95,0.251371847877},{-6.85,0.249851738148},{-6.75,0.267602274012},{-6.65,0.278170295086},{-6.55,0.290379045697},{-6.45,0.291620660152},{-6.35,0.298361584149},{-6.25,0.324669374238},{-6.15,0.331675508097},{-6.05,0.335560335726},{-5.95,0.345415076763},{-5.85,0.352448238638},{-5.75,0.354689375655},{-5.65,0.388804406648},{-5.55,0.371911149324},{-5.45,0.382152266175},{-5.35,0.399575779331},{-5.25,0.39157896404},{-5.15,0.423738181479},{-5.05,0.449872765174},{-4.95,0.456726131745},{-4.85,0.488375504193},{-4.75,0.490951941148},{-4.65,0.492397011146},{-4.55,0.491878157812},{-4.45,0.49582676735},{-4.35,0.513921848698},{-4.25,0.502470666926},{-4.15,0.531113045585},{-4.05,0.527263482541},{-3.95,0.576451566484},{-3.85,0.563601962003},{-3.75,0.55674393391},{-3.65,0.58894439522},{-3.55,0.569845996774},{-3.45,0.59670254548},{-3.35,0.585302577044},{-3.25,0.630248828593},{-3.15,0.64085052466},{-3.05,0.692335945303},{-2.95,0.656692695618},{-2.85,0.662515882368},{-2.75,0.639818253056},{-2.65,0.647078379446},{-2.55,0.675107039267},{-2.45,0.716402263448},{-2.35,0.712425295948},{-2.25,0.736919331995},{-2.15,0.737728244399},{-2.05,0.717968741031},{-1.95,0.722153288282},{-1.85,0.767056199753},{-1.75,0.74559135269},{-1.65,0.778349882901},{-1.55,0.759673804568},{-1.45,0.785035092022},{-1.35,0.795039095443},{-1.25,0.820726021381},{-1.15,0.76579520584},{-1.05,0.797476319254},{-0.95,0.801041708278},{-0.85,0.80953090609},{-0.75,0.819420316242},{-0.65,0.822959933611},{-0.55,0.829680382985},{-0.45,0.81646988897},{-0.35,0.843548820132},{-0.25,0.837720032639},{-0.15,0.850693512533},{-0.05,0.875454861694},{0.05,0.907332744296},{0.15,0.906162986272},{0.25,0.865973445182},{0.35,0.878522707514},{0.45,0.886588061845},{0.55,0.865116185803},{0.65,0.875873524656},{0.75,0.871430050907},{0.85,0.875233779719},{0.95,0.910542822384},{1.05,0.864745249297},{1.15,0.959829348423},{1.25,0.862699787467},{1.35,0.901554659712},{1.45,0.884918899781},{1.55,0.917332057488},{1.65,0.91642940518},{1.75,0.919608352531},{1.85,0.862223899866},{1.95,0.850396399525},{2.05,0.893838892228},{2.15,0.891751285261},{2.25,0.881563829},{2.35,0.933255492375},{2.45,0.881528874589},{2.55,0.879882103423},{2.65,0.918422853868},{2.75,0.849234382806},{2.85,0.873838578473},{2.95,0.898130727369},{3.05,0.868017369061},{3.15,0.894807735603},{3.25,0.890610003495},{3.35,0.850816861851},{3.45,0.871204768679},{3.55,0.870001124836},{3.65,0.82315143786},{3.75,0.859895446646},{3.85,0.837739055457},{3.95,0.84073358188},{4.05,0.793727646526},{4.15,0.754040832202},{4.25,0.780325984323},{4.35,0.808261925066},{4.45,0.798195466541},{4.55,0.787711765455},{4.65,0.752777607028},{4.75,0.758391543763},{4.85,0.79541422526},{4.95,0.795859230598},{5.05,0.70945354892},{5.15,0.745703276119},{5.25,0.707111477047},{5.35,0.706713220232},{5.45,0.72617937516},{5.55,0.696781896594},{5.65,0.682634599932},{5.75,0.696133121563},{5.85,0.664827994637},{5.95,0.648670703125},{6.05,0.652800284776},{6.15,0.645501856565},{6.25,0.609775465362},{6.35,0.641256171966},{6.45,0.591153535912},{6.55,0.581910143998},{6.65,0.55761258429},{6.75,0.570428966286},{6.85,0.578070236465},{6.95,0.576846442043},{7.05,0.540645724029},{7.15,0.63793182373},{7.25,0.546909015935},{7.35,0.471863636928},{7.45,0.437519156056},{7.55,0.504417721389},{7.65,0.460387680131},{7.75,0.434190890155},{7.85,0.458932219252},{7.95,0.430008276504},{8.05,0.451711922048},{8.15,0.444960852011},{8.25,0.399501729456},{8.35,0.400646625179},{8.45,0.376499591487},{8.55,0.357263132731},{8.65,0.344891352196},{8.75,0.378610725862},{8.85,0.349343908115},{8.95,0.400469083052},{9.05,0.32816665585},{9.15,0.319401188901},{9.25,0.293247617524},{9.35,0.300548733405},{9.45,0.278138704389},{9.55,0.300923368205},{9.65,0.278884436495},{9.75,0.231064317329},{9.85,0.24739753807},{9.95,0.235463659191},{10.05,0.222975987026},{10.15,0.233751678467},{10.25,0.207521061838},{10.35,0.189850997925},{10.45,0.208221205583},{10.55,0.183283120994},{10.65,0.217474847777},{10.75,0.165645946156},{10.85,0.16794354679},{10.95,0.188990557635},{11.05,0.172963090376},{11.15,0.158091926575},{11.25,0.17322288021},{11.35,0.163651099572},{11.45,0.182983487447},{11.55,0.150079917908},{11.65,0.141351339294},{11.75,0.132179551008},{11.85,0.161781873859},{11.95,0.161613600595},{12.05,0.121588015902},{12.15,0.155872753688},{12.25,0.113115495251},{12.35,0.0931000847747},{12.45,0.112418945019},{12.55,0.0995316865309},{12.65,0.0876531254161},{12.75,0.0947021727866},{12.85,0.09754267553},{12.95,0.0833071578633},{13.05,0.0700905521711},{13.15,0.0866604804993},{13.25,0.0697145217504},{13.35,0.0824733893077},{13.45,0.0783778881205},{13.55,0.102124488354},{13.65,0.0615047931671},{13.75,0.0670475530624},{13.85,0.0569265462734},{13.95,0.0925216118495},{14.05,0.061288742792},{14.15,0.0552513241768},{14.25,0.057207920972},{14.35,0.043554240749},{14.45,0.0409165989785},{14.55,0.0586021634249},{14.65,0.040081567624},{14.75,0.0345765352249},{14.85,0.0540544450283},{14.95,0.0371910677506},{15.05,0.0269993878901},{15.15,0.021645354874},{15.25,0.023460441402},{15.35,0.0501019557317},{15.45,0.0513266742229},{15.55,0.0280332373721},{15.65,0.0186768963933},{15.75,0.0138940153023},{15.85,0.0161439643966},{15.95,0.0151001736522},{16.05,0.0248422212899},{16.15,0.00837563046},{16.25,0.0087678425014},{16.35,0.0167006533593},{16.45,0.00501019575379},{16.55,0.0197624390324},{16.65,0.00663387030363},{16.75,0.00592475544129},{16.85,0.00800239574164},{16.95,0.0084431078285},{17.05,0.00549729820341},{17.15,0.00619315868244},{17.25,0.0175356846303},{17.35,0.00621635404726},{17.45,0.0062627447769},{17.55,0.00519575861593},{17.65,0.0},{17.75,0.0},{17.85,0.00417516333982},{17.95,0.00250509784867},{18.05,0.00528853992},{18.15,0.00668026087806},{18.25,0.0},{18.35,0.00176284664},{18.45,0.00129893965398},{18.55,0.00389681896195},{18.65,0.0},{18.75,0.00417516333982},{18.85,0.000835032609757},{18.95,0.00111337681301},{19.05,0.000835032609757},{19.15,0.000185562802168},{19.25,0.000695860537235},{19.35,0.0},{19.45,0.000463907024823},{19.55,0.0},{19.65,0.000556688406505},{19.75,0.0},{19.85,0.0},{19.95,0.000139172101626},{20.05,0.0},{20.15,0.0},{20.25,0.0},{20.35,0.0},{20.45,0.000556688406505},{20.55,0.0},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.000556688406505},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU33 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.000278344203252},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.0},{-21.35,0.0},{-21.25,0.0},{-21.15,0.0},{-21.05,0.0},{-20.95,0.0},{-20.85,0.0},{-20.75,0.0},{-20.65,0.0},{-20.55,0.0},{-20.45,0.0},{-20.35,0.0},{-20.25,0.0},{-20.15,0.0},{-20.05,9.27814010841e-05},{-19.95,0.0},{-19.85,0.0},{-19.75,0.0},{-19.65,0.000278344203252},{-19.55,6.95860508131e-05},{-19.45,0.000111337681301},{-19.35,0.0},{-19.25,0.000139172101626},{-19.15,0.0},{-19.05,0.000167006521951},{-18.95,0.000445350725204},{-18.85,5.56688406505e-05},{-18.75,3.47930254065e-05},{-18.65,0.000139172101626},{-18.55,7.9526915215e-05},{-18.45,0.000231953512412},{-18.35,0.000208758152439},{-18.25,0.00334013043903},{-18.15,0.000334013043903},{-18.05,0.000480776356364},{-17.95,0.00222675362602},{-17.85,0.000432979884661},{-17.75,0.000417516333982},{-17.65,0.000556688423135},{-17.55,0.000994086465133},{-17.45,0.000626274500974},{-17.35,0.000501019569735},{-17.25,0.00161439646035},{-17.15,0.000708512538536},{-17.05,0.00103746481578},{-16.95,0.00128038339317},{-16.85,0.00115619900708},{-16.75,0.00143148457365},{-16.65,0.000974204740487},{-16.55,0.00164223089814},{-16.45,0.00323575153016},{-16.35,0.00140718463808},{-16.25,0.00191361643374},{-16.15,0.00146763314578},{-16.05,0.00293331965804},{-15.95,0.00237325069151},{-15.85,0.00194840940336},{-15.75,0.00284971456443},{-15.65,0.00307388830444},{-15.55,0.00382090698589},{-15.45,0.0029661054723},{-15.35,0.00403599097179},{-15.25,0.00442368483969},{-15.15,0.00343089485946},{-15.05,0.00493862160615},{-14.95,0.00450781860003},{-14.85,0.00672797730991},{-14.75,0.00476544478844},{-14.65,0.00532156380556},{-14.55,0.00679366069811},{-14.45,0.0102258360102},{-14.35,0.0089017630748},{-14.25,0.0104700246683},{-14.15,0.00913135151365},{-14.05,0.012847496014},{-13.95,0.0170222944683},{-13.85,0.0115924485972},{-13.75,0.0133968280709},{-13.65,0.0120928818921},{-13.55,0.0147269391394},{-13.45,0.015271592431},{-13.35,0.0133991040806},{-13.25,0.0175953308741},{-13.15,0.0216002250329},{-13.05,0.0170717780237},{-12.95,0.0193230918809},{-12.85,0.0220918817428},{-12.75,0.0213616981841},{-12.65,0.0224920841826},{-12.55,0.0212993829147},{-12.45,0.0254868352136},{-12.35,0.0290834623225},{-12.25,0.0273191878136},{-12.15,0.0294392191131},{-12.05,0.0294955069019},{-11.95,0.03281714728},{-11.85,0.0320925991438},{-11.75,0.0374338179827},{-11.65,0.0444993392841},{-11.55,0.0410984727469},{-11.45,0.0397859163235},{-11.35,0.0406853173666},{-11.25,0.05306296513},{-11.15,0.0483715639913},{-11.05,0.0530074312182},{-10.95,0.0548510415213},{-10.85,0.0531047724061},{-10.75,0.0606415923935},{-10.65,0.0608345841159},{-10.55,0.0552166553966},{-10.45,0.0630054972065},{-10.35,0.0696973874019},{-10.25,0.0668140502825},{-10.15,0.07672645597},{-10.05,0.0671396427844},{-9.95,0.0830954114596},{-9.85,0.0763070291548},{-9.75,0.0770143159678},{-9.65,0.0859351130257},{-9.55,0.0834789629336},{-9.45,0.100511900772},{-9.35,0.0867068824586},{-9.25,0.102109223213},{-9.15,0.0986442656528},{-9.05,0.1034280724},{-8.95,0.119911107586},{-8.85,0.105259834619},{-8.75,0.125041223061},{-8.65,0.126369476318},{-8.55,0.130614476224},{-8.45,0.145976818606},{-8.35,0.152168453633},{-8.25,0.151282867432},{-8.15,0.15108649175},{-8.05,0.164784583386},{-7.95,0.16614558923},{-7.85,0.166370306491},{-7.75,0.169937891676},{-7.65,0.176862626735},{-7.55,0.176115275158},{-7.45,0.209130233373},{-7.35,0.212761012987},{-7.25,0.214506985431},{-7.15,0.221056732877},{-7.05,0.231046780673},{-6.95,0.243622034246},{-6.85,0.234915968454},{-6.75,0.264219267078},{-6.65,0.251437226772},{-6.55,0.2528015646},{-6.45,0.270555308731},{-6.35,0.282010459156},{-6.25,0.30105939361},{-6.15,0.296359640575},{-6.05,0.30881771638},{-5.95,0.312823339255},{-5.85,0.328638786279},{-5.75,0.327482751734},{-5.65,0.343266533588},{-5.55,0.354667593257},{-5.45,0.377867535408},{-5.35,0.368106365731},{-5.25,0.391891358801},{-5.15,0.413432960949},{-5.05,0.396907595371},{-4.95,0.415632252027},{-4.85,0.421036745346},{-4.75,0.432884719609},{-4.65,0.445691471677},{-4.55,0.474429507731},{-4.45,0.479436639732},{-4.35,0.472816559206},{-4.25,0.473941836539},{-4.15,0.49295995925},{-4.05,0.507178385738},{-3.95,0.547527854801},{-3.85,0.529668629169},{-3.75,0.525351145225},{-3.65,0.539578555999},{-3.55,0.529227160025},{-3.45,0.554840851537},{-3.35,0.555912804322},{-3.25,0.561138686313},{-3.15,0.568075556103},{-3.05,0.577452911107},{-2.95,0.617178950549},{-2.85,0.591278288838},{-2.75,0.605975357873},{-2.65,0.618941912123},{-2.55,0.629477001053},{-2.45,0.639800113618},{-2.35,0.644108625367},{-2.25,0.665161078751},{-2.15,0.664285089415},{-2.05,0.655567308554},{-1.95,0.676039118255},{-1.85,0.668484461046},{-1.75,0.704507266774},{-1.65,0.678433908257},{-1.55,0.681720026512},{-1.45,0.693934922234},{-1.35,0.725500308455},{-1.25,0.723596546748},{-1.15,0.716161164844},{-1.05,0.751664624323},{-0.95,0.73969153281},{-0.85,0.745139567057},{-0.75,0.721087671602},{-0.65,0.744711471107},{-0.55,0.749802345153},{-0.45,0.768499929944},{-0.35,0.752416930484},{-0.25,0.753051860393},{-0.15,0.787503081179},{-0.05,0.759259831553},{0.05,0.820235318271},{0.15,0.799946976722},{0.25,0.762578758034},{0.35,0.844684123102},{0.45,0.804108373197},{0.55,0.788487285037},{0.65,0.779665783332},{0.75,0.824466312633},{0.85,0.835216361935},{0.95,0.832938399969},{1.05,0.801747897041},{1.15,0.828020874481},{1.25,0.826652756311},{1.35,0.774353351711},{1.45,0.834738821077},{1.55,0.855399979695},{1.65,0.808793338995},{1.75,0.837329883294},{1.85,0.785749878043},{1.95,0.810155953713},{2.05,0.788780539688},{2.15,0.813707476819},{2.25,0.844349011001},{2.35,0.787916241726},{2.45,0.834899321671},{2.55,0.815272529962},{2.65,0.803408440378},{2.75,0.818937724345},{2.85,0.769884310064},{2.95,0.765653864543},{3.05,0.799317756585},{3.15,0.830974663628},{3.25,0.802010011728},{3.35,0.77104820363},{3.45,0.819975243545},{3.55,0.783411383912},{3.65,0.777171501747},{3.75,0.801221028027},{3.85,0.76065760807},{3.95,0.726947417626},{4.05,0.767450196579},{4.15,0.778502841388},{4.25,0.764689348446},{4.35,0.721568137721},{4.45,0.73978965411},{4.55,0.733852149403},{4.65,0.785453594676},{4.75,0.700672302246},{4.85,0.697852518688},{4.95,0.698215081252},{5.05,0.668044360716},{5.15,0.671112486374},{5.25,0.648664397721},{5.35,0.651904090808},{5.45,0.635541918985},{5.55,0.62200394808},{5.65,0.615867395288},{5.75,0.604624570649},{5.85,0.629134648783},{5.95,0.597399823806},{6.05,0.631532615013},{6.15,0.612761390234},{6.25,0.549481247853},{6.35,0.590096908667},{6.45,0.549741939299},{6.55,0.543512048392},{6.65,0.563067634067},{6.75,0.552358394046},{6.85,0.511101317793},{6.95,0.514103122786},{7.05,0.490140279134},{7.15,0.464143706531},{7.25,0.505295522366},{7.35,0.440348359325},{7.45,0.434714418776},{7.55,0.446894884797},{7.65,0.39993967997},{7.75,0.387303939437},{7.85,0.395913641137},{7.95,0.401473233615},{8.05,0.43671068383},{8.15,0.437448192491},{8.25,0.388001480953},{8.35,0.354279914057},{8.45,0.38457775116},{8.55,0.365564928893},{8.65,0.371498420022},{8.75,0.336222698814},{8.85,0.367603224151},{8.95,0.325629119136},{9.05,0.320809359478},{9.15,0.299468703681},{9.25,0.286344449545},{9.35,0.276104054986},{9.45,0.257067173085},{9.55,0.243399349763},{9.65,0.251220566886},{9.75,0.209420535654},{9.85,0.265873176464},{9.95,0.207167376894},{10.05,0.244193517245},{10.15,0.235505709572},{10.25,0.217901875654},{10.35,0.234555608576},{10.45,0.185679142292},{10.55,0.216632091082},{10.65,0.179388046265},{10.75,0.173612236977},{10.85,0.193652737525},{10.95,0.16064171564},{11.05,0.219660624652},{11.15,0.153696880546},{11.25,0.166853439808},{11.35,0.147283849262},{11.45,0.135709365209},{11.55,0.140385691325},{11.65,0.138242990198},{11.75,0.118614924581},{11.85,0.174295663834},{11.95,0.14090402038},{12.05,0.129857884513},{12.15,0.129890179148},{12.25,0.106451749802},{12.35,0.117927178093},{12.45,0.10685392048},{12.55,0.0953299339781},{12.65,0.0791589138555},{12.75,0.0725836066099},{12.85,0.100105678334},{12.95,0.0664516531903},{13.05,0.0798847874006},{13.15,0.0957297925596},{13.25,0.0863897977052},{13.35,0.0786270830366},{13.45,0.0683136199202},{13.55,0.0510960442679},{13.65,0.0676255433456},{13.75,0.068817291941},{13.85,0.0476690221716},{13.95,0.0582156896591},{14.05,0.0358507355054},{14.15,0.0574698939043},{14.25,0.0421095036325},{14.35,0.0846784909566},{14.45,0.0357254803181},{14.55,0.0369870347135},{14.65,0.0275687277317},{14.75,0.0304168363412},{14.85,0.0400351757805},{14.95,0.03699447621},{15.05,0.0240489403407},{15.15,0.0231582383315},{15.25,0.023423735912},{15.35,0.0251066476107},{15.45,0.0410836040974},{15.55,0.0570605645577},{15.65,0.0281684339046},{15.75,0.0104486139921},{15.85,0.00961552695795},{15.95,0.0103915168179},{16.05,0.0110542412315},{16.15,0.012302814424},{16.25,0.0143347270787},{16.35,0.00795269172106},{16.45,0.0070049961408},{16.55,0.0148914149031},{16.65,0.0176748577505},{16.75,0.00288782129064},{16.85,0.00647150306031},{16.95,0.00478752031922},{17.05,0.0123863173649},{17.15,0.00709777744487},{17.25,0.0147522427142},{17.35,0.00612357258797},{17.45,0.00194840940336},{17.55,0.00380403765788},{17.65,0.00807198230177},{17.75,0.00208758166991},{17.85,0.00501019600779},{17.95,0.00306178629398},{18.05,0.00723694963381},{18.15,0.00306178629398},{18.25,0.000556688406505},{18.35,0.0},{18.45,0.0},{18.55,0.000835032609757},{18.65,0.00139172107447},{18.75,0.00139172107447},{18.85,0.00250509800389},{18.95,0.00139172107447},{19.05,0.0},{19.15,0.0},{19.25,0.0},{19.35,0.000278344203252},{19.45,0.0},{19.55,0.000417516304879},{19.65,0.000835032609757},{19.75,0.0},{19.85,0.0},{19.95,0.0},{20.05,0.0},{20.15,0.0},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.0},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU34 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.0},{-21.35,0.0},{-21.25,0.0},{-21.15,0.000139172101626},{-21.05,0.0},{-20.95,0.0},{-20.85,0.000278344203252},{-20.75,0.0},{-20.65,0.0},{-20.55,0.000371125604336},{-20.45,0.0},{-20.35,0.000278344203252},{-20.25,0.0},{-20.15,0.0},{-20.05,0.000208758152439},{-19.95,0.0},{-19.85,0.0},{-19.75,0.000556688406505},{-19.65,0.000278344203252},{-19.55,0.0},{-19.45,0.000185562802168},{-19.35,0.000139172101626},{-19.25,0.0},{-19.15,0.0},{-19.05,0.0},{-18.95,0.000111337681301},{-18.85,0.000278344203252},{-18.75,0.000556688406505},{-18.65,9.27814010841e-05},{-18.55,0.0},{-18.45,0.000397634592706},{-18.35,0.000278344203252},{-18.25,0.000501019600779},{-18.15,0.000334013043903},{-18.05,0.000649469826991},{-17.95,0.000208758152439},{-17.85,0.000765446573496},{-17.75,0.000417516304879},{-17.65,0.000755505702857},{-17.55,0.000556688423135},{-17.45,0.000354256269268},{-17.35,0.000397634592706},{-17.25,0.00088142332},{-17.15,0.00222675362602},{-17.05,0.00133605217561},{-16.95,0.00208758166991},{-16.85,0.000813621526154},{-16.75,0.000702487748294},{-16.65,0.00106698616097},{-16.55,0.00156884911385},{-16.45,0.00160047924146},{-16.35,0.00125254897608},{-16.25,0.00137780383229},{-16.15,0.00283911097795},{-16.05,0.00196387308339},{-15.95,0.00157408454809},{-15.85,0.00191045349294},{-15.75,0.00188417618091},{-15.65,0.00203747957945},{-15.55,0.00217520845709},{-15.45,0.00240941718221},{-15.35,0.00354353596385},{-15.25,0.00268352375581},{-15.15,0.00360210152233},{-15.05,0.00321993638169},{-14.95,0.00728148460388},{-14.85,0.00550670156608},{-14.75,0.00562514226104},{-14.65,0.00594179666772},{-14.55,0.00819789937564},{-14.45,0.00812765094969},{-14.35,0.00981494713397},{-14.25,0.00944593675593},{-14.15,0.0104057914936},{-14.05,0.0119473899786},{-13.95,0.0129193731074},{-13.85,0.0131024208936},{-13.75,0.0123800857743},{-13.65,0.0140084712232},{-13.55,0.0132270692146},{-13.45,0.0148124259871},{-13.35,0.0156129128055},{-13.25,0.0164367672685},{-13.15,0.0159446949309},{-13.05,0.0202902091014},{-12.95,0.0175098598618},{-12.85,0.0228441073781},{-12.75,0.0193257703694},{-12.65,0.0223576681955},{-12.55,0.0227559046312},{-12.45,0.0268816283116},{-12.35,0.0325754474808},{-12.25,0.0331202049067},{-12.15,0.0281662063599},{-12.05,0.0256684979066},{-11.95,0.0298161540233},{-11.85,0.0394640650068},{-11.75,0.0337087562661},{-11.65,0.0382952069583},{-11.55,0.0330564016881},{-11.45,0.0394841432571},{-11.35,0.0413493999856},{-11.25,0.041500224862},{-11.15,0.0487409857816},{-11.05,0.0547744064796},{-10.95,0.0514122475969},{-10.85,0.0501602763221},{-10.75,0.0499259623711},{-10.65,0.0582009658073},{-10.55,0.0461861143867},{-10.45,0.0548636307792},{-10.35,0.05742380886},{-10.25,0.0548098980356},{-10.15,0.0675595324972},{-10.05,0.0697109381962},{-9.95,0.0806132971995},{-9.85,0.0683743819939},{-9.75,0.0764487074504},{-9.65,0.0784930680927},{-9.55,0.0732100949969},{-9.45,0.0823873652432},{-9.35,0.0865658703972},{-9.25,0.100656892084},{-9.15,0.0895402279306},{-9.05,0.100282775031},{-8.95,0.106934291174},{-8.85,0.110613835721},{-8.75,0.114293918362},{-8.65,0.134440253122},{-8.55,0.125754236576},{-8.45,0.122963169892},{-8.35,0.123158277371},{-8.25,0.137270923114},{-8.15,0.13948591327},{-8.05,0.142952028778},{-7.95,0.154983472016},{-7.85,0.155058276392},{-7.75,0.160994395614},{-7.65,0.156905827129},{-7.55,0.176634056455},{-7.45,0.177773860221},{-7.35,0.180411589249},{-7.25,0.205727652218},{-7.15,0.212459214878},{-7.05,0.214014524336},{-6.95,0.222857565872},{-6.85,0.213512324687},{-6.75,0.22521608663},{-6.65,0.219255079303},{-6.55,0.265300525582},{-6.45,0.263650317383},{-6.35,0.263044592452},{-6.25,0.250930004173},{-6.15,0.253247147727},{-6.05,0.286139868587},{-5.95,0.284184871308},{-5.85,0.296143787155},{-5.75,0.29613671859},{-5.65,0.317559974855},{-5.55,0.317537676345},{-5.45,0.331718345741},{-5.35,0.349827628022},{-5.25,0.329224946967},{-5.15,0.364862099423},{-5.05,0.352505286817},{-4.95,0.35406184389},{-4.85,0.390108300661},{-4.75,0.365037909614},{-4.65,0.385793928667},{-4.55,0.392828252818},{-4.45,0.424421677567},{-4.35,0.445966604363},{-4.25,0.412975122595},{-4.15,0.444041905778},{-4.05,0.45439226462},{-3.95,0.464064604427},{-3.85,0.463573579397},{-3.75,0.456762841239},{-3.65,0.494887149949},{-3.55,0.507958265128},{-3.45,0.470891250808},{-3.35,0.487777709961},{-3.25,0.480310551387},{-3.15,0.52488946419},{-3.05,0.547600011856},{-2.95,0.566183069612},{-2.85,0.552977568854},{-2.75,0.569143520503},{-2.65,0.528331018381},{-2.55,0.574033655606},{-2.45,0.559294879436},{-2.35,0.558729526864},{-2.25,0.589440358125},{-2.15,0.587761194566},{-2.05,0.588014940555},{-1.95,0.610753100029},{-1.85,0.6109939276},{-1.75,0.62237627233},{-1.65,0.632924024019},{-1.55,0.653146977603},{-1.45,0.63489935505},{-1.35,0.624873752376},{-1.25,0.622157489237},{-1.15,0.652824282646},{-1.05,0.6461791407},{-0.95,0.62169773559},{-0.85,0.633322256583},{-0.75,0.676339260019},{-0.65,0.683893075574},{-0.55,0.670200087223},{-0.45,0.673771504151},{-0.35,0.678732799076},{-0.25,0.674671370786},{-0.15,0.689686038023},{-0.05,0.701025644938},{0.05,0.666122005484},{0.15,0.702607017797},{0.25,0.710568170031},{0.35,0.700297781601},{0.45,0.703958460212},{0.55,0.727533103261},{0.65,0.68426005538},{0.75,0.731165209252},{0.85,0.718721167442},{0.95,0.733408151996},{1.05,0.735975563275},{1.15,0.695345647349},{1.25,0.719482676188},{1.35,0.710425928189},{1.45,0.741659191351},{1.55,0.729978959278},{1.65,0.741075975273},{1.75,0.745554924011},{1.85,0.742475246929},{1.95,0.713889942998},{2.05,0.717962808167},{2.15,0.705281776294},{2.25,0.719568836622},{2.35,0.721018648093},{2.45,0.737725417385},{2.55,0.702377196986},{2.65,0.704781830935},{2.75,0.710594222605},{2.85,0.752041555731},{2.95,0.714051722892},{3.05,0.724945572462},{3.15,0.711163825795},{3.25,0.720502147799},{3.35,0.705965800578},{3.45,0.703309400644},{3.55,0.719993464855},{3.65,0.718374303289},{3.75,0.71134247651},{3.85,0.703737459251},{3.95,0.734463697562},{4.05,0.661045835244},{4.15,0.683105423065},{4.25,0.689401301806},{4.35,0.635712518874},{4.45,0.606675700568},{4.55,0.641672722647},{4.65,0.657271088147},{4.75,0.624124101421},{4.85,0.616428891753},{4.95,0.626036504023},{5.05,0.624560439796},{5.15,0.599723151337},{5.25,0.581133138447},{5.35,0.622334660711},{5.45,0.549838175816},{5.55,0.589420034371},{5.65,0.577814292148},{5.75,0.568352862102},{5.85,0.534541841537},{5.95,0.562307938285},{6.05,0.56340071633},{6.15,0.532630818685},{6.25,0.56752397509},{6.35,0.497352720652},{6.45,0.49192742636},{6.55,0.518278346918},{6.65,0.463964411967},{6.75,0.480346204089},{6.85,0.476988673855},{6.95,0.468311405448},{7.05,0.430694251932},{7.15,0.467829386393},{7.25,0.404148059421},{7.35,0.442256062176},{7.45,0.416781131805},{7.55,0.425112363015},{7.65,0.363125643116},{7.75,0.449440952286},{7.85,0.392484933359},{7.95,0.428064851679},{8.05,0.349320950103},{8.15,0.319948175902},{8.25,0.319255524262},{8.35,0.31545935399},{8.45,0.355702596418},{8.55,0.297032178459},{8.65,0.310886850897},{8.75,0.320495328755},{8.85,0.272659157807},{8.95,0.264263504917},{9.05,0.29490167695},{9.15,0.220833919666},{9.25,0.278332111998},{9.35,0.242576180166},{9.45,0.213795578998},{9.55,0.234888817854},{9.65,0.233959746687},{9.75,0.217941621534},{9.85,0.198919614156},{9.95,0.222270095825},{10.05,0.178483910396},{10.15,0.163179294483},{10.25,0.184592403349},{10.35,0.195165687137},{10.45,0.191000873603},{10.55,0.146124023438},{10.65,0.175807362979},{10.75,0.159505147934},{10.85,0.171306467604},{10.95,0.191040780809},{11.05,0.154275587627},{11.15,0.154922051863},{11.25,0.154763248232},{11.35,0.153110091366},{11.45,0.143262920958},{11.55,0.117007117522},{11.65,0.125409052922},{11.75,0.134793153831},{11.85,0.115494290988},{11.95,0.115214620318},{12.05,0.116457032222},{12.15,0.098361786929},{12.25,0.112254955552},{12.35,0.103999517181},{12.45,0.109780466234},{12.55,0.0931200563908},{12.65,0.0811108293987},{12.75,0.112490824291},{12.85,0.089304998517},{12.95,0.0783948267207},{13.05,0.0944477558136},{13.15,0.104365825653},{13.25,0.0736787451638},{13.35,0.0575543988136},{13.45,0.0630021416224},{13.55,0.0465283778406},{13.65,0.0503906099885},{13.75,0.0340454748699},{13.85,0.0585255309155},{13.95,0.0404155778885},{14.05,0.0672400082861},{14.15,0.0548338095347},{14.25,0.0477708242834},{14.35,0.0364484410537},{14.45,0.0314250618219},{14.55,0.0257407893305},{14.65,0.0281282299095},{14.75,0.0272122393636},{14.85,0.0305979805333},{14.95,0.0454048998654},{15.05,0.0197788126328},{15.15,0.0182489417493},{15.25,0.0465948194265},{15.35,0.052676640451},{15.45,0.0364630907774},{15.55,0.021233686379},{15.65,0.01638751477},{15.75,0.0185377240181},{15.85,0.0278344204028},{15.95,0.0106566069382},{16.05,0.0103915172319},{16.15,0.00468124347654},{16.25,0.00793281011283},{16.35,0.00648144366486},{16.45,0.0119688014189},{16.55,0.010113172854},{16.65,0.0133605217561},{16.75,0.0100203920156},{16.85,0.00853588928779},{16.95,0.0108554242179},{17.05,0.00807198230177},{17.15,0.00389681880673},{17.25,0.00584522821009},{17.35,0.0119688007981},{17.45,0.00556688429788},{17.55,0.00161439646035},{17.65,0.00640191696584},{17.75,0.00264426996},{17.85,0.00222675362602},{17.95,0.00334013043903},{18.05,0.0},{18.15,0.00501019600779},{18.25,0.00111337681301},{18.35,0.00153089314699},{18.45,0.0},{18.55,0.000974204740487},{18.65,0.000556688406505},{18.75,0.0},{18.85,0.0},{18.95,0.00111337681301},{19.05,0.0},{19.15,0.000835032609757},{19.25,0.00194840948097},{19.35,0.0},{19.45,0.0},{19.55,0.000278344203252},{19.65,0.0},{19.75,0.0},{19.85,0.0},{19.95,0.0},{20.05,0.0},{20.15,0.0},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.000278344203252},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU35 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.0},{-21.35,0.0},{-21.25,0.0},{-21.15,0.0},{-21.05,0.0},{-20.95,0.0},{-20.85,0.0},{-20.75,0.0},{-20.65,0.0},{-20.55,0.0},{-20.45,0.0},{-20.35,0.0},{-20.25,0.000278344203252},{-20.15,0.0},{-20.05,0.000139172101626},{-19.95,0.0},{-19.85,0.0},{-19.75,0.0},{-19.65,0.0},{-19.55,0.0},{-19.45,0.0},{-19.35,0.00111337681301},{-19.25,0.0},{-19.15,0.000139172101626},{-19.05,6.95860508131e-05},{-18.95,6.95860508131e-05},{-18.85,0.000417516304879},{-18.75,0.000139172101626},{-18.65,9.27814010841e-05},{-18.55,0.000111337681301},{-18.45,0.000347930268617},{-18.35,0.000278344211568},{-18.25,0.000167006521951},{-18.15,0.00031810766086},{-18.05,0.000445350725204},{-17.95,0.000198817296353},{-17.85,0.00102059543133},{-17.75,0.000417516304879},{-17.65,0.00021648994233},{-17.55,0.00501019600779},{-17.45,0.000371125604336},{-17.35,0.000521895417478},{-17.25,0.000556688429788},{-17.15,0.00114816986024},{-17.05,0.000487102370244},{-16.95,0.000556688406505},{-16.85,0.00104379083496},{-16.75,0.000835032625632},{-16.65,0.00114121129736},{-16.55,0.000920676984466},{-16.45,0.00130821783096},{-16.35,0.00115619900708},{-16.25,0.00103384992551},{-16.15,0.00117197564166},{-16.05,0.00170982868544},{-15.95,0.00134111297402},{-15.85,0.00168471489298},{-15.75,0.0017910844282},{-15.65,0.00173429858226},{-15.55,0.00210746324488},{-15.45,0.00207598383228},{-15.35,0.00305108066935},{-15.25,0.00248822863355},{-15.15,0.00535039438142},{-15.05,0.0053611514361},{-14.95,0.00425469023841},{-14.85,0.0059380100833},{-14.75,0.00643670978025},{-14.65,0.00692099091169},{-14.55,0.00742251215837},{-14.45,0.0100290896371},{-14.35,0.00760807531575},{-14.25,0.0120006118502},{-14.15,0.0107069737381},{-14.05,0.0105661644655},{-13.95,0.00988350051348},{-13.85,0.0134434332239},{-13.75,0.01231673147},{-13.65,0.0135860771968},{-13.55,0.0132986676125},{-13.45,0.0137183930193},{-13.35,0.0144197758701},{-13.25,0.0162246434585},{-13.15,0.0166625225381},{-13.05,0.0174722656419},{-12.95,0.0165415989174},{-12.85,0.0203817546368},{-12.75,0.0173686788196},{-12.65,0.0220048293639},{-12.55,0.0206368599298},{-12.45,0.0237682996337},{-12.35,0.028031956765},{-12.25,0.0257532224743},{-12.15,0.0280242009596},{-12.05,0.0341194343567},{-11.95,0.0267767129121},{-11.85,0.0337504148483},{-11.75,0.03128346844},{-11.65,0.0323901760335},{-11.55,0.0303902766284},{-11.45,0.0398999511773},{-11.35,0.0345862552098},{-11.25,0.0364349450958},{-11.15,0.0417082952168},{-11.05,0.0415055817662},{-10.95,0.0402989790807},{-10.85,0.0481520016988},{-10.75,0.0426330566406},{-10.65,0.0496028561897},{-10.55,0.0507180091894},{-10.45,0.0529187505696},{-10.35,0.0605364035611},{-10.25,0.0553232694076},{-10.15,0.061617986891},{-10.05,0.0578143680142},{-9.95,0.0653219105767},{-9.85,0.0698019144486},{-9.75,0.0689334219152},{-9.65,0.0712530472699},{-9.55,0.0709100945355},{-9.45,0.0849196067223},{-9.35,0.0804452034941},{-9.25,0.0940495311554},{-9.15,0.0799704331618},{-9.05,0.0897247702987},{-8.95,0.0836759251069},{-8.85,0.0972690245684},{-8.75,0.102216495217},{-8.65,0.110253433849},{-8.55,0.102631110271},{-8.45,0.108807284423},{-8.35,0.120408038089},{-8.25,0.121235821442},{-8.15,0.136437737314},{-8.05,0.136543378049},{-7.95,0.124633512517},{-7.85,0.150612524},{-7.75,0.139022088302},{-7.65,0.153585705246},{-7.55,0.159821165019},{-7.45,0.148965716587},{-7.35,0.179554215793},{-7.25,0.177083148378},{-7.15,0.183041459932},{-7.05,0.197224263222},{-6.95,0.191107008192},{-6.85,0.200736688685},{-6.75,0.205836301274},{-6.65,0.219685083792},{-6.55,0.21511201777},{-6.45,0.231846016897},{-6.35,0.229271605636},{-6.25,0.235286669086},{-6.15,0.241473383797},{-6.05,0.262121181551},{-5.95,0.248365609043},{-5.85,0.259670338242},{-5.75,0.282588844958},{-5.65,0.287133212463},{-5.55,0.303598841341},{-5.45,0.308284038451},{-5.35,0.293713101474},{-5.25,0.313989858518},{-5.15,0.305360492907},{-5.05,0.332714372586},{-4.95,0.35268474075},{-4.85,0.353423943499},{-4.75,0.346890091737},{-4.65,0.356416418197},{-4.55,0.369902297994},{-4.45,0.354405910815},{-4.35,0.39766998291},{-4.25,0.377845669031},{-4.15,0.386096524188},{-4.05,0.406591587479},{-3.95,0.391822160993},{-3.85,0.424659671351},{-3.75,0.407399531388},{-3.65,0.426282809331},{-3.55,0.438597527103},{-3.45,0.438301878155},{-3.35,0.446047255572},{-3.25,0.447416980924},{-3.15,0.480072576349},{-3.05,0.480739162595},{-2.95,0.476362459921},{-2.85,0.497529707159},{-2.75,0.488699836644},{-2.65,0.467610491334},{-2.55,0.515473303394},{-2.45,0.502016822764},{-2.35,0.497614659377},{-2.25,0.536384449911},{-2.15,0.521651984321},{-2.05,0.523778806174},{-1.95,0.568192013582},{-1.85,0.529614675317},{-1.75,0.561657194658},{-1.65,0.559226921321},{-1.55,0.562849846439},{-1.45,0.585442440968},{-1.35,0.574587145641},{-1.25,0.565626688772},{-1.15,0.565284588788},{-1.05,0.605212976957},{-0.95,0.582031183075},{-0.85,0.60943937193},{-0.75,0.604649027278},{-0.65,0.582504288886},{-0.55,0.599497600585},{-0.45,0.619353417637},{-0.35,0.605568766726},{-0.25,0.618584916398},{-0.15,0.595417084565},{-0.05,0.6475850853},{0.05,0.625924365013},{0.15,0.626316053296},{0.25,0.653770762042},{0.35,0.667274567018},{0.45,0.666839048751},{0.55,0.645192179647},{0.65,0.660004354862},{0.75,0.638936737874},{0.85,0.629453116601},{0.95,0.680177828392},{1.05,0.641162482328},{1.15,0.626219015517},{1.25,0.615320783541},{1.35,0.666854366179},{1.45,0.651428669255},{1.55,0.631580230022},{1.65,0.668283982271},{1.75,0.644536066584},{1.85,0.635190327962},{1.95,0.710232139292},{2.05,0.656776467549},{2.15,0.615169208806},{2.25,0.663500806119},{2.35,0.652029047567},{2.45,0.640776584023},{2.55,0.674778102159},{2.65,0.605134145166},{2.75,0.646437502698},{2.85,0.639549022896},{2.95,0.650402412906},{3.05,0.633203142266},{3.15,0.622843898622},{3.25,0.661117623599},{3.35,0.641438986201},{3.45,0.604006111277},{3.55,0.643885438547},{3.65,0.62933014777},{3.75,0.644872446529},{3.85,0.593530217011},{3.95,0.606339901542},{4.05,0.634674124792},{4.15,0.606777249058},{4.25,0.600535492204},{4.35,0.583652736787},{4.45,0.576965173636},{4.55,0.564528387589},{4.65,0.598125955333},{4.75,0.587181440747},{4.85,0.619579244104},{4.95,0.555189201982},{5.05,0.592943022523},{5.15,0.524824993427},{5.25,0.543511159135},{5.35,0.554928787895},{5.45,0.517112779917},{5.55,0.516245986476},{5.65,0.579631853464},{5.75,0.47793375651},{5.85,0.49343692762},{5.95,0.492936275792},{6.05,0.505177738102},{6.15,0.491685729666},{6.25,0.496885883776},{6.35,0.444031416768},{6.45,0.472365775805},{6.55,0.461644199916},{6.65,0.415671459105},{6.75,0.428141128185},{6.85,0.412760059736},{6.95,0.425131716563},{7.05,0.38155687423},{7.15,0.418143546745},{7.25,0.406437837288},{7.35,0.405071384304},{7.45,0.398494026878},{7.55,0.400840269035},{7.65,0.379454406738},{7.75,0.365899938467},{7.85,0.339388427734},{7.95,0.352776878758},{8.05,0.327065306825},{8.15,0.281217499981},{8.25,0.320160490642},{8.35,0.398093104362},{8.45,0.296202329126},{8.55,0.284223010193},{8.65,0.252394870559},{8.75,0.25970095396},{8.85,0.247169655248},{8.95,0.299933868201},{9.05,0.284158941818},{9.15,0.225562383962},{9.25,0.245418729009},{9.35,0.235871579912},{9.45,0.230358068494},{9.55,0.233381751954},{9.65,0.258813716747},{9.75,0.181662720694},{9.85,0.174297940904},{9.95,0.210025020849},{10.05,0.184500331372},{10.15,0.182709782212},{10.25,0.173223745043},{10.35,0.169069551954},{10.45,0.164068133561},{10.55,0.155077894938},{10.65,0.148416681493},{10.75,0.188462884086},{10.85,0.11688048106},{10.95,0.147905609824},{11.05,0.131799459457},{11.15,0.147783900752},{11.25,0.148092592916},{11.35,0.176696379979},{11.45,0.114371640342},{11.55,0.115137304579},{11.65,0.158947489982},{11.75,0.130897164345},{11.85,0.14067648706},{11.95,0.11797558743},{12.05,0.12002599807},{12.15,0.113724482059},{12.25,0.0899596421615},{12.35,0.112336446257},{12.45,0.130564053853},{12.55,0.109024549353},{12.65,0.0864831840291},{12.75,0.0885969638824},{12.85,0.0696178640638},{12.95,0.0639291160247},{13.05,0.066533545653},{13.15,0.0628594001134},{13.25,0.120682094778},{13.35,0.0528086136127},{13.45,0.065980831782},{13.55,0.0593535900116},{13.65,0.0677031348733},{13.75,0.0551707493631},{13.85,0.0516019231743},{13.95,0.0562081336975},{14.05,0.0297828294613},{14.15,0.0451613478363},{14.25,0.0506586478307},{14.35,0.0283531546593},{14.45,0.0303704473707},{14.55,0.0277880297767},{14.65,0.0561211518943},{14.75,0.0331925476591},{14.85,0.0373537927866},{14.95,0.0235736140838},{15.05,0.0554461658001},{15.15,0.0149957947433},{15.25,0.0195600065318},{15.35,0.05891619126},{15.45,0.0265354812145},{15.55,0.0201335648696},{15.65,0.0173501223326},{15.75,0.0135195755533},{15.85,0.00734828710556},{15.95,0.00867506116629},{16.05,0.00594960758463},{16.15,0.00719718581864},{16.25,0.00473185173339},{16.35,0.0372981242836},{16.45,0.00497043239219},{16.55,0.00595656596124},{16.65,0.0062627447769},{16.75,0.0101595632732},{16.85,0.00510297715664},{16.95,0.00723694963381},{17.05,0.00681943306699},{17.15,0.0086286701262},{17.25,0.00807198230177},{17.35,0.0},{17.45,0.00334013043903},{17.55,0.00204119086266},{17.65,0.00556688429788},{17.75,0.0},{17.85,0.00306178629398},{17.95,0.00102059543133},{18.05,0.0036184748169},{18.15,0.00167006521951},{18.25,0.00111337681301},{18.35,0.000835032609757},{18.45,0.0},{18.55,0.0},{18.65,0.0},{18.75,0.00111337681301},{18.85,0.00111337681301},{18.95,0.0},{19.05,0.0},{19.15,0.0},{19.25,0.000556688406505},{19.35,0.0},{19.45,0.0},{19.55,0.0},{19.65,0.0},{19.75,0.0},{19.85,0.000278344203252},{19.95,0.0},{20.05,0.0},{20.15,0.0},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.0},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.000278344203252},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU36 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.0},{-21.35,0.0},{-21.25,0.0},{-21.15,0.0},{-21.05,0.0},{-20.95,0.0},{-20.85,0.0},{-20.75,0.0},{-20.65,0.0},{-20.55,0.0},{-20.45,0.0},{-20.35,0.0},{-20.25,0.0},{-20.15,0.0},{-20.05,0.0},{-19.95,0.0},{-19.85,0.0},{-19.75,0.0},{-19.65,0.000556688406505},{-19.55,0.0},{-19.45,0.0},{-19.35,0.0},{-19.25,0.0},{-19.15,0.000835032609757},{-19.05,0.000139172101626},{-18.95,0.0},{-18.85,0.0},{-18.75,0.000556688406505},{-18.65,0.00111337681301},{-18.55,0.000139172101626},{-18.45,7.9526915215e-05},{-18.35,4.63907005421e-05},{-18.25,0.000185562802168},{-18.15,0.000111337681301},{-18.05,0.000139172101626},{-17.95,0.000208758152439},{-17.85,0.000835032667965},{-17.75,0.00077936379239},{-17.65,0.000139172101626},{-17.55,0.000835032667965},{-17.45,0.000510297715664},{-17.35,0.000494834139115},{-17.25,0.000603079136151},{-17.15,0.00144738992676},{-17.05,0.00066106749},{-16.95,0.000430168329992},{-16.85,0.000711324107316},{-16.75,0.001057707984},{-16.65,0.000961552712728},{-16.55,0.00103746481578},{-16.45,0.000910944728689},{-16.35,0.00206769989537},{-16.25,0.00107858376577},{-16.15,0.00253602510525},{-16.05,0.00133605226874},{-15.95,0.00173965127518},{-15.85,0.00182663393207},{-15.75,0.00193203635076},{-15.65,0.00221129010121},{-15.55,0.00246334634721},{-15.45,0.00301539566782},{-15.35,0.00181851548453},{-15.25,0.00247169658542},{-15.15,0.00367149284908},{-15.05,0.00449146330357},{-14.95,0.00435409881175},{-14.85,0.00422928565078},{-14.75,0.00723694952635},{-14.65,0.00801845410695},{-14.55,0.00691346864443},{-14.45,0.0100875784611},{-14.35,0.00845738175588},{-14.25,0.00939411737702},{-14.15,0.0106199024579},{-14.05,0.0124489448965},{-13.95,0.0105436789989},{-13.85,0.011855191114},{-13.75,0.0124586868286},{-13.65,0.0150779650566},{-13.55,0.0127894364554},{-13.45,0.0187789559364},{-13.35,0.015894919111},{-13.25,0.0145195971674},{-13.15,0.0173561092346},{-13.05,0.0167586406072},{-12.95,0.0182099846047},{-12.85,0.0177861943841},{-12.75,0.0203940654412},{-12.65,0.0227912633043},{-12.55,0.0265540378434},{-12.45,0.0272008211989},{-12.35,0.0258180429769},{-12.25,0.0250165437915},{-12.15,0.0318586740149},{-12.05,0.0315981196321},{-11.95,0.0292027308562},{-11.85,0.0290256395178},{-11.75,0.0346704535528},{-11.65,0.03720703125},{-11.55,0.0387972781533},{-11.45,0.0417858132145},{-11.35,0.043133996114},{-11.25,0.0457899411519},{-11.15,0.0380487565071},{-11.05,0.0433492497222},{-10.95,0.0488593510219},{-10.85,0.0433073781786},{-10.75,0.0574531519591},{-10.65,0.0525753467898},{-10.55,0.0544815828771},{-10.45,0.0589933156967},{-10.35,0.0529908782557},{-10.25,0.0622422972391},{-10.15,0.0581682604186},{-10.05,0.0572422054452},{-9.95,0.064455378708},{-9.85,0.0600606296373},{-9.75,0.0673618535383},{-9.65,0.0731596309468},{-9.55,0.0721679309319},{-9.45,0.0748653491008},{-9.35,0.0698957755349},{-9.25,0.0898786685167},{-9.15,0.081372702823},{-9.05,0.0943955724019},{-8.95,0.088532078434},{-8.85,0.105156258976},{-8.75,0.100001924568},{-8.65,0.111051211392},{-8.55,0.112172722816},{-8.45,0.113935874787},{-8.35,0.117300811087},{-8.25,0.135393195682},{-8.15,0.128947479437},{-8.05,0.127270490274},{-7.95,0.127241880997},{-7.85,0.139106973632},{-7.75,0.149797417901},{-7.65,0.139111865219},{-7.55,0.158419642308},{-7.45,0.157080313317},{-7.35,0.161686762368},{-7.25,0.164615774379},{-7.15,0.166425847683},{-7.05,0.164260671109},{-6.95,0.184056211322},{-6.85,0.183803924365},{-6.75,0.203679785568},{-6.65,0.193202569233},{-6.55,0.214970890062},{-6.45,0.222988797049},{-6.35,0.231053358405},{-6.25,0.213291999348},{-6.15,0.234024839159},{-6.05,0.259481037481},{-5.95,0.250815435556},{-5.85,0.242655626593},{-5.75,0.249003110326},{-5.65,0.278013958545},{-5.55,0.271233656381},{-5.45,0.287285827087},{-5.35,0.282669691252},{-5.25,0.301040942852},{-5.15,0.307577047971},{-5.05,0.307144519895},{-4.95,0.330551515777},{-4.85,0.314377412342},{-4.75,0.337721091292},{-4.65,0.335113186306},{-4.55,0.356856899574},{-4.45,0.339036303822},{-4.35,0.34702543883},{-4.25,0.370081354263},{-4.15,0.354992145041},{-4.05,0.365550906159},{-3.95,0.401845343759},{-3.85,0.388098090756},{-3.75,0.413696848163},{-3.65,0.390669596011},{-3.55,0.421520923648},{-3.45,0.427887501436},{-3.35,0.43391545428},{-3.25,0.44380277221},{-3.15,0.432953734498},{-3.05,0.44549246332},{-2.95,0.427728174217},{-2.85,0.466626054701},{-2.75,0.460113357018},{-2.65,0.491902477336},{-2.55,0.47407147645},{-2.45,0.49853108146},{-2.35,0.504517811891},{-2.25,0.480461323515},{-2.15,0.504673404588},{-2.05,0.492179840209},{-1.95,0.516162201598},{-1.85,0.523524759227},{-1.75,0.509405315475},{-1.65,0.552889650518},{-1.55,0.512170386283},{-1.45,0.519992573389},{-1.35,0.561194540072},{-1.25,0.541385067692},{-1.15,0.545391445339},{-1.05,0.52903657107},{-0.95,0.574783113268},{-0.85,0.542444221666},{-0.75,0.557924641927},{-0.65,0.538889683983},{-0.55,0.578406870691},{-0.45,0.533087487502},{-0.35,0.59865077158},{-0.25,0.568235805152},{-0.15,0.593422126242},{-0.05,0.574824035726},{0.05,0.565322555582},{0.15,0.605160188139},{0.25,0.587001790143},{0.35,0.556911024936},{0.45,0.546786161663},{0.55,0.637670898438},{0.65,0.585485481793},{0.75,0.595976723565},{0.85,0.648743046253},{0.95,0.601473960285},{1.05,0.58461244103},{1.15,0.605426924764},{1.25,0.621628957098},{1.35,0.591847593747},{1.45,0.630776052764},{1.55,0.613980161488},{1.65,0.561075387757},{1.75,0.612343453072},{1.85,0.631521272659},{1.95,0.597397191692},{2.05,0.615888417878},{2.15,0.596221321812},{2.25,0.607266716206},{2.35,0.585817566382},{2.45,0.640983079778},{2.55,0.604841984796},{2.65,0.579487402115},{2.75,0.635278118981},{2.85,0.568497689315},{2.95,0.589951017766},{3.05,0.587746961578},{3.15,0.589173199379},{3.25,0.619298522726},{3.35,0.556994260855},{3.45,0.592985842059},{3.55,0.62648922205},{3.65,0.611176840773},{3.75,0.607364624504},{3.85,0.555568407034},{3.95,0.587622822635},{4.05,0.589648089438},{4.15,0.537195357986},{4.25,0.575263101024},{4.35,0.524755752504},{4.45,0.578884847364},{4.55,0.54082219646},{4.65,0.555057415187},{4.75,0.513894342313},{4.85,0.515279089596},{4.95,0.534792891173},{5.05,0.523043578526},{5.15,0.512979779925},{5.25,0.531829638859},{5.35,0.490519688367},{5.45,0.537531099267},{5.55,0.549659217412},{5.65,0.51824686744},{5.75,0.523278808594},{5.85,0.50144448365},{5.95,0.428364430826},{6.05,0.4840037654},{6.15,0.45649204484},{6.25,0.43382978297},{6.35,0.415526480902},{6.45,0.420501085197},{6.55,0.453561412151},{6.65,0.403085457651},{6.75,0.455067883206},{6.85,0.378821757688},{6.95,0.43382886561},{7.05,0.407116650585},{7.15,0.368010956386},{7.25,0.378769668268},{7.35,0.375634953127},{7.45,0.354195928775},{7.55,0.342206897654},{7.65,0.340609301318},{7.75,0.355262303116},{7.85,0.335134647163},{7.95,0.334940870603},{8.05,0.324463479062},{8.15,0.354560687218},{8.25,0.300267277502},{8.35,0.309953046132},{8.45,0.268219633475},{8.55,0.289986798718},{8.65,0.283236421497},{8.75,0.272103238268},{8.85,0.294331610203},{8.95,0.260681629181},{9.05,0.204395718045},{9.15,0.275718418898},{9.25,0.234559555054},{9.35,0.213861852884},{9.45,0.241161616343},{9.55,0.193556970166},{9.65,0.195298402206},{9.75,0.185948717911},{9.85,0.207252161126},{9.95,0.162776691573},{10.05,0.202439081101},{10.15,0.169570841688},{10.25,0.163270058839},{10.35,0.148905267107},{10.45,0.174440167745},{10.55,0.180972856634},{10.65,0.168033950469},{10.75,0.170377579946},{10.85,0.138669543796},{10.95,0.163460040915},{11.05,0.153855976306},{11.15,0.146859463778},{11.25,0.169029161665},{11.35,0.11043741554},{11.45,0.121023027985},{11.55,0.102203353246},{11.65,0.131223113038},{11.75,0.0997680178228},{11.85,0.122909843922},{11.95,0.146732299559},{12.05,0.102396720793},{12.15,0.0966828584671},{12.25,0.0980312824249},{12.35,0.0906783607271},{12.45,0.0964148429132},{12.55,0.143874657782},{12.65,0.0762489140034},{12.75,0.0798751896825},{12.85,0.100362970715},{12.95,0.0723909047934},{13.05,0.0970648129781},{13.15,0.0657588193814},{13.25,0.0630994205889},{13.35,0.0377320121316},{13.45,0.0931810782506},{13.55,0.0898123979568},{13.65,0.0810213585695},{13.75,0.0374428629875},{13.85,0.0560585220655},{13.95,0.0526865805898},{14.05,0.0320728448304},{14.15,0.0563415090243},{14.25,0.0417913964817},{14.35,0.0664894729853},{14.45,0.0673195336546},{14.55,0.0567126311362},{14.65,0.0674984703461},{14.75,0.0268280987556},{14.85,0.0645201861858},{14.95,0.0487566292286},{15.05,0.0224902123213},{15.15,0.0310552609818},{15.25,0.0266415178776},{15.35,0.0303951889277},{15.45,0.0190864609821},{15.55,0.025746839121},{15.65,0.0},{15.75,0.0140285477042},{15.85,0.0299220029265},{15.95,0.00755505689553},{16.05,0.00432979895009},{16.15,0.00511457491666},{16.25,0.0160047914833},{16.35,0.00647150306031},{16.45,0.00723694947859},{16.55,0.00349918433598},{16.65,0.00807198230177},{16.75,0.0172573402524},{16.85,0.00668026087806},{16.95,0.00612357258797},{17.05,0.00315456775328},{17.15,0.0},{17.25,0.00259787930797},{17.35,0.00222675362602},{17.45,0.00723694963381},{17.55,0.0},{17.65,0.00334013043903},{17.75,0.00584522821009},{17.85,0.00222675362602},{17.95,0.00167006521951},{18.05,0.0},{18.15,0.0},{18.25,0.00139172107447},{18.35,0.00194840948097},{18.45,0.0},{18.55,0.00334013043903},{18.65,0.0},{18.75,0.0},{18.85,0.0},{18.95,0.000556688406505},{19.05,0.0},{19.15,0.0},{19.25,0.0},{19.35,0.0},{19.45,0.0},{19.55,0.0},{19.65,0.0},{19.75,0.0},{19.85,0.0},{19.95,0.0},{20.05,0.0},{20.15,0.0},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.0},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU37 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.0},{-21.35,0.0},{-21.25,0.0},{-21.15,0.0},{-21.05,0.0},{-20.95,0.0},{-20.85,0.0},{-20.75,0.0},{-20.65,0.0},{-20.55,0.000278344203252},{-20.45,0.0},{-20.35,0.0},{-20.25,0.0},{-20.15,0.000556688406505},{-20.05,0.000139172101626},{-19.95,0.0},{-19.85,0.0},{-19.75,0.0},{-19.65,0.0},{-19.55,0.0},{-19.45,0.0},{-19.35,0.0},{-19.25,0.0},{-19.15,0.0},{-19.05,0.0},{-18.95,0.000278344203252},{-18.85,0.000278344203252},{-18.75,0.000185562802168},{-18.65,0.0},{-18.55,0.000417516304879},{-18.45,3.09271336947e-05},{-18.35,0.0},{-18.25,3.47930254065e-05},{-18.15,0.000139172101626},{-18.05,0.000371125604336},{-17.95,0.0036184748169},{-17.85,0.000487102370244},{-17.75,0.000208758152439},{-17.65,0.000417516304879},{-17.55,0.000487102370244},{-17.45,0.000278344222655},{-17.35,0.000208758166991},{-17.25,0.00031810766086},{-17.15,0.000974204740487},{-17.05,0.000612357258797},{-16.95,0.000715742286827},{-16.85,0.000695860556637},{-16.75,0.000626274500974},{-16.65,0.000835032609757},{-16.55,0.00125254900195},{-16.45,0.00343291182071},{-16.35,0.00100203920156},{-16.25,0.00144738992676},{-16.15,0.000835032636921},{-16.05,0.00172067331997},{-15.95,0.00157065662955},{-15.85,0.00154017135501},{-15.75,0.00473185144365},{-15.65,0.00218964119752},{-15.55,0.00177261311757},{-15.45,0.00231465187512},{-15.35,0.00311745504538},{-15.25,0.00256835787811},{-15.15,0.00344134663994},{-15.05,0.00439783856273},{-14.95,0.0066988175114},{-14.85,0.00569535104128},{-14.75,0.00824208143685},{-14.65,0.00896268337965},{-14.55,0.00677850009764},{-14.45,0.0110757797956},{-14.35,0.0100832437315},{-14.25,0.00813383658727},{-14.15,0.00845692639655},{-14.05,0.0146265395226},{-13.95,0.0186156606674},{-13.85,0.0183227267759},{-13.75,0.019187792655},{-13.65,0.0150372144722},{-13.55,0.0166938639269},{-13.45,0.0126982547086},{-13.35,0.0160369082139},{-13.25,0.0180582902869},{-13.15,0.0208032040492},{-13.05,0.0191715683853},{-12.95,0.020226346819},{-12.85,0.0177869680855},{-12.75,0.024663284421},{-12.65,0.0263631727014},{-12.55,0.0217405382792},{-12.45,0.0252861993414},{-12.35,0.0228630637014},{-12.25,0.0281530524555},{-12.15,0.0280926428645},{-12.05,0.0247360841192},{-11.95,0.0359212493896},{-11.85,0.0361022743178},{-11.75,0.0362385186282},{-11.65,0.0346983885765},{-11.55,0.0461261036955},{-11.45,0.0424155990283},{-11.35,0.042024676005},{-11.25,0.0364345978564},{-11.15,0.0494543254966},{-11.05,0.0404582740669},{-10.95,0.0400404023453},{-10.85,0.0532174612346},{-10.75,0.0530347552726},{-10.65,0.0457326863941},{-10.55,0.0478932795587},{-10.45,0.0498958418641},{-10.35,0.0493563334147},{-10.25,0.0595902747848},{-10.15,0.0581652955239},{-10.05,0.0585532048989},{-9.95,0.0577009075978},{-9.85,0.0563238532982},{-9.75,0.0658474176959},{-9.65,0.0684343872878},{-9.55,0.0697444964678},{-9.45,0.0708048227921},{-9.35,0.0755853143711},{-9.25,0.082202037567},{-9.15,0.0839982392653},{-9.05,0.082776406967},{-8.95,0.0766197973331},{-8.85,0.0918595637375},{-8.75,0.0897758739201},{-8.65,0.101516771317},{-8.55,0.099414563361},{-8.45,0.0978745129092},{-8.35,0.108102952733},{-8.25,0.123104846384},{-8.15,0.114335378011},{-8.05,0.112537930725},{-7.95,0.127663424226},{-7.85,0.13451429168},{-7.75,0.128860567245},{-7.65,0.124800836574},{-7.55,0.149919721815},{-7.45,0.153986863356},{-7.35,0.163325333301},{-7.25,0.166989910069},{-7.15,0.167847079528},{-7.05,0.172519141917},{-6.95,0.172241452501},{-6.85,0.19284706653},{-6.75,0.191400614421},{-6.65,0.209081091275},{-6.55,0.204243669805},{-6.45,0.211552280904},{-6.35,0.216815499136},{-6.25,0.231067473045},{-6.15,0.217951170895},{-6.05,0.249332773027},{-5.95,0.233915415677},{-5.85,0.243013351819},{-5.75,0.271195800046},{-5.65,0.24418124594},{-5.55,0.25770299956},{-5.45,0.270791806457},{-5.35,0.261296458453},{-5.25,0.279420923304},{-5.15,0.286772596158},{-5.05,0.299415650915},{-4.95,0.291840131893},{-4.85,0.313513943469},{-4.75,0.316554632713},{-4.65,0.319713467578},{-4.55,0.345249738597},{-4.45,0.32686803248},{-4.35,0.337714964229},{-4.25,0.323865312018},{-4.15,0.351673643231},{-4.05,0.36099866371},{-3.95,0.366693984792},{-3.85,0.375603827877},{-3.75,0.362261432602},{-3.65,0.345760066926},{-3.55,0.385300740419},{-3.45,0.398388570328},{-3.35,0.404170797597},{-3.25,0.411315414641},{-3.15,0.382602806152},{-3.05,0.400546804651},{-2.95,0.438319880788},{-2.85,0.420123190958},{-2.75,0.436840697423},{-2.65,0.406975155785},{-2.55,0.461260181584},{-2.45,0.457677936873},{-2.35,0.418796360942},{-2.25,0.449507231157},{-2.15,0.456293017578},{-2.05,0.479736833383},{-1.95,0.473596132245},{-1.85,0.475230339246},{-1.75,0.482538146481},{-1.65,0.487253612261},{-1.55,0.487861499452},{-1.45,0.516234638297},{-1.35,0.482997971172},{-1.25,0.492114305496},{-1.15,0.494040121712},{-1.05,0.482416758004},{-0.95,0.496130756678},{-0.85,0.545686101029},{-0.75,0.542166813043},{-0.65,0.524339133558},{-0.55,0.497248900261},{-0.45,0.493567441115},{-0.35,0.570090501632},{-0.25,0.500155662594},{-0.15,0.544016934373},{-0.05,0.564698348174},{0.05,0.566961711232},{0.15,0.560608063254},{0.25,0.567024811875},{0.35,0.551989555359},{0.45,0.549139804527},{0.55,0.541593434355},{0.65,0.618772040473},{0.75,0.514682487205},{0.85,0.534957469371},{0.95,0.566997593173},{1.05,0.547462425422},{1.15,0.588438034058},{1.25,0.540538019866},{1.35,0.568806859627},{1.45,0.602093721411},{1.55,0.533325498467},{1.65,0.543224393006},{1.75,0.571409650844},{1.85,0.589059077468},{1.95,0.545755132929},{2.05,0.607925594554},{2.15,0.560663087276},{2.25,0.565731737645},{2.35,0.562143732992},{2.45,0.555284192946},{2.55,0.587025736042},{2.65,0.593279291372},{2.75,0.556814866689},{2.85,0.535117509469},{2.95,0.564297242951},{3.05,0.592132899353},{3.15,0.528609628752},{3.25,0.580749913266},{3.35,0.553819112575},{3.45,0.534827324137},{3.55,0.595554125281},{3.65,0.550378035646},{3.75,0.528104657169},{3.85,0.555282342042},{3.95,0.553797781182},{4.05,0.548853654838},{4.15,0.518704523806},{4.25,0.53911246207},{4.35,0.512899195106},{4.45,0.531544911493},{4.55,0.477967250942},{4.65,0.494233873155},{4.75,0.534159756778},{4.85,0.516183539685},{4.95,0.479511352539},{5.05,0.491031260973},{5.15,0.529194116592},{5.25,0.500101368602},{5.35,0.487090457835},{5.45,0.469869724472},{5.55,0.462517046111},{5.65,0.48369380039},{5.75,0.485367088051},{5.85,0.552938855384},{5.95,0.457224798541},{6.05,0.441405546581},{6.15,0.449495559348},{6.25,0.473295109753},{6.35,0.407663352375},{6.45,0.435065752194},{6.55,0.400723987155},{6.65,0.453229824332},{6.75,0.394985780878},{6.85,0.368098192254},{6.95,0.363519903954},{7.05,0.354976370866},{7.15,0.322875817617},{7.25,0.350999949668},{7.35,0.365947246552},{7.45,0.377652114697},{7.55,0.353497144911},{7.65,0.357924309003},{7.75,0.322641586989},{7.85,0.300534854278},{7.95,0.308198711829},{8.05,0.317699906094},{8.15,0.322957152253},{8.25,0.304245795403},{8.35,0.329806450875},{8.45,0.301338046789},{8.55,0.301041910471},{8.65,0.252204584192},{8.75,0.216013908386},{8.85,0.26976275444},{8.95,0.246356416785},{9.05,0.21008361332},{9.15,0.242867479047},{9.25,0.209700056485},{9.35,0.219194695501},{9.45,0.192271409211},{9.55,0.230913025992},{9.65,0.208758167837},{9.75,0.146252037114},{9.85,0.180341742255},{9.95,0.175045765147},{10.05,0.173203158379},{10.15,0.212828370391},{10.25,0.180475064178},{10.35,0.146476855645},{10.45,0.165179893374},{10.55,0.171580002226},{10.65,0.134670884269},{10.75,0.156981161663},{10.85,0.132182075131},{10.95,0.103410441081},{11.05,0.154013177182},{11.15,0.134779834747},{11.25,0.136485483335},{11.35,0.161756647958},{11.45,0.0877756239876},{11.55,0.12709196806},{11.65,0.113551185245},{11.75,0.111302888393},{11.85,0.121620518821},{11.95,0.136033535004},{12.05,0.0900165200233},{12.15,0.128156093451},{12.25,0.114420087249},{12.35,0.115420063337},{12.45,0.0739249481874},{12.55,0.0925104808807},{12.65,0.0715344587962},{12.75,0.112265494135},{12.85,0.112033545971},{12.95,0.0635909483983},{13.05,0.0573282012573},{13.15,0.0703771365316},{13.25,0.106234709422},{13.35,0.0633387698068},{13.45,0.0739003845624},{13.55,0.0593742989004},{13.65,0.0675091743469},{13.75,0.0680551578601},{13.85,0.120383868615},{13.95,0.0685840129852},{14.05,0.0435608667987},{14.15,0.0918999811014},{14.25,0.0476221658967},{14.35,0.0670411927359},{14.45,0.0720911522706},{14.55,0.0428959363037},{14.65,0.116347879171},{14.75,0.037421832482},{14.85,0.0449525912603},{14.95,0.0320791713893},{15.05,0.0762663135926},{15.15,0.0202263461219},{15.25,0.0213132138763},{15.35,0.129151716828},{15.45,0.0147522432464},{15.55,0.0215716771781},{15.65,0.0242159465949},{15.75,0.015030587092},{15.85,0.0261643566191},{15.95,0.0092966966331},{16.05,0.0109482059876},{16.15,0.00634624809027},{16.25,0.00440711652239},{16.35,0.0050658646971},{16.45,0.00835032667965},{16.55,0.00714416801929},{16.65,0.00723694963381},{16.75,0.0},{16.85,0.00765446573496},{16.95,0.00278344214894},{17.05,0.0},{17.15,0.00751529354602},{17.25,0.00459267944098},{17.35,0.00111337681301},{17.45,0.0},{17.55,0.00250509800389},{17.65,0.0},{17.75,0.0036184748169},{17.85,0.0},{17.95,0.00278344214894},{18.05,0.00139172107447},{18.15,0.0},{18.25,0.000417516304879},{18.35,0.0},{18.45,0.00139172107447},{18.55,0.0},{18.65,0.0},{18.75,0.0},{18.85,0.0},{18.95,0.000556688406505},{19.05,0.0},{19.15,0.0},{19.25,0.000278344203252},{19.35,0.0},{19.45,0.0},{19.55,0.0},{19.65,0.0},{19.75,0.0},{19.85,0.0},{19.95,0.0},{20.05,0.0},{20.15,0.0},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.0},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU38 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.0},{-21.35,0.0},{-21.25,0.0},{-21.15,0.0},{-21.05,0.0},{-20.95,0.0},{-20.85,0.0},{-20.75,0.0},{-20.65,0.0},{-20.55,0.000278344203252},{-20.45,0.0},{-20.35,0.0},{-20.25,0.0},{-20.15,0.0},{-20.05,0.0},{-19.95,0.0},{-19.85,0.0},{-19.75,0.0},{-19.65,0.0},{-19.55,0.0},{-19.45,0.0},{-19.35,0.0},{-19.25,0.0},{-19.15,0.000278344203252},{-19.05,0.0},{-18.95,9.27814010841e-05},{-18.85,3.97634576075e-05},{-18.75,0.000278344203252},{-18.65,0.000278344203252},{-18.55,0.0},{-18.45,6.95860508131e-05},{-18.35,0.0},{-18.25,0.000167006521951},{-18.15,6.95860508131e-05},{-18.05,0.000417516304879},{-17.95,0.000278344203252},{-17.85,0.000695860537235},{-17.75,0.000463907024823},{-17.65,0.000556688406505},{-17.55,0.0},{-17.45,0.000417516333982},{-17.35,0.000501019600779},{-17.25,0.00031810766086},{-17.15,0.000417516304879},{-17.05,0.000521895417478},{-16.95,0.00146130705252},{-16.85,0.00088142332},{-16.75,0.000954322982579},{-16.65,0.00106698616097},{-16.55,0.00144738992676},{-16.45,0.000974204740487},{-16.35,0.00111337684627},{-16.25,0.000856443738135},{-16.15,0.00130821783096},{-16.05,0.00190201882894},{-15.95,0.00109482059876},{-15.85,0.00208758153021},{-15.75,0.00151101140571},{-15.65,0.00151349662337},{-15.55,0.00217456417158},{-15.45,0.00273125246167},{-15.35,0.0025422103703},{-15.25,0.00278344202568},{-15.15,0.00384462950751},{-15.05,0.00375764667988},{-14.95,0.00528854014058},{-14.85,0.0048963278532},{-14.75,0.00516376515915},{-14.65,0.00726014499863},{-14.55,0.00606268504634},{-14.45,0.00882748780506},{-14.35,0.00862023595608},{-14.25,0.0123811629083},{-14.15,0.0144516313076},{-14.05,0.0166227161884},{-13.95,0.0192057503306},{-13.85,0.0165893147389},{-13.75,0.0114061908519},{-13.65,0.0153303421461},{-13.55,0.0171840928103},{-13.45,0.0211878978845},{-13.35,0.0181387648696},{-13.25,0.0166710412249},{-13.15,0.0195583197806},{-13.05,0.0151145325767},{-12.95,0.0208424139023},{-12.85,0.0184425480904},{-12.75,0.0199689519021},{-12.65,0.0212454907596},{-12.55,0.02028384343},{-12.45,0.0226809592808},{-12.35,0.0244744079454},{-12.25,0.0271647805753},{-12.15,0.0311789701855},{-12.05,0.0272565914106},{-11.95,0.0307748776216},{-11.85,0.0327732471319},{-11.75,0.0288512293173},{-11.65,0.0345114839488},{-11.55,0.0432312519927},{-11.45,0.0386232837387},{-11.35,0.042608555783},{-11.25,0.0392809958685},{-11.15,0.0363367825997},{-11.05,0.0466027746395},{-10.95,0.0386471940625},{-10.85,0.0409789466858},{-10.75,0.0415049177228},{-10.65,0.0473322047562},{-10.55,0.0443595941516},{-10.45,0.0551852775832},{-10.35,0.0542727380287},{-10.25,0.0481830432715},{-10.15,0.0553447689329},{-10.05,0.0509819421709},{-9.95,0.0658671228509},{-9.85,0.0598098877938},{-9.75,0.0568031355136},{-9.65,0.0610981535638},{-9.55,0.0672614588882},{-9.45,0.0704540275258},{-9.35,0.0732126180516},{-9.25,0.0725033992046},{-9.15,0.0717684949808},{-9.05,0.0822827140278},{-8.95,0.089336322305},{-8.85,0.0822922674966},{-8.75,0.086862993912},{-8.65,0.0991608301799},{-8.55,0.0802916013277},{-8.45,0.0944872468205},{-8.35,0.0938726909577},{-8.25,0.0908376852097},{-8.15,0.110593144295},{-8.05,0.0932233333588},{-7.95,0.112689793333},{-7.85,0.116369129528},{-7.75,0.11909212193},{-7.65,0.120274588566},{-7.55,0.125825401963},{-7.45,0.132656817405},{-7.35,0.14458656311},{-7.25,0.149190628409},{-7.15,0.143657952638},{-7.05,0.14863078945},{-6.95,0.165762429039},{-6.85,0.167321695181},{-6.75,0.176286092905},{-6.65,0.182251358032},{-6.55,0.183658488638},{-6.45,0.184663062002},{-6.35,0.181945800781},{-6.25,0.190191779908},{-6.15,0.199367553549},{-6.05,0.206995070608},{-5.95,0.221115132925},{-5.85,0.236979471276},{-5.75,0.220967914335},{-5.65,0.214439356687},{-5.55,0.233403104023},{-5.45,0.231892448248},{-5.35,0.246808272842},{-5.25,0.267063283564},{-5.15,0.271047372981},{-5.05,0.271268479368},{-4.95,0.28363741642},{-4.85,0.279927850314},{-4.75,0.277682538618},{-4.65,0.300502978796},{-4.55,0.303469345747},{-4.45,0.317112857348},{-4.35,0.304921609687},{-4.25,0.290305834477},{-4.15,0.298430187867},{-4.05,0.315891211484},{-3.95,0.317947326415},{-3.85,0.32778264826},{-3.75,0.303943745411},{-3.65,0.321811085827},{-3.55,0.341255441804},{-3.45,0.358710091359},{-3.35,0.368403199231},{-3.25,0.351826032003},{-3.15,0.352047882933},{-3.05,0.373641494633},{-2.95,0.379943611543},{-2.85,0.376447688388},{-2.75,0.416404067493},{-2.65,0.384897185881},{-2.55,0.388054963847},{-2.45,0.421806998875},{-2.35,0.394303229771},{-2.25,0.394751651682},{-2.15,0.397468566895},{-2.05,0.389726265258},{-1.95,0.42275114891},{-1.85,0.411717796326},{-1.75,0.426335810743},{-1.65,0.400275951321},{-1.55,0.405508236009},{-1.45,0.417535606662},{-1.35,0.443972767162},{-1.25,0.429542247036},{-1.15,0.448788374608},{-1.05,0.448060951577},{-0.95,0.459193882373},{-0.85,0.423823115802},{-0.75,0.477279749132},{-0.65,0.451195464117},{-0.55,0.473887210422},{-0.45,0.471402128174},{-0.35,0.469918561981},{-0.25,0.484100513244},{-0.15,0.447666886351},{-0.05,0.446821990809},{0.05,0.483173037725},{0.15,0.459746560933},{0.25,0.45852082905},{0.35,0.488922576333},{0.45,0.499263134953},{0.55,0.489575069349},{0.65,0.497837285886},{0.75,0.456015856698},{0.85,0.443811956442},{0.95,0.482338293275},{1.05,0.458684965463},{1.15,0.518033422605},{1.25,0.537468004729},{1.35,0.523104040401},{1.45,0.48882905827},{1.55,0.516597094978},{1.65,0.475885201956},{1.75,0.498098650286},{1.85,0.496870898042},{1.95,0.477684605567},{2.05,0.488962530121},{2.15,0.51086807251},{2.25,0.496438002386},{2.35,0.500549904539},{2.45,0.498034405452},{2.55,0.476579793294},{2.65,0.521130427477},{2.75,0.488025899519},{2.85,0.483452698425},{2.95,0.540804741686},{3.05,0.504885379737},{3.15,0.498011873797},{3.25,0.476906474688},{3.35,0.491500743921},{3.45,0.506698492509},{3.55,0.462987503915},{3.65,0.467894581915},{3.75,0.47382276339},{3.85,0.457205034829},{3.95,0.492417376974},{4.05,0.473920003255},{4.15,0.460768644141},{4.25,0.458060517182},{4.35,0.456572179636},{4.45,0.451105271873},{4.55,0.467515347272},{4.65,0.48895476136},{4.75,0.457952843529},{4.85,0.433375313168},{4.95,0.44958597819},{5.05,0.434856463082},{5.15,0.485349287553},{5.25,0.422693888346},{5.35,0.40997654918},{5.45,0.416538749773},{5.55,0.450574209864},{5.65,0.43313851012},{5.75,0.453175442278},{5.85,0.416072202196},{5.95,0.46293933575},{6.05,0.409654546081},{6.15,0.404756497114},{6.25,0.378729444322},{6.35,0.381122191056},{6.45,0.41864632374},{6.55,0.370251436846},{6.65,0.36277659958},{6.75,0.405016664599},{6.85,0.341161691225},{6.95,0.303292036057},{7.05,0.337219040629},{7.15,0.370947832119},{7.25,0.309241869063},{7.35,0.33890921811},{7.45,0.325301730994},{7.55,0.319964546827},{7.65,0.27899421295},{7.75,0.250899786478},{7.85,0.257158764721},{7.95,0.29345035553},{8.05,0.283831853936},{8.15,0.26566852597},{8.25,0.24186372757},{8.35,0.278186151537},{8.45,0.281431077837},{8.55,0.217287854795},{8.65,0.237684364977},{8.75,0.217826570783},{8.85,0.194502487183},{8.95,0.234348783688},{9.05,0.210460644324},{9.15,0.222329737066},{9.25,0.208159115004},{9.35,0.224718914756},{9.45,0.210689163208},{9.55,0.209225781759},{9.65,0.164645291446},{9.75,0.184104283651},{9.85,0.189928994459},{9.95,0.158703816564},{10.05,0.152318232768},{10.15,0.13199082613},{10.25,0.222508366903},{10.35,0.133398451124},{10.45,0.130069832304},{10.55,0.128312334418},{10.65,0.164895753066},{10.75,0.160641723209},{10.85,0.143915553888},{10.95,0.145548722961},{11.05,0.146904642989},{11.15,0.130562413823},{11.25,0.125086595846},{11.35,0.113868084821},{11.45,0.128208438555},{11.55,0.132542451223},{11.65,0.146071059363},{11.75,0.096188801527},{11.85,0.142066888809},{11.95,0.137722392877},{12.05,0.124063577652},{12.15,0.0981499244427},{12.25,0.0925734454188},{12.35,0.0776221213802},{12.45,0.0660603624402},{12.55,0.10149821043},{12.65,0.0817446329377},{12.75,0.153266440738},{12.85,0.143043615601},{12.95,0.0645885088227},{13.05,0.0858784675598},{13.15,0.051941451819},{13.25,0.121574560801},{13.35,0.0665613770485},{13.45,0.0434747139613},{13.55,0.0629486120664},{13.65,0.0444368334378},{13.75,0.0295740713676},{13.85,0.0450122356415},{13.95,0.0499859799941},{14.05,0.0697948113084},{14.15,0.034793025681},{14.25,0.118783392012},{14.35,0.0319453500784},{14.45,0.0356027538126},{14.55,0.0425518713892},{14.65,0.0540915578604},{14.75,0.0254811481996},{14.85,0.0392862984112},{14.95,0.0353099512202},{15.05,0.0333549156785},{15.15,0.0305714731415},{15.25,0.0229170074066},{15.35,0.0238819330931},{15.45,0.0308034271002},{15.55,0.0134069124858},{15.65,0.00964926617841},{15.75,0.0254684947431},{15.85,0.0212933328003},{15.95,0.0105770801504},{16.05,0.0286694541574},{16.15,0.00412877245496},{16.25,0.00434216968715},{16.35,0.00501019600779},{16.45,0.0183707177639},{16.55,0.00514936773106},{16.65,0.00598440039903},{16.75,0.00334013043903},{16.85,0.0},{16.95,0.0},{17.05,0.0},{17.15,0.00222675362602},{17.25,0.00640191696584},{17.35,0.00334013043903},{17.45,0.00194840948097},{17.55,0.00139172107447},{17.65,0.00417516333982},{17.75,0.00417516333982},{17.85,0.000695860537235},{17.95,0.000974204740487},{18.05,0.000556688406505},{18.15,0.000417516304879},{18.25,0.0},{18.35,0.0},{18.45,0.0},{18.55,0.0},{18.65,0.0},{18.75,0.0},{18.85,0.0},{18.95,0.0},{19.05,0.0},{19.15,0.000556688406505},{19.25,0.0},{19.35,0.0},{19.45,0.000556688406505},{19.55,0.0},{19.65,0.0},{19.75,0.0},{19.85,0.0},{19.95,0.0},{20.05,0.0},{20.15,0.0},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.0},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU39 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.0},{-21.35,0.0},{-21.25,0.0},{-21.15,0.0},{-21.05,0.0},{-20.95,0.0},{-20.85,0.0},{-20.75,0.0},{-20.65,0.0},{-20.55,0.0},{-20.45,0.0},{-20.35,0.0},{-20.25,0.0},{-20.15,0.0},{-20.05,0.0},{-19.95,0.0},{-19.85,0.0},{-19.75,0.0},{-19.65,0.0},{-19.55,0.0},{-19.45,0.0},{-19.35,0.0},{-19.25,0.000278344203252},{-19.15,0.000278344203252},{-19.05,0.0},{-18.95,0.0},{-18.85,0.000278344203252},{-18.75,0.0},{-18.65,0.0},{-18.55,0.0},{-18.45,0.0},{-18.35,0.0},{-18.25,0.000278344203252},{-18.15,0.0},{-18.05,0.000185562802168},{-17.95,0.0},{-17.85,0.00250509800389},{-17.75,5.56688406505e-05},{-17.65,0.0},{-17.55,0.000835032609757},{-17.45,0.000695860537235},{-17.35,0.000334013043903},{-17.25,0.000463907024823},{-17.15,0.000927814049646},{-17.05,0.000278344214894},{-16.95,0.000695860537235},{-16.85,0.00111337681301},{-16.75,0.000437398041998},{-16.65,0.000715742286827},{-16.55,0.00047716149129},{-16.45,0.00044071166},{-16.35,0.00127243064344},{-16.25,0.00108554242179},{-16.15,0.000723694963381},{-16.05,0.000685154961852},{-15.95,0.000997400066505},{-15.85,0.00123989692127},{-15.75,0.00176284669174},{-15.65,0.00132213498},{-15.55,0.00200407840312},{-15.45,0.00248190248385},{-15.35,0.00260450664376},{-15.25,0.00329373994221},{-15.15,0.0038754077485},{-15.05,0.00757096260786},{-14.95,0.0059751222531},{-14.85,0.00539987757802},{-14.75,0.00662166193912},{-14.65,0.0093399948544},{-14.55,0.00824594746033},{-14.45,0.00828609329004},{-14.35,0.0138146626322},{-14.25,0.0185180762235},{-14.15,0.0159415318207},{-14.05,0.0215962353875},{-13.95,0.0128125315532},{-13.85,0.0218082681298},{-13.75,0.0133379536706},{-13.65,0.0163463968219},{-13.55,0.0220922827721},{-13.45,0.0184128916625},{-13.35,0.0208336421938},{-13.25,0.0177557717922},{-13.15,0.0239294153803},{-13.05,0.0238680160708},{-12.95,0.0199726175289},{-12.85,0.0204391970354},{-12.75,0.0258670340885},{-12.65,0.0259613965948},{-12.55,0.037414100435},{-12.45,0.0287696576118},{-12.35,0.0337971713808},{-12.25,0.0385705544835},{-12.15,0.0252889826678},{-12.05,0.0339970588684},{-11.95,0.0335045629932},{-11.85,0.0346201152513},{-11.75,0.0501814861687},{-11.65,0.0486798719926},{-11.55,0.03790608519},{-11.45,0.0429984608742},{-11.35,0.0366826746199},{-11.25,0.0381331571969},{-11.15,0.0534222057887},{-11.05,0.0540954238839},{-10.95,0.0550193723043},{-10.85,0.0464242620671},{-10.75,0.0455538129807},{-10.65,0.0437827926498},{-10.55,0.0530643365821},{-10.45,0.0538096103853},{-10.35,0.052958119023},{-10.25,0.0593791980188},{-10.15,0.0552324561749},{-10.05,0.0620080672943},{-9.95,0.0597703949479},{-9.85,0.059783115983},{-9.75,0.0631474561469},{-9.65,0.0670283535334},{-9.55,0.065094770704},{-9.45,0.0734765906083},{-9.35,0.0919977341379},{-9.25,0.0950281537812},{-9.15,0.0740325555861},{-9.05,0.0705254619772},{-8.95,0.085628313896},{-8.85,0.0866698571193},{-8.75,0.0925391397358},{-8.65,0.107708002897},{-8.55,0.101488969997},{-8.45,0.0948084279111},{-8.35,0.100953531013},{-8.25,0.127464138487},{-8.15,0.105643286494},{-8.05,0.113214436144},{-7.95,0.126729249954},{-7.85,0.114016280581},{-7.75,0.134630410978},{-7.65,0.123445060632},{-7.55,0.121566559689},{-7.45,0.138422623341},{-7.35,0.141749409951},{-7.25,0.132208331367},{-7.15,0.151606682808},{-7.05,0.162287227443},{-6.95,0.172178898961},{-6.85,0.170329335135},{-6.75,0.172130356121},{-6.65,0.172664518837},{-6.55,0.166154036821},{-6.45,0.174393216375},{-6.35,0.176975571222},{-6.25,0.195655148046},{-6.15,0.213901560647},{-6.05,0.204582076776},{-5.95,0.203695602178},{-5.85,0.231022831523},{-5.75,0.252220617022},{-5.65,0.222570140187},{-5.55,0.218567398773},{-5.45,0.257924123527},{-5.35,0.228135260367},{-5.25,0.258328817536},{-5.15,0.262847763336},{-5.05,0.278751490306},{-4.95,0.26850832258},{-4.85,0.266550525204},{-4.75,0.300788649593},{-4.65,0.291386180154},{-4.55,0.285662722844},{-4.45,0.283186677214},{-4.35,0.317031687936},{-4.25,0.286983290218},{-4.15,0.306350078779},{-4.05,0.327647793678},{-3.95,0.324399365045},{-3.85,0.332155004724},{-3.75,0.367767978722},{-3.65,0.335576375326},{-3.55,0.350773491823},{-3.45,0.341262929305},{-3.35,0.383421374905},{-3.25,0.394578184216},{-3.15,0.404086983722},{-3.05,0.395866673654},{-2.95,0.372402311237},{-2.85,0.395935482449},{-2.75,0.382221322551},{-2.65,0.369336764742},{-2.55,0.399142885671},{-2.45,0.376249119606},{-2.35,0.38815738083},{-2.25,0.425425689999},{-2.15,0.41613055755},{-2.05,0.460406749118},{-1.95,0.428959968291},{-1.85,0.419276559825},{-1.75,0.423955045554},{-1.65,0.440899242054},{-1.55,0.441314082575},{-1.45,0.433854590913},{-1.35,0.449688156634},{-1.25,0.427818775177},{-1.15,0.468612448142},{-1.05,0.446322070593},{-0.95,0.471572103845},{-0.85,0.450185523186},{-0.75,0.453611041428},{-0.65,0.456112545197},{-0.55,0.451254251841},{-0.45,0.472511883904},{-0.35,0.464144095847},{-0.25,0.514531647583},{-0.15,0.47068651776},{-0.05,0.492060663625},{0.05,0.482071718333},{0.15,0.448786720798},{0.25,0.524918428401},{0.35,0.474824065095},{0.45,0.480985353578},{0.55,0.492197967382},{0.65,0.484443136502},{0.75,0.511650779031},{0.85,0.49329383664},{0.95,0.483903733946},{1.05,0.473301068474},{1.15,0.534380703686},{1.25,0.502830929226},{1.35,0.51416233043},{1.45,0.513188441594},{1.55,0.494581126203},{1.65,0.498313942934},{1.75,0.502618051504},{1.85,0.46829513922},{1.95,0.487850569703},{2.05,0.488381161554},{2.15,0.455752675126},{2.25,0.531846188951},{2.35,0.458375167847},{2.45,0.488676906276},{2.55,0.513553049373},{2.65,0.500857128975},{2.75,0.52129799003},{2.85,0.553944382254},{2.95,0.461514348569},{3.05,0.536068647336},{3.15,0.535120381937},{3.25,0.511689724606},{3.35,0.462947091391},{3.45,0.540337135052},{3.55,0.46207222396},{3.65,0.473700831303},{3.75,0.492861573482},{3.85,0.533841758421},{3.95,0.530631650336},{4.05,0.469731648763},{4.15,0.456154225667},{4.25,0.448685257523},{4.35,0.430731211277},{4.45,0.498712038526},{4.55,0.494254278758},{4.65,0.466246883686},{4.75,0.447015531135},{4.85,0.467054785752},{4.95,0.499507325036},{5.05,0.466969194083},{5.15,0.419201835753},{5.25,0.487046704973},{5.35,0.469740331741},{5.45,0.39603455469},{5.55,0.430800468977},{5.65,0.448181495667},{5.75,0.443459417881},{5.85,0.416355873222},{5.95,0.430496337566},{6.05,0.387442790816},{6.15,0.364598628979},{6.25,0.387705185834},{6.35,0.439074870176},{6.45,0.340813418935},{6.55,0.368367776103},{6.65,0.345009214423},{6.75,0.3273405287},{6.85,0.347662170972},{6.95,0.350375708047},{7.05,0.359361701541},{7.15,0.288997783996},{7.25,0.345159015516},{7.35,0.310453612229},{7.45,0.323703765869},{7.55,0.368053779946},{7.65,0.290069978629},{7.75,0.271144109614},{7.85,0.315318855079},{7.95,0.263852649265},{8.05,0.265118146347},{8.15,0.313579659713},{8.25,0.328442928403},{8.35,0.278057078311},{8.45,0.291160982709},{8.55,0.258933517959},{8.65,0.221829204559},{8.75,0.253397194736},{8.85,0.24525604248},{8.95,0.190820733297},{9.05,0.211752054168},{9.15,0.215141773224},{9.25,0.202363566348},{9.35,0.176701045618},{9.45,0.254478772481},{9.55,0.203332658798},{9.65,0.172912265943},{9.75,0.155772248904},{9.85,0.156558236079},{9.95,0.152125813411},{10.05,0.128451983134},{10.15,0.171766204834},{10.25,0.143488883972},{10.35,0.158238679171},{10.45,0.13869035244},{10.55,0.12109464407},{10.65,0.161495316029},{10.75,0.171428217207},{10.85,0.178001120687},{10.95,0.152222469875},{11.05,0.152389237375},{11.15,0.15316114118},{11.25,0.105214107604},{11.35,0.136020537346},{11.45,0.135889563067},{11.55,0.112957138004},{11.65,0.114139080048},{11.75,0.121389000504},{11.85,0.100639986992},{11.95,0.114666213592},{12.05,0.179216559728},{12.15,0.0980328273773},{12.25,0.117812846836},{12.35,0.110121764635},{12.45,0.160117506981},{12.55,0.160832340067},{12.65,0.0967164249981},{12.75,0.089692326153},{12.85,0.198061789785},{12.95,0.0814678743482},{13.05,0.0708733946085},{13.15,0.0696231683095},{13.25,0.109451128377},{13.35,0.151187300682},{13.45,0.0830579102039},{13.55,0.121868371964},{13.65,0.0984940869468},{13.75,0.0787018239498},{13.85,0.0571162343025},{13.95,0.133605226874},{14.05,0.0503524661064},{14.15,0.109389275312},{14.25,0.0673592984676},{14.35,0.132677406073},{14.45,0.346816897392},{14.55,0.0466027728149},{14.65,0.0738307982683},{14.75,0.037059545517},{14.85,0.0450453708569},{14.95,0.0349321986238},{15.05,0.044883005321},{15.15,0.0777972042561},{15.25,0.0173368677497},{15.35,0.0509369894862},{15.45,0.0812765061855},{15.55,0.0299220029265},{15.65,0.0175356852512},{15.75,0.0210149884224},{15.85,0.0113193318248},{15.95,0.00862867074708},{16.05,0.00528853992},{16.15,0.00705138656},{16.25,0.0086286701262},{16.35,0.0},{16.45,0.00228242259473},{16.55,0.00723694963381},{16.65,0.00946370325983},{16.75,0.0077936379239},{16.85,0.0},{16.95,0.00315456775328},{17.05,0.00292261410505},{17.15,0.00501019600779},{17.25,0.0},{17.35,0.00222675362602},{17.45,0.0},{17.55,0.000695860537235},{17.65,0.00222675362602},{17.75,0.0},{17.85,0.0},{17.95,0.00139172107447},{18.05,0.0},{18.15,0.00111337681301},{18.25,0.000835032609757},{18.35,0.00111337681301},{18.45,0.000139172101626},{18.55,0.000556688406505},{18.65,0.000556688406505},{18.75,0.0},{18.85,0.0},{18.95,0.000556688406505},{19.05,0.0},{19.15,0.000278344203252},{19.25,0.0},{19.35,0.0},{19.45,0.0},{19.55,0.0},{19.65,0.0},{19.75,0.0},{19.85,0.0},{19.95,0.0},{20.05,0.0},{20.15,0.0},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.0},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU40 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.0},{-21.35,0.0},{-21.25,0.0},{-21.15,0.0},{-21.05,0.0},{-20.95,0.0},{-20.85,0.0},{-20.75,0.0},{-20.65,0.0},{-20.55,0.0},{-20.45,0.0},{-20.35,0.0},{-20.25,0.0},{-20.15,0.0},{-20.05,0.0},{-19.95,0.0},{-19.85,0.0},{-19.75,0.0},{-19.65,0.0},{-19.55,0.000278344203252},{-19.45,0.0},{-19.35,0.000139172101626},{-19.25,0.0},{-19.15,0.000167006521951},{-19.05,0.0},{-18.95,0.0},{-18.85,0.0},{-18.75,0.0},{-18.65,0.0},{-18.55,0.000835032609757},{-18.45,0.0},{-18.35,0.0},{-18.25,0.0},{-18.15,0.000278344203252},{-18.05,0.000139172101626},{-17.95,0.000185562802168},{-17.85,0.000278344203252},{-17.75,0.000278344203252},{-17.65,0.000556688406505},{-17.55,0.00194840948097},{-17.45,0.000626274500974},{-17.35,0.000167006521951},{-17.25,0.000668026087806},{-17.15,0.00139172107447},{-17.05,0.000765446573496},{-16.95,0.000695860537235},{-16.85,0.00021648994233},{-16.75,0.00102059543133},{-16.65,0.00031810766086},{-16.55,0.00104379083496},{-16.45,0.000357871143413},{-16.35,0.00194840940336},{-16.25,0.00194840948097},{-16.15,0.00134533038363},{-16.05,0.00155872758478},{-15.95,0.00101216078143},{-15.85,0.00121459288692},{-15.75,0.00238580762276},{-15.65,0.00095680821687},{-15.55,0.00204962559722},{-15.45,0.00238138933976},{-15.35,0.00285935401917},{-15.25,0.0022665171751},{-15.15,0.00339977576264},{-15.05,0.00268089418349},{-14.95,0.0106118731201},{-14.85,0.00606392749718},{-14.75,0.0119941044937},{-14.65,0.0119091559734},{-14.55,0.0125851343785},{-14.45,0.012308999896},{-14.35,0.0140254547199},{-14.25,0.0151542954975},{-14.15,0.0173598888673},{-14.05,0.0223023295403},{-13.95,0.017181428996},{-13.85,0.0205835536122},{-13.75,0.0157542824745},{-13.65,0.0282210111618},{-13.55,0.0212933329435},{-13.45,0.0244015082717},{-13.35,0.0301141937574},{-13.25,0.0285186842084},{-13.15,0.0234939903021},{-13.05,0.0226850527174},{-12.95,0.0273452094107},{-12.85,0.0306358202811},{-12.75,0.0244810354142},{-12.65,0.0285053008642},{-12.55,0.0402856866519},{-12.45,0.0276347398758},{-12.35,0.0326259164583},{-12.25,0.0342297099885},{-12.15,0.0292413234711},{-12.05,0.0338800573349},{-11.95,0.041289833459},{-11.85,0.0388590354545},{-11.75,0.0380452599442},{-11.65,0.0312272116945},{-11.55,0.0431145594038},{-11.45,0.0376717913641},{-11.35,0.0521971312436},{-11.25,0.0370767892125},{-11.15,0.0448879053895},{-11.05,0.0469589862559},{-10.95,0.0509489195687},{-10.85,0.0419477386908},{-10.75,0.0425352298695},{-10.65,0.0582551227676},{-10.55,0.0555032476594},{-10.45,0.0509400472536},{-10.35,0.0455298953586},{-10.25,0.0588362079927},{-10.15,0.0487251494612},{-10.05,0.0467848304875},{-9.95,0.0574794042678},{-9.85,0.063164843191},{-9.75,0.0598640656686},{-9.65,0.0576674430097},{-9.55,0.0705615560585},{-9.45,0.068890193413},{-9.35,0.0712654770923},{-9.25,0.0710364878178},{-9.15,0.0648882859418},{-9.05,0.0764158732855},{-8.95,0.0813037183948},{-8.85,0.0732328937312},{-8.75,0.0824769856978},{-8.65,0.0811347121713},{-8.55,0.0944124353343},{-8.45,0.0871569507093},{-8.35,0.0952244565531},{-8.25,0.0903762251466},{-8.15,0.10713519933},{-8.05,0.114543797057},{-7.95,0.0959796344533},{-7.85,0.116803928957},{-7.75,0.138921942892},{-7.65,0.11063050083},{-7.55,0.125872650925},{-7.45,0.128220227685},{-7.35,0.130436892715},{-7.25,0.134116594182},{-7.15,0.146427969331},{-7.05,0.147945154493},{-6.95,0.149588170073},{-6.85,0.164981967998},{-6.75,0.161909655521},{-6.65,0.153186172485},{-6.55,0.169996966835},{-6.45,0.173395787389},{-6.35,0.183187917501},{-6.25,0.176314532985},{-6.15,0.184563792029},{-6.05,0.202027185726},{-5.95,0.199034241424},{-5.85,0.214037864927},{-5.75,0.186836470797},{-5.65,0.199009438084},{-5.55,0.223087240409},{-5.45,0.223953179193},{-5.35,0.245358852171},{-5.25,0.229174174546},{-5.15,0.261457285487},{-5.05,0.244160892201},{-4.95,0.275198929398},{-4.85,0.291393713518},{-4.75,0.245409409948},{-4.65,0.258806046407},{-4.55,0.276958931397},{-4.45,0.270250356422},{-4.35,0.277417850494},{-4.25,0.266246384156},{-4.15,0.305689244488},{-4.05,0.288147086869},{-3.95,0.282611364606},{-3.85,0.309668184058},{-3.75,0.305733451504},{-3.65,0.351359167764},{-3.55,0.311204971092},{-3.45,0.310923840367},{-3.35,0.337881364018},{-3.25,0.346256843867},{-3.15,0.332663359465},{-3.05,0.335138197348},{-2.95,0.331558144158},{-2.85,0.343711554671},{-2.75,0.31524378844},{-2.65,0.338021643618},{-2.55,0.368625531878},{-2.45,0.34804575494},{-2.35,0.353879116951},{-2.25,0.373550287882},{-2.15,0.380752350365},{-2.05,0.35667975374},{-1.95,0.392993112628},{-1.85,0.417852322731},{-1.75,0.358164813584},{-1.65,0.415150390274},{-1.55,0.397937410859},{-1.45,0.373487753311},{-1.35,0.39488309495},{-1.25,0.393224400798},{-1.15,0.443602887322},{-1.05,0.410880423881},{-0.95,0.420279869666},{-0.85,0.405546047813},{-0.75,0.406071340005},{-0.65,0.404522348379},{-0.55,0.429086303711},{-0.45,0.430797325386},{-0.35,0.410897652308},{-0.25,0.411145567894},{-0.15,0.420572943649},{-0.05,0.432325441116},{0.05,0.425036833248},{0.15,0.442831692921},{0.25,0.443914811923},{0.35,0.42829767863},{0.45,0.449334052996},{0.55,0.413395393669},{0.65,0.446117744017},{0.75,0.449762447022},{0.85,0.444391400627},{0.95,0.447313346539},{1.05,0.429193896884},{1.15,0.496407015361},{1.25,0.464461235773},{1.35,0.465065687716},{1.45,0.455394103464},{1.55,0.471880774865},{1.65,0.416425736224},{1.75,0.431588153893},{1.85,0.492702996926},{1.95,0.473919435531},{2.05,0.467509417128},{2.15,0.495657452082},{2.25,0.449996142654},{2.35,0.42904178825},{2.45,0.461422152939},{2.55,0.439184398113},{2.65,0.410815447745},{2.75,0.471726253115},{2.85,0.46537240674},{2.95,0.458709348481},{3.05,0.434293481688},{3.15,0.455005538296},{3.25,0.444864837965},{3.35,0.424603245622},{3.45,0.512106959025},{3.55,0.482088856488},{3.65,0.447411099771},{3.75,0.468005737305},{3.85,0.428915931044},{3.95,0.458501076212},{4.05,0.449421380491},{4.15,0.44274255572},{4.25,0.399643233328},{4.35,0.457402411567},{4.45,0.429686130621},{4.55,0.404890769769},{4.65,0.43500771956},{4.75,0.401716404207},{4.85,0.394512556332},{4.95,0.401744322343},{5.05,0.476362906562},{5.15,0.381898435828},{5.25,0.403248763203},{5.35,0.371594795119},{5.45,0.42184147305},{5.55,0.410288662381},{5.65,0.429498511625},{5.75,0.402941475138},{5.85,0.376903210656},{5.95,0.366081151095},{6.05,0.424108871042},{6.15,0.352644101311},{6.25,0.308884666565},{6.35,0.355071486941},{6.45,0.380328726261},{6.55,0.366827628595},{6.65,0.319900636549},{6.75,0.3549411745},{6.85,0.338765825544},{6.95,0.320398938214},{7.05,0.279365436451},{7.15,0.339111262916},{7.25,0.327505572089},{7.35,0.288391113281},{7.45,0.322478677625},{7.55,0.275137412448},{7.65,0.30374378834},{7.75,0.281506729126},{7.85,0.240691617004},{7.95,0.315642323213},{8.05,0.282575671592},{8.15,0.277026077797},{8.25,0.233157757631},{8.35,0.262433911547},{8.45,0.253339043146},{8.55,0.211346753438},{8.65,0.22771021686},{8.75,0.21155898571},{8.85,0.179927392439},{8.95,0.237485053047},{9.05,0.178196665607},{9.15,0.198741927076},{9.25,0.235904603634},{9.35,0.18569907546},{9.45,0.191246460224},{9.55,0.1417496433},{9.65,0.156040645781},{9.75,0.150123346047},{9.85,0.171367252574},{9.95,0.151828891826},{10.05,0.164295694102},{10.15,0.138449476315},{10.25,0.149854342143},{10.35,0.154413153486},{10.45,0.123718202114},{10.55,0.140327239037},{10.65,0.152476964678},{10.75,0.159430339932},{10.85,0.148122608662},{10.95,0.117717629985},{11.05,0.177490830421},{11.15,0.15423481281},{11.25,0.118122324347},{11.35,0.150317470233},{11.45,0.151014382189},{11.55,0.122246632209},{11.65,0.142591760272},{11.75,0.134453512373},{11.85,0.115331318067},{11.95,0.131481020074},{12.05,0.104151346467},{12.15,0.132335275412},{12.25,0.0934971457436},{12.35,0.112468458712},{12.45,0.0845053017139},{12.55,0.0734431062426},{12.65,0.0782611105177},{12.75,0.145635869768},{12.85,0.149783983827},{12.95,0.165853381157},{13.05,0.0943839875135},{13.15,0.0703782622631},{13.25,0.0742715150118},{13.35,0.0789105832577},{13.45,0.104379074914},{13.55,0.0824246779084},{13.65,0.205696364244},{13.75,0.063091357549},{13.85,0.0855444570382},{13.95,0.0517720222473},{14.05,0.0333615413734},{14.15,0.0405547499657},{14.25,0.0478752031922},{14.35,0.126832177242},{14.45,0.0467220629965},{14.55,0.0437000393867},{14.65,0.0449989785751},{14.75,0.117739602923},{14.85,0.109806790948},{14.95,0.0640191684167},{15.05,0.0574316879114},{15.15,0.0324966870248},{15.25,0.0163030177355},{15.35,0.0},{15.45,0.0156429439783},{15.55,0.0193913131952},{15.65,0.0142883360386},{15.75,0.0},{15.85,0.0281127654016},{15.95,0.0115512851626},{16.05,0.00563647039235},{16.15,0.00424474943429},{16.25,0.0057524467508},{16.35,0.00236592581496},{16.45,0.0041751631846},{16.55,0.00807198230177},{16.65,0.00528853992},{16.75,0.00640191696584},{16.85,0.00695860525593},{16.95,0.00389681896195},{17.05,0.00306178629398},{17.15,0.00278344214894},{17.25,0.000649469826991},{17.35,0.0},{17.45,0.00111337681301},{17.55,0.0},{17.65,0.00139172107447},{17.75,0.0},{17.85,0.0},{17.95,0.0},{18.05,0.0},{18.15,0.0},{18.25,0.0},{18.35,0.0},{18.45,0.0},{18.55,0.000417516304879},{18.65,9.27814010841e-05},{18.75,0.000835032609757},{18.85,0.0},{18.95,0.0},{19.05,0.0},{19.15,0.0},{19.25,0.0},{19.35,0.0},{19.45,0.0},{19.55,0.0},{19.65,0.0},{19.75,0.0},{19.85,0.0},{19.95,0.0},{20.05,0.0},{20.15,0.0},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.0},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU41 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.0},{-21.35,0.0},{-21.25,0.0},{-21.15,0.0},{-21.05,0.0},{-20.95,0.0},{-20.85,0.0},{-20.75,0.0},{-20.65,0.0},{-20.55,0.0},{-20.45,0.0},{-20.35,0.0},{-20.25,0.0},{-20.15,0.0},{-20.05,0.0},{-19.95,0.0},{-19.85,0.0},{-19.75,0.0},{-19.65,0.0},{-19.55,0.0},{-19.45,0.0},{-19.35,0.0},{-19.25,0.0},{-19.15,0.000139172101626},{-19.05,0.0},{-18.95,0.0},{-18.85,0.0},{-18.75,0.0},{-18.65,0.0},{-18.55,0.0},{-18.45,0.000278344203252},{-18.35,0.000139172101626},{-18.25,0.000278344203252},{-18.15,0.000139172101626},{-18.05,0.0},{-17.95,0.000139172101626},{-17.85,0.000835032609757},{-17.75,0.00111337681301},{-17.65,0.0},{-17.55,0.000417516304879},{-17.45,0.000139172101626},{-17.35,0.000278344203252},{-17.25,0.000556688406505},{-17.15,0.000167006521951},{-17.05,0.000198817296353},{-16.95,0.000445350725204},{-16.85,0.00125254900195},{-16.75,0.000556688406505},{-16.65,0.000890701450408},{-16.55,0.00125254900195},{-16.45,0.00100203920156},{-16.35,0.00148450241735},{-16.25,0.00176284664},{-16.15,0.00160047924146},{-16.05,0.00201799557544},{-15.95,0.000795269185411},{-15.85,0.00173965131398},{-15.75,0.0018291191331},{-15.65,0.00182470099794},{-15.55,0.00146763314578},{-15.45,0.00194840945981},{-15.35,0.00290715073546},{-15.25,0.00353497155011},{-15.15,0.0024123165446},{-15.05,0.0050658646971},{-14.95,0.0097420476377},{-14.85,0.00707458208005},{-14.75,0.0158656196935},{-14.65,0.0079901165822},{-14.55,0.0102987355656},{-14.45,0.0109536630266},{-14.35,0.0100082897622},{-14.25,0.0141809049406},{-14.15,0.0153506830335},{-14.05,0.0201553947785},{-13.95,0.0270192708288},{-13.85,0.021022311951},{-13.75,0.0266555512653},{-13.65,0.0190549803277},{-13.55,0.0259973496199},{-13.45,0.0210050472191},{-13.35,0.0223103601199},{-13.25,0.0220947717798},{-13.15,0.0222768147786},{-13.05,0.0290925359726},{-12.95,0.0214557001988},{-12.85,0.0297444380563},{-12.75,0.0258473522133},{-12.65,0.0305503859664},{-12.55,0.0262526099275},{-12.45,0.04284438822},{-12.35,0.0431433546132},{-12.25,0.0357484237568},{-12.15,0.0322384436925},{-12.05,0.0402134123601},{-11.95,0.0428943069358},{-11.85,0.0438086637637},{-11.75,0.0463840734391},{-11.65,0.0472999572754},{-11.55,0.0449699858824},{-11.45,0.0490929583708},{-11.35,0.0367295060839},{-11.25,0.0389762581259},{-11.15,0.0446481518447},{-11.05,0.0468546095349},{-10.95,0.0553221326125},{-10.85,0.0531272419163},{-10.75,0.0611462593079},{-10.65,0.0489428271986},{-10.55,0.0622238477071},{-10.45,0.0521394379934},{-10.35,0.0589363609535},{-10.25,0.0515864576612},{-10.15,0.0618953639514},{-10.05,0.0684567723955},{-9.95,0.0629128383685},{-9.85,0.0561574266312},{-9.75,0.063206029742},{-9.65,0.0689016510459},{-9.55,0.0610501625959},{-9.45,0.0687336226304},{-9.35,0.0598677936782},{-9.25,0.0603305421224},{-9.15,0.0843471770591},{-9.05,0.0649016698201},{-8.95,0.0745915725452},{-8.85,0.0802321230244},{-8.75,0.080241065979},{-8.65,0.0914469677469},{-8.55,0.0873761624098},{-8.45,0.0928633933844},{-8.35,0.105992535413},{-8.25,0.0946449252731},{-8.15,0.101040935516},{-8.05,0.108729721843},{-7.95,0.0985044574145},{-7.85,0.122886924183},{-7.75,0.108352277337},{-7.65,0.11421846027},{-7.55,0.123163831234},{-7.45,0.120199644497},{-7.35,0.104363247117},{-7.25,0.141320786825},{-7.15,0.130467117474},{-7.05,0.128609079303},{-6.95,0.156938932095},{-6.85,0.137008861431},{-6.75,0.182588647913},{-6.65,0.160105611376},{-6.55,0.145228279011},{-6.45,0.168664073944},{-6.35,0.173135551752},{-6.25,0.166537128795},{-6.15,0.188348535246},{-6.05,0.18131089644},{-5.95,0.189313461791},{-5.85,0.202267798308},{-5.75,0.181022107841},{-5.65,0.218701447679},{-5.55,0.199076821284},{-5.45,0.231921284287},{-5.35,0.232997928654},{-5.25,0.220259615423},{-5.15,0.243853937116},{-5.05,0.216596956073},{-4.95,0.255201876422},{-4.85,0.23028976267},{-4.75,0.242883371752},{-4.65,0.263464729153},{-4.55,0.264632145247},{-4.45,0.266195631213},{-4.35,0.25062252031},{-4.25,0.271029547925},{-4.15,0.268824038298},{-4.05,0.269480630861},{-3.95,0.317126091159},{-3.85,0.33718923795},{-3.75,0.287162028568},{-3.65,0.287856871506},{-3.55,0.327321008536},{-3.45,0.301485573373},{-3.35,0.350523364403},{-3.25,0.282165360451},{-3.15,0.32789343976},{-3.05,0.348305883018},{-2.95,0.305372140346},{-2.85,0.346149853298},{-2.75,0.34509799355},{-2.65,0.331663725392},{-2.55,0.37152146945},{-2.45,0.328030434384},{-2.35,0.352147600065},{-2.25,0.349576440188},{-2.15,0.38277797699},{-2.05,0.34495418488},{-1.95,0.338142817571},{-1.85,0.362386026289},{-1.75,0.375672836304},{-1.65,0.384523553363},{-1.55,0.380661137476},{-1.45,0.39558337486},{-1.35,0.37847944978},{-1.25,0.362614839994},{-1.15,0.38987508573},{-1.05,0.388029891175},{-0.95,0.405000192148},{-0.85,0.401435953102},{-0.75,0.419615410114},{-0.65,0.39059163054},{-0.55,0.402930540197},{-0.45,0.374592928901},{-0.35,0.421355370762},{-0.25,0.389075321222},{-0.15,0.413171001447},{-0.05,0.427192583476},{0.05,0.484384728957},{0.15,0.352354753521},{0.25,0.426742527672},{0.35,0.415981254704},{0.45,0.436213705275},{0.55,0.399014448508},{0.65,0.427328893583},{0.75,0.46802847726},{0.85,0.424365291857},{0.95,0.417808712532},{1.05,0.396353232555},{1.15,0.429184465043},{1.25,0.408020247653},{1.35,0.442168495872},{1.45,0.463982739211},{1.55,0.413812722537},{1.65,0.44924232655},{1.75,0.437884555143},{1.85,0.392740902315},{1.95,0.489233615508},{2.05,0.407920757093},{2.15,0.460808868408},{2.25,0.421300149052},{2.35,0.453204725641},{2.45,0.434958487749},{2.55,0.437803419809},{2.65,0.442345533914},{2.75,0.418517504552},{2.85,0.387600418425},{2.95,0.480512776506},{3.05,0.4194838798},{3.15,0.440449714661},{3.25,0.397105884175},{3.35,0.476280395801},{3.45,0.422371607241},{3.55,0.433029278371},{3.65,0.404809655814},{3.75,0.442163750315},{3.85,0.468587410882},{3.95,0.411964948787},{4.05,0.435908025234},{4.15,0.418049793617},{4.25,0.422078631251},{4.35,0.395229858102},{4.45,0.394178107233},{4.55,0.409170371608},{4.65,0.392955681203},{4.75,0.412666278178},{4.85,0.393940701511},{4.95,0.444424110123},{5.05,0.344306175155},{5.15,0.390063386805},{5.25,0.357426452637},{5.35,0.410537569146},{5.45,0.366569266262},{5.55,0.411032643352},{5.65,0.391760832688},{5.75,0.41083605731},{5.85,0.316200687772},{5.95,0.353689690159},{6.05,0.363965763765},{6.15,0.369486940824},{6.25,0.334531424702},{6.35,0.334519522531},{6.45,0.385980657629},{6.55,0.300365921355},{6.65,0.335319842322},{6.75,0.316526063283},{6.85,0.403076426188},{6.95,0.321876737807},{7.05,0.274868358265},{7.15,0.290796314586},{7.25,0.285448484332},{7.35,0.28352735575},{7.45,0.249767544033},{7.55,0.338687798916},{7.65,0.285948059776},{7.75,0.254625726253},{7.85,0.249595222892},{7.95,0.233718374501},{8.05,0.238220569699},{8.15,0.296179337935},{8.25,0.26274899074},{8.35,0.225860050746},{8.45,0.225123261752},{8.55,0.227984372307},{8.65,0.198764092213},{8.75,0.204940269242},{8.85,0.17500704688},{8.95,0.254441400369},{9.05,0.227412672604},{9.15,0.175069532087},{9.25,0.17175693512},{9.35,0.192274608612},{9.45,0.141281425953},{9.55,0.176095320254},{9.65,0.177379491594},{9.75,0.142375685134},{9.85,0.162141832438},{9.95,0.19655194002},{10.05,0.162117664631},{10.15,0.235033855438},{10.25,0.138385784626},{10.35,0.138088025545},{10.45,0.128159669729},{10.55,0.142849618738},{10.65,0.169875603456},{10.75,0.212446212769},{10.85,0.120986952926},{10.95,0.124354918798},{11.05,0.0941169701124},{11.15,0.18023519767},{11.25,0.108665577571},{11.35,0.100658543905},{11.45,0.160187098715},{11.55,0.148589412371},{11.65,0.108229508003},{11.75,0.167711671193},{11.85,0.113153548468},{11.95,0.11574723846},{12.05,0.110827386379},{12.15,0.126275491714},{12.25,0.129469820431},{12.35,0.119091561862},{12.45,0.086614166989},{12.55,0.0675958931446},{12.65,0.0797282233834},{12.75,0.0721085444093},{12.85,0.107635700703},{12.95,0.11248199145},{13.05,0.102894577715},{13.15,0.0912350482411},{13.25,0.0718634128571},{13.35,0.0997665183885},{13.45,0.0487698827471},{13.55,0.156151100993},{13.65,0.110001635551},{13.75,0.0522452056408},{13.85,0.0703017967088},{13.95,0.0793280998866},{14.05,0.045122689671},{14.15,0.0422155393495},{14.25,0.0442915223539},{14.35,0.0472389885357},{14.45,0.0610687196255},{14.55,0.0387296080589},{14.65,0.0521617054939},{14.75,0.032168637429},{14.85,0.0520503669977},{14.95,0.0370197802782},{15.05,0.0786322429776},{15.15,0.0457412302494},{15.25,0.0},{15.35,0.0448134168983},{15.45,0.0},{15.55,0.0150305877129},{15.65,0.018092373386},{15.75,0.00911577325314},{15.85,0.0314528942108},{15.95,0.0},{16.05,0.00765446573496},{16.15,0.00681943306699},{16.25,0.00352569328},{16.35,0.00157728387664},{16.45,0.0102987354621},{16.55,0.0},{16.65,0.00375764677301},{16.75,0.0},{16.85,0.0},{16.95,0.00208758166991},{17.05,0.0},{17.15,0.00501019600779},{17.25,0.00222675362602},{17.35,0.000278344203252},{17.45,0.0},{17.55,0.0},{17.65,0.0},{17.75,0.00139172107447},{17.85,0.0},{17.95,0.0},{18.05,0.00139172107447},{18.15,0.0},{18.25,0.0},{18.35,0.0},{18.45,0.000278344203252},{18.55,0.0},{18.65,0.0},{18.75,0.0},{18.85,0.0},{18.95,0.0},{19.05,0.0},{19.15,0.0},{19.25,0.0},{19.35,0.0},{19.45,0.0},{19.55,0.0},{19.65,0.0},{19.75,0.0},{19.85,0.0},{19.95,0.0},{20.05,0.0},{20.15,0.0},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.0},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU42 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.0},{-21.35,0.0},{-21.25,0.0},{-21.15,0.0},{-21.05,0.0},{-20.95,0.0},{-20.85,0.0},{-20.75,0.0},{-20.65,0.0},{-20.55,0.0},{-20.45,0.0},{-20.35,0.0},{-20.25,0.0},{-20.15,0.0},{-20.05,0.0},{-19.95,0.0},{-19.85,0.0},{-19.75,0.0},{-19.65,0.0},{-19.55,0.0},{-19.45,0.0},{-19.35,0.0},{-19.25,0.0},{-19.15,0.0},{-19.05,0.0},{-18.95,0.0},{-18.85,0.0},{-18.75,0.0},{-18.65,0.000556688406505},{-18.55,0.0},{-18.45,0.000139172101626},{-18.35,0.000139172101626},{-18.25,0.000278344203252},{-18.15,0.000139172101626},{-18.05,0.0},{-17.95,0.0},{-17.85,0.000278344203252},{-17.75,6.95860508131e-05},{-17.65,0.0},{-17.55,9.27814010841e-05},{-17.45,0.000463907024823},{-17.35,0.000278344203252},{-17.25,0.00111337681301},{-17.15,0.000185562802168},{-17.05,0.000139172101626},{-16.95,0.000371125604336},{-16.85,0.000357871143413},{-16.75,0.000556688429788},{-16.65,0.000432979884661},{-16.55,0.000695860537235},{-16.45,0.000516924973843},{-16.35,0.000946370325983},{-16.25,0.000974204740487},{-16.15,0.00194840948097},{-16.05,0.00157728387664},{-15.95,0.00389681896195},{-15.85,0.00133605217561},{-15.75,0.00269066076726},{-15.65,0.00231953508531},{-15.55,0.00176284669174},{-15.45,0.00591481430456},{-15.35,0.00674984697253},{-15.25,0.00179995919267},{-15.15,0.00481137846197},{-15.05,0.00839671678841},{-14.95,0.00637098981274},{-14.85,0.0182593807578},{-14.75,0.00888381960491},{-14.65,0.00807198230177},{-14.55,0.00966018175378},{-14.45,0.0213706493378},{-14.35,0.0173965128405},{-14.25,0.0246334627271},{-14.15,0.0153968302827},{-14.05,0.0218500196934},{-13.95,0.028483889997},{-13.85,0.0216944743605},{-13.75,0.0288921296597},{-13.65,0.0286868494004},{-13.55,0.0225326262769},{-13.45,0.0309657938778},{-13.35,0.0203940662054},{-13.25,0.0396176576614},{-13.15,0.0304985727583},{-13.05,0.0297344223313},{-12.95,0.029440253973},{-12.85,0.0286992767027},{-12.75,0.0582110524178},{-12.65,0.0311457576423},{-12.55,0.0397252845764},{-12.45,0.0326619520783},{-12.35,0.0281263415406},{-12.25,0.0388638116419},{-12.15,0.0375355341855},{-12.05,0.0450917636195},{-11.95,0.0403749556155},{-11.85,0.0418658225964},{-11.75,0.0522714046871},{-11.65,0.0464626073837},{-11.55,0.0401724552622},{-11.45,0.0368086222945},{-11.35,0.0506586486643},{-11.25,0.054057032563},{-11.15,0.0494088238361},{-11.05,0.0501287212739},{-10.95,0.0485128662803},{-10.85,0.0471109374095},{-10.75,0.0556530862484},{-10.65,0.0581161705953},{-10.55,0.0460381337575},{-10.45,0.054640766113},{-10.35,0.0431131713362},{-10.25,0.0503993654904},{-10.15,0.064200091362},{-10.05,0.0539802233378},{-9.95,0.0491485486085},{-9.85,0.0605608339179},{-9.75,0.0513545067414},{-9.65,0.0555791536967},{-9.55,0.0696714083354},{-9.45,0.0624960942215},{-9.35,0.0564255066288},{-9.25,0.0608700583963},{-9.15,0.0723476034872},{-9.05,0.0849362184972},{-8.95,0.0729679346085},{-8.85,0.0748905000233},{-8.75,0.0719104733383},{-8.65,0.0836424369078},{-8.55,0.0902462847093},{-8.45,0.0775144440787},{-8.35,0.0889093793672},{-8.25,0.0966098601358},{-8.15,0.0956330890498},{-8.05,0.102304362449},{-7.95,0.125672413753},{-7.85,0.108256014567},{-7.75,0.108782359532},{-7.65,0.127286807696},{-7.55,0.0986509555724},{-7.45,0.11453396842},{-7.35,0.123744162198},{-7.25,0.123777100914},{-7.15,0.121545920343},{-7.05,0.152382286796},{-6.95,0.146285754722},{-6.85,0.151614087423},{-6.75,0.149449968338},{-6.65,0.164731840424},{-6.55,0.134361345743},{-6.45,0.140778714511},{-6.35,0.164519128083},{-6.25,0.165178733402},{-6.15,0.195487481129},{-6.05,0.184938935028},{-5.95,0.193970303203},{-5.85,0.18898810715},{-5.75,0.194801825446},{-5.65,0.225887298584},{-5.55,0.184857838462},{-5.45,0.200381393433},{-5.35,0.229847734146},{-5.25,0.248804114586},{-5.15,0.230291613643},{-5.05,0.225158522282},{-4.95,0.224390292055},{-4.85,0.21496671491},{-4.75,0.240470572946},{-4.65,0.260285579797},{-4.55,0.260183614843},{-4.45,0.241476593018},{-4.35,0.240337682896},{-4.25,0.251409239123},{-4.15,0.241218332384},{-4.05,0.276806330572},{-3.95,0.27321507122},{-3.85,0.2924701726},{-3.75,0.280214638546},{-3.65,0.281773181672},{-3.55,0.282232883086},{-3.45,0.28199005127},{-3.35,0.336768519935},{-3.25,0.282219113327},{-3.15,0.285156041384},{-3.05,0.309199986121},{-2.95,0.32578389398},{-2.85,0.304991252839},{-2.75,0.323384214039},{-2.65,0.307524132452},{-2.55,0.330298752081},{-2.45,0.31149160953},{-2.35,0.336769352114},{-2.25,0.338508082974},{-2.15,0.376968383789},{-2.05,0.328928503371},{-1.95,0.325012577114},{-1.85,0.347948971473},{-1.75,0.332572509993},{-1.65,0.358570539619},{-1.55,0.384514824819},{-1.45,0.373043729821},{-1.35,0.347407061355},{-1.25,0.395964180155},{-1.15,0.376514756536},{-1.05,0.339949381437},{-0.95,0.367051113526},{-0.85,0.364542750002},{-0.75,0.395512283825},{-0.65,0.413422864549},{-0.55,0.402653199508},{-0.45,0.37082195282},{-0.35,0.375633004995},{-0.25,0.362397985705},{-0.15,0.440566469201},{-0.05,0.388537712248},{0.05,0.389530662477},{0.15,0.389504380113},{0.25,0.400333358209},{0.35,0.400679306463},{0.45,0.375231193774},{0.55,0.419642379436},{0.65,0.3667986845},{0.75,0.410834884644},{0.85,0.387632256911},{0.95,0.394751579531},{1.05,0.412017564733},{1.15,0.377144540003},{1.25,0.400969796929},{1.35,0.408551523241},{1.45,0.385999687225},{1.55,0.435581991117},{1.65,0.411957914933},{1.75,0.409187680199},{1.85,0.387104349688},{1.95,0.402207378701},{2.05,0.490978342964},{2.15,0.384381612142},{2.25,0.405802157962},{2.35,0.416568114379},{2.45,0.386119326129},{2.55,0.473331100876},{2.65,0.451801935832},{2.75,0.340502583173},{2.85,0.419957706584},{2.95,0.428253252078},{3.05,0.412339675367},{3.15,0.371120942842},{3.25,0.38006842477},{3.35,0.333021675272},{3.45,0.369598498185},{3.55,0.37534717522},{3.65,0.368407075628},{3.75,0.385912523772},{3.85,0.385485782418},{3.95,0.398626640018},{4.05,0.388560691576},{4.15,0.358094997507},{4.25,0.407984306476},{4.35,0.397017870944},{4.45,0.395967245102},{4.55,0.385129237175},{4.65,0.390825800742},{4.75,0.353008795641},{4.85,0.358578225841},{4.95,0.38276904903},{5.05,0.385781119056},{5.15,0.330171549542},{5.25,0.393495836331},{5.35,0.334328511556},{5.45,0.319898592715},{5.55,0.384465783592},{5.65,0.351466748142},{5.75,0.36974402035},{5.85,0.380615813392},{5.95,0.326975544607},{6.05,0.337699922465},{6.15,0.327740879382},{6.25,0.31089887619},{6.35,0.381076893908},{6.45,0.276198264091},{6.55,0.328032767419},{6.65,0.304163941883},{6.75,0.32041228445},{6.85,0.314540924564},{6.95,0.355371571794},{7.05,0.250954619078},{7.15,0.298055451492},{7.25,0.261516226099},{7.35,0.298931121826},{7.45,0.286046233358},{7.55,0.206857919693},{7.65,0.319212973118},{7.75,0.284657381583},{7.85,0.282894712506},{7.95,0.240809105538},{8.05,0.262178510427},{8.15,0.232818561442},{8.25,0.256897554559},{8.35,0.192700708235},{8.45,0.26722158432},{8.55,0.220702539411},{8.65,0.214096409934},{8.75,0.188420470556},{8.85,0.209746005488},{8.95,0.168727620443},{9.05,0.16853245667},{9.15,0.203735308214},{9.25,0.234497255749},{9.35,0.172355579293},{9.45,0.198972162447},{9.55,0.254635248865},{9.65,0.227320835508},{9.75,0.197954922915},{9.85,0.134237820452},{9.95,0.198200958116},{10.05,0.175496021907},{10.15,0.134803652763},{10.25,0.136626075296},{10.35,0.193303999693},{10.45,0.122987214257},{10.55,0.104913793112},{10.65,0.121393988209},{10.75,0.100265767839},{10.85,0.145634526792},{10.95,0.147560390559},{11.05,0.121792287827},{11.15,0.109049072972},{11.25,0.14413834873},{11.35,0.13039034605},{11.45,0.131847256108},{11.55,0.139270347707},{11.65,0.186606605848},{11.75,0.119363281462},{11.85,0.167493621508},{11.95,0.192836868763},{12.05,0.140049961897},{12.15,0.105909973383},{12.25,0.154842889309},{12.35,0.183637589216},{12.45,0.131656813622},{12.55,0.0763880908489},{12.65,0.165018354143},{12.75,0.167516827583},{12.85,0.104069809119},{12.95,0.0815801566297},{13.05,0.0678927898407},{13.15,0.0595228396929},{13.25,0.0949153751135},{13.35,0.0950744322368},{13.45,0.153576418757},{13.55,0.0798450282642},{13.65,0.0669765770435},{13.75,0.160326262315},{13.85,0.119757592678},{13.95,0.0877340972424},{14.05,0.390795260668},{14.15,0.0},{14.25,0.0812765061855},{14.35,0.312302201986},{14.45,0.0914824604988},{14.55,0.0864722728729},{14.65,0.117322087288},{14.75,0.070328305165},{14.85,0.0},{14.95,0.0585450679064},{15.05,0.0286694526672},{15.15,0.0583131127059},{15.25,0.050658646971},{15.35,0.0},{15.45,0.0556688420475},{15.55,0.0},{15.65,0.00937092180053},{15.75,0.0139172105119},{15.85,0.00988121982664},{15.95,0.00807198230177},{16.05,0.0},{16.15,0.0},{16.25,0.00306178629398},{16.35,0.00320095848292},{16.45,0.0},{16.55,0.00473185162991},{16.65,0.0},{16.75,0.0},{16.85,0.0},{16.95,0.0},{17.05,0.0},{17.15,0.0},{17.25,0.0},{17.35,0.0},{17.45,0.0},{17.55,0.0},{17.65,0.0},{17.75,0.0},{17.85,0.0},{17.95,0.000278344203252},{18.05,0.0},{18.15,0.0},{18.25,0.0},{18.35,0.0},{18.45,0.0},{18.55,0.0},{18.65,0.0},{18.75,0.0},{18.85,0.0},{18.95,0.0},{19.05,0.0},{19.15,0.0},{19.25,0.0},{19.35,0.0},{19.45,0.0},{19.55,0.0},{19.65,0.0},{19.75,0.0},{19.85,0.0},{19.95,0.0},{20.05,0.0},{20.15,0.0},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.0},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU43 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.0},{-21.35,0.0},{-21.25,0.0},{-21.15,0.0},{-21.05,0.0},{-20.95,0.0},{-20.85,0.0},{-20.75,0.0},{-20.65,0.0},{-20.55,0.0},{-20.45,0.0},{-20.35,0.0},{-20.25,0.0},{-20.15,0.0},{-20.05,0.0},{-19.95,0.0},{-19.85,0.0},{-19.75,0.0},{-19.65,0.0},{-19.55,0.0},{-19.45,0.0},{-19.35,0.0},{-19.25,0.0},{-19.15,0.000278344203252},{-19.05,0.0},{-18.95,0.0},{-18.85,0.0},{-18.75,0.0},{-18.65,0.0},{-18.55,0.000556688406505},{-18.45,0.0},{-18.35,0.000139172101626},{-18.25,9.27814010841e-05},{-18.15,0.0},{-18.05,0.0},{-17.95,0.0},{-17.85,0.000139172101626},{-17.75,0.0},{-17.65,0.000556688406505},{-17.55,0.000371125604336},{-17.45,0.000278344203252},{-17.35,0.000278344214894},{-17.25,0.0},{-17.15,0.000139172101626},{-17.05,0.00139172107447},{-16.95,0.000139172101626},{-16.85,0.000649469826991},{-16.75,0.00389681896195},{-16.65,0.0},{-16.55,0.00153089314699},{-16.45,0.000695860537235},{-16.35,0.00334013043903},{-16.25,0.00104379083496},{-16.15,0.00111337685958},{-16.05,0.00148450241735},{-15.95,0.000939411693253},{-15.85,0.0015030587092},{-15.75,0.00584522821009},{-15.65,0.00354888872243},{-15.55,0.00258462476943},{-15.45,0.00334013067186},{-15.35,0.00411949418485},{-15.25,0.00514936773106},{-15.15,0.0078632235527},{-15.05,0.00801631361246},{-14.95,0.0114121124148},{-14.85,0.00825754470295},{-14.75,0.010020391643},{-14.65,0.0141337000661},{-14.55,0.0130125917494},{-14.45,0.0174850767309},{-14.35,0.0181387638052},{-14.25,0.0252179861069},{-14.15,0.0456948429346},{-14.05,0.0193275269121},{-13.95,0.0209106095135},{-13.85,0.0322626233101},{-13.75,0.0285623990572},{-13.65,0.0332514276871},{-13.55,0.0273432258297},{-13.45,0.0295863537227},{-13.35,0.0335230790079},{-13.25,0.0500766526569},{-13.15,0.038220141083},{-13.05,0.0424567699432},{-12.95,0.0403135187096},{-12.85,0.0520304867199},{-12.75,0.0387176781893},{-12.65,0.0415395583425},{-12.55,0.0393433493117},{-12.45,0.0419835845629},{-12.35,0.0455395346103},{-12.25,0.0358435530816},{-12.15,0.0429047729288},{-12.05,0.052259127299},{-11.95,0.0377116646085},{-11.85,0.0446025494373},{-11.75,0.0527091145515},{-11.65,0.0515023767948},{-11.55,0.0773796879727},{-11.45,0.068949835641},{-11.35,0.0612357240735},{-11.25,0.0603370734624},{-11.15,0.0658202171326},{-11.05,0.0519175204364},{-10.95,0.0484492878119},{-10.85,0.0554709063636},{-10.75,0.0435848647151},{-10.65,0.0549133359169},{-10.55,0.0434782356024},{-10.45,0.0725156247616},{-10.35,0.0553803747351},{-10.25,0.065254320701},{-10.15,0.0683624992768},{-10.05,0.056587378184},{-9.95,0.0645960981196},{-9.85,0.0648925921013},{-9.75,0.0615749582648},{-9.65,0.0640320117657},{-9.55,0.0776726823104},{-9.45,0.0993274323484},{-9.35,0.0663775688893},{-9.25,0.0730241923265},{-9.15,0.0777325227227},{-9.05,0.0767644016366},{-8.95,0.071153739403},{-8.85,0.0855221875509},{-8.75,0.0908976981514},{-8.65,0.0829081809384},{-8.55,0.0866244723288},{-8.45,0.088755094088},{-8.35,0.0952555762397},{-8.25,0.105459706924},{-8.15,0.0934425835471},{-8.05,0.0943847014525},{-7.95,0.106747789383},{-7.85,0.105799416515},{-7.75,0.102137806105},{-7.65,0.109323924521},{-7.55,0.131210355475},{-7.45,0.130767153802},{-7.35,0.140441885449},{-7.25,0.157997257855},{-7.15,0.13783934965},{-7.05,0.14306658256},{-6.95,0.158198918615},{-6.85,0.138659035982},{-6.75,0.170483388399},{-6.65,0.161729025462},{-6.55,0.149251306561},{-6.45,0.188196377876},{-6.35,0.169321284575},{-6.25,0.17036454337},{-6.15,0.179207616573},{-6.05,0.174875388274},{-5.95,0.195567061936},{-5.85,0.175196802616},{-5.75,0.184893249706},{-5.65,0.222695841509},{-5.55,0.229629855686},{-5.45,0.206477874365},{-5.35,0.219388334375},{-5.25,0.23593293804},{-5.15,0.205291660353},{-5.05,0.215177868688},{-4.95,0.234688841266},{-4.85,0.249690717952},{-4.75,0.240403243474},{-4.65,0.251594497218},{-4.55,0.280168106681},{-4.45,0.241324430013},{-4.35,0.257151658508},{-4.25,0.260985656218},{-4.15,0.278864663028},{-4.05,0.267504170455},{-3.95,0.274102922303},{-3.85,0.254503125521},{-3.75,0.272292428268},{-3.65,0.291028745882},{-3.55,0.325684512954},{-3.45,0.270678838094},{-3.35,0.324340180855},{-3.25,0.332540423371},{-3.15,0.292303382452},{-3.05,0.285638699165},{-2.95,0.303432963002},{-2.85,0.319104234378},{-2.75,0.343569023174},{-2.65,0.297882387423},{-2.55,0.352937383966},{-2.45,0.322514146861},{-2.35,0.293289421929},{-2.25,0.349352571977},{-2.15,0.379046965181},{-2.05,0.350836455516},{-1.95,0.353903283878},{-1.85,0.350294799805},{-1.75,0.386023891428},{-1.65,0.405218557878},{-1.55,0.358886794664},{-1.45,0.354311896759},{-1.35,0.352623315958},{-1.25,0.381376050182},{-1.15,0.378697893946},{-1.05,0.409529514},{-0.95,0.382827334934},{-0.85,0.426904956946},{-0.75,0.418517149211},{-0.65,0.372296194428},{-0.55,0.408401650726},{-0.45,0.390817777075},{-0.35,0.395937549825},{-0.25,0.34350740542},{-0.15,0.376997177417},{-0.05,0.380555976942},{0.05,0.370524712329},{0.15,0.412287527354},{0.25,0.426288687665},{0.35,0.376273415305},{0.45,0.46201207778},{0.55,0.42244720459},{0.65,0.406255652867},{0.75,0.400450251653},{0.85,0.434380891588},{0.95,0.425147218131},{1.05,0.427478580684},{1.15,0.363701334539},{1.25,0.412260534929},{1.35,0.424893993802},{1.45,0.433219042691},{1.55,0.468949871299},{1.65,0.439552708676},{1.75,0.409730296317},{1.85,0.419691182799},{1.95,0.434570626652},{2.05,0.411059647464},{2.15,0.380414912838},{2.25,0.47546720189},{2.35,0.430637290261},{2.45,0.429155861459},{2.55,0.374994011335},{2.65,0.469424656459},{2.75,0.392185365534},{2.85,0.431181932107},{2.95,0.378425641741},{3.05,0.462349314085},{3.15,0.397783067491},{3.25,0.446795369538},{3.35,0.39949353536},{3.45,0.478106890538},{3.55,0.43601918392},{3.65,0.447215431615},{3.75,0.398119323108},{3.85,0.382050470011},{3.95,0.451209320068},{4.05,0.412524806919},{4.15,0.404467369193},{4.25,0.364017042395},{4.35,0.341890937404},{4.45,0.416961920066},{4.55,0.39552935791},{4.65,0.397452714013},{4.75,0.341562394616},{4.85,0.397785055226},{4.95,0.401275430407},{5.05,0.416941070557},{5.15,0.412446660903},{5.25,0.402296566269},{5.35,0.315716841089},{5.45,0.339197507112},{5.55,0.405364949216},{5.65,0.389418338207},{5.75,0.331807109797},{5.85,0.374530294667},{5.95,0.352866436573},{6.05,0.336239814758},{6.15,0.294983891078},{6.25,0.286841740975},{6.35,0.3669246239},{6.45,0.331753163111},{6.55,0.332535425822},{6.65,0.33465288831},{6.75,0.388390213251},{6.85,0.414981908966},{6.95,0.312744506418},{7.05,0.305045922597},{7.15,0.291449573305},{7.25,0.316729197426},{7.35,0.298037052155},{7.45,0.270386836108},{7.55,0.260891615455},{7.65,0.303435689753},{7.75,0.322566849845},{7.85,0.253450965881},{7.95,0.226298256526},{8.05,0.25246335842},{8.15,0.261326236725},{8.25,0.27423708174},{8.35,0.234248924255},{8.45,0.297602627728},{8.55,0.207327461243},{8.65,0.248213458061},{8.75,0.201835860377},{8.85,0.240187856886},{8.95,0.201908181353},{9.05,0.197840106487},{9.15,0.236305252198},{9.25,0.200328309195},{9.35,0.187500613076},{9.45,0.222456676619},{9.55,0.167189434596},{9.65,0.16457511397},{9.75,0.192614202146},{9.85,0.160523799158},{9.95,0.160163090147},{10.05,0.141398860562},{10.15,0.168409385681},{10.25,0.21300657172},{10.35,0.138697889116},{10.45,0.189537763596},{10.55,0.15821880386},{10.65,0.130578229825},{10.75,0.133823052697},{10.85,0.131846590476},{10.95,0.130742254711},{11.05,0.109667619069},{11.15,0.108747876209},{11.25,0.125577186283},{11.35,0.11103282656},{11.45,0.197472572327},{11.55,0.161139891698},{11.65,0.182593800805},{11.75,0.211541599698},{11.85,0.20319126712},{11.95,0.151925325394},{12.05,0.162553024292},{12.15,0.137932203033},{12.25,0.177618399262},{12.35,0.162761777639},{12.45,0.0984642604987},{12.55,0.124450789558},{12.65,0.129360467196},{12.75,0.23582713306},{12.85,0.176637232304},{12.95,0.205974712968},{13.05,0.124280691147},{13.15,0.0688623547554},{13.25,0.105260501305},{13.35,0.118685972691},{13.45,0.0919463733832},{13.55,0.0686466395855},{13.65,0.0814620703459},{13.75,0.109110929072},{13.85,0.10152605176},{13.95,0.0666634390752},{14.05,0.097559645772},{14.15,0.0841295346618},{14.25,0.0540915578604},{14.35,0.0755008682609},{14.45,0.0884206791719},{14.55,0.0800703515609},{14.65,0.056782219559},{14.75,0.110502652824},{14.85,0.180923730135},{14.95,0.0393161214888},{15.05,0.0732045248151},{15.15,0.0402671297391},{15.25,0.0427258349955},{15.35,0.0216180682182},{15.45,0.0307570360601},{15.55,0.0381331555545},{15.65,0.0267210435122},{15.75,0.00742251239717},{15.85,0.0},{15.95,0.00445350725204},{16.05,0.00382723286748},{16.15,0.0116904564202},{16.25,0.0},{16.35,0.0},{16.45,0.00250509800389},{16.55,0.0},{16.65,0.00129893965398},{16.75,0.00278344214894},{16.85,0.00528853992},{16.95,0.0036184748169},{17.05,0.0},{17.15,0.0},{17.25,0.0},{17.35,0.00167006521951},{17.45,0.000835032609757},{17.55,0.0},{17.65,0.00250509800389},{17.75,0.0},{17.85,0.0},{17.95,0.0},{18.05,0.0},{18.15,0.0},{18.25,0.0},{18.35,0.000556688406505},{18.45,0.0},{18.55,0.0},{18.65,0.0},{18.75,0.0},{18.85,0.0},{18.95,0.0},{19.05,0.000278344203252},{19.15,0.0},{19.25,0.0},{19.35,0.0},{19.45,0.0},{19.55,0.0},{19.65,0.0},{19.75,0.0},{19.85,0.0},{19.95,0.0},{20.05,0.0},{20.15,0.0},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.0},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU44 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.0},{-21.35,0.0},{-21.25,0.0},{-21.15,0.0},{-21.05,0.0},{-20.95,0.0},{-20.85,0.0},{-20.75,0.0},{-20.65,0.0},{-20.55,0.0},{-20.45,0.0},{-20.35,0.0},{-20.25,0.0},{-20.15,0.0},{-20.05,0.0},{-19.95,0.0},{-19.85,0.0},{-19.75,0.0},{-19.65,0.0},{-19.55,0.0},{-19.45,0.0},{-19.35,0.0},{-19.25,0.0},{-19.15,0.0},{-19.05,0.0},{-18.95,0.0},{-18.85,0.0},{-18.75,0.0},{-18.65,0.0},{-18.55,0.0},{-18.45,0.0},{-18.35,0.0},{-18.25,0.000278344203252},{-18.15,0.0},{-18.05,0.0},{-17.95,0.0},{-17.85,0.0},{-17.75,0.000208758152439},{-17.65,0.000835032609757},{-17.55,0.0},{-17.45,0.0},{-17.35,0.000835032609757},{-17.25,0.00194840948097},{-17.15,9.27814010841e-05},{-17.05,0.0},{-16.95,0.00139172107447},{-16.85,0.00167006521951},{-16.75,0.00139172107447},{-16.65,0.000371125604336},{-16.55,0.00111337681301},{-16.45,0.000463907024823},{-16.35,0.0012061582723},{-16.25,0.00066106749},{-16.15,0.000487102370244},{-16.05,0.00194840948097},{-15.95,0.00153089314699},{-15.85,0.00204119086266},{-15.75,0.0077936379239},{-15.65,0.00162367460628},{-15.55,0.00375764677301},{-15.45,0.00269066076726},{-15.35,0.0},{-15.25,0.00330036718931},{-15.15,0.00841991230845},{-15.05,0.00706994310021},{-14.95,0.00553595688608},{-14.85,0.0087877245886},{-14.75,0.0140365010926},{-14.65,0.0212005500992},{-14.55,0.0789105817676},{-14.45,0.0286230618755},{-14.35,0.0270341821015},{-14.25,0.0116241843927},{-14.15,0.0265540391207},{-14.05,0.0330301788118},{-13.95,0.0273473188281},{-13.85,0.0356002241373},{-13.75,0.0369919449091},{-13.65,0.0332157413165},{-13.55,0.0242159465949},{-13.45,0.0597048327327},{-13.35,0.0258420627368},{-13.25,0.0354981660843},{-13.15,0.0503549955108},{-13.05,0.0369542872205},{-12.95,0.0323853492737},{-12.85,0.0344868481159},{-12.75,0.0350448602722},{-12.65,0.036298616366},{-12.55,0.0251819649163},{-12.45,0.0346482872963},{-12.35,0.0362489796602},{-12.25,0.0431796571483},{-12.15,0.0372501323963},{-12.05,0.0563448213396},{-11.95,0.0375258597461},{-11.85,0.0461955399349},{-11.75,0.044282823801},{-11.65,0.0534804812793},{-11.55,0.0557552247212},{-11.45,0.0640589296818},{-11.35,0.076834599177},{-11.25,0.0609394234996},{-11.15,0.0650786738242},{-11.05,0.055498742395},{-10.95,0.0721391398331},{-10.85,0.0567016476079},{-10.75,0.0574711203575},{-10.65,0.049823613877},{-10.55,0.0638580196782},{-10.45,0.0695319308175},{-10.35,0.0610206398097},{-10.25,0.0609450128343},{-10.15,0.0597686221202},{-10.05,0.0799901098818},{-9.95,0.0721558803736},{-9.85,0.0656040250039},{-9.75,0.0553456044966},{-9.65,0.0727671311826},{-9.55,0.0589073536888},{-9.45,0.0703862905502},{-9.35,0.0601102441981},{-9.25,0.0713108719372},{-9.15,0.0753354557225},{-9.05,0.0716881752014},{-8.95,0.0782575460581},{-8.85,0.0796438331035},{-8.75,0.0714405179024},{-8.65,0.0844637440964},{-8.55,0.0805859324298},{-8.45,0.0945625439496},{-8.35,0.103453993797},{-8.25,0.0923552984073},{-8.15,0.107407009279},{-8.05,0.103922043318},{-7.95,0.112501022143},{-7.85,0.105717030439},{-7.75,0.115768264322},{-7.65,0.118549039994},{-7.55,0.127448901008},{-7.45,0.120739856519},{-7.35,0.110969137262},{-7.25,0.119097187834},{-7.15,0.126524670919},{-7.05,0.162239074707},{-6.95,0.131535348025},{-6.85,0.15756864646},{-6.75,0.153329830725},{-6.65,0.137740945816},{-6.55,0.144357729359},{-6.45,0.177718644095},{-6.35,0.155865796407},{-6.25,0.176660017534},{-6.15,0.179662569434},{-6.05,0.189055898168},{-5.95,0.165003697675},{-5.85,0.155627046782},{-5.75,0.197044499715},{-5.65,0.185706582688},{-5.55,0.212754055605},{-5.45,0.231594800949},{-5.35,0.224533319473},{-5.25,0.212544492183},{-5.15,0.23153749589},{-5.05,0.233493534599},{-4.95,0.220718946388},{-4.85,0.198604715695},{-4.75,0.207377011263},{-4.65,0.206283993191},{-4.55,0.231934083475},{-4.45,0.22537674048},{-4.35,0.241513697306},{-4.25,0.237614949544},{-4.15,0.238527059555},{-4.05,0.247250689736},{-3.95,0.267886680245},{-3.85,0.251250325898},{-3.75,0.285884462554},{-3.65,0.278478834364},{-3.55,0.308178353817},{-3.45,0.29157470402},{-3.35,0.273335705381},{-3.25,0.267575046472},{-3.15,0.308304661199},{-3.05,0.284639461312},{-2.95,0.330089542964},{-2.85,0.277163601993},{-2.75,0.30584564677},{-2.65,0.304038544615},{-2.55,0.301220520198},{-2.45,0.277101224062},{-2.35,0.332878664605},{-2.25,0.336898682993},{-2.15,0.288366074258},{-2.05,0.35555039443},{-1.95,0.352199384361},{-1.85,0.34057449713},{-1.75,0.3467878564},{-1.65,0.35674507618},{-1.55,0.320154592726},{-1.45,0.390161987919},{-1.35,0.341703126597},{-1.25,0.290780579515},{-1.15,0.403206026232},{-1.05,0.364204918466},{-0.95,0.418681886461},{-0.85,0.358869676759},{-0.75,0.366039298966},{-0.65,0.357000727986},{-0.55,0.372124407665},{-0.45,0.371336327978},{-0.35,0.373900103282},{-0.25,0.331145225687},{-0.15,0.361080413641},{-0.05,0.367438910989},{0.05,0.362315668536},{0.15,0.403807412424},{0.25,0.399987724936},{0.35,0.436897251156},{0.45,0.375289665725},{0.55,0.401772034474},{0.65,0.351406440306},{0.75,0.407066594541},{0.85,0.340738953137},{0.95,0.398811951662},{1.05,0.446299902827},{1.15,0.368590695517},{1.25,0.357160923093},{1.35,0.357696733977},{1.45,0.400066701989},{1.55,0.362379154045},{1.65,0.406807590175},{1.75,0.402623963836},{1.85,0.40737389865},{1.95,0.383200459666},{2.05,0.377476058468},{2.15,0.370212065868},{2.25,0.419899515862},{2.35,0.373197329672},{2.45,0.37732711792},{2.55,0.335937982582},{2.65,0.370070771083},{2.75,0.418417710524},{2.85,0.369833671883},{2.95,0.357899872032},{3.05,0.427629486332},{3.15,0.328515313993},{3.25,0.353932062785},{3.35,0.380485997056},{3.45,0.34903776142},{3.55,0.382223594846},{3.65,0.379378761832},{3.75,0.439960729296},{3.85,0.419484953447},{3.95,0.397197187993},{4.05,0.3639692713},{4.15,0.388456685202},{4.25,0.408818061535},{4.35,0.389596065628},{4.45,0.329842382862},{4.55,0.316901524862},{4.65,0.348800080163},{4.75,0.421175003052},{4.85,0.378181729998},{4.95,0.369067367242},{5.05,0.376721118359},{5.15,0.35148624498},{5.25,0.340102526606},{5.35,0.356809762808},{5.45,0.382957505017},{5.55,0.430229992934},{5.65,0.365338808225},{5.75,0.2820854748},{5.85,0.317024556073},{5.95,0.340037961549},{6.05,0.350806477865},{6.15,0.336172993978},{6.25,0.327061869303},{6.35,0.31141956229},{6.45,0.314327928755},{6.55,0.279511109377},{6.65,0.351307519277},{6.75,0.324365277444},{6.85,0.328833014278},{6.95,0.353686206746},{7.05,0.295008362317},{7.15,0.319183490894},{7.25,0.260574371096},{7.35,0.249811717442},{7.45,0.290500365771},{7.55,0.217159097845},{7.65,0.245290841375},{7.75,0.218773905436},{7.85,0.223555139133},{7.95,0.361923391169},{8.05,0.20207789966},{8.15,0.243924422698},{8.25,0.307646260117},{8.35,0.186567026026},{8.45,0.232981241666},{8.55,0.245595032828},{8.65,0.214478869187},{8.75,0.208291736809},{8.85,0.202580465211},{8.95,0.284363408883},{9.05,0.203634887934},{9.15,0.299299558004},{9.25,0.243562777837},{9.35,0.279513263702},{9.45,0.238275289536},{9.55,0.201242866516},{9.65,0.147426754236},{9.75,0.220559954643},{9.85,0.180330732594},{9.95,0.114366720704},{10.05,0.117604917096},{10.15,0.104935765266},{10.25,0.138441453377},{10.35,0.122888968541},{10.45,0.121781158447},{10.55,0.141343188286},{10.65,0.195934448923},{10.75,0.130877447128},{10.85,0.12564457655},{10.95,0.161216974258},{11.05,0.129723866781},{11.15,0.271594375372},{11.25,0.209342670441},{11.35,0.154438220538},{11.45,0.210892134243},{11.55,0.116226106882},{11.65,0.174995005131},{11.75,0.417377144098},{11.85,0.174398117595},{11.95,0.137957507914},{12.05,0.197743671281},{12.15,0.228891730309},{12.25,0.183349302837},{12.35,0.14369520545},{12.45,0.124172449112},{12.55,0.107750137647},{12.65,0.0826176242395},{12.75,0.122232871396},{12.85,0.0905855761634},{12.95,0.130079527696},{13.05,0.179044917226},{13.15,0.336378991604},{13.25,0.0726478397846},{13.35,0.137919560075},{13.45,0.0670461580157},{13.55,0.0785858482122},{13.65,0.0654506513051},{13.75,0.0688901940982},{13.85,0.123955955108},{13.95,0.122378667196},{14.05,0.121358076731},{14.15,0.111616025368},{14.25,0.0783538967371},{14.35,0.128455847502},{14.45,0.124698206782},{14.55,0.113564439118},{14.65,0.0715344597896},{14.75,0.100482262671},{14.85,0.0},{14.95,0.0313415586948},{15.05,0.0693077072501},{15.15,0.0587306283414},{15.25,0.0784930661321},{15.35,0.0},{15.45,0.0578955970705},{15.55,0.0},{15.65,0.0384115017951},{15.75,0.0147522427142},{15.85,0.0172573402524},{15.95,0.00612357258797},{16.05,0.01057707984},{16.15,0.0},{16.25,0.0},{16.35,0.0},{16.45,0.00501019600779},{16.55,0.0036184748169},{16.65,0.00167006521951},{16.75,0.0},{16.85,0.00139172107447},{16.95,0.00250509800389},{17.05,0.00139172107447},{17.15,0.0},{17.25,0.000556688406505},{17.35,0.0},{17.45,0.0},{17.55,0.000835032609757},{17.65,0.0},{17.75,0.0},{17.85,0.0},{17.95,0.0},{18.05,0.0},{18.15,0.0},{18.25,0.0},{18.35,0.0},{18.45,0.0},{18.55,0.0},{18.65,0.0},{18.75,0.000278344203252},{18.85,0.000278344203252},{18.95,0.0},{19.05,0.0},{19.15,0.0},{19.25,0.0},{19.35,0.0},{19.45,0.0},{19.55,0.0},{19.65,0.0},{19.75,0.0},{19.85,0.0},{19.95,0.0},{20.05,0.0},{20.15,0.0},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.0},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU45 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.0},{-21.35,0.0},{-21.25,0.0},{-21.15,0.0},{-21.05,0.0},{-20.95,0.0},{-20.85,0.0},{-20.75,0.0},{-20.65,0.0},{-20.55,0.0},{-20.45,0.0},{-20.35,0.000278344203252},{-20.25,0.0},{-20.15,0.0},{-20.05,0.0},{-19.95,0.0},{-19.85,0.0},{-19.75,0.0},{-19.65,0.0},{-19.55,0.0},{-19.45,0.0},{-19.35,0.0},{-19.25,0.000278344203252},{-19.15,0.0},{-19.05,0.0},{-18.95,0.0},{-18.85,0.0},{-18.75,0.0},{-18.65,0.0},{-18.55,0.000556688406505},{-18.45,0.0},{-18.35,0.0},{-18.25,0.0},{-18.15,0.0},{-18.05,0.0},{-17.95,0.000139172101626},{-17.85,0.0},{-17.75,0.0},{-17.65,0.000556688406505},{-17.55,0.000556688406505},{-17.45,0.000556688406505},{-17.35,0.000139172101626},{-17.25,0.000278344203252},{-17.15,0.000139172101626},{-17.05,0.00111337681301},{-16.95,0.000835032609757},{-16.85,0.000556688406505},{-16.75,0.000417516304879},{-16.65,0.000556688406505},{-16.55,0.00194840948097},{-16.45,0.00167006521951},{-16.35,0.000501019600779},{-16.25,0.000501019600779},{-16.15,0.00122471451759},{-16.05,0.00528853992},{-15.95,0.000626274500974},{-15.85,0.00204119086266},{-15.75,0.0036184748169},{-15.65,0.00835032667965},{-15.55,0.00352569328},{-15.45,0.00723694963381},{-15.35,0.00295044854283},{-15.25,0.0104379076511},{-15.15,0.0078632235527},{-15.05,0.0106698609889},{-14.95,0.0084894982477},{-14.85,0.0167006533593},{-14.75,0.00857806273482},{-14.65,0.0137084526941},{-14.55,0.0190069334848},{-14.45,0.0131749597689},{-14.35,0.0487102381885},{-14.25,0.0385042826335},{-14.15,0.0411949430903},{-14.05,0.0560585260391},{-13.95,0.0522359311581},{-13.85,0.111987153689},{-13.75,0.0603543023268},{-13.65,0.0730375230312},{-13.55,0.038740453395},{-13.45,0.0308365630252},{-13.35,0.0295392796397},{-13.25,0.0351570156904},{-13.15,0.0558544066217},{-13.05,0.0505068247969},{-12.95,0.0425270199776},{-12.85,0.0513545076052},{-12.75,0.058081159989},{-12.65,0.0370058625937},{-12.55,0.0523658235868},{-12.45,0.0534768812358},{-12.35,0.0526561737061},{-12.25,0.0558325753492},{-12.15,0.0393535907452},{-12.05,0.05837496784},{-11.95,0.0403201452323},{-11.85,0.0467725350307},{-11.75,0.0531289527814},{-11.65,0.0628931413997},{-11.55,0.0627363661061},{-11.45,0.0664032490357},{-11.35,0.0566430475031},{-11.25,0.0739185395448},{-11.15,0.0644624586459},{-11.05,0.0507620300565},{-10.95,0.0795716494322},{-10.85,0.0581148971211},{-10.75,0.0851249228353},{-10.65,0.0535134596702},{-10.55,0.0870753427347},{-10.45,0.0765446547804},{-10.35,0.0605887657887},{-10.25,0.052322662395},{-10.15,0.0596403377812},{-10.05,0.0640748381615},{-9.95,0.0719181266991},{-9.85,0.052738351642},{-9.75,0.0781018798416},{-9.65,0.0806538995944},{-9.55,0.0652745597217},{-9.45,0.0626694616282},{-9.35,0.0620756400259},{-9.25,0.0673036315224},{-9.15,0.077919678688},{-9.05,0.0643416964819},{-8.95,0.0811924844418},{-8.85,0.0892467865577},{-8.75,0.0798105637232},{-8.65,0.0962440742637},{-8.55,0.109616493692},{-8.45,0.120641485174},{-8.35,0.107506656647},{-8.25,0.0969023264371},{-8.15,0.0988661993795},{-8.05,0.108706459403},{-7.95,0.102509075487},{-7.85,0.106632520075},{-7.75,0.104332081683},{-7.65,0.111937745825},{-7.55,0.131047677303},{-7.45,0.128783097138},{-7.35,0.138429853651},{-7.25,0.119585629167},{-7.15,0.117545056087},{-7.05,0.155688453365},{-6.95,0.150894273686},{-6.85,0.142553351142},{-6.75,0.214772224426},{-6.65,0.16791371946},{-6.55,0.142297906876},{-6.45,0.154150505861},{-6.35,0.160850725676},{-6.25,0.162243434361},{-6.15,0.165241832733},{-6.05,0.173308238983},{-5.95,0.224474167824},{-5.85,0.193254967531},{-5.75,0.205759233044},{-5.65,0.233681420719},{-5.55,0.213708091028},{-5.45,0.181508969038},{-5.35,0.223964846864},{-5.25,0.202664409365},{-5.15,0.242348857762},{-5.05,0.195440292358},{-4.95,0.222319977624},{-4.85,0.243678429013},{-4.75,0.212082702637},{-4.65,0.227080170314},{-4.55,0.248954040664},{-4.45,0.254103635265},{-4.35,0.246566195448},{-4.25,0.241854175445},{-4.15,0.246584014893},{-4.05,0.256579050204},{-3.95,0.285337296207},{-3.85,0.2587274611},{-3.75,0.280842336019},{-3.65,0.26744312048},{-3.55,0.285775781647},{-3.45,0.346441250403},{-3.35,0.279382647001},{-3.25,0.304647727091},{-3.15,0.282006306435},{-3.05,0.32084274292},{-2.95,0.305232703686},{-2.85,0.327123468572},{-2.75,0.300059218905},{-2.65,0.288150948538},{-2.55,0.402377637845},{-2.45,0.301348651913},{-2.35,0.349137196775},{-2.25,0.340088401254},{-2.15,0.30093807352},{-2.05,0.357169489707},{-1.95,0.353114960686},{-1.85,0.344938583956},{-1.75,0.364239013672},{-1.65,0.33632918866},{-1.55,0.358755481336},{-1.45,0.32369318995},{-1.35,0.3865744794},{-1.25,0.452950868152},{-1.15,0.311234015923},{-1.05,0.348737053249},{-0.95,0.374015397292},{-0.85,0.393650547151},{-0.75,0.366382001051},{-0.65,0.350565646557},{-0.55,0.38236142672},{-0.45,0.325901056427},{-0.35,0.370634912561},{-0.25,0.349732699094},{-0.15,0.408263074673},{-0.05,0.335499420166},{0.05,0.325262278895},{0.15,0.327788266269},{0.25,0.350114504496},{0.35,0.374599767614},{0.45,0.346187249545},{0.55,0.367367626107},{0.65,0.398372407943},{0.75,0.383228971758},{0.85,0.361641731815},{0.95,0.398942962646},{1.05,0.356381988525},{1.15,0.423763601189},{1.25,0.388746036319},{1.35,0.43401252274},{1.45,0.389171600342},{1.55,0.455995434913},{1.65,0.398584318555},{1.75,0.389028672249},{1.85,0.399767239889},{1.95,0.42600456444},{2.05,0.382702928248},{2.15,0.364493906498},{2.25,0.453649221682},{2.35,0.41888760208},{2.45,0.412301150235},{2.55,0.427133759998},{2.65,0.37259529819},{2.75,0.329963454627},{2.85,0.348380065918},{2.95,0.436233559433},{3.05,0.378289665495},{3.15,0.389845767868},{3.25,0.38701136607},{3.35,0.421885728836},{3.45,0.366991678874},{3.55,0.400415186979},{3.65,0.41880516384},{3.75,0.373521408232},{3.85,0.380340303693},{3.95,0.392803520285},{4.05,0.409222906286},{4.15,0.319880745628},{4.25,0.419926387508},{4.35,0.343147817284},{4.45,0.326089877893},{4.55,0.329369253042},{4.65,0.460127180901},{4.75,0.3376590603},{4.85,0.406423929575},{4.95,0.357872590786},{5.05,0.329127629598},{5.15,0.358043426122},{5.25,0.396603668437},{5.35,0.355144655382},{5.45,0.336628010398},{5.55,0.364413962645},{5.65,0.375477641821},{5.75,0.34465562596},{5.85,0.311646370039},{5.95,0.379959040675},{6.05,0.361856913162},{6.15,0.322353035212},{6.25,0.327971599141},{6.35,0.362650997234},{6.45,0.310599676768},{6.55,0.307287216187},{6.65,0.383849038018},{6.75,0.294726746423},{6.85,0.252356574649},{6.95,0.306273269653},{7.05,0.293241195679},{7.15,0.254058684622},{7.25,0.276799124114},{7.35,0.331871937483},{7.45,0.319203719115},{7.55,0.224975639919},{7.65,0.306757875391},{7.75,0.283149317691},{7.85,0.247441382635},{7.95,0.228688905405},{8.05,0.258775075277},{8.15,0.255575643267},{8.25,0.215816693428},{8.35,0.259632295178},{8.45,0.238871514797},{8.55,0.238772948583},{8.65,0.261739914234},{8.75,0.197354475657},{8.85,0.255160450935},{8.95,0.259290283377},{9.05,0.22796390454},{9.15,0.328515768051},{9.25,0.246028447151},{9.35,0.222980226789},{9.45,0.199117335406},{9.55,0.155336680236},{9.65,0.218082692888},{9.75,0.161536455154},{9.85,0.126736087458},{9.95,0.208427622914},{10.05,0.315725827217},{10.15,0.130724958752},{10.25,0.236105481784},{10.35,0.152888284789},{10.45,0.152139663696},{10.55,0.161680873235},{10.65,0.142397628111},{10.75,0.155260403951},{10.85,0.0973445610567},{10.95,0.208312797546},{11.05,0.133623774846},{11.15,0.191305971146},{11.25,0.29949837923},{11.35,0.11657055219},{11.45,0.150963783264},{11.55,0.101856581867},{11.65,0.387663900852},{11.75,0.136920051141},{11.85,0.3588552773},{11.95,0.197664158685},{12.05,0.0980842205194},{12.15,0.154759377241},{12.25,0.163348283087},{12.35,0.102374994755},{12.45,0.244734153152},{12.55,0.221005305648},{12.65,0.20924526453},{12.75,0.135507235924},{12.85,0.179810360074},{12.95,0.169511631131},{13.05,0.2156239748},{13.15,0.146339461207},{13.25,0.179810365041},{13.35,0.0843382974466},{13.45,0.0676376436438},{13.55,0.109110929072},{13.65,0.210149884224},{13.75,0.0486406497657},{13.85,0.122749795516},{13.95,0.338188201189},{14.05,0.0551585455736},{14.15,0.296993285418},{14.25,0.132631018758},{14.35,0.250231444836},{14.45,0.0},{14.55,0.0808126032352},{14.65,0.0},{14.75,0.0},{14.85,0.0816940292716},{14.95,0.0},{15.05,0.121079728007},{15.15,0.091296903789},{15.25,0.0},{15.35,0.0584522858262},{15.45,0.0249118059874},{15.55,0.0289477985352},{15.65,0.0},{15.75,0.0},{15.85,0.0},{15.95,0.0125254895538},{16.05,0.0},{16.15,0.00459267944098},{16.25,0.0},{16.35,0.00473185162991},{16.45,0.0},{16.55,0.0},{16.65,0.0},{16.75,0.00278344214894},{16.85,0.00129893965398},{16.95,0.0},{17.05,0.0},{17.15,0.0},{17.25,0.0},{17.35,0.0},{17.45,0.0},{17.55,0.0},{17.65,0.000278344203252},{17.75,0.0},{17.85,0.0},{17.95,0.0},{18.05,0.0},{18.15,0.0},{18.25,0.0},{18.35,0.0},{18.45,0.0},{18.55,0.0},{18.65,0.0},{18.75,0.0},{18.85,0.0},{18.95,0.0},{19.05,0.0},{19.15,0.0},{19.25,0.0},{19.35,0.0},{19.45,0.0},{19.55,0.0},{19.65,0.0},{19.75,0.0},{19.85,0.0},{19.95,0.0},{20.05,0.0},{20.15,0.0},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.0},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU46 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.0},{-21.35,0.0},{-21.25,0.0},{-21.15,0.0},{-21.05,0.0},{-20.95,0.0},{-20.85,0.0},{-20.75,0.0},{-20.65,0.0},{-20.55,0.0},{-20.45,0.0},{-20.35,0.0},{-20.25,0.0},{-20.15,0.0},{-20.05,0.0},{-19.95,0.0},{-19.85,0.0},{-19.75,0.0},{-19.65,0.0},{-19.55,0.0},{-19.45,0.0},{-19.35,0.0},{-19.25,0.0},{-19.15,0.0},{-19.05,0.0},{-18.95,0.0},{-18.85,0.0},{-18.75,0.0},{-18.65,9.27814010841e-05},{-18.55,0.0},{-18.45,0.0},{-18.35,0.0},{-18.25,0.0},{-18.15,0.0},{-18.05,0.000278344203252},{-17.95,0.0},{-17.85,0.0},{-17.75,0.0},{-17.65,0.0},{-17.55,0.0},{-17.45,0.000139172101626},{-17.35,0.0},{-17.25,0.000556688406505},{-17.15,0.000556688406505},{-17.05,0.000278344203252},{-16.95,0.0},{-16.85,0.000835032609757},{-16.75,0.000278344203252},{-16.65,0.00222675362602},{-16.55,0.000556688406505},{-16.45,0.000278344214894},{-16.35,0.00278344214894},{-16.25,0.000927814049646},{-16.15,0.00389681896195},{-16.05,0.00047716149129},{-15.95,0.00153089314699},{-15.85,0.00556688429788},{-15.75,0.00306178629398},{-15.65,0.00189274065197},{-15.55,0.00285302824341},{-15.45,0.00239376015961},{-15.35,0.0057524467508},{-15.25,0.00542771210894},{-15.15,0.00807198199133},{-15.05,0.00382723286748},{-14.95,0.0115512851626},{-14.85,0.0269993878901},{-14.75,0.0181480422616},{-14.65,0.023770596087},{-14.55,0.0201600726162},{-14.45,0.0205974706582},{-14.35,0.0507978200912},{-14.25,0.0194840945981},{-14.15,0.0297480374575},{-14.05,0.0930597484112},{-13.95,0.0422685572079},{-13.85,0.0283405022188},{-13.75,0.0271153648694},{-13.65,0.0410403079457},{-13.55,0.0228242260568},{-13.45,0.0593270787171},{-13.35,0.0354656924804},{-13.25,0.114747397602},{-13.15,0.0449905449694},{-13.05,0.0526348888874},{-12.95,0.0439141530257},{-12.85,0.0969565709432},{-12.75,0.0784930661321},{-12.65,0.0527141094208},{-12.55,0.0413586742738},{-12.45,0.0294488167763},{-12.35,0.0815826892853},{-12.25,0.0384368056601},{-12.15,0.0479338043614},{-12.05,0.124419860542},{-11.95,0.0486837284906},{-11.85,0.0480325273846},{-11.75,0.0890273222556},{-11.65,0.0509369919697},{-11.55,0.0730653537644},{-11.45,0.0445889465271},{-11.35,0.0721607387066},{-11.25,0.0566791296005},{-11.15,0.0726731419563},{-11.05,0.0700459272965},{-10.95,0.0925494498677},{-10.85,0.0610269691263},{-10.75,0.0808463421735},{-10.65,0.0552687235177},{-10.55,0.0665342083999},{-10.45,0.0818331986666},{-10.35,0.0797177839279},{-10.25,0.0914179242176},{-10.15,0.0532493896973},{-10.05,0.062897838865},{-9.95,0.068906566676},{-9.85,0.0689736979348},{-9.75,0.0690757566028},{-9.65,0.0628395194099},{-9.55,0.0782385826111},{-9.45,0.0742037112896},{-9.35,0.0603515727847},{-9.25,0.0731009549873},{-9.15,0.0677626132965},{-9.05,0.0633730122021},{-8.95,0.0730025908526},{-8.85,0.0654297602379},{-8.75,0.0692039182631},{-8.65,0.100941846537},{-8.55,0.080933545317},{-8.45,0.0819992266203},{-8.35,0.107235131056},{-8.25,0.0982449999395},{-8.15,0.099011012486},{-8.05,0.0853943684522},{-7.95,0.114167513671},{-7.85,0.0987522418682},{-7.75,0.102751190012},{-7.65,0.111537747085},{-7.55,0.126146542824},{-7.45,0.105199267069},{-7.35,0.124216293221},{-7.25,0.121176375283},{-7.15,0.126379874018},{-7.05,0.170751519637},{-6.95,0.149213588599},{-6.85,0.106287722685},{-6.75,0.14510269165},{-6.65,0.192570998751},{-6.55,0.143769935325},{-6.45,0.160875634143},{-6.35,0.140783405304},{-6.25,0.150692994567},{-6.15,0.17290813108},{-6.05,0.158043840196},{-5.95,0.169684388172},{-5.85,0.183992225004},{-5.75,0.1699545768},{-5.65,0.199552442969},{-5.55,0.17002895625},{-5.45,0.226640874689},{-5.35,0.183380555133},{-5.25,0.200129478208},{-5.15,0.212596215142},{-5.05,0.242254513066},{-4.95,0.194048327491},{-4.85,0.226437496883},{-4.75,0.213636077277},{-4.65,0.244670740763},{-4.55,0.21725836167},{-4.45,0.216138180171},{-4.35,0.24624854019},{-4.25,0.226786101306},{-4.15,0.229986365782},{-4.05,0.238680168434},{-3.95,0.259433330876},{-3.85,0.279999772708},{-3.75,0.231485673937},{-3.65,0.270923503394},{-3.55,0.255645356737},{-3.45,0.243698536849},{-3.35,0.283838840631},{-3.25,0.267302393913},{-3.15,0.250450462591},{-3.05,0.23887286553},{-2.95,0.273343612408},{-2.85,0.283317464643},{-2.75,0.305249936113},{-2.65,0.24160683068},{-2.55,0.288808526664},{-2.45,0.277262765853},{-2.35,0.302811639351},{-2.25,0.264039010713},{-2.15,0.280696868896},{-2.05,0.271676612623},{-1.95,0.316963262725},{-1.85,0.342641722481},{-1.75,0.320635588273},{-1.65,0.309001509349},{-1.55,0.345024248876},{-1.45,0.318306482139},{-1.35,0.302597711957},{-1.25,0.307071563721},{-1.15,0.351336184415},{-1.05,0.283429584364},{-0.95,0.327650578817},{-0.85,0.35119335992},{-0.75,0.304311576256},{-0.65,0.306606850257},{-0.55,0.32326538332},{-0.45,0.305548147722},{-0.35,0.375090946661},{-0.25,0.377700092637},{-0.15,0.305222217302},{-0.05,0.374192555745},{0.05,0.343080455974},{0.15,0.3614533686},{0.25,0.317777752876},{0.35,0.341201305389},{0.45,0.328684099259},{0.55,0.372337726278},{0.65,0.356168278477},{0.75,0.347714292592},{0.85,0.391603266151},{0.95,0.325099299031},{1.05,0.358974558967},{1.15,0.37189105705},{1.25,0.332936795553},{1.35,0.394027936577},{1.45,0.315196990967},{1.55,0.367154237266},{1.65,0.331267340709},{1.75,0.335414360309},{1.85,0.407554506001},{1.95,0.34520951692},{2.05,0.422851265801},{2.15,0.415136609759},{2.25,0.439482565487},{2.35,0.339717829993},{2.45,0.336862896561},{2.55,0.370638049379},{2.65,0.364951853849},{2.75,0.327141263069},{2.85,0.315810332427},{2.95,0.339440775853},{3.05,0.364734568494},{3.15,0.366391762443},{3.25,0.382534509418},{3.35,0.372598518025},{3.45,0.36663944071},{3.55,0.408366643465},{3.65,0.417839202881},{3.75,0.313330377851},{3.85,0.341930042614},{3.95,0.290392146391},{4.05,0.364770078659},{4.15,0.360283115242},{4.25,0.393966835989},{4.35,0.315050453975},{4.45,0.340799017798},{4.55,0.374293436323},{4.65,0.316976361158},{4.75,0.295601541856},{4.85,0.354251502217},{4.95,0.27558955927},{5.05,0.31961158857},{5.15,0.301940383911},{5.25,0.333612413117},{5.35,0.290399525617},{5.45,0.294170621415},{5.55,0.34852534327},{5.65,0.380089723147},{5.75,0.320587571462},{5.85,0.31905443915},{5.95,0.258426693508},{6.05,0.323611224139},{6.15,0.404195558457},{6.25,0.277792235552},{6.35,0.216242946991},{6.45,0.304341564178},{6.55,0.29980511568},{6.65,0.262014689269},{6.75,0.413990627636},{6.85,0.318086321761},{6.95,0.348247263167},{7.05,0.26469929322},{7.15,0.30725539358},{7.25,0.279666352272},{7.35,0.297310272853},{7.45,0.277870281323},{7.55,0.246974825859},{7.65,0.233711719513},{7.75,0.191352763075},{7.85,0.221840344943},{7.95,0.24206941268},{8.05,0.259852870305},{8.15,0.387879973964},{8.25,0.335855415889},{8.35,0.196101679521},{8.45,0.1973721385},{8.55,0.134100055695},{8.65,0.15453369553},{8.75,0.164931600744},{8.85,0.234100125053},{8.95,0.161810763677},{9.05,0.161391652864},{9.15,0.274134248495},{9.25,0.209008669853},{9.35,0.199350118637},{9.45,0.215896872913},{9.55,0.206220318289},{9.65,0.198328438927},{9.75,0.39671009779},{9.85,0.298719000816},{9.95,0.169380636776},{10.05,0.225597977638},{10.15,0.157768979669},{10.25,0.130089295538},{10.35,0.135602754705},{10.45,0.147466754913},{10.55,0.133152917027},{10.65,0.157478589278},{10.75,0.197039866447},{10.85,0.15974637866},{10.95,0.15276457866},{11.05,0.160073226148},{11.15,0.166811680794},{11.25,0.162218999863},{11.35,0.129290888707},{11.45,0.368806064129},{11.55,0.1452678442},{11.65,0.15262541506},{11.75,0.11050265034},{11.85,0.104982157548},{11.95,0.15444624424},{12.05,0.194840947787},{12.15,0.366486549377},{12.25,0.113626294666},{12.35,0.485571473837},{12.45,0.219891920686},{12.55,0.160715949535},{12.65,0.760158061981},{12.75,0.36184746027},{12.85,0.330533742905},{12.95,0.210799356302},{13.05,0.116125202179},{13.15,0.272638142109},{13.25,0.0849877695243},{13.35,0.0},{13.45,0.0532681234181},{13.55,0.133698006471},{13.65,0.0737612128258},{13.75,0.124048739672},{13.85,0.171460032463},{13.95,0.156011924148},{14.05,0.0},{14.15,0.280849307775},{14.25,0.0},{14.35,0.116069532931},{14.45,0.0807198186715},{14.55,0.0494060963392},{14.65,0.0313601146142},{14.75,0.0},{14.85,0.0490813603004},{14.95,0.0331229604781},{15.05,0.114956155419},{15.15,0.0},{15.25,0.0275560766459},{15.35,0.0573389083147},{15.45,0.0140099922816},{15.55,0.015030587092},{15.65,0.0217108484358},{15.75,0.0},{15.85,0.0086286701262},{15.95,0.00556688429788},{16.05,0.00501019600779},{16.15,0.00807198230177},{16.25,0.00473185162991},{16.35,0.00250509800389},{16.45,0.0},{16.55,0.00334013043903},{16.65,0.0},{16.75,0.0},{16.85,0.0},{16.95,0.0},{17.05,0.0},{17.15,0.0},{17.25,0.0},{17.35,0.0},{17.45,0.0},{17.55,0.0},{17.65,0.0},{17.75,0.000278344203252},{17.85,0.0},{17.95,0.0},{18.05,0.000278344203252},{18.15,0.0},{18.25,0.0},{18.35,0.0},{18.45,0.0},{18.55,0.0},{18.65,0.0},{18.75,0.0},{18.85,0.0},{18.95,0.0},{19.05,0.0},{19.15,0.0},{19.25,0.0},{19.35,0.0},{19.45,0.0},{19.55,0.0},{19.65,0.0},{19.75,0.0},{19.85,0.0},{19.95,0.0},{20.05,0.0},{20.15,0.0},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.0},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU47 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.0},{-21.35,0.0},{-21.25,0.0},{-21.15,0.0},{-21.05,0.0},{-20.95,0.0},{-20.85,0.0},{-20.75,0.0},{-20.65,0.0},{-20.55,0.0},{-20.45,0.0},{-20.35,0.0},{-20.25,0.0},{-20.15,0.0},{-20.05,0.0},{-19.95,0.0},{-19.85,0.0},{-19.75,0.0},{-19.65,0.0},{-19.55,0.0},{-19.45,0.0},{-19.35,0.0},{-19.25,0.0},{-19.15,0.0},{-19.05,0.0},{-18.95,0.0},{-18.85,0.0},{-18.75,0.0},{-18.65,0.0},{-18.55,0.0},{-18.45,0.0},{-18.35,0.0},{-18.25,0.000278344203252},{-18.15,0.0},{-18.05,0.0},{-17.95,0.0},{-17.85,0.000556688406505},{-17.75,0.000278344203252},{-17.65,0.0},{-17.55,0.0},{-17.45,0.000835032609757},{-17.35,0.0},{-17.25,0.0},{-17.15,0.0},{-17.05,0.0},{-16.95,0.0},{-16.85,0.000556688406505},{-16.75,0.000835032609757},{-16.65,0.000417516304879},{-16.55,0.0},{-16.45,0.0},{-16.35,0.000742251208673},{-16.25,0.00167006521951},{-16.15,0.0},{-16.05,0.0},{-15.95,0.00292261410505},{-15.85,0.00501019600779},{-15.75,0.00723694963381},{-15.65,0.0036184748169},{-15.55,0.00299220019951},{-15.45,0.00681943306699},{-15.35,0.0183707177639},{-15.25,0.0102987354621},{-15.15,0.00350713692605},{-15.05,0.00505658642699},{-14.95,0.0203191265464},{-14.85,0.0573389083147},{-14.75,0.0343755111098},{-14.65,0.0},{-14.55,0.0208758165439},{-14.45,0.0239376028379},{-14.35,0.021676056087},{-14.25,0.036555873851},{-14.15,0.231582388282},{-14.05,0.0344351551362},{-13.95,0.0541101157665},{-13.85,0.0415925766741},{-13.75,0.110780994097},{-13.65,0.0376383231746},{-13.55,0.0444306954741},{-13.45,0.0653644998868},{-13.35,0.0604404551642},{-13.25,0.0446185767651},{-13.15,0.0423842316324},{-13.05,0.0501854598522},{-12.95,0.0483812852339},{-12.85,0.0730305612087},{-12.75,0.0662149919404},{-12.65,0.0424011031787},{-12.55,0.0303901271387},{-12.45,0.072981852293},{-12.35,0.0532830357552},{-12.25,0.0908948514197},{-12.15,0.0464370912976},{-12.05,0.0694361741726},{-11.95,0.0551448990317},{-11.85,0.071554345744},{-11.75,0.0543745398521},{-11.65,0.0980467498302},{-11.55,0.0615836560726},{-11.45,0.0809285789728},{-11.35,0.0940206987517},{-11.25,0.061805064028},{-11.15,0.0779803301159},{-11.05,0.0812919735909},{-10.95,0.0826991597811},{-10.85,0.0964810624719},{-10.75,0.099977761507},{-10.65,0.0501019582152},{-10.55,0.0773796926845},{-10.45,0.066652733546},{-10.35,0.0850010202045},{-10.25,0.0699179264215},{-10.15,0.0653245079106},{-10.05,0.0715046354703},{-9.95,0.0713455847331},{-9.85,0.0589239199956},{-9.75,0.0584823763048},{-9.65,0.0740216009078},{-9.55,0.0768140208337},{-9.45,0.129268909756},{-9.35,0.0813026055694},{-9.25,0.113761593898},{-9.15,0.0768380487287},{-9.05,0.0714615640186},{-8.95,0.0708892074498},{-8.85,0.0859013031691},{-8.75,0.119236896778},{-8.65,0.0967612392024},{-8.55,0.106551706791},{-8.45,0.112257772022},{-8.35,0.103992113253},{-8.25,0.107827826244},{-8.15,0.10087312536},{-8.05,0.157605678804},{-7.95,0.099786400795},{-7.85,0.121061176724},{-7.75,0.123584828478},{-7.65,0.128144933822},{-7.55,0.119835061847},{-7.45,0.124692952858},{-7.35,0.178889678075},{-7.25,0.0986128368893},{-7.15,0.151324615479},{-7.05,0.152570100931},{-6.95,0.167385082245},{-6.85,0.164139063853},{-6.75,0.213967164358},{-6.65,0.135593387059},{-6.55,0.153257203481},{-6.45,0.200904490901},{-6.35,0.15256892771},{-6.25,0.170533671975},{-6.15,0.210412767198},{-6.05,0.174096121508},{-5.95,0.168112271453},{-5.85,0.24714236166},{-5.75,0.164839672137},{-5.65,0.20648857997},{-5.55,0.193534281519},{-5.45,0.253381126805},{-5.35,0.206110027101},{-5.25,0.227872506896},{-5.15,0.205410796326},{-5.05,0.196735703802},{-4.95,0.177950777906},{-4.85,0.200783263805},{-4.75,0.26000213623},{-4.65,0.232353185996},{-4.55,0.247084299723},{-4.45,0.208497959635},{-4.35,0.255100671347},{-4.25,0.282341533237},{-4.15,0.223981438102},{-4.05,0.244874932045},{-3.95,0.243437311866},{-3.85,0.251329010183},{-3.75,0.243384775908},{-3.65,0.262603365142},{-3.55,0.307980537415},{-3.45,0.296857571602},{-3.35,0.295391106024},{-3.25,0.279467084191},{-3.15,0.266381324606},{-3.05,0.277863150058},{-2.95,0.306086932912},{-2.85,0.315035348915},{-2.75,0.259730619543},{-2.65,0.330316497058},{-2.55,0.30507144928},{-2.45,0.283569611225},{-2.35,0.309882740398},{-2.25,0.367353683863},{-2.15,0.330509755803},{-2.05,0.343165655697},{-1.95,0.385785077748},{-1.85,0.320044958463},{-1.75,0.362105702779},{-1.65,0.371501271318},{-1.55,0.30880180513},{-1.45,0.31140250389},{-1.35,0.370459579286},{-1.25,0.300086866106},{-1.15,0.307116351081},{-1.05,0.356408815705},{-0.95,0.307107338539},{-0.85,0.345434127315},{-0.75,0.317863613951},{-0.65,0.387680462429},{-0.55,0.362153667874},{-0.45,0.298035812378},{-0.35,0.363199422648},{-0.25,0.319760739225},{-0.15,0.32396810195},{-0.05,0.374512152238},{0.05,0.364893986629},{0.15,0.355804730487},{0.25,0.352472589371},{0.35,0.343772298282},{0.45,0.316660272507},{0.55,0.399695568774},{0.65,0.435432885822},{0.75,0.323564230227},{0.85,0.391133262998},{0.95,0.354562656854},{1.05,0.401749122434},{1.15,0.406681776047},{1.25,0.350926183885},{1.35,0.345087578956},{1.45,0.305291085873},{1.55,0.390686639925},{1.65,0.422017448827},{1.75,0.385961579113},{1.85,0.38942073304},{1.95,0.385551405542},{2.05,0.421258926392},{2.15,0.364829721905},{2.25,0.403917739266},{2.35,0.331189836775},{2.45,0.40143544515},{2.55,0.416987056464},{2.65,0.366394925117},{2.75,0.377987824477},{2.85,0.378258805526},{2.95,0.44059279561},{3.05,0.405809734179},{3.15,0.332473777863},{3.25,0.350603079185},{3.35,0.45330949557},{3.45,0.352413457235},{3.55,0.419729601952},{3.65,0.360012752909},{3.75,0.37798312173},{3.85,0.327759577433},{3.95,0.388042752705},{4.05,0.499969998995},{4.15,0.378817496761},{4.25,0.37578295098},{4.35,0.409110329368},{4.45,0.357124605486},{4.55,0.30861214229},{4.65,0.391145776819},{4.75,0.335247655069},{4.85,0.347114431447},{4.95,0.377589996044},{5.05,0.414648138958},{5.15,0.322058644788},{5.25,0.376878062884},{5.35,0.355272979736},{5.45,0.467836431555},{5.55,0.40712933424},{5.65,0.288787092481},{5.75,0.378680660611},{5.85,0.314665288341},{5.95,0.268293450095},{6.05,0.262124339017},{6.15,0.337034109162},{6.25,0.330876583006},{6.35,0.345014973691},{6.45,0.367987408358},{6.55,0.329807796994},{6.65,0.415607656751},{6.75,0.234957297643},{6.85,0.30061173439},{6.95,0.349247773488},{7.05,0.263357564023},{7.15,0.240009260178},{7.25,0.440234502157},{7.35,0.359487113953},{7.45,0.274276794926},{7.55,0.235924557277},{7.65,0.21033042186},{7.75,0.315213223298},{7.85,0.277080957706},{7.95,0.33834130764},{8.05,0.296398618005},{8.15,0.269848657691},{8.25,0.236637115479},{8.35,0.213618480242},{8.45,0.282446133463},{8.55,0.252555608749},{8.65,0.267411470413},{8.75,0.195385539013},{8.85,0.194018559022},{8.95,0.196113382067},{9.05,0.157899103165},{9.15,0.178750004087},{9.25,0.161528208039},{9.35,0.124110592736},{9.45,0.350713703367},{9.55,0.139070890167},{9.65,0.149295041436},{9.75,0.209507538722},{9.85,0.163579419255},{9.95,0.188481844389},{10.05,0.134964199627},{10.15,0.111991798878},{10.25,0.238602850172},{10.35,0.186414718628},{10.45,0.280650496483},{10.55,0.171105774966},{10.65,0.140285482773},{10.75,0.189552413093},{10.85,0.165113782883},{10.95,0.175789833069},{11.05,0.138337070292},{11.15,0.369362771511},{11.25,0.201044048582},{11.35,0.155656271511},{11.45,0.270049548149},{11.55,0.129012537003},{11.65,0.160535022616},{11.75,0.397661089897},{11.85,0.228631925583},{11.95,0.0998496575789},{12.05,0.25600707531},{12.15,0.514240920544},{12.25,0.13372451067},{12.35,0.2267113626},{12.45,0.166227161884},{12.55,0.145518350601},{12.65,0.0766683684455},{12.75,0.106884181499},{12.85,0.102848182122},{12.95,0.144460648298},{13.05,0.181202073892},{13.15,0.0516885221004},{13.25,0.118852980435},{13.35,0.112172715366},{13.45,0.0843382954597},{13.55,0.079829120636},{13.65,0.182315453887},{13.75,0.067693310976},{13.85,0.324549347162},{13.95,0.0},{14.05,0.284189432859},{14.15,0.13054344058},{14.25,0.252458184958},{14.35,0.226850524545},{14.45,0.200686171651},{14.55,0.0988121926785},{14.65,0.0604006946087},{14.75,0.0543699016174},{14.85,0.0794672742486},{14.95,0.0638799965382},{15.05,0.0364630917708},{15.15,0.0},{15.25,0.0759879723191},{15.35,0.0279735922813},{15.45,0.0},{15.55,0.0300611741841},{15.65,0.0},{15.75,0.0},{15.85,0.0},{15.95,0.0128038339317},{16.05,0.0},{16.15,0.0086286701262},{16.25,0.0},{16.35,0.0},{16.45,0.0},{16.55,0.0},{16.65,0.0},{16.75,0.0},{16.85,0.0},{16.95,0.0036184748169},{17.05,0.00167006521951},{17.15,0.0},{17.25,0.0},{17.35,0.0},{17.45,0.0},{17.55,0.0},{17.65,0.0},{17.75,0.00139172107447},{17.85,0.0},{17.95,0.0},{18.05,0.0},{18.15,0.00111337681301},{18.25,0.0},{18.35,0.0},{18.45,0.0},{18.55,0.0},{18.65,0.0},{18.75,0.0},{18.85,0.0},{18.95,0.0},{19.05,0.0},{19.15,0.0},{19.25,0.0},{19.35,0.0},{19.45,0.0},{19.55,0.0},{19.65,0.0},{19.75,0.0},{19.85,0.0},{19.95,0.0},{20.05,0.0},{20.15,0.0},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.0},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU48 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.0},{-21.35,0.0},{-21.25,0.0},{-21.15,0.0},{-21.05,0.0},{-20.95,0.0},{-20.85,0.0},{-20.75,0.0},{-20.65,0.0},{-20.55,0.0},{-20.45,0.0},{-20.35,0.0},{-20.25,0.0},{-20.15,0.0},{-20.05,0.0},{-19.95,0.0},{-19.85,0.0},{-19.75,0.0},{-19.65,0.0},{-19.55,0.0},{-19.45,0.0},{-19.35,0.0},{-19.25,0.0},{-19.15,0.0},{-19.05,0.0},{-18.95,0.0},{-18.85,0.0},{-18.75,0.0},{-18.65,0.0},{-18.55,0.0},{-18.45,0.0},{-18.35,0.0},{-18.25,0.0},{-18.15,0.0},{-18.05,0.0},{-17.95,0.0},{-17.85,0.000835032609757},{-17.75,0.000278344203252},{-17.65,0.0},{-17.55,0.0},{-17.45,0.000278344203252},{-17.35,0.0},{-17.25,0.0},{-17.15,0.0},{-17.05,0.0},{-16.95,0.0},{-16.85,0.0},{-16.75,0.000185562802168},{-16.65,0.0},{-16.55,0.000278344203252},{-16.45,0.000649469826991},{-16.35,0.000278344203252},{-16.25,0.00334013043903},{-16.15,0.000742251208673},{-16.05,0.000835032609757},{-15.95,0.00236592581496},{-15.85,0.00176284664},{-15.75,0.00612357258797},{-15.65,0.00417516333982},{-15.55,0.00946370325983},{-15.45,0.0161439646035},{-15.35,0.0144738992676},{-15.25,0.00654108915478},{-15.15,0.0129430061206},{-15.05,0.00591481430456},{-14.95,0.0129893968503},{-14.85,0.0148218292743},{-14.75,0.0372981242836},{-14.65,0.019985114038},{-14.55,0.0585914552212},{-14.45,0.0543699016174},{-14.35,0.0350157022476},{-14.25,0.0635552604993},{-14.15,0.04303201437},{-14.05,0.0310701727867},{-13.95,0.0210381820798},{-13.85,0.0911113421122},{-13.75,0.0449724708285},{-13.65,0.0653552234173},{-13.55,0.0641861736774},{-13.45,0.0525672904083},{-13.35,0.054754282747},{-13.25,0.0464216272036},{-13.15,0.109180517495},{-13.05,0.115164913237},{-12.95,0.125463649631},{-12.85,0.0527740597725},{-12.75,0.107106852531},{-12.65,0.0720215663314},{-12.55,0.204954127471},{-12.45,0.168467834592},{-12.35,0.0605525157668},{-12.25,0.146409058571},{-12.15,0.0635320643584},{-12.05,0.0724454088645},{-11.95,0.0606591573783},{-11.85,0.0788873881102},{-11.75,0.109543912941},{-11.65,0.117554042074},{-11.55,0.110753166676},{-11.45,0.113286089897},{-11.35,0.122026097775},{-11.25,0.0638521611691},{-11.15,0.0592367107218},{-11.05,0.0837120190263},{-10.95,0.105578101598},{-10.85,0.133493888378},{-10.75,0.0693633794785},{-10.65,0.0852879426059},{-10.55,0.0682322870601},{-10.45,0.0774236415562},{-10.35,0.108315663678},{-10.25,0.0840746038838},{-10.15,0.064383158317},{-10.05,0.0900663262919},{-9.95,0.0780210909636},{-9.85,0.0765330592791},{-9.75,0.0627109487851},{-9.65,0.0857784229776},{-9.55,0.0725881968226},{-9.45,0.0820580170705},{-9.35,0.13206613765},{-9.25,0.0762752948269},{-9.15,0.120857059956},{-9.05,0.100353791164},{-8.95,0.0871576493786},{-8.85,0.109078810765},{-8.75,0.10336168059},{-8.65,0.123028144836},{-8.55,0.101787000895},{-8.45,0.0996144799625},{-8.35,0.0978492723929},{-8.25,0.102182414081},{-8.15,0.138404254256},{-8.05,0.128368869424},{-7.95,0.118108221003},{-7.85,0.129275427924},{-7.75,0.127401075865},{-7.65,0.137690105954},{-7.55,0.099311117856},{-7.45,0.121551710626},{-7.35,0.133124449036},{-7.25,0.156051183358},{-7.15,0.148312147274},{-7.05,0.138806780179},{-6.95,0.161465533944},{-6.85,0.189632980447},{-6.75,0.174554181653},{-6.65,0.169614491255},{-6.55,0.161827143501},{-6.45,0.172266668203},{-6.35,0.165929920269},{-6.25,0.216995829628},{-6.15,0.164069521016},{-6.05,0.204582989216},{-5.95,0.184056368741},{-5.85,0.238730777394},{-5.75,0.178842997942},{-5.65,0.227929815954},{-5.55,0.206725256784},{-5.45,0.230367312065},{-5.35,0.245288047791},{-5.25,0.219364034718},{-5.15,0.21836566925},{-5.05,0.30682388219},{-4.95,0.236837904332},{-4.85,0.216518055309},{-4.75,0.240101548492},{-4.65,0.252783726838},{-4.55,0.240659013391},{-4.45,0.242437802828},{-4.35,0.303017058462},{-4.25,0.295164142336},{-4.15,0.307099706476},{-4.05,0.275649116153},{-3.95,0.281927350968},{-3.85,0.32676599676},{-3.75,0.290609026712},{-3.65,0.264036549462},{-3.55,0.274133246286},{-3.45,0.29067859365},{-3.35,0.278967548424},{-3.25,0.320749736968},{-3.15,0.320865631104},{-3.05,0.272553208586},{-2.95,0.368801183868},{-2.85,0.240692674444},{-2.75,0.347364728413},{-2.65,0.365593706975},{-2.55,0.317226141271},{-2.45,0.298996624194},{-2.35,0.354987364549},{-2.25,0.334009088789},{-2.15,0.309789783076},{-2.05,0.309645293595},{-1.95,0.307383621795},{-1.85,0.363966215902},{-1.75,0.361806532916},{-1.65,0.37909637798},{-1.55,0.392304420471},{-1.45,0.336180419922},{-1.35,0.279283230121},{-1.25,0.407637308514},{-1.15,0.33080137693},{-1.05,0.389864679593},{-0.95,0.390766200735},{-0.85,0.346179635901},{-0.75,0.322964133286},{-0.65,0.322342723249},{-0.55,0.325017789515},{-0.45,0.382906205314},{-0.35,0.378944074604},{-0.25,0.355687266902},{-0.15,0.404749884534},{-0.05,0.437669323337},{0.05,0.35982111613},{0.15,0.376804616716},{0.25,0.40533563984},{0.35,0.432427603101},{0.45,0.388274274554},{0.55,0.371772530961},{0.65,0.398167301627},{0.75,0.465353110741},{0.85,0.414467386099},{0.95,0.441526913252},{1.05,0.434140636075},{1.15,0.362321415463},{1.25,0.483853322809},{1.35,0.345360099495},{1.45,0.341821150346},{1.55,0.381803540216},{1.65,0.40929210186},{1.75,0.388369118989},{1.85,0.393173853556},{1.95,0.403707832098},{2.05,0.37535945107},{2.15,0.360940878732},{2.25,0.300990690668},{2.35,0.422068903002},{2.45,0.403097183978},{2.55,0.356829082265},{2.65,0.422922067475},{2.75,0.39592145284},{2.85,0.453701055967},{2.95,0.423002243042},{3.05,0.459663200378},{3.15,0.442556381226},{3.25,0.330656556522},{3.35,0.310898713663},{3.45,0.44366361657},{3.55,0.388118119673},{3.65,0.38065847917},{3.75,0.377520786632},{3.85,0.364486762456},{3.95,0.32122716596},{4.05,0.387848087386},{4.15,0.438872900876},{4.25,0.402189619998},{4.35,0.385976433754},{4.45,0.548962275187},{4.55,0.396993086073},{4.65,0.481133408017},{4.75,0.499071177314},{4.85,0.369239044189},{4.95,0.359849590725},{5.05,0.282782810075},{5.15,0.377774192066},{5.25,0.319391088283},{5.35,0.396271886052},{5.45,0.383468035105},{5.55,0.404851661009},{5.65,0.347423529014},{5.75,0.283644842065},{5.85,0.351200819016},{5.95,0.534711340199},{6.05,0.344725336347},{6.15,0.342437070959},{6.25,0.332727768842},{6.35,0.350444332246},{6.45,0.228218057881},{6.55,0.437787014505},{6.65,0.286186975591},{6.75,0.262308491601},{6.85,0.380484938622},{6.95,0.326332798711},{7.05,0.368902911311},{7.15,0.311445749723},{7.25,0.28153523377},{7.35,0.299821243286},{7.45,0.291893997192},{7.55,0.38358924124},{7.65,0.208653777838},{7.75,0.245114198098},{7.85,0.240211048126},{7.95,0.263693180951},{8.05,0.201093758856},{8.15,0.332412570715},{8.25,0.173897940537},{8.35,0.187904605865},{8.45,0.305492051442},{8.55,0.305900301252},{8.65,0.239032184376},{8.75,0.186106239046},{8.85,0.331356135282},{8.95,0.208987376269},{9.05,0.254128272717},{9.15,0.398484528065},{9.25,0.186890736222},{9.35,0.20549755437},{9.45,0.225551585356},{9.55,0.290838771396},{9.65,0.16348083814},{9.75,0.390980839729},{9.85,0.375254392624},{9.95,0.264079064131},{10.05,0.153753060561},{10.15,0.218252791299},{10.25,0.175205024806},{10.35,0.127362361976},{10.45,0.139009733995},{10.55,0.134370664756},{10.65,0.17526406712},{10.75,0.300500416756},{10.85,0.163418981764},{10.95,0.280125617981},{11.05,0.196709837232},{11.15,0.220309436321},{11.25,0.219010512034},{11.35,0.24232647419},{11.45,0.297271609306},{11.55,0.192103902499},{11.65,0.230413341522},{11.75,0.0},{11.85,0.212098288536},{11.95,0.168954928716},{12.05,0.241741940379},{12.15,0.0},{12.25,0.140981346369},{12.35,0.0},{12.45,0.255334417025},{12.55,0.13516395092},{12.65,0.129430055618},{12.75,0.201613982519},{12.85,0.297967463732},{12.95,0.524957180023},{13.05,0.163666397333},{13.15,0.0},{13.25,0.443402320147},{13.35,0.101665221155},{13.45,0.132677406073},{13.55,0.12015191714},{13.65,0.173825964332},{13.75,0.161857157946},{13.85,0.301725119352},{13.95,0.0},{14.05,0.0847094257673},{14.15,0.121636420488},{14.25,0.221283644438},{14.35,0.0413619488478},{14.45,0.206531405449},{14.55,0.0},{14.65,0.194840952754},{14.75,0.150584220886},{14.85,0.129708409309},{14.95,0.0381331567963},{15.05,0.10744086653},{15.15,0.0918535888195},{15.25,0.0815548524261},{15.35,0.0},{15.45,0.0},{15.55,0.0},{15.65,0.0},{15.75,0.0},{15.85,0.0},{15.95,0.0},{16.05,0.0},{16.15,0.00445350725204},{16.25,0.0},{16.35,0.0},{16.45,0.0},{16.55,0.0},{16.65,0.0},{16.75,0.0},{16.85,0.0},{16.95,0.00194840948097},{17.05,0.0},{17.15,0.000278344203252},{17.25,0.0},{17.35,0.0},{17.45,0.0},{17.55,0.0},{17.65,0.0},{17.75,0.000278344203252},{17.85,0.000278344203252},{17.95,0.0},{18.05,0.0},{18.15,0.0},{18.25,0.000278344203252},{18.35,0.0},{18.45,0.0},{18.55,0.0},{18.65,0.0},{18.75,0.0},{18.85,0.0},{18.95,0.0},{19.05,0.0},{19.15,0.0},{19.25,0.0},{19.35,0.0},{19.45,0.0},{19.55,0.0},{19.65,0.0},{19.75,0.0},{19.85,0.0},{19.95,0.0},{20.05,0.0},{20.15,0.0},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.0},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU49 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.0},{-21.35,0.0},{-21.25,0.0},{-21.15,0.0},{-21.05,0.0},{-20.95,0.0},{-20.85,0.0},{-20.75,0.0},{-20.65,0.0},{-20.55,0.0},{-20.45,0.0},{-20.35,0.0},{-20.25,0.0},{-20.15,0.0},{-20.05,0.0},{-19.95,0.0},{-19.85,0.0},{-19.75,0.0},{-19.65,0.0},{-19.55,0.0},{-19.45,0.0},{-19.35,0.0},{-19.25,0.0},{-19.15,0.0},{-19.05,0.0},{-18.95,0.0},{-18.85,0.0},{-18.75,0.0},{-18.65,0.0},{-18.55,0.0},{-18.45,0.0},{-18.35,0.0},{-18.25,0.0},{-18.15,0.0},{-18.05,0.000278344203252},{-17.95,0.0},{-17.85,0.0},{-17.75,0.0},{-17.65,0.0},{-17.55,0.0},{-17.45,0.000278344203252},{-17.35,0.000278344203252},{-17.25,0.000347930268617},{-17.15,0.0},{-17.05,0.000278344203252},{-16.95,0.0},{-16.85,0.000556688406505},{-16.75,0.00111337681301},{-16.65,0.0},{-16.55,0.0},{-16.45,0.0},{-16.35,0.0036184748169},{-16.25,0.000835032609757},{-16.15,0.0},{-16.05,0.0036184748169},{-15.95,0.00111337681301},{-15.85,0.00153089314699},{-15.75,0.00584522821009},{-15.65,0.0},{-15.55,0.00835032667965},{-15.45,0.00528853992},{-15.35,0.0},{-15.25,0.00283911097795},{-15.15,0.00821115449071},{-15.05,0.0},{-14.95,0.019623266533},{-14.85,0.0237984303385},{-14.75,0.0166310667992},{-14.65,0.091296903789},{-14.55,0.0},{-14.45,0.0729261860251},{-14.35,0.0268138249715},{-14.25,0.0363517552614},{-14.15,0.19985114038},{-14.05,0.0},{-13.95,0.0624186880887},{-13.85,0.0541101157665},{-13.75,0.0747354179621},{-13.65,0.291704744101},{-13.55,0.0810677483678},{-13.45,0.0858691856265},{-13.35,0.0626274496317},{-13.25,0.065318107605},{-13.15,0.044566002157},{-13.05,0.0719519803921},{-12.95,0.0579999759793},{-12.85,0.0799311796824},{-12.75,0.0634624809027},{-12.65,0.0605244040489},{-12.55,0.114677810669},{-12.45,0.119242656231},{-12.35,0.0907799771854},{-12.25,0.130098080635},{-12.15,0.116487056017},{-12.05,0.0725086688995},{-11.95,0.070446388288},{-11.85,0.0649398473593},{-11.75,0.0811246850274},{-11.65,0.0847937681458},{-11.55,0.108956297239},{-11.45,0.126437857747},{-11.35,0.071163336436},{-11.25,0.123492042224},{-11.15,0.0872716170091},{-11.05,0.105492450974},{-10.95,0.10189718008},{-10.85,0.0862469417708},{-10.75,0.122415781021},{-10.65,0.10769601663},{-10.55,0.120371222496},{-10.45,0.112126330535},{-10.35,0.075957039992},{-10.25,0.0936721086502},{-10.15,0.0718406379223},{-10.05,0.151948106289},{-9.95,0.0801770508289},{-9.85,0.121122552798},{-9.75,0.0992706453099},{-9.65,0.102528908673},{-9.55,0.0855709654944},{-9.45,0.0606880149534},{-9.35,0.0947298152106},{-9.25,0.111801584562},{-9.15,0.0937535866447},{-9.05,0.112005710602},{-8.95,0.110568920771},{-8.85,0.0944015062772},{-8.75,0.170086876551},{-8.65,0.0954720633371},{-8.55,0.112083644867},{-8.45,0.120024343332},{-8.35,0.0945358131871},{-8.25,0.156429449717},{-8.15,0.153418270024},{-8.05,0.12734247957},{-7.95,0.142009074871},{-7.85,0.117680556846},{-7.75,0.119990909801},{-7.65,0.116724014282},{-7.55,0.174896515333},{-7.45,0.188550376892},{-7.35,0.191597168262},{-7.25,0.133041394063},{-7.15,0.128522123609},{-7.05,0.167462002147},{-6.95,0.16747574125},{-6.85,0.170246137513},{-6.75,0.191087520484},{-6.65,0.143117334532},{-6.55,0.176955553202},{-6.45,0.198629524973},{-6.35,0.197955389281},{-6.25,0.212283849716},{-6.15,0.213354600442},{-6.05,0.17954411714},{-5.95,0.193499825218},{-5.85,0.213252393211},{-5.75,0.189326246579},{-5.65,0.235771465302},{-5.55,0.236178467913},{-5.45,0.183933982143},{-5.35,0.223691919576},{-5.25,0.247739303944},{-5.15,0.265547170872},{-5.05,0.350670218468},{-4.95,0.23954419295},{-4.85,0.208767924392},{-4.75,0.276610894637},{-4.65,0.235920348257},{-4.55,0.303083714985},{-4.45,0.278273136058},{-4.35,0.252006548756},{-4.25,0.317979125089},{-4.15,0.256258860501},{-4.05,0.319935014513},{-3.95,0.239471842031},{-3.85,0.280644488785},{-3.75,0.267034647758},{-3.65,0.287725448608},{-3.55,0.352105416192},{-3.45,0.298792203267},{-3.35,0.332553162867},{-3.25,0.298578841346},{-3.15,0.260667214027},{-3.05,0.357509930929},{-2.95,0.323977187828},{-2.85,0.302078958285},{-2.75,0.325334685189},{-2.65,0.29514361966},{-2.55,0.393679395635},{-2.45,0.3065436629},{-2.35,0.411211221114},{-2.25,0.391954110593},{-2.15,0.293986320496},{-2.05,0.339498355471},{-1.95,0.422461367668},{-1.85,0.32993369806},{-1.75,0.362076112202},{-1.65,0.279804569401},{-1.55,0.383656254521},{-1.45,0.432703455289},{-1.35,0.344608369421},{-1.25,0.393037478129},{-1.15,0.385769896074},{-1.05,0.438965855813},{-0.95,0.331019768348},{-0.85,0.338601380587},{-0.75,0.383729231985},{-0.65,0.385496976083},{-0.55,0.360223050977},{-0.45,0.393896818161},{-0.35,0.34762147069},{-0.25,0.359122399361},{-0.15,0.410732975713},{-0.05,0.367341338611},{0.05,0.454291830257},{0.15,0.39967247418},{0.25,0.454314562739},{0.35,0.440127690633},{0.45,0.376665761915},{0.55,0.374372959137},{0.65,0.620042641958},{0.75,0.406584965099},{0.85,0.529596237909},{0.95,0.484651731408},{1.05,0.380314169259},{1.15,0.373561503523},{1.25,0.365438111623},{1.35,0.496116941625},{1.45,0.434729118347},{1.55,0.480737559001},{1.65,0.414855993711},{1.75,0.438801123171},{1.85,0.415791679831},{1.95,0.452202736063},{2.05,0.466047159831},{2.15,0.339862854754},{2.25,0.448654547982},{2.35,0.363920143672},{2.45,0.361753020968},{2.55,0.407791293397},{2.65,0.37668375699},{2.75,0.459416810856},{2.85,0.403227965037},{2.95,0.49285482749},{3.05,0.411913125411},{3.15,0.358298595135},{3.25,0.448453251908},{3.35,0.370919208137},{3.45,0.426118487404},{3.55,0.377014281902},{3.65,0.459238654689},{3.75,0.396802325581},{3.85,0.524191737175},{3.95,0.386238186858},{4.05,0.386845452445},{4.15,0.483121207266},{4.25,0.355983257294},{4.35,0.350827563893},{4.45,0.340819835663},{4.55,0.367309975624},{4.65,0.412259592329},{4.75,0.271701409267},{4.85,0.346385455132},{4.95,0.3538487334},{5.05,0.488019872595},{5.15,0.388981819153},{5.25,0.331793634515},{5.35,0.432208912713},{5.45,0.362749995607},{5.55,0.30954884194},{5.65,0.296209511004},{5.75,0.361986637115},{5.85,0.330429375172},{5.95,0.410490913391},{6.05,0.269738120002},{6.15,0.405941843987},{6.25,0.409214392952},{6.35,0.34809083205},{6.45,0.363819082578},{6.55,0.324827707731},{6.65,0.344416181246},{6.75,0.396362161636},{6.85,0.379438829422},{6.95,0.372619390488},{7.05,0.275443003728},{7.15,0.264052299353},{7.25,0.225535590073},{7.35,0.265262027582},{7.45,0.306832742691},{7.55,0.263478105718},{7.65,0.24514863802},{7.75,0.311074200798},{7.85,0.273934640382},{7.95,0.223270004446},{8.05,0.335663250514},{8.15,0.298607667287},{8.25,0.609176158905},{8.35,0.210237779115},{8.45,0.31972471873},{8.55,0.336012059992},{8.65,0.193619330724},{8.75,0.273519575596},{8.85,0.288162166422},{8.95,0.594209241867},{9.05,0.257569616491},{9.15,0.24846016277},{9.25,0.325627923012},{9.35,0.202170670033},{9.45,0.473964500427},{9.55,0.159670165607},{9.65,0.14362560908},{9.75,0.22091252274},{9.85,0.193393552303},{9.95,0.182092785835},{10.05,0.158858635209},{10.15,0.167646718025},{10.25,0.148686419834},{10.35,0.266514579455},{10.45,0.483669439952},{10.55,0.242669761181},{10.65,0.176713779569},{10.75,0.226572195689},{10.85,0.258915781975},{10.95,0.210289041201},{11.05,0.122193109989},{11.15,0.0954256753127},{11.25,0.280918896198},{11.35,0.18115568161},{11.45,0.365651528041},{11.55,0.109853181574},{11.65,0.333270808061},{11.75,0.168722987175},{11.85,0.156846960386},{11.95,0.304508566856},{12.05,0.180367052555},{12.15,0.829744100571},{12.25,0.192753359675},{12.35,0.242808938026},{12.45,0.219520807266},{12.55,0.214881738027},{12.65,0.118741643429},{12.75,0.178789754709},{12.85,0.266514569521},{12.95,0.166357060273},{13.05,0.0931339740753},{13.15,0.0860640287399},{13.25,0.412506133318},{13.35,0.36908441782},{13.45,0.182732969522},{13.55,0.166310667992},{13.65,0.309240430593},{13.75,0.0955648422241},{13.85,0.274725735188},{13.95,0.263870298862},{14.05,0.0},{14.15,0.237427607179},{14.25,0.223510399461},{14.35,0.214325040579},{14.45,0.096863783896},{14.55,0.0},{14.65,0.0836424380541},{14.75,0.0779363811016},{14.85,0.0},{14.95,0.0},{15.05,0.0},{15.15,0.0},{15.25,0.0651325434446},{15.35,0.0},{15.45,0.0317312404513},{15.55,0.0141955548897},{15.65,0.0},{15.75,0.0},{15.85,0.0},{15.95,0.00918535888195},{16.05,0.0},{16.15,0.0},{16.25,0.0},{16.35,0.0},{16.45,0.0},{16.55,0.00278344214894},{16.65,0.0},{16.75,0.00139172107447},{16.85,0.00306178629398},{16.95,0.0},{17.05,0.000835032609757},{17.15,0.00194840948097},{17.25,0.0},{17.35,0.0},{17.45,0.0},{17.55,0.0},{17.65,0.0},{17.75,0.0},{17.85,0.0},{17.95,0.0},{18.05,0.0},{18.15,0.0},{18.25,0.0},{18.35,0.0},{18.45,0.0},{18.55,0.0},{18.65,0.0},{18.75,0.0},{18.85,0.0},{18.95,0.0},{19.05,0.0},{19.15,0.0},{19.25,0.0},{19.35,0.0},{19.45,0.0},{19.55,0.0},{19.65,0.0},{19.75,0.0},{19.85,0.0},{19.95,0.0},{20.05,0.0},{20.15,0.0},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.0},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU50 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.0},{-21.35,0.0},{-21.25,0.0},{-21.15,0.0},{-21.05,0.0},{-20.95,0.0},{-20.85,0.0},{-20.75,0.0},{-20.65,0.0},{-20.55,0.0},{-20.45,0.0},{-20.35,0.0},{-20.25,0.0},{-20.15,0.0},{-20.05,0.0},{-19.95,0.0},{-19.85,0.0},{-19.75,0.0},{-19.65,0.0},{-19.55,0.0},{-19.45,0.0},{-19.35,0.0},{-19.25,0.0},{-19.15,0.0},{-19.05,0.0},{-18.95,0.0},{-18.85,0.0},{-18.75,0.0},{-18.65,0.0},{-18.55,0.0},{-18.45,0.0},{-18.35,0.0},{-18.25,0.0},{-18.15,0.0},{-18.05,0.0},{-17.95,0.000278344203252},{-17.85,0.00111337681301},{-17.75,0.0},{-17.65,0.0},{-17.55,0.0},{-17.45,0.0},{-17.35,0.0},{-17.25,0.000556688406505},{-17.15,0.0},{-17.05,0.000278344203252},{-16.95,0.0},{-16.85,0.0},{-16.75,0.0},{-16.65,0.00139172107447},{-16.55,0.0},{-16.45,0.0},{-16.35,0.0},{-16.25,0.00250509800389},{-16.15,0.0},{-16.05,0.00139172107447},{-15.95,0.0},{-15.85,0.00278344214894},{-15.75,0.00528853992},{-15.65,0.0},{-15.55,0.0102987354621},{-15.45,0.00417516333982},{-15.35,0.00347930262797},{-15.25,0.0164223089814},{-15.15,0.0104379076511},{-15.05,0.0137780383229},{-14.95,0.0320095829666},{-14.85,0.0450917631388},{-14.75,0.0712561160326},{-14.65,0.0462051406503},{-14.55,0.0528853982687},{-14.45,0.0647150278091},{-14.35,0.0370197817683},{-14.25,0.090601041913},{-14.15,0.100343085825},{-14.05,0.207923129201},{-13.95,0.241602778435},{-13.85,0.0840599536896},{-13.75,0.13402274251},{-13.65,0.0577842593193},{-13.55,0.0790497586131},{-13.45,0.16143964231},{-13.35,0.166589006782},{-13.25,0.0713674545288},{-13.15,0.0973508879542},{-13.05,0.135275284449},{-12.95,0.143347263336},{-12.85,0.154295474291},{-12.75,0.114190712571},{-12.65,0.129360467196},{-12.55,0.130195498466},{-12.45,0.0752921104431},{-12.35,0.0831851533481},{-12.25,0.0697716143396},{-12.15,0.135887646675},{-12.05,0.0859735682607},{-11.95,0.237334827582},{-11.85,0.200407832861},{-11.75,0.266004284223},{-11.65,0.0780628973787},{-11.55,0.0890701472759},{-11.45,0.138416596821},{-11.35,0.0717531612941},{-11.25,0.130056336522},{-11.15,0.103488373756},{-11.05,0.359713514646},{-10.95,0.0720354795456},{-10.85,0.121760129929},{-10.75,0.138476237655},{-10.65,0.107668605718},{-10.55,0.104986375028},{-10.45,0.239264678955},{-10.35,0.0936949436481},{-10.25,0.0898256557328},{-10.15,0.0759388488882},{-10.05,0.0841817259789},{-9.95,0.124571681023},{-9.85,0.115025748809},{-9.75,0.0932105183601},{-9.65,0.101855421066},{-9.55,0.144738988443},{-9.45,0.100673623383},{-9.35,0.0908867120743},{-9.25,0.135360928682},{-9.15,0.102090471321},{-9.05,0.137382745743},{-8.95,0.0807754898071},{-8.85,0.0806020589975},{-8.75,0.103769370488},{-8.65,0.0883207596265},{-8.55,0.104221758635},{-8.45,0.135568279969},{-8.35,0.113806475764},{-8.25,0.137307202816},{-8.15,0.0989273745438},{-8.05,0.201966555913},{-7.95,0.152453104655},{-7.85,0.14487210564},{-7.75,0.183663230193},{-7.65,0.129221303122},{-7.55,0.234992101789},{-7.45,0.122593231499},{-7.35,0.199639070602},{-7.25,0.162738588121},{-7.15,0.126808987723},{-7.05,0.20701547291},{-6.95,0.172237478454},{-6.85,0.188428719838},{-6.75,0.156969757641},{-6.65,0.195695860045},{-6.55,0.173830176845},{-6.45,0.206080288723},{-6.35,0.171235813035},{-6.25,0.178032053841},{-6.15,0.22651460253},{-6.05,0.287587563197},{-5.95,0.221214056015},{-5.85,0.214095816893},{-5.75,0.342882113023},{-5.65,0.253706255267},{-5.55,0.244917609475},{-5.45,0.252390717015},{-5.35,0.251582229839},{-5.25,0.314449446542},{-5.15,0.349675251887},{-5.05,0.216720093128},{-4.95,0.251264245887},{-4.85,0.22620968486},{-4.75,0.227641279047},{-4.65,0.29461541857},{-4.55,0.24069816416},{-4.45,0.316976743586},{-4.35,0.226611954825},{-4.25,0.306141028533},{-4.15,0.298777531355},{-4.05,0.384348469396},{-3.95,0.269560898675},{-3.85,0.38782915473},{-3.75,0.320759577629},{-3.65,0.378073299632},{-3.55,0.31056585766},{-3.45,0.302958705209},{-3.35,0.297283711641},{-3.25,0.362499387641},{-3.15,0.260664198134},{-3.05,0.316260867649},{-2.95,0.368791800279},{-2.85,0.409173727036},{-2.75,0.309831897418},{-2.65,0.368371591335},{-2.55,0.327101829204},{-2.45,0.277076755251},{-2.35,0.40212173951},{-2.25,0.510240862446},{-2.15,0.372987702835},{-2.05,0.448551707798},{-1.95,0.373430382122},{-1.85,0.412554836273},{-1.75,0.387675218804},{-1.65,0.373828633626},{-1.55,0.397371957468},{-1.45,0.486346871512},{-1.35,0.468927228773},{-1.25,0.443702061971},{-1.15,0.446970866277},{-1.05,0.43977689743},{-0.95,0.347226198982},{-0.85,0.422400610788},{-0.75,0.42694686708},{-0.65,0.343364348778},{-0.55,0.549223755345},{-0.45,0.411304170435},{-0.35,0.37927877903},{-0.25,0.37259495015},{-0.15,0.314121049026},{-0.05,0.35110444289},{0.05,0.53916089675},{0.15,0.416946974668},{0.25,0.708118365361},{0.35,0.509903377957},{0.45,0.382079601288},{0.55,0.523374611991},{0.65,0.48234121423},{0.75,0.423853497173},{0.85,0.39898826765},{0.95,0.369300297328},{1.05,0.442363645972},{1.15,0.475536446822},{1.25,0.515708214896},{1.35,0.450681018829},{1.45,0.485259288066},{1.55,0.436165367685},{1.65,0.429817757955},{1.75,0.40225167708},{1.85,0.459341199774},{1.95,0.429171991348},{2.05,0.492693110875},{2.15,0.404599825541},{2.25,0.731367525847},{2.35,0.601362637111},{2.45,0.450014887629},{2.55,0.420485325349},{2.65,0.544376309713},{2.75,0.461454936436},{2.85,0.346683771714},{2.95,0.631084251404},{3.05,0.459619970883},{3.15,0.441652733939},{3.25,0.524410083376},{3.35,0.50088040034},{3.45,0.61152223746},{3.55,0.609075109164},{3.65,0.32389144464},{3.75,0.437765866518},{3.85,0.345174646378},{3.95,0.268493016561},{4.05,0.380941881452},{4.15,0.456724462838},{4.25,0.392313523726},{4.35,0.468370826156},{4.45,0.49643245697},{4.55,0.409527842204},{4.65,0.520539988642},{4.75,0.448797922868},{4.85,0.49718326071},{4.95,0.371413230896},{5.05,0.320095847635},{5.15,0.422170219421},{5.25,0.279984190657},{5.35,0.401583900452},{5.45,0.655222256978},{5.55,0.479308748245},{5.65,0.312348588308},{5.75,0.351313224206},{5.85,0.400777686726},{5.95,0.305910212653},{6.05,0.362876145736},{6.15,0.427873661644},{6.25,0.300900789408},{6.35,0.399922019557},{6.45,0.382635392641},{6.55,0.536776102506},{6.65,0.360265305168},{6.75,0.603171912107},{6.85,0.491213285006},{6.95,0.280646866018},{7.05,0.312375445115},{7.15,0.360455751419},{7.25,0.255456729369},{7.35,0.37757393292},{7.45,0.51752538681},{7.55,0.346041509083},{7.65,0.42568952387},{7.75,0.251916964849},{7.85,0.391756838018},{7.95,0.273964913686},{8.05,0.331299205621},{8.15,0.234661564231},{8.25,0.323486588218},{8.35,0.425031602383},{8.45,0.404712468386},{8.55,0.379104822874},{8.65,0.295935559273},{8.75,0.283994603157},{8.85,0.383279970714},{8.95,0.316616535187},{9.05,0.270148515701},{9.15,0.154017130534},{9.25,0.280605763197},{9.35,0.236004961862},{9.45,0.252945303917},{9.55,0.240802541375},{9.65,0.185906100273},{9.75,0.444028615952},{9.85,0.331730628014},{9.95,0.174862013923},{10.05,0.169264210595},{10.15,0.248143871625},{10.25,0.239515185356},{10.35,0.263925981522},{10.45,0.664546787739},{10.55,0.181758761406},{10.65,0.244107866287},{10.75,0.242437815666},{10.85,0.215271401405},{10.95,0.136771380901},{11.05,0.263870298862},{11.15,0.506029784679},{11.25,1.01567804813},{11.35,0.475968599319},{11.45,0.309425989787},{11.55,0.445211559534},{11.65,0.456484496593},{11.75,0.286323408286},{11.85,0.210845738649},{11.95,0.806084811687},{12.05,0.390238583088},{12.15,0.700592398643},{12.25,0.174521818757},{12.35,0.159908741713},{12.45,0.155246481299},{12.55,0.146061122417},{12.65,0.526348888874},{12.75,0.164037525654},{12.85,0.160140703122},{12.95,0.108554244041},{13.05,0.1434400479},{13.15,0.204861342907},{13.25,0.385506719351},{13.35,0.11504894495},{13.45,0.331786304712},{13.55,0.0},{13.65,0.301168441772},{13.75,0.271663963795},{13.85,0.0638799965382},{13.95,0.0},{14.05,0.0},{14.15,0.0484875619411},{14.25,0.0},{14.35,0.0},{14.45,0.188995718956},{14.55,0.166728183627},{14.65,0.0},{14.75,0.142512232065},{14.85,0.0591481439769},{14.95,0.0578955970705},{15.05,0.0879567712545},{15.15,0.0},{15.25,0.0656892359257},{15.35,0.0},{15.45,0.0},{15.55,0.0},{15.65,0.0},{15.75,0.0153089314699},{15.85,0.0144738992676},{15.95,0.0},{16.05,0.0},{16.15,0.0},{16.25,0.0},{16.35,0.0},{16.45,0.0},{16.55,0.0},{16.65,0.0},{16.75,0.00139172107447},{16.85,0.0},{16.95,0.0},{17.05,0.0},{17.15,0.0},{17.25,0.000835032609757},{17.35,0.0},{17.45,0.000835032609757},{17.55,0.000835032609757},{17.65,0.0},{17.75,0.0},{17.85,0.0},{17.95,0.0},{18.05,0.0},{18.15,0.0},{18.25,0.0},{18.35,0.0},{18.45,0.0},{18.55,0.0},{18.65,0.0},{18.75,0.0},{18.85,0.0},{18.95,0.0},{19.05,0.0},{19.15,0.0},{19.25,0.0},{19.35,0.0},{19.45,0.0},{19.55,0.0},{19.65,0.0},{19.75,0.0},{19.85,0.0},{19.95,0.0},{20.05,0.0},{20.15,0.0},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.0},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU51 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.0},{-21.35,0.0},{-21.25,0.0},{-21.15,0.0},{-21.05,0.0},{-20.95,0.0},{-20.85,0.0},{-20.75,0.0},{-20.65,0.0},{-20.55,0.0},{-20.45,0.0},{-20.35,0.0},{-20.25,0.0},{-20.15,0.0},{-20.05,0.0},{-19.95,0.0},{-19.85,0.0},{-19.75,0.0},{-19.65,0.0},{-19.55,0.0},{-19.45,0.0},{-19.35,0.0},{-19.25,0.0},{-19.15,0.0},{-19.05,0.0},{-18.95,0.0},{-18.85,0.0},{-18.75,0.0},{-18.65,0.0},{-18.55,0.0},{-18.45,0.0},{-18.35,0.0},{-18.25,0.000139172101626},{-18.15,0.0},{-18.05,0.0},{-17.95,0.000278344203252},{-17.85,0.0},{-17.75,0.0},{-17.65,0.0},{-17.55,0.0},{-17.45,0.0},{-17.35,0.0},{-17.25,0.0},{-17.15,0.0},{-17.05,0.0},{-16.95,0.0},{-16.85,0.00111337681301},{-16.75,0.000417516304879},{-16.65,0.0},{-16.55,0.000835032609757},{-16.45,0.0},{-16.35,0.0},{-16.25,0.00194840948097},{-16.15,0.0},{-16.05,0.00306178629398},{-15.95,0.0},{-15.85,0.00236592581496},{-15.75,0.0},{-15.65,0.00250509800389},{-15.55,0.00612357258797},{-15.45,0.00487102381885},{-15.35,0.00570605648682},{-15.25,0.0},{-15.15,0.0},{-15.05,0.024215945974},{-14.95,0.0},{-14.85,0.0},{-14.75,0.0210613782207},{-14.65,0.0},{-14.55,0.031267332534},{-14.45,0.0},{-14.35,0.0466690460841},{-14.25,0.0409861840308},{-14.15,0.0464834831655},{-14.05,0.046900998801},{-13.95,0.0548338107765},{-13.85,0.075895190239},{-13.75,0.0369004905224},{-13.65,0.0885134637356},{-13.55,0.142790585756},{-13.45,0.0636294841766},{-13.35,0.31564232707},{-13.25,0.174243479967},{-13.15,0.0917840003967},{-13.05,0.185098901391},{-12.95,0.133234093587},{-12.85,0.0628660278661},{-12.75,0.0451474308968},{-12.65,0.0600875578821},{-12.55,0.0866578320662},{-12.45,0.0834104816119},{-12.35,0.132352665067},{-12.25,0.137710794806},{-12.15,0.0662149919404},{-12.05,0.163109704852},{-11.95,0.216459016005},{-11.85,0.13861541748},{-11.75,0.0885482504964},{-11.65,0.124744594097},{-11.55,0.130960951249},{-11.45,0.215647175908},{-11.35,0.224345430732},{-11.25,0.15499133865},{-11.15,0.0853757587346},{-11.05,0.0597141106923},{-10.95,0.0753456354141},{-10.85,0.195787322521},{-10.75,0.112296422323},{-10.65,0.0834104816119},{-10.55,0.0681015491486},{-10.45,0.0954720648852},{-10.35,0.107301688194},{-10.25,0.0786521179335},{-10.15,0.0932221114635},{-10.05,0.0970261494319},{-9.95,0.0939732881693},{-9.85,0.150653809309},{-9.75,0.0812765061855},{-9.65,0.0879567702611},{-9.55,0.0975596479007},{-9.45,0.0749624904833},{-9.35,0.106307608741},{-9.25,0.0979771614075},{-9.15,0.0906319684452},{-9.05,0.15496181358},{-8.95,0.123803530421},{-8.85,0.133982973439},{-8.75,0.0845786820758},{-8.65,0.11466144113},{-8.55,0.110136408555},{-8.45,0.113828132027},{-8.35,0.132606450249},{-8.25,0.170267122132},{-8.15,0.087459725993},{-8.05,0.116423791105},{-7.95,0.160195280524},{-7.85,0.113620109558},{-7.75,0.137021259828},{-7.65,0.141474767165},{-7.55,0.18076909913},{-7.45,0.169845640659},{-7.35,0.126954785415},{-7.25,0.118709318099},{-7.15,0.124671266925},{-7.05,0.159535770416},{-6.95,0.138633966446},{-6.85,0.136493042111},{-6.75,0.240591952675},{-6.65,0.185922794342},{-6.55,0.201161682606},{-6.45,0.170346657435},{-6.35,0.259361124039},{-6.25,0.214336166382},{-6.15,0.150102757119},{-6.05,0.151455879211},{-5.95,0.204650188315},{-5.85,0.237309841009},{-5.75,0.16345228293},{-5.65,0.255627045265},{-5.55,0.280130247275},{-5.45,0.28769193093},{-5.35,0.267550645051},{-5.25,0.281373885962},{-5.15,0.206012326318},{-5.05,0.292199558682},{-4.95,0.470205222859},{-4.85,0.212219629532},{-4.75,0.290562563929},{-4.65,0.234644168132},{-4.55,0.276813328266},{-4.45,0.23673908334},{-4.35,0.201726934184},{-4.25,0.255083651156},{-4.15,0.21992356127},{-4.05,0.248415255547},{-3.95,0.24044300261},{-3.85,0.279164185395},{-3.75,0.318172743826},{-3.65,0.281735621001},{-3.55,0.295360822935},{-3.45,0.297971235739},{-3.35,0.264038618221},{-3.25,0.288295006752},{-3.15,0.332979202271},{-3.05,0.318583746214},{-2.95,0.292838468784},{-2.85,0.319692963048},{-2.75,0.298602243749},{-2.65,0.285555861213},{-2.55,0.258735150707},{-2.45,0.348110817574},{-2.35,0.33080137693},{-2.25,0.321324627574},{-2.15,0.360335375812},{-2.05,0.37605076366},{-1.95,0.323714324406},{-1.85,0.297598361969},{-1.75,0.328790778206},{-1.65,0.362125812433},{-1.55,0.34188814861},{-1.45,0.309125444163},{-1.35,0.419734870686},{-1.25,0.388147251026},{-1.15,0.318050612574},{-1.05,0.393706605241},{-0.95,0.343612693077},{-0.85,0.41890008109},{-0.75,0.403087564417},{-0.65,0.340294772928},{-0.55,0.452840718356},{-0.45,0.332584211561},{-0.35,0.303038902283},{-0.25,0.351095620976},{-0.15,0.410798433665},{-0.05,0.389160889846},{0.05,0.445571787217},{0.15,0.388411497458},{0.25,0.272921460015},{0.35,0.490613106758},{0.45,0.369057259909},{0.55,0.345083561811},{0.65,0.329952861952},{0.75,0.376203083992},{0.85,0.473533093929},{0.95,0.419263707267},{1.05,0.279127703773},{1.15,0.417547252443},{1.25,0.305894598669},{1.35,0.391293350019},{1.45,0.378912118765},{1.55,0.352178323837},{1.65,0.396414808325},{1.75,0.408624755012},{1.85,0.354176032834},{1.95,0.449247568846},{2.05,0.479021104177},{2.15,0.383234848847},{2.25,0.401213291713},{2.35,0.341983190397},{2.45,0.493633508682},{2.55,0.351070550772},{2.65,0.438230514526},{2.75,0.277184446653},{2.85,0.302275484258},{2.95,0.422293047751},{3.05,0.342846820229},{3.15,0.36335849762},{3.25,0.369256328134},{3.35,0.399298237216},{3.45,0.386072129011},{3.55,0.418936828087},{3.65,0.351196709801},{3.75,0.317748714138},{3.85,0.4983813659},{3.95,0.392129404791},{4.05,0.413609186808},{4.15,0.456496119499},{4.25,0.39568176976},{4.35,0.422782592773},{4.45,0.32467982173},{4.55,0.507463264465},{4.65,0.452992569317},{4.75,0.512036172967},{4.85,0.352497171473},{4.95,0.407399094623},{5.05,0.378872871399},{5.15,0.553765833378},{5.25,0.301552345013},{5.35,0.384962688793},{5.45,0.391219411577},{5.55,0.361720952121},{5.65,0.323528746764},{5.75,0.35061248866},{5.85,0.272973201893},{5.95,0.362042307854},{6.05,0.430094003677},{6.15,0.424074798822},{6.25,0.310738177527},{6.35,0.423955345154},{6.45,0.438630717141},{6.55,0.393986956278},{6.65,0.361134201288},{6.75,0.350504934788},{6.85,0.354666201274},{6.95,0.304721411537},{7.05,0.357513257435},{7.15,0.40111720562},{7.25,0.204304653665},{7.35,0.300314839681},{7.45,0.228989375265},{7.55,0.297033037458},{7.65,0.50387263298},{7.75,0.357748226686},{7.85,0.411763879988},{7.95,0.18968425299},{8.05,0.26380608632},{8.15,0.464834826333},{8.25,0.236699636166},{8.35,0.181723982096},{8.45,0.251167687503},{8.55,0.379820551191},{8.65,0.28115857972},{8.75,0.247865509987},{8.85,0.18839263916},{8.95,0.367136001587},{9.05,0.420633792877},{9.15,0.400815677643},{9.25,0.242959707975},{9.35,0.919092595577},{9.45,0.159212892706},{9.55,0.19017095036},{9.65,0.275004088879},{9.75,0.21877854211},{9.85,0.116883158684},{9.95,0.141927707195},{10.05,0.150213095877},{10.15,0.254517936707},{10.25,0.163457632065},{10.35,0.296506166458},{10.45,0.293583542109},{10.55,0.159093601363},{10.65,0.210094213486},{10.75,0.203358268738},{10.85,0.172155896823},{10.95,0.337538758914},{11.05,0.158609807491},{11.15,0.193282222748},{11.25,0.299962282181},{11.35,0.862310349941},{11.45,0.814713478088},{11.55,0.206461817026},{11.65,0.205000504851},{11.75,0.257746736209},{11.85,0.374372959137},{11.95,0.125579625368},{12.05,0.355863064528},{12.15,0.136778342724},{12.25,0.152671799064},{12.35,0.20282014211},{12.45,0.137641206384},{12.55,0.0890237589677},{12.65,0.253293246031},{12.75,0.0},{12.85,0.21947440505},{12.95,0.208479806781},{13.05,0.18885654211},{13.15,0.348765283823},{13.25,0.35405382514},{13.35,0.0860779434443},{13.45,0.145574018359},{13.55,0.0},{13.65,0.134857773781},{13.75,0.242994502187},{13.85,0.0886990229289},{13.95,0.0},{14.05,0.0},{14.15,0.202077895403},{14.25,0.0},{14.35,0.180923730135},{14.45,0.0},{14.55,0.0},{14.65,0.0680551603436},{14.75,0.0},{14.85,0.120801389217},{14.95,0.104100733995},{15.05,0.0901835262775},{15.15,0.0751529335976},{15.25,0.0570605620742},{15.35,0.0},{15.45,0.0},{15.55,0.0},{15.65,0.0},{15.75,0.0},{15.85,0.0},{15.95,0.0},{16.05,0.00417516333982},{16.15,0.0},{16.25,0.0},{16.35,0.0},{16.45,0.0},{16.55,0.00139172107447},{16.65,0.0},{16.75,0.00139172107447},{16.85,0.00194840948097},{16.95,0.0},{17.05,0.000556688406505},{17.15,0.0},{17.25,0.000556688406505},{17.35,0.0},{17.45,0.0},{17.55,0.0},{17.65,0.0},{17.75,0.0},{17.85,0.0},{17.95,0.0},{18.05,0.000278344203252},{18.15,0.0},{18.25,0.0},{18.35,0.0},{18.45,0.0},{18.55,0.0},{18.65,0.0},{18.75,0.0},{18.85,0.0},{18.95,0.0},{19.05,0.0},{19.15,0.0},{19.25,0.0},{19.35,0.0},{19.45,0.0},{19.55,0.0},{19.65,0.0},{19.75,0.0},{19.85,0.0},{19.95,0.0},{20.05,0.0},{20.15,0.0},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.0},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU52 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.0},{-21.35,0.0},{-21.25,0.0},{-21.15,0.0},{-21.05,0.0},{-20.95,0.0},{-20.85,0.0},{-20.75,0.0},{-20.65,0.0},{-20.55,0.0},{-20.45,0.0},{-20.35,0.0},{-20.25,0.0},{-20.15,0.0},{-20.05,0.0},{-19.95,0.0},{-19.85,0.0},{-19.75,0.0},{-19.65,0.0},{-19.55,0.0},{-19.45,0.0},{-19.35,0.0},{-19.25,0.0},{-19.15,0.0},{-19.05,0.0},{-18.95,0.0},{-18.85,0.0},{-18.75,0.0},{-18.65,0.0},{-18.55,0.0},{-18.45,0.0},{-18.35,0.0},{-18.25,0.0},{-18.15,0.0},{-18.05,0.0},{-17.95,0.0},{-17.85,0.000556688406505},{-17.75,0.0},{-17.65,0.0},{-17.55,0.0},{-17.45,0.0},{-17.35,0.0},{-17.25,0.000417516304879},{-17.15,0.0},{-17.05,0.0},{-16.95,0.0},{-16.85,0.0},{-16.75,0.000835032609757},{-16.65,0.0},{-16.55,0.0},{-16.45,0.000556688406505},{-16.35,0.000371125604336},{-16.25,0.000556688406505},{-16.15,0.0},{-16.05,0.00334013043903},{-15.95,0.00194840948097},{-15.85,0.00306178629398},{-15.75,0.00445350725204},{-15.65,0.0},{-15.55,0.0},{-15.45,0.0},{-15.35,0.0},{-15.25,0.0183707177639},{-15.15,0.0178140290082},{-15.05,0.00570605648682},{-14.95,0.0104842980703},{-14.85,0.0384115017951},{-14.75,0.0590089708567},{-14.65,0.0201103687286},{-14.55,0.0},{-14.45,0.0308962073177},{-14.35,0.0719519779086},{-14.25,0.0532565265894},{-14.15,0.041473288089},{-14.05,0.0629057933887},{-13.95,0.0402485728264},{-13.85,0.0712561160326},{-13.75,0.118157118559},{-13.65,0.0},{-13.55,0.0},{-13.45,0.0534977555275},{-13.35,0.0627944529057},{-13.25,0.0496844400962},{-13.15,0.0539059937},{-13.05,0.0686953485012},{-12.95,0.120894163847},{-12.85,0.396083801985},{-12.75,0.104100733995},{-12.65,0.134254693985},{-12.55,0.0742715150118},{-12.45,0.15392434597},{-12.35,0.0945256948471},{-12.25,0.132213503122},{-12.15,0.0484065901149},{-12.05,0.0819922515324},{-11.95,0.206531405449},{-11.85,0.326080232859},{-11.75,0.060324782675},{-11.65,0.0722859919071},{-11.55,0.107321577413},{-11.45,0.257097264131},{-11.35,0.0818331956863},{-11.25,0.0813600122929},{-11.15,0.0952865017785},{-11.05,0.173631119728},{-10.95,0.0804161700335},{-10.85,0.0899608492851},{-10.75,0.0817319804972},{-10.65,0.0784698724747},{-10.55,0.116765394807},{-10.45,0.103853318426},{-10.35,0.140404769353},{-10.25,0.0614444836974},{-10.15,0.111894369125},{-10.05,0.115976757473},{-9.95,0.0775983929634},{-9.85,0.111504685879},{-9.75,0.0819922515324},{-9.65,0.0784188429515},{-9.55,0.0929027337294},{-9.45,0.115032065998},{-9.35,0.128094005585},{-9.25,0.0785749309203},{-9.15,0.157852093379},{-9.05,0.104120612144},{-8.95,0.125370870034},{-8.85,0.14527036927},{-8.75,0.0965854420381},{-8.65,0.129044661155},{-8.55,0.0761735339959},{-8.45,0.109814980451},{-8.35,0.151269371693},{-8.25,0.169650793076},{-8.15,0.102974108287},{-8.05,0.188067913055},{-7.95,0.0876268810696},{-7.85,0.146147082834},{-7.75,0.181122558458},{-7.65,0.111349284649},{-7.55,0.175478622317},{-7.45,0.183307051659},{-7.35,0.151781094074},{-7.25,0.152917010444},{-7.15,0.143903960352},{-7.05,0.161731243134},{-6.95,0.154831989952},{-6.85,0.234939903021},{-6.75,0.170516086661},{-6.65,0.159847517014},{-6.55,0.20014274688},{-6.45,0.195448246869},{-6.35,0.22193775177},{-6.25,0.182382259369},{-6.15,0.198273857435},{-6.05,0.203991512458},{-5.95,0.315990269184},{-5.85,0.180415038405},{-5.75,0.255135604313},{-5.65,0.249636801806},{-5.55,0.269423938933},{-5.45,0.254818066307},{-5.35,0.201818116506},{-5.25,0.221820456641},{-5.15,0.245724402941},{-5.05,0.244262501046},{-4.95,0.192725535801},{-4.85,0.255375650194},{-4.75,0.202149472918},{-4.65,0.279157840289},{-4.55,0.241243623918},{-4.45,0.361555871509},{-4.35,0.325848281384},{-4.25,0.198285460472},{-4.15,0.353836018106},{-4.05,0.251614744013},{-3.95,0.316260867649},{-3.85,0.298202613304},{-3.75,0.232996087325},{-3.65,0.280266523361},{-3.55,0.242635576349},{-3.45,0.28982591629},{-3.35,0.277697479024},{-3.25,0.317831961314},{-3.15,0.280578913007},{-3.05,0.309631824493},{-2.95,0.383365631104},{-2.85,0.291625213623},{-2.75,0.314124107361},{-2.65,0.286634342091},{-2.55,0.330568552017},{-2.45,0.299552493625},{-2.35,0.29335975647},{-2.25,0.410145335727},{-2.15,0.294510138662},{-2.05,0.330050748937},{-1.95,0.367055216143},{-1.85,0.248573489811},{-1.75,0.30354901364},{-1.65,0.300561782641},{-1.55,0.310243932824},{-1.45,0.371998339891},{-1.35,0.32614419267},{-1.25,0.413465927387},{-1.15,0.328002311088},{-1.05,0.322139463927},{-0.95,0.381496846676},{-0.85,0.590381304423},{-0.75,0.473549145919},{-0.65,0.306463753305},{-0.55,0.403976225084},{-0.45,0.307801176862},{-0.35,0.501643066406},{-0.25,0.464927602697},{-0.15,0.372342698714},{-0.05,0.423148155212},{0.05,0.559532372848},{0.15,0.396501332521},{0.25,0.345628274454},{0.35,0.376141267664},{0.45,0.4243821462},{0.55,0.47176251588},{0.65,0.335382787805},{0.75,0.365736334664},{0.85,0.317152357101},{0.95,0.417562707265},{1.05,0.487584114075},{1.15,0.346445772383},{1.25,0.570934599096},{1.35,0.443680661065},{1.45,0.414157613118},{1.55,0.361102496876},{1.65,0.421941033725},{1.75,0.32095284211},{1.85,0.349011829921},{1.95,0.445330125314},{2.05,0.398523966471},{2.15,0.38399828634},{2.25,0.785468800863},{2.35,0.386814943949},{2.45,0.332987158639},{2.55,0.325670678275},{2.65,0.336870165432},{2.75,0.352505534887},{2.85,0.383471949347},{2.95,0.367878278097},{3.05,0.374574529714},{3.15,0.411082267761},{3.25,0.422982978821},{3.35,0.551751488133},{3.45,0.605431388406},{3.55,0.391202083001},{3.65,0.436129072438},{3.75,0.383397725912},{3.85,0.422320780547},{3.95,0.3969536225},{4.05,0.303592712648},{4.15,0.298286222642},{4.25,0.324807814189},{4.35,0.42287113553},{4.45,0.414653323946},{4.55,0.448178140741},{4.65,0.38000310551},{4.75,0.342166225115},{4.85,0.348438553188},{4.95,0.31423948288},{5.05,0.5862999696},{5.15,0.31329959631},{5.25,0.382034753498},{5.35,0.264540407393},{5.45,0.347164821625},{5.55,0.268524227142},{5.65,0.435070546468},{5.75,0.320276761055},{5.85,0.385454535484},{5.95,0.337105777529},{6.05,0.588447475433},{6.15,0.384077898661},{6.25,0.424667615157},{6.35,0.454141775767},{6.45,0.290421247482},{6.55,0.255311226845},{6.65,0.304647743702},{6.75,0.279375721427},{6.85,0.354096669417},{6.95,0.335618899419},{7.05,0.23761317465},{7.15,0.26120865345},{7.25,0.355698607185},{7.35,0.192739450932},{7.45,0.214488772785},{7.55,0.395217842526},{7.65,0.335154271126},{7.75,0.251237759223},{7.85,0.315809345245},{7.95,0.234173132823},{8.05,0.181289061904},{8.15,0.150460508135},{8.25,0.447716673215},{8.35,0.228394074873},{8.45,0.299324393272},{8.55,0.469009971619},{8.65,0.730189641317},{8.75,0.151777114187},{8.85,0.205056190491},{8.95,0.238227844238},{9.05,0.128674549716},{9.15,0.116050982475},{9.25,0.209732368588},{9.35,0.228560362543},{9.45,0.156429445744},{9.55,0.295044851303},{9.65,0.139979302883},{9.75,0.123028137467},{9.85,0.187802808625},{9.95,0.157855957747},{10.05,0.236870932579},{10.15,0.166887232235},{10.25,0.223399066925},{10.35,0.152055467878},{10.45,0.17442903916},{10.55,0.245986700058},{10.65,0.123758792877},{10.75,0.1574036479},{10.85,0.307570358117},{10.95,0.431572705507},{11.05,0.286601761977},{11.15,0.120006118502},{11.25,0.412506133318},{11.35,0.25357156992},{11.45,0.753199458122},{11.55,0.256818930308},{11.65,0.186281859875},{11.75,0.236685355504},{11.85,0.72146821022},{11.95,0.217386821906},{12.05,0.675541400909},{12.15,0.323575139046},{12.25,0.143834367394},{12.35,0.133605226874},{12.45,0.175913532575},{12.55,0.0},{12.65,0.223371222615},{12.75,0.426423341036},{12.85,0.401650696993},{12.95,0.0},{13.05,0.188578203321},{13.15,0.0},{13.25,0.0},{13.35,0.304230213165},{13.45,0.0},{13.55,0.273334026337},{13.65,0.256911695004},{13.75,0.0},{13.85,0.251901507378},{13.95,0.0},{14.05,0.0},{14.15,0.0932453125715},{14.25,0.0462747253478},{14.35,0.171181693673},{14.45,0.0837816074491},{14.55,0.160047918558},{14.65,0.0},{14.75,0.0},{14.85,0.0},{14.95,0.0},{15.05,0.0370197817683},{15.15,0.0},{15.25,0.0},{15.35,0.0199016109109},{15.45,0.0},{15.55,0.0},{15.65,0.0},{15.75,0.00570605648682},{15.85,0.00695860525593},{15.95,0.0},{16.05,0.0036184748169},{16.15,0.0},{16.25,0.0},{16.35,0.00250509800389},{16.45,0.0},{16.55,0.0},{16.65,0.0},{16.75,0.0},{16.85,0.0},{16.95,0.0},{17.05,0.000835032609757},{17.15,0.0},{17.25,0.0},{17.35,0.0},{17.45,0.0},{17.55,0.0},{17.65,0.0},{17.75,0.0},{17.85,0.0},{17.95,0.0},{18.05,0.0},{18.15,0.0},{18.25,0.0},{18.35,0.0},{18.45,0.0},{18.55,0.0},{18.65,0.0},{18.75,0.0},{18.85,0.0},{18.95,0.0},{19.05,0.0},{19.15,0.0},{19.25,0.0},{19.35,0.0},{19.45,0.0},{19.55,0.0},{19.65,0.0},{19.75,0.0},{19.85,0.0},{19.95,0.0},{20.05,0.0},{20.15,0.0},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.0},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU53 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.0},{-21.35,0.0},{-21.25,0.0},{-21.15,0.0},{-21.05,0.0},{-20.95,0.0},{-20.85,0.0},{-20.75,0.0},{-20.65,0.0},{-20.55,0.0},{-20.45,0.0},{-20.35,0.0},{-20.25,0.0},{-20.15,0.0},{-20.05,0.0},{-19.95,0.0},{-19.85,0.0},{-19.75,0.0},{-19.65,0.0},{-19.55,0.0},{-19.45,0.0},{-19.35,0.0},{-19.25,0.0},{-19.15,0.0},{-19.05,0.0},{-18.95,0.0},{-18.85,0.0},{-18.75,0.0},{-18.65,0.0},{-18.55,0.0},{-18.45,0.0},{-18.35,0.0},{-18.25,0.000556688406505},{-18.15,0.0},{-18.05,0.0},{-17.95,0.000278344203252},{-17.85,0.000278344203252},{-17.75,0.0},{-17.65,0.0},{-17.55,0.0},{-17.45,0.0},{-17.35,0.0},{-17.25,0.0},{-17.15,0.000556688406505},{-17.05,0.0},{-16.95,0.0},{-16.85,0.0},{-16.75,0.00250509800389},{-16.65,0.0},{-16.55,9.27814010841e-05},{-16.45,0.000556688406505},{-16.35,0.0},{-16.25,0.00250509800389},{-16.15,0.0},{-16.05,0.00250509800389},{-15.95,0.00111337681301},{-15.85,0.0},{-15.75,0.00139172111327},{-15.65,0.00264426996},{-15.55,0.0},{-15.45,0.00890701450408},{-15.35,0.00501019600779},{-15.25,0.00445350725204},{-15.15,0.0},{-15.05,0.0244942903519},{-14.95,0.0146130714566},{-14.85,0.0},{-14.75,0.0670809522271},{-14.65,0.0367414355278},{-14.55,0.096863783896},{-14.45,0.0219335243106},{-14.35,0.121358074248},{-14.25,0.134440258145},{-14.15,0.0805806517601},{-14.05,0.0850341543555},{-13.95,0.0670809547106},{-13.85,0.102152325213},{-13.75,0.214046701789},{-13.65,0.115930363536},{-13.55,0.115095332265},{-13.45,0.265818715096},{-13.35,0.1386154145},{-13.25,0.286416202784},{-13.15,0.0421095022133},{-13.05,0.170346662402},{-12.95,0.0857996046543},{-12.85,0.0909489691257},{-12.75,0.0778807103634},{-12.65,0.0807198226452},{-12.55,0.0840042829514},{-12.45,0.146594613791},{-12.35,0.154852161805},{-12.25,0.163666397333},{-12.15,0.158377856016},{-12.05,0.256076663733},{-11.95,0.1343010813},{-11.85,0.188067913055},{-11.75,0.0612913966179},{-11.65,0.214510599772},{-11.55,0.1368896842},{-11.45,0.239654362202},{-11.35,0.147745108604},{-11.25,0.255148867766},{-11.15,0.124373475711},{-11.05,0.0858228007952},{-10.95,0.0802466332912},{-10.85,0.153144979477},{-10.75,0.0710283842954},{-10.65,0.133002142111},{-10.55,0.0744950337843},{-10.45,0.118574636323},{-10.35,0.0691221455733},{-10.25,0.0810740752654},{-10.15,0.0893484890461},{-10.05,0.185265910625},{-9.95,0.11819191277},{-9.85,0.15462021033},{-9.75,0.0839903652668},{-9.65,0.174614608288},{-9.55,0.175635198752},{-9.45,0.179485619068},{-9.35,0.113842785358},{-9.25,0.236759591103},{-9.15,0.0953864225974},{-9.05,0.210521002611},{-8.95,0.132714521885},{-8.85,0.114190707604},{-8.75,0.104120612144},{-8.65,0.165676660008},{-8.55,0.109369388648},{-8.45,0.135808775822},{-8.35,0.0987630731919},{-8.25,0.159896091981},{-8.15,0.169334498319},{-8.05,0.146045070428},{-7.95,0.143387028149},{-7.85,0.187705213373},{-7.75,0.155097365379},{-7.65,0.143816977739},{-7.55,0.159342781703},{-7.45,0.130851080543},{-7.35,0.422712087631},{-7.25,0.179235108693},{-7.15,0.197644267763},{-7.05,0.284857463837},{-6.95,0.172688021379},{-6.85,0.164340282741},{-6.75,0.274586558342},{-6.65,0.210532605648},{-6.55,0.251205648695},{-6.45,0.208479811164},{-6.35,0.308915674686},{-6.25,0.388763356209},{-6.15,0.197540891171},{-6.05,0.291148049491},{-5.95,0.386999650435},{-5.85,0.275769531727},{-5.75,0.2988489151},{-5.65,0.306141503652},{-5.55,0.360455769759},{-5.45,0.325829728444},{-5.35,0.360316583088},{-5.25,0.322722703218},{-5.15,0.313481078428},{-5.05,0.363870112101},{-4.95,0.243708506874},{-4.85,0.305285002056},{-4.75,0.328136894438},{-4.65,0.339765495724},{-4.55,0.305733275414},{-4.45,0.289984052831},{-4.35,0.379808874691},{-4.25,0.39467570361},{-4.15,0.558497667313},{-4.05,0.362623917429},{-3.95,0.439731657505},{-3.85,0.299022873243},{-3.75,0.487083816528},{-3.65,0.413820531633},{-3.55,0.343008626591},{-3.45,0.323076446851},{-3.35,0.658307234446},{-3.25,0.419948176334},{-3.15,0.474625980153},{-3.05,0.410919570923},{-2.95,0.433718882109},{-2.85,0.340337028503},{-2.75,0.472891330719},{-2.65,0.581368255615},{-2.55,0.486483838823},{-2.45,0.402397155762},{-2.35,0.452128410339},{-2.25,0.652319567544},{-2.15,0.651842389788},{-2.05,0.442196164812},{-1.95,0.323023269916},{-1.85,0.558554985944},{-1.75,0.499730411329},{-1.65,0.480227279663},{-1.55,0.443516211076},{-1.45,0.431675579237},{-1.35,0.49297542572},{-1.25,0.342181008438},{-1.15,0.402808609009},{-1.05,0.634068131447},{-0.95,0.404790420532},{-0.85,0.463379859924},{-0.75,0.569739659627},{-0.65,0.605480530683},{-0.55,0.644836544991},{-0.45,0.415245018005},{-0.35,0.450239927872},{-0.25,0.44919913748},{-0.15,0.80507850647},{-0.05,0.654213249683},{0.05,0.552439990797},{0.15,0.80704835745},{0.25,0.616123087266},{0.35,0.616172229542},{0.45,0.349025090535},{0.55,0.587089803484},{0.65,0.501377469017},{0.75,0.548059764661},{0.85,0.436408917109},{0.95,0.497493880136},{1.05,0.474159370769},{1.15,0.432210564613},{1.25,0.734769071851},{1.35,0.448206777158},{1.45,0.538376306233},{1.55,0.429090778033},{1.65,0.420009811719},{1.75,0.386941286234},{1.85,0.525704333657},{1.95,0.584129894481},{2.05,0.497790765762},{2.15,0.488160085678},{2.25,0.574289602392},{2.35,0.501503040916},{2.45,0.504257151955},{2.55,0.558522224426},{2.65,0.425702181729},{2.75,1.86551856995},{2.85,0.70448919443},{2.95,0.569614052773},{3.05,0.689951089712},{3.15,0.46736923017},{3.25,0.67644067911},{3.35,0.480329301622},{3.45,0.573147837321},{3.55,0.468515184191},{3.65,0.374879056757},{3.75,1.15771307264},{3.85,0.366920948029},{3.95,0.566589525768},{4.05,0.963210165501},{4.15,0.694241046906},{4.25,0.62033645312},{4.35,0.491463088989},{4.45,0.902913808823},{4.55,0.714927101135},{4.65,0.632701700384},{4.75,0.853264153004},{4.85,0.439672501882},{4.95,0.817810058594},{5.05,0.455371141434},{5.15,0.570301966234},{5.25,0.466654777527},{5.35,0.455777938549},{5.45,0.727417826653},{5.55,0.436914774088},{5.65,0.391550779343},{5.75,0.449224352837},{5.85,0.645723760128},{5.95,0.720752443586},{6.05,0.327611128489},{6.15,0.959508132935},{6.25,0.332820143018},{6.35,0.449498081207},{6.45,0.491061051687},{6.55,0.470680077871},{6.65,0.58082485199},{6.75,0.444546646542},{6.85,0.63318669796},{6.95,0.533625602722},{7.05,0.89202362299},{7.15,0.872469902039},{7.25,0.560074925423},{7.35,0.360826889674},{7.45,0.347620990541},{7.55,0.60155749321},{7.65,0.577953910828},{7.75,0.700035691261},{7.85,0.300302479002},{7.95,0.631075918674},{8.05,0.352463313511},{8.15,0.335285493306},{8.25,0.752457141876},{8.35,1.07538282871},{8.45,0.681757767995},{8.55,0.32858534654},{8.65,0.609944939613},{8.75,0.597605029742},{8.85,0.431711882353},{8.95,0.53070962429},{9.05,0.782008051872},{9.15,0.739560544491},{9.25,0.480329314868},{9.35,0.685561776161},{9.45,0.163144499063},{9.55,0.319817483425},{9.65,0.171539562089},{9.75,0.582991957664},{9.85,0.587862968445},{9.95,0.262617766857},{10.05,0.516606867313},{10.15,0.0},{10.25,0.24257697165},{10.35,0.314065059026},{10.45,0.225389227271},{10.55,0.294395387173},{10.65,0.416681289673},{10.75,0.113882541656},{10.85,0.203469619155},{10.95,0.388011842966},{11.05,0.367692708969},{11.15,0.125208506982},{11.25,0.180506214499},{11.35,0.351827085018},{11.45,0.0},{11.55,0.340971648693},{11.65,0.134662926197},{11.75,0.334430575371},{11.85,0.608460426331},{11.95,0.0},{12.05,0.575615823269},{12.15,0.570605635643},{12.25,0.266932100058},{12.35,0.513823390007},{12.45,0.451195955276},{12.55,0.443680673838},{12.65,0.210845738649},{12.75,0.392186999321},{12.85,0.0},{12.95,0.0},{13.05,0.0},{13.15,0.168259069324},{13.25,0.301725119352},{13.35,0.0739699751139},{13.45,0.0858228007952},{13.55,0.228520601988},{13.65,0.229077279568},{13.75,0.0},{13.85,0.101595640182},{13.95,0.0},{14.05,0.19205750525},{14.15,0.173965126276},{14.25,0.0},{14.35,0.0},{14.45,0.0},{14.55,0.140007138252},{14.65,0.0},{14.75,0.0},{14.85,0.0},{14.95,0.094358690083},{15.05,0.0},{15.15,0.0},{15.25,0.0},{15.35,0.0},{15.45,0.0},{15.55,0.0},{15.65,0.0},{15.75,0.0},{15.85,0.00334013043903},{15.95,0.0},{16.05,0.0},{16.15,0.0},{16.25,0.0},{16.35,0.00445350725204},{16.45,0.0},{16.55,0.0},{16.65,0.0},{16.75,0.0},{16.85,0.0},{16.95,0.0},{17.05,0.0},{17.15,0.0},{17.25,0.0},{17.35,0.0},{17.45,0.0},{17.55,0.000278344203252},{17.65,0.0},{17.75,0.0},{17.85,0.0},{17.95,0.0},{18.05,0.0},{18.15,0.0},{18.25,0.0},{18.35,0.0},{18.45,0.0},{18.55,0.0},{18.65,0.0},{18.75,0.0},{18.85,0.0},{18.95,0.0},{19.05,0.0},{19.15,0.0},{19.25,0.0},{19.35,0.0},{19.45,0.0},{19.55,0.0},{19.65,0.0},{19.75,0.0},{19.85,0.0},{19.95,0.0},{20.05,0.0},{20.15,0.0},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.0},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU54 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.0},{-21.35,0.0},{-21.25,0.0},{-21.15,0.0},{-21.05,0.0},{-20.95,0.0},{-20.85,0.0},{-20.75,0.0},{-20.65,0.0},{-20.55,0.0},{-20.45,0.0},{-20.35,0.0},{-20.25,0.0},{-20.15,0.0},{-20.05,0.0},{-19.95,0.0},{-19.85,0.0},{-19.75,0.0},{-19.65,0.0},{-19.55,0.0},{-19.45,0.0},{-19.35,0.0},{-19.25,0.0},{-19.15,0.0},{-19.05,0.0},{-18.95,0.0},{-18.85,0.0},{-18.75,0.0},{-18.65,0.0},{-18.55,0.0},{-18.45,0.0},{-18.35,0.0},{-18.25,0.0},{-18.15,0.0},{-18.05,0.0},{-17.95,0.0},{-17.85,0.0},{-17.75,0.0},{-17.65,0.0},{-17.55,0.000278344203252},{-17.45,0.0},{-17.35,0.0},{-17.25,0.0},{-17.15,0.0},{-17.05,0.000556688406505},{-16.95,0.0},{-16.85,0.0},{-16.75,0.0},{-16.65,0.0},{-16.55,0.0},{-16.45,0.000835032609757},{-16.35,0.0},{-16.25,0.0},{-16.15,0.0},{-16.05,0.0},{-15.95,0.0},{-15.85,0.0},{-15.75,0.0},{-15.65,0.0},{-15.55,0.0},{-15.45,0.00204119086266},{-15.35,0.0108554242179},{-15.25,0.0},{-15.15,0.0},{-15.05,0.0},{-14.95,0.0147522427142},{-14.85,0.0},{-14.75,0.0},{-14.65,0.0679159909487},{-14.55,0.0},{-14.45,0.102709010243},{-14.35,0.124976553023},{-14.25,0.0},{-14.15,0.0525142749151},{-14.05,0.0},{-13.95,0.178696990013},{-13.85,0.0},{-13.75,0.203191280365},{-13.65,0.106745004654},{-13.55,0.0},{-13.45,0.233530789614},{-13.35,0.0846166412036},{-13.25,0.255241632462},{-13.15,0.0742483213544},{-13.05,0.321765899658},{-12.95,0.11050265034},{-12.85,0.0},{-12.75,0.176609396935},{-12.65,0.356558918953},{-12.55,0.396083801985},{-12.45,0.0},{-12.35,0.40638256073},{-12.25,0.450082600117},{-12.15,0.111616030335},{-12.05,0.161068518957},{-11.95,0.161439637343},{-11.85,0.177398045858},{-11.75,0.135344877839},{-11.65,0.280570954084},{-11.55,0.105770796537},{-11.45,0.324270993471},{-11.35,0.686118483543},{-11.25,0.332203805447},{-11.15,0.343198418617},{-11.05,0.172295063734},{-10.95,0.140619492531},{-10.85,0.115280896425},{-10.75,0.143903958797},{-10.65,0.126553833485},{-10.55,0.184681385756},{-10.45,0.126507441203},{-10.35,0.0955764427781},{-10.25,0.257839520772},{-10.15,0.113962071283},{-10.05,0.272127846877},{-9.95,0.141909152269},{-9.85,0.109493650496},{-9.75,0.0908793866634},{-9.65,0.219265654683},{-9.55,0.191890501976},{-9.45,0.104502790504},{-9.35,0.102569842339},{-9.25,0.252388626337},{-9.15,0.184310257435},{-9.05,0.133292078972},{-8.95,0.12810019652},{-8.85,0.132646481196},{-8.75,0.156394660473},{-8.65,0.32879409194},{-8.55,0.2233248353},{-8.45,0.178383842111},{-8.35,0.144265806675},{-8.25,0.220448613167},{-8.15,0.310799145699},{-8.05,0.167758059502},{-7.95,0.135746332315},{-7.85,0.224658563733},{-7.75,0.147843599319},{-7.65,0.222149610519},{-7.55,0.129725798965},{-7.45,0.35516722997},{-7.35,0.201748934659},{-7.25,0.176598695608},{-7.15,0.202217062314},{-7.05,0.229355638677},{-6.95,0.198309549919},{-6.85,0.24638522755},{-6.75,0.210578093162},{-6.65,0.238517800967},{-6.55,0.229205755087},{-6.45,0.301808619499},{-6.35,0.243315660037},{-6.25,0.253036297285},{-6.15,0.237566777638},{-6.05,0.382414023081},{-5.95,0.450395733118},{-5.85,0.248023239772},{-5.75,0.271982056754},{-5.65,0.56412417548},{-5.55,0.341806689898},{-5.45,0.420104932785},{-5.35,0.355283180873},{-5.25,0.291945966085},{-5.15,0.239288129305},{-5.05,0.395875056585},{-4.95,0.32046696345},{-4.85,0.305482774973},{-4.75,0.278251436022},{-4.65,0.423523902893},{-4.55,0.524372673035},{-4.45,0.333404183388},{-4.35,0.342119812965},{-4.25,0.331966400146},{-4.15,0.436208211459},{-4.05,0.729922890663},{-3.95,0.374007642269},{-3.85,0.430101462773},{-3.75,0.446305070605},{-3.65,0.569239226255},{-3.55,0.337895217695},{-3.45,0.38414775624},{-3.35,0.333080601692},{-3.25,0.483404363905},{-3.15,0.420821666718},{-3.05,0.411949438207},{-2.95,0.393578714795},{-2.85,0.510125398636},{-2.75,0.656689903953},{-2.65,0.369933366776},{-2.55,0.369585442543},{-2.45,0.341452425176},{-2.35,0.508516311646},{-2.25,0.517720222473},{-2.15,0.372848692394},{-2.05,0.656289259593},{-1.95,0.440417846044},{-1.85,0.506064593792},{-1.75,0.50446408987},{-1.65,0.372437217019},{-1.55,0.68212890625},{-1.45,0.458154572381},{-1.35,0.597068241664},{-1.25,0.522834777832},{-1.15,0.472257349226},{-1.05,0.708896319071},{-0.95,0.654430095966},{-0.85,0.659654397231},{-0.75,0.621244362422},{-0.65,0.575411732992},{-0.55,0.729424158732},{-0.45,0.545415461063},{-0.35,0.436234951019},{-0.25,0.546267926693},{-0.15,0.739421367645},{-0.05,0.414905184791},{0.05,0.678967182453},{0.15,0.522059104022},{0.25,0.587770207723},{0.35,0.58821551005},{0.45,0.555261909962},{0.55,0.489854865604},{0.65,0.468321448878},{0.75,0.732926686605},{0.85,0.420167196365},{0.95,0.48169014189},{1.05,0.549521028996},{1.15,0.623232569013},{1.25,0.418828510103},{1.35,0.508371128755},{1.45,0.409245536441},{1.55,0.388315460899},{1.65,0.777187607505},{1.75,0.607963425773},{1.85,0.467324468825},{1.95,0.844050979614},{2.05,0.598022529057},{2.15,0.331385498047},{2.25,0.409792280197},{2.35,0.354453211245},{2.45,0.542325846354},{2.55,0.53340028127},{2.65,0.569989306586},{2.75,0.457696129294},{2.85,0.781423521042},{2.95,0.593793832339},{3.05,0.544162920543},{3.15,0.744988298416},{3.25,0.462434113026},{3.35,0.518177509308},{3.45,0.477972666423},{3.55,0.471830558777},{3.65,0.432581692934},{3.75,0.534784867213},{3.85,0.453849506378},{3.95,0.600439071655},{4.05,0.382641427657},{4.15,0.932572364807},{4.25,0.529178738594},{4.35,0.571643092416},{4.45,0.410613377889},{4.55,0.603227567673},{4.65,0.457362358387},{4.75,0.386768563588},{4.85,0.356158822775},{4.95,0.427365413079},{5.05,0.67258399725},{5.15,0.448969205221},{5.25,0.647880971432},{5.35,0.631145477295},{5.45,0.291246273938},{5.55,0.596526443958},{5.65,0.392627716064},{5.75,0.44818983078},{5.85,0.744570732117},{5.95,0.330116235293},{6.05,0.381356889551},{6.15,0.511283516884},{6.25,0.356407100504},{6.35,0.488528877497},{6.45,0.460938006639},{6.55,0.517640692847},{6.65,1.16932400068},{6.75,0.482927220208},{6.85,0.816870689392},{6.95,0.35711561309},{7.05,0.308405375481},{7.15,0.297577786446},{7.25,0.26285815239},{7.35,0.461448311806},{7.45,0.371112346649},{7.55,0.650699198246},{7.65,0.500741243362},{7.75,0.488772439957},{7.85,0.748838742574},{7.95,0.54694634676},{8.05,0.525305092335},{8.15,0.661438624064},{8.25,0.389125204086},{8.35,0.234609380364},{8.45,0.456066995859},{8.55,0.576265295347},{8.65,0.271246433258},{8.75,0.53302915891},{8.85,0.755982875824},{8.95,0.701705753803},{9.05,0.456670085589},{9.15,0.332342982292},{9.25,0.621264278889},{9.35,0.395341555278},{9.45,0.291148036718},{9.55,0.22467944622},{9.65,0.18398553133},{9.75,0.522312939167},{9.85,0.997307300568},{9.95,0.157589217027},{10.05,0.153831571341},{10.15,0.452030986547},{10.25,0.424614101648},{10.35,0.413619488478},{10.45,0.804414749146},{10.55,0.258767326673},{10.65,0.240953306357},{10.75,0.181550011039},{10.85,0.141732871532},{10.95,0.690850317478},{11.05,0.224902113279},{11.15,0.165336459875},{11.25,0.320095837116},{11.35,0.320235013962},{11.45,0.324966877699},{11.55,0.30297768116},{11.65,0.313833087683},{11.75,0.294209837914},{11.85,0.565317094326},{11.95,0.182129899661},{12.05,0.529689013958},{12.15,0.0},{12.25,0.0933009803295},{12.35,0.224484607577},{12.45,0.217804342508},{12.55,0.135739197334},{12.65,0.0},{12.75,0.0},{12.85,0.0},{12.95,0.0},{13.05,0.288642942905},{13.15,0.293931484222},{13.25,0.144321471453},{13.35,0.258303433657},{13.45,0.255241632462},{13.55,0.0780291606983},{13.65,0.0724622756243},{13.75,0.20764477551},{13.85,0.0674520780643},{13.95,0.0},{14.05,0.0},{14.15,0.0},{14.25,0.0},{14.35,0.0},{14.45,0.0},{14.55,0.0},{14.65,0.0},{14.75,0.0},{14.85,0.097420476377},{14.95,0.0896268337965},{15.05,0.0},{15.15,0.0},{15.25,0.0},{15.35,0.0375764667988},{15.45,0.0},{15.55,0.0},{15.65,0.0},{15.75,0.0},{15.85,0.0},{15.95,0.0},{16.05,0.0},{16.15,0.0},{16.25,0.00250509800389},{16.35,0.00278344214894},{16.45,0.0},{16.55,0.0},{16.65,0.0},{16.75,0.0},{16.85,0.000556688406505},{16.95,0.0},{17.05,0.0},{17.15,0.000835032609757},{17.25,0.0},{17.35,0.000278344203252},{17.45,0.000556688406505},{17.55,0.0},{17.65,0.0},{17.75,0.0},{17.85,0.0},{17.95,0.0},{18.05,0.0},{18.15,0.0},{18.25,0.0},{18.35,0.0},{18.45,0.0},{18.55,0.0},{18.65,0.0},{18.75,0.0},{18.85,0.0},{18.95,0.0},{19.05,0.0},{19.15,0.0},{19.25,0.0},{19.35,0.0},{19.45,0.000278344203252},{19.55,0.0},{19.65,0.0},{19.75,0.0},{19.85,0.0},{19.95,0.0},{20.05,0.0},{20.15,0.0},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.0},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU55 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.0},{-21.35,0.0},{-21.25,0.0},{-21.15,0.0},{-21.05,0.0},{-20.95,0.0},{-20.85,0.0},{-20.75,0.0},{-20.65,0.0},{-20.55,0.0},{-20.45,0.0},{-20.35,0.0},{-20.25,0.0},{-20.15,0.0},{-20.05,0.0},{-19.95,0.0},{-19.85,0.0},{-19.75,0.0},{-19.65,0.0},{-19.55,0.0},{-19.45,0.0},{-19.35,0.0},{-19.25,0.0},{-19.15,0.0},{-19.05,0.0},{-18.95,0.0},{-18.85,0.0},{-18.75,0.0},{-18.65,0.0},{-18.55,0.0},{-18.45,0.0},{-18.35,0.0},{-18.25,0.0},{-18.15,0.000278344203252},{-18.05,0.0},{-17.95,0.0},{-17.85,0.0},{-17.75,0.0},{-17.65,0.0},{-17.55,0.0},{-17.45,0.0},{-17.35,0.0},{-17.25,0.0},{-17.15,0.000835032609757},{-17.05,0.0},{-16.95,0.0},{-16.85,0.0},{-16.75,0.0},{-16.65,0.000278344203252},{-16.55,0.0},{-16.45,0.0},{-16.35,0.0},{-16.25,0.0},{-16.15,0.00139172107447},{-16.05,0.00222675362602},{-15.95,0.00125254900195},{-15.85,0.0},{-15.75,0.00167006521951},{-15.65,0.00473185162991},{-15.55,0.0},{-15.45,0.0},{-15.35,0.0},{-15.25,0.0},{-15.15,0.0172573402524},{-15.05,0.00946370325983},{-14.95,0.0},{-14.85,0.0139172105119},{-14.75,0.0},{-14.65,0.0310353785753},{-14.55,0.0},{-14.45,0.103265702724},{-14.35,0.0},{-14.25,0.0},{-14.15,0.0},{-14.05,0.0},{-13.95,0.0551121532917},{-13.85,0.091296903789},{-13.75,0.0629985729853},{-13.65,0.211263254285},{-13.55,0.0},{-13.45,0.113146923482},{-13.35,0.125672414899},{-13.25,0.0},{-13.15,0.274169057608},{-13.05,0.0543327927589},{-12.95,0.0731349438429},{-12.85,0.318147420883},{-12.75,0.161578819156},{-12.65,0.168119907379},{-12.55,0.347373574972},{-12.45,0.335404783487},{-12.35,0.131749590238},{-12.25,0.127017736435},{-12.15,0.209036499262},{-12.05,0.448690861464},{-11.95,0.454257756472},{-11.85,0.122958555818},{-11.75,0.0629057884216},{-11.65,0.18398553133},{-11.55,0.188346246878},{-11.45,0.196325441202},{-11.35,0.0759183838964},{-11.25,0.156707793474},{-11.15,0.125254893303},{-11.05,0.203098495801},{-10.95,0.0694004893303},{-10.85,0.217757960161},{-10.75,0.110549042622},{-10.65,0.219799141089},{-10.55,0.085312500596},{-10.45,0.167702391744},{-10.35,0.0675541400909},{-10.25,0.233438014984},{-10.15,0.0898355916142},{-10.05,0.083379553424},{-9.95,0.0744570732117},{-9.85,0.0969333723187},{-9.75,0.13063621521},{-9.65,0.100969359279},{-9.55,0.140517433484},{-9.45,0.172629082203},{-9.35,0.0798594843258},{-9.25,0.0911020576954},{-9.15,0.12114931643},{-9.05,0.124141514301},{-8.95,0.115141722891},{-8.85,0.087284108003},{-8.75,0.100128000433},{-8.65,0.166926997049},{-8.55,0.118379795551},{-8.45,0.102129131556},{-8.35,0.253961253166},{-8.25,0.147058526675},{-8.15,0.226757744948},{-8.05,0.134111296047},{-7.95,0.0989049752553},{-7.85,0.0828147248218},{-7.75,0.151191516356},{-7.65,0.247646825654},{-7.55,0.109163120389},{-7.45,0.153321266174},{-7.35,0.106884174877},{-7.25,0.163643201192},{-7.15,0.150544456073},{-7.05,0.180251061916},{-6.95,0.161598699433},{-6.85,0.176984090071},{-6.75,0.242688322067},{-6.65,0.227609656074},{-6.55,0.21353640159},{-6.45,0.285395595762},{-6.35,0.191520690918},{-6.25,0.176522418857},{-6.15,0.206332581384},{-6.05,0.208658746311},{-5.95,0.220806479454},{-5.85,0.188520894331},{-5.75,0.232318009649},{-5.65,0.211158871651},{-5.55,0.217160671949},{-5.45,0.25377038547},{-5.35,0.200794418653},{-5.25,0.162855562956},{-5.15,0.20244413928},{-5.05,0.24229863286},{-4.95,0.268806266785},{-4.85,0.261121660471},{-4.75,0.382444945249},{-4.65,0.311626229967},{-4.55,0.366718490918},{-4.45,0.30317252477},{-4.35,0.330613272531},{-4.25,0.197543203831},{-4.15,0.242590904236},{-4.05,0.349162919181},{-3.95,0.265745464124},{-3.85,0.324097037315},{-3.75,0.349841562907},{-3.65,0.254101753235},{-3.55,0.234450547591},{-3.45,0.275157165527},{-3.35,0.402048315321},{-3.25,0.314977407455},{-3.15,0.249783681787},{-3.05,0.296046900749},{-2.95,0.248793323835},{-2.85,0.333564599355},{-2.75,0.242181739807},{-2.65,0.326014317964},{-2.55,0.285745642402},{-2.45,0.273927004441},{-2.35,0.45992405074},{-2.25,0.340664010299},{-2.15,0.288304100866},{-2.05,0.25572338471},{-1.95,0.334193968773},{-1.85,0.478016410555},{-1.75,0.339482522011},{-1.65,0.382135682636},{-1.55,0.313643325459},{-1.45,0.367853842284},{-1.35,0.289535959562},{-1.25,0.415797121385},{-1.15,0.321285139431},{-1.05,0.308429593625},{-0.95,0.39849612448},{-0.85,0.483725134532},{-0.75,0.425162595861},{-0.65,0.307129641374},{-0.55,0.456066995859},{-0.45,0.35270186833},{-0.35,0.434478928061},{-0.25,0.335341518575},{-0.15,0.38925705458},{-0.05,0.351283641089},{0.05,0.391454495882},{0.15,0.530881949833},{0.25,0.33888407187},{0.35,0.615511814753},{0.45,0.289477971884},{0.55,0.274096877487},{0.65,0.394208657114},{0.75,0.464156359434},{0.85,0.336935671893},{0.95,0.434266090393},{1.05,0.349428017934},{1.15,0.410403066211},{1.25,0.605700214704},{1.35,0.385213726445},{1.45,0.3637819767},{1.55,0.381038565385},{1.65,0.328420855782},{1.75,0.508833101818},{1.85,0.341382548923},{1.95,0.504121133259},{2.05,0.369333467985},{2.15,0.385073741277},{2.25,0.489249604089},{2.35,0.380821281009},{2.45,0.402502087986},{2.55,0.518234106211},{2.65,0.354478685479},{2.75,0.298600066792},{2.85,0.592341769825},{2.95,0.40841794014},{3.05,0.424938837687},{3.15,0.417553424835},{3.25,0.421932697296},{3.35,0.406215540568},{3.45,0.435429743358},{3.55,0.375642895699},{3.65,0.386731433868},{3.75,0.393819936117},{3.85,0.411034856524},{3.95,0.354993253946},{4.05,0.307029114829},{4.15,0.549701976776},{4.25,0.59213092592},{4.35,0.401757753812},{4.45,0.39655483686},{4.55,0.277400943968},{4.65,0.273009273741},{4.75,0.44087193229},{4.85,0.396570920944},{4.95,0.782147248586},{5.05,0.420755212957},{5.15,0.631920882634},{5.25,0.309618166515},{5.35,0.302082981382},{5.45,0.199029354822},{5.55,0.454659779867},{5.65,0.356432416222},{5.75,0.424351215363},{5.85,0.267687610218},{5.95,0.212687716765},{6.05,0.319210204211},{6.15,0.250668849264},{6.25,0.260166186553},{6.35,0.412923634052},{6.45,0.314139270782},{6.55,0.437596866063},{6.65,0.379731088877},{6.75,0.286416196823},{6.85,0.254330700094},{6.95,0.274419546127},{7.05,0.376718997955},{7.15,0.642140090466},{7.25,0.221536679701},{7.35,0.338466576168},{7.45,0.574711203575},{7.55,0.317630495344},{7.65,0.356048623721},{7.75,0.29428935051},{7.85,0.48216176033},{7.95,0.270709633827},{8.05,0.363740205765},{8.15,0.43999260664},{8.25,0.419395148754},{8.35,0.536925991376},{8.45,0.174336261219},{8.55,0.182037115097},{8.65,0.178766563535},{8.75,0.191182715552},{8.85,0.186848487173},{8.95,0.403135180473},{9.05,0.118741643429},{9.15,0.377991437912},{9.25,0.215104413033},{9.35,0.17350123326},{9.45,1.0023175478},{9.55,0.239236846566},{9.65,0.320095837116},{9.75,0.0979771614075},{9.85,0.184375202656},{9.95,0.164223086834},{10.05,0.102917768061},{10.15,0.259416798751},{10.25,0.752086043358},{10.35,0.0875740498304},{10.45,0.23520086209},{10.55,0.707272648811},{10.65,0.113332480192},{10.75,0.215995113055},{10.85,0.214325050513},{10.95,0.622377634048},{11.05,0.625439465046},{11.15,0.58313113451},{11.25,0.191315253576},{11.35,0.283215224743},{11.45,0.277787536383},{11.55,0.534977555275},{11.65,0.275143265724},{11.75,0.259277641773},{11.85,0.174521823724},{11.95,0.494339317083},{12.05,0.468453317881},{12.15,0.460102975368},{12.25,0.147800773382},{12.35,0.0},{12.45,0.196928530931},{12.55,0.371867865324},{12.65,0.358785688877},{12.75,0.178140297532},{12.85,0.0},{12.95,0.0973276893298},{13.05,0.0},{13.15,0.0935236513615},{13.25,0.268880516291},{13.35,0.0786786278089},{13.45,0.218500211835},{13.55,0.0},{13.65,0.0},{13.75,0.20736643672},{13.85,0.0},{13.95,0.0825290605426},{14.05,0.0},{14.15,0.150305867195},{14.25,0.147244080901},{14.35,0.0},{14.45,0.0},{14.55,0.131378471851},{14.65,0.0},{14.75,0.108554244041},{14.85,0.0},{14.95,0.0},{15.05,0.0},{15.15,0.0590089708567},{15.25,0.0},{15.35,0.0},{15.45,0.0},{15.55,0.0},{15.65,0.0},{15.75,0.0},{15.85,0.0},{15.95,0.00194840948097},{16.05,0.0},{16.15,0.0},{16.25,0.0},{16.35,0.00111337681301},{16.45,0.0},{16.55,0.0},{16.65,0.0},{16.75,0.0},{16.85,0.0},{16.95,0.0},{17.05,0.0},{17.15,0.0},{17.25,0.0},{17.35,0.000835032609757},{17.45,0.0},{17.55,0.0},{17.65,0.0},{17.75,0.0},{17.85,0.0},{17.95,0.0},{18.05,0.0},{18.15,0.0},{18.25,0.0},{18.35,0.0},{18.45,0.0},{18.55,0.0},{18.65,0.0},{18.75,0.0},{18.85,0.0},{18.95,0.0},{19.05,0.0},{19.15,0.0},{19.25,0.0},{19.35,0.0},{19.45,0.0},{19.55,0.0},{19.65,0.0},{19.75,0.0},{19.85,0.0},{19.95,0.0},{20.05,0.0},{20.15,0.0},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.0},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU56 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.0},{-21.35,0.0},{-21.25,0.0},{-21.15,0.0},{-21.05,0.0},{-20.95,0.0},{-20.85,0.0},{-20.75,0.0},{-20.65,0.0},{-20.55,0.0},{-20.45,0.0},{-20.35,0.0},{-20.25,0.0},{-20.15,0.0},{-20.05,0.0},{-19.95,0.0},{-19.85,0.0},{-19.75,0.0},{-19.65,0.0},{-19.55,0.0},{-19.45,0.0},{-19.35,0.0},{-19.25,0.0},{-19.15,0.0},{-19.05,0.0},{-18.95,0.0},{-18.85,0.0},{-18.75,0.0},{-18.65,0.0},{-18.55,0.0},{-18.45,0.0},{-18.35,0.0},{-18.25,0.0},{-18.15,0.0},{-18.05,0.0},{-17.95,0.0},{-17.85,0.0},{-17.75,0.0},{-17.65,0.0},{-17.55,0.0},{-17.45,0.0},{-17.35,0.0},{-17.25,0.0},{-17.15,0.0},{-17.05,0.000278344203252},{-16.95,0.0},{-16.85,0.0},{-16.75,0.0},{-16.65,0.0},{-16.55,0.0},{-16.45,0.000835032609757},{-16.35,0.00194840948097},{-16.25,0.0},{-16.15,0.0},{-16.05,0.0},{-15.95,0.00250509800389},{-15.85,0.0},{-15.75,0.0},{-15.65,0.00389681896195},{-15.55,0.0},{-15.45,0.00946370325983},{-15.35,0.0},{-15.25,0.00334013043903},{-15.15,0.00695860525593},{-15.05,0.0},{-14.95,0.0208758153021},{-14.85,0.0},{-14.75,0.024215945974},{-14.65,0.0},{-14.55,0.0},{-14.45,0.091296903789},{-14.35,0.10771921277},{-14.25,0.0419371922811},{-14.15,0.0},{-14.05,0.150584220886},{-13.95,0.0},{-13.85,0.055297717452},{-13.75,0.182872146368},{-13.65,0.0995080545545},{-13.55,0.093106135726},{-13.45,0.0681943297386},{-13.35,0.0796992232402},{-13.25,0.226293846965},{-13.15,0.129847571254},{-13.05,0.126924961805},{-12.95,0.26220023632},{-12.85,0.150862559676},{-12.75,0.0750137642026},{-12.65,0.11050265034},{-12.55,0.0834336802363},{-12.45,0.174939334393},{-12.35,0.072981852293},{-12.25,0.190248265862},{-12.15,0.190526604652},{-12.05,0.199155285954},{-11.95,0.408052623272},{-11.85,0.451752662659},{-11.75,0.235479205847},{-11.65,0.494895994663},{-11.55,0.129221305251},{-11.45,0.10972328186},{-11.35,0.136875763535},{-11.25,0.179160892963},{-11.15,0.0911113421122},{-11.05,0.1944698294},{-10.95,0.118073618412},{-10.85,0.0849347455161},{-10.75,0.20189233621},{-10.65,0.299220025539},{-10.55,0.196139891942},{-10.45,0.213026106358},{-10.35,0.201799551646},{-10.25,0.129318714142},{-10.15,0.211356043816},{-10.05,0.0713179707527},{-9.95,0.132324838638},{-9.85,0.113703608513},{-9.75,0.1368896842},{-9.65,0.145908033848},{-9.55,0.370058625937},{-9.45,0.129522840182},{-9.35,0.164557099342},{-9.25,0.134393860896},{-9.15,0.144414256016},{-9.05,0.0865650475025},{-8.95,0.228103086352},{-8.85,0.140802408968},{-8.75,0.189552402496},{-8.65,0.1390528168},{-8.55,0.173640390237},{-8.45,0.1514192479},{-8.35,0.140737786889},{-8.25,0.239710044861},{-8.15,0.149714395404},{-8.05,0.411671082179},{-7.95,0.162205085158},{-7.85,0.19404567991},{-7.75,0.120894163847},{-7.65,0.147912108898},{-7.55,0.218539970262},{-7.45,0.136249492566},{-7.35,0.140703002612},{-7.25,0.159769578414},{-7.15,0.198644982444},{-7.05,0.170802127231},{-6.95,0.159328867992},{-6.85,0.285382338933},{-6.75,0.130856573582},{-6.65,0.268289029598},{-6.55,0.244015084373},{-6.45,0.192544599374},{-6.35,0.232417416573},{-6.25,0.148253083229},{-6.15,0.179631420544},{-6.05,0.256188011169},{-5.95,0.323992669582},{-5.85,0.242893284017},{-5.75,0.23206949234},{-5.65,0.32383802202},{-5.55,0.2476567626},{-5.45,0.253733932972},{-5.35,0.239440257733},{-5.25,0.358321772681},{-5.15,0.21688580513},{-5.05,0.301876956766},{-4.95,0.349934339523},{-4.85,0.319134278731},{-4.75,0.226154670119},{-4.65,0.231965109706},{-4.55,0.423361539841},{-4.45,0.22940474398},{-4.35,0.232220930212},{-4.25,0.451288753086},{-4.15,0.274410279592},{-4.05,0.247480757096},{-3.95,0.288921292623},{-3.85,0.271977096796},{-3.75,0.34527529203},{-3.65,0.254963292016},{-3.55,0.327412332807},{-3.45,0.31825876236},{-3.35,0.318425782522},{-3.25,0.372317497547},{-3.15,0.257761378037},{-3.05,0.238010815212},{-2.95,0.393214739286},{-2.85,0.337149047852},{-2.75,0.398053646088},{-2.65,0.347967370351},{-2.55,0.406039971572},{-2.45,0.318851470947},{-2.35,0.417152331426},{-2.25,0.363870112101},{-2.15,0.325482620912},{-2.05,0.428371722882},{-1.95,0.40874845641},{-1.85,0.313941346274},{-1.75,0.342166900635},{-1.65,0.32188961241},{-1.55,0.645758575863},{-1.45,0.352645733777},{-1.35,0.394654973348},{-1.25,0.318088832654},{-1.15,0.547832012177},{-1.05,0.465926793905},{-0.95,0.554233941165},{-0.85,0.408497969309},{-0.75,0.346770498488},{-0.65,0.41504834493},{-0.55,0.328885655654},{-0.45,0.346693171395},{-0.35,0.329764642214},{-0.25,0.419817288717},{-0.15,0.285049785267},{-0.05,0.315698003769},{0.05,0.370394285987},{0.15,0.371245692758},{0.25,0.350466277864},{0.35,0.524075746536},{0.45,0.420596663157},{0.55,0.395387947559},{0.65,0.528413295746},{0.75,0.396327376366},{0.85,0.525722622871},{0.95,0.391560703516},{1.05,0.368036550634},{1.15,0.887162549155},{1.25,0.347358120812},{1.35,0.563950668682},{1.45,0.561344363473},{1.55,0.361781989827},{1.65,0.356411569259},{1.75,0.465798341311},{1.85,0.402133146922},{1.95,0.860202925546},{2.05,0.369293183088},{2.15,0.426860741207},{2.25,0.368405967951},{2.35,0.529866175218},{2.45,0.387826251984},{2.55,0.525311426683},{2.65,0.631872283088},{2.75,0.561253261566},{2.85,0.427343992087},{2.95,0.427408255064},{3.05,0.364296913147},{3.15,0.53809504509},{3.25,0.441407521566},{3.35,0.575677659776},{3.45,0.519919157028},{3.55,0.458432934501},{3.65,0.557678063711},{3.75,0.497929954529},{3.85,0.348486934389},{3.95,0.373088286473},{4.05,0.314083607992},{4.15,0.516081068251},{4.25,0.240826330687},{4.35,0.342898662274},{4.45,0.63148348672},{4.55,0.627467359815},{4.65,0.284207979838},{4.75,0.349252382914},{4.85,0.50181978941},{4.95,0.66765499115},{5.05,0.326080242793},{5.15,0.377546095848},{5.25,0.537363392966},{5.35,0.514857258115},{5.45,0.716625022888},{5.55,0.392836464776},{5.65,0.486863783428},{5.75,0.277764320374},{5.85,0.318564939499},{5.95,0.78277349472},{6.05,0.341899474462},{6.15,0.371902644634},{6.25,0.222653957514},{6.35,0.400895186833},{6.45,0.553737974167},{6.55,0.892649888992},{6.65,0.641165912151},{6.75,0.311536759138},{6.85,0.267024887933},{6.95,0.469009971619},{7.05,0.326815877642},{7.15,0.363749504089},{7.25,0.712468385696},{7.35,0.403376436234},{7.45,0.498096972704},{7.55,0.475968599319},{7.65,0.263591970716},{7.75,0.459476709366},{7.85,0.216203868389},{7.95,0.327833819389},{8.05,0.27175672849},{8.15,0.303896212578},{8.25,0.73093187809},{8.35,0.357950657606},{8.45,0.337561935186},{8.55,0.32100045681},{8.65,0.246946978569},{8.75,0.198691368103},{8.85,0.285233229399},{8.95,1.08331561089},{9.05,0.359713514646},{9.15,0.502828836441},{9.25,0.198069739342},{9.35,0.313415586948},{9.45,0.180812394619},{9.55,0.87400084734},{9.65,0.859805285931},{9.75,0.13110011816},{9.85,0.157320141792},{9.95,0.377713084221},{10.05,0.366300970316},{10.15,0.70810765028},{10.25,0.673592984676},{10.35,0.214974502722},{10.45,0.316755712032},{10.55,0.205974717935},{10.65,0.303395181894},{10.75,0.200222273668},{10.85,0.288364589214},{10.95,0.131517633796},{11.05,0.141538023949},{11.15,0.0},{11.25,0.516050159931},{11.35,0.176934142907},{11.45,0.264705330133},{11.55,0.251901507378},{11.65,0.503524661064},{11.75,0.246056288481},{11.85,0.122332282364},{11.95,0.0942473471165},{12.05,0.438948810101},{12.15,0.211263254285},{12.25,0.195536807179},{12.35,0.198041900992},{12.45,0.358507335186},{12.55,0.172155886889},{12.65,0.317034065723},{12.75,0.155455246568},{12.85,0.0979771614075},{12.95,0.0712561160326},{13.05,0.0910185575485},{13.15,0.122471451759},{13.25,0.0},{13.35,0.0480422109365},{13.45,0.226850524545},{13.55,0.0},{13.65,0.182593807578},{13.75,0.187325656414},{13.85,0.0878176018596},{13.95,0.0},{14.05,0.0},{14.15,0.0},{14.25,0.13110011816},{14.35,0.0},{14.45,0.0},{14.55,0.0},{14.65,0.0},{14.75,0.0495452694595},{14.85,0.079328097403},{14.95,0.0},{15.05,0.0},{15.15,0.0559471845627},{15.25,0.0},{15.35,0.0336796492338},{15.45,0.0},{15.55,0.0},{15.65,0.0},{15.75,0.0},{15.85,0.0},{15.95,0.0},{16.05,0.0},{16.15,0.0},{16.25,0.0},{16.35,0.0},{16.45,0.0},{16.55,0.0},{16.65,0.0},{16.75,0.0},{16.85,0.0},{16.95,0.0},{17.05,0.0},{17.15,0.0},{17.25,0.0},{17.35,0.0},{17.45,0.0},{17.55,0.0},{17.65,0.0},{17.75,0.0},{17.85,0.0},{17.95,0.0},{18.05,0.0},{18.15,0.0},{18.25,0.0},{18.35,0.0},{18.45,0.0},{18.55,0.0},{18.65,0.0},{18.75,0.0},{18.85,0.0},{18.95,0.0},{19.05,0.0},{19.15,0.0},{19.25,0.0},{19.35,0.0},{19.45,0.0},{19.55,0.0},{19.65,0.0},{19.75,0.0},{19.85,0.0},{19.95,0.0},{20.05,0.0},{20.15,0.0},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.0},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU57 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.0},{-21.35,0.0},{-21.25,0.0},{-21.15,0.0},{-21.05,0.0},{-20.95,0.0},{-20.85,0.0},{-20.75,0.0},{-20.65,0.0},{-20.55,0.0},{-20.45,0.0},{-20.35,0.0},{-20.25,0.0},{-20.15,0.0},{-20.05,0.0},{-19.95,0.0},{-19.85,0.0},{-19.75,0.0},{-19.65,0.0},{-19.55,0.0},{-19.45,0.0},{-19.35,0.0},{-19.25,0.0},{-19.15,0.0},{-19.05,0.0},{-18.95,0.0},{-18.85,0.0},{-18.75,0.0},{-18.65,0.0},{-18.55,0.0},{-18.45,0.0},{-18.35,0.0},{-18.25,0.0},{-18.15,0.0},{-18.05,0.0},{-17.95,0.0},{-17.85,0.0},{-17.75,0.0},{-17.65,0.0},{-17.55,0.0},{-17.45,0.0},{-17.35,0.0},{-17.25,0.0},{-17.15,0.0},{-17.05,0.0},{-16.95,0.0},{-16.85,0.0},{-16.75,0.0},{-16.65,0.0},{-16.55,0.0},{-16.45,0.000556688406505},{-16.35,0.0},{-16.25,0.0},{-16.15,0.00139172107447},{-16.05,0.0},{-15.95,0.0},{-15.85,0.0},{-15.75,0.00194840948097},{-15.65,0.0},{-15.55,0.00501019600779},{-15.45,0.0},{-15.35,0.00334013043903},{-15.25,0.00654108915478},{-15.15,0.0},{-15.05,0.0},{-14.95,0.0},{-14.85,0.0375764667988},{-14.75,0.0406382530928},{-14.65,0.0278344210237},{-14.55,0.0},{-14.45,0.0879567712545},{-14.35,0.0},{-14.25,0.0},{-14.15,0.118296287954},{-14.05,0.134440258145},{-13.95,0.0698643997312},{-13.85,0.0},{-13.75,0.167284876108},{-13.65,0.188160687685},{-13.55,0.0},{-13.45,0.186768963933},{-13.35,0.214603379369},{-13.25,0.0},{-13.15,0.108693413436},{-13.05,0.246056288481},{-12.95,0.259695142508},{-12.85,0.288921296597},{-12.75,0.284189432859},{-12.65,0.141398862004},{-12.55,0.293653130531},{-12.45,0.302838504314},{-12.35,0.114399472872},{-12.25,0.116069535414},{-12.15,0.366300970316},{-12.05,0.0},{-11.95,0.383836656809},{-11.85,0.10423990339},{-11.75,0.146594613791},{-11.65,0.212237462401},{-11.55,0.157821168502},{-11.45,0.239097669721},{-11.35,0.125672414899},{-11.25,0.248143866658},{-11.15,0.271942287683},{-11.05,0.136527836323},{-10.95,0.0},{-10.85,0.175913532575},{-10.75,0.278205037117},{-10.65,0.283911108971},{-10.55,0.55418330431},{-10.45,0.0940339565277},{-10.35,0.116347885132},{-10.25,0.282936900854},{-10.15,0.190572996934},{-10.05,0.141259685159},{-9.95,0.214510599772},{-9.85,0.209500412146},{-9.75,0.221376419067},{-9.65,0.330394566059},{-9.55,0.223232050737},{-9.45,0.229077279568},{-9.35,0.141899883747},{-9.25,0.366579324007},{-9.15,0.184403032064},{-9.05,0.160103595257},{-8.95,0.794394373894},{-8.85,0.118375812258},{-8.75,0.86815559864},{-8.65,0.144367863735},{-8.55,0.0},{-8.45,0.196789360046},{-8.35,0.495591878891},{-8.25,0.198737764359},{-8.15,0.544023752213},{-8.05,0.554740011692},{-7.95,0.192103902499},{-7.85,0.14961001277},{-7.75,0.178736754826},{-7.65,0.648681163788},{-7.55,0.221793949604},{-7.45,0.179149284959},{-7.35,0.296492242813},{-7.25,0.308906412125},{-7.15,0.309463095665},{-7.05,0.334013056755},{-6.95,0.332899665833},{-6.85,0.218187063932},{-6.75,0.600574016571},{-6.65,0.168524763801},{-6.55,0.380106854439},{-6.45,0.992018759251},{-6.35,0.0},{-6.25,0.299935783659},{-6.15,0.437557077408},{-6.05,0.280014276505},{-5.95,0.467228603363},{-5.85,0.79495104154},{-5.75,0.409026821454},{-5.65,0.228394074873},{-5.55,0.255770492554},{-5.45,0.265289855003},{-5.35,0.299745798111},{-5.25,0.393459422248},{-5.15,0.404235328947},{-5.05,0.491695046425},{-4.95,0.432069744383},{-4.85,0.381470739841},{-4.75,0.527787009875},{-4.65,0.534142533938},{-4.55,0.819793283939},{-4.45,0.846583902836},{-4.35,0.339385104179},{-4.25,0.439679473639},{-4.15,0.510960442679},{-4.05,0.369195771217},{-3.95,0.527979203633},{-3.85,0.343856313012},{-3.75,0.480213344097},{-3.65,0.961540102959},{-3.55,0.664314866066},{-3.45,0.447175449795},{-3.35,0.316220430227},{-3.25,0.600467954363},{-3.15,0.522869586945},{-3.05,0.476772679223},{-2.95,0.615697383881},{-2.85,0.48527765274},{-2.75,0.628024033138},{-2.65,0.453756713867},{-2.55,0.655103002276},{-2.45,0.511472966936},{-2.35,0.516142951118},{-2.25,0.595969736576},{-2.15,0.343536411013},{-2.05,0.964462661743},{-1.95,1.22715008259},{-1.85,0.539895004696},{-1.75,0.99892168045},{-1.65,0.55647193061},{-1.55,0.38976753675},{-1.45,0.719917433602},{-1.35,1.72981643677},{-1.25,0.470502940091},{-1.15,0.859016656876},{-1.05,0.741230624063},{-0.95,0.580100271437},{-0.85,0.657205462456},{-0.75,0.486672184684},{-0.65,0.880681117376},{-0.55,0.483711632815},{-0.45,0.596955564287},{-0.35,1.05954504013},{-0.25,0.675889313221},{-0.15,0.896221955617},{-0.05,0.60218222936},{0.05,1.35664963722},{0.15,0.675471782684},{0.25,0.541908359528},{0.35,0.5435505867},{0.45,0.778250421797},{0.55,0.535478591919},{0.65,0.547753572464},{0.75,0.674323618412},{0.85,1.08181257248},{0.95,0.773478780474},{1.05,0.598749319712},{1.15,0.892232338587},{1.25,0.488215749914},{1.35,0.756619112832},{1.45,1.0575966835},{1.55,0.532138442993},{1.65,0.742463316236},{1.75,0.659780144691},{1.85,0.865650494893},{1.95,0.865928808848},{2.05,1.28483688831},{2.15,1.28059208393},{2.25,0.725722857884},{2.35,0.719599315098},{2.45,0.824038028717},{2.55,1.65011723836},{2.65,0.965576076508},{2.75,0.608738780022},{2.85,0.797595342},{2.95,0.665083612714},{3.05,0.584383666515},{3.15,0.77337940534},{3.25,0.573110699654},{3.35,0.760018905004},{3.45,0.894208621979},{3.55,0.874668884277},{3.65,1.07948839664},{3.75,0.8445520401},{3.85,0.852512645721},{3.95,0.595855440412},{4.05,0.512536048889},{4.15,0.66765499115},{4.25,0.788827514648},{4.35,0.554620708738},{4.45,1.90554451942},{4.55,0.418629699283},{4.65,0.612310886383},{4.75,0.895642101765},{4.85,0.389496326447},{4.95,0.68673081398},{5.05,0.563136736552},{5.15,1.08906809489},{5.25,0.799265384674},{5.35,0.789384186268},{5.45,0.770247995853},{5.55,1.01781201363},{5.65,0.589644384384},{5.75,0.954163948695},{5.85,0.7069247365},{5.95,0.453376332919},{6.05,0.376559938703},{6.15,0.322983652353},{6.25,0.358348301479},{6.35,0.0},{6.45,0.0},{6.55,0.570188105106},{6.65,0.363424738248},{6.75,0.363610307376},{6.85,1.05255866051},{6.95,2.00547003746},{7.05,0.0},{7.15,0.628594001134},{7.25,0.608460426331},{7.35,0.596120516459},{7.45,0.352272439003},{7.55,0.830439925194},{7.65,0.407356739044},{7.75,0.0},{7.85,0.753338575363},{7.95,0.483947793643},{8.05,0.467711051305},{8.15,0.680969119072},{8.25,0.326636940241},{8.35,0.408423741659},{8.45,0.578955948353},{8.55,0.291356801987},{8.65,0.0},{8.75,0.533585846424},{8.85,0.514101743698},{8.95,0.470401704311},{9.05,0.308776517709},{9.15,0.442706465721},{9.25,0.293096462886},{9.35,0.272498985132},{9.45,0.267396012942},{9.55,0.193588390946},{9.65,0.247726341089},{9.75,0.696973919868},{9.85,0.697530567646},{9.95,0.0},{10.05,0.0},{10.15,0.210242668788},{10.25,0.620150923729},{10.35,0.298106640577},{10.45,0.287251234055},{10.55,0.572275698185},{10.65,0.544997990131},{10.75,0.530524075031},{10.85,0.526070535183},{10.95,0.0},{11.05,0.255102455616},{11.15,0.478195339441},{11.25,0.495452702045},{11.35,0.0},{11.45,0.0},{11.55,0.235200852156},{11.65,0.454257756472},{11.75,0.0},{11.85,0.0},{11.95,0.0},{12.05,0.423918217421},{12.15,0.425031602383},{12.25,0.182593807578},{12.35,0.357115626335},{12.45,0.0},{12.55,0.315920680761},{12.65,0.0},{12.75,0.0},{12.85,0.0},{12.95,0.275004088879},{13.05,0.230747357011},{13.15,0.0},{13.25,0.209871530533},{13.35,0.0},{13.45,0.0},{13.55,0.0},{13.65,0.0},{13.75,0.0},{13.85,0.0},{13.95,0.0},{14.05,0.0},{14.15,0.0},{14.25,0.0},{14.35,0.0},{14.45,0.110780999064},{14.55,0.0},{14.65,0.0},{14.75,0.0},{14.85,0.0},{14.95,0.0},{15.05,0.0},{15.15,0.0},{15.25,0.0},{15.35,0.0},{15.45,0.0208758153021},{15.55,0.0},{15.65,0.0},{15.75,0.0},{15.85,0.0},{15.95,0.0},{16.05,0.0},{16.15,0.0},{16.25,0.0},{16.35,0.0},{16.45,0.0},{16.55,0.0},{16.65,0.0},{16.75,0.0},{16.85,0.0},{16.95,0.0},{17.05,0.0},{17.15,0.0},{17.25,0.0},{17.35,0.0},{17.45,0.0},{17.55,0.0},{17.65,0.0},{17.75,0.0},{17.85,0.0},{17.95,0.0},{18.05,0.0},{18.15,0.0},{18.25,0.0},{18.35,0.0},{18.45,0.0},{18.55,0.0},{18.65,0.0},{18.75,0.0},{18.85,0.0},{18.95,0.0},{19.05,0.0},{19.15,0.0},{19.25,0.0},{19.35,0.0},{19.45,0.0},{19.55,0.0},{19.65,0.0},{19.75,0.0},{19.85,0.0},{19.95,0.0},{20.05,0.0},{20.15,0.0},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.0},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU58 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.0},{-21.35,0.0},{-21.25,0.0},{-21.15,0.0},{-21.05,0.0},{-20.95,0.0},{-20.85,0.0},{-20.75,0.0},{-20.65,0.0},{-20.55,0.0},{-20.45,0.0},{-20.35,0.0},{-20.25,0.0},{-20.15,0.0},{-20.05,0.0},{-19.95,0.0},{-19.85,0.0},{-19.75,0.0},{-19.65,0.0},{-19.55,0.0},{-19.45,0.0},{-19.35,0.0},{-19.25,0.0},{-19.15,0.0},{-19.05,0.0},{-18.95,0.0},{-18.85,0.0},{-18.75,0.0},{-18.65,0.0},{-18.55,0.0},{-18.45,0.0},{-18.35,0.0},{-18.25,0.0},{-18.15,0.0},{-18.05,0.0},{-17.95,0.0},{-17.85,0.0},{-17.75,0.0},{-17.65,0.0},{-17.55,0.0},{-17.45,0.0},{-17.35,0.0},{-17.25,0.0},{-17.15,0.0},{-17.05,0.0},{-16.95,0.0},{-16.85,0.0},{-16.75,0.0},{-16.65,0.0},{-16.55,0.0},{-16.45,0.0},{-16.35,0.0},{-16.25,0.0},{-16.15,0.0},{-16.05,0.0},{-15.95,0.0},{-15.85,0.0},{-15.75,0.0},{-15.65,0.00334013043903},{-15.55,0.0},{-15.45,0.0},{-15.35,0.00723694963381},{-15.25,0.0},{-15.15,0.0},{-15.05,0.0},{-14.95,0.0231025703251},{-14.85,0.0306178629398},{-14.75,0.0},{-14.65,0.0},{-14.55,0.0740395635366},{-14.45,0.0},{-14.35,0.0},{-14.25,0.0},{-14.15,0.0},{-14.05,0.0},{-13.95,0.148914158344},{-13.85,0.166449844837},{-13.75,0.0},{-13.65,0.164779767394},{-13.55,0.186490625143},{-13.45,0.19177916646},{-13.35,0.194284260273},{-13.25,0.100343085825},{-13.15,0.0},{-13.05,0.236592575908},{-12.95,0.244107872248},{-12.85,0.0},{-12.75,0.275282412767},{-12.65,0.0982555051645},{-12.55,0.0},{-12.45,0.0738307982683},{-12.35,0.160326272249},{-12.25,0.163248881698},{-12.15,0.161857157946},{-12.05,0.0},{-11.95,0.178140297532},{-11.85,0.126739392678},{-11.75,0.191500812769},{-11.65,0.0},{-11.55,0.442845642567},{-11.45,0.462051391602},{-11.35,0.227128878236},{-11.25,0.0},{-11.15,0.0},{-11.05,0.117530845106},{-10.95,0.495731025934},{-10.85,0.162831366062},{-10.75,0.528297305107},{-10.65,0.494339317083},{-10.55,0.527740597725},{-10.45,0.170810560385},{-10.35,0.105770802498},{-10.25,0.257607579231},{-10.15,0.135414451361},{-10.05,0.271663963795},{-9.95,0.177026927471},{-9.85,0.275004088879},{-9.75,0.279735922813},{-9.65,0.147661596537},{-9.55,0.121747756004},{-9.45,0.316059857607},{-9.35,0.318147420883},{-9.25,0.163248881698},{-9.15,0.112126330535},{-9.05,0.235479195913},{-8.95,0.234922508399},{-8.85,0.766559958458},{-8.75,0.397893041372},{-8.65,0.1628870368},{-8.55,0.830579102039},{-8.45,0.278808116913},{-8.35,0.130026510784},{-8.25,0.156522224347},{-8.15,0.315920670827},{-8.05,0.250927299261},{-7.95,0.258581757545},{-7.85,0.270411401987},{-7.75,0.379661520322},{-7.65,0.193681180477},{-7.55,0.396083792051},{-7.45,0.251623177528},{-7.35,0.219706356525},{-7.25,0.685840129852},{-7.15,0.46965944767},{-7.05,0.286694526672},{-6.95,0.211660896029},{-6.85,0.303951883316},{-6.75,0.526720007261},{-6.65,0.232496942793},{-6.55,0.331953310966},{-6.45,0.346427202225},{-6.35,0.306456983089},{-6.25,0.369195771217},{-6.15,0.38467168808},{-6.05,0.334291378657},{-5.95,0.335312008858},{-5.85,0.341481963793},{-5.75,0.350388964017},{-5.65,2.18555879593},{-5.55,0.462775087357},{-5.45,0.388197382291},{-5.35,0.467506933212},{-5.25,0.24343984127},{-5.15,0.627874970436},{-5.05,0.323853492737},{-4.95,0.328307002783},{-4.85,0.436814864477},{-4.75,0.463628689448},{-4.65,0.274196887016},{-4.55,0.71666675806},{-4.45,0.592984485626},{-4.35,0.273612369191},{-4.25,0.610631513596},{-4.15,0.625773429871},{-4.05,0.28828867999},{-3.95,0.464874608176},{-3.85,0.552559653918},{-3.75,0.482052394322},{-3.65,0.382692363527},{-3.55,0.435469508171},{-3.45,0.388908704122},{-3.35,1.77889788151},{-3.25,0.448725670576},{-3.15,0.617599407832},{-3.05,0.740896606445},{-2.95,0.760881710052},{-2.85,0.426454252667},{-2.75,0.545992033822},{-2.65,0.561181681497},{-2.55,0.50202858448},{-2.45,0.812152767181},{-2.35,0.282618778093},{-2.25,0.688391606013},{-2.15,0.699989318848},{-2.05,0.421747159958},{-1.95,0.526348888874},{-1.85,1.06682372093},{-1.75,0.42942943573},{-1.65,0.482463306851},{-1.55,0.485123051537},{-1.45,0.366370558739},{-1.35,0.401979663155},{-1.25,0.496813509199},{-1.15,0.409773306413},{-1.05,0.758348782857},{-0.95,0.454202079773},{-0.85,0.651921885354},{-0.75,0.770827929179},{-0.65,0.579477846622},{-0.55,0.470707893372},{-0.45,0.466421413422},{-0.35,0.582504868507},{-0.25,0.582957148552},{-0.15,0.676495688302},{-0.05,0.590437650681},{0.05,0.42776445909},{0.15,0.787482182185},{0.25,0.671962669918},{0.35,0.670213086264},{0.45,0.676933152335},{0.55,0.461856555939},{0.65,0.782750288645},{0.75,0.669616631099},{0.85,0.775466998418},{0.95,0.782193581263},{1.05,0.933622169495},{1.15,1.15220582485},{1.25,0.426423332908},{1.35,0.654983656747},{1.45,0.768090883891},{1.55,0.765539328257},{1.65,0.757374604543},{1.75,0.756585915883},{1.85,0.640827928271},{1.95,0.63239806039},{2.05,0.644008977073},{2.15,0.627308300563},{2.25,0.630727972303},{2.35,0.619753292629},{2.45,0.719844500224},{2.55,2.1097099781},{2.65,0.705741723378},{2.75,0.607386861529},{2.85,0.69247396787},{2.95,0.412673139572},{3.05,1.02430665493},{3.15,0.806251811981},{3.25,0.789439868927},{3.35,0.786433744431},{3.45,0.382778954506},{3.55,0.768174362183},{3.65,0.625856955846},{3.75,0.612821181615},{3.85,0.913247346878},{3.95,0.608645995458},{4.05,1.19762237867},{4.15,0.583873391151},{4.25,0.426144987345},{4.35,0.847070991993},{4.45,0.82466429472},{4.55,0.655778980255},{4.65,0.631229019165},{4.75,0.782495141029},{4.85,0.436881133488},{4.95,1.00742046038},{5.05,0.588809347153},{5.15,0.413818325315},{5.25,0.403161696025},{5.35,0.457412322362},{5.45,0.386262246541},{5.55,0.531860113144},{5.65,0.854887882868},{5.75,0.314146220684},{5.85,0.495786714554},{5.95,0.821115414302},{6.05,1.1554068327},{6.15,0.571579813957},{6.25,0.552374064922},{6.35,0.725550572077},{6.45,2.09927201271},{6.55,0.0},{6.65,0.4953135252},{6.75,0.377379083633},{6.85,0.460172563791},{6.95,1.80840229988},{7.05,0.343142747879},{7.15,1.68481755257},{7.25,0.544162948926},{7.35,0.787157416344},{7.45,0.0},{7.55,0.367971032858},{7.65,1.41176187992},{7.75,0.467618266741},{7.85,1.31879484653},{7.95,0.161091715097},{8.05,0.411485513051},{8.15,1.20216858387},{8.25,1.16347885132},{8.35,0.562811970711},{8.45,0.520364522934},{8.55,0.0},{8.65,0.19322655201},{8.75,0.318147440751},{8.85,0.887639701366},{8.95,0.833362579346},{9.05,0.280014276505},{9.15,0.0},{9.25,0.378826469183},{9.35,0.377713084221},{9.45,0.366300970316},{9.55,0.72870516777},{9.65,0.711169481277},{9.75,0.679994881153},{9.85,0.211541593075},{9.95,0.0},{10.05,0.295323193073},{10.15,0.564203739166},{10.25,0.550286531448},{10.35,0.0},{10.45,0.0},{10.55,0.522730410099},{10.65,0.247030481696},{10.75,0.255937486887},{10.85,0.482927203178},{10.95,0.0},{11.05,0.472071766853},{11.15,0.0},{11.25,0.467339932919},{11.35,0.452866017818},{11.45,0.436165362597},{11.55,0.426980018616},{11.65,0.0},{11.75,0.0},{11.85,0.401094019413},{11.95,0.196789354086},{12.05,0.0},{12.15,0.186490625143},{12.25,0.363795876503},{12.35,0.33846655488},{12.45,0.328446179628},{12.55,0.0},{12.65,0.0},{12.75,0.272777318954},{12.85,0.0},{12.95,0.124559037387},{13.05,0.0},{13.15,0.220448613167},{13.25,0.21488173306},{13.35,0.0},{13.45,0.192892536521},{13.55,0.0},{13.65,0.0},{13.75,0.0},{13.85,0.0},{13.95,0.0},{14.05,0.0},{14.15,0.0},{14.25,0.128316685557},{14.35,0.0},{14.45,0.0},{14.55,0.0},{14.65,0.0},{14.75,0.08461663872},{14.85,0.0},{14.95,0.0},{15.05,0.0},{15.15,0.0},{15.25,0.0},{15.35,0.0},{15.45,0.0},{15.55,0.0},{15.65,0.0},{15.75,0.00556688429788},{15.85,0.0},{15.95,0.0},{16.05,0.0},{16.15,0.0},{16.25,0.0},{16.35,0.0},{16.45,0.0},{16.55,0.0},{16.65,0.0},{16.75,0.0},{16.85,0.0},{16.95,0.0},{17.05,0.0},{17.15,0.0},{17.25,0.0},{17.35,0.0},{17.45,0.0},{17.55,0.0},{17.65,0.0},{17.75,0.0},{17.85,0.0},{17.95,0.0},{18.05,0.0},{18.15,0.0},{18.25,0.0},{18.35,0.0},{18.45,0.0},{18.55,0.0},{18.65,0.0},{18.75,0.0},{18.85,0.0},{18.95,0.0},{19.05,0.0},{19.15,0.0},{19.25,0.0},{19.35,0.0},{19.45,0.0},{19.55,0.0},{19.65,0.0},{19.75,0.0},{19.85,0.0},{19.95,0.0},{20.05,0.0},{20.15,0.0},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.0},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-map<double,double>AnalyzerAllSteps::mapPU59 = {{-29.95,0.0},{-29.85,0.0},{-29.75,0.0},{-29.65,0.0},{-29.55,0.0},{-29.45,0.0},{-29.35,0.0},{-29.25,0.0},{-29.15,0.0},{-29.05,0.0},{-28.95,0.0},{-28.85,0.0},{-28.75,0.0},{-28.65,0.0},{-28.55,0.0},{-28.45,0.0},{-28.35,0.0},{-28.25,0.0},{-28.15,0.0},{-28.05,0.0},{-27.95,0.0},{-27.85,0.0},{-27.75,0.0},{-27.65,0.0},{-27.55,0.0},{-27.45,0.0},{-27.35,0.0},{-27.25,0.0},{-27.15,0.0},{-27.05,0.0},{-26.95,0.0},{-26.85,0.0},{-26.75,0.0},{-26.65,0.0},{-26.55,0.0},{-26.45,0.0},{-26.35,0.0},{-26.25,0.0},{-26.15,0.0},{-26.05,0.0},{-25.95,0.0},{-25.85,0.0},{-25.75,0.0},{-25.65,0.0},{-25.55,0.0},{-25.45,0.0},{-25.35,0.0},{-25.25,0.0},{-25.15,0.0},{-25.05,0.0},{-24.95,0.0},{-24.85,0.0},{-24.75,0.0},{-24.65,0.0},{-24.55,0.0},{-24.45,0.0},{-24.35,0.0},{-24.25,0.0},{-24.15,0.0},{-24.05,0.0},{-23.95,0.0},{-23.85,0.0},{-23.75,0.0},{-23.65,0.0},{-23.55,0.0},{-23.45,0.0},{-23.35,0.0},{-23.25,0.0},{-23.15,0.0},{-23.05,0.0},{-22.95,0.0},{-22.85,0.0},{-22.75,0.0},{-22.65,0.0},{-22.55,0.0},{-22.45,0.0},{-22.35,0.0},{-22.25,0.0},{-22.15,0.0},{-22.05,0.0},{-21.95,0.0},{-21.85,0.0},{-21.75,0.0},{-21.65,0.0},{-21.55,0.0},{-21.45,0.0},{-21.35,0.0},{-21.25,0.0},{-21.15,0.0},{-21.05,0.0},{-20.95,0.0},{-20.85,0.0},{-20.75,0.0},{-20.65,0.0},{-20.55,0.0},{-20.45,0.0},{-20.35,0.0},{-20.25,0.0},{-20.15,0.0},{-20.05,0.0},{-19.95,0.0},{-19.85,0.0},{-19.75,0.0},{-19.65,0.0},{-19.55,0.0},{-19.45,0.0},{-19.35,0.0},{-19.25,0.0},{-19.15,0.0},{-19.05,0.0},{-18.95,0.0},{-18.85,0.0},{-18.75,0.0},{-18.65,0.0},{-18.55,0.0},{-18.45,0.0},{-18.35,0.0},{-18.25,0.0},{-18.15,0.0},{-18.05,0.0},{-17.95,0.000835032609757},{-17.85,0.0},{-17.75,0.0},{-17.65,0.0},{-17.55,0.0},{-17.45,0.0},{-17.35,0.0},{-17.25,0.0},{-17.15,0.0},{-17.05,0.0},{-16.95,0.0},{-16.85,0.0},{-16.75,0.0},{-16.65,0.0},{-16.55,0.0},{-16.45,0.0},{-16.35,0.0},{-16.25,0.0},{-16.15,0.0},{-16.05,0.0},{-15.95,0.0},{-15.85,0.0},{-15.75,0.0},{-15.65,0.0},{-15.55,0.0},{-15.45,0.0},{-15.35,0.0},{-15.25,0.0},{-15.15,0.0111337685958},{-15.05,0.0},{-14.95,0.030339518562},{-14.85,0.0253293234855},{-14.75,0.0459267944098},{-14.65,0.0},{-14.55,0.079328097403},{-14.45,0.0},{-14.35,0.0893484950066},{-14.25,0.0},{-14.15,0.0},{-14.05,0.0},{-13.95,0.0},{-13.85,0.145295679569},{-13.75,0.156151100993},{-13.65,0.0},{-13.55,0.170625001192},{-13.45,0.0},{-13.35,0.202634587884},{-13.25,0.100064747036},{-13.15,0.0},{-13.05,0.220726951957},{-12.95,0.241881117225},{-12.85,0.0},{-12.75,0.253849923611},{-12.65,0.128455847502},{-12.55,0.275560766459},{-12.45,0.0},{-12.35,0.145713195205},{-12.25,0.15392434597},{-12.15,0.307570338249},{-12.05,0.173130095005},{-11.95,0.345425158739},{-11.85,0.367136001587},{-11.75,0.17647023499},{-11.65,0.0},{-11.55,0.399423927069},{-11.45,0.0},{-11.35,0.441453903913},{-11.25,0.2223970294},{-11.15,0.0},{-11.05,0.148171901703},{-10.95,0.153831571341},{-10.85,0.150584220886},{-10.75,0.466783225536},{-10.65,0.232278242707},{-10.55,0.489885807037},{-10.45,0.162460237741},{-10.35,0.507699847221},{-10.25,0.242855325341},{-10.15,0.250231444836},{-10.05,0.247865512967},{-9.95,0.251066476107},{-9.85,0.0},{-9.75,0.130056336522},{-9.65,0.181294858456},{-9.55,0.183243274689},{-9.45,0.184078296026},{-9.35,0.145086914301},{-9.25,0.308683723211},{-9.15,0.166519418359},{-9.05,0.221005300681},{-8.95,0.224530994892},{-8.85,0.171460032463},{-8.75,0.234644174576},{-8.65,0.236499806245},{-8.55,0.185098901391},{-8.45,0.778807103634},{-8.35,0.807476580143},{-8.25,0.415985435247},{-8.15,0.218221858144},{-8.05,0.177527940273},{-7.95,0.47541192174},{-7.85,0.319539149602},{-7.75,1.00537931919},{-7.65,0.340322176615},{-7.55,0.530802428722},{-7.45,0.274099469185},{-7.35,0.192985316118},{-7.25,0.399795055389},{-7.15,0.407124797503},{-7.05,1.28678524494},{-6.95,0.329420357943},{-6.85,0.272554659843},{-6.75,0.352662116289},{-6.65,0.239097674688},{-6.55,0.288754272461},{-6.45,0.50092681249},{-6.35,0.264566163222},{-6.25,0.545461853345},{-6.15,0.572090148926},{-6.05,0.442567288876},{-5.95,0.435817450285},{-5.85,0.304322997729},{-5.75,0.470540881157},{-5.65,0.971142947674},{-5.55,0.676190853119},{-5.45,0.251066476107},{-5.35,0.423862552643},{-5.25,0.529619455338},{-5.15,0.446575450897},{-5.05,1.1190829277},{-4.95,0.461661720276},{-4.85,0.295566767454},{-4.75,0.80868268013},{-4.65,0.415707071622},{-4.55,0.420392553012},{-4.45,0.322044253349},{-4.35,0.519056272507},{-4.25,0.541212463379},{-4.15,0.273918533325},{-4.05,0.0},{-3.95,0.573444747925},{-3.85,0.35777670145},{-3.75,0.420617852892},{-3.65,0.329776022169},{-3.55,0.996193965276},{-3.45,0.513405879339},{-3.35,0.616532421112},{-3.25,0.531962156296},{-3.15,0.536879579226},{-3.05,0.822089612484},{-2.95,0.481535468783},{-2.85,0.421552300453},{-2.75,0.375177065531},{-2.65,0.431433528662},{-2.55,0.578723986944},{-2.45,0.582435250282},{-2.35,1.7659548521},{-2.25,0.517441885812},{-2.15,0.895642101765},{-2.05,0.918048799038},{-1.95,0.524758372988},{-1.85,0.616949955622},{-1.75,0.623676578204},{-1.65,3.82556271553},{-1.55,0.422031667497},{-1.45,0.638336062431},{-1.35,0.387844824791},{-1.25,1.31990822156},{-1.15,0.490024983883},{-1.05,0.563806091036},{-0.95,0.439907550812},{-0.85,0.398338389397},{-0.75,0.662598411242},{-0.65,1.01296412945},{-0.55,0.582375594548},{-0.45,0.672572374344},{-0.35,1.02082741261},{-0.25,0.817942333221},{-0.15,0.583886623383},{-0.05,0.678556760152},{0.05,0.684355656306},{0.15,0.82284116745},{0.25,0.822284507751},{0.35,2.06378316879},{0.45,1.01212918758},{0.55,0.683195829391},{0.65,0.454134040409},{0.75,0.813822841644},{0.85,1.03655385971},{0.95,0.447515646617},{1.05,0.683474222819},{1.15,0.667098283768},{1.25,0.58424452373},{1.35,0.99549806118},{1.45,0.667933305105},{1.55,0.573349339621},{1.65,1.31369185448},{1.75,0.563448224749},{1.85,0.647475004196},{1.95,0.567225728716},{2.05,0.960635483265},{2.15,0.643763780594},{2.25,1.89134895802},{2.35,0.421134789785},{2.45,0.418505986532},{2.55,0.750917005539},{2.65,0.727313423157},{2.75,1.21552920341},{2.85,0.91011595726},{2.95,0.711503458023},{3.05,0.705379915237},{3.15,0.497242041997},{3.25,3.4918282032},{3.35,0.569909771283},{3.45,1.12729406357},{3.55,0.664017963409},{3.65,0.411288350821},{3.75,0.80907702446},{3.85,0.527323087056},{3.95,0.785974442959},{4.05,0.765446603298},{4.15,0.517395496368},{4.25,0.994709412257},{4.35,0.580291986465},{4.45,2.89895486832},{4.55,0.558859491348},{4.65,0.468870838483},{4.75,0.697530567646},{4.85,1.35108280182},{4.95,0.331055641174},{5.05,0.429021199544},{5.15,0.421181162198},{5.25,0.822043259939},{5.35,0.598231315613},{5.45,0.393161177635},{5.55,0.788270791372},{5.65,1.11073255539},{5.75,0.549242734909},{5.85,0.720169226329},{5.95,0.690293629964},{6.05,0.340971668561},{6.15,0.32297205925},{6.25,0.966132760048},{6.35,0.954163968563},{6.45,0.60920270284},{6.55,0.603728572528},{6.65,0.880681097507},{6.75,0.836145997047},{6.85,0.797873675823},{6.95,0.780755519867},{7.05,0.765446603298},{7.15,0.4890507857},{7.25,0.713952898979},{7.35,0.0},{7.45,1.38142228127},{7.55,0.656196475029},{7.65,1.24698209763},{7.75,0.416217366854},{7.85,0.0},{7.95,1.13425266743},{8.05,1.11365520954},{8.15,0.208869504929},{8.25,0.0},{8.35,0.0},{8.45,0.0},{8.55,0.298013865948},{8.65,0.877897620201},{8.75,0.826960623264},{8.85,0.40693923831},{8.95,0.0},{9.05,0.184611797333},{9.15,0.237520396709},{9.25,0.704210877419},{9.35,0.226572195689},{9.45,0.0},{9.55,0.652995526791},{9.65,0.612357258797},{9.75,0.0},{9.85,0.291565567255},{9.95,0.56865721941},{10.05,0.181573212147},{10.15,0.182501018047},{10.25,0.0},{10.35,0.247169658542},{10.45,0.0},{10.55,0.479865431786},{10.65,0.0},{10.75,0.43811377883},{10.85,0.432825237513},{10.95,0.215438425541},{11.05,0.144924551249},{11.15,0.0},{11.25,0.0},{11.35,0.397475540638},{11.45,0.399980634451},{11.55,0.423918217421},{11.65,0.397475540638},{11.75,0.394135415554},{11.85,0.0},{11.95,0.0},{12.05,0.0},{12.15,0.0},{12.25,0.358785688877},{12.35,0.148774981499},{12.45,0.298384994268},{12.55,0.0},{12.65,0.0},{12.75,0.0},{12.85,0.0},{12.95,0.224902123213},{13.05,0.229077279568},{13.15,0.0},{13.25,0.0},{13.35,0.0},{13.45,0.0},{13.55,0.0},{13.65,0.175635203719},{13.75,0.159491226077},{13.85,0.0637408271432},{13.95,0.146965742111},{14.05,0.136388659477},{14.15,0.0},{14.25,0.132491841912},{14.35,0.0},{14.45,0.0},{14.55,0.0},{14.65,0.0},{14.75,0.0},{14.85,0.0},{14.95,0.0668026134372},{15.05,0.0},{15.15,0.0},{15.25,0.0},{15.35,0.0},{15.45,0.0},{15.55,0.0},{15.65,0.0},{15.75,0.0},{15.85,0.00528853992},{15.95,0.0},{16.05,0.0},{16.15,0.0},{16.25,0.0},{16.35,0.0},{16.45,0.0},{16.55,0.0},{16.65,0.0},{16.75,0.0},{16.85,0.0},{16.95,0.0},{17.05,0.0},{17.15,0.0},{17.25,0.0},{17.35,0.0},{17.45,0.0},{17.55,0.0},{17.65,0.0},{17.75,0.0},{17.85,0.0},{17.95,0.0},{18.05,0.0},{18.15,0.0},{18.25,0.0},{18.35,0.0},{18.45,0.0},{18.55,0.0},{18.65,0.0},{18.75,0.0},{18.85,0.0},{18.95,0.0},{19.05,0.0},{19.15,0.0},{19.25,0.0},{19.35,0.0},{19.45,0.0},{19.55,0.0},{19.65,0.0},{19.75,0.0},{19.85,0.0},{19.95,0.0},{20.05,0.0},{20.15,0.0},{20.25,0.0},{20.35,0.0},{20.45,0.0},{20.55,0.0},{20.65,0.0},{20.75,0.0},{20.85,0.0},{20.95,0.0},{21.05,0.0},{21.15,0.0},{21.25,0.0},{21.35,0.0},{21.45,0.0},{21.55,0.0},{21.65,0.0},{21.75,0.0},{21.85,0.0},{21.95,0.0},{22.05,0.0},{22.15,0.0},{22.25,0.0},{22.35,0.0},{22.45,0.0},{22.55,0.0},{22.65,0.0},{22.75,0.0},{22.85,0.0},{22.95,0.0},{23.05,0.0},{23.15,0.0},{23.25,0.0},{23.35,0.0},{23.45,0.0},{23.55,0.0},{23.65,0.0},{23.75,0.0},{23.85,0.0},{23.95,0.0},{24.05,0.0},{24.15,0.0},{24.25,0.0},{24.35,0.0},{24.45,0.0},{24.55,0.0},{24.65,0.0},{24.75,0.0},{24.85,0.0},{24.95,0.0},{25.05,0.0},{25.15,0.0},{25.25,0.0},{25.35,0.0},{25.45,0.0},{25.55,0.0},{25.65,0.0},{25.75,0.0},{25.85,0.0},{25.95,0.0},{26.05,0.0},{26.15,0.0},{26.25,0.0},{26.35,0.0},{26.45,0.0},{26.55,0.0},{26.65,0.0},{26.75,0.0},{26.85,0.0},{26.95,0.0},{27.05,0.0},{27.15,0.0},{27.25,0.0},{27.35,0.0},{27.45,0.0},{27.55,0.0},{27.65,0.0},{27.75,0.0},{27.85,0.0},{27.95,0.0},{28.05,0.0},{28.15,0.0},{28.25,0.0},{28.35,0.0},{28.45,0.0},{28.55,0.0},{28.65,0.0},{28.75,0.0},{28.85,0.0},{28.95,0.0},{29.05,0.0},{29.15,0.0},{29.25,0.0},{29.35,0.0},{29.45,0.0},{29.55,0.0},{29.65,0.0},{29.75,0.0},{29.85,0.0},{29.95,0.0}};
-vector<map<double,double>>AnalyzerAllSteps::v_mapPU{mapPU0,mapPU1,mapPU2,mapPU3,mapPU4,mapPU5,mapPU6,mapPU7,mapPU8,mapPU9,mapPU10,mapPU11,mapPU12,mapPU13,mapPU14,mapPU15,mapPU16,mapPU17,mapPU18,mapPU19,mapPU20,mapPU21,mapPU22,mapPU23,mapPU24,mapPU25,mapPU26,mapPU27,mapPU28,mapPU29,mapPU30,mapPU31,mapPU32,mapPU33,mapPU34,mapPU35,mapPU36,mapPU37,mapPU38,mapPU39,mapPU40,mapPU41,mapPU42,mapPU43,mapPU44,mapPU45,mapPU46,mapPU47,mapPU48,mapPU49,mapPU50,mapPU51,mapPU52,mapPU53,mapPU54,mapPU55,mapPU56,mapPU57,mapPU58,mapPU59};
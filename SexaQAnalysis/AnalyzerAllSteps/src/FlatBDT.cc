@@ -0,0 +1,57 @@
+#include "../interface/FlatBDT.h"
+
+#include "FWCore/Utilities/interface/Exception.h"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+namespace {
+   const char payloadMagic[8] = {'S','E','X','A','Q','B','D','\0'};
+
+   template<class T> void readArray(std::ifstream& file, std::vector<T>& values, std::size_t n){
+	values.resize(n);
+	file.read(reinterpret_cast<char*>(values.data()), n*sizeof(T));
+   }
+}
+
+const unsigned int FlatBDT::payloadVersion;
+
+FlatBDT::FlatBDT(const std::string& fileName):
+  nTrees_(0),
+  depth_(0),
+  nInternal_(0),
+  nLeaves_(0)
+{
+	std::ifstream file(fileName, std::ios::binary);
+	if(!file) throw cms::Exception("FlatBDT") << "cannot open BDT payload " << fileName;
+
+	char magic[sizeof(payloadMagic)];
+	uint32_t header[4];
+	file.read(magic, sizeof(magic));
+	file.read(reinterpret_cast<char*>(header), sizeof(header));
+	if(!file || std::memcmp(magic, payloadMagic, sizeof(payloadMagic)) != 0) throw cms::Exception("FlatBDT") << fileName << " is not a BDT payload";
+	if(header[0] != payloadVersion) throw cms::Exception("FlatBDT") << fileName << " has payload version " << header[0] << ", expected " << payloadVersion;
+	//the features are stored as unsigned char, the depth is limited to keep the tree sizes sane
+	if(header[1] == 0 || header[2] == 0 || header[2] > 16 || header[3] == 0 || header[3] > 256) throw cms::Exception("FlatBDT") << fileName << " has an invalid forest: " << header[1] << " trees of depth " << header[2] << " with " << header[3] << " variables";
+
+	nTrees_ = header[1];
+	depth_ = header[2];
+	nInternal_ = (1u << depth_) - 1;
+	nLeaves_ = 1u << depth_;
+	for(uint32_t v = 0; v < header[3] && file; ++v){
+		uint32_t length = 0;
+		file.read(reinterpret_cast<char*>(&length), sizeof(length));
+		std::string name(length, '\0');
+		file.read(&name[0], length);
+		variables_.push_back(name);
+	}
+	readArray(file, features_, (std::size_t)nTrees_*nInternal_);
+	readArray(file, thresholds_, (std::size_t)nTrees_*nInternal_);
+	readArray(file, leafValues_, (std::size_t)nTrees_*nLeaves_);
+	if(!file) throw cms::Exception("FlatBDT") << fileName << " is truncated, expected " << nTrees_ << " trees of depth " << depth_;
+
+	for(unsigned char feature : features_){
+		if(feature >= variables_.size()) throw cms::Exception("FlatBDT") << fileName << " uses variable " << (unsigned int)feature << " but has only " << variables_.size() << " variables";
+	}
+}
@@ -1,11 +1,15 @@
 #include "../interface/FlatTreeProducerBDT.h"
+#include "FWCore/Utilities/interface/Exception.h"
 #include <typeinfo>
+#include <map>
 
 FlatTreeProducerBDT::FlatTreeProducerBDT(edm::ParameterSet const& pset):
   m_lookAtAntiS(pset.getUntrackedParameter<bool>("lookAtAntiS")),
   m_runningOnData(pset.getUntrackedParameter<bool>("runningOnData")),
+  m_randomSeed(pset.getUntrackedParameter<unsigned int>("randomSeed")),
   m_bsTag(pset.getParameter<edm::InputTag>("beamspot")),
-  m_offlinePVTag(pset.getParameter<edm::InputTag>("offlinePV")),
+  m_goodPVsTag(pset.getParameter<edm::InputTag>("goodPVs")),
+  m_eventSummaryTag(pset.getParameter<edm::InputTag>("eventSummary")),
   m_genParticlesTag_GEN(pset.getParameter<edm::InputTag>("genCollection_GEN")),
   m_genParticlesTag_SIM_GEANT(pset.getParameter<edm::InputTag>("genCollection_SIM_GEANT")),
   m_generalTracksTag(pset.getParameter<edm::InputTag>("generalTracksCollection")),
@@ -14,13 +18,19 @@ FlatTreeProducerBDT::FlatTreeProducerBDT(edm::ParameterSet const& pset):
   m_V0LTag(pset.getParameter<edm::InputTag>("V0LCollection")),
 
   m_bsToken    (consumes<reco::BeamSpot>(m_bsTag)),
-  m_offlinePVToken    (consumes<vector<reco::Vertex>>(m_offlinePVTag)),
+  m_goodPVsToken    (consumes<GoodPrimaryVertices>(m_goodPVsTag)),
+  m_eventSummaryToken(consumes<EventSummary>(m_eventSummaryTag)),
   m_genParticlesToken_GEN(consumes<vector<reco::GenParticle> >(m_genParticlesTag_GEN)),
   m_genParticlesToken_SIM_GEANT(consumes<vector<reco::GenParticle> >(m_genParticlesTag_SIM_GEANT)),
   m_generalTracksToken(consumes<View<reco::Track> >(m_generalTracksTag)),
   m_sCandsToken(consumes<vector<reco::VertexCompositeCandidate> >(m_sCandsTag)),
   m_V0KsToken(consumes<vector<reco::VertexCompositeCandidate> >(m_V0KsTag)),
-  m_V0LToken(consumes<vector<reco::VertexCompositeCandidate> >(m_V0LTag))
+  m_V0LToken(consumes<vector<reco::VertexCompositeCandidate> >(m_V0LTag)),
+  m_PUReweighingFile(pset.getParameter<edm::FileInPath>("PUReweighingFile")),
+  m_evaluateBDT(pset.getUntrackedParameter<bool>("evaluateBDT")),
+  m_BDTWeightsFile(pset.getParameter<edm::FileInPath>("BDTWeightsFile")),
+  m_minBDTScore(pset.getParameter<double>("minBDTScore")),
+  m_flatTreeLayout(FlatTreeWriter::layout(pset.getUntrackedParameter<std::string>("flatTreeLayout")))
 
 {
 
@@ -32,137 +42,210 @@ void FlatTreeProducerBDT::beginJob() {
         // Initialize when class is created
         edm::Service<TFileService> fs ;
 
+	//PU reweighing parameters
+	m_PUReweighingTable = PUReweighingTable::get(m_PUReweighingFile.fullPath());
+
 	//PV information
-        _tree_PV = fs->make <TTree>("FlatTreePV","tree_PV");
-
-	_tree_PV->Branch("_nPV",&_nPV);
-	_tree_PV->Branch("_nGoodPV",&_nGoodPV);
-	_tree_PV->Branch("_nGoodPVPOG",&_nGoodPVPOG);
-	_tree_PV->Branch("_PVx",&_PVx);
-	_tree_PV->Branch("_PVy",&_PVy);
-	_tree_PV->Branch("_PVz",&_PVz);
-	_tree_PV->Branch("_goodPVx",&_goodPVx);
-	_tree_PV->Branch("_goodPVy",&_goodPVy);
-	_tree_PV->Branch("_goodPVz",&_goodPVz);
-	_tree_PV->Branch("_goodPVxPOG",&_goodPVxPOG);
-	_tree_PV->Branch("_goodPVyPOG",&_goodPVyPOG);
-	_tree_PV->Branch("_goodPVzPOG",&_goodPVzPOG);
+        _tree_PV.open(*fs, "FlatTreePV", "tree_PV");
+	m_eventId.addBranches(_tree_PV);
+
+	_tree_PV.add("_nPV",&_nPV);
+	_tree_PV.add("_nGoodPV",&_nGoodPV);
+	_tree_PV.add("_nGoodPVPOG",&_nGoodPVPOG);
+	_tree_PV.add("_PVx",&_PVx);
+	_tree_PV.add("_PVy",&_PVy);
+	_tree_PV.add("_PVz",&_PVz);
+	_tree_PV.add("_goodPVx",&_goodPVx);
+	_tree_PV.add("_goodPVy",&_goodPVy);
+	_tree_PV.add("_goodPVz",&_goodPVz);
+	_tree_PV.add("_goodPVxPOG",&_goodPVxPOG);
+	_tree_PV.add("_goodPVyPOG",&_goodPVyPOG);
+	_tree_PV.add("_goodPVzPOG",&_goodPVzPOG);
 
 	//Sbar event information to be (potentially) used in the BDT    
-        _tree = fs->make <TTree>("FlatTree","tree");
-
-	_tree->Branch("_S_charge",&_S_charge);
-	_tree->Branch("_S_deltaLInteractionVertexAntiSmin",&_S_deltaLInteractionVertexAntiSmin);
-	_tree->Branch("_S_deltaRAntiSmin",&_S_deltaRAntiSmin);
-	_tree->Branch("_S_deltaRKsAntiSmin",&_S_deltaRKsAntiSmin);
-	_tree->Branch("_S_deltaRLambdaAntiSmin",&_S_deltaRLambdaAntiSmin);
-
-	_tree->Branch("_S_lxy_interaction_vertex",&_S_lxy_interaction_vertex);
-	_tree->Branch("_S_lxy_interaction_vertex_beampipeCenter",&_S_lxy_interaction_vertex_beampipeCenter);
-	_tree->Branch("_S_error_lxy_interaction_vertex",&_S_error_lxy_interaction_vertex);
-	_tree->Branch("_S_error_lxy_interaction_vertex_beampipeCenter",&_S_error_lxy_interaction_vertex_beampipeCenter);
-	_tree->Branch("_Ks_lxy_decay_vertex",&_Ks_lxy_decay_vertex);
-	_tree->Branch("_Lambda_lxy_decay_vertex",&_Lambda_lxy_decay_vertex);
-	_tree->Branch("_S_mass",&_S_mass);
-	_tree->Branch("_S_chi2_ndof",&_S_chi2_ndof);
-	_tree->Branch("_S_event_weighting_factor",&_S_event_weighting_factor);
-	_tree->Branch("_S_event_weighting_factorPU",&_S_event_weighting_factorPU);
-	_tree->Branch("_S_event_weighting_factorALL",&_S_event_weighting_factorALL);
-
-	_tree->Branch("_S_daughters_deltaphi",&_S_daughters_deltaphi);
-	_tree->Branch("_S_daughters_deltaeta",&_S_daughters_deltaeta);
-	_tree->Branch("_S_daughters_openingsangle",&_S_daughters_openingsangle);
-	_tree->Branch("_S_Ks_openingsangle",&_S_Ks_openingsangle);
-	_tree->Branch("_S_Lambda_openingsangle",&_S_Lambda_openingsangle);
-	_tree->Branch("_S_daughters_DeltaR",&_S_daughters_DeltaR);
-	_tree->Branch("_S_eta",&_S_eta);
-	_tree->Branch("_Ks_eta",&_Ks_eta);
-	_tree->Branch("_Lambda_eta",&_Lambda_eta);
-
-	_tree->Branch("_S_dxy",&_S_dxy);
-	_tree->Branch("_Ks_dxy",&_Ks_dxy);
-	_tree->Branch("_Lambda_dxy",&_Lambda_dxy);
-	_tree->Branch("_S_dxy_dzPVmin",&_S_dxy_dzPVmin);
-	_tree->Branch("_Ks_dxy_dzPVmin",&_Ks_dxy_dzPVmin);
-	_tree->Branch("_Lambda_dxy_dzPVmin",&_Lambda_dxy_dzPVmin);
-
-	_tree->Branch("_S_dxy_over_lxy",&_S_dxy_over_lxy);
-	_tree->Branch("_Ks_dxy_over_lxy",&_Ks_dxy_over_lxy);
-	_tree->Branch("_Lambda_dxy_over_lxy",&_Lambda_dxy_over_lxy);
-
-	_tree->Branch("_S_dz",&_S_dz);
-	_tree->Branch("_Ks_dz",&_Ks_dz);
-	_tree->Branch("_Lambda_dz",&_Lambda_dz);
-	_tree->Branch("_S_dz_min",&_S_dz_min);
-	_tree->Branch("_Ks_dz_min",&_Ks_dz_min);
-	_tree->Branch("_Lambda_dz_min",&_Lambda_dz_min);
-
-	_tree->Branch("_S_pt",&_S_pt);
-	_tree->Branch("_Ks_pt",&_Ks_pt);
-	_tree->Branch("_Lambda_pt",&_Lambda_pt);
-
-	_tree->Branch("_S_pz",&_S_pz);
-	_tree->Branch("_Ks_pz",&_Ks_pz);
-	_tree->Branch("_Lambda_pz",&_Lambda_pz);
-
-	_tree->Branch("_S_vz_interaction_vertex",&_S_vz_interaction_vertex);
-	_tree->Branch("_Ks_vz_decay_vertex",&_Ks_vz_decay_vertex);
-	_tree->Branch("_Lambda_vz_decay_vertex",&_Lambda_vz_decay_vertex);
-
-	_tree->Branch("_S_vx",&_S_vx);
-	_tree->Branch("_S_vy",&_S_vy);
-	_tree->Branch("_S_vz",&_S_vz);
-
-	_tree->Branch("_Lambda_mass",&_Lambda_mass);
-	_tree->Branch("_Ks_mass",&_Ks_mass);
-
-	_tree->Branch("_RECO_Lambda_daughter0_charge",&_RECO_Lambda_daughter0_charge);
-	_tree->Branch("_RECO_Lambda_daughter0_pt",&_RECO_Lambda_daughter0_pt);
-	_tree->Branch("_RECO_Lambda_daughter0_pz",&_RECO_Lambda_daughter0_pz);
-	_tree->Branch("_RECO_Lambda_daughter0_dxy_beamspot",&_RECO_Lambda_daughter0_dxy_beamspot);
-	_tree->Branch("_RECO_Lambda_daughter0_dz_beamspot",&_RECO_Lambda_daughter0_dz_beamspot);
-
-	_tree->Branch("_RECO_Lambda_daughter1_charge",&_RECO_Lambda_daughter1_charge);
-	_tree->Branch("_RECO_Lambda_daughter1_pt",&_RECO_Lambda_daughter1_pt);
-	_tree->Branch("_RECO_Lambda_daughter1_pz",&_RECO_Lambda_daughter1_pz);
-	_tree->Branch("_RECO_Lambda_daughter1_dxy_beamspot",&_RECO_Lambda_daughter1_dxy_beamspot);
-	_tree->Branch("_RECO_Lambda_daughter1_dz_beamspot",&_RECO_Lambda_daughter1_dz_beamspot);
+        _tree.open(*fs, "FlatTree", "tree", m_flatTreeLayout);
+	m_eventId.addBranches(_tree);
+	m_eventSummary.addBranches(_tree);
+
+	_tree.add("_S_index",&_S_index);
+	_tree.add("_S_charge",&_S_charge);
+	_tree.add("_S_deltaLInteractionVertexAntiSmin",&_S_deltaLInteractionVertexAntiSmin);
+	_tree.add("_S_deltaRAntiSmin",&_S_deltaRAntiSmin);
+	_tree.add("_S_deltaRKsAntiSmin",&_S_deltaRKsAntiSmin);
+	_tree.add("_S_deltaRLambdaAntiSmin",&_S_deltaRLambdaAntiSmin);
+
+	_tree.add("_S_lxy_interaction_vertex",&_S_lxy_interaction_vertex);
+	_tree.add("_S_lxy_interaction_vertex_beampipeCenter",&_S_lxy_interaction_vertex_beampipeCenter);
+	_tree.add("_S_error_lxy_interaction_vertex",&_S_error_lxy_interaction_vertex);
+	_tree.add("_S_error_lxy_interaction_vertex_beampipeCenter",&_S_error_lxy_interaction_vertex_beampipeCenter);
+	_tree.add("_Ks_lxy_decay_vertex",&_Ks_lxy_decay_vertex);
+	_tree.add("_Lambda_lxy_decay_vertex",&_Lambda_lxy_decay_vertex);
+	_tree.add("_S_mass",&_S_mass);
+	_tree.add("_S_chi2_ndof",&_S_chi2_ndof);
+	_tree.add("_S_event_weighting_factor",&_S_event_weighting_factor);
+	_tree.add("_S_event_weighting_factorPU",&_S_event_weighting_factorPU);
+	_tree.add("_S_event_weighting_factorALL",&_S_event_weighting_factorALL);
+
+	_tree.add("_S_daughters_deltaphi",&_S_daughters_deltaphi);
+	_tree.add("_S_daughters_deltaeta",&_S_daughters_deltaeta);
+	_tree.add("_S_daughters_openingsangle",&_S_daughters_openingsangle);
+	_tree.add("_S_Ks_openingsangle",&_S_Ks_openingsangle);
+	_tree.add("_S_Lambda_openingsangle",&_S_Lambda_openingsangle);
+	_tree.add("_S_daughters_DeltaR",&_S_daughters_DeltaR);
+	_tree.add("_S_eta",&_S_eta);
+	_tree.add("_Ks_eta",&_Ks_eta);
+	_tree.add("_Lambda_eta",&_Lambda_eta);
+
+	_tree.add("_S_dxy",&_S_dxy);
+	_tree.add("_Ks_dxy",&_Ks_dxy);
+	_tree.add("_Lambda_dxy",&_Lambda_dxy);
+	_tree.add("_S_dxy_dzPVmin",&_S_dxy_dzPVmin);
+	_tree.add("_Ks_dxy_dzPVmin",&_Ks_dxy_dzPVmin);
+	_tree.add("_Lambda_dxy_dzPVmin",&_Lambda_dxy_dzPVmin);
+
+	_tree.add("_S_dxy_over_lxy",&_S_dxy_over_lxy);
+	_tree.add("_Ks_dxy_over_lxy",&_Ks_dxy_over_lxy);
+	_tree.add("_Lambda_dxy_over_lxy",&_Lambda_dxy_over_lxy);
+
+	_tree.add("_S_dz",&_S_dz);
+	_tree.add("_Ks_dz",&_Ks_dz);
+	_tree.add("_Lambda_dz",&_Lambda_dz);
+	_tree.add("_S_dz_min",&_S_dz_min);
+	_tree.add("_Ks_dz_min",&_Ks_dz_min);
+	_tree.add("_Lambda_dz_min",&_Lambda_dz_min);
+
+	_tree.add("_S_pt",&_S_pt);
+	_tree.add("_Ks_pt",&_Ks_pt);
+	_tree.add("_Lambda_pt",&_Lambda_pt);
+
+	_tree.add("_S_pz",&_S_pz);
+	_tree.add("_Ks_pz",&_Ks_pz);
+	_tree.add("_Lambda_pz",&_Lambda_pz);
+
+	_tree.add("_S_vz_interaction_vertex",&_S_vz_interaction_vertex);
+	_tree.add("_Ks_vz_decay_vertex",&_Ks_vz_decay_vertex);
+	_tree.add("_Lambda_vz_decay_vertex",&_Lambda_vz_decay_vertex);
+
+	_tree.add("_S_vx",&_S_vx);
+	_tree.add("_S_vy",&_S_vy);
+	_tree.add("_S_vz",&_S_vz);
+
+	_tree.add("_Lambda_mass",&_Lambda_mass);
+	_tree.add("_Ks_mass",&_Ks_mass);
+	_tree.add("_S_BDT",&_S_BDT);
+
+	_tree.add("_RECO_Lambda_daughter0_charge",&_RECO_Lambda_daughter0_charge);
+	_tree.add("_RECO_Lambda_daughter0_pt",&_RECO_Lambda_daughter0_pt);
+	_tree.add("_RECO_Lambda_daughter0_pz",&_RECO_Lambda_daughter0_pz);
+	_tree.add("_RECO_Lambda_daughter0_dxy_beamspot",&_RECO_Lambda_daughter0_dxy_beamspot);
+	_tree.add("_RECO_Lambda_daughter0_dz_beamspot",&_RECO_Lambda_daughter0_dz_beamspot);
+
+	_tree.add("_RECO_Lambda_daughter1_charge",&_RECO_Lambda_daughter1_charge);
+	_tree.add("_RECO_Lambda_daughter1_pt",&_RECO_Lambda_daughter1_pt);
+	_tree.add("_RECO_Lambda_daughter1_pz",&_RECO_Lambda_daughter1_pz);
+	_tree.add("_RECO_Lambda_daughter1_dxy_beamspot",&_RECO_Lambda_daughter1_dxy_beamspot);
+	_tree.add("_RECO_Lambda_daughter1_dz_beamspot",&_RECO_Lambda_daughter1_dz_beamspot);
 
 	
-	_tree->Branch("_RECO_Ks_daughter0_charge",&_RECO_Ks_daughter0_charge);
-	_tree->Branch("_RECO_Ks_daughter0_pt",&_RECO_Ks_daughter0_pt);
-	_tree->Branch("_RECO_Ks_daughter0_pz",&_RECO_Ks_daughter0_pz);
-	_tree->Branch("_RECO_Ks_daughter0_dxy_beamspot",&_RECO_Ks_daughter0_dxy_beamspot);
-	_tree->Branch("_RECO_Ks_daughter0_dz_beamspot",&_RECO_Ks_daughter0_dz_beamspot);
-
-	_tree->Branch("_RECO_Ks_daughter1_charge",&_RECO_Ks_daughter1_charge);
-	_tree->Branch("_RECO_Ks_daughter1_pt",&_RECO_Ks_daughter1_pt);
-	_tree->Branch("_RECO_Ks_daughter1_pz",&_RECO_Ks_daughter1_pz);
-	_tree->Branch("_RECO_Ks_daughter1_dxy_beamspot",&_RECO_Ks_daughter1_dxy_beamspot);
-	_tree->Branch("_RECO_Ks_daughter1_dz_beamspot",&_RECO_Ks_daughter1_dz_beamspot);
+	_tree.add("_RECO_Ks_daughter0_charge",&_RECO_Ks_daughter0_charge);
+	_tree.add("_RECO_Ks_daughter0_pt",&_RECO_Ks_daughter0_pt);
+	_tree.add("_RECO_Ks_daughter0_pz",&_RECO_Ks_daughter0_pz);
+	_tree.add("_RECO_Ks_daughter0_dxy_beamspot",&_RECO_Ks_daughter0_dxy_beamspot);
+	_tree.add("_RECO_Ks_daughter0_dz_beamspot",&_RECO_Ks_daughter0_dz_beamspot);
+
+	_tree.add("_RECO_Ks_daughter1_charge",&_RECO_Ks_daughter1_charge);
+	_tree.add("_RECO_Ks_daughter1_pt",&_RECO_Ks_daughter1_pt);
+	_tree.add("_RECO_Ks_daughter1_pz",&_RECO_Ks_daughter1_pz);
+	_tree.add("_RECO_Ks_daughter1_dxy_beamspot",&_RECO_Ks_daughter1_dxy_beamspot);
+	_tree.add("_RECO_Ks_daughter1_dz_beamspot",&_RECO_Ks_daughter1_dz_beamspot);
 
 	//to keep the ntuples small I do not save the S or Sbar candidates which have an lxy of the interaction vertex below AnalyzerAllSteps::MinLxyCut, these are for sure not signal, because there is no material there 
-        _tree_counter = fs->make <TTree>("FlatTreeCounter","tree_counter");
-	_tree_counter->Branch("_RECO_S_total_lxy_beampipeCenter",&_RECO_S_total_lxy_beampipeCenter);
-	_tree_counter->Branch("_RECO_S_saved_lxy_beampipeCenter",&_RECO_S_saved_lxy_beampipeCenter);
+        _tree_counter.open(*fs, "FlatTreeCounter", "tree_counter");
+	m_eventId.addBranches(_tree_counter);
+	_tree_counter.add("_RECO_S_total_lxy_beampipeCenter",&_RECO_S_total_lxy_beampipeCenter);
+	_tree_counter.add("_RECO_S_saved_lxy_beampipeCenter",&_RECO_S_saved_lxy_beampipeCenter);
+
+	//BDT: connect each input variable of the BDT to the branch with the same name
+	if(m_evaluateBDT){
+		m_BDT.reset(new FlatBDT(m_BDTWeightsFile.fullPath()));
+		std::map<std::string, const std::vector<float>*> BDTInputBranches;
+		BDTInputBranches["_S_lxy_interaction_vertex"] = &_S_lxy_interaction_vertex;
+		BDTInputBranches["_S_lxy_interaction_vertex_beampipeCenter"] = &_S_lxy_interaction_vertex_beampipeCenter;
+		BDTInputBranches["_S_error_lxy_interaction_vertex"] = &_S_error_lxy_interaction_vertex;
+		BDTInputBranches["_S_error_lxy_interaction_vertex_beampipeCenter"] = &_S_error_lxy_interaction_vertex_beampipeCenter;
+		BDTInputBranches["_Ks_lxy_decay_vertex"] = &_Ks_lxy_decay_vertex;
+		BDTInputBranches["_Lambda_lxy_decay_vertex"] = &_Lambda_lxy_decay_vertex;
+		BDTInputBranches["_S_mass"] = &_S_mass;
+		BDTInputBranches["_S_chi2_ndof"] = &_S_chi2_ndof;
+		BDTInputBranches["_S_daughters_deltaphi"] = &_S_daughters_deltaphi;
+		BDTInputBranches["_S_daughters_deltaeta"] = &_S_daughters_deltaeta;
+		BDTInputBranches["_S_daughters_openingsangle"] = &_S_daughters_openingsangle;
+		BDTInputBranches["_S_Ks_openingsangle"] = &_S_Ks_openingsangle;
+		BDTInputBranches["_S_Lambda_openingsangle"] = &_S_Lambda_openingsangle;
+		BDTInputBranches["_S_daughters_DeltaR"] = &_S_daughters_DeltaR;
+		BDTInputBranches["_S_eta"] = &_S_eta;
+		BDTInputBranches["_Ks_eta"] = &_Ks_eta;
+		BDTInputBranches["_Lambda_eta"] = &_Lambda_eta;
+		BDTInputBranches["_S_dxy"] = &_S_dxy;
+		BDTInputBranches["_Ks_dxy"] = &_Ks_dxy;
+		BDTInputBranches["_Lambda_dxy"] = &_Lambda_dxy;
+		BDTInputBranches["_S_dxy_dzPVmin"] = &_S_dxy_dzPVmin;
+		BDTInputBranches["_Ks_dxy_dzPVmin"] = &_Ks_dxy_dzPVmin;
+		BDTInputBranches["_Lambda_dxy_dzPVmin"] = &_Lambda_dxy_dzPVmin;
+		BDTInputBranches["_S_dxy_over_lxy"] = &_S_dxy_over_lxy;
+		BDTInputBranches["_Ks_dxy_over_lxy"] = &_Ks_dxy_over_lxy;
+		BDTInputBranches["_Lambda_dxy_over_lxy"] = &_Lambda_dxy_over_lxy;
+		BDTInputBranches["_S_dz"] = &_S_dz;
+		BDTInputBranches["_Ks_dz"] = &_Ks_dz;
+		BDTInputBranches["_Lambda_dz"] = &_Lambda_dz;
+		BDTInputBranches["_S_dz_min"] = &_S_dz_min;
+		BDTInputBranches["_Ks_dz_min"] = &_Ks_dz_min;
+		BDTInputBranches["_Lambda_dz_min"] = &_Lambda_dz_min;
+		BDTInputBranches["_S_pt"] = &_S_pt;
+		BDTInputBranches["_Ks_pt"] = &_Ks_pt;
+		BDTInputBranches["_Lambda_pt"] = &_Lambda_pt;
+		BDTInputBranches["_S_pz"] = &_S_pz;
+		BDTInputBranches["_Ks_pz"] = &_Ks_pz;
+		BDTInputBranches["_Lambda_pz"] = &_Lambda_pz;
+		BDTInputBranches["_S_vz_interaction_vertex"] = &_S_vz_interaction_vertex;
+		BDTInputBranches["_Ks_vz_decay_vertex"] = &_Ks_vz_decay_vertex;
+		BDTInputBranches["_Lambda_vz_decay_vertex"] = &_Lambda_vz_decay_vertex;
+		BDTInputBranches["_S_vx"] = &_S_vx;
+		BDTInputBranches["_S_vy"] = &_S_vy;
+		BDTInputBranches["_S_vz"] = &_S_vz;
+		BDTInputBranches["_Lambda_mass"] = &_Lambda_mass;
+		BDTInputBranches["_Ks_mass"] = &_Ks_mass;
+		m_BDTInputs.clear();
+		for(const std::string& variable : m_BDT->variables()){
+			auto it = BDTInputBranches.find(variable);
+			if(it == BDTInputBranches.end()) throw cms::Exception("FlatTreeProducerBDT") << "BDT input variable " << variable << " from " << m_BDTWeightsFile.fullPath() << " is not a branch of the FlatTree";
+			m_BDTInputs.push_back(it->second);
+		}
+		m_BDTFeatures.resize(m_BDTInputs.size());
+	}
 
 
 }
 
 void FlatTreeProducerBDT::analyze(edm::Event const& iEvent, edm::EventSetup const& iSetup) {
 
+  m_eventId.set(iEvent);
+  m_eventSummary.set(iEvent, m_eventSummaryToken);
+
 
   //beamspot
   edm::Handle<reco::BeamSpot> h_bs;
   iEvent.getByToken(m_bsToken, h_bs);
 
-  //primary vertex
-  edm::Handle<vector<reco::Vertex>> h_offlinePV;
-  iEvent.getByToken(m_offlinePVToken, h_offlinePV);
+  //primary vertices, selected by the GoodPVProducer
+  edm::Handle<GoodPrimaryVertices> h_goodPVs;
+  iEvent.getByToken(m_goodPVsToken, h_goodPVs);
 
   //SIM particles: normal Gen particles or PlusGEANT
   edm::Handle<vector<reco::GenParticle>> h_genParticles;
   iEvent.getByToken(m_genParticlesToken_SIM_GEANT, h_genParticles);
+  if(h_genParticles.isValid()) m_genAntiS.build(*h_genParticles);
+  else m_genAntiS.clear();
 
   //General tracks particles
   //edm::Handle<vector<reco::Track>> h_generalTracks;
@@ -187,46 +270,44 @@ void FlatTreeProducerBDT::analyze(edm::Event const& iEvent, edm::EventSetup cons
   int ngoodPVs = 0;
   unsigned int ngoodPVsPOG = 0;
   Init_PV();
-  if(h_offlinePV.isValid()){
-	for(unsigned int i = 0; i < h_offlinePV->size(); i++ ){
-		if(h_offlinePV->at(i).isValid()){//all PV
-			nPVs++;
-			_PVx.push_back(h_offlinePV->at(i).x());
-			_PVy.push_back(h_offlinePV->at(i).y());
-			_PVz.push_back(h_offlinePV->at(i).z());
-		}
-		if(h_offlinePV->at(i).isValid() && h_offlinePV->at(i).tracksSize() >= 4){//valid PV definition by Pascal
-			ngoodPVs++;
-			_goodPVx.push_back(h_offlinePV->at(i).x());
-			_goodPVy.push_back(h_offlinePV->at(i).y());
-			_goodPVz.push_back(h_offlinePV->at(i).z());
-		}
-
-                double r = sqrt(h_offlinePV->at(i).x()*h_offlinePV->at(i).x()+h_offlinePV->at(i).y()*h_offlinePV->at(i).y());
-                if(h_offlinePV->at(i).ndof() > 4 && abs(h_offlinePV->at(i).z()) < 24 && r < 2){//valid PV definition from POG (https://twiki.cern.ch/twiki/bin/view/CMSPublic/TrackingPOGPerformance2017MC#Vertex_Reconstruction_Performanc)
-			ngoodPVsPOG++;
-                        _goodPVxPOG.push_back(h_offlinePV->at(i).x());
-                        _goodPVyPOG.push_back(h_offlinePV->at(i).y());
-                        _goodPVzPOG.push_back(h_offlinePV->at(i).z());
-		}
-	}
+  if(h_goodPVs.isValid()){
+	const GoodPrimaryVertices& goodPVs = *h_goodPVs;
+	nPVs = goodPVs.nPV();
+	_PVx.assign(goodPVs.all.x.begin(), goodPVs.all.x.end());
+	_PVy.assign(goodPVs.all.y.begin(), goodPVs.all.y.end());
+	_PVz.assign(goodPVs.all.z.begin(), goodPVs.all.z.end());
+	//valid PV definition by Pascal
+	ngoodPVs = goodPVs.nGoodPV();
+	_goodPVx.assign(goodPVs.good.x.begin(), goodPVs.good.x.end());
+	_goodPVy.assign(goodPVs.good.y.begin(), goodPVs.good.y.end());
+	_goodPVz.assign(goodPVs.good.z.begin(), goodPVs.good.z.end());
+	//valid PV definition from POG
+	ngoodPVsPOG = goodPVs.nGoodPVPOG();
+	_goodPVxPOG.assign(goodPVs.goodPOG.x.begin(), goodPVs.goodPOG.x.end());
+	_goodPVyPOG.assign(goodPVs.goodPOG.y.begin(), goodPVs.goodPOG.y.end());
+	_goodPVzPOG.assign(goodPVs.goodPOG.z.begin(), goodPVs.goodPOG.z.end());
   }
 
-  //for background use a random PV to do the reweighing
-  int randomIndexPV = rand()%(ngoodPVsPOG);
-  double randomPVz = _goodPVzPOG[randomIndexPV];
+  //for background use a random PV to do the reweighing. Without a POG good PV the weight is 0 anyway (it is multiplied by ngoodPVsPOG)
+  double randomPVz = 0.;
+  if(ngoodPVsPOG > 0) randomPVz = _goodPVzPOG[randomIndex(iEvent, ngoodPVsPOG)];
 
   _nPV.push_back(nPVs);
   _nGoodPV.push_back(ngoodPVs);
   _nGoodPVPOG.push_back(ngoodPVsPOG);
-  //_tree_PV->Fill();
+  //_tree_PV.fill();
+  //for the scalar layout the PV tree is the event-level tree, FlatTree points to its entries with _eventIndex
+  if(m_flatTreeLayout == FlatTreeWriter::scalarLayout){
+	m_eventIndex = _tree_PV.entries();
+	_tree_PV.fill();
+  }
 
   //beamspot
-  TVector3 beamspot(999999,999999,999999);
-  TVector3 beamspotVariance(999999,999999,999999);
+  sexaq::Vec3 beamspot(999999,999999,999999);
+  sexaq::Vec3 beamspotVariance(999999,999999,999999);
   if(h_bs.isValid()){  
-	beamspot.SetXYZ(h_bs->x0(),h_bs->y0(),h_bs->z0());
-	beamspotVariance.SetXYZ(pow(h_bs->x0Error(),2),pow(h_bs->y0Error(),2),pow(h_bs->z0Error(),2));			
+	beamspot = sexaq::Vec3(h_bs->x0(),h_bs->y0(),h_bs->z0());
+	beamspotVariance = sexaq::Vec3(pow(h_bs->x0Error(),2),pow(h_bs->y0Error(),2),pow(h_bs->z0Error(),2));			
   }
 
   
@@ -234,7 +315,7 @@ void FlatTreeProducerBDT::analyze(edm::Event const& iEvent, edm::EventSetup cons
   if(h_sCands.isValid()){
       for(unsigned int i = 0; i < h_sCands->size(); ++i){//loop all S candidates
 	const reco::VertexCompositeCandidate * antiS = &h_sCands->at(i);
-	FillBranches(antiS, beamspot, beamspotVariance, h_offlinePV,m_runningOnData,  h_genParticles, h_V0Ks,  h_V0L, ngoodPVsPOG, randomPVz);
+	FillBranches(antiS, i, beamspot, beamspotVariance, h_goodPVs,m_runningOnData,  h_genParticles, h_V0Ks,  h_V0L, ngoodPVsPOG, randomPVz);
       }
   }
   else std::cout << "!!!!!!!!!!!!!h_sCands not valid!!!!!!!!!!!!!!!!!!!!!!!" << std::endl; 
@@ -243,22 +324,22 @@ void FlatTreeProducerBDT::analyze(edm::Event const& iEvent, edm::EventSetup cons
  } //end of analyzer
 
 //fill the ntuple branches
-void FlatTreeProducerBDT::FillBranches(const reco::VertexCompositeCandidate * RECO_S, TVector3 beamspot, TVector3 beamspotVariance, edm::Handle<vector<reco::Vertex>> h_offlinePV, bool m_runningOnData, edm::Handle<vector<reco::GenParticle>> h_genParticles, edm::Handle<vector<reco::VertexCompositeCandidate> > h_V0Ks, edm::Handle<vector<reco::VertexCompositeCandidate> > h_V0L, unsigned int ngoodPVsPOG, double randomPVz){
+void FlatTreeProducerBDT::FillBranches(const reco::VertexCompositeCandidate * RECO_S, unsigned int SIndex, const sexaq::Vec3& beamspot, const sexaq::Vec3& beamspotVariance, edm::Handle<GoodPrimaryVertices> h_goodPVs, bool m_runningOnData, edm::Handle<vector<reco::GenParticle>> h_genParticles, edm::Handle<vector<reco::VertexCompositeCandidate> > h_V0Ks, edm::Handle<vector<reco::VertexCompositeCandidate> > h_V0L, unsigned int ngoodPVsPOG, double randomPVz){
 
 	//below calculate some kinematic variables on the event and then fill them in the branches	
 
 	//this is the interaction vertex of the antiS and the neutron. (Check in the skimming code if you want to check)
-	TVector3 RECOAntiSInteractionVertex(RECO_S->vx(),RECO_S->vy(),RECO_S->vz());
-	double RECOLxy_interactionVertex_beampipeCenter = sqrt(RECOAntiSInteractionVertex.X()*RECOAntiSInteractionVertex.X() + RECOAntiSInteractionVertex.Y()*RECOAntiSInteractionVertex.Y() );
+	sexaq::Vec3 RECOAntiSInteractionVertex(RECO_S->vx(),RECO_S->vy(),RECO_S->vz());
+	double RECOLxy_interactionVertex_beampipeCenter = sqrt(RECOAntiSInteractionVertex.x*RECOAntiSInteractionVertex.x + RECOAntiSInteractionVertex.y*RECOAntiSInteractionVertex.y );
 	//indeed, if you are running on MC then the above calculation, which is with respect to (0,0,0) is correct 
 	//for RECOLxy_interactionVertex_beampipeCenter, but if you run on data then you should actually calculate wrt 
 	//the center of the beampipe, which is offsset wrt (0,0,0)
-	if(m_runningOnData) RECOLxy_interactionVertex_beampipeCenter = sqrt( pow(RECOAntiSInteractionVertex.X()-AnalyzerAllSteps::center_beampipe_x , 2) + pow(RECOAntiSInteractionVertex.Y()-AnalyzerAllSteps::center_beampipe_y, 2) ) ;
+	if(m_runningOnData) RECOLxy_interactionVertex_beampipeCenter = sqrt( pow(RECOAntiSInteractionVertex.x-AnalyzerAllSteps::center_beampipe_x , 2) + pow(RECOAntiSInteractionVertex.y-AnalyzerAllSteps::center_beampipe_y, 2) ) ;
 	//error on RECOLxy_interactionVertex_beampipeCenter
-	double RECOLxy_interactionVertex_beampipeCenter_error = 1/RECOLxy_interactionVertex_beampipeCenter*sqrt( pow(RECOAntiSInteractionVertex.X(),2)*pow(RECO_S->vertexCovariance(0,0),2 ) + pow(RECOAntiSInteractionVertex.Y(),2)*pow(RECO_S->vertexCovariance(1,1),2 ) );
+	double RECOLxy_interactionVertex_beampipeCenter_error = 1/RECOLxy_interactionVertex_beampipeCenter*sqrt( pow(RECOAntiSInteractionVertex.x,2)*pow(RECO_S->vertexCovariance(0,0),2 ) + pow(RECOAntiSInteractionVertex.y,2)*pow(RECO_S->vertexCovariance(1,1),2 ) );
 
 	//lxy interaction vertex wrt to the beamspot instead of the bpc
-	double RECOLxy_interactionVertex = AnalyzerAllSteps::lxy(beamspot,RECOAntiSInteractionVertex);
+	double RECOLxy_interactionVertex = sexaq::lxy(beamspot,RECOAntiSInteractionVertex);
 
 	//if running on MC and the RECO_S charge is negative and the RECO_S has an interaction vertex which is far enough in lxy, check if this is a real AntiS 
 	//by looking at the difference in lxyz between the RECO and the GEN antiS. Save this deltaLInteractionVertexAntiSmin in the tree, like this later I can 
@@ -267,32 +348,21 @@ void FlatTreeProducerBDT::FillBranches(const reco::VertexCompositeCandidate * RE
         double deltaRAntiSmin = 999.;
 	int bestMatchingAntiS = -1;
 	if(!m_runningOnData && RECO_S->charge() == -1  && RECOLxy_interactionVertex >= AnalyzerAllSteps::MinLxyCut){
-		if(h_genParticles.isValid()){
-			//loop all genparticlesPlusGEANT and only for the ones with the correct pdgId check 
-			//if this RECO antiS is matching a GEN particle and is thus not a fake antiS
-			for(unsigned int i = 0; i < h_genParticles->size(); ++i){
-				if(h_genParticles->at(i).pdgId() != AnalyzerAllSteps::pdgIdAntiS) continue;
-				if(h_genParticles->at(i).numberOfDaughters() != 2) continue;
-				//have to use the vertex of the daughter Ks (at GEN level) as the interaction vertex of the AntiS 
-				//and compare it to the vertex of the RECO antiS which is the annihilation vertex
-				double deltaLInteractionVertexAntiS = sqrt( pow(h_genParticles->at(i).daughter(0)->vx() - RECO_S->vx(),2) + pow(h_genParticles->at(i).daughter(0)->vy() - RECO_S->vy(),2) +  pow(h_genParticles->at(i).daughter(0)->vz() - RECO_S->vz(),2)  );
-				if(deltaLInteractionVertexAntiS < deltaLInteractionVertexAntiSmin){
-					deltaLInteractionVertexAntiSmin = deltaLInteractionVertexAntiS;
-					deltaRAntiSmin = AnalyzerAllSteps::deltaR(h_genParticles->at(i).phi(), h_genParticles->at(i).eta(),RECO_S->phi(),RECO_S->eta());
-					bestMatchingAntiS = i;
-				}
-		       }
-		}
+		//check with the GEN antiS of this event (indexed in analyze) if this RECO antiS is matching a GEN particle and is thus not a fake antiS.
+		//have to use the vertex of the daughter Ks (at GEN level) as the interaction vertex of the AntiS 
+		//and compare it to the vertex of the RECO antiS which is the annihilation vertex
+		bestMatchingAntiS = m_genAntiS.nearestVertex(RECO_S->vx(), RECO_S->vy(), RECO_S->vz(), deltaLInteractionVertexAntiSmin);
+		if(bestMatchingAntiS > -1) deltaRAntiSmin = AnalyzerAllSteps::deltaR(h_genParticles->at(bestMatchingAntiS).phi(), h_genParticles->at(bestMatchingAntiS).eta(),RECO_S->phi(),RECO_S->eta());
 	}
 	//the weighting factor for events will depend on their pathlength through the beampipe
 	double event_weighting_factor = AnalyzerAllSteps::EventWeightingFactor(RECO_S->theta()); 
 	double event_weighting_factorPU = 1.; 
 	//you only need to calculate a reweighing parameter for the PU and z location if you are running on MC
-        if(ngoodPVsPOG < AnalyzerAllSteps::v_mapPU.size() && bestMatchingAntiS > -1) {
-		event_weighting_factorPU = AnalyzerAllSteps::PUReweighingFactor(AnalyzerAllSteps::v_mapPU[ngoodPVsPOG],h_genParticles->at(bestMatchingAntiS).vz());
+        if(ngoodPVsPOG < m_PUReweighingTable->nPVBins() && bestMatchingAntiS > -1) {
+		event_weighting_factorPU = m_PUReweighingTable->weight(ngoodPVsPOG,h_genParticles->at(bestMatchingAntiS).vz());
 	}
-	else if(ngoodPVsPOG < AnalyzerAllSteps::v_mapPU.size()){ //but if the MC does not contain any antiS you have to reweigh on the 'event', so pick a random PVz location to reweigh on
-		event_weighting_factorPU = AnalyzerAllSteps::PUReweighingFactor(AnalyzerAllSteps::v_mapPU[ngoodPVsPOG],randomPVz);
+	else if(ngoodPVsPOG < m_PUReweighingTable->nPVBins()){ //but if the MC does not contain any antiS you have to reweigh on the 'event', so pick a random PVz location to reweigh on
+		event_weighting_factorPU = m_PUReweighingTable->weight(ngoodPVsPOG,randomPVz);
 		event_weighting_factorPU = event_weighting_factorPU * ngoodPVsPOG / 18.479;
 	}
 
@@ -301,8 +371,8 @@ void FlatTreeProducerBDT::FillBranches(const reco::VertexCompositeCandidate * RE
 	nTotalRECOSWeighed = nTotalRECOSWeighed + event_weighting_factor*event_weighting_factorPU;
 
 	//calculate some kinematic variables for the RECO AntiS
-	TVector3 RECOAntiSMomentumVertex(RECO_S->px(),RECO_S->py(),RECO_S->pz());
-	double RECOErrorLxy_interactionVertex = AnalyzerAllSteps::std_dev_lxy(RECO_S->vx(), RECO_S->vy(), RECO_S->vertexCovariance(0,0), RECO_S->vertexCovariance(1,1), beamspot.X(), beamspot.Y(), beamspotVariance.X(), beamspotVariance.Y());
+	sexaq::Vec3 RECOAntiSMomentumVertex(RECO_S->px(),RECO_S->py(),RECO_S->pz());
+	double RECOErrorLxy_interactionVertex = AnalyzerAllSteps::std_dev_lxy(RECO_S->vx(), RECO_S->vy(), RECO_S->vertexCovariance(0,0), RECO_S->vertexCovariance(1,1), beamspot.x, beamspot.y, beamspotVariance.x, beamspotVariance.y);
 	//angular differences between the V0s
 	double RECODeltaPhiDaughters = reco::deltaPhi(RECO_S->daughter(0)->phi(),RECO_S->daughter(1)->phi());
 	double RECODeltaEtaDaughters = RECO_S->daughter(0)->eta()-RECO_S->daughter(1)->eta();
@@ -313,14 +383,14 @@ void FlatTreeProducerBDT::FillBranches(const reco::VertexCompositeCandidate * RE
 	double RECO_Smass = (RECO_S->p4()-n_).mass();
 
 	//the lxy of the Lambda and Ks decay vertex
-	TVector3 RECOAntiSDaug0Vertex(RECO_S->daughter(0)->vx(),RECO_S->daughter(0)->vy(),RECO_S->daughter(0)->vz());
-        TVector3 RECOAntiSDaug1Vertex(RECO_S->daughter(1)->vx(),RECO_S->daughter(1)->vy(),RECO_S->daughter(1)->vz());
-	double RECOLxy_Lambda = AnalyzerAllSteps::lxy(beamspot,RECOAntiSDaug0Vertex);
-	double RECOLxy_Ks = AnalyzerAllSteps::lxy(beamspot,RECOAntiSDaug1Vertex);
+	sexaq::Vec3 RECOAntiSDaug0Vertex(RECO_S->daughter(0)->vx(),RECO_S->daughter(0)->vy(),RECO_S->daughter(0)->vz());
+        sexaq::Vec3 RECOAntiSDaug1Vertex(RECO_S->daughter(1)->vx(),RECO_S->daughter(1)->vy(),RECO_S->daughter(1)->vz());
+	double RECOLxy_Lambda = sexaq::lxy(beamspot,RECOAntiSDaug0Vertex);
+	double RECOLxy_Ks = sexaq::lxy(beamspot,RECOAntiSDaug1Vertex);
 
 	//the dxy of the Lambda and Ks
-	TVector3 RECOAntiSDaug0Momentum(RECO_S->daughter(0)->px(),RECO_S->daughter(0)->py(),RECO_S->daughter(0)->pz());
-        TVector3 RECOAntiSDaug1Momentum(RECO_S->daughter(1)->px(),RECO_S->daughter(1)->py(),RECO_S->daughter(1)->pz());
+	sexaq::Vec3 RECOAntiSDaug0Momentum(RECO_S->daughter(0)->px(),RECO_S->daughter(0)->py(),RECO_S->daughter(0)->pz());
+        sexaq::Vec3 RECOAntiSDaug1Momentum(RECO_S->daughter(1)->px(),RECO_S->daughter(1)->py(),RECO_S->daughter(1)->pz());
 	reco::Candidate::Vector vRECOAntiSMomentum(RECO_S->px(),RECO_S->py(),RECO_S->pz());
 	reco::Candidate::Vector vRECOAntiSDaug0Momentum(RECO_S->daughter(0)->px(),RECO_S->daughter(0)->py(),RECO_S->daughter(0)->pz());
         reco::Candidate::Vector vRECOAntiSDaug1Momentum(RECO_S->daughter(1)->px(),RECO_S->daughter(1)->py(),RECO_S->daughter(1)->pz());
@@ -329,43 +399,50 @@ void FlatTreeProducerBDT::FillBranches(const reco::VertexCompositeCandidate * RE
 	double RECOOpeningsAngleAntiSKs = AnalyzerAllSteps::openings_angle(vRECOAntiSDaug1Momentum,vRECOAntiSMomentum);
 
 	double RECOOpeningsAngleDaughters = AnalyzerAllSteps::openings_angle(vRECOAntiSDaug0Momentum,vRECOAntiSDaug1Momentum);
-        double RECO_dxy_daughter0 = AnalyzerAllSteps::dxy_signed_line_point(RECOAntiSInteractionVertex, RECOAntiSDaug0Momentum,beamspot);
-        double RECO_dxy_daughter1 = AnalyzerAllSteps::dxy_signed_line_point(RECOAntiSInteractionVertex, RECOAntiSDaug1Momentum,beamspot);
+        double RECO_dxy_daughter0 = sexaq::dxy_signed_line_point(RECOAntiSInteractionVertex, RECOAntiSDaug0Momentum,beamspot);
+        double RECO_dxy_daughter1 = sexaq::dxy_signed_line_point(RECOAntiSInteractionVertex, RECOAntiSDaug1Momentum,beamspot);
 	//the dz of the Ks and Lambda
-	double RECO_dz_daughter0 = AnalyzerAllSteps::dz_line_point(RECOAntiSInteractionVertex, RECOAntiSDaug0Momentum,beamspot);
-	double RECO_dz_daughter1 = AnalyzerAllSteps::dz_line_point(RECOAntiSInteractionVertex, RECOAntiSDaug1Momentum,beamspot);
+	double RECO_dz_daughter0 = sexaq::dz_line_point(RECOAntiSInteractionVertex, RECOAntiSDaug0Momentum,beamspot);
+	double RECO_dz_daughter1 = sexaq::dz_line_point(RECOAntiSInteractionVertex, RECOAntiSDaug1Momentum,beamspot);
 	//dxy and dz of the AntiS itself
-	double RECO_dxy_antiS = AnalyzerAllSteps::dxy_signed_line_point(RECOAntiSInteractionVertex,RECOAntiSMomentumVertex,beamspot);
-	double RECO_dz_antiS = AnalyzerAllSteps::dz_line_point(RECOAntiSInteractionVertex,RECOAntiSMomentumVertex,beamspot);
+	double RECO_dxy_antiS = sexaq::dxy_signed_line_point(RECOAntiSInteractionVertex,RECOAntiSMomentumVertex,beamspot);
+	double RECO_dz_antiS = sexaq::dz_line_point(RECOAntiSInteractionVertex,RECOAntiSMomentumVertex,beamspot);
 	
-	//loop over all PVs and find the one which minimises the dz of the antiS
+	//loop over all PVs and find the ones which minimise the dz of the antiS, the Lambda and the Ks, all three in one pass over the PVs
+	m_dzLines.clear();
+	m_dzLines.push_back(RECOAntiSInteractionVertex,RECOAntiSMomentumVertex);
+	m_dzLines.push_back(RECOAntiSInteractionVertex,RECOAntiSDaug0Momentum);
+	m_dzLines.push_back(RECOAntiSInteractionVertex,RECOAntiSDaug1Momentum);
+	if(h_goodPVs.isValid()) AnalyzerAllSteps::dz_line_point_min(m_dzLines, h_goodPVs->goodPOG, m_dzBestPV, m_dzmin);
+	else m_dzBestPV.assign(3, -1);
+	sexaq::Vec3 bestPVdz[3];
+	for(unsigned int l = 0; l < 3; ++l) if(m_dzBestPV[l] > -1) bestPVdz[l] = sexaq::Vec3(h_goodPVs->goodPOG.x[m_dzBestPV[l]],h_goodPVs->goodPOG.y[m_dzBestPV[l]],h_goodPVs->goodPOG.z[m_dzBestPV[l]]);
+
+	//the antiS
 	double RECOdzAntiSPVmin = 999.;
 	double dxyAntiSPVmin = 999.;
-	TVector3  bestPVdzAntiS;
-	if(h_offlinePV.isValid()){
-		bestPVdzAntiS = AnalyzerAllSteps::dz_line_point_min(RECOAntiSInteractionVertex,RECOAntiSMomentumVertex,h_offlinePV);
-		RECOdzAntiSPVmin = AnalyzerAllSteps::dz_line_point(RECOAntiSInteractionVertex,RECOAntiSMomentumVertex,bestPVdzAntiS);
-		dxyAntiSPVmin = AnalyzerAllSteps::dxy_signed_line_point(RECOAntiSInteractionVertex,RECOAntiSMomentumVertex,bestPVdzAntiS);
+	sexaq::Vec3  bestPVdzAntiS = bestPVdz[0];
+	if(h_goodPVs.isValid()){
+		RECOdzAntiSPVmin = sexaq::dz_line_point(RECOAntiSInteractionVertex,RECOAntiSMomentumVertex,bestPVdzAntiS);
+		dxyAntiSPVmin = sexaq::dxy_signed_line_point(RECOAntiSInteractionVertex,RECOAntiSMomentumVertex,bestPVdzAntiS);
 	}
 
-	//loop over all PVs and find the one which minimises the dz of the Lambda
+	//the Lambda
 	double RECOdzLambdaPVmin = 999.;
 	double dxyLambdaPVmin = 999.;
-	TVector3  bestPVdzLambda;
-	if(h_offlinePV.isValid()){
-		bestPVdzLambda = AnalyzerAllSteps::dz_line_point_min(RECOAntiSInteractionVertex,RECOAntiSDaug0Momentum,h_offlinePV);
-		RECOdzLambdaPVmin = AnalyzerAllSteps::dz_line_point(RECOAntiSInteractionVertex,RECOAntiSDaug0Momentum,bestPVdzLambda);
-		dxyLambdaPVmin = AnalyzerAllSteps::dxy_signed_line_point(RECOAntiSInteractionVertex,RECOAntiSDaug0Momentum,bestPVdzLambda);
+	sexaq::Vec3  bestPVdzLambda = bestPVdz[1];
+	if(h_goodPVs.isValid()){
+		RECOdzLambdaPVmin = sexaq::dz_line_point(RECOAntiSInteractionVertex,RECOAntiSDaug0Momentum,bestPVdzLambda);
+		dxyLambdaPVmin = sexaq::dxy_signed_line_point(RECOAntiSInteractionVertex,RECOAntiSDaug0Momentum,bestPVdzLambda);
 	}
 
-	//loop over all PVs and find the one which minimises the dz of the Ks
+	//the Ks
 	double RECOdzKsPVmin = 999.;
 	double dxyKsPVmin = 999.;
-	TVector3  bestPVdzKs;
-	if(h_offlinePV.isValid()){
-		bestPVdzKs = AnalyzerAllSteps::dz_line_point_min(RECOAntiSInteractionVertex,RECOAntiSDaug1Momentum,h_offlinePV);
-		RECOdzKsPVmin = AnalyzerAllSteps::dz_line_point(RECOAntiSInteractionVertex,RECOAntiSDaug1Momentum,bestPVdzKs);
-		dxyKsPVmin = AnalyzerAllSteps::dxy_signed_line_point(RECOAntiSInteractionVertex,RECOAntiSDaug1Momentum,bestPVdzKs);
+	sexaq::Vec3  bestPVdzKs = bestPVdz[2];
+	if(h_goodPVs.isValid()){
+		RECOdzKsPVmin = sexaq::dz_line_point(RECOAntiSInteractionVertex,RECOAntiSDaug1Momentum,bestPVdzKs);
+		dxyKsPVmin = sexaq::dxy_signed_line_point(RECOAntiSInteractionVertex,RECOAntiSDaug1Momentum,bestPVdzKs);
 	}
 
 	//for the granddaughters: problem is the Ks and Lambda as daughter of the AntiS do not have daughters, so I need to go through the reconstructed Ks and Lambda collection and find the best matching ones
@@ -381,7 +458,7 @@ void FlatTreeProducerBDT::FillBranches(const reco::VertexCompositeCandidate * RE
 		if(deltaR < deltaRMinLambda){deltaRMinLambda=deltaR;bestMatchingLambda=i_l;}
 	}
 
-	const reco::VertexCompositeCandidate Lambda = h_V0L->at(bestMatchingLambda); 
+	const reco::VertexCompositeCandidate& Lambda = h_V0L->at(bestMatchingLambda); 
 
 	//for the Ks
 	const reco::Candidate* Ks_fromAntiS = RECO_S->daughter(1);
@@ -394,43 +471,43 @@ void FlatTreeProducerBDT::FillBranches(const reco::VertexCompositeCandidate * RE
 		double deltaR = sqrt( deltaPhi*deltaPhi + deltaEta*deltaEta);
 		if(deltaR < deltaRMinKs){deltaRMinKs=deltaR;bestMatchingKs=i_k;}
 	}
-	const reco::VertexCompositeCandidate Ks = h_V0Ks->at(bestMatchingKs);
+	const reco::VertexCompositeCandidate& Ks = h_V0Ks->at(bestMatchingKs);
 
 	//for the Lambda: het info on the tracks
 	//track1
 	double RECO_Lambda_daughter0_charge = Lambda.daughter(0)->charge();
 	double RECO_Lambda_daughter0_pt = Lambda.daughter(0)->pt();
 	double RECO_Lambda_daughter0_pz = Lambda.daughter(0)->pz();
-	TVector3 RECO_Lambda_Daughter0Momentum( Lambda.daughter(0)->px(), Lambda.daughter(0)->py(), Lambda.daughter(0)->pz() );	
-	TVector3 RECO_Lambda_Daughter0Vertex( Lambda.daughter(0)->vx(), Lambda.daughter(0)->vy(), Lambda.daughter(0)->vz() );	
-	double RECO_Lambda_daughter0_dxy_beamspot = AnalyzerAllSteps::dxy_signed_line_point(RECO_Lambda_Daughter0Vertex, RECO_Lambda_Daughter0Momentum, beamspot);
-	double RECO_Lambda_daughter0_dz_beamspot = AnalyzerAllSteps::dz_line_point(RECO_Lambda_Daughter0Vertex, RECO_Lambda_Daughter0Momentum, beamspot);
+	sexaq::Vec3 RECO_Lambda_Daughter0Momentum( Lambda.daughter(0)->px(), Lambda.daughter(0)->py(), Lambda.daughter(0)->pz() );	
+	sexaq::Vec3 RECO_Lambda_Daughter0Vertex( Lambda.daughter(0)->vx(), Lambda.daughter(0)->vy(), Lambda.daughter(0)->vz() );	
+	double RECO_Lambda_daughter0_dxy_beamspot = sexaq::dxy_signed_line_point(RECO_Lambda_Daughter0Vertex, RECO_Lambda_Daughter0Momentum, beamspot);
+	double RECO_Lambda_daughter0_dz_beamspot = sexaq::dz_line_point(RECO_Lambda_Daughter0Vertex, RECO_Lambda_Daughter0Momentum, beamspot);
 	//track2	
 	double RECO_Lambda_daughter1_charge = Lambda.daughter(1)->charge();
 	double RECO_Lambda_daughter1_pt = Lambda.daughter(1)->pt();
 	double RECO_Lambda_daughter1_pz = Lambda.daughter(1)->pz();
-	TVector3 RECO_Lambda_Daughter1Momentum( Lambda.daughter(1)->px(), Lambda.daughter(1)->py(), Lambda.daughter(1)->pz() );	
-	TVector3 RECO_Lambda_Daughter1Vertex( Lambda.daughter(1)->vx(), Lambda.daughter(1)->vy(), Lambda.daughter(1)->vz() );	
-	double RECO_Lambda_daughter1_dxy_beamspot = AnalyzerAllSteps::dxy_signed_line_point(RECO_Lambda_Daughter1Vertex, RECO_Lambda_Daughter1Momentum, beamspot);
-	double RECO_Lambda_daughter1_dz_beamspot = AnalyzerAllSteps::dz_line_point(RECO_Lambda_Daughter1Vertex, RECO_Lambda_Daughter1Momentum, beamspot);
+	sexaq::Vec3 RECO_Lambda_Daughter1Momentum( Lambda.daughter(1)->px(), Lambda.daughter(1)->py(), Lambda.daughter(1)->pz() );	
+	sexaq::Vec3 RECO_Lambda_Daughter1Vertex( Lambda.daughter(1)->vx(), Lambda.daughter(1)->vy(), Lambda.daughter(1)->vz() );	
+	double RECO_Lambda_daughter1_dxy_beamspot = sexaq::dxy_signed_line_point(RECO_Lambda_Daughter1Vertex, RECO_Lambda_Daughter1Momentum, beamspot);
+	double RECO_Lambda_daughter1_dz_beamspot = sexaq::dz_line_point(RECO_Lambda_Daughter1Vertex, RECO_Lambda_Daughter1Momentum, beamspot);
 
 	//for the Ks: get info on the tracks
 	//track1
 	double RECO_Ks_daughter0_charge = Ks.daughter(0)->charge();
 	double RECO_Ks_daughter0_pt = Ks.daughter(0)->pt();
 	double RECO_Ks_daughter0_pz = Ks.daughter(0)->pz();
-	TVector3 RECO_Ks_Daughter0Momentum( Ks.daughter(0)->px(), Ks.daughter(0)->py(), Ks.daughter(0)->pz() );	
-	TVector3 RECO_Ks_Daughter0Vertex( Ks.daughter(0)->vx(), Ks.daughter(0)->vy(), Ks.daughter(0)->vz() );	
-	double RECO_Ks_daughter0_dxy_beamspot = AnalyzerAllSteps::dxy_signed_line_point(RECO_Ks_Daughter0Vertex, RECO_Ks_Daughter0Momentum, beamspot);
-	double RECO_Ks_daughter0_dz_beamspot = AnalyzerAllSteps::dz_line_point(RECO_Ks_Daughter0Vertex, RECO_Ks_Daughter0Momentum, beamspot);
+	sexaq::Vec3 RECO_Ks_Daughter0Momentum( Ks.daughter(0)->px(), Ks.daughter(0)->py(), Ks.daughter(0)->pz() );	
+	sexaq::Vec3 RECO_Ks_Daughter0Vertex( Ks.daughter(0)->vx(), Ks.daughter(0)->vy(), Ks.daughter(0)->vz() );	
+	double RECO_Ks_daughter0_dxy_beamspot = sexaq::dxy_signed_line_point(RECO_Ks_Daughter0Vertex, RECO_Ks_Daughter0Momentum, beamspot);
+	double RECO_Ks_daughter0_dz_beamspot = sexaq::dz_line_point(RECO_Ks_Daughter0Vertex, RECO_Ks_Daughter0Momentum, beamspot);
 	//track2	
 	double RECO_Ks_daughter1_charge = Ks.daughter(1)->charge();
 	double RECO_Ks_daughter1_pt = Ks.daughter(1)->pt();
 	double RECO_Ks_daughter1_pz = Ks.daughter(1)->pz();
-	TVector3 RECO_Ks_Daughter1Momentum( Ks.daughter(1)->px(), Ks.daughter(1)->py(), Ks.daughter(1)->pz() );	
-	TVector3 RECO_Ks_Daughter1Vertex( Ks.daughter(1)->vx(), Ks.daughter(1)->vy(), Ks.daughter(1)->vz() );	
-	double RECO_Ks_daughter1_dxy_beamspot = AnalyzerAllSteps::dxy_signed_line_point(RECO_Ks_Daughter1Vertex, RECO_Ks_Daughter1Momentum, beamspot);
-	double RECO_Ks_daughter1_dz_beamspot = AnalyzerAllSteps::dz_line_point(RECO_Ks_Daughter1Vertex, RECO_Ks_Daughter1Momentum, beamspot);
+	sexaq::Vec3 RECO_Ks_Daughter1Momentum( Ks.daughter(1)->px(), Ks.daughter(1)->py(), Ks.daughter(1)->pz() );	
+	sexaq::Vec3 RECO_Ks_Daughter1Vertex( Ks.daughter(1)->vx(), Ks.daughter(1)->vy(), Ks.daughter(1)->vz() );	
+	double RECO_Ks_daughter1_dxy_beamspot = sexaq::dxy_signed_line_point(RECO_Ks_Daughter1Vertex, RECO_Ks_Daughter1Momentum, beamspot);
+	double RECO_Ks_daughter1_dz_beamspot = sexaq::dz_line_point(RECO_Ks_Daughter1Vertex, RECO_Ks_Daughter1Momentum, beamspot);
 
 
 	//if the RECO S particle fails the below cut than don't fill the tree. These already cut the majority of the background, so the background trees will be much smaller, which is nice for computational reasons
@@ -438,19 +515,17 @@ void FlatTreeProducerBDT::FillBranches(const reco::VertexCompositeCandidate * RE
 	Init_Counter();
 	if(RECO_S->charge()==1)_RECO_S_total_lxy_beampipeCenter.push_back(RECOLxy_interactionVertex_beampipeCenter);
 	if(RECOLxy_interactionVertex_beampipeCenter < AnalyzerAllSteps::MinLxyCut  ){
-        	_tree_counter->Fill();
+        	_tree_counter.fill();
 		return;
 	}
 
         if(RECO_S->charge()==1)_RECO_S_saved_lxy_beampipeCenter.push_back(RECOLxy_interactionVertex_beampipeCenter);
-        _tree_counter->Fill();
-
+        _tree_counter.fill();
 
-	nSavedRECOS++;
-	nSavedRECOSWeighed++;
 
 	Init();	
 
+	_S_index.push_back(SIndex);
 	_S_charge.push_back(RECO_S->charge());
 	_S_deltaLInteractionVertexAntiSmin.push_back(deltaLInteractionVertexAntiSmin);
 	_S_deltaRAntiSmin.push_back(deltaRAntiSmin);
@@ -505,13 +580,13 @@ void FlatTreeProducerBDT::FillBranches(const reco::VertexCompositeCandidate * RE
 	_Lambda_pz.push_back(RECO_S->daughter(0)->pz());
 	_Ks_pz.push_back(RECO_S->daughter(1)->pz());
 
-	_S_vz_interaction_vertex.push_back(RECO_S->vz()-beamspot.Z());
-        _Lambda_vz_decay_vertex.push_back(RECOAntiSDaug0Vertex.Z()-beamspot.Z());
-        _Ks_vz_decay_vertex.push_back(RECOAntiSDaug1Vertex.Z()-beamspot.Z());
+	_S_vz_interaction_vertex.push_back(RECO_S->vz()-beamspot.z);
+        _Lambda_vz_decay_vertex.push_back(RECOAntiSDaug0Vertex.z-beamspot.z);
+        _Ks_vz_decay_vertex.push_back(RECOAntiSDaug1Vertex.z-beamspot.z);
 
 	_S_vx.push_back(RECO_S->vx());	
 	_S_vy.push_back(RECO_S->vy());	
-	_S_vz.push_back(RECO_S->vz()-beamspot.Z());	
+	_S_vz.push_back(RECO_S->vz()-beamspot.z);	
 
 	_Lambda_mass.push_back(RECO_S->daughter(0)->mass());
 	_Ks_mass.push_back(RECO_S->daughter(1)->mass());
@@ -540,37 +615,37 @@ void FlatTreeProducerBDT::FillBranches(const reco::VertexCompositeCandidate * RE
 	_RECO_Ks_daughter1_dxy_beamspot.push_back(RECO_Ks_daughter1_dxy_beamspot);
 	_RECO_Ks_daughter1_dz_beamspot.push_back(RECO_Ks_daughter1_dz_beamspot);
 
-  	_tree->Fill();
+	//the BDT score, from the values which were just filled in the branches
+	double BDTScore = -999.;
+	if(m_evaluateBDT){
+		for(unsigned int i = 0; i < m_BDTInputs.size(); ++i) m_BDTFeatures[i] = m_BDTInputs[i]->back();
+		BDTScore = m_BDT->evaluate(m_BDTFeatures.data());
+		if(BDTScore < m_minBDTScore){
+			nDroppedBDTRECOS++;
+			return;
+		}
+	}
+	_S_BDT.push_back(BDTScore);
 
-}
+	nSavedRECOS++;
+	nSavedRECOSWeighed++;
 
+  	_tree.fill(m_eventIndex);
 
-void FlatTreeProducerBDT::endJob()
-{
 }
 
-void
-FlatTreeProducerBDT::beginRun(edm::Run const& iRun, edm::EventSetup const& iSetup)
-{
-  srand(time(NULL));
-}
 
-// ------------ method called when ending the processing of a run  ------------
-void
-FlatTreeProducerBDT::endRun(edm::Run const&, edm::EventSetup const&)
+void FlatTreeProducerBDT::endJob()
 {
 }
 
-// ------------ method called when starting to processes a luminosity block  ------------
-void
-FlatTreeProducerBDT::beginLuminosityBlock(edm::LuminosityBlock const&, edm::EventSetup const&)
-{
-}
+unsigned int FlatTreeProducerBDT::randomIndex(edm::Event const& iEvent, unsigned int n) const {
 
-// ------------ method called when ending the processing of a luminosity block  ------------
-void
-FlatTreeProducerBDT::endLuminosityBlock(edm::LuminosityBlock const&, edm::EventSetup const&)
-{
+	//a fresh engine for every event, seeded with the module seed and the event id: the number does not depend on which events were processed before in the same job. std::seed_seq and std::mt19937 are fully specified by the standard, so it is the same on every platform
+	const unsigned long long eventNumber = iEvent.id().event();
+	std::seed_seq seed{m_randomSeed, (std::uint32_t)iEvent.id().run(), (std::uint32_t)iEvent.id().luminosityBlock(), (std::uint32_t)(eventNumber >> 32), (std::uint32_t)(eventNumber & 0xffffffff)};
+	std::mt19937 engine(seed);
+	return engine() % n;
 }
 
 // ------------ method fills 'descriptions' with the allowed parameters for the module  ------------
@@ -587,6 +662,7 @@ FlatTreeProducerBDT::~FlatTreeProducerBDT()
 {
 	std::cout << "total number of S or antiS found: " << nTotalRECOS << std::endl;
 	std::cout << "total number of S or antiS found, weighed: " << nTotalRECOSWeighed << std::endl;
+	if(m_evaluateBDT) std::cout << "total number of S or antiS not saved because of a BDT score below " << m_minBDTScore << ": " << nDroppedBDTRECOS << std::endl;
 	std::cout << "total number of S or antiS saved: " << nSavedRECOS << std::endl;
 	std::cout << "total number of S or antiS saved, weighed: " << nSavedRECOSWeighed << std::endl;
 }
@@ -618,6 +694,7 @@ void FlatTreeProducerBDT::Init()
 {
 
 
+    	_S_index.clear();
     	_S_charge.clear();
 	_S_deltaLInteractionVertexAntiSmin.clear();
 	_S_deltaRAntiSmin.clear();
@@ -682,6 +759,7 @@ void FlatTreeProducerBDT::Init()
 
 	_Lambda_mass.clear();
 	_Ks_mass.clear();
+	_S_BDT.clear();
 
 	_RECO_Lambda_daughter0_charge.clear();
 	_RECO_Lambda_daughter0_pt.clear();
@@ -21,19 +21,21 @@ void FlatTreeProducerGEN::beginJob() {
         edm::Service<TFileService> fs ;
 
 	//very basic info on the charged pions in events
-	_tree_pi = fs->make <TTree>("FlatTreeGENLevelPi","treePi");
-	_tree_pi->Branch("_pi_eta",&_pi_eta);
+	_tree_pi.open(*fs, "FlatTreeGENLevelPi", "treePi");
+	m_eventId.addBranches(_tree_pi);
+	_tree_pi.add("_pi_eta",&_pi_eta);
 
 	//some GEN Sbar kinematics
-        _tree = fs->make <TTree>("FlatTreeGENLevel","tree");
-	_tree->Branch("_S_charge",&_S_charge);
-	_tree->Branch("_S_mass",&_S_mass);
-	_tree->Branch("_S_eta",&_S_eta);
-	_tree->Branch("_S_pt",&_S_pt);
-	_tree->Branch("_S_pz",&_S_pz);
-	_tree->Branch("_S_vx",&_S_vx);
-	_tree->Branch("_S_vy",&_S_vy);
-	_tree->Branch("_S_vz",&_S_vz);
+        _tree.open(*fs, "FlatTreeGENLevel", "tree");
+	m_eventId.addBranches(_tree);
+	_tree.add("_S_charge",&_S_charge);
+	_tree.add("_S_mass",&_S_mass);
+	_tree.add("_S_eta",&_S_eta);
+	_tree.add("_S_pt",&_S_pt);
+	_tree.add("_S_pz",&_S_pz);
+	_tree.add("_S_vx",&_S_vx);
+	_tree.add("_S_vy",&_S_vy);
+	_tree.add("_S_vz",&_S_vz);
 
 
 
@@ -41,6 +43,8 @@ void FlatTreeProducerGEN::beginJob() {
 
 void FlatTreeProducerGEN::analyze(edm::Event const& iEvent, edm::EventSetup const& iSetup) {
 
+  m_eventId.set(iEvent);
+
  
 
   //beamspot
@@ -88,7 +92,7 @@ void FlatTreeProducerGEN::analyze(edm::Event const& iEvent, edm::EventSetup cons
 
 
 	      }//for(unsigned int i = 0; i < h_genParticles->size(); ++i)
-	      _tree_pi->Fill();
+	      _tree_pi.fill();
 	      nPions = nPions + nPionsThisEvent;
 	      nPionsEtaSmaller4 = nPionsEtaSmaller4 + nPionsThisEventEtaSmaller4;
 	  }//if(h_genParticles.isValid())
@@ -115,7 +119,7 @@ void FlatTreeProducerGEN::FillBranchesGENAntiS(const reco::Candidate  * genParti
 	_S_vy.push_back(genParticle->vy());	
 	_S_vz.push_back(genParticle->vz());	
 
-  	_tree->Fill();
+  	_tree.fill();
 
 }
 
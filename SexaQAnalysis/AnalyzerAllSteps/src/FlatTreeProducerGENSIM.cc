@@ -5,16 +5,17 @@ FlatTreeProducerGENSIM::FlatTreeProducerGENSIM(edm::ParameterSet const& pset):
   m_lookAtAntiS(pset.getUntrackedParameter<bool>("lookAtAntiS")),
   m_runningOnData(pset.getUntrackedParameter<bool>("runningOnData")),
   m_bsTag(pset.getParameter<edm::InputTag>("beamspot")),
-  m_offlinePVTag(pset.getParameter<edm::InputTag>("offlinePV")),
+  m_goodPVsTag(pset.getParameter<edm::InputTag>("goodPVs")),
   m_genParticlesTag_GEN(pset.getParameter<edm::InputTag>("genCollection_GEN")),
   m_genParticlesTag_SIM_GEANT(pset.getParameter<edm::InputTag>("genCollection_SIM_GEANT")),
   m_TPTag(pset.getParameter<edm::InputTag>("TrackingParticles")),
 
   m_bsToken    (consumes<reco::BeamSpot>(m_bsTag)),
-  m_offlinePVToken    (consumes<vector<reco::Vertex>>(m_offlinePVTag)),
+  m_goodPVsToken    (consumes<GoodPrimaryVertices>(m_goodPVsTag)),
   m_genParticlesToken_GEN(consumes<vector<reco::GenParticle> >(m_genParticlesTag_GEN)),
   m_genParticlesToken_SIM_GEANT(consumes<vector<reco::GenParticle> >(m_genParticlesTag_SIM_GEANT)),
-  m_TPToken(consumes<vector<TrackingParticle> >(m_TPTag))
+  m_TPToken(consumes<vector<TrackingParticle> >(m_TPTag)),
+  m_PUReweighingFile(pset.getParameter<edm::FileInPath>("PUReweighingFile"))
   
 {
 
@@ -26,155 +27,160 @@ void FlatTreeProducerGENSIM::beginJob() {
         // Initialize when class is created
         edm::Service<TFileService> fs ;
 
+	//PU reweighing parameters
+	m_PUReweighingTable = PUReweighingTable::get(m_PUReweighingFile.fullPath());
+
 	//tree containing info on the Sbar, also for Sbar that do not go to all correct final state particles.
 	//a tree like this is needed to have a full scope of the Sbar kinematics. Sbar which are produced very 
 	//forward will anyway not have the correct final state particles as these will have high eta and are
 	//by construction not stored in the genParticlesPlusGEANT collection 
-	_treeAllAntiS = fs->make <TTree>("FlatTreeGENLevelAllAntiS","treeAllAntiS");
-	_treeAllAntiS->Branch("_S_eta_all",&_S_eta_all);
-	_treeAllAntiS->Branch("_S_reconstructable_all",&_S_reconstructable_all);
-	_treeAllAntiS->Branch("_S_event_weighting_factor_all",&_S_event_weighting_factor_all);
-	_treeAllAntiS->Branch("_S_event_weighting_factor_PU_all",&_S_event_weighting_factor_PU_all);
-	_treeAllAntiS->Branch("_S_vz_creation_vertex_all",&_S_vz_creation_vertex_all);
-	_treeAllAntiS->Branch("_S_nGoodPV_all",&_S_nGoodPV_all);
-	_treeAllAntiS->Branch("_S_pt_all",&_S_pt_all);
-	_treeAllAntiS->Branch("_S_pz_all",&_S_pz_all);
+	_treeAllAntiS.open(*fs, "FlatTreeGENLevelAllAntiS", "treeAllAntiS");
+	m_eventId.addBranches(_treeAllAntiS);
+	_treeAllAntiS.add("_S_eta_all",&_S_eta_all);
+	_treeAllAntiS.add("_S_reconstructable_all",&_S_reconstructable_all);
+	_treeAllAntiS.add("_S_event_weighting_factor_all",&_S_event_weighting_factor_all);
+	_treeAllAntiS.add("_S_event_weighting_factor_PU_all",&_S_event_weighting_factor_PU_all);
+	_treeAllAntiS.add("_S_vz_creation_vertex_all",&_S_vz_creation_vertex_all);
+	_treeAllAntiS.add("_S_nGoodPV_all",&_S_nGoodPV_all);
+	_treeAllAntiS.add("_S_pt_all",&_S_pt_all);
+	_treeAllAntiS.add("_S_pz_all",&_S_pz_all);
 
 	//tree containing info on the Sbar which go to correct final state particles
-        _tree = fs->make <TTree>("FlatTreeGENLevel","tree");
-	_tree->Branch("_S_n_loops",&_S_n_loops);
-	_tree->Branch("_S_charge",&_S_charge);
-	_tree->Branch("_S_nGoodPV",&_S_nGoodPV);
-	_tree->Branch("_S_event_weighting_factor",&_S_event_weighting_factor);
-	_tree->Branch("_S_event_weighting_factor_PU",&_S_event_weighting_factor_PU);
-	_tree->Branch("_S_lxy_interaction_vertex",&_S_lxy_interaction_vertex);
-	_tree->Branch("_S_lxy_interaction_vertex_beamspot",&_S_lxy_interaction_vertex_beamspot);
-	_tree->Branch("_S_lxy_interaction_vertex_beampipeCenterData",&_S_lxy_interaction_vertex_beampipeCenterData);
-	_tree->Branch("_S_lxyz_interaction_vertex",&_S_lxyz_interaction_vertex);
-	_tree->Branch("_S_error_lxy_interaction_vertex",&_S_error_lxy_interaction_vertex);
-	_tree->Branch("_S_mass",&_S_mass);
-	_tree->Branch("_S_Mt",&_S_Mt);
-	_tree->Branch("_n_M",&_n_M);
-	_tree->Branch("_n_p",&_n_p);
-	_tree->Branch("_S_chi2_ndof",&_S_chi2_ndof);
-
-	_tree->Branch("_S_daughters_deltaphi",&_S_daughters_deltaphi);
-	_tree->Branch("_S_daughters_deltaeta",&_S_daughters_deltaeta);
-	_tree->Branch("_S_daughters_openingsangle",&_S_daughters_openingsangle);
-	_tree->Branch("_S_Ks_openingsangle",&_S_Ks_openingsangle);
-	_tree->Branch("_S_Lambda_openingsangle",&_S_Lambda_openingsangle);
-	_tree->Branch("_S_sumDaughters_openingsangle",&_S_sumDaughters_openingsangle);
-	_tree->Branch("_S_sumDaughters_deltaPhi",&_S_sumDaughters_deltaPhi);
-	_tree->Branch("_S_sumDaughters_deltaEta",&_S_sumDaughters_deltaEta);
-	_tree->Branch("_S_sumDaughters_deltaR",&_S_sumDaughters_deltaR);
-	_tree->Branch("_S_daughters_DeltaR",&_S_daughters_DeltaR);
-	_tree->Branch("_S_eta",&_S_eta);
-	_tree->Branch("_Ks_eta",&_Ks_eta);
-	_tree->Branch("_Lambda_eta",&_Lambda_eta);
-
-	_tree->Branch("_S_dxy",&_S_dxy);
-	_tree->Branch("_Ks_dxy",&_Ks_dxy);
-	_tree->Branch("_Lambda_dxy",&_Lambda_dxy);
-
-	_tree->Branch("_S_dxy_over_lxy",&_S_dxy_over_lxy);
-	_tree->Branch("_Ks_dxy_over_lxy",&_Ks_dxy_over_lxy);
-	_tree->Branch("_Lambda_dxy_over_lxy",&_Lambda_dxy_over_lxy);
-
-	_tree->Branch("_S_dz",&_S_dz);
-	_tree->Branch("_Ks_dz",&_Ks_dz);
-	_tree->Branch("_Lambda_dz",&_Lambda_dz);
-	_tree->Branch("_S_dz_min",&_S_dz_min);
-	_tree->Branch("_Ks_dz_min",&_Ks_dz_min);
-	_tree->Branch("_Lambda_dz_min",&_Lambda_dz_min);
-
-	_tree->Branch("_deltaR_sumDaughterMomenta_antiSMomentum",&_deltaR_sumDaughterMomenta_antiSMomentum);
-
-	_tree->Branch("_Ks_openings_angle_displacement_momentum",&_Ks_openings_angle_displacement_momentum);
-	_tree->Branch("_Lambda_openings_angle_displacement_momentum",&_Lambda_openings_angle_displacement_momentum);
-
-	_tree->Branch("_S_pt",&_S_pt);
-	_tree->Branch("_Ks_pt",&_Ks_pt);
-	_tree->Branch("_Lambda_pt",&_Lambda_pt);
-
-	_tree->Branch("_S_pz",&_S_pz);
-	_tree->Branch("_Ks_pz",&_Ks_pz);
-	_tree->Branch("_Lambda_pz",&_Lambda_pz);
-
-	_tree->Branch("_S_vx_interaction_vertex",&_S_vx_interaction_vertex);
-	_tree->Branch("_S_vy_interaction_vertex",&_S_vy_interaction_vertex);
-	_tree->Branch("_S_vz_interaction_vertex",&_S_vz_interaction_vertex);
-
-	_tree->Branch("_S_vx",&_S_vx);
-	_tree->Branch("_S_vy",&_S_vy);
-	_tree->Branch("_S_vz",&_S_vz);
-
-	_tree->Branch("_GEN_Ks_daughter0_px",&_GEN_Ks_daughter0_px);
-	_tree->Branch("_GEN_Ks_daughter0_py",&_GEN_Ks_daughter0_py);
-	_tree->Branch("_GEN_Ks_daughter0_pz",&_GEN_Ks_daughter0_pz);
-	_tree->Branch("_GEN_Ks_daughter0_pt",&_GEN_Ks_daughter0_pt);
-	_tree->Branch("_GEN_Ks_daughter0_eta",&_GEN_Ks_daughter0_eta);
-	_tree->Branch("_GEN_Ks_daughter0_phi",&_GEN_Ks_daughter0_phi);
-	_tree->Branch("_GEN_Ks_daughter0_vx",&_GEN_Ks_daughter0_vx);
-	_tree->Branch("_GEN_Ks_daughter0_vy",&_GEN_Ks_daughter0_vy);
-	_tree->Branch("_GEN_Ks_daughter0_vz",&_GEN_Ks_daughter0_vz);
-	_tree->Branch("_GEN_Ks_daughter0_lxy",&_GEN_Ks_daughter0_lxy);
-	_tree->Branch("_GEN_Ks_daughter0_lxy_zero",&_GEN_Ks_daughter0_lxy_zero);
-	_tree->Branch("_GEN_Ks_daughter0_dxy",&_GEN_Ks_daughter0_dxy);
-	_tree->Branch("_GEN_Ks_daughter0_dz",&_GEN_Ks_daughter0_dz);
-	_tree->Branch("_GEN_Ks_daughter0_openings_angle_displacement_momentum",&_GEN_Ks_daughter0_openings_angle_displacement_momentum);
-
-	_tree->Branch("_GEN_Ks_daughter1_px",&_GEN_Ks_daughter1_px);
-	_tree->Branch("_GEN_Ks_daughter1_py",&_GEN_Ks_daughter1_py);
-	_tree->Branch("_GEN_Ks_daughter1_pz",&_GEN_Ks_daughter1_pz);
-	_tree->Branch("_GEN_Ks_daughter1_pt",&_GEN_Ks_daughter1_pt);
-	_tree->Branch("_GEN_Ks_daughter1_eta",&_GEN_Ks_daughter1_eta);
-	_tree->Branch("_GEN_Ks_daughter1_phi",&_GEN_Ks_daughter1_phi);
-	_tree->Branch("_GEN_Ks_daughter1_vx",&_GEN_Ks_daughter1_vx);
-	_tree->Branch("_GEN_Ks_daughter1_vy",&_GEN_Ks_daughter1_vy);
-	_tree->Branch("_GEN_Ks_daughter1_vz",&_GEN_Ks_daughter1_vz);
-	_tree->Branch("_GEN_Ks_daughter1_lxy",&_GEN_Ks_daughter1_lxy);
-	_tree->Branch("_GEN_Ks_daughter1_dxy",&_GEN_Ks_daughter1_dxy);
-	_tree->Branch("_GEN_Ks_daughter1_dz",&_GEN_Ks_daughter1_dz);
-	_tree->Branch("_GEN_Ks_daughter1_openings_angle_displacement_momentum",&_GEN_Ks_daughter1_openings_angle_displacement_momentum);
-
-	_tree->Branch("_GEN_AntiLambda_AntiProton_px",&_GEN_AntiLambda_AntiProton_px);
-	_tree->Branch("_GEN_AntiLambda_AntiProton_py",&_GEN_AntiLambda_AntiProton_py);
-	_tree->Branch("_GEN_AntiLambda_AntiProton_pz",&_GEN_AntiLambda_AntiProton_pz);
-	_tree->Branch("_GEN_AntiLambda_AntiProton_pt",&_GEN_AntiLambda_AntiProton_pt);
-	_tree->Branch("_GEN_AntiLambda_AntiProton_eta",&_GEN_AntiLambda_AntiProton_eta);
-	_tree->Branch("_GEN_AntiLambda_AntiProton_phi",&_GEN_AntiLambda_AntiProton_phi);
-	_tree->Branch("_GEN_AntiLambda_AntiProton_vx",&_GEN_AntiLambda_AntiProton_vx);
-	_tree->Branch("_GEN_AntiLambda_AntiProton_vy",&_GEN_AntiLambda_AntiProton_vy);
-	_tree->Branch("_GEN_AntiLambda_AntiProton_vz",&_GEN_AntiLambda_AntiProton_vz);
-	_tree->Branch("_GEN_AntiLambda_AntiProton_lxy",&_GEN_AntiLambda_AntiProton_lxy);
-	_tree->Branch("_GEN_AntiLambda_AntiProton_lxy_zero",&_GEN_AntiLambda_AntiProton_lxy_zero);
-	_tree->Branch("_GEN_AntiLambda_AntiProton_dxy",&_GEN_AntiLambda_AntiProton_dxy);
-	_tree->Branch("_GEN_AntiLambda_AntiProton_dz",&_GEN_AntiLambda_AntiProton_dz);
-	_tree->Branch("_GEN_AntiLambda_AntiProton_openings_angle_displacement_momentum",&_GEN_AntiLambda_AntiProton_openings_angle_displacement_momentum);
-
-	_tree->Branch("_GEN_AntiLambda_Pion_px",&_GEN_AntiLambda_Pion_px);
-	_tree->Branch("_GEN_AntiLambda_Pion_py",&_GEN_AntiLambda_Pion_py);
-	_tree->Branch("_GEN_AntiLambda_Pion_pz",&_GEN_AntiLambda_Pion_pz);
-	_tree->Branch("_GEN_AntiLambda_Pion_pt",&_GEN_AntiLambda_Pion_pt);
-	_tree->Branch("_GEN_AntiLambda_Pion_eta",&_GEN_AntiLambda_Pion_eta);
-	_tree->Branch("_GEN_AntiLambda_Pion_phi",&_GEN_AntiLambda_Pion_phi);
-	_tree->Branch("_GEN_AntiLambda_Pion_vx",&_GEN_AntiLambda_Pion_vx);
-	_tree->Branch("_GEN_AntiLambda_Pion_vy",&_GEN_AntiLambda_Pion_vy);
-	_tree->Branch("_GEN_AntiLambda_Pion_vz",&_GEN_AntiLambda_Pion_vz);
-	_tree->Branch("_GEN_AntiLambda_Pion_lxy",&_GEN_AntiLambda_Pion_lxy);
-	_tree->Branch("_GEN_AntiLambda_Pion_dxy",&_GEN_AntiLambda_Pion_dxy);
-	_tree->Branch("_GEN_AntiLambda_Pion_dz",&_GEN_AntiLambda_Pion_dz);
-	_tree->Branch("_GEN_AntiLambda_Pion_openings_angle_displacement_momentum",&_GEN_AntiLambda_Pion_openings_angle_displacement_momentum);
-
-  	_tree->Branch("_GEN_Ks_daughter0_numberOfTrackerLayers",&_GEN_Ks_daughter0_numberOfTrackerLayers);
-        _tree->Branch("_GEN_Ks_daughter1_numberOfTrackerLayers",&_GEN_Ks_daughter1_numberOfTrackerLayers);
-        _tree->Branch("_GEN_AntiLambda_AntiProton_numberOfTrackerLayers",&_GEN_AntiLambda_AntiProton_numberOfTrackerLayers);
-        _tree->Branch("_GEN_AntiLambda_Pion_numberOfTrackerLayers",&_GEN_AntiLambda_Pion_numberOfTrackerLayers);
-
-        _tree->Branch("_GEN_Ks_daughter0_numberOfTrackerHits",&_GEN_Ks_daughter0_numberOfTrackerHits);
-        _tree->Branch("_GEN_Ks_daughter1_numberOfTrackerHits",&_GEN_Ks_daughter1_numberOfTrackerHits);
-        _tree->Branch("_GEN_AntiLambda_AntiProton_numberOfTrackerHits",&_GEN_AntiLambda_AntiProton_numberOfTrackerHits);
-        _tree->Branch("_GEN_AntiLambda_Pion_numberOfTrackerHits",&_GEN_AntiLambda_Pion_numberOfTrackerHits);
+        _tree.open(*fs, "FlatTreeGENLevel", "tree");
+	m_eventId.addBranches(_tree);
+	_tree.add("_S_n_loops",&_S_n_loops);
+	_tree.add("_S_charge",&_S_charge);
+	_tree.add("_S_nGoodPV",&_S_nGoodPV);
+	_tree.add("_S_event_weighting_factor",&_S_event_weighting_factor);
+	_tree.add("_S_event_weighting_factor_PU",&_S_event_weighting_factor_PU);
+	_tree.add("_S_lxy_interaction_vertex",&_S_lxy_interaction_vertex);
+	_tree.add("_S_lxy_interaction_vertex_beamspot",&_S_lxy_interaction_vertex_beamspot);
+	_tree.add("_S_lxy_interaction_vertex_beampipeCenterData",&_S_lxy_interaction_vertex_beampipeCenterData);
+	_tree.add("_S_lxyz_interaction_vertex",&_S_lxyz_interaction_vertex);
+	_tree.add("_S_error_lxy_interaction_vertex",&_S_error_lxy_interaction_vertex);
+	_tree.add("_S_mass",&_S_mass);
+	_tree.add("_S_Mt",&_S_Mt);
+	_tree.add("_n_M",&_n_M);
+	_tree.add("_n_p",&_n_p);
+	_tree.add("_S_chi2_ndof",&_S_chi2_ndof);
+
+	_tree.add("_S_daughters_deltaphi",&_S_daughters_deltaphi);
+	_tree.add("_S_daughters_deltaeta",&_S_daughters_deltaeta);
+	_tree.add("_S_daughters_openingsangle",&_S_daughters_openingsangle);
+	_tree.add("_S_Ks_openingsangle",&_S_Ks_openingsangle);
+	_tree.add("_S_Lambda_openingsangle",&_S_Lambda_openingsangle);
+	_tree.add("_S_sumDaughters_openingsangle",&_S_sumDaughters_openingsangle);
+	_tree.add("_S_sumDaughters_deltaPhi",&_S_sumDaughters_deltaPhi);
+	_tree.add("_S_sumDaughters_deltaEta",&_S_sumDaughters_deltaEta);
+	_tree.add("_S_sumDaughters_deltaR",&_S_sumDaughters_deltaR);
+	_tree.add("_S_daughters_DeltaR",&_S_daughters_DeltaR);
+	_tree.add("_S_eta",&_S_eta);
+	_tree.add("_Ks_eta",&_Ks_eta);
+	_tree.add("_Lambda_eta",&_Lambda_eta);
+
+	_tree.add("_S_dxy",&_S_dxy);
+	_tree.add("_Ks_dxy",&_Ks_dxy);
+	_tree.add("_Lambda_dxy",&_Lambda_dxy);
+
+	_tree.add("_S_dxy_over_lxy",&_S_dxy_over_lxy);
+	_tree.add("_Ks_dxy_over_lxy",&_Ks_dxy_over_lxy);
+	_tree.add("_Lambda_dxy_over_lxy",&_Lambda_dxy_over_lxy);
+
+	_tree.add("_S_dz",&_S_dz);
+	_tree.add("_Ks_dz",&_Ks_dz);
+	_tree.add("_Lambda_dz",&_Lambda_dz);
+	_tree.add("_S_dz_min",&_S_dz_min);
+	_tree.add("_Ks_dz_min",&_Ks_dz_min);
+	_tree.add("_Lambda_dz_min",&_Lambda_dz_min);
+
+	_tree.add("_deltaR_sumDaughterMomenta_antiSMomentum",&_deltaR_sumDaughterMomenta_antiSMomentum);
+
+	_tree.add("_Ks_openings_angle_displacement_momentum",&_Ks_openings_angle_displacement_momentum);
+	_tree.add("_Lambda_openings_angle_displacement_momentum",&_Lambda_openings_angle_displacement_momentum);
+
+	_tree.add("_S_pt",&_S_pt);
+	_tree.add("_Ks_pt",&_Ks_pt);
+	_tree.add("_Lambda_pt",&_Lambda_pt);
+
+	_tree.add("_S_pz",&_S_pz);
+	_tree.add("_Ks_pz",&_Ks_pz);
+	_tree.add("_Lambda_pz",&_Lambda_pz);
+
+	_tree.add("_S_vx_interaction_vertex",&_S_vx_interaction_vertex);
+	_tree.add("_S_vy_interaction_vertex",&_S_vy_interaction_vertex);
+	_tree.add("_S_vz_interaction_vertex",&_S_vz_interaction_vertex);
+
+	_tree.add("_S_vx",&_S_vx);
+	_tree.add("_S_vy",&_S_vy);
+	_tree.add("_S_vz",&_S_vz);
+
+	_tree.add("_GEN_Ks_daughter0_px",&_GEN_Ks_daughter0_px);
+	_tree.add("_GEN_Ks_daughter0_py",&_GEN_Ks_daughter0_py);
+	_tree.add("_GEN_Ks_daughter0_pz",&_GEN_Ks_daughter0_pz);
+	_tree.add("_GEN_Ks_daughter0_pt",&_GEN_Ks_daughter0_pt);
+	_tree.add("_GEN_Ks_daughter0_eta",&_GEN_Ks_daughter0_eta);
+	_tree.add("_GEN_Ks_daughter0_phi",&_GEN_Ks_daughter0_phi);
+	_tree.add("_GEN_Ks_daughter0_vx",&_GEN_Ks_daughter0_vx);
+	_tree.add("_GEN_Ks_daughter0_vy",&_GEN_Ks_daughter0_vy);
+	_tree.add("_GEN_Ks_daughter0_vz",&_GEN_Ks_daughter0_vz);
+	_tree.add("_GEN_Ks_daughter0_lxy",&_GEN_Ks_daughter0_lxy);
+	_tree.add("_GEN_Ks_daughter0_lxy_zero",&_GEN_Ks_daughter0_lxy_zero);
+	_tree.add("_GEN_Ks_daughter0_dxy",&_GEN_Ks_daughter0_dxy);
+	_tree.add("_GEN_Ks_daughter0_dz",&_GEN_Ks_daughter0_dz);
+	_tree.add("_GEN_Ks_daughter0_openings_angle_displacement_momentum",&_GEN_Ks_daughter0_openings_angle_displacement_momentum);
+
+	_tree.add("_GEN_Ks_daughter1_px",&_GEN_Ks_daughter1_px);
+	_tree.add("_GEN_Ks_daughter1_py",&_GEN_Ks_daughter1_py);
+	_tree.add("_GEN_Ks_daughter1_pz",&_GEN_Ks_daughter1_pz);
+	_tree.add("_GEN_Ks_daughter1_pt",&_GEN_Ks_daughter1_pt);
+	_tree.add("_GEN_Ks_daughter1_eta",&_GEN_Ks_daughter1_eta);
+	_tree.add("_GEN_Ks_daughter1_phi",&_GEN_Ks_daughter1_phi);
+	_tree.add("_GEN_Ks_daughter1_vx",&_GEN_Ks_daughter1_vx);
+	_tree.add("_GEN_Ks_daughter1_vy",&_GEN_Ks_daughter1_vy);
+	_tree.add("_GEN_Ks_daughter1_vz",&_GEN_Ks_daughter1_vz);
+	_tree.add("_GEN_Ks_daughter1_lxy",&_GEN_Ks_daughter1_lxy);
+	_tree.add("_GEN_Ks_daughter1_dxy",&_GEN_Ks_daughter1_dxy);
+	_tree.add("_GEN_Ks_daughter1_dz",&_GEN_Ks_daughter1_dz);
+	_tree.add("_GEN_Ks_daughter1_openings_angle_displacement_momentum",&_GEN_Ks_daughter1_openings_angle_displacement_momentum);
+
+	_tree.add("_GEN_AntiLambda_AntiProton_px",&_GEN_AntiLambda_AntiProton_px);
+	_tree.add("_GEN_AntiLambda_AntiProton_py",&_GEN_AntiLambda_AntiProton_py);
+	_tree.add("_GEN_AntiLambda_AntiProton_pz",&_GEN_AntiLambda_AntiProton_pz);
+	_tree.add("_GEN_AntiLambda_AntiProton_pt",&_GEN_AntiLambda_AntiProton_pt);
+	_tree.add("_GEN_AntiLambda_AntiProton_eta",&_GEN_AntiLambda_AntiProton_eta);
+	_tree.add("_GEN_AntiLambda_AntiProton_phi",&_GEN_AntiLambda_AntiProton_phi);
+	_tree.add("_GEN_AntiLambda_AntiProton_vx",&_GEN_AntiLambda_AntiProton_vx);
+	_tree.add("_GEN_AntiLambda_AntiProton_vy",&_GEN_AntiLambda_AntiProton_vy);
+	_tree.add("_GEN_AntiLambda_AntiProton_vz",&_GEN_AntiLambda_AntiProton_vz);
+	_tree.add("_GEN_AntiLambda_AntiProton_lxy",&_GEN_AntiLambda_AntiProton_lxy);
+	_tree.add("_GEN_AntiLambda_AntiProton_lxy_zero",&_GEN_AntiLambda_AntiProton_lxy_zero);
+	_tree.add("_GEN_AntiLambda_AntiProton_dxy",&_GEN_AntiLambda_AntiProton_dxy);
+	_tree.add("_GEN_AntiLambda_AntiProton_dz",&_GEN_AntiLambda_AntiProton_dz);
+	_tree.add("_GEN_AntiLambda_AntiProton_openings_angle_displacement_momentum",&_GEN_AntiLambda_AntiProton_openings_angle_displacement_momentum);
+
+	_tree.add("_GEN_AntiLambda_Pion_px",&_GEN_AntiLambda_Pion_px);
+	_tree.add("_GEN_AntiLambda_Pion_py",&_GEN_AntiLambda_Pion_py);
+	_tree.add("_GEN_AntiLambda_Pion_pz",&_GEN_AntiLambda_Pion_pz);
+	_tree.add("_GEN_AntiLambda_Pion_pt",&_GEN_AntiLambda_Pion_pt);
+	_tree.add("_GEN_AntiLambda_Pion_eta",&_GEN_AntiLambda_Pion_eta);
+	_tree.add("_GEN_AntiLambda_Pion_phi",&_GEN_AntiLambda_Pion_phi);
+	_tree.add("_GEN_AntiLambda_Pion_vx",&_GEN_AntiLambda_Pion_vx);
+	_tree.add("_GEN_AntiLambda_Pion_vy",&_GEN_AntiLambda_Pion_vy);
+	_tree.add("_GEN_AntiLambda_Pion_vz",&_GEN_AntiLambda_Pion_vz);
+	_tree.add("_GEN_AntiLambda_Pion_lxy",&_GEN_AntiLambda_Pion_lxy);
+	_tree.add("_GEN_AntiLambda_Pion_dxy",&_GEN_AntiLambda_Pion_dxy);
+	_tree.add("_GEN_AntiLambda_Pion_dz",&_GEN_AntiLambda_Pion_dz);
+	_tree.add("_GEN_AntiLambda_Pion_openings_angle_displacement_momentum",&_GEN_AntiLambda_Pion_openings_angle_displacement_momentum);
+
+  	_tree.add("_GEN_Ks_daughter0_numberOfTrackerLayers",&_GEN_Ks_daughter0_numberOfTrackerLayers);
+        _tree.add("_GEN_Ks_daughter1_numberOfTrackerLayers",&_GEN_Ks_daughter1_numberOfTrackerLayers);
+        _tree.add("_GEN_AntiLambda_AntiProton_numberOfTrackerLayers",&_GEN_AntiLambda_AntiProton_numberOfTrackerLayers);
+        _tree.add("_GEN_AntiLambda_Pion_numberOfTrackerLayers",&_GEN_AntiLambda_Pion_numberOfTrackerLayers);
+
+        _tree.add("_GEN_Ks_daughter0_numberOfTrackerHits",&_GEN_Ks_daughter0_numberOfTrackerHits);
+        _tree.add("_GEN_Ks_daughter1_numberOfTrackerHits",&_GEN_Ks_daughter1_numberOfTrackerHits);
+        _tree.add("_GEN_AntiLambda_AntiProton_numberOfTrackerHits",&_GEN_AntiLambda_AntiProton_numberOfTrackerHits);
+        _tree.add("_GEN_AntiLambda_Pion_numberOfTrackerHits",&_GEN_AntiLambda_Pion_numberOfTrackerHits);
 
 
 
@@ -182,13 +188,15 @@ void FlatTreeProducerGENSIM::beginJob() {
 
 void FlatTreeProducerGENSIM::analyze(edm::Event const& iEvent, edm::EventSetup const& iSetup) {
 
+  m_eventId.set(iEvent);
+
   //beamspot
   edm::Handle<reco::BeamSpot> h_bs;
   iEvent.getByToken(m_bsToken, h_bs);
 
-  //primary vertex
-  edm::Handle<vector<reco::Vertex>> h_offlinePV;
-  iEvent.getByToken(m_offlinePVToken, h_offlinePV);
+  //primary vertices, selected by the GoodPVProducer
+  edm::Handle<GoodPrimaryVertices> h_goodPVs;
+  iEvent.getByToken(m_goodPVsToken, h_goodPVs);
 
   //SIM particles: normal Gen particles or PlusGEANT
   edm::Handle<vector<reco::GenParticle>> h_genParticles;
@@ -213,14 +221,7 @@ void FlatTreeProducerGENSIM::analyze(edm::Event const& iEvent, edm::EventSetup c
   }
 
   unsigned int nGoodPV = 0;
-  if(h_offlinePV.isValid()){
-        for(unsigned int i = 0; i < h_offlinePV->size(); i++){
-		double r = sqrt(h_offlinePV->at(i).x()*h_offlinePV->at(i).x()+h_offlinePV->at(i).y()*h_offlinePV->at(i).y());
-                if(h_offlinePV->at(i).ndof() > 4 && abs(h_offlinePV->at(i).z()) < 24 && r < 2){
-                        nGoodPV++;
-                }
-        }
-  }
+  if(h_goodPVs.isValid()) nGoodPV = h_goodPVs->nGoodPVPOG();
 
   //loop over the gen particles, check for this antiS if there are any antiS with the same eta, so duplicates. These duplicates are the result of the looping mechanism.
   //save the number of duplicates in a vector of vectors. Each vector has  as a first element the eta of the antiS and 2nd element the # of antiS with this eta. 
@@ -243,8 +244,7 @@ void FlatTreeProducerGENSIM::analyze(edm::Event const& iEvent, edm::EventSetup c
 	}
 	else{//this is a new antiS
 		nTotalUniqueGenS++;
-		double weight_PU = 0.;
-		if(nGoodPV < AnalyzerAllSteps::v_mapPU.size()) weight_PU = AnalyzerAllSteps::PUReweighingFactor(AnalyzerAllSteps::v_mapPU[nGoodPV],genParticle->vz());
+		double weight_PU = m_PUReweighingTable->weight(nGoodPV,genParticle->vz());
 		nTotalUniqueGenS_weighted = nTotalUniqueGenS_weighted + AnalyzerAllSteps::EventWeightingFactor(genParticle->theta())*weight_PU;
 		vector<float> dummyVec; 
 		dummyVec.push_back(genParticle->eta());
@@ -293,8 +293,7 @@ void FlatTreeProducerGENSIM::analyze(edm::Event const& iEvent, edm::EventSetup c
 
 			bool AntiSReconstructable = false;
 
-			double weight_PU = 0.;
-                	if(nGoodPV < AnalyzerAllSteps::v_mapPU.size()) weight_PU = AnalyzerAllSteps::PUReweighingFactor(AnalyzerAllSteps::v_mapPU[nGoodPV],genParticle->vz());
+			double weight_PU = m_PUReweighingTable->weight(nGoodPV,genParticle->vz());
 			//check if this is a reconstructable antiS, so should have 2 daughters of correct type, each daughter should have 2 daughters with the correct type
 			//the below implicitely neglects the duplitcate antiS due to looping, because only 1 of the duplicates will interact and give daughters. The others do not have any daughters.
 			if(genParticle->numberOfDaughters()==2){
@@ -336,14 +335,13 @@ void FlatTreeProducerGENSIM::analyze(edm::Event const& iEvent, edm::EventSetup c
 		_S_eta_all.push_back(v_antiS_eta_reconstructable[j][0]);
 		_S_reconstructable_all.push_back(v_antiS_eta_reconstructable[j][1]);
 		_S_event_weighting_factor_all.push_back(v_antiS_eta_reconstructable[j][2]);
-		if(nGoodPV < AnalyzerAllSteps::v_mapPU.size()) _S_event_weighting_factor_PU_all.push_back(AnalyzerAllSteps::PUReweighingFactor(AnalyzerAllSteps::v_mapPU[nGoodPV],v_antiS_eta_reconstructable[j][3]));
-        	else _S_event_weighting_factor_PU_all.push_back(0.);
+		_S_event_weighting_factor_PU_all.push_back(m_PUReweighingTable->weight(nGoodPV,v_antiS_eta_reconstructable[j][3]));
 		_S_vz_creation_vertex_all.push_back(v_antiS_eta_reconstructable[j][3]);
 		_S_pt_all.push_back(v_antiS_eta_reconstructable[j][4]);
 		_S_pz_all.push_back(v_antiS_eta_reconstructable[j][5]);
 		_S_nGoodPV_all.push_back(nGoodPV);
 
-		_treeAllAntiS->Fill();
+		_treeAllAntiS.fill();
 
 		_S_eta_all.clear();
 		_S_reconstructable_all.clear();
@@ -400,8 +398,7 @@ bool FlatTreeProducerGENSIM::FillBranchesGENAntiS(const reco::Candidate  * genPa
 	double GENDeltaEtaDaughters = genParticle->daughter(0)->eta()-genParticle->daughter(1)->eta();
 	double GENDeltaRDaughters = pow(GENDeltaPhiDaughters*GENDeltaPhiDaughters+GENDeltaEtaDaughters*GENDeltaEtaDaughters,0.5);
 
-	double weight_PU = 0.;
-	if(nGoodPV < AnalyzerAllSteps::v_mapPU.size()) weight_PU = AnalyzerAllSteps::PUReweighingFactor(AnalyzerAllSteps::v_mapPU[nGoodPV],genParticle->vz());
+	double weight_PU = m_PUReweighingTable->weight(nGoodPV,genParticle->vz());
 	//count the number of AntiS going to fully correct granddaughters and which interact in the beampipe 
 	if(GENLxy_interactionVertex < 2.26){ 
 		nTotalCorrectGENSInteractingInBeampipe++; 
@@ -735,7 +732,7 @@ bool FlatTreeProducerGENSIM::FillBranchesGENAntiS(const reco::Candidate  * genPa
 	_GEN_AntiLambda_AntiProton_numberOfTrackerHits.push_back(AntiLambda_AntiProton_numberOfTrackerHits);
 	_GEN_AntiLambda_Pion_numberOfTrackerHits.push_back(AntiLambda_Pion_numberOfTrackerHits);
 
-  	_tree->Fill();
+  	_tree.fill();
 
 	int cutNumberOfTrackerHits = 7;
 	if(	Ks_daughter0_numberOfTrackerHits >= cutNumberOfTrackerHits && 
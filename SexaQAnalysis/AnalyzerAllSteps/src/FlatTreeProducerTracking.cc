@@ -1,5 +1,7 @@
 #include "../interface/FlatTreeProducerTracking.h"
+#include "FWCore/MessageLogger/interface/MessageLogger.h"
 #include <typeinfo>
+#include <sstream>
 
 // pdg mass constants, I copies (sorry, I know its ugly) a part of the V0Fitter code below to check where the V0 fitting fails for Sbar candidates. The constants defined
 // here are used in this piece of code
@@ -17,7 +19,7 @@ typedef ROOT::Math::SVector<double, 3> SVector3;
 
 FlatTreeProducerTracking::FlatTreeProducerTracking(edm::ParameterSet const& pset):
   m_bsTag(pset.getParameter<edm::InputTag>("beamspot")),
-  m_offlinePVTag(pset.getParameter<edm::InputTag>("offlinePV")),
+  m_goodPVsTag(pset.getParameter<edm::InputTag>("goodPVs")),
   m_genParticlesTag_GEN(pset.getParameter<edm::InputTag>("genCollection_GEN")),
   m_genParticlesTag_SIM_GEANT(pset.getParameter<edm::InputTag>("genCollection_SIM_GEANT")),
   m_generalTracksTag(pset.getParameter<edm::InputTag>("generalTracksCollection")),
@@ -29,7 +31,7 @@ FlatTreeProducerTracking::FlatTreeProducerTracking(edm::ParameterSet const& pset
 //  m_PileupInfoTag(pset.getParameter<edm::InputTag>("PileupInfo")),
 
   m_bsToken    (consumes<reco::BeamSpot>(m_bsTag)),
-  m_offlinePVToken    (consumes<vector<reco::Vertex>>(m_offlinePVTag)),
+  m_goodPVsToken    (consumes<GoodPrimaryVertices>(m_goodPVsTag)),
   m_genParticlesToken_GEN(consumes<vector<reco::GenParticle> >(m_genParticlesTag_GEN)),
   m_genParticlesToken_SIM_GEANT(consumes<vector<reco::GenParticle> >(m_genParticlesTag_SIM_GEANT)),
   //m_generalTracksToken(consumes<vector<reco::Track> >(m_generalTracksTag)),
@@ -38,12 +40,17 @@ FlatTreeProducerTracking::FlatTreeProducerTracking(edm::ParameterSet const& pset
   m_V0KsToken(consumes<vector<reco::VertexCompositeCandidate> >(m_V0KsTag)),
   m_V0LToken(consumes<vector<reco::VertexCompositeCandidate> >(m_V0LTag)),
   m_trackAssociatorToken(consumes<reco::TrackToTrackingParticleAssociator> (m_trackAssociatorTag)),
-  m_TPToken(consumes<vector<TrackingParticle> >(m_TPTag))
+  m_TPToken(consumes<vector<TrackingParticle> >(m_TPTag)),
 //  m_PileupInfoToken(consumes<vector<PileupSummaryInfo> >(m_PileupInfoTag))
+  m_PUReweighingFile(pset.getParameter<edm::FileInPath>("PUReweighingFile"))
   
 
 
 {
+   //the tree with all tracking particles is very heavy, so only fill it on request
+   m_fillTracksTree = pset.getUntrackedParameter<bool>("fillTracksTree");
+   m_associateAntiSGranddaughtersOnly = pset.getUntrackedParameter<bool>("associateAntiSGranddaughtersOnly");
+
    //the below configurations are also for the V0Fitting
 
    useVertex_ = pset.getParameter<bool>("useVertex");
@@ -80,108 +87,120 @@ void FlatTreeProducerTracking::beginJob() {
 	// Initialize when class is created
         edm::Service<TFileService> fs ; 
 
+	//PU reweighing parameters
+	m_PUReweighingTable = PUReweighingTable::get(m_PUReweighingFile.fullPath());
+
+	//cut flow and timing of the V0Fitter steps
+	m_v0FitterCutFlow.book(*fs);
+
 	//PV info
-	_tree_PV = fs->make <TTree>("FlatTreePV","treePV");
-	_tree_PV->Branch("_goodPVxPOG",&_goodPVxPOG);
-	_tree_PV->Branch("_goodPVyPOG",&_goodPVyPOG);
-	_tree_PV->Branch("_goodPVzPOG",&_goodPVzPOG);
-	_tree_PV->Branch("_goodPV_weightPU",&_goodPV_weightPU);
+	_tree_PV.open(*fs, "FlatTreePV", "treePV");
+	m_eventId.addBranches(_tree_PV);
+	_tree_PV.add("_goodPVxPOG",&_goodPVxPOG);
+	_tree_PV.add("_goodPVyPOG",&_goodPVyPOG);
+	_tree_PV.add("_goodPVzPOG",&_goodPVzPOG);
+	_tree_PV.add("_goodPV_weightPU",&_goodPV_weightPU);
 
 	//counting the number of reco antiS and the total number of GEN antiS
-	_tree_counter = fs->make <TTree>("FlatTreeCounter","treeCounter");
-	_tree_counter->Branch("_nGENAntiS",&_nGENAntiS);
-	_tree_counter->Branch("_nRECOAntiS",&_nRECOAntiS);
+	_tree_counter.open(*fs, "FlatTreeCounter", "treeCounter");
+	m_eventId.addBranches(_tree_counter);
+	_tree_counter.add("_nGENAntiS",&_nGENAntiS);
+	_tree_counter.add("_nRECOAntiS",&_nRECOAntiS);
 
 	//tree for all the tracks, normally I don't use this as it way too heavy (there are a looooot of tracks)	
-	_tree_tracks = fs->make <TTree>("FlatTreeTracks","treeTracks");
+	_tree_tracks.open(*fs, "FlatTreeTracks", "treeTracks");
+	m_eventId.addBranches(_tree_tracks);
 	//GEN (trackingparticle) level info
-	_tree_tracks->Branch("_tp_pt",&_tp_pt);
-	_tree_tracks->Branch("_tp_eta",&_tp_eta);
-	_tree_tracks->Branch("_tp_phi",&_tp_phi);
-	_tree_tracks->Branch("_tp_pz",&_tp_pz);
-	_tree_tracks->Branch("_tp_Lxy_beamspot",&_tp_Lxy_beamspot);
-	_tree_tracks->Branch("_tp_vz_beamspot",&_tp_vz_beamspot);
-	_tree_tracks->Branch("_tp_dxy_beamspot",&_tp_dxy_beamspot);
-	_tree_tracks->Branch("_tp_dz_beamspot",&_tp_dz_beamspot);
-	_tree_tracks->Branch("_tp_numberOfTrackerHits",&_tp_numberOfTrackerHits);
-	_tree_tracks->Branch("_tp_charge",&_tp_charge);
-	_tree_tracks->Branch("_tp_reconstructed",&_tp_reconstructed);
-	_tree_tracks->Branch("_tp_isAntiSTrack",&_tp_isAntiSTrack);
-	_tree_tracks->Branch("_tp_etaOfGrandMotherAntiS",&_tp_etaOfGrandMotherAntiS);
+	_tree_tracks.add("_tp_pt",&_tp_pt);
+	_tree_tracks.add("_tp_eta",&_tp_eta);
+	_tree_tracks.add("_tp_phi",&_tp_phi);
+	_tree_tracks.add("_tp_pz",&_tp_pz);
+	_tree_tracks.add("_tp_Lxy_beamspot",&_tp_Lxy_beamspot);
+	_tree_tracks.add("_tp_vz_beamspot",&_tp_vz_beamspot);
+	_tree_tracks.add("_tp_dxy_beamspot",&_tp_dxy_beamspot);
+	_tree_tracks.add("_tp_dz_beamspot",&_tp_dz_beamspot);
+	_tree_tracks.add("_tp_numberOfTrackerHits",&_tp_numberOfTrackerHits);
+	_tree_tracks.add("_tp_charge",&_tp_charge);
+	_tree_tracks.add("_tp_reconstructed",&_tp_reconstructed);
+	_tree_tracks.add("_tp_isAntiSTrack",&_tp_isAntiSTrack);
+	_tree_tracks.add("_tp_etaOfGrandMotherAntiS",&_tp_etaOfGrandMotherAntiS);
 	//RECO (matched to trackingparticle) level info
-	_tree_tracks->Branch("_matchedTrack_pt",&_matchedTrack_pt);
-	_tree_tracks->Branch("_matchedTrack_eta",&_matchedTrack_eta);
-	_tree_tracks->Branch("_matchedTrack_phi",&_matchedTrack_phi);
-	_tree_tracks->Branch("_matchedTrack_pz",&_matchedTrack_pz);
-	_tree_tracks->Branch("_matchedTrack_chi2",&_matchedTrack_chi2);
-	_tree_tracks->Branch("_matchedTrack_ndof",&_matchedTrack_ndof);
-	_tree_tracks->Branch("_matchedTrack_charge",&_matchedTrack_charge);
-	_tree_tracks->Branch("_matchedTrack_dxy_beamspot",&_matchedTrack_dxy_beamspot);
-	_tree_tracks->Branch("_matchedTrack_dz_beamspot",&_matchedTrack_dz_beamspot);
-	_tree_tracks->Branch("_matchedTrack_trackQuality",&_matchedTrack_trackQuality);
-	_tree_tracks->Branch("_matchedTrack_isLooper",&_matchedTrack_isLooper);
+	_tree_tracks.add("_matchedTrack_pt",&_matchedTrack_pt);
+	_tree_tracks.add("_matchedTrack_eta",&_matchedTrack_eta);
+	_tree_tracks.add("_matchedTrack_phi",&_matchedTrack_phi);
+	_tree_tracks.add("_matchedTrack_pz",&_matchedTrack_pz);
+	_tree_tracks.add("_matchedTrack_chi2",&_matchedTrack_chi2);
+	_tree_tracks.add("_matchedTrack_ndof",&_matchedTrack_ndof);
+	_tree_tracks.add("_matchedTrack_charge",&_matchedTrack_charge);
+	_tree_tracks.add("_matchedTrack_dxy_beamspot",&_matchedTrack_dxy_beamspot);
+	_tree_tracks.add("_matchedTrack_dz_beamspot",&_matchedTrack_dz_beamspot);
+	_tree_tracks.add("_matchedTrack_trackQuality",&_matchedTrack_trackQuality);
+	_tree_tracks.add("_matchedTrack_isLooper",&_matchedTrack_isLooper);
 
 	//tree to store the tps in an Sbar event, so for each branch there will be 7 entries in the vector: 0th is the Sbar, 1st is the Ks, 2nd is the Lambda, 
 	//3rd pi+ from Ks, 4th pi- from Ks, 5th pi+ from antiLambda, 6th pi- from antiproton
-	_tree_tpsAntiS = fs->make <TTree>("FlatTreeTpsAntiS","tree_tpsAntiS");
+	_tree_tpsAntiS.open(*fs, "FlatTreeTpsAntiS", "tree_tpsAntiS");
+	m_eventId.addBranches(_tree_tpsAntiS);
 	//GEN (trackingparticle) level info
-	_tree_tpsAntiS->Branch("_tpsAntiS_type",&_tpsAntiS_type);
-	_tree_tpsAntiS->Branch("_tpsAntiS_pdgId",&_tpsAntiS_pdgId);
-	_tree_tpsAntiS->Branch("_tpsAntiS_bestDeltaRWithRECO",&_tpsAntiS_bestDeltaRWithRECO);
-	_tree_tpsAntiS->Branch("_tpsAntiS_deltaLInteractionVertexAntiSmin",&_tpsAntiS_deltaLInteractionVertexAntiSmin);
-	_tree_tpsAntiS->Branch("_tpsAntiS_mass",&_tpsAntiS_mass);
-	_tree_tpsAntiS->Branch("_tpsAntiS_pt",&_tpsAntiS_pt);
-	_tree_tpsAntiS->Branch("_tpsAntiS_eta",&_tpsAntiS_eta);
-	_tree_tpsAntiS->Branch("_tpsAntiS_phi",&_tpsAntiS_phi);
-	_tree_tpsAntiS->Branch("_tpsAntiS_pz",&_tpsAntiS_pz);
-	_tree_tpsAntiS->Branch("_tpsAntiS_Lxy_beampipeCenter",&_tpsAntiS_Lxy_beampipeCenter);
-	_tree_tpsAntiS->Branch("_tpsAntiS_Lxy_beamspot",&_tpsAntiS_Lxy_beamspot);
-	_tree_tpsAntiS->Branch("_tpsAntiS_vz",&_tpsAntiS_vz);
-	_tree_tpsAntiS->Branch("_tpsAntiS_vz_beamspot",&_tpsAntiS_vz_beamspot);
-	_tree_tpsAntiS->Branch("_tpsAntiS_dxy_beamspot",&_tpsAntiS_dxy_beamspot);
-	_tree_tpsAntiS->Branch("_tpsAntiS_dz_beamspot",&_tpsAntiS_dz_beamspot);
-	_tree_tpsAntiS->Branch("_tpsAntiS_dz_AntiSCreationVertex",&_tpsAntiS_dz_AntiSCreationVertex);
-	_tree_tpsAntiS->Branch("_tpsAntiS_dxyTrack_beamspot",&_tpsAntiS_dxyTrack_beamspot);
-	_tree_tpsAntiS->Branch("_tpsAntiS_dzTrack_beamspot",&_tpsAntiS_dzTrack_beamspot);
-	_tree_tpsAntiS->Branch("_tpsAntiS_numberOfTrackerHits",&_tpsAntiS_numberOfTrackerHits);
-	_tree_tpsAntiS->Branch("_tpsAntiS_charge",&_tpsAntiS_charge);
-	_tree_tpsAntiS->Branch("_tpsAntiS_reconstructed",&_tpsAntiS_reconstructed);
+	_tree_tpsAntiS.add("_tpsAntiS_type",&_tpsAntiS_type);
+	_tree_tpsAntiS.add("_tpsAntiS_pdgId",&_tpsAntiS_pdgId);
+	_tree_tpsAntiS.add("_tpsAntiS_bestDeltaRWithRECO",&_tpsAntiS_bestDeltaRWithRECO);
+	_tree_tpsAntiS.add("_tpsAntiS_deltaLInteractionVertexAntiSmin",&_tpsAntiS_deltaLInteractionVertexAntiSmin);
+	_tree_tpsAntiS.add("_tpsAntiS_mass",&_tpsAntiS_mass);
+	_tree_tpsAntiS.add("_tpsAntiS_pt",&_tpsAntiS_pt);
+	_tree_tpsAntiS.add("_tpsAntiS_eta",&_tpsAntiS_eta);
+	_tree_tpsAntiS.add("_tpsAntiS_phi",&_tpsAntiS_phi);
+	_tree_tpsAntiS.add("_tpsAntiS_pz",&_tpsAntiS_pz);
+	_tree_tpsAntiS.add("_tpsAntiS_Lxy_beampipeCenter",&_tpsAntiS_Lxy_beampipeCenter);
+	_tree_tpsAntiS.add("_tpsAntiS_Lxy_beamspot",&_tpsAntiS_Lxy_beamspot);
+	_tree_tpsAntiS.add("_tpsAntiS_vz",&_tpsAntiS_vz);
+	_tree_tpsAntiS.add("_tpsAntiS_vz_beamspot",&_tpsAntiS_vz_beamspot);
+	_tree_tpsAntiS.add("_tpsAntiS_dxy_beamspot",&_tpsAntiS_dxy_beamspot);
+	_tree_tpsAntiS.add("_tpsAntiS_dz_beamspot",&_tpsAntiS_dz_beamspot);
+	_tree_tpsAntiS.add("_tpsAntiS_dz_AntiSCreationVertex",&_tpsAntiS_dz_AntiSCreationVertex);
+	_tree_tpsAntiS.add("_tpsAntiS_dxyTrack_beamspot",&_tpsAntiS_dxyTrack_beamspot);
+	_tree_tpsAntiS.add("_tpsAntiS_dzTrack_beamspot",&_tpsAntiS_dzTrack_beamspot);
+	_tree_tpsAntiS.add("_tpsAntiS_numberOfTrackerHits",&_tpsAntiS_numberOfTrackerHits);
+	_tree_tpsAntiS.add("_tpsAntiS_charge",&_tpsAntiS_charge);
+	_tree_tpsAntiS.add("_tpsAntiS_reconstructed",&_tpsAntiS_reconstructed);
 	//RECO (matched to trackingparticle) level info
-	_tree_tpsAntiS->Branch("_tpsAntiS_bestRECO_mass",&_tpsAntiS_bestRECO_mass);
-	_tree_tpsAntiS->Branch("_tpsAntiS_bestRECO_massMinusNeutron",&_tpsAntiS_bestRECO_massMinusNeutron);
-	_tree_tpsAntiS->Branch("_tpsAntiS_bestRECO_pt",&_tpsAntiS_bestRECO_pt);
-	_tree_tpsAntiS->Branch("_tpsAntiS_bestRECO_eta",&_tpsAntiS_bestRECO_eta);
-	_tree_tpsAntiS->Branch("_tpsAntiS_bestRECO_phi",&_tpsAntiS_bestRECO_phi);
-	_tree_tpsAntiS->Branch("_tpsAntiS_bestRECO_pz",&_tpsAntiS_bestRECO_pz);
-	_tree_tpsAntiS->Branch("_tpsAntiS_bestRECO_Lxy_beampipeCenter",&_tpsAntiS_bestRECO_Lxy_beampipeCenter);
-	_tree_tpsAntiS->Branch("_tpsAntiS_bestRECO_error_Lxy_beampipeCenter",&_tpsAntiS_bestRECO_error_Lxy_beampipeCenter);
-	_tree_tpsAntiS->Branch("_tpsAntiS_bestRECO_Lxy_beamspot",&_tpsAntiS_bestRECO_Lxy_beamspot);
-	_tree_tpsAntiS->Branch("_tpsAntiS_bestRECO_error_Lxy_beamspot",&_tpsAntiS_bestRECO_error_Lxy_beamspot);
-	_tree_tpsAntiS->Branch("_tpsAntiS_bestRECO_vz",&_tpsAntiS_bestRECO_vz);
-	_tree_tpsAntiS->Branch("_tpsAntiS_bestRECO_vz_beamspot",&_tpsAntiS_bestRECO_vz_beamspot);
-	_tree_tpsAntiS->Branch("_tpsAntiS_bestRECO_dxy_beamspot",&_tpsAntiS_bestRECO_dxy_beamspot);
-	_tree_tpsAntiS->Branch("_tpsAntiS_bestRECO_dz_beamspot",&_tpsAntiS_bestRECO_dz_beamspot);
-	_tree_tpsAntiS->Branch("_tpsAntiS_bestRECO_dxyTrack_beamspot",&_tpsAntiS_bestRECO_dxyTrack_beamspot);
-	_tree_tpsAntiS->Branch("_tpsAntiS_bestRECO_dzTrack_beamspot",&_tpsAntiS_bestRECO_dzTrack_beamspot);
-	_tree_tpsAntiS->Branch("_tpsAntiS_bestRECO_charge",&_tpsAntiS_bestRECO_charge);
-	_tree_tpsAntiS->Branch("_tpsAntiS_returnCodeV0Fitter",&_tpsAntiS_returnCodeV0Fitter);
-	_tree_tpsAntiS->Branch("_tpsAntiS_event_weighting_factor",&_tpsAntiS_event_weighting_factor);
-	_tree_tpsAntiS->Branch("_tpsAntiS_event_weighting_factorPU",&_tpsAntiS_event_weighting_factorPU);
+	_tree_tpsAntiS.add("_tpsAntiS_bestRECO_mass",&_tpsAntiS_bestRECO_mass);
+	_tree_tpsAntiS.add("_tpsAntiS_bestRECO_massMinusNeutron",&_tpsAntiS_bestRECO_massMinusNeutron);
+	_tree_tpsAntiS.add("_tpsAntiS_bestRECO_pt",&_tpsAntiS_bestRECO_pt);
+	_tree_tpsAntiS.add("_tpsAntiS_bestRECO_eta",&_tpsAntiS_bestRECO_eta);
+	_tree_tpsAntiS.add("_tpsAntiS_bestRECO_phi",&_tpsAntiS_bestRECO_phi);
+	_tree_tpsAntiS.add("_tpsAntiS_bestRECO_pz",&_tpsAntiS_bestRECO_pz);
+	_tree_tpsAntiS.add("_tpsAntiS_bestRECO_Lxy_beampipeCenter",&_tpsAntiS_bestRECO_Lxy_beampipeCenter);
+	_tree_tpsAntiS.add("_tpsAntiS_bestRECO_error_Lxy_beampipeCenter",&_tpsAntiS_bestRECO_error_Lxy_beampipeCenter);
+	_tree_tpsAntiS.add("_tpsAntiS_bestRECO_Lxy_beamspot",&_tpsAntiS_bestRECO_Lxy_beamspot);
+	_tree_tpsAntiS.add("_tpsAntiS_bestRECO_error_Lxy_beamspot",&_tpsAntiS_bestRECO_error_Lxy_beamspot);
+	_tree_tpsAntiS.add("_tpsAntiS_bestRECO_vz",&_tpsAntiS_bestRECO_vz);
+	_tree_tpsAntiS.add("_tpsAntiS_bestRECO_vz_beamspot",&_tpsAntiS_bestRECO_vz_beamspot);
+	_tree_tpsAntiS.add("_tpsAntiS_bestRECO_dxy_beamspot",&_tpsAntiS_bestRECO_dxy_beamspot);
+	_tree_tpsAntiS.add("_tpsAntiS_bestRECO_dz_beamspot",&_tpsAntiS_bestRECO_dz_beamspot);
+	_tree_tpsAntiS.add("_tpsAntiS_bestRECO_dxyTrack_beamspot",&_tpsAntiS_bestRECO_dxyTrack_beamspot);
+	_tree_tpsAntiS.add("_tpsAntiS_bestRECO_dzTrack_beamspot",&_tpsAntiS_bestRECO_dzTrack_beamspot);
+	_tree_tpsAntiS.add("_tpsAntiS_bestRECO_charge",&_tpsAntiS_bestRECO_charge);
+	_tree_tpsAntiS.add("_tpsAntiS_returnCodeV0Fitter",&_tpsAntiS_returnCodeV0Fitter);
+	_tree_tpsAntiS.add("_tpsAntiS_event_weighting_factor",&_tpsAntiS_event_weighting_factor);
+	_tree_tpsAntiS.add("_tpsAntiS_event_weighting_factorPU",&_tpsAntiS_event_weighting_factorPU);
 
 }
 
 void FlatTreeProducerTracking::analyze(edm::Event const& iEvent, edm::EventSetup const& iSetup) {
 
+  m_eventId.set(iEvent);
+
  
   //beamspot
   edm::Handle<reco::BeamSpot> h_bs;
   iEvent.getByToken(m_bsToken, h_bs);
   const reco::BeamSpot* theBeamSpot = h_bs.product();
 
-  //primary vertex
-  edm::Handle<vector<reco::Vertex>> h_offlinePV;
-  iEvent.getByToken(m_offlinePVToken, h_offlinePV);
-  int nPVs = h_offlinePV->size(); 
+  //primary vertices, selected by the GoodPVProducer
+  edm::Handle<GoodPrimaryVertices> h_goodPVs;
+  iEvent.getByToken(m_goodPVsToken, h_goodPVs);
+  int nPVs = h_goodPVs->nVertices; 
 
   //SIM particles: normal Gen particles or PlusGEANT
   edm::Handle<vector<reco::GenParticle>> h_genParticles;
@@ -221,29 +240,21 @@ void FlatTreeProducerTracking::analyze(edm::Event const& iEvent, edm::EventSetup
   //save some info on the PVs
   InitPV();
   unsigned int nGoodPV = 0;
-  if(h_offlinePV.isValid()){
-
-	//first count the number of good vertices
-	for(unsigned int i = 0; i < h_offlinePV->size(); i++){
-		double r = sqrt(h_offlinePV->at(i).x()*h_offlinePV->at(i).x()+h_offlinePV->at(i).y()*h_offlinePV->at(i).y());
-                if(h_offlinePV->at(i).ndof() > 4 && abs(h_offlinePV->at(i).z()) < 24 && r < 2)nGoodPV++;
-	}
-
-	//now that you know the good number of vertices store the location of the vertex and the reweighing factor (you need the nGoodPV to calculate the weighing factor)
-	for(unsigned int i = 0; i < h_offlinePV->size(); i++){
-		double r = sqrt(h_offlinePV->at(i).x()*h_offlinePV->at(i).x()+h_offlinePV->at(i).y()*h_offlinePV->at(i).y());
-                if(h_offlinePV->at(i).ndof() > 4 && abs(h_offlinePV->at(i).z()) < 24 && r < 2){
-			_goodPVxPOG.push_back(h_offlinePV->at(i).x());
-                        _goodPVyPOG.push_back(h_offlinePV->at(i).y());
-                        _goodPVzPOG.push_back(h_offlinePV->at(i).z());
-			double weightPU = 0.;
-			if(nGoodPV < AnalyzerAllSteps::v_mapPU.size()) weightPU = AnalyzerAllSteps::PUReweighingFactor(AnalyzerAllSteps::v_mapPU[nGoodPV], h_offlinePV->at(i).z());
-        		_goodPV_weightPU.push_back(weightPU);
-		}
+  if(h_goodPVs.isValid()){
+
+	//the reweighing factor needs the number of good vertices, which the GoodPVProducer already counted
+	const PrimaryVertexArrays& goodPVsPOG = h_goodPVs->goodPOG;
+	nGoodPV = goodPVsPOG.size();
+	for(unsigned int i = 0; i < goodPVsPOG.size(); i++){
+		_goodPVxPOG.push_back(goodPVsPOG.x[i]);
+		_goodPVyPOG.push_back(goodPVsPOG.y[i]);
+		_goodPVzPOG.push_back(goodPVsPOG.z[i]);
+		double weightPU = m_PUReweighingTable->weight(nGoodPV,goodPVsPOG.z[i]);
+		_goodPV_weightPU.push_back(weightPU);
 	}
 	
   }
-  _tree_PV->Fill();
+  _tree_PV.fill();
 
   //beamspot
   TVector3 beamspot(0,0,0);
@@ -283,8 +294,7 @@ void FlatTreeProducerTracking::analyze(edm::Event const& iEvent, edm::EventSetup
 			v_antiS_momenta_and_itt[duplicateIt][1]++;
 	}
 	else{//this is a new antiS
-		double weight_PU = 0.;
-		if(nGoodPV < AnalyzerAllSteps::v_mapPU.size()) weight_PU = AnalyzerAllSteps::PUReweighingFactor(AnalyzerAllSteps::v_mapPU[nGoodPV],genParticle->vz());
+		double weight_PU = m_PUReweighingTable->weight(nGoodPV,genParticle->vz());
 		nTotalUniqueGenS_weighted = nTotalUniqueGenS_weighted + AnalyzerAllSteps::EventWeightingFactor(genParticle->theta())*weight_PU;
 		nTotalUniqueGenS_Nonweighted = nTotalUniqueGenS_Nonweighted + 1;
 		vector<float> dummyVec; 
@@ -295,62 +305,51 @@ void FlatTreeProducerTracking::analyze(edm::Event const& iEvent, edm::EventSetup
 
 	}
   }
-  std::cout << "In this event found " << v_antiS_momenta_and_itt.size() << " unique AntiS, with following #duplicates: " << std::endl;
+  std::ostringstream uniqueAntiS;
   for(unsigned int j = 0; j<v_antiS_momenta_and_itt.size();j++){
-	std::cout << v_antiS_momenta_and_itt[j][1] << " with eta " << v_antiS_momenta_and_itt[j][0] << std::endl;
+	uniqueAntiS << "\n" << v_antiS_momenta_and_itt[j][1] << " with eta " << v_antiS_momenta_and_itt[j][0];
+  }
+  LogDebug("FlatTreeProducerTracking") << "In this event found " << v_antiS_momenta_and_itt.size() << " unique AntiS, with following #duplicates: " << uniqueAntiS.str();
+  //the mother-daughter relations of the trackingparticles, built once for this event
+  if(h_TP.isValid()) m_tpAncestry.build(TPColl);
+
+  //to do the trackmatching on hits, done once for this event and used for all trackingparticles.
+  //Without the tracks tree only the antiS granddaughters are ever looked up, so then only those tps are associated to the tracks, which is much cheaper than associating the full tp collection
+  reco::SimToRecoCollection simRecColl;
+  if(h_generalTracks.isValid() && h_TP.isValid() && h_trackAssociator.isValid()){
+	if(m_associateAntiSGranddaughtersOnly && !m_fillTracksTree){
+		TrackingParticleRefVector antiSGranddaughterTPs;
+		for(unsigned int i : m_tpAncestry.antiSGranddaughters()) antiSGranddaughterTPs.push_back(TrackingParticleRef(h_TP,i));
+		if(!antiSGranddaughterTPs.empty()) simRecColl = h_trackAssociator->associateSimToReco(h_generalTracks->refVector(),antiSGranddaughterTPs);
+	}
+	else simRecColl = std::move(h_trackAssociator->associateSimToReco(h_generalTracks,h_TP));
   }
-//evaluate tracking performance, the below part works, but normally I do not use it, because this tree is very heavy
-/*  if(h_generalTracks.isValid() && h_TP.isValid() && h_trackAssociator.isValid()){
+
+//evaluate tracking performance for all charged trackingparticles. This tree is very heavy, so it is only filled when fillTracksTree is set
+  if(m_fillTracksTree && h_generalTracks.isValid() && h_TP.isValid() && h_trackAssociator.isValid()){
 	for(size_t i=0; i<TPColl.size(); ++i) {
-	  //first investigate whether this tp is a dauhgter of an AntiS. You need this because these granddaughter tracks you want to investigate separately from the rest of the tracks. 
 	  const TrackingParticle& tp = TPColl[i];
-	  std::vector<double> tpIsGrandDaughterAntiS = AnalyzerAllSteps::isTpGrandDaughterAntiS(TPColl, tp);
-	  //std::cout << "---------------------------" << std::endl;
-	  //std::cout << "tp pdgId: " << tp.pdgId() << std::endl;
-	  //std::cout << "tp is a granddaughter of an antiS " << tpIsGrandDaughterAntiS << std::endl;
+	  if(tp.charge() == 0) continue;
 	  bool matchingTrackFound = false;
 	  const reco::Track *matchedTrackPointer = nullptr;
 	  TrackingParticleRef tpr(h_TP,i);
-	  edm::Handle<reco::TrackToTrackingParticleAssociator> theAssociator;
-	  reco::SimToRecoCollection simRecCollL;
-	  reco::SimToRecoCollection const * simRecCollP=nullptr;
-	  simRecCollL = std::move(h_trackAssociator->associateSimToReco(h_generalTracks,h_TP));
-	  simRecCollP = &simRecCollL;
-          reco::SimToRecoCollection const & simRecColl = *simRecCollP;
 
 	  if(simRecColl.find(tpr) != simRecColl.end()){
 		  auto const & rt = simRecColl[tpr];
 		  if (rt.size()!=0) {
-		    // isRecoMatched = true; // UNUSED
 		    matchedTrackPointer = rt.begin()->first.get();
 		    matchingTrackFound  = true;
-		    //std::cout << "found a matching track with quality: " << matchedTrackQuality << std::endl;
-	  	    //std::cout << "Track matching result: " << matchingTrackFound << " ,for a GEN track with a pt of " << tpr->pt() << " and a RECO matched track with a pt of " << matchedTrackPointer->pt() << std::endl;	
 		  }
-	  }else{
-		    //std::cout << "no matching track found" << std::endl;
-		    matchingTrackFound = false;
 	  }
         
-	//fill the tree for all charged particles, so this will also be charged particles from the antiS, but you save in the trees which ones are from the antiS, but in this tree one entry is just one track, so you loose the knowledge of which tp belong to the same antiS, that is why I fill also a second tree as below.
-	if(tp.charge() != 0 )FillTreesTracks(tp, beamspot, nPVs, matchedTrackPointer, matchingTrackFound,tpIsGrandDaughterAntiS);
-
-	  //now in the above two catagories you are missing all the tracks from the antiS granddaughters, so when you encounter an antiS you should still have to fill four it's 4 potential granddaughters the histograms and also one where you count how many antiS have four granddaughters reconstructed
-	  //if(tp.pdgId() == AnalyzerAllSteps::pdgIdAntiS)FillHistosAntiSTracks(tp, beamspot, TPColl,  h_TP, h_trackAssociator, h_generalTracks, h_V0Ks, h_V0L);
+	//fill the tree for all charged particles, so this will also be charged particles from the antiS, but you save in the trees which ones are from the antiS (granddaughter type from the ancestry index), but in this tree one entry is just one track, so you loose the knowledge of which tp belong to the same antiS, that is why I fill also a second tree as below.
+	FillTreesTracks(tp, beamspot, nPVs, matchedTrackPointer, matchingTrackFound, m_tpAncestry.antiSGranddaughterType(i), m_tpAncestry.etaOfGrandMotherAntiS(i));
 	}
   }
-*/
 
 //fill a second tree: one entry in this tree will have the parameters of the antiS, the parameters of the daughters and the parameters of the granddaughters. And will check if they were reconstructed or not. 
   if(h_generalTracks.isValid() && h_TP.isValid() && h_trackAssociator.isValid() && h_V0Ks.isValid() && h_V0L.isValid()){
 
-	//to do the trackmatching on hits
-	reco::SimToRecoCollection simRecCollL;
-	reco::SimToRecoCollection const * simRecCollP=nullptr;
-	simRecCollL= std::move(h_trackAssociator->associateSimToReco(h_generalTracks,h_TP));
-	simRecCollP= &simRecCollL;
-	reco::SimToRecoCollection const & simRecColl= *simRecCollP;
-
 	//some counters
 	int nUniqueAntiSInThisEvent = 0;
 	int nUniqueAntiSWithCorrectGranddaughtersThisEvent = 0;
@@ -393,7 +392,7 @@ void FlatTreeProducerTracking::analyze(edm::Event const& iEvent, edm::EventSetup
 } //end of analyzer
 
 //for all possible tracks
-void FlatTreeProducerTracking::FillTreesTracks(const TrackingParticle& tp, TVector3 beamspot, int nPVs, const reco::Track *matchedTrackPointer, bool matchingTrackFound, std::vector<double> tpIsGrandDaughterAntiS){
+void FlatTreeProducerTracking::FillTreesTracks(const TrackingParticle& tp, TVector3 beamspot, int nPVs, const reco::Track *matchedTrackPointer, bool matchingTrackFound, int antiSGranddaughterType, double etaOfGrandMotherAntiS){
 
 	math::XYZPoint beamspotPoint(beamspot.X(),beamspot.Y(),beamspot.Z());
 
@@ -419,9 +418,9 @@ void FlatTreeProducerTracking::FillTreesTracks(const TrackingParticle& tp, TVect
 	_tp_charge.push_back(tp.charge());
 
 	_tp_reconstructed.push_back(matchingTrackFound);
-	_tp_isAntiSTrack.push_back(tpIsGrandDaughterAntiS[0]);
+	_tp_isAntiSTrack.push_back(antiSGranddaughterType);
 
-	_tp_etaOfGrandMotherAntiS.push_back(tpIsGrandDaughterAntiS[1]);
+	_tp_etaOfGrandMotherAntiS.push_back(etaOfGrandMotherAntiS);
 
 	//save also the information of the actual reconstructed track if the tp was matched to a track
 	if(matchingTrackFound){
@@ -460,7 +459,7 @@ void FlatTreeProducerTracking::FillTreesTracks(const TrackingParticle& tp, TVect
 
 	}
 
-	_tree_tracks->Fill();
+	_tree_tracks.fill();
 
 }
 
@@ -485,48 +484,33 @@ int FlatTreeProducerTracking::FillTreesAntiSAndDaughters(const TrackingParticle&
 
 	int numberOfGranddaughtersFoundThisEvent = 0;
 	
-	tv_iterator antiS_firstDecayVertex = tp.decayVertices_begin();
-	double antisDecayVx = (**antiS_firstDecayVertex).position().X(); double antisDecayVy = (**antiS_firstDecayVertex).position().Y(); double antisDecayVz = (**antiS_firstDecayVertex).position().Z();
-
-	//the trackingparticles do not have mother-daughter relations stored, so have to go through all tps and try to find onderlapping decay and creation vertices.
-        for(size_t j=0; j<TPColl.size(); ++j) {//now find the daughters which have a production vertex = decay vertex of the antiS
+	//the trackingparticles do not have mother-daughter relations stored, the ancestry index of this event gives the tps with a production vertex overlapping with the decay vertex of the mother.
+        for(unsigned int j : m_tpAncestry.daughters(tp)) {//the daughters have a production vertex = decay vertex of the antiS
 
                 const TrackingParticle& tp_daughter = TPColl[j];
 
                 if(abs(tp_daughter.pdgId()) == AnalyzerAllSteps::pdgIdKs || tp_daughter.pdgId() == AnalyzerAllSteps::pdgIdAntiLambda){//daughter has to be a Ks or Lambda
 
-			double daughterProductionVx = tp_daughter.vx(); double daughterProductionVy = tp_daughter.vy(); double daughterProductionVz = tp_daughter.vz();
-
-                        if(antisDecayVx == daughterProductionVx && antisDecayVy == daughterProductionVy &&  antisDecayVz == daughterProductionVz){//daughter prod vertex has to match the mother decay
-
-				//save the daughter:
-				if( abs(tp_daughter.pdgId()) == AnalyzerAllSteps::pdgIdKs ) tp_Ks = tp_daughter;
-				if( tp_daughter.pdgId() == AnalyzerAllSteps::pdgIdAntiLambda ) tp_AntiLambda = tp_daughter;
-
-				tv_iterator tp_daughter_firstDecayVertex = tp_daughter.decayVertices_begin();
-				double daughterdecayVx = (**tp_daughter_firstDecayVertex).position().X(); double daughterdecayVy = (**tp_daughter_firstDecayVertex).position().Y(); double daughterdecayVz = (**tp_daughter_firstDecayVertex).position().Z();
+			//save the daughter:
+			if( abs(tp_daughter.pdgId()) == AnalyzerAllSteps::pdgIdKs ) tp_Ks = tp_daughter;
+			if( tp_daughter.pdgId() == AnalyzerAllSteps::pdgIdAntiLambda ) tp_AntiLambda = tp_daughter;
 
-                                for(unsigned int k=0; k<TPColl.size(); ++k) {
+                        for(unsigned int k : m_tpAncestry.daughters(tp_daughter)) {//the granddaughters have a production vertex = decay vertex of the daughter
 
-                                        const TrackingParticle& tp_granddaughter = TPColl[k];
+                                const TrackingParticle& tp_granddaughter = TPColl[k];
 
-                                        if(tp_granddaughter.pdgId() == AnalyzerAllSteps::pdgIdPosPion || tp_granddaughter.pdgId() == AnalyzerAllSteps::pdgIdNegPion || tp_granddaughter.pdgId() == AnalyzerAllSteps::pdgIdAntiProton){
-                                                double granddaughterProductionVx = tp_granddaughter.vx(); double granddaughterProductionVy = tp_granddaughter.vy();double granddaughterProductionVz= tp_granddaughter.vz();
-
-                                                if(daughterdecayVx == granddaughterProductionVx && daughterdecayVy == granddaughterProductionVy && daughterdecayVz == granddaughterProductionVz){
-							//save the granddaughters
-							if(abs(tp_daughter.pdgId()) == AnalyzerAllSteps::pdgIdKs && tp_granddaughter.pdgId() == AnalyzerAllSteps::pdgIdPosPion){ tp_Ks_posPion = tp_granddaughter;numberOfGranddaughtersFoundThisEvent++;tp_it_Ks_posPion = k;}
-							if(abs(tp_daughter.pdgId()) == AnalyzerAllSteps::pdgIdKs && tp_granddaughter.pdgId() == AnalyzerAllSteps::pdgIdNegPion){ tp_Ks_negPion = tp_granddaughter;numberOfGranddaughtersFoundThisEvent++;tp_it_Ks_negPion = k;}
-							if( tp_daughter.pdgId() == AnalyzerAllSteps::pdgIdAntiLambda && tp_granddaughter.pdgId() == AnalyzerAllSteps::pdgIdPosPion){ tp_AntiLambda_posPion = tp_granddaughter;numberOfGranddaughtersFoundThisEvent++;tp_it_AntiLambda_posPion = k;}
-							if( tp_daughter.pdgId() == AnalyzerAllSteps::pdgIdAntiLambda && tp_granddaughter.pdgId() == AnalyzerAllSteps::pdgIdAntiProton){ tp_AntiLambda_AntiProton = tp_granddaughter;numberOfGranddaughtersFoundThisEvent++;tp_it_AntiLambda_AntiProton = k;}
-                                                }
-                                        }//end if good granddaughter
-                                }//end loop over the tp to find granddaughter
-                        }// end check if antiS decay vertex matches daughter production vertex
+                                if(tp_granddaughter.pdgId() == AnalyzerAllSteps::pdgIdPosPion || tp_granddaughter.pdgId() == AnalyzerAllSteps::pdgIdNegPion || tp_granddaughter.pdgId() == AnalyzerAllSteps::pdgIdAntiProton){
+					//save the granddaughters
+					if(abs(tp_daughter.pdgId()) == AnalyzerAllSteps::pdgIdKs && tp_granddaughter.pdgId() == AnalyzerAllSteps::pdgIdPosPion){ tp_Ks_posPion = tp_granddaughter;numberOfGranddaughtersFoundThisEvent++;tp_it_Ks_posPion = k;}
+					if(abs(tp_daughter.pdgId()) == AnalyzerAllSteps::pdgIdKs && tp_granddaughter.pdgId() == AnalyzerAllSteps::pdgIdNegPion){ tp_Ks_negPion = tp_granddaughter;numberOfGranddaughtersFoundThisEvent++;tp_it_Ks_negPion = k;}
+					if( tp_daughter.pdgId() == AnalyzerAllSteps::pdgIdAntiLambda && tp_granddaughter.pdgId() == AnalyzerAllSteps::pdgIdPosPion){ tp_AntiLambda_posPion = tp_granddaughter;numberOfGranddaughtersFoundThisEvent++;tp_it_AntiLambda_posPion = k;}
+					if( tp_daughter.pdgId() == AnalyzerAllSteps::pdgIdAntiLambda && tp_granddaughter.pdgId() == AnalyzerAllSteps::pdgIdAntiProton){ tp_AntiLambda_AntiProton = tp_granddaughter;numberOfGranddaughtersFoundThisEvent++;tp_it_AntiLambda_AntiProton = k;}
+                                }//end if good granddaughter
+                        }//end loop over the granddaughters
                 }//end check for pdgId daughter
-        }//end loop over tp to find daughters
+        }//end loop over the daughters
 
-	std::cout << "number trackingParticle granddaughters found in this event: " << numberOfGranddaughtersFoundThisEvent << std::endl;
+	LogDebug("FlatTreeProducerTracking") << "number trackingParticle granddaughters found in this event: " << numberOfGranddaughtersFoundThisEvent;
 
 	//now only when there are 4 correct tp granddaughters found you have the chance to actually reconstruct them, so save only those events in the tree
 	if(tp_it_Ks_posPion == -1 || tp_it_Ks_negPion == -1 || tp_it_AntiLambda_posPion == -1 || tp_it_AntiLambda_AntiProton == -1) return -1;
@@ -738,8 +722,7 @@ int FlatTreeProducerTracking::FillTreesAntiSAndDaughters(const TrackingParticle&
 	//calculate the weight parameter for the pathlength through the beampipe and the reweighing for the PV
 	double weightBeampipe = AnalyzerAllSteps::EventWeightingFactor(tp.theta());
 	_tpsAntiS_event_weighting_factor.push_back(weightBeampipe);
-	double weightPV = 0.;
-	if(nGoodPV < AnalyzerAllSteps::v_mapPU.size()) weightPV = AnalyzerAllSteps::PUReweighingFactor(AnalyzerAllSteps::v_mapPU[nGoodPV],tp.vz());
+	double weightPV = m_PUReweighingTable->weight(nGoodPV,tp.vz());
 	_tpsAntiS_event_weighting_factorPU.push_back(weightPV);
 
 	if(bestMatchingAntiS>-1){//for the antiS just save a few extras, which you do not save for the other particles:
@@ -792,7 +775,7 @@ int FlatTreeProducerTracking::FillTreesAntiSAndDaughters(const TrackingParticle&
 	if(matchedTrackPointer_AntiLambda_AntiProton)FillFlatTreeTpsAntiSRECO(beamspot,beamspotPoint,RECOAntiLambda_AntiProtonFound,6,matchedTrackPointer_AntiLambda_AntiProton);
 	else FillFlatTreeTpsAntiSRECODummy();
 
-	_tree_tpsAntiS->Fill();
+	_tree_tpsAntiS.fill();
 
 
 	if(RECOAntiSFound) weighedRecoAntiS  += weightBeampipe*weightPV; 
@@ -950,13 +933,21 @@ int FlatTreeProducerTracking::V0Fitter_trackSelection(const reco::Track *matched
       double ipsigXY = std::abs(tmpTrack->dxy(*theBeamSpot)/tmpTrack->dxyError());
       double ipsigZ = std::abs(tmpTrack->dz(theBeamSpot->position())/tmpTrack->dzError());
 
+      bool failed[V0FitterCutFlow::nTrackCuts];
+      failed[V0FitterCutFlow::trackChi2] = tmpTrack->normalizedChi2() >=  tkChi2Cut_;
+      failed[V0FitterCutFlow::trackNHits] = tmpTrack->numberOfValidHits() < tkNHitsCut_;
+      failed[V0FitterCutFlow::trackPt] = tmpTrack->pt() <= tkPtCut_;
+      failed[V0FitterCutFlow::trackIPSigXY] = ipsigXY <= tkIPSigXYCut_;
+      failed[V0FitterCutFlow::trackIPSigZ] = ipsigZ <= tkIPSigZCut_;
+      m_v0FitterCutFlow.track(failed);
+
       //save the result of the cut in a string
       std::string cut1,cut2,cut3,cut4,cut5 = "0"; 
-      if (tmpTrack->normalizedChi2() >=  tkChi2Cut_) cut1 = "1";
-      if (tmpTrack->numberOfValidHits() < tkNHitsCut_) cut2 = "1";
-      if (tmpTrack->pt() <= tkPtCut_ ) cut3 = "1";
-      if (ipsigXY <= tkIPSigXYCut_) cut4 = "1";
-      if (ipsigZ <= tkIPSigZCut_) cut5 = "1";
+      if (failed[V0FitterCutFlow::trackChi2]) cut1 = "1";
+      if (failed[V0FitterCutFlow::trackNHits]) cut2 = "1";
+      if (failed[V0FitterCutFlow::trackPt]) cut3 = "1";
+      if (failed[V0FitterCutFlow::trackIPSigXY]) cut4 = "1";
+      if (failed[V0FitterCutFlow::trackIPSigZ]) cut5 = "1";
 
       std::string cutSummary = cut1+cut2+cut3+cut4+cut5;
       int intCutSummary = std::stoi(cutSummary, nullptr, 2);
@@ -964,14 +955,24 @@ int FlatTreeProducerTracking::V0Fitter_trackSelection(const reco::Track *matched
 
 }
 
-//this is a stupid copy paste from the V0Fitter code in CMSSSW
+//V0Fitter with the accounting of its return code and of the time spent in every step
 int FlatTreeProducerTracking::V0Fitter(const reco::Track *matchedTrackPointer1, const reco::Track *matchedTrackPointer2, const reco::BeamSpot* theBeamSpot, const MagneticField* theMagneticField, bool isGENKs, bool isGENLambda, bool isGENAntiLambda){
+
+	m_v0FitterCutFlow.begin();
+	int returnCode = V0FitterSteps(matchedTrackPointer1, matchedTrackPointer2, theBeamSpot, theMagneticField, isGENKs, isGENLambda, isGENAntiLambda);
+	m_v0FitterCutFlow.end(returnCode);
+	return returnCode;
+}
+
+//this is a stupid copy paste from the V0Fitter code in CMSSSW, after every step the step is marked as passed in the cut flow
+int FlatTreeProducerTracking::V0FitterSteps(const reco::Track *matchedTrackPointer1, const reco::Track *matchedTrackPointer2, const reco::BeamSpot* theBeamSpot, const MagneticField* theMagneticField, bool isGENKs, bool isGENLambda, bool isGENAntiLambda){
       
         math::XYZPoint referencePos(theBeamSpot->position());
 
 	if(matchedTrackPointer1->charge() == matchedTrackPointer2->charge()) return 1;
 	if(abs(matchedTrackPointer1->charge()) != 1) return 2;
 	if(abs(matchedTrackPointer2->charge()) != 1) return 3;
+	m_v0FitterCutFlow.passed(V0FitterCutFlow::charge);
 
 
 	reco::Track positiveTrack;
@@ -990,24 +991,28 @@ int FlatTreeProducerTracking::V0Fitter(const reco::Track *matchedTrackPointer1,
 
       // measure distance between tracks at their closest approach
       if (!posTransTkPtr->impactPointTSCP().isValid() || !negTransTkPtr->impactPointTSCP().isValid()) return 4;
+      m_v0FitterCutFlow.passed(V0FitterCutFlow::impactPoint);
       FreeTrajectoryState const & posState = posTransTkPtr->impactPointTSCP().theState();
       FreeTrajectoryState const & negState = negTransTkPtr->impactPointTSCP().theState();
       ClosestApproachInRPhi cApp;
       cApp.calculate(posState, negState);
       if (!cApp.status()) return 5;
       float dca = std::abs(cApp.distance());
-      std::cout << "the distance of closest approach of the tracks: " << dca << std::endl;
+      LogDebug("V0FitterDCA") << "the distance of closest approach of the tracks: " << dca;
       if (dca > tkDCACut_) return 6;
+      m_v0FitterCutFlow.passed(V0FitterCutFlow::closestApproach);
 
       // the POCA should at least be in the sensitive volume
       GlobalPoint cxPt = cApp.crossingPoint();
       if (sqrt(cxPt.x()*cxPt.x() + cxPt.y()*cxPt.y()) > 120. || std::abs(cxPt.z()) > 300.) return 7;
+      m_v0FitterCutFlow.passed(V0FitterCutFlow::POCA);
 
       // the tracks should at least point in the same quadrant
       TrajectoryStateClosestToPoint const & posTSCP = posTransTkPtr->trajectoryStateClosestToPoint(cxPt);
       TrajectoryStateClosestToPoint const & negTSCP = negTransTkPtr->trajectoryStateClosestToPoint(cxPt);
       if (!posTSCP.isValid() || !negTSCP.isValid()) return 8;
       if (posTSCP.momentum().dot(negTSCP.momentum())  < 0) return 9;
+      m_v0FitterCutFlow.passed(V0FitterCutFlow::quadrant);
      
       // calculate mPiPi
       double totalE = sqrt(posTSCP.momentum().mag2() + piMassSquared) + sqrt(negTSCP.momentum().mag2() + piMassSquared);
@@ -1015,6 +1020,7 @@ int FlatTreeProducerTracking::V0Fitter(const reco::Track *matchedTrackPointer1,
       double totalPSq = (posTSCP.momentum() + negTSCP.momentum()).mag2();
       double mass = sqrt(totalESq - totalPSq);
       if (mass > mPiPiCut_) return 10;
+      m_v0FitterCutFlow.passed(V0FitterCutFlow::mPiPi);
 
       // Fill the vector of TransientTracks to send to KVF
       std::vector<reco::TransientTrack> transTracks;
@@ -1033,9 +1039,11 @@ int FlatTreeProducerTracking::V0Fitter(const reco::Track *matchedTrackPointer1,
          theRecoVertex = theAdaptiveFitter.vertex(transTracks);
       }
       if (!theRecoVertex.isValid()) return 11;
+      m_v0FitterCutFlow.passed(V0FitterCutFlow::vertexFit);
      
       reco::Vertex theVtx = theRecoVertex;
       if (theVtx.normalizedChi2() > vtxChi2Cut_) return 12;
+      m_v0FitterCutFlow.passed(V0FitterCutFlow::vertexChi2);
       GlobalPoint vtxPos(theVtx.x(), theVtx.y(), theVtx.z());
 
       // 2D decay significance
@@ -1053,6 +1061,7 @@ int FlatTreeProducerTracking::V0Fitter(const reco::Track *matchedTrackPointer1,
       double distMagXYZ = ROOT::Math::Mag(distVecXYZ);
       double sigmaDistMagXYZ = sqrt(ROOT::Math::Similarity(totalCov, distVecXYZ)) / distMagXYZ;
       if (distMagXYZ/sigmaDistMagXYZ < vtxDecaySigXYZCut_) return 14;
+      m_v0FitterCutFlow.passed(V0FitterCutFlow::decaySignificance);
 
       //comment the below part because also in my reconstruction I donnot use it
       /*
@@ -1096,6 +1105,7 @@ int FlatTreeProducerTracking::V0Fitter(const reco::Track *matchedTrackPointer1,
       }
 
       if (trajPlus.get() == 0 || trajMins.get() == 0 || !trajPlus->isValid() || !trajMins->isValid()) return 16;
+      m_v0FitterCutFlow.passed(V0FitterCutFlow::trajectoriesAtVertex);
 
       GlobalVector positiveP(trajPlus->momentum());
       GlobalVector negativeP(trajMins->momentum());
@@ -1114,6 +1124,7 @@ int FlatTreeProducerTracking::V0Fitter(const reco::Track *matchedTrackPointer1,
       double pz = totalP.z();
       double angleXYZ = (dx*px+dy*py+dz*pz)/(sqrt(dx*dx+dy*dy+dz*dz)*sqrt(px*px+py*py+pz*pz));
       if (angleXYZ < cosThetaXYZCut_) return 18;
+      m_v0FitterCutFlow.passed(V0FitterCutFlow::pointingAngle);
 
       // calculate total energy of V0 3 ways: assume it's a kShort, a Lambda, or a LambdaBar.
       double piPlusE = sqrt(positiveP.mag2() + piMassSquared);
@@ -1320,6 +1331,10 @@ void FlatTreeProducerTracking::InitTrackingAntiS(){
 
 void FlatTreeProducerTracking::endJob()
 {
+	m_v0FitterCutFlow.fill();
+	std::ostringstream summary;
+	m_v0FitterCutFlow.print(summary);
+	edm::LogPrint("V0FitterCutFlow") << summary.str();
 }
 
 void
@@ -1368,7 +1383,7 @@ FlatTreeProducerTracking::~FlatTreeProducerTracking()
 	_nRECOAntiS.clear();
 	_nGENAntiS.push_back(nTotalUniqueGenS_weighted);
 	_nRECOAntiS.push_back(weighedRecoAntiS);
-	_tree_counter->Fill();
+	_tree_counter.fill();
 
 	std::cout << "non weighed number of generated antiS (unique): " << nTotalUniqueGenS_Nonweighted << std::endl;
 	std::cout << "non weighed number of reconstructed antiS: " << nonweighedRecoAntiS << std::endl;
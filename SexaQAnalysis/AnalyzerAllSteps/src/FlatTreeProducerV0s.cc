@@ -3,11 +3,18 @@
 
 typedef math::XYZTLorentzVector LorentzVector;
 
+//append a feature of all the V0s of the event to its output column in one go
+static void appendColumn(std::vector<float>& column, const std::vector<double>& values){
+	column.insert(column.end(), values.begin(), values.end());
+}
+
 FlatTreeProducerV0s::FlatTreeProducerV0s(edm::ParameterSet const& pset):
   m_lookAtAntiS(pset.getUntrackedParameter<bool>("lookAtAntiS")),
   m_runningOnData(pset.getUntrackedParameter<bool>("runningOnData")),
   m_bsTag(pset.getParameter<edm::InputTag>("beamspot")),
   m_offlinePVTag(pset.getParameter<edm::InputTag>("offlinePV")),
+  m_goodPVsTag(pset.getParameter<edm::InputTag>("goodPVs")),
+  m_eventSummaryTag(pset.getParameter<edm::InputTag>("eventSummary")),
   m_genParticlesTag_GEN(pset.getParameter<edm::InputTag>("genCollection_GEN")),
   m_genParticlesTag_SIM_GEANT(pset.getParameter<edm::InputTag>("genCollection_SIM_GEANT")),
   //m_generalTracksTag(pset.getParameter<edm::InputTag>("generalTracksCollection")),
@@ -16,10 +23,13 @@ FlatTreeProducerV0s::FlatTreeProducerV0s(edm::ParameterSet const& pset):
   m_V0LTag(pset.getParameter<edm::InputTag>("V0LCollection")),
   m_muonsTag(pset.getParameter<edm::InputTag>("muonsCollection")),
   m_jetsTag(pset.getParameter<edm::InputTag>("jetsCollection")),
+  m_nHardConeJets(pset.getParameter<unsigned int>("nHardConeJets")),
 
 
   m_bsToken    (consumes<reco::BeamSpot>(m_bsTag)),
   m_offlinePVToken    (consumes<vector<reco::Vertex>>(m_offlinePVTag)),
+  m_goodPVsToken    (consumes<GoodPrimaryVertices>(m_goodPVsTag)),
+  m_eventSummaryToken(consumes<EventSummary>(m_eventSummaryTag)),
   m_genParticlesToken_GEN(consumes<vector<reco::GenParticle> >(m_genParticlesTag_GEN)),
   m_genParticlesToken_SIM_GEANT(consumes<vector<reco::GenParticle> >(m_genParticlesTag_SIM_GEANT)),
   //m_generalTracksToken(consumes<vector<reco::Track> >(m_generalTracksTag)),
@@ -27,7 +37,8 @@ FlatTreeProducerV0s::FlatTreeProducerV0s(edm::ParameterSet const& pset):
   m_V0KsToken(consumes<vector<reco::VertexCompositeCandidate> >(m_V0KsTag)),
   m_V0LToken(consumes<vector<reco::VertexCompositeCandidate> >(m_V0LTag)),
   m_muonsToken(consumes<vector<reco::Muon>  >(m_muonsTag)),
-  m_jetsToken(consumes<vector<reco::PFJet>  >(m_jetsTag))
+  m_jetsToken(consumes<vector<reco::PFJet>  >(m_jetsTag)),
+  m_flatTreeLayout(FlatTreeWriter::layout(pset.getUntrackedParameter<std::string>("flatTreeLayout")))
 
 
 
@@ -44,143 +55,156 @@ void FlatTreeProducerV0s::beginJob() {
         edm::Service<TFileService> fs ;
 
 	//for the GEN Ks: just fill tree with few variables so you have an idea if the GEN Ks are really correctly modeuled
-	_tree_GEN_Ks = fs->make <TTree>("FlatTreeGENKs","treeGENKs");
-	_tree_GEN_Ks->Branch("_GEN_Ks_mass",&_GEN_Ks_mass);
-	_tree_GEN_Ks->Branch("_GEN_Ks_pt",&_GEN_Ks_pt);
+	_tree_GEN_Ks.open(*fs, "FlatTreeGENKs", "treeGENKs");
+	m_eventId.addBranches(_tree_GEN_Ks);
+	_tree_GEN_Ks.add("_GEN_Ks_mass",&_GEN_Ks_mass);
+	_tree_GEN_Ks.add("_GEN_Ks_pt",&_GEN_Ks_pt);
         
 	//for the Ks
-	_tree_Ks = fs->make <TTree>("FlatTreeKs","treeKs");
-	_tree_Ks->Branch("_Ks_mass",&_Ks_mass);
-	_tree_Ks->Branch("_Ks_pt",&_Ks_pt);
-	_tree_Ks->Branch("_Ks_pz",&_Ks_pz);
-	_tree_Ks->Branch("_Ks_Lxy",&_Ks_Lxy);
-	_tree_Ks->Branch("_Ks_vz",&_Ks_vz);
-	_tree_Ks->Branch("_Ks_eta",&_Ks_eta);
-	_tree_Ks->Branch("_Ks_phi",&_Ks_phi);
-	_tree_Ks->Branch("_Ks_dxy_beamspot",&_Ks_dxy_beamspot);
-	_tree_Ks->Branch("_Ks_dxy_min_PV",&_Ks_dxy_min_PV);
-	_tree_Ks->Branch("_Ks_dxy_PV0",&_Ks_dxy_PV0);
-	_tree_Ks->Branch("_Ks_dxy_000",&_Ks_dxy_000);
-	_tree_Ks->Branch("_Ks_dz_beamspot",&_Ks_dz_beamspot);
-	_tree_Ks->Branch("_Ks_dz_min_PV",&_Ks_dz_min_PV);
-	_tree_Ks->Branch("_Ks_dz_PV0",&_Ks_dz_PV0);
-	_tree_Ks->Branch("_Ks_dz_000",&_Ks_dz_000);
-	_tree_Ks->Branch("_Ks_vz_dz_min_PV",&_Ks_vz_dz_min_PV);
-	_tree_Ks->Branch("_Ks_deltaRBestMatchingGENParticle",&_Ks_deltaRBestMatchingGENParticle);
-	_tree_Ks->Branch("_Ks_trackPair_mindeltaR",&_Ks_trackPair_mindeltaR);
-	_tree_Ks->Branch("_Ks_trackPair_mass",&_Ks_trackPair_mass);
-	_tree_Ks->Branch("_Ks_Track1Track2_openingsAngle",&_Ks_Track1Track2_openingsAngle);
-	_tree_Ks->Branch("_Ks_Track1Track2_deltaR",&_Ks_Track1Track2_deltaR);
-	_tree_Ks->Branch("_Ks_Track1_openingsAngle",&_Ks_Track1_openingsAngle);
-	_tree_Ks->Branch("_Ks_Track2_openingsAngle",&_Ks_Track2_openingsAngle);
-	_tree_Ks->Branch("_Ks_Track1_deltaR",&_Ks_Track1_deltaR);
-	_tree_Ks->Branch("_Ks_Track2_deltaR",&_Ks_Track2_deltaR);
-	_tree_Ks->Branch("_Ks_daughterTrack1_charge",&_Ks_daughterTrack1_charge);
-	_tree_Ks->Branch("_Ks_daughterTrack1_chi2",&_Ks_daughterTrack1_chi2);
-	_tree_Ks->Branch("_Ks_daughterTrack1_ndof",&_Ks_daughterTrack1_ndof);
-	_tree_Ks->Branch("_Ks_daughterTrack1_eta",&_Ks_daughterTrack1_eta);
-	_tree_Ks->Branch("_Ks_daughterTrack1_phi",&_Ks_daughterTrack1_phi);
-	_tree_Ks->Branch("_Ks_daughterTrack1_pt",&_Ks_daughterTrack1_pt);
-	_tree_Ks->Branch("_Ks_daughterTrack1_pz",&_Ks_daughterTrack1_pz);
-	_tree_Ks->Branch("_Ks_daughterTrack1_dxy_beamspot",&_Ks_daughterTrack1_dxy_beamspot);
-	_tree_Ks->Branch("_Ks_daughterTrack1_dz_beamspot",&_Ks_daughterTrack1_dz_beamspot);
-	_tree_Ks->Branch("_Ks_daughterTrack1_dz_min_PV",&_Ks_daughterTrack1_dz_min_PV);
-	_tree_Ks->Branch("_Ks_daughterTrack1_dz_PV0",&_Ks_daughterTrack1_dz_PV0);
-	_tree_Ks->Branch("_Ks_daughterTrack1_dz_000",&_Ks_daughterTrack1_dz_000);
-	_tree_Ks->Branch("_Ks_daughterTrack2_charge",&_Ks_daughterTrack2_charge);
-	_tree_Ks->Branch("_Ks_daughterTrack2_chi2",&_Ks_daughterTrack2_chi2);
-	_tree_Ks->Branch("_Ks_daughterTrack2_ndof",&_Ks_daughterTrack2_ndof);
-	_tree_Ks->Branch("_Ks_daughterTrack2_eta",&_Ks_daughterTrack2_eta);
-	_tree_Ks->Branch("_Ks_daughterTrack2_phi",&_Ks_daughterTrack2_phi);
-	_tree_Ks->Branch("_Ks_daughterTrack2_pt",&_Ks_daughterTrack2_pt);
-	_tree_Ks->Branch("_Ks_daughterTrack2_pz",&_Ks_daughterTrack2_pz);
-	_tree_Ks->Branch("_Ks_daughterTrack2_dxy_beamspot",&_Ks_daughterTrack2_dxy_beamspot);
-	_tree_Ks->Branch("_Ks_daughterTrack2_dz_beamspot",&_Ks_daughterTrack2_dz_beamspot);
-	_tree_Ks->Branch("_Ks_daughterTrack2_dz_min_PV",&_Ks_daughterTrack2_dz_min_PV);
-	_tree_Ks->Branch("_Ks_daughterTrack2_dz_PV0",&_Ks_daughterTrack2_dz_PV0);
-	_tree_Ks->Branch("_Ks_daughterTrack2_dz_000",&_Ks_daughterTrack2_dz_000);
+	_tree_Ks.open(*fs, "FlatTreeKs", "treeKs", m_flatTreeLayout);
+	m_eventId.addBranches(_tree_Ks);
+	_tree_Ks.add("_Ks_index",&_Ks_index);
+	_tree_Ks.add("_Ks_mass",&_Ks_mass);
+	_tree_Ks.add("_Ks_pt",&_Ks_pt);
+	_tree_Ks.add("_Ks_pz",&_Ks_pz);
+	_tree_Ks.add("_Ks_Lxy",&_Ks_Lxy);
+	_tree_Ks.add("_Ks_vz",&_Ks_vz);
+	_tree_Ks.add("_Ks_eta",&_Ks_eta);
+	_tree_Ks.add("_Ks_phi",&_Ks_phi);
+	_tree_Ks.add("_Ks_dxy_beamspot",&_Ks_dxy_beamspot);
+	_tree_Ks.add("_Ks_dxy_min_PV",&_Ks_dxy_min_PV);
+	_tree_Ks.add("_Ks_dxy_PV0",&_Ks_dxy_PV0);
+	_tree_Ks.add("_Ks_dxy_000",&_Ks_dxy_000);
+	_tree_Ks.add("_Ks_dz_beamspot",&_Ks_dz_beamspot);
+	_tree_Ks.add("_Ks_dz_min_PV",&_Ks_dz_min_PV);
+	_tree_Ks.add("_Ks_dz_PV0",&_Ks_dz_PV0);
+	_tree_Ks.add("_Ks_dz_000",&_Ks_dz_000);
+	_tree_Ks.add("_Ks_vz_dz_min_PV",&_Ks_vz_dz_min_PV);
+	_tree_Ks.add("_Ks_deltaRBestMatchingGENParticle",&_Ks_deltaRBestMatchingGENParticle);
+	_tree_Ks.add("_Ks_trackPair_mindeltaR",&_Ks_trackPair_mindeltaR);
+	_tree_Ks.add("_Ks_trackPair_mass",&_Ks_trackPair_mass);
+	_tree_Ks.add("_Ks_Track1Track2_openingsAngle",&_Ks_Track1Track2_openingsAngle);
+	_tree_Ks.add("_Ks_Track1Track2_deltaR",&_Ks_Track1Track2_deltaR);
+	_tree_Ks.add("_Ks_Track1_openingsAngle",&_Ks_Track1_openingsAngle);
+	_tree_Ks.add("_Ks_Track2_openingsAngle",&_Ks_Track2_openingsAngle);
+	_tree_Ks.add("_Ks_Track1_deltaR",&_Ks_Track1_deltaR);
+	_tree_Ks.add("_Ks_Track2_deltaR",&_Ks_Track2_deltaR);
+	_tree_Ks.add("_Ks_daughterTrack1_charge",&_Ks_daughterTrack1_charge);
+	_tree_Ks.add("_Ks_daughterTrack1_chi2",&_Ks_daughterTrack1_chi2);
+	_tree_Ks.add("_Ks_daughterTrack1_ndof",&_Ks_daughterTrack1_ndof);
+	_tree_Ks.add("_Ks_daughterTrack1_eta",&_Ks_daughterTrack1_eta);
+	_tree_Ks.add("_Ks_daughterTrack1_phi",&_Ks_daughterTrack1_phi);
+	_tree_Ks.add("_Ks_daughterTrack1_pt",&_Ks_daughterTrack1_pt);
+	_tree_Ks.add("_Ks_daughterTrack1_pz",&_Ks_daughterTrack1_pz);
+	_tree_Ks.add("_Ks_daughterTrack1_dxy_beamspot",&_Ks_daughterTrack1_dxy_beamspot);
+	_tree_Ks.add("_Ks_daughterTrack1_dz_beamspot",&_Ks_daughterTrack1_dz_beamspot);
+	_tree_Ks.add("_Ks_daughterTrack1_dz_min_PV",&_Ks_daughterTrack1_dz_min_PV);
+	_tree_Ks.add("_Ks_daughterTrack1_dz_PV0",&_Ks_daughterTrack1_dz_PV0);
+	_tree_Ks.add("_Ks_daughterTrack1_dz_000",&_Ks_daughterTrack1_dz_000);
+	_tree_Ks.add("_Ks_daughterTrack2_charge",&_Ks_daughterTrack2_charge);
+	_tree_Ks.add("_Ks_daughterTrack2_chi2",&_Ks_daughterTrack2_chi2);
+	_tree_Ks.add("_Ks_daughterTrack2_ndof",&_Ks_daughterTrack2_ndof);
+	_tree_Ks.add("_Ks_daughterTrack2_eta",&_Ks_daughterTrack2_eta);
+	_tree_Ks.add("_Ks_daughterTrack2_phi",&_Ks_daughterTrack2_phi);
+	_tree_Ks.add("_Ks_daughterTrack2_pt",&_Ks_daughterTrack2_pt);
+	_tree_Ks.add("_Ks_daughterTrack2_pz",&_Ks_daughterTrack2_pz);
+	_tree_Ks.add("_Ks_daughterTrack2_dxy_beamspot",&_Ks_daughterTrack2_dxy_beamspot);
+	_tree_Ks.add("_Ks_daughterTrack2_dz_beamspot",&_Ks_daughterTrack2_dz_beamspot);
+	_tree_Ks.add("_Ks_daughterTrack2_dz_min_PV",&_Ks_daughterTrack2_dz_min_PV);
+	_tree_Ks.add("_Ks_daughterTrack2_dz_PV0",&_Ks_daughterTrack2_dz_PV0);
+	_tree_Ks.add("_Ks_daughterTrack2_dz_000",&_Ks_daughterTrack2_dz_000);
 
 	//for the Lambda
-        _tree_Lambda = fs->make <TTree>("FlatTreeLambda","treeLambda");
-	_tree_Lambda->Branch("_Lambda_mass",&_Lambda_mass);
-	_tree_Lambda->Branch("_Lambda_pt",&_Lambda_pt);
-	_tree_Lambda->Branch("_Lambda_pz",&_Lambda_pz);
-	_tree_Lambda->Branch("_Lambda_Lxy",&_Lambda_Lxy);
-	_tree_Lambda->Branch("_Lambda_vz",&_Lambda_vz);
-	_tree_Lambda->Branch("_Lambda_eta",&_Lambda_eta);
-	_tree_Lambda->Branch("_Lambda_phi",&_Lambda_phi);
-	_tree_Lambda->Branch("_Lambda_dxy_beamspot",&_Lambda_dxy_beamspot);
-	_tree_Lambda->Branch("_Lambda_dxy_min_PV",&_Lambda_dxy_min_PV);
-	_tree_Lambda->Branch("_Lambda_dxy_PV0",&_Lambda_dxy_PV0);
-	_tree_Lambda->Branch("_Lambda_dxy_000",&_Lambda_dxy_000);
-	_tree_Lambda->Branch("_Lambda_dz_beamspot",&_Lambda_dz_beamspot);
-	_tree_Lambda->Branch("_Lambda_dz_min_PV",&_Lambda_dz_min_PV);
-	_tree_Lambda->Branch("_Lambda_dz_PV0",&_Lambda_dz_PV0);
-	_tree_Lambda->Branch("_Lambda_dz_000",&_Lambda_dz_000);
-	_tree_Lambda->Branch("_Lambda_vz_dz_min_PV",&_Lambda_vz_dz_min_PV);
-	_tree_Lambda->Branch("_Lambda_deltaRBestMatchingGENParticle",&_Lambda_deltaRBestMatchingGENParticle);
-	_tree_Lambda->Branch("_Lambda_trackPair_mindeltaR",&_Lambda_trackPair_mindeltaR);
-	_tree_Lambda->Branch("_Lambda_trackPair_mass",&_Lambda_trackPair_mass);
-	_tree_Lambda->Branch("_Lambda_Track1Track2_openingsAngle",&_Lambda_Track1Track2_openingsAngle);
-	_tree_Lambda->Branch("_Lambda_Track1Track2_deltaR",&_Lambda_Track1Track2_deltaR);
-	_tree_Lambda->Branch("_Lambda_Track1_openingsAngle",&_Lambda_Track1_openingsAngle);
-	_tree_Lambda->Branch("_Lambda_Track2_openingsAngle",&_Lambda_Track2_openingsAngle);
-	_tree_Lambda->Branch("_Lambda_Track1_deltaR",&_Lambda_Track1_deltaR);
-	_tree_Lambda->Branch("_Lambda_Track2_deltaR",&_Lambda_Track2_deltaR);
-	_tree_Lambda->Branch("_Lambda_daughterTrack1_charge",&_Lambda_daughterTrack1_charge);
-	_tree_Lambda->Branch("_Lambda_daughterTrack1_chi2",&_Lambda_daughterTrack1_chi2);
-	_tree_Lambda->Branch("_Lambda_daughterTrack1_ndof",&_Lambda_daughterTrack1_ndof);
-	_tree_Lambda->Branch("_Lambda_daughterTrack1_eta",&_Lambda_daughterTrack1_eta);
-	_tree_Lambda->Branch("_Lambda_daughterTrack1_phi",&_Lambda_daughterTrack1_phi);
-	_tree_Lambda->Branch("_Lambda_daughterTrack1_pt",&_Lambda_daughterTrack1_pt);
-	_tree_Lambda->Branch("_Lambda_daughterTrack1_pz",&_Lambda_daughterTrack1_pz);
-	_tree_Lambda->Branch("_Lambda_daughterTrack1_dxy_beamspot",&_Lambda_daughterTrack1_dxy_beamspot);
-	_tree_Lambda->Branch("_Lambda_daughterTrack1_dz_beamspot",&_Lambda_daughterTrack1_dz_beamspot);
-	_tree_Lambda->Branch("_Lambda_daughterTrack1_dz_min_PV",&_Lambda_daughterTrack1_dz_min_PV);
-	_tree_Lambda->Branch("_Lambda_daughterTrack1_dz_PV0",&_Lambda_daughterTrack1_dz_PV0);
-	_tree_Lambda->Branch("_Lambda_daughterTrack1_dz_000",&_Lambda_daughterTrack1_dz_000);
-	_tree_Lambda->Branch("_Lambda_daughterTrack2_charge",&_Lambda_daughterTrack2_charge);
-	_tree_Lambda->Branch("_Lambda_daughterTrack2_chi2",&_Lambda_daughterTrack2_chi2);
-	_tree_Lambda->Branch("_Lambda_daughterTrack2_ndof",&_Lambda_daughterTrack2_ndof);
-	_tree_Lambda->Branch("_Lambda_daughterTrack2_eta",&_Lambda_daughterTrack2_eta);
-	_tree_Lambda->Branch("_Lambda_daughterTrack2_phi",&_Lambda_daughterTrack2_phi);
-	_tree_Lambda->Branch("_Lambda_daughterTrack2_pt",&_Lambda_daughterTrack2_pt);
-	_tree_Lambda->Branch("_Lambda_daughterTrack2_pz",&_Lambda_daughterTrack2_pz);
-	_tree_Lambda->Branch("_Lambda_daughterTrack2_dxy_beamspot",&_Lambda_daughterTrack2_dxy_beamspot);
-	_tree_Lambda->Branch("_Lambda_daughterTrack2_dz_beamspot",&_Lambda_daughterTrack2_dz_beamspot);
-	_tree_Lambda->Branch("_Lambda_daughterTrack2_dz_min_PV",&_Lambda_daughterTrack2_dz_min_PV);
-	_tree_Lambda->Branch("_Lambda_daughterTrack2_dz_PV0",&_Lambda_daughterTrack2_dz_PV0);
-	_tree_Lambda->Branch("_Lambda_daughterTrack2_dz_000",&_Lambda_daughterTrack2_dz_000);
+        _tree_Lambda.open(*fs, "FlatTreeLambda", "treeLambda", m_flatTreeLayout);
+	m_eventId.addBranches(_tree_Lambda);
+	_tree_Lambda.add("_Lambda_index",&_Lambda_index);
+	_tree_Lambda.add("_Lambda_mass",&_Lambda_mass);
+	_tree_Lambda.add("_Lambda_pt",&_Lambda_pt);
+	_tree_Lambda.add("_Lambda_pz",&_Lambda_pz);
+	_tree_Lambda.add("_Lambda_Lxy",&_Lambda_Lxy);
+	_tree_Lambda.add("_Lambda_vz",&_Lambda_vz);
+	_tree_Lambda.add("_Lambda_eta",&_Lambda_eta);
+	_tree_Lambda.add("_Lambda_phi",&_Lambda_phi);
+	_tree_Lambda.add("_Lambda_dxy_beamspot",&_Lambda_dxy_beamspot);
+	_tree_Lambda.add("_Lambda_dxy_min_PV",&_Lambda_dxy_min_PV);
+	_tree_Lambda.add("_Lambda_dxy_PV0",&_Lambda_dxy_PV0);
+	_tree_Lambda.add("_Lambda_dxy_000",&_Lambda_dxy_000);
+	_tree_Lambda.add("_Lambda_dz_beamspot",&_Lambda_dz_beamspot);
+	_tree_Lambda.add("_Lambda_dz_min_PV",&_Lambda_dz_min_PV);
+	_tree_Lambda.add("_Lambda_dz_PV0",&_Lambda_dz_PV0);
+	_tree_Lambda.add("_Lambda_dz_000",&_Lambda_dz_000);
+	_tree_Lambda.add("_Lambda_vz_dz_min_PV",&_Lambda_vz_dz_min_PV);
+	_tree_Lambda.add("_Lambda_deltaRBestMatchingGENParticle",&_Lambda_deltaRBestMatchingGENParticle);
+	_tree_Lambda.add("_Lambda_trackPair_mindeltaR",&_Lambda_trackPair_mindeltaR);
+	_tree_Lambda.add("_Lambda_trackPair_mass",&_Lambda_trackPair_mass);
+	_tree_Lambda.add("_Lambda_Track1Track2_openingsAngle",&_Lambda_Track1Track2_openingsAngle);
+	_tree_Lambda.add("_Lambda_Track1Track2_deltaR",&_Lambda_Track1Track2_deltaR);
+	_tree_Lambda.add("_Lambda_Track1_openingsAngle",&_Lambda_Track1_openingsAngle);
+	_tree_Lambda.add("_Lambda_Track2_openingsAngle",&_Lambda_Track2_openingsAngle);
+	_tree_Lambda.add("_Lambda_Track1_deltaR",&_Lambda_Track1_deltaR);
+	_tree_Lambda.add("_Lambda_Track2_deltaR",&_Lambda_Track2_deltaR);
+	_tree_Lambda.add("_Lambda_daughterTrack1_charge",&_Lambda_daughterTrack1_charge);
+	_tree_Lambda.add("_Lambda_daughterTrack1_chi2",&_Lambda_daughterTrack1_chi2);
+	_tree_Lambda.add("_Lambda_daughterTrack1_ndof",&_Lambda_daughterTrack1_ndof);
+	_tree_Lambda.add("_Lambda_daughterTrack1_eta",&_Lambda_daughterTrack1_eta);
+	_tree_Lambda.add("_Lambda_daughterTrack1_phi",&_Lambda_daughterTrack1_phi);
+	_tree_Lambda.add("_Lambda_daughterTrack1_pt",&_Lambda_daughterTrack1_pt);
+	_tree_Lambda.add("_Lambda_daughterTrack1_pz",&_Lambda_daughterTrack1_pz);
+	_tree_Lambda.add("_Lambda_daughterTrack1_dxy_beamspot",&_Lambda_daughterTrack1_dxy_beamspot);
+	_tree_Lambda.add("_Lambda_daughterTrack1_dz_beamspot",&_Lambda_daughterTrack1_dz_beamspot);
+	_tree_Lambda.add("_Lambda_daughterTrack1_dz_min_PV",&_Lambda_daughterTrack1_dz_min_PV);
+	_tree_Lambda.add("_Lambda_daughterTrack1_dz_PV0",&_Lambda_daughterTrack1_dz_PV0);
+	_tree_Lambda.add("_Lambda_daughterTrack1_dz_000",&_Lambda_daughterTrack1_dz_000);
+	_tree_Lambda.add("_Lambda_daughterTrack2_charge",&_Lambda_daughterTrack2_charge);
+	_tree_Lambda.add("_Lambda_daughterTrack2_chi2",&_Lambda_daughterTrack2_chi2);
+	_tree_Lambda.add("_Lambda_daughterTrack2_ndof",&_Lambda_daughterTrack2_ndof);
+	_tree_Lambda.add("_Lambda_daughterTrack2_eta",&_Lambda_daughterTrack2_eta);
+	_tree_Lambda.add("_Lambda_daughterTrack2_phi",&_Lambda_daughterTrack2_phi);
+	_tree_Lambda.add("_Lambda_daughterTrack2_pt",&_Lambda_daughterTrack2_pt);
+	_tree_Lambda.add("_Lambda_daughterTrack2_pz",&_Lambda_daughterTrack2_pz);
+	_tree_Lambda.add("_Lambda_daughterTrack2_dxy_beamspot",&_Lambda_daughterTrack2_dxy_beamspot);
+	_tree_Lambda.add("_Lambda_daughterTrack2_dz_beamspot",&_Lambda_daughterTrack2_dz_beamspot);
+	_tree_Lambda.add("_Lambda_daughterTrack2_dz_min_PV",&_Lambda_daughterTrack2_dz_min_PV);
+	_tree_Lambda.add("_Lambda_daughterTrack2_dz_PV0",&_Lambda_daughterTrack2_dz_PV0);
+	_tree_Lambda.add("_Lambda_daughterTrack2_dz_000",&_Lambda_daughterTrack2_dz_000);
 
 	//for the Z
-        _tree_Z = fs->make <TTree>("FlatTreeZ","treeZ");
-        _tree_Z->Branch("_Z_mass",&_Z_mass);
-        _tree_Z->Branch("_Z_dz_PV_muon1",&_Z_dz_PV_muon1);
-        _tree_Z->Branch("_Z_dz_PV_muon2",&_Z_dz_PV_muon2);
-        _tree_Z->Branch("_Z_ptMuMu",&_Z_ptMuMu);
+        _tree_Z.open(*fs, "FlatTreeZ", "treeZ");
+	m_eventId.addBranches(_tree_Z);
+        _tree_Z.add("_Z_mass",&_Z_mass);
+        _tree_Z.add("_Z_dz_PV_muon1",&_Z_dz_PV_muon1);
+        _tree_Z.add("_Z_dz_PV_muon2",&_Z_dz_PV_muon2);
+        _tree_Z.add("_Z_ptMuMu",&_Z_ptMuMu);
 
 	//for the PV 
-        _tree_PV = fs->make <TTree>("FlatTreePV","treePV");
-        _tree_PV->Branch("_PV_n",&_PV_n);
-        _tree_PV->Branch("_PV0_lxy",&_PV0_lxy);
-        _tree_PV->Branch("_PV0_vz",&_PV0_vz);
+        _tree_PV.open(*fs, "FlatTreePV", "treePV");
+	m_eventId.addBranches(_tree_PV);
+        _tree_PV.add("_PV_n",&_PV_n);
+        _tree_PV.add("_PV0_lxy",&_PV0_lxy);
+        _tree_PV.add("_PV0_vz",&_PV0_vz);
 
         //for the beamspot
-        _tree_beamspot = fs->make <TTree>("FlatTreeBeamspot","treeBeamspot");
-        _tree_beamspot->Branch("_beampot_lxy",&_beampot_lxy);
-        _tree_beamspot->Branch("_beampot_vz",&_beampot_vz);
+        _tree_beamspot.open(*fs, "FlatTreeBeamspot", "treeBeamspot");
+	m_eventId.addBranches(_tree_beamspot);
+        _tree_beamspot.add("_beampot_lxy",&_beampot_lxy);
+        _tree_beamspot.add("_beampot_vz",&_beampot_vz);
 
 	//some generalities:
-	_tree_general = fs->make <TTree>("FlatTreeGeneral","treeGeneral");
-	_tree_general->Branch("_general_triggerFired_HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ",&_general_triggerFired_HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ);
-	_tree_general->Branch("_general_triggerFired_HLT_Mu17_TrkIsoVVL_TkMu8_TrkIsoVVL_DZ",&_general_triggerFired_HLT_Mu17_TrkIsoVVL_TkMu8_TrkIsoVVL_DZ);
-	_tree_general->Branch("_general_eventTrackMultiplicity",&_general_eventTrackMultiplicity);
-	_tree_general->Branch("_general_eventTrackMultiplicity_highPurity",&_general_eventTrackMultiplicity_highPurity);
+	_tree_general.open(*fs, "FlatTreeGeneral", "treeGeneral");
+	m_eventId.addBranches(_tree_general);
+	m_eventSummary.addBranches(_tree_general);
+	_tree_general.add("_general_triggerFired_HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ",&_general_triggerFired_HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ);
+	_tree_general.add("_general_triggerFired_HLT_Mu17_TrkIsoVVL_TkMu8_TrkIsoVVL_DZ",&_general_triggerFired_HLT_Mu17_TrkIsoVVL_TkMu8_TrkIsoVVL_DZ);
+	_tree_general.add("_general_eventTrackMultiplicity",&_general_eventTrackMultiplicity);
+	_tree_general.add("_general_eventTrackMultiplicity_highPurity",&_general_eventTrackMultiplicity_highPurity);
 	
 }
 
 void FlatTreeProducerV0s::analyze(edm::Event const& iEvent, edm::EventSetup const& iSetup) {
 
+  m_eventId.set(iEvent);
+  m_eventSummary.set(iEvent, m_eventSummaryToken);
+
 
   //beamspot
   edm::Handle<reco::BeamSpot> h_bs;
@@ -190,10 +214,22 @@ void FlatTreeProducerV0s::analyze(edm::Event const& iEvent, edm::EventSetup cons
   edm::Handle<vector<reco::Vertex>> h_offlinePV;
   iEvent.getByToken(m_offlinePVToken, h_offlinePV);
 
+  //primary vertices, selected by the GoodPVProducer
+  edm::Handle<GoodPrimaryVertices> h_goodPVs;
+  iEvent.getByToken(m_goodPVsToken, h_goodPVs);
+
   //SIM particles: normal Gen particles or PlusGEANT
   edm::Handle<vector<reco::GenParticle>> h_genParticles;
   iEvent.getByToken(m_genParticlesToken_GEN, h_genParticles);
   //iEvent.getByToken(m_genParticlesToken_SIM_GEANT, h_genParticles);
+  if(h_genParticles.isValid()){
+	m_genKs.build(*h_genParticles);
+	m_genLambda.build(*h_genParticles);
+  }
+  else{
+	m_genKs.clear();
+	m_genLambda.clear();
+  }
 
   //General tracks particles
   //edm::Handle<vector<reco::Track>> h_generalTracks;
@@ -220,6 +256,10 @@ void FlatTreeProducerV0s::analyze(edm::Event const& iEvent, edm::EventSetup cons
   edm::Handle<vector<reco::PFJet> > h_jets;
   iEvent.getByToken(m_jetsToken, h_jets);
 
+  //jets with pt above 30 GeV, highest pt first, which can contaminate the transverse region. Selected once per event on indices, so the jets are not copied and their pt is not recomputed for every muon pair
+  std::vector<unsigned int> hardConeJetIndices;
+  if(h_jets.isValid()) sexaq::topKIndices(*h_jets, m_nHardConeJets, [](const reco::PFJet& jet){ return jet.pt(); }, hardConeJetIndices, 30.);
+
   //trigger information
   edm::Handle< pat::PackedTriggerPrescales > triggerPrescales;
   edm::Handle< edm::TriggerResults > HLTResHandle;
@@ -229,10 +269,8 @@ void FlatTreeProducerV0s::analyze(edm::Event const& iEvent, edm::EventSetup cons
 
   //beamspot
   TVector3 beamspot(0,0,0);
-  TVector3 beamspotVariance(0,0,0);
   if(h_bs.isValid()){ 
 	beamspot.SetXYZ(h_bs->x0(),h_bs->y0(),h_bs->z0());
-	beamspotVariance.SetXYZ(pow(h_bs->x0Error(),2),pow(h_bs->y0Error(),2),pow(h_bs->z0Error(),2));			
   }
 
   //some very simple check to look how the pt distribution looks like for GEN Ks in the MC
@@ -242,7 +280,7 @@ void FlatTreeProducerV0s::analyze(edm::Event const& iEvent, edm::EventSetup cons
 			InitGENKs();
 			_GEN_Ks_mass.push_back(h_genParticles->at(i).mass());	
 			_GEN_Ks_pt.push_back(h_genParticles->at(i).pt());	
-			_tree_GEN_Ks->Fill();
+			_tree_GEN_Ks.fill();
 		}
 	}
   }
@@ -312,9 +350,9 @@ void FlatTreeProducerV0s::analyze(edm::Event const& iEvent, edm::EventSetup cons
 			//now check if the ONLY jet in the event is going back to back with the Z, jets with momenta lower than 30 GeV can be ignored
 			bool ContaminatingHighPtJetFound = false;
 
-			for(unsigned int k = 0; k < h_jets->size(); ++k){
+			for(unsigned int k : hardConeJetIndices){
 
-				if(h_jets->at(k).pt() < 30) continue;//should be .energy()  ????
+				//jets below 30 GeV pt are already removed from hardConeJetIndices //should be .energy()  ????
 				double deltaPhiJetZ = reco::deltaPhi(p4ZCandidate.phi(),h_jets->at(k).phi());
 				//if the jet is outside of the phi-cone with opening pi/4 around the backToBack of the Z then this jet can affect the cleanlyness of the the transverse region
 				bool jetInBackToBackRegion = false;
@@ -365,66 +403,77 @@ void FlatTreeProducerV0s::analyze(edm::Event const& iEvent, edm::EventSetup cons
 	
 	//save some variables to the Z tree
 	InitZ();
+	//entry of the event-level trees (Z, PV, beamspot, general) for this event, the Ks and Lambda trees point to it with _eventIndex in the scalar layout
+	Long64_t eventIndex = _tree_Z.entries();
 	_Z_mass.push_back(ZCandidateMass);
 	_Z_dz_PV_muon1.push_back(dz_PV_muon1);
 	_Z_dz_PV_muon2.push_back(dz_PV_muon2);
 	_Z_ptMuMu.push_back(pTMuMu);
-	_tree_Z->Fill();
+	_tree_Z.fill();
 
 	InitPV();
 	_PV_n.push_back(h_offlinePV->size());
 	_PV0_lxy.push_back( sqrt( pow( h_offlinePV->at(0).x()- h_bs->x0() , 2) + pow( h_offlinePV->at(0).y()- h_bs->y0() , 2)  ) );
 	_PV0_vz.push_back(h_offlinePV->at(0).z());
-	_tree_PV->Fill();
+	_tree_PV.fill();
 
 	InitBeamspot();
 	_beampot_lxy.push_back( sqrt( pow( h_bs->x0() , 2) + pow( h_bs->y0() , 2) ));
 	_beampot_vz.push_back(h_bs->z0());
-	_tree_beamspot->Fill();       
+	_tree_beamspot.fill();       
 
 
 	InitGeneral();
 	_general_triggerFired_HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ.push_back(Fired_HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ);
 	_general_triggerFired_HLT_Mu17_TrkIsoVVL_TkMu8_TrkIsoVVL_DZ.push_back(Fired_HLT_Mu17_TrkIsoVVL_TkMu8_TrkIsoVVL_DZ);
-	_tree_general->Fill();
+	_tree_general.fill();
 	
 
 	TVector3 PV0(h_offlinePV->at(0).x(),h_offlinePV->at(0).y(),h_offlinePV->at(0).z());
+	const sexaq::Vec3 PV0Point = AnalyzerAllSteps::vec3(PV0);
+	const sexaq::Vec3 beamspotPoint = AnalyzerAllSteps::vec3(beamspot);
 
 	//select and save Ks in the UE
 	InitKs();
-	  if(h_V0Ks.isValid()){
+	m_Ks.clear();
+	//the features of the V0s need the good PVs, without them no V0 is saved
+	  if(h_V0Ks.isValid() && h_goodPVs.isValid()){
 	      for(unsigned int i = 0; i < h_V0Ks->size(); ++i){//loop all RECO Ks
 		const reco::VertexCompositeCandidate * Ks = &h_V0Ks->at(i);
 		double deltaPhiKsHardCone = reco::deltaPhi( Ks->phi() , ZCandidatePhi ); 
 		double deltaPhiKsBackToBackHardCone = reco::deltaPhi( Ks->phi() , -TMath::Pi() + ZCandidatePhi ); 
 		//only select Ks in the transverse region OR if the Ks is pointing in dz far enough from the hard PV
 		
-		TVector3 V0CreationVertex(Ks->vx(),Ks->vy(),Ks->vz());
-        	TVector3 V0Momentum(Ks->px(),Ks->py(),Ks->pz());
-		double dz_PV0 = AnalyzerAllSteps::dz_line_point(V0CreationVertex,V0Momentum,PV0);
+		double dz_PV0 = sexaq::dz_line_point(sexaq::Vec3(Ks->vx(),Ks->vy(),Ks->vz()),sexaq::Vec3(Ks->px(),Ks->py(),Ks->pz()),PV0Point);
 
-		if(  (abs(deltaPhiKsHardCone) >  TMath::Pi()/3 &&  abs(deltaPhiKsBackToBackHardCone) >  TMath::Pi()/3)  || abs(dz_PV0)>1  )  FillBranchesV0(Ks, beamspot, beamspotVariance, h_offlinePV, h_genParticles,  "Ks");
+		if(  (abs(deltaPhiKsHardCone) >  TMath::Pi()/3 &&  abs(deltaPhiKsBackToBackHardCone) >  TMath::Pi()/3)  || abs(dz_PV0)>1  ){
+			m_Ks.push_back(*Ks, i);
+		}
 	      }
+	      m_Ks.compute(beamspotPoint, PV0Point, h_goodPVs->goodPOG);
+	      FillBranchesV0s(m_Ks, h_genParticles, "Ks");
 	  }
-	_tree_Ks->Fill();
+	_tree_Ks.fill(eventIndex);
 
 	//select and save Lambda in the UE
 	InitLambda();
-	  if(h_V0L.isValid()){
+	m_Lambda.clear();
+	  if(h_V0L.isValid() && h_goodPVs.isValid()){
 	      for(unsigned int i = 0; i < h_V0L->size(); ++i){//loop all RECO Lambdas
 		const reco::VertexCompositeCandidate * L = &h_V0L->at(i);
 		double deltaPhiLHardCone = reco::deltaPhi( L->phi() , ZCandidatePhi );
 		double deltaPhiLBackToBackHardCone = reco::deltaPhi( L->phi() , -TMath::Pi() + ZCandidatePhi );
 
-		TVector3 V0CreationVertex(L->vx(),L->vy(),L->vz());
-        	TVector3 V0Momentum(L->px(),L->py(),L->pz());
-		double dz_PV0 = AnalyzerAllSteps::dz_line_point(V0CreationVertex,V0Momentum,PV0);
+		double dz_PV0 = sexaq::dz_line_point(sexaq::Vec3(L->vx(),L->vy(),L->vz()),sexaq::Vec3(L->px(),L->py(),L->pz()),PV0Point);
 
-		if(  (abs(deltaPhiLHardCone) >  TMath::Pi()/3 &&  abs(deltaPhiLBackToBackHardCone) >  TMath::Pi()/3)  || abs(dz_PV0)>1  )  FillBranchesV0(L, beamspot, beamspotVariance, h_offlinePV,h_genParticles, "Lambda");
+		if(  (abs(deltaPhiLHardCone) >  TMath::Pi()/3 &&  abs(deltaPhiLBackToBackHardCone) >  TMath::Pi()/3)  || abs(dz_PV0)>1  ){
+			m_Lambda.push_back(*L, i);
+		}
 	      }
+	      m_Lambda.compute(beamspotPoint, PV0Point, h_goodPVs->goodPOG);
+	      FillBranchesV0s(m_Lambda, h_genParticles, "Lambda");
 	  }
-	_tree_Lambda->Fill();
+	_tree_Lambda.fill(eventIndex);
 
  }
 
@@ -434,262 +483,133 @@ void FlatTreeProducerV0s::analyze(edm::Event const& iEvent, edm::EventSetup cons
 
 
 
-void FlatTreeProducerV0s::FillBranchesV0(const reco::VertexCompositeCandidate * RECOV0, TVector3 beamspot, TVector3 beamspotVariance, edm::Handle<vector<reco::Vertex>> h_offlinePV, edm::Handle<vector<reco::GenParticle>> h_genParticles, std::string V0Type){
-
-
-	math::XYZPoint beamspotPoint(beamspot.X(),beamspot.Y(),beamspot.Z());
-	
-	//loop over the GEN particles and try to find a Kshort which mathches this RECO Kshort. Then save the status of this particle so you know from where it comes: PV, material or maybe a fake?
-	int bestMatchingGENParticle = -1;
-	double deltaRBestMatchingGENParticle = 99;
-	if(h_genParticles.isValid() && V0Type == "Ks"){
-		for(unsigned int i = 0; i < h_genParticles->size(); ++i){
-
-			if(h_genParticles->at(i).pdgId() == AnalyzerAllSteps::pdgIdKs){
-				double deltaPhi = reco::deltaPhi(h_genParticles->at(i).phi(), RECOV0->phi()); 
-				double deltaEta = abs(h_genParticles->at(i).eta() - RECOV0->eta()); 
-				double deltaR = sqrt(deltaPhi*deltaPhi+deltaEta*deltaEta);
-				if(deltaR < deltaRBestMatchingGENParticle){ 
-					bestMatchingGENParticle = i;
-					deltaRBestMatchingGENParticle = deltaR;
-				}
-
-			}
-
-		}		
-	}
-
-	//loop over the GEN particles and try to find a Lambda which mathches this RECO Kshort. Then save the status of this particle so you know from where it comes: PV, material or maybe a fake?
-	if(h_genParticles.isValid() && V0Type == "Lambda"){
-		for(unsigned int i = 0; i < h_genParticles->size(); ++i){
-
-			if(abs(h_genParticles->at(i).pdgId()) == abs(AnalyzerAllSteps::pdgIdAntiLambda) ){
-				double deltaPhi = reco::deltaPhi(h_genParticles->at(i).phi(), RECOV0->phi()); 
-				double deltaEta = abs(h_genParticles->at(i).eta() - RECOV0->eta()); 
-				double deltaR = sqrt(deltaPhi*deltaPhi+deltaEta*deltaEta);
-				if(deltaR < deltaRBestMatchingGENParticle){ 
-					bestMatchingGENParticle = i;
-					deltaRBestMatchingGENParticle = deltaR;
-				}
+void FlatTreeProducerV0s::FillBranchesV0s(const V0FeatureArrays& V0s, edm::Handle<vector<reco::GenParticle>> h_genParticles, std::string V0Type){
 
-			}
-
-		}		
+	//the GEN matching stays per V0, it scans the GEN Ks (or Lambdas) indexed in analyze
+	std::vector<double>& deltaRBestMatchingGENParticle = m_deltaRBestMatchingGENParticle;
+	deltaRBestMatchingGENParticle.assign(V0s.size(), 99.);
+	for(unsigned int i = 0; i < V0s.size(); ++i){
+		if(V0Type == "Ks") m_genKs.nearestDeltaR(V0s.eta[i], V0s.phi[i], deltaRBestMatchingGENParticle[i]);
+		if(V0Type == "Lambda") m_genLambda.nearestDeltaR(V0s.eta[i], V0s.phi[i], deltaRBestMatchingGENParticle[i]);
 	}
 
-
-	//calculate some kin variables of the V0
-        TVector3 V0CreationVertex(RECOV0->vx(),RECOV0->vy(),RECOV0->vz());
-        double Lxy = AnalyzerAllSteps::lxy(beamspot,V0CreationVertex);
-        TVector3 V0Momentum(RECOV0->px(),RECOV0->py(),RECOV0->pz());
-
-	//different reference points
-	TVector3 PVmin = AnalyzerAllSteps::dz_line_point_min(V0CreationVertex,V0Momentum,h_offlinePV);
-	TVector3 PV0(h_offlinePV->at(0).x(),h_offlinePV->at(0).y(),h_offlinePV->at(0).z());
-	TVector3 ZeroZeroZero(0.,0.,0.);
-
-	//different dxy definitions
-	double dxy_beamspot = AnalyzerAllSteps::dxy_signed_line_point(V0CreationVertex,V0Momentum,beamspot);
-	double dxy_min_PV = AnalyzerAllSteps::dxy_signed_line_point(V0CreationVertex,V0Momentum,PVmin);
-	double dxy_PV0 = AnalyzerAllSteps::dxy_signed_line_point(V0CreationVertex,V0Momentum,PV0);
-	double dxy_000 = AnalyzerAllSteps::dxy_signed_line_point(V0CreationVertex,V0Momentum,ZeroZeroZero);
-	//different dz definitions
-        double dz_beamspot = AnalyzerAllSteps::dz_line_point(V0CreationVertex,V0Momentum,beamspot);
-        double dz_min_PV = AnalyzerAllSteps::dz_line_point(V0CreationVertex,V0Momentum,PVmin);
-        double dz_PV0 = AnalyzerAllSteps::dz_line_point(V0CreationVertex,V0Momentum,PV0);
-        double dz_000 = AnalyzerAllSteps::dz_line_point(V0CreationVertex,V0Momentum,ZeroZeroZero);
-
-	//save things related to the track daughters of the Ks
-
-	//calculate the invariant mass of the trackpair as if the two tracks were pions (which is the case for Ks)
-	TLorentzVector p4bestTrack1(RECOV0->daughter(0)->px(),RECOV0->daughter(0)->py(),RECOV0->daughter(0)->pz(), sqrt( pow(RECOV0->daughter(0)->p(),2) + pow(AnalyzerAllSteps::pdgMassChargedPion,2)  ));
-	TLorentzVector p4bestTrack2(RECOV0->daughter(1)->px(),RECOV0->daughter(1)->py(),RECOV0->daughter(1)->pz(), sqrt( pow(RECOV0->daughter(1)->p(),2) + pow(AnalyzerAllSteps::pdgMassChargedPion,2)  ));
-	TLorentzVector p4bestTrackPair = p4bestTrack1 + p4bestTrack2;	
-
-	//calculate some angles between the tracks and between the Ks and the tracks, the RECOV0->daughter(0) and RECOV0->daughter(1) objects should have the angles calculated at the vertex of the two tracks, which is a good thing as this is where you want to evaluate the angles. See: https://github.com/jarnedc/cmssw/blob/from-CMSSW_8_0_30/RecoVertex/V0Producer/src/V0Fitter.cc#L435-L440
-	//between the two tracks
-	double openingsAngleTrack1Track2 = AnalyzerAllSteps::openings_angle(RECOV0->daughter(0)->momentum(),RECOV0->daughter(1)->momentum());
-	double deltaRTrack1Track2 = AnalyzerAllSteps::deltaR(RECOV0->daughter(0)->phi(),RECOV0->daughter(0)->eta(),RECOV0->daughter(1)->phi(),RECOV0->daughter(1)->eta());
-
-	//between the tracks and the Ks
-	double openingsAngleTrack1V0 = AnalyzerAllSteps::openings_angle(RECOV0->daughter(0)->momentum(),RECOV0->momentum());
-	double openingsAngleTrack2V0 = AnalyzerAllSteps::openings_angle(RECOV0->daughter(1)->momentum(),RECOV0->momentum());
-
-	double deltaRTrack1V0 = AnalyzerAllSteps::deltaR(RECOV0->daughter(0)->phi(),RECOV0->daughter(0)->eta(),RECOV0->phi(),RECOV0->eta());
-	double deltaRTrack2V0 = AnalyzerAllSteps::deltaR(RECOV0->daughter(1)->phi(),RECOV0->daughter(1)->eta(),RECOV0->phi(),RECOV0->eta());
-
-	TVector3 V0Track1creationVertex(RECOV0->daughter(0)->vx(),RECOV0->daughter(0)->vy(),RECOV0->daughter(0)->vz());
-        TVector3 V0Track1Momentum(RECOV0->daughter(0)->px(),RECOV0->daughter(0)->py(),RECOV0->daughter(0)->pz());
-	double dxy_Track1V0_beamspot = AnalyzerAllSteps::dxy_signed_line_point(V0Track1creationVertex,V0Track1Momentum,beamspot);	
-        double dz_Track1V0_beamspot = AnalyzerAllSteps::dz_line_point(V0Track1creationVertex,V0Track1Momentum,beamspot);
-        double dz_Track1V0_min_PV = AnalyzerAllSteps::dz_line_point(V0Track1creationVertex,V0Track1Momentum,PVmin);
-        double dz_Track1V0_PV0 = AnalyzerAllSteps::dz_line_point(V0Track1creationVertex,V0Track1Momentum,PV0);
-        double dz_Track1V0_000 = AnalyzerAllSteps::dz_line_point(V0Track1creationVertex,V0Track1Momentum,ZeroZeroZero);
-
-	TVector3 V0Track2creationVertex(RECOV0->daughter(1)->vx(),RECOV0->daughter(1)->vy(),RECOV0->daughter(1)->vz());
-        TVector3 V0Track2Momentum(RECOV0->daughter(1)->px(),RECOV0->daughter(1)->py(),RECOV0->daughter(1)->pz());
-	double dxy_Track2V0_beamspot = AnalyzerAllSteps::dxy_signed_line_point(V0Track2creationVertex,V0Track2Momentum,beamspot);	
-        double dz_Track2V0_beamspot = AnalyzerAllSteps::dz_line_point(V0Track2creationVertex,V0Track2Momentum,beamspot);
-        double dz_Track2V0_min_PV = AnalyzerAllSteps::dz_line_point(V0Track2creationVertex,V0Track2Momentum,PVmin);
-        double dz_Track2V0_PV0 = AnalyzerAllSteps::dz_line_point(V0Track2creationVertex,V0Track2Momentum,PV0);
-        double dz_Track2V0_000 = AnalyzerAllSteps::dz_line_point(V0Track2creationVertex,V0Track2Momentum,ZeroZeroZero);
-
-
 	if(V0Type == "Ks"){
-		_Ks_mass.push_back(RECOV0->mass());	
-
-		_Ks_pt.push_back(RECOV0->pt());	
-		_Ks_pz.push_back(RECOV0->pz());	
-		_Ks_Lxy.push_back(Lxy);	
-		_Ks_vz.push_back(RECOV0->vz());	
-
-		_Ks_eta.push_back(RECOV0->eta());
-		_Ks_phi.push_back(RECOV0->phi());
-
-		_Ks_dxy_beamspot.push_back(dxy_beamspot);
-		_Ks_dxy_min_PV.push_back(dxy_min_PV);
-		_Ks_dxy_PV0.push_back(dxy_PV0);
-		_Ks_dxy_000.push_back(dxy_000);
-
-		_Ks_dz_beamspot.push_back(dz_beamspot);	
-		_Ks_dz_min_PV.push_back(dz_min_PV);	
-		_Ks_dz_PV0.push_back(dz_PV0);	
-		_Ks_dz_000.push_back(dz_000);
-
-		_Ks_vz_dz_min_PV.push_back(PVmin.Z());
-
-		_Ks_deltaRBestMatchingGENParticle.push_back(deltaRBestMatchingGENParticle);
-
-
-		//_Ks_trackPair_mindeltaR.push_back(deltaRRecoKsTrackPair);
-		_Ks_trackPair_mass.push_back(p4bestTrackPair.M());
-
-		//between the two tracks
-		_Ks_Track1Track2_openingsAngle.push_back(openingsAngleTrack1Track2);
-		_Ks_Track1Track2_deltaR.push_back(deltaRTrack1Track2);
-
-		//between the two tracks and the Ks
-		_Ks_Track1_openingsAngle.push_back(openingsAngleTrack1V0);
-		_Ks_Track2_openingsAngle.push_back(openingsAngleTrack2V0);
-		_Ks_Track1_deltaR.push_back(deltaRTrack1V0);
-		_Ks_Track2_deltaR.push_back(deltaRTrack2V0);
-		
-		//somehow the RECOV0->daughter(0) should be containing the reference to the track (see e.g. https://github.com/jarnedc/cmssw/blob/from-CMSSW_8_0_30/RecoVertex/V0Producer/src/V0Fitter.cc#L515), but I am not able to get it out...
-		//const reco::Candidate* Ks_daug0 = RECOV0->daughter(0);
-		//reco::TrackRef Ks_daug0_trackref = Ks_daug0->track();
-
-		
-		_Ks_daughterTrack1_charge.push_back(RECOV0->daughter(0)->charge());
-		//_Ks_daughterTrack1_chi2.push_back(RECOV0->daughter(0)->chi2());
-		//_Ks_daughterTrack1_ndof.push_back(RECOV0->daughter(0)->ndof());
-		_Ks_daughterTrack1_eta.push_back(RECOV0->daughter(0)->eta());
-		_Ks_daughterTrack1_phi.push_back(RECOV0->daughter(0)->phi());
-		_Ks_daughterTrack1_pt.push_back(RECOV0->daughter(0)->pt());
-		_Ks_daughterTrack1_pz.push_back(RECOV0->daughter(0)->pz());
-		_Ks_daughterTrack1_dxy_beamspot.push_back(dxy_Track1V0_beamspot);
-		_Ks_daughterTrack1_dz_beamspot.push_back(dz_Track1V0_beamspot);
-		_Ks_daughterTrack1_dz_min_PV.push_back(dz_Track1V0_min_PV);
-		_Ks_daughterTrack1_dz_PV0.push_back(dz_Track1V0_PV0);
-		_Ks_daughterTrack1_dz_000.push_back(dz_Track1V0_000);
-
-		_Ks_daughterTrack2_charge.push_back(RECOV0->daughter(1)->charge());
-		//_Ks_daughterTrack2_chi2.push_back(RECOV0->daughter(1)->chi2());
-		//_Ks_daughterTrack2_ndof.push_back(RECOV0->daughter(1)->ndof());
-		_Ks_daughterTrack2_eta.push_back(RECOV0->daughter(1)->eta());
-		_Ks_daughterTrack2_phi.push_back(RECOV0->daughter(1)->phi());
-		_Ks_daughterTrack2_pt.push_back(RECOV0->daughter(1)->pt());
-		_Ks_daughterTrack2_pz.push_back(RECOV0->daughter(1)->pz());
-		_Ks_daughterTrack2_dxy_beamspot.push_back(dxy_Track2V0_beamspot);
-		_Ks_daughterTrack2_dz_beamspot.push_back(dz_Track2V0_beamspot);
-		_Ks_daughterTrack2_dz_min_PV.push_back(dz_Track2V0_min_PV);
-		_Ks_daughterTrack2_dz_PV0.push_back(dz_Track2V0_PV0);
-		_Ks_daughterTrack2_dz_000.push_back(dz_Track2V0_000);
+		_Ks_index.insert(_Ks_index.end(), V0s.index.begin(), V0s.index.end());
+		appendColumn(_Ks_mass, V0s.mass);
+
+		appendColumn(_Ks_pt, V0s.pt);
+		appendColumn(_Ks_pz, V0s.V0.pz);
+		appendColumn(_Ks_Lxy, V0s.Lxy);
+		appendColumn(_Ks_vz, V0s.V0.z);
+
+		appendColumn(_Ks_eta, V0s.eta);
+		appendColumn(_Ks_phi, V0s.phi);
+
+		appendColumn(_Ks_dxy_beamspot, V0s.dxy_beamspot);
+		appendColumn(_Ks_dxy_min_PV, V0s.dxy_min_PV);
+		appendColumn(_Ks_dxy_PV0, V0s.dxy_PV0);
+		appendColumn(_Ks_dxy_000, V0s.dxy_000);
+
+		appendColumn(_Ks_dz_beamspot, V0s.dz_beamspot);
+		appendColumn(_Ks_dz_min_PV, V0s.dz_min_PV);
+		appendColumn(_Ks_dz_PV0, V0s.dz_PV0);
+		appendColumn(_Ks_dz_000, V0s.dz_000);
+
+		appendColumn(_Ks_vz_dz_min_PV, V0s.PVmin_z);
+
+		appendColumn(_Ks_deltaRBestMatchingGENParticle, deltaRBestMatchingGENParticle);
+
+		appendColumn(_Ks_trackPair_mass, V0s.trackPair_mass);
+
+		appendColumn(_Ks_Track1Track2_openingsAngle, V0s.Track1Track2_openingsAngle);
+		appendColumn(_Ks_Track1Track2_deltaR, V0s.Track1Track2_deltaR);
+
+		appendColumn(_Ks_Track1_openingsAngle, V0s.Track1_openingsAngle);
+		appendColumn(_Ks_Track2_openingsAngle, V0s.Track2_openingsAngle);
+		appendColumn(_Ks_Track1_deltaR, V0s.Track1_deltaR);
+		appendColumn(_Ks_Track2_deltaR, V0s.Track2_deltaR);
+
+		appendColumn(_Ks_daughterTrack1_charge, V0s.track1_charge);
+		appendColumn(_Ks_daughterTrack1_eta, V0s.track1_eta);
+		appendColumn(_Ks_daughterTrack1_phi, V0s.track1_phi);
+		appendColumn(_Ks_daughterTrack1_pt, V0s.track1_pt);
+		appendColumn(_Ks_daughterTrack1_pz, V0s.track1.pz);
+		appendColumn(_Ks_daughterTrack1_dxy_beamspot, V0s.track1_dxy_beamspot);
+		appendColumn(_Ks_daughterTrack1_dz_beamspot, V0s.track1_dz_beamspot);
+		appendColumn(_Ks_daughterTrack1_dz_min_PV, V0s.track1_dz_min_PV);
+		appendColumn(_Ks_daughterTrack1_dz_PV0, V0s.track1_dz_PV0);
+		appendColumn(_Ks_daughterTrack1_dz_000, V0s.track1_dz_000);
+
+		appendColumn(_Ks_daughterTrack2_charge, V0s.track2_charge);
+		appendColumn(_Ks_daughterTrack2_eta, V0s.track2_eta);
+		appendColumn(_Ks_daughterTrack2_phi, V0s.track2_phi);
+		appendColumn(_Ks_daughterTrack2_pt, V0s.track2_pt);
+		appendColumn(_Ks_daughterTrack2_pz, V0s.track2.pz);
+		appendColumn(_Ks_daughterTrack2_dxy_beamspot, V0s.track2_dxy_beamspot);
+		appendColumn(_Ks_daughterTrack2_dz_beamspot, V0s.track2_dz_beamspot);
+		appendColumn(_Ks_daughterTrack2_dz_min_PV, V0s.track2_dz_min_PV);
+		appendColumn(_Ks_daughterTrack2_dz_PV0, V0s.track2_dz_PV0);
+		appendColumn(_Ks_daughterTrack2_dz_000, V0s.track2_dz_000);
 	}
 	else if (V0Type == "Lambda"){
-		_Lambda_mass.push_back(RECOV0->mass());	
-
-		_Lambda_pt.push_back(RECOV0->pt());	
-		_Lambda_pz.push_back(RECOV0->pz());	
-		_Lambda_Lxy.push_back(Lxy);	
-		_Lambda_vz.push_back(RECOV0->vz());	
-
-		_Lambda_eta.push_back(RECOV0->eta());
-		_Lambda_phi.push_back(RECOV0->phi());
-
-		_Lambda_dxy_beamspot.push_back(dxy_beamspot);
-		_Lambda_dxy_min_PV.push_back(dxy_min_PV);
-		_Lambda_dxy_PV0.push_back(dxy_PV0);
-		_Lambda_dxy_000.push_back(dxy_000);
-
-		_Lambda_dz_beamspot.push_back(dz_beamspot);	
-		_Lambda_dz_min_PV.push_back(dz_min_PV);	
-		_Lambda_dz_PV0.push_back(dz_PV0);	
-		_Lambda_dz_000.push_back(dz_000);
-
-		_Lambda_vz_dz_min_PV.push_back(PVmin.Z());
-
-		_Lambda_deltaRBestMatchingGENParticle.push_back(deltaRBestMatchingGENParticle);
-
-
-		//_Ks_trackPair_mindeltaR.push_back(deltaRRecoKsTrackPair);
-		_Lambda_trackPair_mass.push_back(p4bestTrackPair.M());
-
-		//between the two tracks
-		_Lambda_Track1Track2_openingsAngle.push_back(openingsAngleTrack1Track2);
-		_Lambda_Track1Track2_deltaR.push_back(deltaRTrack1Track2);
-
-		//between the two tracks and the Ks
-		_Lambda_Track1_openingsAngle.push_back(openingsAngleTrack1V0);
-		_Lambda_Track2_openingsAngle.push_back(openingsAngleTrack2V0);
-		_Lambda_Track1_deltaR.push_back(deltaRTrack1V0);
-		_Lambda_Track2_deltaR.push_back(deltaRTrack2V0);
-		
-		//somehow the RECOV0->daughter(0) should be containing the reference to the track (see e.g. https://github.com/jarnedc/cmssw/blob/from-CMSSW_8_0_30/RecoVertex/V0Producer/src/V0Fitter.cc#L515), but I am not able to get it out...
-		//const reco::Candidate* Ks_daug0 = RECOV0->daughter(0);
-		//reco::TrackRef Ks_daug0_trackref = Ks_daug0->track();
-
-		
-		_Lambda_daughterTrack1_charge.push_back(RECOV0->daughter(0)->charge());
-		//_Ks_daughterTrack1_chi2.push_back(RECOV0->daughter(0)->chi2());
-		//_Ks_daughterTrack1_ndof.push_back(RECOV0->daughter(0)->ndof());
-		_Lambda_daughterTrack1_eta.push_back(RECOV0->daughter(0)->eta());
-		_Lambda_daughterTrack1_phi.push_back(RECOV0->daughter(0)->phi());
-		_Lambda_daughterTrack1_pt.push_back(RECOV0->daughter(0)->pt());
-		_Lambda_daughterTrack1_pz.push_back(RECOV0->daughter(0)->pz());
-		_Lambda_daughterTrack1_dxy_beamspot.push_back(dxy_Track1V0_beamspot);
-		_Lambda_daughterTrack1_dz_beamspot.push_back(dz_Track1V0_beamspot);
-		_Lambda_daughterTrack1_dz_min_PV.push_back(dz_Track1V0_min_PV);
-		_Lambda_daughterTrack1_dz_PV0.push_back(dz_Track1V0_PV0);
-		_Lambda_daughterTrack1_dz_000.push_back(dz_Track1V0_000);
-
-		_Lambda_daughterTrack2_charge.push_back(RECOV0->daughter(1)->charge());
-		//_Ks_daughterTrack2_chi2.push_back(RECOV0->daughter(1)->chi2());
-		//_Ks_daughterTrack2_ndof.push_back(RECOV0->daughter(1)->ndof());
-		_Lambda_daughterTrack2_eta.push_back(RECOV0->daughter(1)->eta());
-		_Lambda_daughterTrack2_phi.push_back(RECOV0->daughter(1)->phi());
-		_Lambda_daughterTrack2_pt.push_back(RECOV0->daughter(1)->pt());
-		_Lambda_daughterTrack2_pz.push_back(RECOV0->daughter(1)->pz());
-		_Lambda_daughterTrack2_dxy_beamspot.push_back(dxy_Track2V0_beamspot);
-		_Lambda_daughterTrack2_dz_beamspot.push_back(dz_Track2V0_beamspot);
-		_Lambda_daughterTrack2_dz_min_PV.push_back(dz_Track2V0_min_PV);
-		_Lambda_daughterTrack2_dz_PV0.push_back(dz_Track2V0_PV0);
-		_Lambda_daughterTrack2_dz_000.push_back(dz_Track2V0_000);
-
-
+		_Lambda_index.insert(_Lambda_index.end(), V0s.index.begin(), V0s.index.end());
+		appendColumn(_Lambda_mass, V0s.mass);
+
+		appendColumn(_Lambda_pt, V0s.pt);
+		appendColumn(_Lambda_pz, V0s.V0.pz);
+		appendColumn(_Lambda_Lxy, V0s.Lxy);
+		appendColumn(_Lambda_vz, V0s.V0.z);
+
+		appendColumn(_Lambda_eta, V0s.eta);
+		appendColumn(_Lambda_phi, V0s.phi);
+
+		appendColumn(_Lambda_dxy_beamspot, V0s.dxy_beamspot);
+		appendColumn(_Lambda_dxy_min_PV, V0s.dxy_min_PV);
+		appendColumn(_Lambda_dxy_PV0, V0s.dxy_PV0);
+		appendColumn(_Lambda_dxy_000, V0s.dxy_000);
+
+		appendColumn(_Lambda_dz_beamspot, V0s.dz_beamspot);
+		appendColumn(_Lambda_dz_min_PV, V0s.dz_min_PV);
+		appendColumn(_Lambda_dz_PV0, V0s.dz_PV0);
+		appendColumn(_Lambda_dz_000, V0s.dz_000);
+
+		appendColumn(_Lambda_vz_dz_min_PV, V0s.PVmin_z);
+
+		appendColumn(_Lambda_deltaRBestMatchingGENParticle, deltaRBestMatchingGENParticle);
+
+		appendColumn(_Lambda_trackPair_mass, V0s.trackPair_mass);
+
+		appendColumn(_Lambda_Track1Track2_openingsAngle, V0s.Track1Track2_openingsAngle);
+		appendColumn(_Lambda_Track1Track2_deltaR, V0s.Track1Track2_deltaR);
+
+		appendColumn(_Lambda_Track1_openingsAngle, V0s.Track1_openingsAngle);
+		appendColumn(_Lambda_Track2_openingsAngle, V0s.Track2_openingsAngle);
+		appendColumn(_Lambda_Track1_deltaR, V0s.Track1_deltaR);
+		appendColumn(_Lambda_Track2_deltaR, V0s.Track2_deltaR);
+
+		appendColumn(_Lambda_daughterTrack1_charge, V0s.track1_charge);
+		appendColumn(_Lambda_daughterTrack1_eta, V0s.track1_eta);
+		appendColumn(_Lambda_daughterTrack1_phi, V0s.track1_phi);
+		appendColumn(_Lambda_daughterTrack1_pt, V0s.track1_pt);
+		appendColumn(_Lambda_daughterTrack1_pz, V0s.track1.pz);
+		appendColumn(_Lambda_daughterTrack1_dxy_beamspot, V0s.track1_dxy_beamspot);
+		appendColumn(_Lambda_daughterTrack1_dz_beamspot, V0s.track1_dz_beamspot);
+		appendColumn(_Lambda_daughterTrack1_dz_min_PV, V0s.track1_dz_min_PV);
+		appendColumn(_Lambda_daughterTrack1_dz_PV0, V0s.track1_dz_PV0);
+		appendColumn(_Lambda_daughterTrack1_dz_000, V0s.track1_dz_000);
+
+		appendColumn(_Lambda_daughterTrack2_charge, V0s.track2_charge);
+		appendColumn(_Lambda_daughterTrack2_eta, V0s.track2_eta);
+		appendColumn(_Lambda_daughterTrack2_phi, V0s.track2_phi);
+		appendColumn(_Lambda_daughterTrack2_pt, V0s.track2_pt);
+		appendColumn(_Lambda_daughterTrack2_pz, V0s.track2.pz);
+		appendColumn(_Lambda_daughterTrack2_dxy_beamspot, V0s.track2_dxy_beamspot);
+		appendColumn(_Lambda_daughterTrack2_dz_beamspot, V0s.track2_dz_beamspot);
+		appendColumn(_Lambda_daughterTrack2_dz_min_PV, V0s.track2_dz_min_PV);
+		appendColumn(_Lambda_daughterTrack2_dz_PV0, V0s.track2_dz_PV0);
+		appendColumn(_Lambda_daughterTrack2_dz_000, V0s.track2_dz_000);
 	}
 
-	//just a consitency check: if deltaR is small then also the 3D distance between the GEN decay vertex and the RECO decay vertex should be small
-	if(h_genParticles.isValid()){
-		if( RECOV0->mass() > 0.48 && RECOV0->mass() < 0.52 &&  abs(RECOV0->eta()) < 2 && dxy_beamspot < 0.1 && dxy_beamspot > 0. && abs(dz_PV0) < 0.2 ){
-			std::cout << "number of daughters: "<< h_genParticles->at(bestMatchingGENParticle).numberOfDaughters() << std::endl;
-			if(deltaRBestMatchingGENParticle < 0.01 && h_genParticles->at(bestMatchingGENParticle).numberOfDaughters() > 0){
-				double distance = sqrt(  pow( h_genParticles->at(bestMatchingGENParticle).daughter(0)->vx() - RECOV0->vx() ,2) + pow( h_genParticles->at(bestMatchingGENParticle).daughter(0)->vy() - RECOV0->vy(),2) + pow( h_genParticles->at(bestMatchingGENParticle).daughter(0)->vz() - RECOV0->vz(),2) );
-				double GEN_lxyz = sqrt( pow(h_genParticles->at(bestMatchingGENParticle).daughter(0)->vx(),2) + pow(h_genParticles->at(bestMatchingGENParticle).daughter(0)->vy(),2) + pow(h_genParticles->at(bestMatchingGENParticle).daughter(0)->vz(),2) );
-				std::cout << "Found a GEN Ks matching a RECO Ks in deltaR, the 3D distance between GEN and RECO decay vertex is: "<< distance << " the GEN lxyz is: " << GEN_lxyz << std::endl;
-			}
-		}
-	}	
-
 }
 
 
@@ -755,6 +675,7 @@ FlatTreeProducerV0s::~FlatTreeProducerV0s()
 void FlatTreeProducerV0s::InitKs()
 {
 
+	_Ks_index.clear();
 	_Ks_mass.clear();
 
 	_Ks_pt.clear();
@@ -824,6 +745,7 @@ void FlatTreeProducerV0s::InitKs()
 void FlatTreeProducerV0s::InitLambda()
 {
 
+	_Lambda_index.clear();
 	_Lambda_mass.clear();
 
 	_Lambda_pt.clear();
@@ -0,0 +1,66 @@
+#include "../interface/FlatTreeWriter.h"
+
+#include "FWCore/Utilities/interface/Exception.h"
+#include "CommonTools/UtilAlgos/interface/TFileService.h"
+
+#include <algorithm>
+
+FlatTreeWriter::Layout FlatTreeWriter::layout(const std::string& name){
+	if(name == "vector") return vectorLayout;
+	if(name == "scalar") return scalarLayout;
+	throw cms::Exception("FlatTreeWriter") << "unknown flatTreeLayout " << name << ", use vector or scalar";
+}
+
+FlatTreeWriter::FlatTreeWriter(): tree_(nullptr), layout_(vectorLayout) {}
+
+void FlatTreeWriter::open(TFileService& fs, const char* name, const char* title, Layout layout){
+	tree_ = fs.make<TTree>(name, title);
+	layout_ = layout;
+	if(layout_ == scalarLayout) addScalar("_eventIndex", &eventIndex_);
+}
+
+void FlatTreeWriter::add(const char* name, std::vector<float>* column){
+	if(layout_ == vectorLayout) tree_->Branch(name, column);
+	else{
+		floatValues_.push_back(0.);
+		addScalar(name, &floatValues_.back());
+		floatColumns_.push_back(std::make_pair(column, &floatValues_.back()));
+	}
+}
+
+void FlatTreeWriter::add(const char* name, std::vector<int>* column){
+	if(layout_ == vectorLayout) tree_->Branch(name, column);
+	else{
+		intValues_.push_back(0);
+		addScalar(name, &intValues_.back());
+		intColumns_.push_back(std::make_pair(column, &intValues_.back()));
+	}
+}
+
+void FlatTreeWriter::addScalar(const char* name, float* value){ tree_->Branch(name, value, (std::string(name) + "/F").c_str()); }
+void FlatTreeWriter::addScalar(const char* name, int* value){ tree_->Branch(name, value, (std::string(name) + "/I").c_str()); }
+void FlatTreeWriter::addScalar(const char* name, UInt_t* value){ tree_->Branch(name, value, (std::string(name) + "/i").c_str()); }
+void FlatTreeWriter::addScalar(const char* name, ULong64_t* value){ tree_->Branch(name, value, (std::string(name) + "/l").c_str()); }
+void FlatTreeWriter::addScalar(const char* name, Long64_t* value){ tree_->Branch(name, value, (std::string(name) + "/L").c_str()); }
+
+void FlatTreeWriter::fill(Long64_t eventIndex){
+	if(layout_ == vectorLayout){
+		tree_->Fill();
+		return;
+	}
+	eventIndex_ = eventIndex;
+	size_t n = 0;
+	for(auto& column : floatColumns_) n = std::max(n, column.first->size());
+	for(auto& column : intColumns_) n = std::max(n, column.first->size());
+	for(auto& column : floatColumns_) check(column.first->size(), n);
+	for(auto& column : intColumns_) check(column.first->size(), n);
+	for(size_t i = 0; i < n; ++i){
+		for(auto& column : floatColumns_) *column.second = column.first->empty() ? notFilled : (*column.first)[i];
+		for(auto& column : intColumns_) *column.second = column.first->empty() ? notFilled : (*column.first)[i];
+		tree_->Fill();
+	}
+}
+
+void FlatTreeWriter::check(size_t size, size_t n) const {
+	if(size != n && size != 0) throw cms::Exception("FlatTreeWriter") << "the columns of " << tree_->GetName() << " do not have the same number of candidates";
+}
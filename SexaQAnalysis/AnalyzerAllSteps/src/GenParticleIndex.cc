@@ -0,0 +1,68 @@
+#include "../interface/GenParticleIndex.h"
+
+#include "DataFormats/Math/interface/deltaPhi.h"
+
+#include <cmath>
+#include <cstdlib>
+
+void GenParticleIndex::build(std::vector<reco::GenParticle> const & genParticles){
+
+	clear();
+	for(unsigned int i = 0; i < genParticles.size(); ++i){
+		const reco::GenParticle& genParticle = genParticles[i];
+		if(absPdgId_ ? abs(genParticle.pdgId()) != abs(pdgId_) : genParticle.pdgId() != pdgId_) continue;
+		if(nDaughters_ >= 0 && (int)genParticle.numberOfDaughters() != nDaughters_) continue;
+
+		index_.push_back(i);
+		eta_.push_back(genParticle.eta());
+		phi_.push_back(genParticle.phi());
+		const bool hasVertex = genParticle.numberOfDaughters() > 0;
+		hasVertex_.push_back(hasVertex);
+		vx_.push_back(hasVertex ? genParticle.daughter(0)->vx() : 0.);
+		vy_.push_back(hasVertex ? genParticle.daughter(0)->vy() : 0.);
+		vz_.push_back(hasVertex ? genParticle.daughter(0)->vz() : 0.);
+	}
+}
+
+void GenParticleIndex::clear(){
+
+	index_.clear();
+	eta_.clear();
+	phi_.clear();
+	hasVertex_.clear();
+	vx_.clear();
+	vy_.clear();
+	vz_.clear();
+}
+
+int GenParticleIndex::nearestVertex(double x, double y, double z, double& distance, double maxDistance) const {
+
+	int best = -1;
+	distance = maxDistance;
+	for(unsigned int i = 0; i < index_.size(); ++i){
+		if(!hasVertex_[i]) continue;
+		//same expression as the old loop, so the same particle is found
+		double d = sqrt( pow(vx_[i] - x,2) + pow(vy_[i] - y,2) + pow(vz_[i] - z,2) );
+		if(d < distance){
+			distance = d;
+			best = index_[i];
+		}
+	}
+	return best;
+}
+
+int GenParticleIndex::nearestDeltaR(double eta, double phi, double& deltaR, double maxDeltaR) const {
+
+	int best = -1;
+	deltaR = maxDeltaR;
+	for(unsigned int i = 0; i < index_.size(); ++i){
+		double deltaPhi = reco::deltaPhi(phi_[i], phi);
+		double deltaEta = std::abs(eta_[i] - eta);
+		double d = sqrt(deltaPhi*deltaPhi+deltaEta*deltaEta);
+		if(d < deltaR){
+			deltaR = d;
+			best = index_[i];
+		}
+	}
+	return best;
+}
@@ -0,0 +1,83 @@
+#include "../interface/PUReweighingTable.h"
+
+#include "FWCore/Utilities/interface/Exception.h"
+
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <mutex>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+   const char payloadMagic[8] = {'S','E','X','A','Q','P','U','\0'};
+   const std::size_t headerSize = sizeof(payloadMagic) + 4*sizeof(uint32_t) + 2*sizeof(double);
+}
+
+std::shared_ptr<const PUReweighingTable> PUReweighingTable::get(const std::string& fileName){
+	//one table per file for the whole job, kept as long as a module uses it
+	static std::mutex mutex;
+	static std::map<std::string, std::weak_ptr<const PUReweighingTable> > tables;
+
+	std::lock_guard<std::mutex> guard(mutex);
+	std::shared_ptr<const PUReweighingTable> table = tables[fileName].lock();
+	if(!table){
+		table = std::make_shared<const PUReweighingTable>(fileName);
+		tables[fileName] = table;
+	}
+	return table;
+}
+
+PUReweighingTable::PUReweighingTable(const std::string& fileName):
+  mapping_(MAP_FAILED),
+  mappingSize_(0),
+  nPV_(0),
+  nVz_(0),
+  vzMin_(0.),
+  vzMax_(0.),
+  invBinWidth_(0.),
+  weights_(nullptr)
+{
+	int fd = open(fileName.c_str(), O_RDONLY);
+	if(fd < 0) throw cms::Exception("PUReweighingTable") << "cannot open PU reweighing payload " << fileName;
+	struct stat fileStat;
+	if(fstat(fd, &fileStat) != 0 || (std::size_t)fileStat.st_size < headerSize){
+		close(fd);
+		throw cms::Exception("PUReweighingTable") << fileName << " is not a PU reweighing payload";
+	}
+	mappingSize_ = fileStat.st_size;
+	mapping_ = mmap(nullptr, mappingSize_, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if(mapping_ == MAP_FAILED) throw cms::Exception("PUReweighingTable") << "cannot map PU reweighing payload " << fileName;
+
+	//from here on the destructor is not called if the constructor throws, so unmap before throwing
+	const char* data = static_cast<const char*>(mapping_);
+	uint32_t header[4];
+	double range[2];
+	std::memcpy(header, data + sizeof(payloadMagic), sizeof(header));
+	std::memcpy(range, data + sizeof(payloadMagic) + sizeof(header), sizeof(range));
+
+	std::string error;
+	if(std::memcmp(data, payloadMagic, sizeof(payloadMagic)) != 0) error = "is not a PU reweighing payload";
+	else if(header[0] != payloadVersion) error = "has payload version " + std::to_string(header[0]) + ", expected " + std::to_string(payloadVersion);
+	else if(header[1] == 0 || header[2] == 0 || !(range[1] > range[0])) error = "has an empty or invalid binning";
+	else if(mappingSize_ < headerSize + (std::size_t)header[1]*header[2]*sizeof(float)) error = "is truncated, expected " + std::to_string(header[1]) + "x" + std::to_string(header[2]) + " weights";
+	if(!error.empty()){
+		munmap(mapping_, mappingSize_);
+		throw cms::Exception("PUReweighingTable") << fileName << " " << error;
+	}
+
+	nPV_ = header[1];
+	nVz_ = header[2];
+	vzMin_ = range[0];
+	vzMax_ = range[1];
+	invBinWidth_ = nVz_/(vzMax_ - vzMin_);
+	weights_ = reinterpret_cast<const float*>(data + headerSize);
+}
+
+PUReweighingTable::~PUReweighingTable(){
+	if(mapping_ != MAP_FAILED) munmap(mapping_, mappingSize_);
+}
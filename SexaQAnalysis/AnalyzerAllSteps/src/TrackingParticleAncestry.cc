@@ -0,0 +1,59 @@
+#include "../interface/TrackingParticleAncestry.h"
+#include "../interface/AnalyzerAllSteps.h"
+
+void TrackingParticleAncestry::build(TrackingParticleCollection const & TPColl){
+
+	producedAt_.clear();
+	decayingAt_.clear();
+	granddaughterType_.assign(TPColl.size(), notAntiSGranddaughter);
+	etaOfGrandMotherAntiS_.assign(TPColl.size(), 999.);
+	antiSGranddaughters_.clear();
+
+	//one pass to index all tps on their production and first decay vertex
+	for(unsigned int i = 0; i < TPColl.size(); ++i){
+		const TrackingParticle& tp = TPColl[i];
+		producedAt_[productionPosition(tp)].push_back(i);
+		if(tp.decayVertices_begin() == tp.decayVertices_end()) continue;
+		const auto& decayPosition = (**tp.decayVertices_begin()).position();
+		decayingAt_[Position{decayPosition.X(), decayPosition.Y(), decayPosition.Z()}].push_back(i);
+	}
+
+	//one pass to find the antiS granddaughters: a charged pion or antiproton, produced where a Ks or AntiLambda decays, which was produced where an antiS decays
+	for(unsigned int i = 0; i < TPColl.size(); ++i){
+		const TrackingParticle& tp = TPColl[i];
+		if(abs(tp.pdgId()) != AnalyzerAllSteps::pdgIdPosPion && tp.pdgId() != AnalyzerAllSteps::pdgIdAntiProton) continue;
+
+		bool antiSFound = false;
+		for(unsigned int j : find(decayingAt_, productionPosition(tp))){
+			const TrackingParticle& tp_daughter = TPColl[j];
+			if(abs(tp_daughter.pdgId()) != AnalyzerAllSteps::pdgIdKs && tp_daughter.pdgId() != AnalyzerAllSteps::pdgIdAntiLambda) continue;
+
+			for(unsigned int k : find(decayingAt_, productionPosition(tp_daughter))){
+				if(TPColl[k].pdgId() != AnalyzerAllSteps::pdgIdAntiS) continue;
+				antiSFound = true;
+				etaOfGrandMotherAntiS_[i] = TPColl[k].eta();
+				bool daughterIsKs = abs(tp_daughter.pdgId()) == AnalyzerAllSteps::pdgIdKs;
+				bool granddaughterIsPion = abs(tp.pdgId()) == AnalyzerAllSteps::pdgIdPosPion;
+				if(daughterIsKs && granddaughterIsPion) granddaughterType_[i] = KsPion;
+				else if(!daughterIsKs && granddaughterIsPion) granddaughterType_[i] = AntiLambdaPion;
+				else if(!daughterIsKs && !granddaughterIsPion) granddaughterType_[i] = AntiLambdaAntiProton;
+				if(granddaughterType_[i] != notAntiSGranddaughter) antiSGranddaughters_.push_back(i);
+				break;
+			}
+			if(antiSFound) break;
+		}
+	}
+
+}
+
+const std::vector<unsigned int>& TrackingParticleAncestry::daughters(const TrackingParticle& tp) const{
+	if(tp.decayVertices_begin() == tp.decayVertices_end()) return none_;
+	const auto& decayPosition = (**tp.decayVertices_begin()).position();
+	return find(producedAt_, Position{decayPosition.X(), decayPosition.Y(), decayPosition.Z()});
+}
+
+const std::vector<unsigned int>& TrackingParticleAncestry::find(const PositionIndex& index, const Position& position) const{
+	auto it = index.find(position);
+	if(it == index.end()) return none_;
+	return it->second;
+}
@@ -0,0 +1,119 @@
+#include "../interface/V0FeatureArrays.h"
+#include "../interface/AnalyzerAllSteps.h"
+
+#include <TMath.h>
+
+#include <cmath>
+
+void V0FeatureArrays::clear(){
+
+	index.clear();
+	mass.clear(); pt.clear(); eta.clear(); phi.clear();
+	V0.clear(); track1.clear(); track2.clear();
+	track1_p.clear(); track1_pt.clear(); track1_eta.clear(); track1_phi.clear(); track1_charge.clear();
+	track2_p.clear(); track2_pt.clear(); track2_eta.clear(); track2_phi.clear(); track2_charge.clear();
+}
+
+void V0FeatureArrays::push_back(const reco::VertexCompositeCandidate& V0Candidate, unsigned int V0Index){
+
+	const reco::Candidate* daughter1 = V0Candidate.daughter(0);
+	const reco::Candidate* daughter2 = V0Candidate.daughter(1);
+
+	index.push_back(V0Index);
+	mass.push_back(V0Candidate.mass());
+	pt.push_back(V0Candidate.pt());
+	eta.push_back(V0Candidate.eta());
+	phi.push_back(V0Candidate.phi());
+	V0.push_back(sexaq::Vec3(V0Candidate.vx(), V0Candidate.vy(), V0Candidate.vz()), sexaq::Vec3(V0Candidate.px(), V0Candidate.py(), V0Candidate.pz()));
+
+	track1.push_back(sexaq::Vec3(daughter1->vx(), daughter1->vy(), daughter1->vz()), sexaq::Vec3(daughter1->px(), daughter1->py(), daughter1->pz()));
+	track1_p.push_back(daughter1->p());
+	track1_pt.push_back(daughter1->pt());
+	track1_eta.push_back(daughter1->eta());
+	track1_phi.push_back(daughter1->phi());
+	track1_charge.push_back(daughter1->charge());
+
+	track2.push_back(sexaq::Vec3(daughter2->vx(), daughter2->vy(), daughter2->vz()), sexaq::Vec3(daughter2->px(), daughter2->py(), daughter2->pz()));
+	track2_p.push_back(daughter2->p());
+	track2_pt.push_back(daughter2->pt());
+	track2_eta.push_back(daughter2->eta());
+	track2_phi.push_back(daughter2->phi());
+	track2_charge.push_back(daughter2->charge());
+}
+
+void V0FeatureArrays::compute(const sexaq::Vec3& beamspot, const sexaq::Vec3& PV0, const PrimaryVertexArrays& goodPVsPOG){
+
+	const unsigned int n = size();
+	const sexaq::Vec3 ZeroZeroZero(0.,0.,0.);
+
+	for(std::vector<double>* feature : {&Lxy, &PVmin_x, &PVmin_y, &PVmin_z, &dxy_beamspot, &dxy_min_PV, &dxy_PV0, &dxy_000, &dz_beamspot, &dz_min_PV, &dz_PV0, &dz_000,
+	                                    &trackPair_mass, &Track1Track2_openingsAngle, &Track1Track2_deltaR, &Track1_openingsAngle, &Track2_openingsAngle, &Track1_deltaR, &Track2_deltaR,
+	                                    &track1_dxy_beamspot, &track1_dz_beamspot, &track1_dz_min_PV, &track1_dz_PV0, &track1_dz_000,
+	                                    &track2_dxy_beamspot, &track2_dz_beamspot, &track2_dz_min_PV, &track2_dz_PV0, &track2_dz_000}) feature->resize(n);
+
+	//the V0 vertex in xy from the beamspot (pow of the difference is even in its sign, so the order of the points does not matter)
+	sexaq::lxy(n, V0.x.data(), V0.y.data(), beamspot, Lxy.data());
+
+	//the PV closest in dz to every V0 line in one pass over the PVs
+	AnalyzerAllSteps::dz_line_point_min(V0, goodPVsPOG, bestPV_, dzmin_);
+	for(unsigned int i = 0; i < n; ++i){
+		const bool found = bestPV_[i] > -1;
+		PVmin_x[i] = found ? goodPVsPOG.x[bestPV_[i]] : 0.;
+		PVmin_y[i] = found ? goodPVsPOG.y[bestPV_[i]] : 0.;
+		PVmin_z[i] = found ? goodPVsPOG.z[bestPV_[i]] : 0.;
+	}
+
+	//impact parameters of the V0 and of its daughter tracks w.r.t. the fixed reference points
+	sexaq::dxy_signed_line_point(n, V0.x.data(), V0.y.data(), V0.px.data(), V0.py.data(), beamspot, dxy_beamspot.data());
+	sexaq::dxy_signed_line_point(n, V0.x.data(), V0.y.data(), V0.px.data(), V0.py.data(), PV0, dxy_PV0.data());
+	sexaq::dxy_signed_line_point(n, V0.x.data(), V0.y.data(), V0.px.data(), V0.py.data(), ZeroZeroZero, dxy_000.data());
+	sexaq::dz_line_point(n, V0.x.data(), V0.y.data(), V0.z.data(), V0.px.data(), V0.py.data(), V0.pz.data(), beamspot, dz_beamspot.data());
+	sexaq::dz_line_point(n, V0.x.data(), V0.y.data(), V0.z.data(), V0.px.data(), V0.py.data(), V0.pz.data(), PV0, dz_PV0.data());
+	sexaq::dz_line_point(n, V0.x.data(), V0.y.data(), V0.z.data(), V0.px.data(), V0.py.data(), V0.pz.data(), ZeroZeroZero, dz_000.data());
+
+	sexaq::dxy_signed_line_point(n, track1.x.data(), track1.y.data(), track1.px.data(), track1.py.data(), beamspot, track1_dxy_beamspot.data());
+	sexaq::dz_line_point(n, track1.x.data(), track1.y.data(), track1.z.data(), track1.px.data(), track1.py.data(), track1.pz.data(), beamspot, track1_dz_beamspot.data());
+	sexaq::dz_line_point(n, track1.x.data(), track1.y.data(), track1.z.data(), track1.px.data(), track1.py.data(), track1.pz.data(), PV0, track1_dz_PV0.data());
+	sexaq::dz_line_point(n, track1.x.data(), track1.y.data(), track1.z.data(), track1.px.data(), track1.py.data(), track1.pz.data(), ZeroZeroZero, track1_dz_000.data());
+
+	sexaq::dxy_signed_line_point(n, track2.x.data(), track2.y.data(), track2.px.data(), track2.py.data(), beamspot, track2_dxy_beamspot.data());
+	sexaq::dz_line_point(n, track2.x.data(), track2.y.data(), track2.z.data(), track2.px.data(), track2.py.data(), track2.pz.data(), beamspot, track2_dz_beamspot.data());
+	sexaq::dz_line_point(n, track2.x.data(), track2.y.data(), track2.z.data(), track2.px.data(), track2.py.data(), track2.pz.data(), PV0, track2_dz_PV0.data());
+	sexaq::dz_line_point(n, track2.x.data(), track2.y.data(), track2.z.data(), track2.px.data(), track2.py.data(), track2.pz.data(), ZeroZeroZero, track2_dz_000.data());
+
+	//impact parameters w.r.t. the PV closest in dz, which is another point for every V0
+	for(unsigned int i = 0; i < n; ++i){
+		const sexaq::Vec3 PVmin(PVmin_x[i], PVmin_y[i], PVmin_z[i]);
+		dxy_min_PV[i] = sexaq::dxy_signed_line_point(sexaq::Vec3(V0.x[i], V0.y[i], 0.), sexaq::Vec3(V0.px[i], V0.py[i], 0.), PVmin);
+		dz_min_PV[i] = sexaq::dz_line_point(sexaq::Vec3(V0.x[i], V0.y[i], V0.z[i]), sexaq::Vec3(V0.px[i], V0.py[i], V0.pz[i]), PVmin);
+		track1_dz_min_PV[i] = sexaq::dz_line_point(sexaq::Vec3(track1.x[i], track1.y[i], track1.z[i]), sexaq::Vec3(track1.px[i], track1.py[i], track1.pz[i]), PVmin);
+		track2_dz_min_PV[i] = sexaq::dz_line_point(sexaq::Vec3(track2.x[i], track2.y[i], track2.z[i]), sexaq::Vec3(track2.px[i], track2.py[i], track2.pz[i]), PVmin);
+	}
+
+	//invariant mass of the track pair as if both tracks were pions, the same operations as the sum of the two TLorentzVectors and M() of the sum
+	const double pionMass2 = pow(AnalyzerAllSteps::pdgMassChargedPion,2);
+	for(unsigned int i = 0; i < n; ++i){
+		const double E = sqrt(pow(track1_p[i],2) + pionMass2) + sqrt(pow(track2_p[i],2) + pionMass2);
+		const double px = track1.px[i] + track2.px[i], py = track1.py[i] + track2.py[i], pz = track1.pz[i] + track2.pz[i];
+		const double mass2 = E*E - (px*px + py*py + pz*pz);
+		trackPair_mass[i] = mass2 < 0.0 ? -sqrt(-mass2) : sqrt(mass2);
+	}
+
+	//angles between the two tracks and between the tracks and the V0, as AnalyzerAllSteps::openings_angle and AnalyzerAllSteps::deltaR
+	for(unsigned int i = 0; i < n; ++i){
+		const double mag2V0 = V0.px[i]*V0.px[i] + V0.py[i]*V0.py[i] + V0.pz[i]*V0.pz[i];
+		const double mag2Track1 = track1.px[i]*track1.px[i] + track1.py[i]*track1.py[i] + track1.pz[i]*track1.pz[i];
+		const double mag2Track2 = track2.px[i]*track2.px[i] + track2.py[i]*track2.py[i] + track2.pz[i]*track2.pz[i];
+		const double track1Track2 = track1.px[i]*track2.px[i] + track1.py[i]*track2.py[i] + track1.pz[i]*track2.pz[i];
+		const double track1V0 = track1.px[i]*V0.px[i] + track1.py[i]*V0.py[i] + track1.pz[i]*V0.pz[i];
+		const double track2V0 = track2.px[i]*V0.px[i] + track2.py[i]*V0.py[i] + track2.pz[i]*V0.pz[i];
+		Track1Track2_openingsAngle[i] = TMath::ACos(track1Track2/pow(mag2Track1*mag2Track2,0.5));
+		Track1_openingsAngle[i] = TMath::ACos(track1V0/pow(mag2Track1*mag2V0,0.5));
+		Track2_openingsAngle[i] = TMath::ACos(track2V0/pow(mag2Track2*mag2V0,0.5));
+	}
+	for(unsigned int i = 0; i < n; ++i){
+		Track1Track2_deltaR[i] = AnalyzerAllSteps::deltaR(track1_phi[i], track1_eta[i], track2_phi[i], track2_eta[i]);
+		Track1_deltaR[i] = AnalyzerAllSteps::deltaR(track1_phi[i], track1_eta[i], phi[i], eta[i]);
+		Track2_deltaR[i] = AnalyzerAllSteps::deltaR(track2_phi[i], track2_eta[i], phi[i], eta[i]);
+	}
+}
@@ -0,0 +1,110 @@
+#include "../interface/V0FitterCutFlow.h"
+
+#include <iomanip>
+
+V0FitterCutFlow::Step V0FitterCutFlow::stepOf(int returnCode){
+
+	switch(returnCode){
+		case 1: case 2: case 3: return charge;
+		case 4: return impactPoint;
+		case 5: case 6: return closestApproach;
+		case 7: return POCA;
+		case 8: case 9: return quadrant;
+		case 10: return mPiPi;
+		case 11: return vertexFit;
+		case 12: return vertexChi2;
+		case 13: case 14: return decaySignificance;
+		case 15: case 16: return trajectoriesAtVertex;
+		case 17: case 18: return pointingAngle;
+		default: return massWindow;
+	}
+}
+
+const char* V0FitterCutFlow::stepName(Step step){
+
+	static const char* names[nSteps] = {"charge", "impact point", "closest approach (DCA)", "POCA in tracker", "same quadrant", "mPiPi", "vertex fit", "vertex chi2", "decay significance",
+	                                    "trajectories at vertex", "pointing angle", "mass window"};
+	return names[step];
+}
+
+const char* V0FitterCutFlow::trackCutName(TrackCut cut){
+
+	static const char* names[nTrackCuts] = {"normalized chi2", "number of valid hits", "pt", "IP significance xy", "IP significance z"};
+	return names[cut];
+}
+
+void V0FitterCutFlow::book(TFileService& fs){
+
+	//bin 1: all track pairs given to V0Fitter, bin 2+i: the ones passing step i
+	h_cutFlow_ = fs.make<TH1F>("V0FitterCutFlow", "V0Fitter cut flow; ; track pairs", nSteps + 1, 0, nSteps + 1);
+	h_cutFlow_->GetXaxis()->SetBinLabel(1, "all");
+	for(int i = 0; i < nSteps; ++i) h_cutFlow_->GetXaxis()->SetBinLabel(i + 2, stepName(Step(i)));
+
+	h_returnCode_ = fs.make<TH1F>("V0FitterReturnCode", "V0Fitter return code; return code; track pairs", nReturnCodes, -0.5, nReturnCodes - 0.5);
+
+	h_stepTime_ = fs.make<TH1F>("V0FitterStepTime", "time spent in the V0Fitter steps; ; s", nSteps, 0, nSteps);
+	for(int i = 0; i < nSteps; ++i) h_stepTime_->GetXaxis()->SetBinLabel(i + 1, stepName(Step(i)));
+
+	//bin 1: all tracks given to V0Fitter_trackSelection, bin 2+i: the ones failing cut i, last bin: the ones passing all the cuts
+	h_trackSelection_ = fs.make<TH1F>("V0FitterTrackSelection", "V0Fitter track selection; ; tracks", nTrackCuts + 2, 0, nTrackCuts + 2);
+	h_trackSelection_->GetXaxis()->SetBinLabel(1, "all");
+	for(int i = 0; i < nTrackCuts; ++i) h_trackSelection_->GetXaxis()->SetBinLabel(i + 2, (std::string("fail ") + trackCutName(TrackCut(i))).c_str());
+	h_trackSelection_->GetXaxis()->SetBinLabel(nTrackCuts + 2, "pass all");
+}
+
+void V0FitterCutFlow::end(int returnCode){
+
+	nCalls_++;
+	if(returnCode >= 0 && returnCode < nReturnCodes) nReturnCode_[returnCode]++;
+	//an accepted pair (0) passed the mass window, the other codes of the last step are rejections
+	if(returnCode == 0) passed(massWindow);
+	else addTime(stepOf(returnCode));
+}
+
+void V0FitterCutFlow::track(const bool failed[nTrackCuts]){
+
+	nTracks_++;
+	bool passedAll = true;
+	for(int i = 0; i < nTrackCuts; ++i){
+		if(!failed[i]) continue;
+		nTracksFailed_[i]++;
+		passedAll = false;
+	}
+	if(passedAll) nTracksPassed_++;
+}
+
+void V0FitterCutFlow::fill(){
+
+	if(h_cutFlow_){
+		h_cutFlow_->SetBinContent(1, nCalls_);
+		for(int i = 0; i < nSteps; ++i) h_cutFlow_->SetBinContent(i + 2, nPassed_[i]);
+	}
+	if(h_returnCode_) for(int i = 0; i < nReturnCodes; ++i) h_returnCode_->SetBinContent(i + 1, nReturnCode_[i]);
+	if(h_stepTime_) for(int i = 0; i < nSteps; ++i) h_stepTime_->SetBinContent(i + 1, seconds_[i]);
+	if(h_trackSelection_){
+		h_trackSelection_->SetBinContent(1, nTracks_);
+		for(int i = 0; i < nTrackCuts; ++i) h_trackSelection_->SetBinContent(i + 2, nTracksFailed_[i]);
+		h_trackSelection_->SetBinContent(nTrackCuts + 2, nTracksPassed_);
+	}
+}
+
+void V0FitterCutFlow::print(std::ostream& out) const {
+
+	double totalSeconds = 0.;
+	for(int i = 0; i < nSteps; ++i) totalSeconds += seconds_[i];
+
+	out << "V0Fitter cut flow: " << nCalls_ << " track pairs, " << totalSeconds << " s" << std::endl;
+	out << std::left << std::setw(26) << "step" << std::right << std::setw(12) << "passed" << std::setw(12) << "rejected" << std::setw(14) << "time [s]" << std::setw(10) << "time [%]" << std::endl;
+	unsigned long entering = nCalls_;
+	for(int i = 0; i < nSteps; ++i){
+		out << std::left << std::setw(26) << stepName(Step(i)) << std::right << std::setw(12) << nPassed_[i] << std::setw(12) << entering - nPassed_[i]
+		    << std::setw(14) << seconds_[i] << std::setw(10) << (totalSeconds > 0. ? 100.*seconds_[i]/totalSeconds : 0.) << std::endl;
+		entering = nPassed_[i];
+	}
+	out << "V0Fitter return codes:";
+	for(int i = 0; i < nReturnCodes; ++i) if(nReturnCode_[i] > 0) out << " " << i << ": " << nReturnCode_[i];
+	out << std::endl;
+	out << "V0Fitter track selection: " << nTracks_ << " tracks, " << nTracksPassed_ << " pass all cuts, failing";
+	for(int i = 0; i < nTrackCuts; ++i) out << " " << trackCutName(TrackCut(i)) << ": " << nTracksFailed_[i] << (i + 1 < nTrackCuts ? "," : "");
+	out << std::endl;
+}
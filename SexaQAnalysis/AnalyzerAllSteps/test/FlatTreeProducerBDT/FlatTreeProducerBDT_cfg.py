@@ -46,9 +46,11 @@ process.source = cms.Source("PoolSource",
 
 
 process.load("SexaQAnalysis.AnalyzerAllSteps.FlatTreeProducerBDT_cfi")
+#the PV selection, run once per event and read by the FlatTreeProducer
+process.load("SexaQAnalysis.Skimming.GoodPVProducer_cfi")
 process.FlatTreeProducerBDT.runningOnData = runningOnData
 #process.FlatTreeProducerBDT.lookAtAntiS = lookAtAntiS
-process.flattreeproducer = cms.Path(process.FlatTreeProducerBDT)
+process.flattreeproducer = cms.Path(process.GoodPVProducer*process.FlatTreeProducerBDT)
 
 process.p = cms.Schedule(
   process.flattreeproducer
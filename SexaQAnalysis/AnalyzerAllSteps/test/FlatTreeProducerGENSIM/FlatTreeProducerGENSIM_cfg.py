@@ -46,9 +46,11 @@ process.source = cms.Source("PoolSource",
 
 
 process.load("SexaQAnalysis.AnalyzerAllSteps.FlatTreeProducerGENSIM_cfi")
+#the PV selection, run once per event and read by the FlatTreeProducer
+process.load("SexaQAnalysis.Skimming.GoodPVProducer_cfi")
 process.FlatTreeProducerGENSIM.runningOnData = runningOnData
 process.FlatTreeProducerGENSIM.lookAtAntiS = lookAtAntiS
-process.flattreeproducer = cms.Path(process.FlatTreeProducerGENSIM)
+process.flattreeproducer = cms.Path(process.GoodPVProducer*process.FlatTreeProducerGENSIM)
 
 process.p = cms.Schedule(
   process.flattreeproducer
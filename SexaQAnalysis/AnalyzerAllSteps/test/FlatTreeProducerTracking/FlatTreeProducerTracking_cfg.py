@@ -35,6 +35,12 @@ else:
 
 process.maxEvents = cms.untracked.PSet( input = cms.untracked.int32(options.maxEvts))
 process.MessageLogger.cerr.FwkReport.reportEvery = cms.untracked.int32(1)
+#the distance of closest approach of the track pairs in the V0Fitter and the per event antiS counts are LogDebug: they are only there when compiled with USER_CXXFLAGS="-DEDM_ML_DEBUG"
+#and with the two commented lines below. The V0FitterDCA messages are then rate limited: the first 20, after that exponentially fewer
+process.MessageLogger.categories.append("V0FitterDCA")
+process.MessageLogger.cerr.V0FitterDCA = cms.untracked.PSet(limit = cms.untracked.int32(20))
+#process.MessageLogger.debugModules = cms.untracked.vstring("FlatTreeProducerTracking")
+#process.MessageLogger.cerr.threshold = cms.untracked.string("DEBUG")
 process.options = cms.untracked.PSet(wantSummary = cms.untracked.bool(True))
 
 process.source = cms.Source("PoolSource",
@@ -73,6 +79,8 @@ process.validation = cms.Sequence(
 )
 
 process.load("SexaQAnalysis.AnalyzerAllSteps.FlatTreeProducerTracking_cfi")
+#the PV selection, run once per event and read by the FlatTreeProducer
+process.load("SexaQAnalysis.Skimming.GoodPVProducer_cfi")
 process.FlatTreeProducerTracking.innerHitPosCut = -1
 process.FlatTreeProducerTracking.cosThetaXYCut = -1
 process.FlatTreeProducerTracking.kShortMassCut = 0.03
@@ -82,7 +90,7 @@ process.FlatTreeProducerTracking.lambdaMassCut = 0.015
 #process.flattreeproducer = cms.Path(process.FlatTreeProducerTracking)
 
 
-process.master = cms.Path(process.validation*process.FlatTreeProducerTracking)
+process.master = cms.Path(process.validation*process.GoodPVProducer*process.FlatTreeProducerTracking)
 
 
 process.p = cms.Schedule(
@@ -46,9 +46,12 @@ process.source = cms.Source("PoolSource",
 
 
 process.load("SexaQAnalysis.AnalyzerAllSteps.FlatTreeProducerV0s_cfi")
+#the PV selection, run once per event and read by the FlatTreeProducer
+process.load("SexaQAnalysis.Skimming.GoodPVProducer_cfi")
+process.GoodPVProducer.offlinePrimaryVerticesCollection = process.FlatTreeProducerV0s.offlinePV
 process.FlatTreeProducerV0s.runningOnData = runningOnData
 process.FlatTreeProducerV0s.lookAtAntiS = lookAtAntiS
-process.flattreeproducer = cms.Path(process.FlatTreeProducerV0s)
+process.flattreeproducer = cms.Path(process.GoodPVProducer*process.FlatTreeProducerV0s)
 
 process.p = cms.Schedule(
   process.flattreeproducer
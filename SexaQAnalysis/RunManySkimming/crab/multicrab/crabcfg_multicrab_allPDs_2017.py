@@ -11,6 +11,9 @@ config.General.transferLogs = True
 
 config.JobType.pluginName = 'Analysis'
 config.JobType.psetName = '../treeproducer_data_cfg.py'
+#treeproducer_data_cfg.py runs with 8 threads, geometry and magnetic field are shared between them
+config.JobType.numCores = 8
+config.JobType.maxMemoryMB = 10000
 
 #config.Data.inputDataset = '/SingleMuon/Run2016G-23Sep2016-v1/AOD'
 config.Data.inputDBS = 'global'
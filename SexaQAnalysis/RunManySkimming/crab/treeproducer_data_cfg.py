@@ -41,12 +41,20 @@ options.register(
 	'maxEvts',-1,VarParsing.multiplicity.singleton,VarParsing.varType.int,
 	'flag to indicate max events to process')
 
+options.register(
+	'nThreads',8,VarParsing.multiplicity.singleton,VarParsing.varType.int,
+	'number of threads (and streams) of the job. The skim modules are stream or global modules and run in parallel, but the tree (TreeProducer_AOD) and the event counters are one modules which see one event at a time, so the throughput is limited by them and does not grow linearly with the threads')
+
 
 process = cms.Process("SEXAQ")
 
 process.load("FWCore.MessageService.MessageLogger_cfi")
 process.MessageLogger.cerr.FwkReport.reportEvery = cms.untracked.int32(10000)
-process.options = cms.untracked.PSet(wantSummary = cms.untracked.bool(True))
+process.options = cms.untracked.PSet(
+  wantSummary = cms.untracked.bool(True),
+  numberOfThreads = cms.untracked.uint32(options.nThreads),
+  numberOfStreams = cms.untracked.uint32(0) # 0 means one stream per thread
+)
 
 process.load('Configuration.StandardSequences.GeometryRecoDB_cff')
 process.load("Configuration.StandardSequences.FrontierConditions_GlobalTag_cff")
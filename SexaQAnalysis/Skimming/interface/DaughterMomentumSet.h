@@ -0,0 +1,60 @@
+#ifndef DaughterMomentumSet_h
+#define DaughterMomentumSet_h
+
+#include <cstddef>
+#include <functional>
+#include <unordered_set>
+
+//the momenta of the daughters of a set of V0s, to check with one lookup per daughter if a daughter of another V0 has exactly the same (px, py, pz) as any of them. Filled once per event from the selected V0s,
+//so removing the overlaps of N V0s with M selected V0s is O(N + M) instead of the O(N x M) loop over all pairs of V0s, with the same result as that loop (exact comparison of the momentum components).
+//V0 is anything with numberOfDaughters() and daughter(i) returning a pointer to something with px(), py() and pz() (a reco::Candidate in the filter, a light mock in test/).
+namespace sexaq {
+
+class DaughterMomentumSet {
+  public:
+	void clear() { momenta_.clear(); }
+	void reserve(unsigned int n) { momenta_.reserve(n); }
+	unsigned int size() const { return momenta_.size(); }
+
+	template <class V0>
+	void insertDaughters(const V0& v0)
+	{
+		for(unsigned int i = 0; i < v0.numberOfDaughters(); ++i) momenta_.insert(momentum(*v0.daughter(i)));
+	}
+
+	template <class V0>
+	bool sharesMomentum(const V0& v0) const
+	{
+		for(unsigned int i = 0; i < v0.numberOfDaughters(); ++i){
+			if(momenta_.count(momentum(*v0.daughter(i)))) return true;
+		}
+		return false;
+	}
+
+  private:
+	struct Momentum {
+		double px, py, pz;
+		bool operator==(const Momentum& other) const { return px == other.px && py == other.py && pz == other.pz; }
+	};
+
+	//0. and -0. compare equal, so they have to get the same hash
+	struct MomentumHash {
+		std::size_t operator()(const Momentum& p) const
+		{
+			std::hash<double> hash;
+			std::size_t seed = hash(p.px == 0. ? 0. : p.px);
+			seed ^= hash(p.py == 0. ? 0. : p.py) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+			seed ^= hash(p.pz == 0. ? 0. : p.pz) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+			return seed;
+		}
+	};
+
+	template <class Daughter>
+	static Momentum momentum(const Daughter& daughter) { return Momentum{daughter.px(), daughter.py(), daughter.pz()}; }
+
+	std::unordered_set<Momentum, MomentumHash> momenta_;
+};
+
+}
+
+#endif
@@ -0,0 +1,41 @@
+#ifndef EventSummary_h
+#define EventSummary_h
+
+#include "DataFormats/Math/interface/LorentzVector.h"
+#include "DataFormats/Math/interface/Vector3D.h"
+
+#include <vector>
+
+//basic info on the event, written by the InitialProducer before the Sexaq reconstruction starts to drop events. One product per event instead of one single element vector per quantity, so the skimmed EDM files have one branch for all of it
+struct EventSummary {
+    typedef math::XYZTLorentzVector LorentzVector;
+
+    //counts
+    int ntracks = 0;
+    int nlambdas = 0;
+    int nkshorts = 0;
+    //1 if there is at least 1 kshort and at least 1 lambda, i.e. there is the potential to reconstruct an S. The old nkshortsAndNlambdas vector product was always 0, skims made before EventSummary have no information here
+    int nkshortsAndNlambdas = 0;
+    int nPV = 0;
+    int nGoodPV = 0;
+    int njets = 0;
+    int nmuons = 0;
+    int nelectrons = 0;
+
+    //scalar sums of the pt of the jets and of the tracks
+    double HT = 0.;
+    double TKHT = 0.;
+
+    //the nTopJets (InitialProducer parameter, 2 by default) jets with highest momentum, leading jet first. Always nTopJets entries, padded with zero four-vectors if the event has less jets, like the old TwoTopJets,
+    //so topJets[1] can be used. Unlike TwoTopJets the second entry is really the second highest momentum jet: the old selection did not move the leading jet down when a higher one was found
+    std::vector<LorentzVector> topJets;
+    //the MET and the missing pt from the tracks
+    LorentzVector MET;
+    math::XYZVector TKMET;
+
+    //positions of all valid PVs and of the good (tracksSize >= 4) PVs
+    std::vector<float> PVx, PVy, PVz;
+    std::vector<float> goodPVx, goodPVy, goodPVz;
+};
+
+#endif
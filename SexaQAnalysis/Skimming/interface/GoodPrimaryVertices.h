@@ -0,0 +1,43 @@
+#ifndef GoodPrimaryVertices_h
+#define GoodPrimaryVertices_h
+
+#include <vector>
+
+//the primary vertices passing one PV definition, as one array per quantity (structure of arrays), in the order of the vertex collection
+struct PrimaryVertexArrays {
+    std::vector<double> x, y, z, ndof;
+    std::vector<int> nTracks;
+    //index of the vertex in the offlinePrimaryVertices collection
+    std::vector<unsigned int> index;
+
+    unsigned int size() const { return x.size(); }
+    bool empty() const { return x.empty(); }
+
+    void push_back(double vx, double vy, double vz, double vndof, int vnTracks, unsigned int vindex){
+	x.push_back(vx);
+	y.push_back(vy);
+	z.push_back(vz);
+	ndof.push_back(vndof);
+	nTracks.push_back(vnTracks);
+	index.push_back(vindex);
+    }
+};
+
+//the selected primary vertices of an event for every PV definition in use, written once per event by the GoodPVProducer so the analyzers do not apply the cuts again.
+//Empty if the vertex collection is missing.
+struct GoodPrimaryVertices {
+    //size of the vertex collection, including the invalid (fake) vertex of an event without reconstructed PV
+    unsigned int nVertices = 0;
+    //all valid PVs
+    PrimaryVertexArrays all;
+    //valid PVs with tracksSize() >= 4 (the good PV definition of the skimming)
+    PrimaryVertexArrays good;
+    //ndof > 4, |z| < 24 and r < 2 (https://twiki.cern.ch/twiki/bin/view/CMSPublic/TrackingPOGPerformance2017MC#Vertex_Reconstruction_Performanc)
+    PrimaryVertexArrays goodPOG;
+
+    unsigned int nPV() const { return all.size(); }
+    unsigned int nGoodPV() const { return good.size(); }
+    unsigned int nGoodPVPOG() const { return goodPOG.size(); }
+};
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef TopK_h
+#define TopK_h
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+//select the (at most) k objects with the highest key from a collection (jets, tracks, V0s, ...) without copying the objects themselves. Only the indices into the collection are returned, ordered from the highest to the lowest key.
+//k = 0 means no limit. Objects with a key below minKey are not considered at all. For equal keys the object which comes first in the collection comes first.
+//the key is evaluated exactly once per object, the sorting is a partial sort on (key, index) pairs, so this is O(N log k).
+namespace sexaq {
+
+template <class Collection, class KeyFunction>
+void topKIndices(const Collection& collection, unsigned int k, KeyFunction key, std::vector<unsigned int>& indices, double minKey = -std::numeric_limits<double>::infinity())
+{
+	indices.clear();
+
+	std::vector<std::pair<double, unsigned int> > keyed;
+	keyed.reserve(collection.size());
+	for(unsigned int i = 0; i < collection.size(); ++i){
+		double thisKey = key(collection[i]);
+		if(thisKey < minKey) continue;
+		keyed.emplace_back(thisKey, i);
+	}
+
+	auto higherKeyFirst = [](const std::pair<double, unsigned int>& a, const std::pair<double, unsigned int>& b){
+		if(a.first != b.first) return a.first > b.first;
+		return a.second < b.second;
+	};
+
+	unsigned int nSelected = (k == 0 || k > keyed.size()) ? keyed.size() : k;
+	std::partial_sort(keyed.begin(), keyed.begin() + nSelected, keyed.end(), higherKeyFirst);
+
+	indices.reserve(nSelected);
+	for(unsigned int i = 0; i < nSelected; ++i) indices.push_back(keyed[i].second);
+}
+
+template <class Collection, class KeyFunction>
+std::vector<unsigned int> topKIndices(const Collection& collection, unsigned int k, KeyFunction key, double minKey = -std::numeric_limits<double>::infinity())
+{
+	std::vector<unsigned int> indices;
+	topKIndices(collection, k, key, indices, minKey);
+	return indices;
+}
+
+}
+
+#endif
@@ -0,0 +1,116 @@
+// -*- C++ -*-
+//
+// Package:    SexaQAnalysis/Skimming
+// Class:      GoodPVProducer
+//
+/**\class GoodPVProducer GoodPVProducer.cc SexaQAnalysis/Skimming/plugins/GoodPVProducer.cc
+
+ Description: applies the PV definitions in use (all valid, tracksSize() >= 4 and the POG definition) once per event and writes the selected PVs as one GoodPrimaryVertices product.
+ The FlatTreeProducers read this product instead of looping over the vertex collection and applying the cuts themselves.
+
+ Implementation:
+     one pass over the vertex collection, the selected PVs are stored as arrays per quantity (see GoodPrimaryVertices.h)
+*/
+
+
+// system include files
+#include <memory>
+#include <cmath>
+
+// user include files
+#include "FWCore/Framework/interface/Frameworkfwd.h"
+#include "FWCore/Framework/interface/global/EDProducer.h"
+
+#include "FWCore/Framework/interface/Event.h"
+#include "FWCore/Framework/interface/MakerMacros.h"
+
+#include "FWCore/ParameterSet/interface/ParameterSet.h"
+#include "FWCore/Utilities/interface/StreamID.h"
+#include "FWCore/Utilities/interface/InputTag.h"
+
+#include "DataFormats/VertexReco/interface/Vertex.h"
+
+#include "SexaQAnalysis/Skimming/interface/GoodPrimaryVertices.h"
+
+#include <iostream>
+#include <vector>
+
+//
+// class declaration
+//
+
+class GoodPVProducer : public edm::global::EDProducer<> {
+   public:
+      explicit GoodPVProducer(const edm::ParameterSet&);
+      ~GoodPVProducer();
+
+      static void fillDescriptions(edm::ConfigurationDescriptions& descriptions);
+
+   private:
+      virtual void produce(edm::StreamID, edm::Event&, const edm::EventSetup&) const override;
+
+      // ----------member data ---------------------------
+      edm::InputTag offlinePrimaryVerticesCollectionTag_;
+      edm::EDGetTokenT<std::vector<reco::Vertex> > offlinePrimaryVerticesCollectionToken_;
+};
+
+//
+// constructors and destructor
+//
+GoodPVProducer::GoodPVProducer(edm::ParameterSet const& pset):
+offlinePrimaryVerticesCollectionTag_(pset.getParameter<edm::InputTag>("offlinePrimaryVerticesCollection"))
+{
+   offlinePrimaryVerticesCollectionToken_ = consumes<std::vector<reco::Vertex> >(offlinePrimaryVerticesCollectionTag_);
+   produces<GoodPrimaryVertices>();
+}
+
+
+GoodPVProducer::~GoodPVProducer()
+{
+}
+
+
+//
+// member functions
+//
+
+// ------------ method called to produce the data  ------------
+void
+GoodPVProducer::produce(edm::StreamID, edm::Event& iEvent, const edm::EventSetup& iSetup) const
+{
+  auto goodPVs = std::make_unique<GoodPrimaryVertices>();
+
+  edm::Handle<std::vector<reco::Vertex> > h_PVs;
+  iEvent.getByToken(offlinePrimaryVerticesCollectionToken_, h_PVs);
+  if(!h_PVs.isValid()) {
+      std::cout << "Missing collection during GoodPVProducer : " << offlinePrimaryVerticesCollectionTag_ << " ... skip entry !" << std::endl;
+  }
+  else {
+	goodPVs->nVertices = h_PVs->size();
+	for(unsigned int i = 0; i < h_PVs->size(); ++i){
+		const reco::Vertex& PV = (*h_PVs)[i];
+		const int nTracks = (int)PV.tracksSize();
+		if(PV.isValid()){//all PV
+			goodPVs->all.push_back(PV.x(), PV.y(), PV.z(), PV.ndof(), nTracks, i);
+			if(nTracks >= 4) goodPVs->good.push_back(PV.x(), PV.y(), PV.z(), PV.ndof(), nTracks, i);//valid PV definition by Pascal
+		}
+		double r = sqrt(PV.x()*PV.x()+PV.y()*PV.y());
+		if(PV.ndof() > 4 && std::abs(PV.z()) < 24 && r < 2) goodPVs->goodPOG.push_back(PV.x(), PV.y(), PV.z(), PV.ndof(), nTracks, i);//valid PV definition from POG
+	}
+  }
+
+  iEvent.put(std::move(goodPVs));
+}
+
+// ------------ method fills 'descriptions' with the allowed parameters for the module  ------------
+void
+GoodPVProducer::fillDescriptions(edm::ConfigurationDescriptions& descriptions) {
+  //The following says we do not know what parameters are allowed so do no validation
+  // Please change this to state exactly what you do use, even if it is no parameters
+  edm::ParameterSetDescription desc;
+  desc.setUnknown();
+  descriptions.addDefault(desc);
+}
+
+//define this as a plug-in
+DEFINE_FWK_MODULE(GoodPVProducer);
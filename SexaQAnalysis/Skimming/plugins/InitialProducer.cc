@@ -5,7 +5,7 @@
 // 
 /**\class InitialProducer InitialProducer.cc SexaQAnalysis/Skimming/plugins/InitialProducer.cc
 
- Description: class to write some very basic info on the event into the EDM file before running the Sexaq reconstruction where you start to drop events.
+ Description: class to write some very basic info on the event into the EDM file before running the Sexaq reconstruction where you start to drop events. All the info goes into one EventSummary product.
 
  Implementation:
      [Notes on implementation]
@@ -22,7 +22,7 @@
 
 // user include files
 #include "FWCore/Framework/interface/Frameworkfwd.h"
-#include "FWCore/Framework/interface/stream/EDProducer.h"
+#include "FWCore/Framework/interface/global/EDProducer.h"
 
 #include "FWCore/Framework/interface/Event.h"
 #include "FWCore/Framework/interface/MakerMacros.h"
@@ -45,11 +45,14 @@
 #include "DataFormats/ParticleFlowCandidate/interface/PFCandidate.h"
 #include "DataFormats/METReco/interface/PFMET.h"
 #include "DataFormats/Candidate/interface/LeafCandidate.h"
+
+#include "SexaQAnalysis/Skimming/interface/EventSummary.h"
+#include "SexaQAnalysis/Skimming/interface/TopK.h"
 //
 // class declaration
 //
 
-class InitialProducer : public edm::stream::EDProducer<> {
+class InitialProducer : public edm::global::EDProducer<> {
    public:
       explicit InitialProducer(const edm::ParameterSet&);
       ~InitialProducer();
@@ -77,9 +80,9 @@ class InitialProducer : public edm::stream::EDProducer<> {
       edm::EDGetTokenT<std::vector<edm::FwdPtr<reco::PFCandidate> > > muonsCollectionToken_;
       edm::EDGetTokenT<std::vector<edm::FwdPtr<reco::PFCandidate> > > electronsCollectionToken_;
       edm::EDGetTokenT<std::vector<reco::PFMET>  > METCollectionToken_;
-      virtual void beginStream(edm::StreamID) override;
-      virtual void produce(edm::Event&, const edm::EventSetup&) override;
-      virtual void endStream() override;
+      //number of highest momentum jets stored in the EventSummary
+      unsigned int nTopJets_;
+      virtual void produce(edm::StreamID, edm::Event&, const edm::EventSetup&) const override;
 
       //virtual void beginRun(edm::Run const&, edm::EventSetup const&) override;
       //virtual void endRun(edm::Run const&, edm::EventSetup const&) override;
@@ -110,7 +113,8 @@ offlinePrimaryVerticesCollectionTag_(pset.getParameter<edm::InputTag>("offlinePr
 ak4PFJetsCollectionTag_(pset.getParameter<edm::InputTag>("ak4PFJetsCollection")),
 muonsCollectionTag_(pset.getParameter<edm::InputTag>("muonsCollection")),
 electronsCollectionTag_(pset.getParameter<edm::InputTag>("electronsCollection")),
-METCollectionTag_(pset.getParameter<edm::InputTag>("METCollection"))
+METCollectionTag_(pset.getParameter<edm::InputTag>("METCollection")),
+nTopJets_(pset.getParameter<unsigned int>("nTopJets"))
 {
    //register your products
    tracksCollectionToken_ = consumes<std::vector<reco::Track> >(trackCollectionTag_);
@@ -121,27 +125,7 @@ METCollectionTag_(pset.getParameter<edm::InputTag>("METCollection"))
    muonsCollectionToken_ = consumes<std::vector<edm::FwdPtr<reco::PFCandidate> > >(muonsCollectionTag_);
    electronsCollectionToken_ = consumes<std::vector<edm::FwdPtr<reco::PFCandidate> > >(electronsCollectionTag_);
    METCollectionToken_ = consumes<std::vector<reco::PFMET> >(METCollectionTag_);
-   produces<std::vector<int>>("ntracks");
-   produces<std::vector<int>>("nlambdas");
-   produces<std::vector<int>>("nkshorts");
-   produces<std::vector<int>>("nkshortsAndNlambdas");
-   produces<std::vector<int>>("nPV");
-   produces<std::vector<int>>("nGoodPV");
-   produces<std::vector<float>>("PVx");
-   produces<std::vector<float>>("PVy");
-   produces<std::vector<float>>("PVz");
-   produces<std::vector<float>>("goodPVx");
-   produces<std::vector<float>>("goodPVy");
-   produces<std::vector<float>>("goodPVz");
-
-   produces<std::vector<int>>("njets");
-   produces<std::vector<reco::Particle::LorentzVector>>("TwoTopJets");
-   produces<std::vector<int>>("nmuons");
-   produces<std::vector<int>>("nelectrons");
-   produces<std::vector<double>>("HT");
-   produces<std::vector<double>>("TKHT");
-   produces<std::vector<LorentzVector>>("MET");
-   produces<std::vector<math::XYZVector>>("TKMET");
+   produces<EventSummary>();
   
 }
 
@@ -161,21 +145,34 @@ InitialProducer::~InitialProducer()
 
 // ------------ method called to produce the data  ------------
 void
-InitialProducer::produce(edm::Event& iEvent, const edm::EventSetup& iSetup)
+InitialProducer::produce(edm::StreamID, edm::Event& iEvent, const edm::EventSetup& iSetup) const
 {
    using namespace edm;
    using namespace reco; 
    using namespace std;
   //std::cout << "InitialProducer: starting for a new event" << std::endl; 
-  //ntracks part
+  //everything goes in one EventSummary, filled with a single pass over each collection
+  auto summary = std::make_unique<EventSummary>();
+
+  //ntracks, TKMET and TKHT part 
+  //TKMET: calculate the missing pT from the tracks: so sum all the tracks and take the minus sign
+  //TKHT: scalar sim of all track pts
   edm::Handle<std::vector<reco::Track >> h_tracks;
   iEvent.getByToken(tracksCollectionToken_, h_tracks);
   if(!h_tracks.isValid()) {
       std::cout << "Missing collection during InitialProducer : " << trackCollectionTag_ << " ... skip entry !" << std::endl;
   }
-  auto ntracks = std::make_unique<std::vector<int>>();
-  ntracks->push_back((int)h_tracks->size());
-  iEvent.put(std::move(ntracks), "ntracks");
+  else {
+      math::XYZVector sumTK(0,0,0);
+      double sumTrackpT = 0;
+      for(auto const& track : *h_tracks) {
+	//sumTK = sumTK - track.innerMomentum();
+	sumTrackpT = sumTrackpT + track.pt();
+      }
+      summary->ntracks = (int)h_tracks->size();
+      summary->TKMET = sumTK;
+      summary->TKHT = sumTrackpT;
+  }
 
   //nlambdas part
   edm::Handle<std::vector<reco::VertexCompositeCandidate> > h_lambdas;
@@ -183,9 +180,7 @@ InitialProducer::produce(edm::Event& iEvent, const edm::EventSetup& iSetup)
   if(!h_lambdas.isValid()) {
       std::cout << "Missing collection during InitialProducer : " << lambdaCollectionTag_ << " ... skip entry !" << std::endl;
   }
-  auto nlambdas = std::make_unique<std::vector<int>>();
-  nlambdas->push_back((int)h_lambdas->size());
-  iEvent.put(std::move(nlambdas), "nlambdas");
+  else summary->nlambdas = (int)h_lambdas->size();
 
   //nkshorts part
   edm::Handle<std::vector<reco::VertexCompositeCandidate> > h_kshorts;
@@ -193,24 +188,10 @@ InitialProducer::produce(edm::Event& iEvent, const edm::EventSetup& iSetup)
   if(!h_kshorts.isValid()) {
       std::cout << "Missing collection during InitialProducer : " << kshortCollectionTag_ << " ... skip entry !" << std::endl;
   }
-  auto nkshorts = std::make_unique<std::vector<int>>();
-  nkshorts->push_back((int)h_kshorts->size());
-  iEvent.put(std::move(nkshorts), "nkshorts");
+  else summary->nkshorts = (int)h_kshorts->size();
 
   //nkshorts and nlambdas part: if at least 1 kshort and at least 1 lambda is present then there is the potential to reconstruct an S
-  auto nkshortsAndNlambdas = std::make_unique<std::vector<int>>();
-  int nkshort_and_nlambdas_present = 0;
-/*  if((int)h_kshorts->size() >= 1) std::cout << "InitialProducer: Found " << (int)h_kshorts->size() << "kshorts" << std::endl;
-  if((int)h_lambdas->size() >= 1) std::cout << "InitialProduer: Found " << (int)h_lambdas->size() << "lambdas" << std::endl;
-  if((int)h_kshorts->size() >= 1 && (int)h_lambdas->size() >= 1) std::cout << "InitialProducer: Found both a kshort and a lambda: " << std::endl;
-  for(int k = 0; k<(int)h_kshorts->size(); k++){
-	std::cout << "Initialproducer: kshort " << k << "px,py,pz: " << h_kshorts->at(k).px() << "," << h_kshorts->at(k).py() << "," << h_kshorts->at(k).pz() << std::endl; 
-  }
-  for(int l = 0; l<(int)h_lambdas->size(); l++){
-	std::cout << "Initialproducer: lambda " << l << "px,py,pz: " << h_lambdas->at(l).px() << "," << h_lambdas->at(l).py() << "," << h_lambdas->at(l).pz() << std::endl; 
-  }*/
-  nkshortsAndNlambdas->push_back((int) nkshort_and_nlambdas_present);
-  iEvent.put(std::move(nkshortsAndNlambdas), "nkshortsAndNlambdas");
+  summary->nkshortsAndNlambdas = (summary->nkshorts >= 1 && summary->nlambdas >= 1) ? 1 : 0;
 
   //nPVs part
   edm::Handle<std::vector<reco::Vertex> > h_PVs;
@@ -218,80 +199,45 @@ InitialProducer::produce(edm::Event& iEvent, const edm::EventSetup& iSetup)
   if(!h_PVs.isValid()) {
       std::cout << "Missing collection during InitialProducer : " << offlinePrimaryVerticesCollectionTag_ << " ... skip entry !" << std::endl;
   }
-
-  auto _nPV = std::make_unique<std::vector<int>>();
-  auto _nGoodPV = std::make_unique<std::vector<int>>();
-  auto _PVx= std::make_unique<std::vector<float>>();
-  auto _PVy= std::make_unique<std::vector<float>>();
-  auto _PVz= std::make_unique<std::vector<float>>();
-  auto _goodPVx= std::make_unique<std::vector<float>>();
-  auto _goodPVy= std::make_unique<std::vector<float>>();
-  auto _goodPVz= std::make_unique<std::vector<float>>();
-
-  int nPVs = 0;
-  int ngoodPVs = 0;
-  if(h_PVs.isValid()){
-	for(unsigned int i = 0; i < h_PVs->size(); i++ ){
-		if(h_PVs->at(i).isValid()){
-			nPVs++;
-			_PVx->push_back(h_PVs->at(i).x());
-			_PVy->push_back(h_PVs->at(i).y());
-			_PVz->push_back(h_PVs->at(i).z());
-		}
-		if(h_PVs->at(i).isValid() && h_PVs->at(i).tracksSize() >= 4){
-			ngoodPVs++;
-			_goodPVx->push_back(h_PVs->at(i).x());
-			_goodPVy->push_back(h_PVs->at(i).y());
-			_goodPVz->push_back(h_PVs->at(i).z());
+  else {
+	summary->PVx.reserve(h_PVs->size());
+	summary->PVy.reserve(h_PVs->size());
+	summary->PVz.reserve(h_PVs->size());
+	for(auto const& PV : *h_PVs){
+		if(!PV.isValid()) continue;
+		summary->nPV++;
+		summary->PVx.push_back(PV.x());
+		summary->PVy.push_back(PV.y());
+		summary->PVz.push_back(PV.z());
+		if(PV.tracksSize() >= 4){
+			summary->nGoodPV++;
+			summary->goodPVx.push_back(PV.x());
+			summary->goodPVy.push_back(PV.y());
+			summary->goodPVz.push_back(PV.z());
 		}
 	}
   }
 
-  _nPV->push_back(nPVs);
-  _nGoodPV->push_back(ngoodPVs);
-  iEvent.put(std::move(_nPV), "nPV");
-  iEvent.put(std::move(_nGoodPV), "nGoodPV");
-  iEvent.put(std::move(_PVx), "PVx");
-  iEvent.put(std::move(_PVy), "PVy");
-  iEvent.put(std::move(_PVz), "PVz");
-  iEvent.put(std::move(_goodPVx), "goodPVx");
-  iEvent.put(std::move(_goodPVy), "goodPVy");
-  iEvent.put(std::move(_goodPVz), "goodPVz");
-
   //njets part and HT part
   edm::Handle<std::vector<reco::PFJet> > h_jets;
   iEvent.getByToken(ak4PFJetsCollectionToken_, h_jets);
   if(!h_jets.isValid()) {
       std::cout << "Missing collection during InitialProducer : " << ak4PFJetsCollectionTag_ << " ... skip entry !" << std::endl;
   }
-  auto njets = std::make_unique<std::vector<int>>();
-  njets->push_back((int)h_jets->size());
-  iEvent.put(std::move(njets), "njets");
-
-  //select the 2 jets with highest momentum
-  auto TwoTopJets = std::make_unique<std::vector<reco::PFJet>>();
-  reco::PFJet dummyPFJet; 
-  TwoTopJets->push_back(dummyPFJet); 
-  TwoTopJets->push_back(dummyPFJet);
-  double sumJetpT = 0;
-  for (unsigned int j = 0; j < h_jets->size(); ++j) {
-
-	double thisJetMomentum = h_jets->at(j).p();
-	if(thisJetMomentum > TwoTopJets->at(0).p()) TwoTopJets->at(0)  = h_jets->at(j);
-	else if(thisJetMomentum > TwoTopJets->at(1).p()) TwoTopJets->at(1)  = h_jets->at(j);
-        
-	sumJetpT = sumJetpT + h_jets->at(j).pt();
- 
+  else {
+	//select the nTopJets jets with highest momentum, only their indices are sorted, the jets themselves are not copied
+	std::vector<unsigned int> topJetIndices;
+	sexaq::topKIndices(*h_jets, nTopJets_, [](const reco::PFJet& jet){ return jet.p(); }, topJetIndices);
+	summary->topJets.reserve(topJetIndices.size());
+	for(unsigned int j : topJetIndices) summary->topJets.push_back(h_jets->at(j).p4());
+
+	double sumJetpT = 0;
+	for(auto const& jet : *h_jets) sumJetpT = sumJetpT + jet.pt();
+	summary->njets = (int)h_jets->size();
+	summary->HT = sumJetpT;
   }
- 
-  auto highestMomentJetsLorentzVectors = std::make_unique<std::vector<reco::Particle::LorentzVector>>();
-  highestMomentJetsLorentzVectors->push_back(TwoTopJets->at(0).p4());
-  highestMomentJetsLorentzVectors->push_back(TwoTopJets->at(1).p4());
-  iEvent.put(std::move(highestMomentJetsLorentzVectors), "TwoTopJets");
-
-  auto HT = std::make_unique<std::vector<double>>();
-  HT->push_back(sumJetpT);
-  iEvent.put(std::move(HT), "HT");
+  //as the old TwoTopJets product: always nTopJets_ entries, padded with zero four-vectors if the event has less jets (or no jet collection)
+  summary->topJets.resize(nTopJets_);
 
   //nmuons part
   edm::Handle<std::vector<edm::FwdPtr<reco::PFCandidate>> > h_muons;
@@ -299,9 +245,7 @@ InitialProducer::produce(edm::Event& iEvent, const edm::EventSetup& iSetup)
   if(!h_muons.isValid()) {
       std::cout << "Missing collection during InitialProducer : " << muonsCollectionTag_ << " ... skip entry !" << std::endl;
   }
-  auto nmuons = std::make_unique<std::vector<int>>();
-  nmuons->push_back((int)h_muons->size());
-  iEvent.put(std::move(nmuons), "nmuons");
+  else summary->nmuons = (int)h_muons->size();
 
   //nelectrons part
   edm::Handle<std::vector<edm::FwdPtr<reco::PFCandidate>> > h_electrons;
@@ -309,49 +253,18 @@ InitialProducer::produce(edm::Event& iEvent, const edm::EventSetup& iSetup)
   if(!h_electrons.isValid()) {
       std::cout << "Missing collection during InitialProducer : " << electronsCollectionTag_ << " ... skip entry !" << std::endl;
   }
-  auto nelectrons = std::make_unique<std::vector<int>>();
-  nelectrons->push_back((int)h_electrons->size());
-  iEvent.put(std::move(nelectrons), "nelectrons");
+  else summary->nelectrons = (int)h_electrons->size();
 
   //MET part
   edm::Handle<vector<reco::PFMET> > h_MET;
   iEvent.getByToken(METCollectionToken_, h_MET);
-  if(!h_MET.isValid()) {
+  if(!h_MET.isValid() || h_MET->empty()) {
       std::cout << "Missing collection during InitialProducer : " << METCollectionTag_ << " ... skip entry !" << std::endl;
   }
-  auto MET = std::make_unique<std::vector<LorentzVector>>();
-  MET->push_back(h_MET->at(0).p4()); 
-  iEvent.put(std::move(MET), "MET");
+  else summary->MET = h_MET->at(0).p4(); 
 
-  //TKMET and TKHT part 
-  //TKMET: calculate the missing pT from the tracks: so sum all the tracks and take the minus sign
-  //TKHT: scalar sim of all track pts
-  math::XYZVector sumTK(0,0,0);
-  double sumTrackpT = 0;
-  for(unsigned int j = 0; j < h_tracks->size(); ++j) {
-	//sumTK = sumTK - h_tracks->at(j).innerMomentum();
-	sumTrackpT = sumTrackpT + h_tracks->at(j).pt();
-  }	
-  auto TKMET = std::make_unique<std::vector<math::XYZVector>>();
-  TKMET->push_back(sumTK);
-  iEvent.put(std::move(TKMET), "TKMET");
-
-  auto TKHT = std::make_unique<std::vector<double>>();
-  TKHT->push_back(sumTrackpT);
-  iEvent.put(std::move(TKHT), "TKHT");
-
-
-}
+  iEvent.put(std::move(summary));
 
-// ------------ method called once each stream before processing any runs, lumis or events  ------------
-void
-InitialProducer::beginStream(edm::StreamID)
-{
-}
-
-// ------------ method called once each stream after processing all runs, lumis and events  ------------
-void
-InitialProducer::endStream() {
 }
 
 // ------------ method called when starting to processes a run  ------------
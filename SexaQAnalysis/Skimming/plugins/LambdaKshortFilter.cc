@@ -29,7 +29,7 @@ LambdaKshortFilter::LambdaKshortFilter(edm::ParameterSet const& pset):
 }
 
 
-bool LambdaKshortFilter::filter(edm::Event & iEvent, edm::EventSetup const & iSetup)
+bool LambdaKshortFilter::filter(edm::StreamID, edm::Event & iEvent, edm::EventSetup const & iSetup) const
 {
   auto kshorts = std::make_unique<reco::CandidatePtrVector>();
   auto lambdas = std::make_unique<reco::CandidatePtrVector>();
@@ -61,6 +61,11 @@ bool LambdaKshortFilter::filter(edm::Event & iEvent, edm::EventSetup const & iSe
       }
     }
 
+    // collect the momenta of the daughters of the selected lambdas once, so the overlap check for each kshort is a lookup instead of a loop over all lambdas
+    sexaq::DaughterMomentumSet lambdaDaughterMomenta;
+    lambdaDaughterMomenta.reserve(2*lambdas->size());
+    for (auto const& lptr : *lambdas) lambdaDaughterMomenta.insertDaughters(*lptr);
+
     // select the kshorts passing kinematic cuts and non-overlapping with lambdas
     for (unsigned int k = 0; k < h_kshort->size(); ++k) {
       if (h_kshort->at(k).pt()       > minPtKshort_   &&
@@ -68,25 +73,9 @@ bool LambdaKshortFilter::filter(edm::Event & iEvent, edm::EventSetup const & iSe
 	  h_kshort->at(k).mass()     > minMassKshort_ &&
 	  h_kshort->at(k).mass()     < maxMassKshort_) {
         edm::Ptr<reco::VertexCompositeCandidate> kptr(h_kshort,k);
-	// check for overlaps with the lambdas, and keep the lambda in case
-        bool overlap = false;
-        for (auto lptr : *lambdas) {
-          for (unsigned int li = 0; li < lptr->numberOfDaughters() && !overlap; ++li) {
-            for (unsigned int ki = 0; ki < kptr->numberOfDaughters() && !overlap; ++ki) {
-	      if (lptr->daughter(li)->px() == kptr->daughter(ki)->px() &&
-	          lptr->daughter(li)->py() == kptr->daughter(ki)->py() &&
-	          lptr->daughter(li)->pz() == kptr->daughter(ki)->pz()) {
-                overlap = true;
-	      }
-	    }
-          }
-          if (overlap){
-		 //std::cout << "LambdaKshortFilter: OVERLAP FOUND" << std::endl;
-		 break;
-	  }	
-        }
-        if (!overlap) kshorts->push_back(std::move(kptr));
-      //  kshorts->push_back(std::move(kptr));
+	// check for overlaps with the lambdas: a kshort with a daughter of exactly the same momentum as a daughter of any of the lambdas is dropped, and the lambda is kept
+        if (!lambdaDaughterMomenta.sharesMomentum(*kptr)) kshorts->push_back(std::move(kptr));
+	//else std::cout << "LambdaKshortFilter: OVERLAP FOUND" << std::endl;
       }
     }
 
@@ -137,8 +126,8 @@ bool LambdaKshortFilter::filter(edm::Event & iEvent, edm::EventSetup const & iSe
 
   // throw away events on data without sufficient lambdas or kshorts
   if (nl < minNrLambda_ || nk < minNrKshort_) {
-    ++nreject_;
-    return (prescaleFalse_ ? !(nreject_ % prescaleFalse_) : false);
+    unsigned int nreject = ++nreject_;
+    return (prescaleFalse_ ? !(nreject % prescaleFalse_) : false);
   }
   // if we reach here there's a sufficient number of good lambdas and kshorts
  
@@ -2,7 +2,7 @@
 #define LambdaKshortFilter_h
  
 #include "FWCore/Framework/interface/Event.h"
-#include "FWCore/Framework/interface/EDFilter.h"
+#include "FWCore/Framework/interface/global/EDFilter.h"
 #include "FWCore/ParameterSet/interface/ParameterSet.h"
 
 #include "FWCore/Framework/interface/EventSetup.h"
@@ -10,17 +10,20 @@
 
 #include "DataFormats/Candidate/interface/VertexCompositeCandidate.h"
 #include "DataFormats/HepMCCandidate/interface/GenParticle.h"
+#include "DataFormats/TrackReco/interface/Track.h"
+#include "SexaQAnalysis/Skimming/interface/DaughterMomentumSet.h"
 
 #include <vector>
+#include <atomic>
 
   
-class LambdaKshortFilter : public edm::EDFilter {
+class LambdaKshortFilter : public edm::global::EDFilter<> {
 
   public:
 
     explicit LambdaKshortFilter(edm::ParameterSet const& cfg);
     virtual ~LambdaKshortFilter() {}
-    virtual bool filter(edm::Event & iEvent, edm::EventSetup const & iSetup);
+    virtual bool filter(edm::StreamID, edm::Event & iEvent, edm::EventSetup const & iSetup) const override;
 
   private:
   
@@ -37,7 +40,9 @@ class LambdaKshortFilter : public edm::EDFilter {
     double       minMassLambda_, minMassKshort_;
     double       maxMassLambda_, maxMassKshort_;
     bool checkLambdaDaughters_;
-    unsigned int prescaleFalse_, nreject_;
+    unsigned int prescaleFalse_;
+    //shared by all streams, hence atomic
+    mutable std::atomic<unsigned int> nreject_;
 
 };
 
@@ -3,22 +3,71 @@ using namespace reco;
 using namespace edm;
 using namespace std;
 
-LambdaKshortVertexFilter::LambdaKshortVertexFilter(edm::ParameterSet const& pset):
+//unpack the kinematic state of a fitted V0 once, so it does not have to be done again for every pair it is used in
+void V0FitCache::push_back(const RefCountedKinematicParticle& fittedParticle, const RefCountedKinematicVertex& fittedVertex, int fittedCharge){
+  const KinematicState state = fittedParticle->currentState();
+  const GlobalVector momentum = state.globalMomentum();
+  double m = state.kinematicParameters().mass();
+  double E = sqrt(momentum.x()*momentum.x()+momentum.y()*momentum.y()+momentum.z()*momentum.z()+m*m);
+  particle.push_back(fittedParticle);
+  p4.push_back(reco::Particle::LorentzVector(momentum.x(),momentum.y(),momentum.z(),E));
+  decayPoint.push_back(math::XYZPoint(fittedVertex->position().x(),fittedVertex->position().y(),fittedVertex->position().z()));
+  charge.push_back(fittedCharge);
+}
+
+//a new kinematic particle from the stored state, without a link to the tree or the transient tracks it was fitted from
+void V0FitCache::push_back(const V0StateArrays& states, unsigned int i, const MagneticField* field){
+  VirtualKinematicParticleFactory factory;
+  const KinematicState state(KinematicParameters(states.parameters[i]), KinematicParametersError(states.covariance[i]), states.particleCharge[i], field);
+  float chi2 = states.chi2[i];
+  float ndf = states.ndf[i];
+  particle.push_back(factory.particle(state, chi2, ndf, ReferenceCountingPointer<KinematicParticle>(0)));
+  p4.push_back(states.p4[i]);
+  decayPoint.push_back(states.decayPoint[i]);
+  charge.push_back(states.charge[i]);
+}
+
+//copy the fitted V0s out of their kinematic particles
+void V0StateArrays::assign(const V0FitCache& fits){
+  parameters.clear(); covariance.clear(); particleCharge.clear(); chi2.clear(); ndf.clear();
+  for(const RefCountedKinematicParticle& fittedParticle : fits.particle){
+    const KinematicState state = fittedParticle->currentState();
+    parameters.push_back(state.kinematicParameters().vector());
+    covariance.push_back(state.kinematicParametersError().matrix());
+    particleCharge.push_back(state.particleCharge());
+    chi2.push_back(fittedParticle->chiSquared());
+    ndf.push_back(fittedParticle->degreesOfFreedom());
+  }
+  p4 = fits.p4;
+  decayPoint = fits.decayPoint;
+  charge = fits.charge;
+}
+
+LambdaKshortVertexFilter::LambdaKshortVertexFilter(edm::ParameterSet const& pset, const LambdaKshortVertexFilterCounters*):
   //collections
   lambdaCollectionTag_		(pset.getParameter<edm::InputTag>("lambdaCollection")),
   kshortCollectionTag_		(pset.getParameter<edm::InputTag>("kshortCollection")),
   genCollectionTag_  		(pset.getParameter<edm::InputTag>("genparticlesCollection")),
   //parameters
-  maxchi2ndofVertexFit_  	(pset.getParameter<double>("maxchi2ndofVertexFit"))
+  maxchi2ndofVertexFit_  	(pset.getParameter<double>("maxchi2ndofVertexFit")),
+  preselectPairs_  		(pset.getParameter<bool>("preselectPairs")),
+  checkPreselection_  		(pset.getParameter<bool>("checkPreselection")),
+  maxDCAV0FlightLines_  	(pset.getParameter<double>("maxDCAV0FlightLines")),
+  nPhiBuckets_  		(std::max(1u,pset.getParameter<unsigned int>("nPhiBuckets"))),
+  zBucketWidth_  		(pset.getParameter<double>("zBucketWidth")),
+  nMixedEvents_  		(pset.getParameter<unsigned int>("nMixedEvents"))
 {
+  nZBuckets_ = std::max(1,(int)ceil(2*zBucketHalfLength_/zBucketWidth_));
+  kshortBuckets_.resize(nPhiBuckets_*nZBuckets_);
   //collections
   lambdaCollectionToken_ = consumes<reco::CandidatePtrVector>(lambdaCollectionTag_);
   kshortCollectionToken_ = consumes<reco::CandidatePtrVector>(kshortCollectionTag_);
   genCollectionToken_    = consumes<std::vector<reco::GenParticle> > (genCollectionTag_);
   //producer
   produces<std::vector<reco::VertexCompositeCandidate> >("sParticles");
-  //the reconstruction of X events S and Sbar is disabled for now as it was giving a mysterious seg violation
-//  produces<std::vector<reco::VertexCompositeCandidate> >("sParticlesXEvent");
+  //S and Sbar reconstructed from a Lambda of this event and a Kshort of one of the nMixedEvents_ previous events of this stream, for background modelling
+  kshortMixingBuffer_.resize(nMixedEvents_);
+  if(nMixedEvents_ > 0) produces<std::vector<reco::VertexCompositeCandidate> >("sParticlesXEvent");
 
 }
 
@@ -27,17 +76,13 @@ LambdaKshortVertexFilter::LambdaKshortVertexFilter(edm::ParameterSet const& pset
 bool LambdaKshortVertexFilter::filter(edm::Event & iEvent, edm::EventSetup const & iSetup)
 { 
 
-  static std::vector<RefCountedKinematicParticle> kshortKinFittedPrevEvent;
-  static std::vector<RefCountedKinematicVertex> kshortKinFittedVertexPrevEvent;
-
-
   // initialize the transient track builder
   edm::ESHandle<TransientTrackBuilder> theB;
   iSetup.get<TransientTrackRecord>().get("TransientTrackBuilder",theB);
 
   //these are for the producer
   auto sParticles = std::make_unique<std::vector<reco::VertexCompositeCandidate> >();
-//  auto sParticlesXEvent = std::make_unique<std::vector<reco::VertexCompositeCandidate> >();
+  auto sParticlesXEvent = std::make_unique<std::vector<reco::VertexCompositeCandidate> >();
 
 
   // collections
@@ -57,10 +102,11 @@ bool LambdaKshortVertexFilter::filter(edm::Event & iEvent, edm::EventSetup const
   }
  
 
-  //to save the results from the kinfit
-  std::vector<int> chargeProton;
-  std::vector<RefCountedKinematicParticle> lambdaKinFitted, kshortKinFitted;
-  std::vector<RefCountedKinematicVertex> lambdaKinFittedVertex, kshortKinFittedVertex;
+  //to save the results from the kinfit: one entry per V0, filled once per event
+  lambdaFitCache_.clear();
+  kshortFitCache_.clear();
+  lambdaFitCache_.reserve(h_lambda->size());
+  kshortFitCache_.reserve(h_kshort->size());
 
   
   // loop over all the lambdas in an event
@@ -82,22 +128,20 @@ bool LambdaKshortVertexFilter::filter(edm::Event & iEvent, edm::EventSetup const
       TrackV0LambdasDaughterProton = V0LambdasDaughter2->bestTrack();
       TrackV0LambdasDaughterPion = V0LambdasDaughter1->bestTrack();
     }
-    //save the charge of the proton: if pos then we know the lamda was a particle if neg we know it was an antilambda
-    chargeProton.push_back(TrackV0LambdasDaughterProton->charge());
     //get the ttracks
     TransientTrack TTrackV0LambdasDaughterProton = (*theB).build(TrackV0LambdasDaughterProton);
     TransientTrack TTrackV0LambdasDaughterPion = (*theB).build(TrackV0LambdasDaughterPion);
     //now do a kinfit on the two transient tracks from the lambda
     RefCountedKinematicTree LambdaTree = KinfitTwoTTracks(TTrackV0LambdasDaughterPion, TTrackV0LambdasDaughterProton, charged_pi_mass, charged_pi_mass_sigma, proton_mass, proton_mass_sigma, LambdaMass, LambdaMassSigma);
+    nV0Fits_++;
     //check if the LambdaTree is not a null pointer, isValid and is not empty. i.e.: the fit succeeded
     if(!checkRefCountedKinematicTree(LambdaTree)){
 //	cout << "Lambda tree not succesfully build" << endl; 
 	return false;
     }
-    //get the Lambda particle from the tree and save it to a vector
+    //get the Lambda particle from the tree and save it in the cache, together with the charge of the proton: if pos then we know the lamda was a particle if neg we know it was an antilambda
     LambdaTree->movePointerToTheTop();
-    lambdaKinFitted.push_back(LambdaTree->currentParticle());
-    lambdaKinFittedVertex.push_back(LambdaTree->currentDecayVertex());
+    lambdaFitCache_.push_back(LambdaTree->currentParticle(), LambdaTree->currentDecayVertex(), TrackV0LambdasDaughterProton->charge());
   }
 
 
@@ -117,11 +161,11 @@ bool LambdaKshortVertexFilter::filter(edm::Event & iEvent, edm::EventSetup const
     TransientTrack TTrackV0KaonsDaughter2 = (*theB).build(TrackV0KaonsDaughter2);
     //now do a kinfit to the two transient tracks
     RefCountedKinematicTree  KshortTree = KinfitTwoTTracks(TTrackV0KaonsDaughter1, TTrackV0KaonsDaughter2, charged_pi_mass, charged_pi_mass_sigma, charged_pi_mass, charged_pi_mass_sigma, KshortMass, KshortMassSigma);
+    nV0Fits_++;
     if(!checkRefCountedKinematicTree(KshortTree)){cout << "Kshort tree not succesfully build" << endl; return false;}
-    //get the Kshort particle from the tree and put in a vector
+    //get the Kshort particle from the tree and put it in the cache
    KshortTree->movePointerToTheTop(); 
-   kshortKinFitted.push_back(KshortTree->currentParticle());
-   kshortKinFittedVertex.push_back(KshortTree->currentDecayVertex());
+   kshortFitCache_.push_back(KshortTree->currentParticle(), KshortTree->currentDecayVertex(), 0);
 
   }
 
@@ -133,11 +177,13 @@ bool LambdaKshortVertexFilter::filter(edm::Event & iEvent, edm::EventSetup const
   }//end isMC
 
 
-  for (unsigned int l = 0; l < lambdaKinFitted.size(); ++l) {
-    for(unsigned int k = 0; k < kshortKinFitted.size(); ++k){
+  indexKshorts(kshortFitCache_);
+  for (unsigned int l = 0; l < lambdaFitCache_.size(); ++l) {
+    selectPairCandidates(lambdaFitCache_,l,kshortFitCache_,sameEventPairs);
+    checkPrunedPairs(lambdaFitCache_,l,kshortFitCache_,sameEventPairs);
+    for(unsigned int k : pairCandidates_){
 
-      int cProton =  chargeProton[l];
-      reco::VertexCompositeCandidate S = FitS(lambdaKinFitted.at(l),kshortKinFitted.at(k),lambdaKinFittedVertex.at(l),kshortKinFittedVertex.at(k),cProton);
+      reco::VertexCompositeCandidate S = FitS(lambdaFitCache_,l,kshortFitCache_,k);
 
        //adding Sparticles to the event
       if(S.vertexNdof() != 999.){
@@ -146,49 +192,196 @@ bool LambdaKshortVertexFilter::filter(edm::Event & iEvent, edm::EventSetup const
     }//end loop over kshort
   }//end loop over lambda
 
-  //std::cout << "size of lambdaKinFitted and kshortKinFittedPrevEvent: " << lambdaKinFitted.size() << " " << kshortKinFittedPrevEvent.size() << std::endl;
-  for (unsigned int l = 0; l < lambdaKinFitted.size(); ++l) {
-    for(unsigned int k = 0; k < kshortKinFittedPrevEvent.size(); ++k){
-
-      //std::cout << "l, k = " << l <<  ", " << k << std::endl;
-      int cProton =  chargeProton[l];
-      reco::VertexCompositeCandidate S = FitS(lambdaKinFitted.at(l),kshortKinFittedPrevEvent.at(k),lambdaKinFittedVertex.at(l),kshortKinFittedVertexPrevEvent.at(k),cProton);
-
-       //adding Sparticles to the event
-      if(S.vertexNdof() != 999.){
-//	sParticlesXEvent->push_back(std::move(S)); 
-	//std::cout << "S candidate mass prev event " << S.mass() << std::endl;
-      }
-    }//end loop over kshort
-  }//end loop over lambda
- 
-  //std::cout << "saving " << kshortKinFitted.size() << " Ks for use in the next event" << std::endl;
-
-  kshortKinFittedPrevEvent = kshortKinFitted; 
-  kshortKinFittedVertexPrevEvent = kshortKinFittedVertex;
+  //mix the Lambdas of this event with the Kshorts of the previous events in this stream, starting from the oldest one
+  const MagneticField* magneticField = theB->field();
+  for (unsigned int i = 0; i < nMixingBufferFilled_; ++i) {
+    const V0StateArrays& kshortStatesPrevEvent = kshortMixingBuffer_[(mixingBufferHead_+nMixedEvents_-nMixingBufferFilled_+i)%nMixedEvents_];
+    kshortFitCacheMixed_.clear();
+    kshortFitCacheMixed_.reserve(kshortStatesPrevEvent.size());
+    for (unsigned int k = 0; k < kshortStatesPrevEvent.size(); ++k) kshortFitCacheMixed_.push_back(kshortStatesPrevEvent,k,magneticField);
+    const V0FitCache& kshortFitCachePrevEvent = kshortFitCacheMixed_;
+    indexKshorts(kshortFitCachePrevEvent);
+    for (unsigned int l = 0; l < lambdaFitCache_.size(); ++l) {
+      selectPairCandidates(lambdaFitCache_,l,kshortFitCachePrevEvent,mixedEventPairs);
+      checkPrunedPairs(lambdaFitCache_,l,kshortFitCachePrevEvent,mixedEventPairs);
+      for(unsigned int k : pairCandidates_){
+
+        reco::VertexCompositeCandidate S = FitS(lambdaFitCache_,l,kshortFitCachePrevEvent,k);
+
+         //adding X event Sparticles to the event
+        if(S.vertexNdof() != 999.){
+	  sParticlesXEvent->push_back(std::move(S)); 
+        }
+      }//end loop over kshort
+    }//end loop over lambda
+  }//end loop over previous events
+
+  //save the Ks of this event for the next events in this stream, overwriting the oldest event in the ring buffer
+  if(nMixedEvents_ > 0){
+    kshortMixingBuffer_[mixingBufferHead_].assign(kshortFitCache_);
+    mixingBufferHead_ = (mixingBufferHead_+1)%nMixedEvents_;
+    if(nMixingBufferFilled_ < nMixedEvents_) nMixingBufferFilled_++;
+  }
+  //drop the kinematic particles of this event, only the unpacked states in the mixing buffer are kept for the next events
+  lambdaFitCache_.clear();
+  kshortFitCache_.clear();
+  kshortFitCacheMixed_.clear();
 
   
   int ns = sParticles->size();
   iEvent.put(std::move(sParticles),"sParticles"); 
-//  iEvent.put(std::move(sParticlesXEvent),"sParticlesXEvent"); 
+  if(nMixedEvents_ > 0) iEvent.put(std::move(sParticlesXEvent),"sParticlesXEvent"); 
   return (ns > 0);
 
 }//end filter
 
 
-//fit the Ks and Lambda to an S:
-reco::VertexCompositeCandidate LambdaKshortVertexFilter::FitS(RefCountedKinematicParticle lambdaKinFitted, RefCountedKinematicParticle kshortKinFitted, RefCountedKinematicVertex lambdaKinFittedVertex, RefCountedKinematicVertex kshortKinFittedVertex, int cProton){
-      vector<RefCountedKinematicParticle> daughtersS;
-      daughtersS.push_back(lambdaKinFitted);
-      daughtersS.push_back(kshortKinFitted);
+std::unique_ptr<LambdaKshortVertexFilterCounters> LambdaKshortVertexFilter::initializeGlobalCache(edm::ParameterSet const& pset)
+{
+  auto counters = std::make_unique<LambdaKshortVertexFilterCounters>();
+  counters->checkPreselection = pset.getParameter<bool>("preselectPairs") && pset.getParameter<bool>("checkPreselection");
+  return counters;
+}
+
+
+//add the counters of this stream to the job wide counters
+void LambdaKshortVertexFilter::endStream()
+{
+  globalCache()->nV0Fits += nV0Fits_;
+  globalCache()->nSFits += nSFits_;
+  globalCache()->nSFitsAvoided += nSFitsAvoided_;
+  for(unsigned int t = 0; t < nPairTypes; ++t){
+    globalCache()->nPairs[t] += nPairs_[t];
+    globalCache()->nPairsPrunedBucket[t] += nPairsPrunedBucket_[t];
+    globalCache()->nPairsPrunedDCA[t] += nPairsPrunedDCA_[t];
+    globalCache()->nPairsPrunedAccepted[t] += nPairsPrunedAccepted_[t];
+  }
+}
+
+
+void LambdaKshortVertexFilter::globalEndJob(const LambdaKshortVertexFilterCounters* counters)
+{
+  std::cout << "LambdaKshortVertexFilter: number of V0 kinematic fits: " << counters->nV0Fits << std::endl;
+  std::cout << "LambdaKshortVertexFilter: number of S vertex fits: " << counters->nSFits << std::endl;
+  //the V0 fits were always done once per V0, the fits the filter can avoid are the S vertex fits of the pairs rejected by the pre-selection (0 with preselectPairs off or with checkPreselection)
+  std::cout << "LambdaKshortVertexFilter: number of S vertex fits avoided by the pair pre-selection: " << counters->nSFitsAvoided << std::endl;
+  const char* pairTypeNames[nPairTypes] = {"same event", "mixed event"};
+  for(unsigned int t = 0; t < nPairTypes; ++t){
+    unsigned long long nPruned = counters->nPairsPrunedBucket[t]+counters->nPairsPrunedDCA[t];
+    double fractionPruned = counters->nPairs[t] > 0 ? (double)nPruned/counters->nPairs[t] : 0.;
+    std::cout << "LambdaKshortVertexFilter: number of " << pairTypeNames[t] << " Lambda-Kshort pairs: " << counters->nPairs[t] << ", pruned by the (phi,z) buckets: " << counters->nPairsPrunedBucket[t] << ", pruned by the DCA of the V0 flight lines: " << counters->nPairsPrunedDCA[t] << ", pruned fraction: " << fractionPruned << std::endl;
+    //with checkPreselection: the pruned pairs which give an S passing maxchi2ndofVertexFit, i.e. the S candidates lost by the pre-selection
+    if(counters->checkPreselection && nPruned > 0) std::cout << "LambdaKshortVertexFilter: " << pairTypeNames[t] << " S candidates lost by the pair pre-selection: " << counters->nPairsPrunedAccepted[t] << std::endl;
+  }
+}
+
+
+//bucket of the azimuthal angle of the V0 decay vertex
+unsigned int LambdaKshortVertexFilter::phiBucket(const Point& decayPoint) const
+{
+  unsigned int bucket = (unsigned int)((decayPoint.phi()+M_PI)/(2*M_PI)*nPhiBuckets_);
+  return std::min(bucket,nPhiBuckets_-1);
+}
+
+
+//bucket of the z position of the V0 decay vertex
+unsigned int LambdaKshortVertexFilter::zBucket(const Point& decayPoint) const
+{
+  int bucket = (int)floor((decayPoint.z()+zBucketHalfLength_)/zBucketWidth_);
+  return (unsigned int)std::max(0,std::min(bucket,(int)nZBuckets_-1));
+}
+
+
+//sort the Kshorts in (phi, z) buckets of their decay vertex, so for each Lambda only the Kshorts in the neighbouring buckets have to be looked at
+void LambdaKshortVertexFilter::indexKshorts(const V0FitCache& kshorts)
+{
+  for(auto& bucket : kshortBuckets_) bucket.clear();
+  for(unsigned int k = 0; k < kshorts.size(); ++k){
+    kshortBuckets_[phiBucket(kshorts.decayPoint[k])*nZBuckets_+zBucket(kshorts.decayPoint[k])].push_back(k);
+  }
+}
+
+
+//collect in pairCandidates_ the Kshorts to be fitted with Lambda l. With preselectPairs the Kshort decay vertex has to be in a neighbouring (phi, z) bucket and the flight lines of the two V0s have to come closer than maxDCAV0FlightLines,
+//which also drops some pairs that would make a good S vertex
+void LambdaKshortVertexFilter::selectPairCandidates(const V0FitCache& lambdas, unsigned int l, const V0FitCache& kshorts, LambdaKshortPairType type)
+{
+  pairCandidates_.clear();
+  nPairs_[type] += kshorts.size();
+  if(!preselectPairs_){
+    for(unsigned int k = 0; k < kshorts.size(); ++k) pairCandidates_.push_back(k);
+    return;
+  }
+
+  const Point& lambdaPoint = lambdas.decayPoint[l];
+  const Vector lambdaDirection = lambdas.p4[l].Vect();
+  int lambdaPhiBucket = phiBucket(lambdaPoint);
+  int lambdaZBucket = zBucket(lambdaPoint);
+  //with less than 3 phi buckets the neighbouring buckets wrap around onto each other, so look at each of them only once
+  int dPhiMin = nPhiBuckets_ >= 3 ? -1 : 0;
+  int dPhiMax = nPhiBuckets_ >= 2 ? 1 : 0;
+  unsigned int nInBuckets = 0;
+  for(int dPhi = dPhiMin; dPhi <= dPhiMax; ++dPhi){
+    unsigned int iPhi = (lambdaPhiBucket+dPhi+nPhiBuckets_)%nPhiBuckets_;
+    for(int dZ = -1; dZ <= 1; ++dZ){
+      int iZ = lambdaZBucket+dZ;
+      if(iZ < 0 || iZ >= (int)nZBuckets_) continue;
+      for(unsigned int k : kshortBuckets_[iPhi*nZBuckets_+iZ]){
+        nInBuckets++;
+        if(dcaLines(lambdaPoint,lambdaDirection,kshorts.decayPoint[k],kshorts.p4[k].Vect()) > maxDCAV0FlightLines_){
+          nPairsPrunedDCA_[type]++;
+          continue;
+        }
+        pairCandidates_.push_back(k);
+      }
+    }
+  }
+  nPairsPrunedBucket_[type] += kshorts.size()-nInBuckets;
+  if(!checkPreselection_) nSFitsAvoided_ += kshorts.size()-pairCandidates_.size();
+  //keep the same order of the S candidates as without the pre-selection
+  std::sort(pairCandidates_.begin(),pairCandidates_.end());
+}
+
+
+//with checkPreselection: fit the pairs the pre-selection rejected for Lambda l and count the ones which give an S candidate, these are not saved
+void LambdaKshortVertexFilter::checkPrunedPairs(const V0FitCache& lambdas, unsigned int l, const V0FitCache& kshorts, LambdaKshortPairType type)
+{
+  if(!preselectPairs_ || !checkPreselection_) return;
+  //pairCandidates_ is sorted, the pruned pairs are the other Kshorts
+  prunedPairs_.clear();
+  std::vector<unsigned int>::const_iterator candidate = pairCandidates_.begin();
+  for(unsigned int k = 0; k < kshorts.size(); ++k){
+    if(candidate != pairCandidates_.end() && *candidate == k) ++candidate;
+    else prunedPairs_.push_back(k);
+  }
+  for(unsigned int k : prunedPairs_){
+    if(FitS(lambdas,l,kshorts,k).vertexNdof() != 999.) nPairsPrunedAccepted_[type]++;
+  }
+}
+
+
+//analytic distance of closest approach between two lines, each given by a point and a direction
+double LambdaKshortVertexFilter::dcaLines(const Point& point1, const Vector& direction1, const Point& point2, const Vector& direction2)
+{
+  Vector connection = point2 - point1;
+  Vector normal = direction1.Cross(direction2);
+  double normalMag2 = normal.Mag2();
+  //parallel lines: the distance from point2 to line 1
+  if(normalMag2 < 1e-12*direction1.Mag2()*direction2.Mag2()){
+    return sqrt(connection.Cross(direction1).Mag2()/direction1.Mag2());
+  }
+  return fabs(connection.Dot(normal))/sqrt(normalMag2);
+}
+
+
+//fit the Ks and Lambda to an S, taking the fitted Lambda and Ks from the per event cache
+reco::VertexCompositeCandidate LambdaKshortVertexFilter::FitS(const V0FitCache& lambdas, unsigned int l, const V0FitCache& kshorts, unsigned int k){
+      sDaughters_.clear();
+      sDaughters_.push_back(lambdas.particle[l]);
+      sDaughters_.push_back(kshorts.particle[k]);
       //fit the S daughters to a common vertex
-      KinematicParticleVertexFitter kpvFitter;
-      //std::cout << "accessing some info on the lambdaKinFitted" << std::endl;
-      //std::cout << " lambdaKinFitted->currentState().kinematicParameters().mass(): " <<  lambdaKinFitted->currentState().kinematicParameters().mass() << std::endl;
-      //std::cout << "accessing some info on the kshortKinFitted" << std::endl;
-      //std::cout << " kshortKinFitted->currentState().kinematicParameters().mass(): " <<  kshortKinFitted->currentState().kinematicParameters().mass() << std::endl;
-      //std::cout << "going to fit S, size of daughtersS: " << daughtersS.size() << std::endl;
-      RefCountedKinematicTree STree = kpvFitter.fit(daughtersS);
+      RefCountedKinematicTree STree = sVertexFitter_.fit(sDaughters_);
+      nSFits_++;
       //std::cout << "Fitted S" << std::endl;
       Point STreeVertexPointDummy(0.,0.,0.);
       const reco::Particle::LorentzVector SparticlePDummy(0.,0.,0.,0.);
@@ -206,51 +399,27 @@ reco::VertexCompositeCandidate LambdaKshortVertexFilter::FitS(RefCountedKinemati
       if(STreeVertex->chiSquared()/STreeVertex->degreesOfFreedom() > maxchi2ndofVertexFit_)return theSparticleVertexCompositeCandidateDummy;
       //now that you passed cuts you can start making the Sparticle candidate as a VertexCompositeCandidate
       //momentum
-      double S_px = Sparticle->currentState().globalMomentum().x();	
-      double S_py = Sparticle->currentState().globalMomentum().y();	
-      double S_pz = Sparticle->currentState().globalMomentum().z();	
-      double S_m = Sparticle->currentState().kinematicParameters().mass();	
+      const KinematicState SparticleState = Sparticle->currentState();
+      const GlobalVector SparticleMomentum = SparticleState.globalMomentum();
+      double S_px = SparticleMomentum.x();	
+      double S_py = SparticleMomentum.y();	
+      double S_pz = SparticleMomentum.z();	
+      double S_m = SparticleState.kinematicParameters().mass();	
       double S_E = sqrt(S_px*S_px+S_py*S_py+S_pz*S_pz+S_m*S_m);
 
-      const reco::Particle::LorentzVector SparticleP(Sparticle->currentState().globalMomentum().x(), Sparticle->currentState().globalMomentum().y(), Sparticle->currentState().globalMomentum().z(),S_E);
+      const reco::Particle::LorentzVector SparticleP(S_px, S_py, S_pz, S_E);
       //decay vertex
       Point STreeVertexPoint(STreeVertex->position().x(),STreeVertex->position().y(),STreeVertex->position().z()); 
 
       //will use the charge in the VertexCompositeCandidate constructor to indicate if in the decay there is an antiproton present if the antiproton
       //create the S as VertexCompositeCandidate
-      reco::VertexCompositeCandidate theSparticleVertexCompositeCandidate(cProton,SparticleP, STreeVertexPoint);
+      reco::VertexCompositeCandidate theSparticleVertexCompositeCandidate(lambdas.charge[l],SparticleP, STreeVertexPoint);
       theSparticleVertexCompositeCandidate.setCovariance(STreeVertex->error().matrix());
       theSparticleVertexCompositeCandidate.setChi2AndNdof(STreeVertex->chiSquared(),STreeVertex->degreesOfFreedom());
      
-      //making daughters to the Sparticle
-      
-      //Lambda      
-      //momentum
-      double Lambda_px = lambdaKinFitted->currentState().globalMomentum().x();	
-      double Lambda_py = lambdaKinFitted->currentState().globalMomentum().y();	
-      double Lambda_pz = lambdaKinFitted->currentState().globalMomentum().z();	
-      double Lambda_m = lambdaKinFitted->currentState().kinematicParameters().mass();	
-      double E_Lambda = sqrt(Lambda_px*Lambda_px+Lambda_py*Lambda_py+Lambda_pz*Lambda_pz+Lambda_m*Lambda_m);
-      
-      const reco::Particle::LorentzVector LambdaDaughterP(lambdaKinFitted->currentState().globalMomentum().x(), lambdaKinFitted->currentState().globalMomentum().y(), lambdaKinFitted->currentState().globalMomentum().z(),E_Lambda);
-      //vertex
-      const Point LambdaDaughterPoint(lambdaKinFittedVertex->position().x(),lambdaKinFittedVertex->position().y(),lambdaKinFittedVertex->position().z());
-     
-      LeafCandidate LambdaDaughter(0,  LambdaDaughterP, LambdaDaughterPoint);
-      
-      //Kshort
-      //momentum
-      double Kshort_px = kshortKinFitted->currentState().globalMomentum().x();	
-      double Kshort_py = kshortKinFitted->currentState().globalMomentum().y();	
-      double Kshort_pz = kshortKinFitted->currentState().globalMomentum().z();	
-      double Kshort_m = kshortKinFitted->currentState().kinematicParameters().mass();	
-      double E_Kshort = sqrt(Kshort_px*Kshort_px+Kshort_py*Kshort_py+Kshort_pz*Kshort_pz+Kshort_m*Kshort_m);
-      
-      const reco::Particle::LorentzVector KshortDaughterP(kshortKinFitted->currentState().globalMomentum().x(), kshortKinFitted->currentState().globalMomentum().y(), kshortKinFitted->currentState().globalMomentum().z(),E_Kshort);
-      //vertex
-      const Point KshortDaughterPoint(kshortKinFittedVertex->position().x(),kshortKinFittedVertex->position().y(),kshortKinFittedVertex->position().z()); 
-     
-     LeafCandidate KshortDaughter(0,  KshortDaughterP, KshortDaughterPoint);
+      //making daughters to the Sparticle, the momenta and vertices of the Lambda and Kshort were already unpacked in the cache
+      LeafCandidate LambdaDaughter(0, lambdas.p4[l], lambdas.decayPoint[l]);
+      LeafCandidate KshortDaughter(0, kshorts.p4[k], kshorts.decayPoint[k]);
 
      //add daughters to the S
      theSparticleVertexCompositeCandidate.addDaughter(LambdaDaughter);
@@ -2,7 +2,7 @@
 #define LambdaKshortVertexFilter_h
  
 #include "FWCore/Framework/interface/Event.h"
-#include "FWCore/Framework/interface/EDFilter.h"
+#include "FWCore/Framework/interface/stream/EDFilter.h"
 #include "FWCore/ParameterSet/interface/ParameterSet.h"
 
 #include "FWCore/Framework/interface/EventSetup.h"
@@ -24,23 +24,83 @@
 #include "RecoVertex/VertexPrimitives/interface/TransientVertex.h"
 #include "RecoVertex/PrimaryVertexProducer/interface/PrimaryVertexSorter.h"
 #include <vector>
+#include <algorithm>
+#include <atomic>
+#include <memory>
 #include "RecoVertex/KinematicFit/interface/KinematicParticleVertexFitter.h"  
 #include <RecoVertex/KinematicFitPrimitives/interface/KinematicParticleFactoryFromTransientTrack.h>
 #include "RecoVertex/KinematicFit/interface/MassKinematicConstraint.h"
 #include "RecoVertex/KinematicFit/interface/KinematicParticleFitter.h"
+#include "RecoVertex/KinematicFitPrimitives/interface/VirtualKinematicParticleFactory.h"
+#include "RecoVertex/KinematicFitPrimitives/interface/KinematicState.h"
 //#include "FWCore/ServiceRegistry/interface/Service.h"
 #include "DataFormats/BeamSpot/interface/BeamSpot.h"
 #include "DataFormats/Math/interface/Vector.h"
 
-class LambdaKshortVertexFilter : public edm::EDFilter {
+struct V0StateArrays;
+
+//per event cache of the kinematic fits of the V0s. Every V0 is fitted once per event (as it always was) and the quantities needed to build the S candidate are unpacked once, stored as a structure of arrays, so the Lambda x Kshort pair loop only has to do the final S vertex fit
+struct V0FitCache {
+    std::vector<RefCountedKinematicParticle> particle;
+    std::vector<reco::Particle::LorentzVector> p4;
+    std::vector<math::XYZPoint> decayPoint;
+    std::vector<int> charge;
+
+    unsigned int size() const { return particle.size(); }
+    void clear() { particle.clear(); p4.clear(); decayPoint.clear(); charge.clear(); }
+    void reserve(unsigned int n) { particle.reserve(n); p4.reserve(n); decayPoint.reserve(n); charge.reserve(n); }
+    void push_back(const RefCountedKinematicParticle& fittedParticle, const RefCountedKinematicVertex& fittedVertex, int fittedCharge);
+    //rebuild V0 i of states as a kinematic particle in the magnetic field of the current event
+    void push_back(const V0StateArrays& states, unsigned int i, const MagneticField* field);
+};
+
+//the fitted V0s of an event as plain numbers: the kinematic parameters with their covariance and the unpacked quantities of V0FitCache. Unlike V0FitCache it holds no kinematic particles,
+//which point to the kinematic trees and transient tracks of the event they were fitted in, so it can be kept from one event to the next for the event mixing
+struct V0StateArrays {
+    std::vector<AlgebraicVector7> parameters;
+    std::vector<AlgebraicSymMatrix77> covariance;
+    std::vector<TrackCharge> particleCharge;
+    std::vector<float> chi2, ndf;
+    std::vector<reco::Particle::LorentzVector> p4;
+    std::vector<math::XYZPoint> decayPoint;
+    std::vector<int> charge;
+
+    unsigned int size() const { return parameters.size(); }
+    void assign(const V0FitCache& fits);
+};
+
+//the Lambda x Kshort pairs of the same event and the ones with a Kshort of a previous event (event mixing) are counted separately
+enum LambdaKshortPairType { sameEventPairs = 0, mixedEventPairs = 1, nPairTypes = 2 };
+
+//job wide counters: every stream adds its own counts at endStream, they are printed once at endJob
+struct LambdaKshortVertexFilterCounters {
+    mutable std::atomic<unsigned long long> nV0Fits{0};
+    mutable std::atomic<unsigned long long> nSFits{0};
+    mutable std::atomic<unsigned long long> nSFitsAvoided{0};
+    mutable std::atomic<unsigned long long> nPairs[nPairTypes];
+    mutable std::atomic<unsigned long long> nPairsPrunedBucket[nPairTypes];
+    mutable std::atomic<unsigned long long> nPairsPrunedDCA[nPairTypes];
+    mutable std::atomic<unsigned long long> nPairsPrunedAccepted[nPairTypes];
+    //the pruned pairs are fitted to count the lost S candidates
+    bool checkPreselection = false;
+
+    LambdaKshortVertexFilterCounters(){
+      for(unsigned int t = 0; t < nPairTypes; ++t){ nPairs[t] = 0; nPairsPrunedBucket[t] = 0; nPairsPrunedDCA[t] = 0; nPairsPrunedAccepted[t] = 0; }
+    }
+};
+
+class LambdaKshortVertexFilter : public edm::stream::EDFilter<edm::GlobalCache<LambdaKshortVertexFilterCounters> > {
 
   public:
     typedef math::XYZPoint Point;
     typedef math::XYZVector Vector;
 
-    explicit LambdaKshortVertexFilter(edm::ParameterSet const& cfg);
+    explicit LambdaKshortVertexFilter(edm::ParameterSet const& cfg, const LambdaKshortVertexFilterCounters* counters);
+    static std::unique_ptr<LambdaKshortVertexFilterCounters> initializeGlobalCache(edm::ParameterSet const& cfg);
+    static void globalEndJob(const LambdaKshortVertexFilterCounters* counters);
     virtual ~LambdaKshortVertexFilter() {}
-    virtual bool filter(edm::Event & iEvent, edm::EventSetup const & iSetup);
+    virtual bool filter(edm::Event & iEvent, edm::EventSetup const & iSetup) override;
+    virtual void endStream() override;
     ParticleMass charged_pi_mass = 0.13957061;
     ParticleMass KshortMass = 0.497611;
     ParticleMass proton_mass = 0.9382720813;
@@ -53,10 +113,6 @@ class LambdaKshortVertexFilter : public edm::EDFilter {
     //initial chi2 and ndf before kinematic fits. The chi2 of the reconstruction is not considered
     float chi = 0.;
     float ndf = 0.;
- 
-    //for looking X events:
-    //static std::vector<RefCountedKinematicParticle> kshortKinFittedPrevEvent;
-    //static std::vector<RefCountedKinematicVertex> kshortKinFittedVertexPrevEvent;
 
  private:
 
@@ -72,13 +128,58 @@ class LambdaKshortVertexFilter : public edm::EDFilter {
 
     double maxchi2ndofVertexFit_;
 
+    //geometric pre-selection of the Lambda x Kshort pairs before the S vertex fit. It is a speed up which loses S candidates (widely separated or back to back V0s), so it is off by default.
+    //With checkPreselection the rejected pairs are fitted anyway (and not saved), to count the S candidates the pre-selection loses
+    bool preselectPairs_;
+    bool checkPreselection_;
+    double maxDCAV0FlightLines_;
+    unsigned int nPhiBuckets_;
+    double zBucketWidth_;
+    unsigned int nZBuckets_;
+    //half length in z of the region in which the V0 decay vertices are bucketed, vertices outside go to the first or last bucket
+    static constexpr double zBucketHalfLength_ = 300.;
+    //Kshort indices per (phi, z) bucket of their decay vertex and the Kshorts surviving the pre-selection for the current Lambda
+    std::vector<std::vector<unsigned int> > kshortBuckets_;
+    std::vector<unsigned int> pairCandidates_;
+    std::vector<unsigned int> prunedPairs_;
+
+    //the per event fit cache and the fitter for the S vertex, reused for every Lambda x Kshort pair
+    V0FitCache lambdaFitCache_;
+    V0FitCache kshortFitCache_;
+    KinematicParticleVertexFitter sVertexFitter_;
+    std::vector<RefCountedKinematicParticle> sDaughters_;
+
+    //for looking at X events: ring buffer with the fitted Kshorts of the nMixedEvents_ previous events of this stream. A stream module has one instance per stream, so this needs no locking.
+    //Only the unpacked states are kept: kinematic particles held across events were segfaulting. kshortFitCacheMixed_ has the Kshorts of one previous event rebuilt as kinematic particles.
+    //The previous events are the ones this stream happened to process before, so with more than one thread the mixed pairs (sParticlesXEvent) change from job to job
+    unsigned int nMixedEvents_;
+    std::vector<V0StateArrays> kshortMixingBuffer_;
+    V0FitCache kshortFitCacheMixed_;
+    unsigned int mixingBufferHead_ = 0;
+    unsigned int nMixingBufferFilled_ = 0;
+
+    //counters of this stream, added to the job wide counters at endStream
+    unsigned long long nV0Fits_ = 0;
+    unsigned long long nSFits_ = 0;
+    unsigned long long nSFitsAvoided_ = 0;
+    unsigned long long nPairs_[nPairTypes] = {0, 0};
+    unsigned long long nPairsPrunedBucket_[nPairTypes] = {0, 0};
+    unsigned long long nPairsPrunedDCA_[nPairTypes] = {0, 0};
+    unsigned long long nPairsPrunedAccepted_[nPairTypes] = {0, 0};
+
     //functions 
     bool allCollectionValid(edm::Handle<reco::CandidatePtrVector> h_lambda,edm::Handle<reco::CandidatePtrVector> h_kshort);
     bool checkRefCountedKinematicTree(RefCountedKinematicTree Tree); 
     RefCountedKinematicTree KinfitTwoTTracks(reco::TransientTrack ttrack1, reco::TransientTrack ttrack2, ParticleMass trackMass1, float trackMassSigma1, ParticleMass trackMass2, float trackMassSigma2, ParticleMass combinedMass, float combinedMassSigma);
     RefCountedKinematicParticle getTopParticleFromTree(RefCountedKinematicTree Tree);
     RefCountedKinematicVertex returnVertexFromTree(const RefCountedKinematicTree& myTree) const;
-    reco::VertexCompositeCandidate FitS(RefCountedKinematicParticle lambdaKinFitted, RefCountedKinematicParticle kshortKinFitted,RefCountedKinematicVertex lambdaKinFittedVertex, RefCountedKinematicVertex kshortKinFittedVertex, int cProton); 
+    unsigned int phiBucket(const Point& decayPoint) const;
+    unsigned int zBucket(const Point& decayPoint) const;
+    void indexKshorts(const V0FitCache& kshorts);
+    void selectPairCandidates(const V0FitCache& lambdas, unsigned int l, const V0FitCache& kshorts, LambdaKshortPairType type);
+    void checkPrunedPairs(const V0FitCache& lambdas, unsigned int l, const V0FitCache& kshorts, LambdaKshortPairType type);
+    double static dcaLines(const Point& point1, const Vector& direction1, const Point& point2, const Vector& direction2);
+    reco::VertexCompositeCandidate FitS(const V0FitCache& lambdas, unsigned int l, const V0FitCache& kshorts, unsigned int k); 
 };
 
 
@@ -18,7 +18,7 @@ MassFilter::MassFilter(edm::ParameterSet const & pset) :
 }
 
 
-bool MassFilter::filter(edm::Event & iEvent, edm::EventSetup const & iSetup)
+bool MassFilter::filter(edm::StreamID, edm::Event & iEvent, edm::EventSetup const & iSetup) const
 {
 
   edm::Handle<std::vector<reco::VertexCompositeCandidate> > h_lkPair;
@@ -51,8 +51,8 @@ bool MassFilter::filter(edm::Event & iEvent, edm::EventSetup const & iSetup)
 
   // throw away events on data without good lambda-kshort pairs
   if (n == 0) {
-    ++nreject_;
-    return (prescaleFalse_ ? !(nreject_ % prescaleFalse_) : false);
+    unsigned int nreject = ++nreject_;
+    return (prescaleFalse_ ? !(nreject % prescaleFalse_) : false);
   }
   // if we reach here there's a good lambda-kshort pair
   return true;
@@ -2,7 +2,7 @@
 #define MassFilter_h
  
 #include "FWCore/Framework/interface/Event.h"
-#include "FWCore/Framework/interface/EDFilter.h"
+#include "FWCore/Framework/interface/global/EDFilter.h"
 #include "FWCore/ParameterSet/interface/ParameterSet.h"
 #include "FWCore/Framework/interface/EventSetup.h"
 #include "FWCore/Framework/interface/Frameworkfwd.h"
@@ -10,21 +10,25 @@
 #include "DataFormats/Candidate/interface/VertexCompositeCandidate.h"
 #include "DataFormats/Candidate/interface/VertexCompositePtrCandidate.h"
 
+#include <atomic>
+
   
-class MassFilter : public edm::EDFilter {
+class MassFilter : public edm::global::EDFilter<> {
 
   public:
 
     explicit MassFilter(edm::ParameterSet const& cfg);
     virtual ~MassFilter() {}
-    virtual bool filter(edm::Event & iEvent, edm::EventSetup const & iSetup);
+    virtual bool filter(edm::StreamID, edm::Event & iEvent, edm::EventSetup const & iSetup) const override;
 
   private:
 
     edm::InputTag lkPairCollectionTag_;
     edm::EDGetTokenT<std::vector<reco::VertexCompositeCandidate> > lkPairCollectionToken_;
     double minMass_, maxMass_, targetMass_;
-    unsigned int prescaleFalse_, nreject_;
+    unsigned int prescaleFalse_;
+    //shared by all streams, hence atomic
+    mutable std::atomic<unsigned int> nreject_;
     reco::LeafCandidate::LorentzVector n_;
 
 };
@@ -0,0 +1,6 @@
+import FWCore.ParameterSet.Config as cms
+
+GoodPVProducer = cms.EDProducer(
+  'GoodPVProducer',
+  offlinePrimaryVerticesCollection = cms.InputTag("offlinePrimaryVertices"),
+  )
@@ -10,4 +10,6 @@ InitialProducer = cms.EDProducer(
   muonsCollection = cms.InputTag("pfIsolatedMuonsEI"),
   electronsCollection = cms.InputTag("pfIsolatedElectronsEI"),
   METCollection = cms.InputTag("pfMet"),
+  #number of jets with highest momentum stored in the EventSummary
+  nTopJets = cms.uint32(2),
   )
@@ -6,5 +6,12 @@ lambdaKshortVertexFilter = cms.EDFilter(
     kshortCollection = cms.InputTag("generalV0Candidates","Kshort"),
     genparticlesCollection = cms.InputTag("genParticles",""), 
     maxchi2ndofVertexFit = cms.double(10.),
+    preselectPairs = cms.bool(False), # reject Lambda-Kshort pairs before the S vertex fit. Not lossless: the buckets and the DCA cut also drop pairs which would pass maxchi2ndofVertexFit (V0s far apart in phi or z, or with flight lines passing further than maxDCAV0FlightLines from each other), so off by default
+    checkPreselection = cms.bool(False), # with preselectPairs: fit the rejected pairs anyway (not saved) and print at endJob how many S candidates the pre-selection loses, per same event and mixed event pairs
+    maxDCAV0FlightLines = cms.double(5.), # cm, max distance of closest approach between the Lambda and Kshort flight lines
+    nPhiBuckets = cms.uint32(6), # number of buckets in phi of the V0 decay vertices, only neighbouring buckets are paired
+    zBucketWidth = cms.double(20.), # cm, width of the buckets in z of the V0 decay vertices, only neighbouring buckets are paired
+    nMixedEvents = cms.uint32(0), # number of previous events (per stream) whose Kshorts are mixed with the Lambdas of this event into sParticlesXEvent, 0 disables the event mixing and the product.
+                                  # Which events are the previous ones depends on how the framework hands the events to the streams, so sParticlesXEvent is only reproducible when running with one thread (sParticles does not depend on it)
     isData = cms.bool(True)
 )
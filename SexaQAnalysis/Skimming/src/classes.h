@@ -0,0 +1,13 @@
+#include "DataFormats/Common/interface/Wrapper.h"
+#include "SexaQAnalysis/Skimming/interface/EventSummary.h"
+#include "SexaQAnalysis/Skimming/interface/GoodPrimaryVertices.h"
+
+namespace SexaQAnalysis_Skimming {
+  struct dictionary {
+    EventSummary eventSummary;
+    edm::Wrapper<EventSummary> wEventSummary;
+    PrimaryVertexArrays primaryVertexArrays;
+    GoodPrimaryVertices goodPrimaryVertices;
+    edm::Wrapper<GoodPrimaryVertices> wGoodPrimaryVertices;
+  };
+}
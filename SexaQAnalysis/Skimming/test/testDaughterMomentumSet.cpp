@@ -0,0 +1,115 @@
+//unit test of the removal of the kshorts overlapping with a lambda in LambdaKshortFilter: the DaughterMomentumSet lookup has to keep exactly the same kshorts as the loop over all
+//(lambda, kshort, daughter, daughter) combinations comparing the daughter momenta, which the filter used before. Returns 1 if any check fails.
+
+#include "SexaQAnalysis/Skimming/interface/DaughterMomentumSet.h"
+
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace {
+
+//the daughter of a V0 as seen by the filter, only its momentum is compared
+struct Daughter {
+	double px_, py_, pz_;
+	double px() const { return px_; }
+	double py() const { return py_; }
+	double pz() const { return pz_; }
+};
+
+struct V0 {
+	Daughter daughters[2];
+	unsigned int numberOfDaughters() const { return 2; }
+	const Daughter* daughter(unsigned int i) const { return &daughters[i]; }
+};
+
+unsigned int nFailed = 0;
+
+void check(bool ok, const char* what)
+{
+	if(ok) return;
+	std::printf("FAILED: %s\n", what);
+	nFailed++;
+}
+
+//the overlap removal as it was in LambdaKshortFilter before the DaughterMomentumSet
+std::vector<unsigned int> selectNestedLoop(const std::vector<V0>& lambdas, const std::vector<V0>& kshorts)
+{
+	std::vector<unsigned int> selected;
+	for(unsigned int k = 0; k < kshorts.size(); ++k){
+		bool overlap = false;
+		for(const V0& lambda : lambdas){
+			for(unsigned int li = 0; li < lambda.numberOfDaughters() && !overlap; ++li){
+				for(unsigned int ki = 0; ki < kshorts[k].numberOfDaughters() && !overlap; ++ki){
+					if(lambda.daughter(li)->px() == kshorts[k].daughter(ki)->px() &&
+					   lambda.daughter(li)->py() == kshorts[k].daughter(ki)->py() &&
+					   lambda.daughter(li)->pz() == kshorts[k].daughter(ki)->pz()) overlap = true;
+				}
+			}
+			if(overlap) break;
+		}
+		if(!overlap) selected.push_back(k);
+	}
+	return selected;
+}
+
+//the overlap removal as it is in LambdaKshortFilter now
+std::vector<unsigned int> selectMomentumSet(const std::vector<V0>& lambdas, const std::vector<V0>& kshorts)
+{
+	sexaq::DaughterMomentumSet lambdaDaughterMomenta;
+	lambdaDaughterMomenta.reserve(2*lambdas.size());
+	for(const V0& lambda : lambdas) lambdaDaughterMomenta.insertDaughters(lambda);
+	std::vector<unsigned int> selected;
+	for(unsigned int k = 0; k < kshorts.size(); ++k) if(!lambdaDaughterMomenta.sharesMomentum(kshorts[k])) selected.push_back(k);
+	return selected;
+}
+
+bool sameSelection(const std::vector<V0>& lambdas, const std::vector<V0>& kshorts)
+{
+	return selectNestedLoop(lambdas, kshorts) == selectMomentumSet(lambdas, kshorts);
+}
+
+}
+
+int main()
+{
+	const Daughter a{1., 2., 3.}, b{-1., 0.5, 2.}, c{0.3, -0.2, 7.};
+
+	//a kshort sharing a daughter momentum with a lambda is removed, whichever daughter it is
+	check(selectMomentumSet({V0{{a, b}}}, {V0{{c, a}}, V0{{b, c}}, V0{{c, c}}}) == std::vector<unsigned int>{2}, "shared daughter momentum");
+	//the same track refitted at another vertex has a slightly different momentum: not an overlap, as in the old loop
+	const Daughter aRefitted{1., 2., 3.0000001};
+	check(selectMomentumSet({V0{{a, b}}}, {V0{{aRefitted, c}}}) == std::vector<unsigned int>{0}, "different momentum is no overlap");
+	//all three components have to be equal
+	check(selectMomentumSet({V0{{a, b}}}, {V0{{Daughter{1., 2., 4.}, Daughter{1., 5., 3.}}}}) == std::vector<unsigned int>{0}, "one equal component is no overlap");
+	//0. and -0. are equal for the old comparison
+	check(sameSelection({V0{{Daughter{0., 1., 2.}, b}}}, {V0{{Daughter{-0., 1., 2.}, c}}}), "signed zero");
+	//NaN is never equal to anything, also not to itself
+	const double nan = std::numeric_limits<double>::quiet_NaN();
+	check(sameSelection({V0{{Daughter{nan, 1., 2.}, b}}}, {V0{{Daughter{nan, 1., 2.}, c}}}), "NaN");
+	//no lambdas: all kshorts are kept
+	check(selectMomentumSet({}, {V0{{a, b}}, V0{{b, c}}}) == std::vector<unsigned int>{0, 1}, "no lambdas");
+
+	//random events with up to a thousand V0s per type, with the daughters drawn from a pool of momenta so part of the kshorts overlaps
+	std::mt19937 random(12345);
+	std::normal_distribution<double> momentum(0., 2.);
+	for(unsigned int nV0 : {1u, 10u, 100u, 1000u}){
+		for(unsigned int event = 0; event < 20; ++event){
+			std::vector<Daughter> pool(4*nV0);
+			for(Daughter& daughter : pool) daughter = Daughter{momentum(random), momentum(random), momentum(random)};
+			std::uniform_int_distribution<unsigned int> pick(0, pool.size()-1);
+			std::vector<V0> lambdas(nV0), kshorts(nV0);
+			for(V0& v0 : lambdas) v0 = V0{{pool[pick(random)], pool[pick(random)]}};
+			for(V0& v0 : kshorts) v0 = V0{{pool[pick(random)], pool[pick(random)]}};
+			check(sameSelection(lambdas, kshorts), "random event");
+		}
+	}
+
+	if(nFailed > 0){
+		std::printf("%u checks failed\n", nFailed);
+		return 1;
+	}
+	std::printf("DaughterMomentumSet keeps the same kshorts as the nested loop\n");
+	return 0;
+}
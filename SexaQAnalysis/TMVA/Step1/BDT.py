@@ -10,6 +10,8 @@ sys.path.insert(1, './..')
 import configBDT as config
 
 config_dict = config.config_dict
+#the compiled selection of configBDT.py
+FlatTreeSelection = config.load_selection_library()
 
 # Open files
 SignFile1 = ROOT.TFile.Open(config_dict["config_SignalFile"])
@@ -22,13 +24,17 @@ BkgFile  = ROOT.TFile.Open(config_dict["config_BkgFileData"])
 SignalTree1     = SignFile1.Get("FlatTreeProducerBDT/FlatTree")
 #apply the pre-BDT cuts and also select from the ntuples the Sbar (based on charge) and should be signal (based on matching with GEN particles)
 gROOT.cd()
-selectedSignalTree1 = SignalTree1.CopyTree( config_dict["config_SelectionSignalAntiS"] + ' && ' + config_dict["config_pre_BDT_cuts"] )
+signalSelection = FlatTreeSelection("SignalAntiS+pre_BDT")
+selectedSignalTree1 = signalSelection.copyTree(SignalTree1)
+signalSelection.printCutFlow(ROOT.std.cout)
 
 
 BkgTree        = BkgFile.Get("FlatTreeProducerBDT/FlatTree")
 gROOT.cd()
 #apply pre-BDT cuts and select data BKG S (look at the charge)
-selectedBkgTree = BkgTree.CopyTree(config_dict["config_SelectionBkgS"] + ' && ' + config_dict["config_pre_BDT_cuts"] )
+bkgSelection = FlatTreeSelection("BkgS+pre_BDT")
+selectedBkgTree = bkgSelection.copyTree(BkgTree)
+bkgSelection.printCutFlow(ROOT.std.cout)
 
 trainTestSplit = 0.8
 
@@ -0,0 +1,204 @@
+#converts the TMVA weights of a BDT (the weights xml or the standalone .class.C) into a C++ header with flat arrays for the FlatBDT evaluator (AnalyzerAllSteps/interface/FlatBDT.h)
+#only AdaBoost with yes/no leaves (the settings used in BDT.py) is supported: then the score is the sum over the trees of boostWeight*nodeType/sum(boostWeights)
+#the output is either a C++ header (for the standalone macros like TMVA/Step2/DiscrApplication.C) or, if the output file ends with .bin, a binary payload which FlatTreeProducerBDT reads at run time
+#(layout documented in FlatBDT.h)
+#usage: python makeFlatBDT.py <weights .xml or .class.C> <output header> <name of the namespace in the header>
+#       python makeFlatBDT.py <weights .xml or .class.C> <output payload .bin>
+#e.g.: python makeFlatBDT.py dataset_BDT_2016dataset_BDT_2016vSelected19Parameters_CutFiducialRegion_CutDeltaPhi_CutLxy_CutDxyOverLxy_SignalWeighing/weights/TMVAClassification_BDT.class.C ../../AnalyzerAllSteps/interface/FlatBDT_2016vSelected19Parameters.h FlatBDT_2016vSelected19Parameters
+from __future__ import print_function
+import os
+import re
+import struct
+import sys
+import xml.etree.ElementTree as ET
+
+def fail(message):
+	print("makeFlatBDT.py: " + message)
+	sys.exit(1)
+
+class Node:
+	def __init__(self, left, right, selector, cut, cutType, nodeType):
+		self.left = left
+		self.right = right
+		self.selector = selector
+		self.cut = cut
+		self.cutType = cutType
+		self.nodeType = nodeType
+
+def checkOptions(options):
+	#options which change the evaluation and are not supported by the flat evaluator
+	if options.get("BoostType", "AdaBoost") != "AdaBoost": fail("BoostType " + options["BoostType"] + " not supported, only AdaBoost")
+	if options.get("UseYesNoLeaf", "True") != "True": fail("only UseYesNoLeaf=True is supported")
+	if options.get("VarTransform", "None") != "None": fail("variable transformations (" + options["VarTransform"] + ") are not supported")
+	if options.get("UseFisherCuts", "False") != "False": fail("UseFisherCuts is not supported")
+	if options.get("DoPreselection", "False") != "False": fail("DoPreselection is not supported")
+
+#the weights xml written by TMVA::Factory
+def readXML(fileName):
+	root = ET.parse(fileName).getroot()
+	options = {}
+	for option in root.find("Options").findall("Option"): options[option.get("name")] = option.text.strip() if option.text else ""
+	checkOptions(options)
+	variables = [v.get("Expression") for v in sorted(root.find("Variables").findall("Variable"), key = lambda v: int(v.get("VarIndex")))]
+
+	def readNode(element):
+		children = dict((child.get("pos"), readNode(child)) for child in element.findall("Node"))
+		return Node(children.get("l"), children.get("r"), int(element.get("IVar")), float(element.get("Cut")), int(element.get("cType")) == 1, int(element.get("nType")))
+
+	boostWeights = []
+	trees = []
+	for tree in root.find("Weights").findall("BinaryTree"):
+		boostWeights.append(float(tree.get("boostWeight")))
+		trees.append(readNode(tree.find("Node")))
+	return variables, boostWeights, trees
+
+#the standalone ReadBDT class written by MethodBase::MakeClass
+def readClassC(fileName):
+	text = open(fileName).read()
+	options = dict(re.findall(r'^(\w+): "([^"]*)"', text, re.M))
+	checkOptions(options)
+	variables = re.findall(r'"([^"]*)"', re.search(r'inputVars\[\] = \{([^}]*)\}', text).group(1))
+
+	boostWeights = [float(w) for w in re.findall(r'fBoostWeights\.push_back\(([^)]*)\);', text)]
+	trees = []
+	for forest in re.findall(r'fForest\.push_back\((.*?)\);', text, re.S):
+		tokens = re.findall(r'NN\(|\)|[^\s,()]+', forest)
+		position = [0]
+		def next():
+			position[0] += 1
+			return tokens[position[0] - 1]
+		def readNode():
+			if next() != "NN(": fail("cannot parse the forest in " + fileName)
+			children = []
+			for i in range(2):
+				if tokens[position[0]] == "0":
+					next()
+					children.append(None)
+				else:
+					children.append(readNode())
+			selector, cut, cutType, nodeType, purity, response = [next() for i in range(6)]
+			if next() != ")": fail("cannot parse the forest in " + fileName)
+			return Node(children[0], children[1], int(selector), float(cut), cutType == "1", int(nodeType))
+		trees.append(readNode())
+	if len(trees) != len(boostWeights): fail("found " + str(len(trees)) + " trees but " + str(len(boostWeights)) + " boost weights in " + fileName)
+	return variables, boostWeights, trees
+
+def treeDepth(node):
+	if node is None or node.left is None: return 0
+	return 1 + max(treeDepth(node.left), treeDepth(node.right))
+
+#largest float <= value: for a float x, x > floatBelow(cut) gives the same answer as x > cut in double
+def floatBelow(value):
+	f = struct.unpack("f", struct.pack("f", value))[0]
+	if f <= value: return f
+	#one ulp towards -inf, the float just below zero is the smallest negative denormal
+	bits = struct.unpack("I", struct.pack("f", f))[0]
+	if f > 0: bits -= 1
+	elif f == 0: bits = 0x80000001
+	else: bits += 1
+	return struct.unpack("f", struct.pack("I", bits))[0]
+
+#fills the complete binary tree of the given depth below node: internal nodes in breadth first order in features/thresholds, the leaves in leafValues
+def flatten(tree, depth, leafWeight):
+	nInternal = 2**depth - 1
+	features = [0]*nInternal
+	thresholds = [0.]*nInternal
+	leafValues = [0.]*(2**depth)
+	def fill(node, index, level):
+		if level == depth:
+			if node.left is not None: fail("tree deeper than " + str(depth))
+			leafValues[index - nInternal] = leafWeight*node.nodeType
+			return
+		if node.left is None:
+			#leaf above the maximal depth: both sides of a dummy cut lead to the same leaf
+			fill(node, 2*index + 1, level + 1)
+			fill(node, 2*index + 2, level + 1)
+			return
+		features[index] = node.selector
+		thresholds[index] = floatBelow(node.cut)
+		#cType 0: the events with x > cut go left, swap the children so that right is always x > cut
+		left, right = (node.left, node.right) if node.cutType else (node.right, node.left)
+		fill(left, 2*index + 1, level + 1)
+		fill(right, 2*index + 2, level + 1)
+	fill(tree, 0, 0)
+	return features, thresholds, leafValues
+
+def formatFloat(value):
+	text = "%.9g" % value
+	if not re.search(r"[.e]", text): text += ".0"
+	return text + "f"
+
+def formatArray(values, formatter, perLine):
+	lines = []
+	for i in range(0, len(values), perLine): lines.append("\t" + ", ".join(formatter(v) for v in values[i:i + perLine]) + ",")
+	return "\n".join(lines)
+
+#the TMVA dataset of the weights: the directory containing weights/, empty if the weights are not in a weights/ directory
+def trainingDataset(inputFile):
+	directories = os.path.dirname(os.path.abspath(inputFile)).split(os.sep)
+	if len(directories) < 2 or directories[-1] != "weights": return ""
+	return directories[-2]
+
+def writeHeader(outputFile, name, inputFile, variables, nTrees, depth, features, thresholds, leafValues):
+	guard = name + "_h"
+	out = open(outputFile, "w")
+	out.write("#ifndef " + guard + "\n#define " + guard + "\n\n")
+	out.write('#include "SexaQAnalysis/AnalyzerAllSteps/interface/FlatBDT.h"\n\n')
+	out.write("//generated by TMVA/Step1/makeFlatBDT.py from " + inputFile.split("/")[-1] + ", do not edit\n")
+	out.write("//" + str(nTrees) + " trees of depth " + str(depth) + ", the features have to be given in the order of variables\n")
+	out.write("namespace " + name + " {\n")
+	out.write("  const unsigned int nTrees = " + str(nTrees) + ";\n")
+	out.write("  const unsigned int depth = " + str(depth) + ";\n")
+	out.write("  const unsigned int nVars = " + str(len(variables)) + ";\n")
+	out.write("  const char* const variables[nVars] = {" + ", ".join('"' + v + '"' for v in variables) + "};\n")
+	out.write("  //the TMVA dataset (directory of the training) the weights were taken from, DiscrApplication.C checks it against the dataset it is asked to apply\n")
+	out.write('  const char* const dataset = "' + trainingDataset(inputFile) + '";\n\n')
+	out.write("  const unsigned char features[] = {\n" + formatArray(features, str, 28) + "\n  };\n\n")
+	out.write("  const float thresholds[] = {\n" + formatArray(thresholds, formatFloat, 7) + "\n  };\n\n")
+	out.write("  const double leafValues[] = {\n" + formatArray(leafValues, lambda v: "%.17g" % v, 8) + "\n  };\n\n")
+	out.write("  inline FlatBDT make() { return FlatBDT(std::vector<std::string>(variables, variables + nVars), nTrees, depth, features, thresholds, leafValues); }\n")
+	out.write("}\n\n#endif\n")
+	out.close()
+
+payloadVersion = 1
+
+def writePayload(outputFile, variables, nTrees, depth, features, thresholds, leafValues):
+	out = open(outputFile, "wb")
+	out.write(struct.pack("<8s4I", b"SEXAQBD", payloadVersion, nTrees, depth, len(variables)))
+	for v in variables:
+		out.write(struct.pack("<I", len(v)) + v.encode("ascii"))
+	out.write(struct.pack("<%dB" % len(features), *features))
+	out.write(struct.pack("<%df" % len(thresholds), *thresholds))
+	out.write(struct.pack("<%dd" % len(leafValues), *leafValues))
+	out.close()
+
+def main():
+	if len(sys.argv) == 3 and sys.argv[2].endswith(".bin"):
+		inputFile, outputFile = sys.argv[1:]
+		name = None
+	elif len(sys.argv) == 4:
+		inputFile, outputFile, name = sys.argv[1:]
+	else:
+		fail("usage: python makeFlatBDT.py <weights .xml or .class.C> <output header> <namespace>, or python makeFlatBDT.py <weights .xml or .class.C> <output payload .bin>")
+	variables, boostWeights, trees = readXML(inputFile) if inputFile.endswith(".xml") else readClassC(inputFile)
+	if len(variables) > 256: fail("more than 256 input variables")
+	for tree in trees:
+		if tree.left is None and tree.nodeType == 0: fail("tree without nodes")
+
+	depth = max(treeDepth(tree) for tree in trees)
+	norm = sum(boostWeights)
+	features = []
+	thresholds = []
+	leafValues = []
+	for weight, tree in zip(boostWeights, trees):
+		f, t, l = flatten(tree, depth, weight/norm)
+		features += f
+		thresholds += t
+		leafValues += l
+
+	if name is None: writePayload(outputFile, variables, len(trees), depth, features, thresholds, leafValues)
+	else: writeHeader(outputFile, name, inputFile, variables, len(trees), depth, features, thresholds, leafValues)
+	print("wrote " + str(len(trees)) + " trees of depth " + str(depth) + " with " + str(len(variables)) + " variables to " + outputFile)
+
+if __name__ == "__main__":
+	main()
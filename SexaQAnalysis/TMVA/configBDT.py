@@ -12,12 +12,26 @@ GENRECO_matcher_Ks_deltaR = 0.03
 GENRECO_matcher_AntiL_deltaL = 3.
 GENRECO_matcher_AntiL_deltaR = 0.03
 
-#cuts to be applied pre BDT:
-pre_BDT_noCut = "Alt$(_S_lxy_interaction_vertex_beampipeCenter,0) < 99999999." #essentially no cut, this is just for testing
+#the pre-BDT and fiducial region cuts and the signal/background selections are declared once here, as a list of named cuts. Each cut acts on the first candidate of the entry (Alt$(variable,0)):
+#   (name, variable, operator, value) with operator one of <, <=, >, >=, == or "outside" (value is (min, max), passes if variable < min || variable > max)
+#the TTreeFormula strings below (for CopyTree, TCut, Draw, valid for both the vector and the scalar layout of the FlatTree) are made from these declarations, and TMVA/makeSelection.py compiles them into the C++ predicates
+#of AnalyzerAllSteps/interface/SexaqSelectionCuts.h, which are used through AnalyzerAllSteps/interface/FlatTreeSelection.h (see load_selection_library below)
+#so after changing a cut here rerun: python makeSelection.py
+cuts = [
+("noCut", "_S_lxy_interaction_vertex_beampipeCenter", "<", 99999999.), #essentially no cut, this is just for testing
 #the 3 below cuts are the ones used pre-BDT (see AN for the explanation). The numbering is historical and not necessarily the order in which they are explained in the AN
-pre_BDT_cut1 =  "Alt$(_S_lxy_interaction_vertex_beampipeCenter,0) > 2.02 && Alt$(_S_lxy_interaction_vertex_beampipeCenter,0) < 2.4"
-pre_BDT_cut3 = "Alt$(_S_dxy_over_lxy,0) >= 0 && Alt$(_S_dxy_over_lxy,0) <= 0.5"
-pre_BDT_cut4 = "(Alt$(_S_daughters_deltaphi,0) < -0.5 || Alt$(_S_daughters_deltaphi,0) > 0.5)"
+("cut1_lxy_min", "_S_lxy_interaction_vertex_beampipeCenter", ">", 2.02),
+("cut1_lxy_max", "_S_lxy_interaction_vertex_beampipeCenter", "<", 2.4),
+("cut3_dxy_over_lxy_min", "_S_dxy_over_lxy", ">=", 0),
+("cut3_dxy_over_lxy_max", "_S_dxy_over_lxy", "<=", 0.5),
+("cut4_deltaphi", "_S_daughters_deltaphi", "outside", (-0.5, 0.5)),
+#charge and GEN matching of the S
+("S_charge_minus", "_S_charge", "==", -1),
+("S_charge_plus", "_S_charge", "==", 1),
+("AntiS_GEN_deltaL", "_S_deltaLInteractionVertexAntiSmin", "<", GENRECO_matcher_AntiS_deltaL),
+("AntiS_GEN_deltaR", "_S_deltaRAntiSmin", "<", GENRECO_matcher_AntiS_deltaR),
+("AntiS_noGEN_deltaL", "_S_deltaLInteractionVertexAntiSmin", ">", 10),
+]
 
 #pre-BDT cuts also include the fiducial region in which we understand the systematics, this is defined by:
 FiducialRegionptMin = 0.33
@@ -37,43 +51,75 @@ FiducialRegionlxyMax = 44.5
 FiducialRegionvzMin = -125.
 FiducialRegionvzMax = 125.
 
-
-
 #apply the above limits on all 4 final state particles
-fiducial_region_cuts = "Alt$(_Lambda_vz_decay_vertex,0) >= "+str(FiducialRegionvzMin)\
-+" && Alt$(_Lambda_vz_decay_vertex,0) <= "+str(FiducialRegionvzMax)\
-+" && Alt$(_Lambda_lxy_decay_vertex,0) <= "+str(FiducialRegionlxyMax)\
-+" && Alt$(_Ks_vz_decay_vertex,0) >= "+str(FiducialRegionvzMin)\
-+" && Alt$(_Ks_vz_decay_vertex,0) <= "+str(FiducialRegionvzMax)\
-+" && Alt$(_Ks_lxy_decay_vertex,0) <= "+str(FiducialRegionlxyMax)\
-+" && Alt$(_RECO_Lambda_daughter0_pt,0) >= "+str(FiducialRegionptMin)\
-+" && Alt$(_RECO_Lambda_daughter0_pz,0) >= "+str(FiducialRegionpzMin)\
-+" && Alt$(_RECO_Lambda_daughter0_pz,0) <= "+str(FiducialRegionpzMax)\
-+" && Alt$(_RECO_Lambda_daughter0_dxy_beamspot,0) >= "+str(FiducialRegiondxyMin)\
-+" && Alt$(_RECO_Lambda_daughter0_dxy_beamspot,0) <= "+str(FiducialRegiondxyMax)\
-+" && Alt$(_RECO_Lambda_daughter0_dz_beamspot,0) >= "+str(FiducialRegiondzMin)\
-+" && Alt$(_RECO_Lambda_daughter0_dz_beamspot,0) <= "+str(FiducialRegiondzMax)\
-+" && Alt$(_RECO_Lambda_daughter1_pt,0) >= "+str(FiducialRegionptMin)\
-+" && Alt$(_RECO_Lambda_daughter1_pz,0) >= "+str(FiducialRegionpzMin)\
-+" && Alt$(_RECO_Lambda_daughter1_pz,0) <= "+str(FiducialRegionpzMax)\
-+" && Alt$(_RECO_Lambda_daughter1_dxy_beamspot,0) >= "+str(FiducialRegiondxyMin)\
-+" && Alt$(_RECO_Lambda_daughter1_dxy_beamspot,0) <= "+str(FiducialRegiondxyMax)\
-+" && Alt$(_RECO_Lambda_daughter1_dz_beamspot,0) >= "+str(FiducialRegiondzMin)\
-+" && Alt$(_RECO_Lambda_daughter1_dz_beamspot,0) <= "+str(FiducialRegiondzMax)\
-+" && Alt$(_RECO_Ks_daughter0_pt,0) >= "+str(FiducialRegionptMin)\
-+" && Alt$(_RECO_Ks_daughter0_pz,0) >= "+str(FiducialRegionpzMin)\
-+" && Alt$(_RECO_Ks_daughter0_pz,0) <= "+str(FiducialRegionpzMax)\
-+" && Alt$(_RECO_Ks_daughter0_dxy_beamspot,0) >= "+str(FiducialRegiondxyMin)\
-+" && Alt$(_RECO_Ks_daughter0_dxy_beamspot,0) <= "+str(FiducialRegiondxyMax)\
-+" && Alt$(_RECO_Ks_daughter0_dz_beamspot,0) >= "+str(FiducialRegiondzMin)\
-+" && Alt$(_RECO_Ks_daughter0_dz_beamspot,0) <= "+str(FiducialRegiondzMax)\
-+" && Alt$(_RECO_Ks_daughter1_pt,0) >= "+str(FiducialRegionptMin)\
-+" && Alt$(_RECO_Ks_daughter1_pz,0) >= "+str(FiducialRegionpzMin)\
-+" && Alt$(_RECO_Ks_daughter1_pz,0) <= "+str(FiducialRegionpzMax)\
-+" && Alt$(_RECO_Ks_daughter1_dxy_beamspot,0) >= "+str(FiducialRegiondxyMin)\
-+" && Alt$(_RECO_Ks_daughter1_dxy_beamspot,0) <= "+str(FiducialRegiondxyMax)\
-+" && Alt$(_RECO_Ks_daughter1_dz_beamspot,0) >= "+str(FiducialRegiondzMin)\
-+" && Alt$(_RECO_Ks_daughter1_dz_beamspot,0) <= "+str(FiducialRegiondzMax)
+fiducial_cuts = []
+for V0 in ["Lambda", "Ks"]:
+	fiducial_cuts += [
+	("fiducial_"+V0+"_vz_min", "_"+V0+"_vz_decay_vertex", ">=", FiducialRegionvzMin),
+	("fiducial_"+V0+"_vz_max", "_"+V0+"_vz_decay_vertex", "<=", FiducialRegionvzMax),
+	("fiducial_"+V0+"_lxy_max", "_"+V0+"_lxy_decay_vertex", "<=", FiducialRegionlxyMax)]
+for daughter in ["Lambda_daughter0", "Lambda_daughter1", "Ks_daughter0", "Ks_daughter1"]:
+	fiducial_cuts += [
+	("fiducial_"+daughter+"_pt_min", "_RECO_"+daughter+"_pt", ">=", FiducialRegionptMin),
+	("fiducial_"+daughter+"_pz_min", "_RECO_"+daughter+"_pz", ">=", FiducialRegionpzMin),
+	("fiducial_"+daughter+"_pz_max", "_RECO_"+daughter+"_pz", "<=", FiducialRegionpzMax),
+	("fiducial_"+daughter+"_dxy_min", "_RECO_"+daughter+"_dxy_beamspot", ">=", FiducialRegiondxyMin),
+	("fiducial_"+daughter+"_dxy_max", "_RECO_"+daughter+"_dxy_beamspot", "<=", FiducialRegiondxyMax),
+	("fiducial_"+daughter+"_dz_min", "_RECO_"+daughter+"_dz_beamspot", ">=", FiducialRegiondzMin),
+	("fiducial_"+daughter+"_dz_max", "_RECO_"+daughter+"_dz_beamspot", "<=", FiducialRegiondzMax)]
+cuts += fiducial_cuts
+
+#the named selections, each is a list of cut names, applied in this order (this is also the order of the cut flow)
+selections = [
+("noCut", ["noCut"]),
+("pre_BDT_cut1", ["cut1_lxy_min", "cut1_lxy_max"]),
+("pre_BDT_cut3", ["cut3_dxy_over_lxy_min", "cut3_dxy_over_lxy_max"]),
+("pre_BDT_cut4", ["cut4_deltaphi"]),
+("fiducial_region", [cut[0] for cut in fiducial_cuts]),
+("pre_BDT", [cut[0] for cut in fiducial_cuts] + ["cut4_deltaphi", "cut1_lxy_min", "cut1_lxy_max", "cut3_dxy_over_lxy_min", "cut3_dxy_over_lxy_max"]),
+("SignalAntiS", ["S_charge_minus", "AntiS_GEN_deltaL", "AntiS_GEN_deltaR"]),
+("BkgS", ["S_charge_plus"]),
+("BkgAntiS", ["S_charge_minus", "AntiS_noGEN_deltaL"]),
+("AntiS", ["S_charge_minus"]),
+]
+selection_dict = dict(selections)
+
+#TTreeFormula string of one cut
+def cut_formula(name):
+	name, variable, operator, value = [cut for cut in cuts if cut[0] == name][0]
+	x = "Alt$("+variable+",0)"
+	if(operator == "outside"): return "("+x+" < "+str(value[0])+" || "+x+" > "+str(value[1])+")"
+	return x+" "+operator+" "+str(value)
+
+#TTreeFormula string of one or more selections joined with '+', e.g. selection_formula("BkgS+pre_BDT")
+def selection_formula(selection):
+	return " && ".join([cut_formula(name) for s in selection.split("+") for name in selection_dict[s]])
+
+pre_BDT_noCut = selection_formula("noCut")
+pre_BDT_cut1 = selection_formula("pre_BDT_cut1")
+pre_BDT_cut3 = selection_formula("pre_BDT_cut3")
+pre_BDT_cut4 = selection_formula("pre_BDT_cut4")
+fiducial_region_cuts = selection_formula("fiducial_region")
+
+#the compiled selection: loads AnalyzerAllSteps/interface/FlatTreeSelection.h in ROOT (needs $CMSSW_BASE/src or the directory containing SexaQAnalysis as include_path)
+#then e.g. ROOT.FlatTreeSelection("SignalAntiS+pre_BDT").copyTree(tree) replaces tree.CopyTree(config_dict["config_SelectionSignalAntiS"] + ' && ' + config_dict["config_pre_BDT_cuts"])
+def load_selection_library(include_path = None):
+	import os
+	import ROOT
+	if(not hasattr(ROOT, "FlatTreeSelection")):
+		if(include_path == None): include_path = os.environ["CMSSW_BASE"]+"/src"
+		ROOT.gInterpreter.AddIncludePath(include_path)
+		ROOT.gInterpreter.Declare('#include "SexaQAnalysis/AnalyzerAllSteps/interface/FlatTreeSelection.h"')
+	return ROOT.FlatTreeSelection
+
+#applies a selection to an RDataFrame as one named Filter per cut, so df.Report() gives the cut flow. Works for both layouts of the FlatTree (vector or scalar branches)
+def filter_rdataframe(df, selection):
+	FlatTreeSelection = load_selection_library()
+	for cut in FlatTreeSelection(selection).cuts():
+		columnType = str(df.GetColumnType(FlatTreeSelection.variableName(cut)))
+		scalar = "vector" not in columnType and "RVec" not in columnType
+		df = df.Filter(FlatTreeSelection.rdfExpression(cut, scalar), FlatTreeSelection.cutName(cut))
+	return df
 
 
 #dictionary to load in several macros
@@ -89,15 +135,15 @@ config_dict = {
 "pre_BDT_cut1":pre_BDT_cut1,
 "pre_BDT_cut3":pre_BDT_cut3,
 "pre_BDT_cut4":pre_BDT_cut4,
-"config_pre_BDT_cuts":fiducial_region_cuts + " && "+pre_BDT_cut4 + " && "+pre_BDT_cut1 + " && " + pre_BDT_cut3,
+"config_pre_BDT_cuts":selection_formula("pre_BDT"),
 "BDT_classifier_cut":BDT_classifier_cut ,
 "config_SignalFile":"/pnfs/iihe/cms/store/user/jdeclerc/crmc_Sexaq/Final/1p8GeV/FlatTreeBDTMCSignal/combined_FlatTreeBDT_trial17AND21_1p8GeV_02112019_v1.root",
 "config_BkgFileData":"/pnfs/iihe/cms/store/user/jdeclerc/data_Sexaq/trialR/ALL/ALL_v6/FlatTreeBDT_SingleMuon_Run2016H-07Aug17-v1_trialR.root",
 "config_BkgFileMC":"/pnfs/iihe/cms/store/user/jdeclerc/crmc_Sexaq/Final/1p8GeV/FlatTreeBDTMCBackground/FlatTreeBDT_DYJetsToLL_M-50_TuneCUETP8M1_13TeV-amcatnloFXFX-pythia8__31102019_v1.root",
-"config_SelectionSignalAntiS":"Alt$(_S_charge,0) == -1 && Alt$(_S_deltaLInteractionVertexAntiSmin,0) < "+str(GENRECO_matcher_AntiS_deltaL)+" && Alt$(_S_deltaRAntiSmin,0) <"+str(GENRECO_matcher_AntiS_deltaR),
-"config_SelectionBkgS":"Alt$(_S_charge,0) == 1",
-"config_SelectionBkgAntiS":"Alt$(_S_charge,0) == -1 && Alt$(_S_deltaLInteractionVertexAntiSmin,0) > 10",
-"config_SelectionAntiS":"Alt$(_S_charge,0) == -1",
+"config_SelectionSignalAntiS":selection_formula("SignalAntiS"),
+"config_SelectionBkgS":selection_formula("BkgS"),
+"config_SelectionBkgAntiS":selection_formula("BkgAntiS"),
+"config_SelectionAntiS":selection_formula("AntiS"),
 "config_fidRegion_FiducialRegionptMin":FiducialRegionptMin,
 "config_fidRegion_FiducialRegionptMax":FiducialRegionptMax,
 "config_fidRegion_FiducialRegionpzMin":FiducialRegionpzMin,
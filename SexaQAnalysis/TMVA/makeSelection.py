@@ -0,0 +1,86 @@
+#compiles the cuts and selections declared in configBDT.py into C++ predicates: writes AnalyzerAllSteps/interface/SexaqSelectionCuts.h, which is used through AnalyzerAllSteps/interface/FlatTreeSelection.h
+#every cut becomes an inline function of the value of its variable (the first candidate of the entry, as Alt$(variable,0)), the comparison is done in double as TTreeFormula does, so the result is identical to the cut strings
+#rerun this after changing a cut in configBDT.py and commit the header
+#usage: python makeSelection.py [output header]
+from __future__ import print_function
+import os
+import sys
+
+import configBDT as config
+
+def fail(message):
+	print("makeSelection.py: " + message)
+	sys.exit(1)
+
+def literal(value):
+	return repr(float(value))
+
+def expression(operator, value):
+	if(operator == "outside"): return "x < " + literal(value[0]) + " || x > " + literal(value[1])
+	if(operator not in ["<", "<=", ">", ">=", "=="]): fail("unknown operator " + operator)
+	return "x " + operator + " " + literal(value)
+
+def main():
+	output = sys.argv[1] if len(sys.argv) > 1 else os.path.join(os.path.dirname(os.path.abspath(__file__)), "../AnalyzerAllSteps/interface/SexaqSelectionCuts.h")
+
+	variables = []
+	for name, variable, operator, value in config.cuts:
+		if(variable not in variables): variables.append(variable)
+	cutNames = [cut[0] for cut in config.cuts]
+	if(len(set(cutNames)) != len(cutNames)): fail("the cut names are not unique")
+	for name, cuts in config.selections:
+		for cut in cuts:
+			if(cut not in cutNames): fail("selection " + name + " uses the unknown cut " + cut)
+
+	lines = []
+	lines.append("//generated by TMVA/makeSelection.py from the cuts in TMVA/configBDT.py, do not edit")
+	lines.append("#ifndef SexaqSelectionCuts_h")
+	lines.append("#define SexaqSelectionCuts_h")
+	lines.append("")
+	lines.append("namespace SexaqSelectionCuts {")
+	lines.append("")
+	lines.append("  //the branches the cuts are on (vector<float>, the cut is on element 0)")
+	lines.append("  enum Variable { " + ", ".join(["v" + v for v in variables]) + ", nVariables };")
+	lines.append("  const char* const variableNames[nVariables] = {")
+	lines.append(",\n".join(['\t"' + v + '"' for v in variables]))
+	lines.append("  };")
+	lines.append("")
+	lines.append("  enum Cut { " + ", ".join(["c_" + name for name in cutNames]) + ", nCuts };")
+	lines.append("  const char* const cutNames[nCuts] = {")
+	lines.append(",\n".join(['\t"' + name + '"' for name in cutNames]))
+	lines.append("  };")
+	lines.append("  //the TTreeFormula string of each cut, as used in configBDT.py")
+	lines.append("  const char* const cutFormulas[nCuts] = {")
+	lines.append(",\n".join(['\t"' + config.cut_formula(name) + '"' for name in cutNames]))
+	lines.append("  };")
+	lines.append("  const Variable cutVariables[nCuts] = { " + ", ".join(["v" + variable for name, variable, operator, value in config.cuts]) + " };")
+	lines.append("")
+	for name, variable, operator, value in config.cuts:
+		lines.append("  inline bool " + name + "(double x){ return " + expression(operator, value) + "; }")
+	lines.append("")
+	lines.append("  inline bool passes(unsigned int cut, double x){")
+	lines.append("\tswitch(cut){")
+	for name in cutNames:
+		lines.append("\t\tcase c_" + name + ": return " + name + "(x);")
+	lines.append("\t}")
+	lines.append("\treturn false;")
+	lines.append("  }")
+	lines.append("")
+	lines.append("  //the named selections, the cuts in the order in which they are applied")
+	for name, cuts in config.selections:
+		lines.append("  const Cut " + name + "Cuts[] = { " + ", ".join(["c_" + cut for cut in cuts]) + " };")
+	lines.append("  struct Selection { const char* name; unsigned int nCuts; const Cut* cuts; };")
+	lines.append("  const Selection selections[] = {")
+	lines.append(",\n".join(['\t{ "' + name + '", ' + str(len(cuts)) + ", " + name + "Cuts }" for name, cuts in config.selections]))
+	lines.append("  };")
+	lines.append("  const unsigned int nSelections = " + str(len(config.selections)) + ";")
+	lines.append("")
+	lines.append("}")
+	lines.append("")
+	lines.append("#endif")
+
+	open(output, "w").write("\n".join(lines) + "\n")
+	print("makeSelection.py: wrote " + str(len(cutNames)) + " cuts on " + str(len(variables)) + " variables and " + str(len(config.selections)) + " selections to " + output)
+
+if __name__ == "__main__":
+	main()
@@ -1,4 +1,5 @@
 // Description: EDAnalyzer produce flat trees from AOD for HexaAnalysis
+// A one module sharing the TFileService resource: only this module runs one event at a time, the rest of a multi-threaded skim job is not serialized by it
 
 // C++ lib
 #include <vector>
@@ -12,7 +13,7 @@
 // CMSSW standard lib
 #include "FWCore/Utilities/interface/EDGetToken.h"
 #include "FWCore/Framework/interface/Frameworkfwd.h"
-#include "FWCore/Framework/interface/EDAnalyzer.h"
+#include "FWCore/Framework/interface/one/EDAnalyzer.h"
 #include "FWCore/Framework/interface/Event.h"
 #include "FWCore/Framework/interface/EventSetup.h"
 #include "FWCore/Framework/interface/ESHandle.h"
@@ -38,7 +39,7 @@ int verbose=1;
 // class declaration
 //
 
-class TreeProducer_AOD : public edm::EDAnalyzer {
+class TreeProducer_AOD : public edm::one::EDAnalyzer<edm::one::SharedResources> {
  public:
   explicit TreeProducer_AOD(const edm::ParameterSet&);
   ~TreeProducer_AOD();
@@ -47,14 +48,9 @@ class TreeProducer_AOD : public edm::EDAnalyzer {
   static bool ptSorter(const reco::Track & i, const reco::Track & j);
 
  private:
-  virtual void beginJob() ;
-  virtual void analyze(const edm::Event&, const edm::EventSetup&);
-  virtual void endJob() ;
-
-  virtual void beginRun(edm::Run const&, edm::EventSetup const&);
-  virtual void endRun(edm::Run const&, edm::EventSetup const&);
-  virtual void beginLuminosityBlock(edm::LuminosityBlock const&, edm::EventSetup const&);
-  virtual void endLuminosityBlock(edm::LuminosityBlock const&, edm::EventSetup const&);
+  virtual void beginJob() override;
+  virtual void analyze(const edm::Event&, const edm::EventSetup&) override;
+  virtual void endJob() override;
 
   void Init();
 
@@ -23,6 +23,7 @@ muonsCollectionToken_(consumes<std::vector<edm::FwdPtr<reco::PFCandidate> > >(mu
 electronsCollectionToken_(consumes<std::vector<edm::FwdPtr<reco::PFCandidate> > >(electronsCollectionTag_)),
 METCollectionToken_(consumes<std::vector<reco::PFMET> >(METCollectionTag_))
 {
+  usesResource("TFileService");
 }
 
 TreeProducer_AOD::~TreeProducer_AOD()
@@ -145,30 +146,6 @@ TreeProducer_AOD::endJob()
 {
 }
 
-// ------------ method called when starting to processes a run  ------------
-void
-TreeProducer_AOD::beginRun(edm::Run const& iRun, edm::EventSetup const& iSetup)
-{
-}
-
-// ------------ method called when ending the processing of a run  ------------
-void
-TreeProducer_AOD::endRun(edm::Run const&, edm::EventSetup const&)
-{
-}
-
-// ------------ method called when starting to processes a luminosity block  ------------
-void
-TreeProducer_AOD::beginLuminosityBlock(edm::LuminosityBlock const&, edm::EventSetup const&)
-{
-}
-
-// ------------ method called when ending the processing of a luminosity block  ------------
-void
-TreeProducer_AOD::endLuminosityBlock(edm::LuminosityBlock const&, edm::EventSetup const&)
-{
-}
-
 // ------------ method fills 'descriptions' with the allowed parameters for the module  ------------
 void
 TreeProducer_AOD::fillDescriptions(edm::ConfigurationDescriptions& descriptions) {